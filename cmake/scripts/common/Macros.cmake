@@ -120,6 +120,14 @@ function(core_add_test_library name)
   endforeach()
 endfunction()
 
+# Add sources to the list of microbenchmarks of the bench target (ENABLE_BENCHMARKS)
+function(core_add_bench_sources)
+  foreach(src IN LISTS SOURCES)
+    get_filename_component(src_path "${src}" ABSOLUTE)
+    set(bench_sources "${src_path}" ${bench_sources} CACHE STRING "" FORCE)
+  endforeach()
+endfunction()
+
 # Add addon dev kit headers to main application
 # Arguments:
 #   name name of the header part to add
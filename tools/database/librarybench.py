@@ -0,0 +1,506 @@
+#!/usr/bin/env python3
+#
+#  Copyright (C) 2024 Team Kodi
+#  This file is part of Kodi - https://kodi.tv
+#
+#  SPDX-License-Identifier: GPL-2.0-or-later
+#  See LICENSES/README.md for more information.
+#
+
+"""Fill Kodi library databases with synthetic items and time the queries the library nodes use.
+
+The databases have to be created by the Kodi build under test (start it once with an empty
+profile), so that tables, views and indices are exactly the ones to be measured. The tool only
+adds rows, the generated items are marked by their paths below synthetic://.
+
+  librarybench.py generate --video MyVideosXYZ.db --movies 20000 --shows 500
+  librarybench.py generate --music MyMusicXYZ.db --songs 100000
+  librarybench.py run --video MyVideosXYZ.db --music MyMusicXYZ.db --explain --json out.json
+"""
+
+import argparse
+import json
+import random
+import sqlite3
+import statistics
+import sys
+import time
+
+PATH_ROOT = 'synthetic://'
+VIDEODB_MAX_COLUMNS = 24
+
+GENRES = ['Action', 'Adventure', 'Animation', 'Comedy', 'Crime', 'Documentary', 'Drama',
+          'Family', 'Fantasy', 'History', 'Horror', 'Music', 'Mystery', 'Romance',
+          'Science Fiction', 'Thriller', 'War', 'Western', 'Blues', 'Classical', 'Electronic',
+          'Folk', 'Hip-Hop', 'Jazz', 'Metal', 'Pop', 'Punk', 'Reggae', 'Rock', 'Soul']
+WORDS = ['alpha', 'bridge', 'crimson', 'delta', 'echo', 'falcon', 'garden', 'harbor', 'island',
+         'jungle', 'kingdom', 'lantern', 'meadow', 'night', 'ocean', 'planet', 'quartz', 'river',
+         'shadow', 'tower', 'umbra', 'valley', 'winter', 'xenon', 'yonder', 'zephyr']
+
+# the queries below mirror what CVideoDatabase and CMusicDatabase execute for the library nodes,
+# smart playlists and searches, with the filters the GUI applies by default
+VIDEO_QUERIES = [
+    ('movies', "SELECT * FROM movie_view"),
+    ('movies/recentlyadded',
+     "SELECT * FROM movie_view ORDER BY dateAdded DESC, idMovie DESC LIMIT 25"),
+    ('movies/genres',
+     "SELECT genre.genre_id, genre.name, count(1), count(files.playCount) FROM genre "
+     "JOIN genre_link ON genre.genre_id = genre_link.genre_id "
+     "JOIN movie_view ON genre_link.media_id = movie_view.idMovie "
+     "AND genre_link.media_type='movie' "
+     "JOIN files ON files.idFile = movie_view.idFile GROUP BY genre.genre_id"),
+    ('movies/years',
+     "SELECT DISTINCT movie_view.premiered, count(1), count(files.playCount) FROM movie_view "
+     "JOIN files ON files.idFile = movie_view.idFile GROUP BY movie_view.premiered"),
+    ('movies/actors',
+     "SELECT actor.actor_id, actor.name, actor.art_urls, count(1), count(files.playCount) "
+     "FROM actor JOIN actor_link ON actor.actor_id = actor_link.actor_id "
+     "JOIN movie_view ON actor_link.media_id = movie_view.idMovie "
+     "AND actor_link.media_type='movie' "
+     "JOIN files ON files.idFile = movie_view.idFile GROUP BY actor.actor_id"),
+    ('movies/genres/<id>',
+     "SELECT * FROM movie_view JOIN genre_link ON genre_link.media_id = movie_view.idMovie "
+     "AND genre_link.media_type='movie' WHERE genre_link.genre_id = {genre_id}"),
+    ('smartplaylist: genre is, unwatched',
+     "SELECT * FROM movie_view WHERE EXISTS (SELECT 1 FROM genre_link "
+     "JOIN genre ON genre.genre_id=genre_link.genre_id "
+     "WHERE genre_link.media_id=movie_view.idMovie AND genre.name = '{genre}' "
+     "AND genre_link.media_type = 'movie') AND movie_view.playCount IS NULL"),
+    ('search: movies', "SELECT * FROM movie_view WHERE c00 LIKE '%{word}%'"),
+    ('search: actors',
+     "SELECT DISTINCT actor.actor_id, actor.name FROM actor "
+     "INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id "
+     "INNER JOIN movie ON actor_link.media_id=movie.idMovie "
+     "WHERE actor_link.media_type='movie' AND actor.name LIKE '%{word}%'"),
+    ('tvshows', "SELECT * FROM tvshow_view"),
+    ('tvshows/<id>', "SELECT * FROM season_view WHERE idShow = {show_id}"),
+    ('tvshows/<id>/<season>',
+     "SELECT * FROM episode_view WHERE idShow = {show_id} AND idSeason = {season_id}"),
+    ('tvshows/recentlyadded',
+     "SELECT * FROM episode_view ORDER BY dateAdded DESC, idEpisode DESC LIMIT 25"),
+    ('tvshows/inprogress',
+     "SELECT * FROM tvshow_view WHERE totalCount != watchedCount AND watchedCount > 0"),
+]
+
+MUSIC_QUERIES = [
+    ('artists',
+     "SELECT artistview.* FROM artistview WHERE EXISTS (SELECT 1 FROM album_artist "
+     "WHERE album_artist.idArtist = artistview.idArtist) AND artistview.idArtist > 1"),
+    ('albums', "SELECT albumview.* FROM albumview"),
+    ('songs', "SELECT songview.* FROM songview"),
+    ('genres',
+     "SELECT genre.idGenre, genre.strGenre FROM genre WHERE EXISTS (SELECT 1 FROM song_genre "
+     "WHERE song_genre.idGenre = genre.idGenre)"),
+    ('genres/<id>/artists',
+     "SELECT artistview.* FROM artistview WHERE EXISTS (SELECT 1 FROM song_artist "
+     "JOIN song_genre ON song_genre.idSong = song_artist.idSong "
+     "WHERE song_artist.idArtist = artistview.idArtist AND song_genre.idGenre = {genre_id})"),
+    ('artists/<id>/albums',
+     "SELECT albumview.*, albumartistview.* FROM albumview "
+     "JOIN albumartistview ON albumview.idAlbum = albumartistview.idAlbum "
+     "WHERE albumview.idAlbum IN (SELECT idAlbum FROM album_artist "
+     "WHERE idArtist = {artist_id})"),
+    ('albums/<id>/songs',
+     "SELECT songview.*, songartistview.* FROM songview "
+     "JOIN songartistview ON songview.idSong = songartistview.idSong "
+     "WHERE songview.idAlbum = {album_id}"),
+    ('years',
+     "SELECT DISTINCT CAST(strReleaseDate AS INTEGER) FROM album WHERE strReleaseDate != ''"),
+    ('recentlyaddedalbums',
+     "SELECT albumview.*, albumartistview.* FROM (SELECT idAlbum FROM album "
+     "WHERE strAlbum != '' ORDER BY dateAdded DESC LIMIT 25) AS recentalbums "
+     "JOIN albumview ON albumview.idAlbum = recentalbums.idAlbum "
+     "JOIN albumartistview ON albumview.idAlbum = albumartistview.idAlbum "
+     "ORDER BY dateAdded DESC, albumview.idAlbum desc, albumartistview.iOrder"),
+    ('recentlyplayedalbums',
+     "SELECT albumview.*, albumartistview.* FROM (SELECT idAlbum FROM albumview "
+     "WHERE albumview.lastplayed IS NOT NULL AND albumview.strReleaseType = 'album' "
+     "ORDER BY albumview.lastplayed DESC LIMIT 25) as playedalbums "
+     "JOIN albumview ON albumview.idAlbum = playedalbums.idAlbum "
+     "JOIN albumartistview ON albumview.idAlbum = albumartistview.idAlbum "
+     "ORDER BY albumview.lastplayed DESC, albumartistview.iorder"),
+    ('topalbums',
+     "SELECT albumview.*, albumartistview.* FROM (SELECT albumview.idAlbum FROM albumview "
+     "WHERE albumview.strAlbum != '' AND albumview.iTimesPlayed>0 "
+     "ORDER BY albumview.iTimesPlayed DESC LIMIT 100) AS top "
+     "JOIN albumview ON albumview.idAlbum = top.idAlbum "
+     "JOIN albumartistview ON albumview.idAlbum = albumartistview.idAlbum "
+     "ORDER BY albumview.iTimesPlayed DESC, albumartistview.iOrder"),
+    ('recentlyplayedsongs',
+     "SELECT songview.* FROM songview WHERE lastplayed IS NOT NULL "
+     "ORDER BY lastplayed DESC LIMIT 25"),
+    ('topsongs',
+     "SELECT songview.* FROM songview WHERE iTimesPlayed > 0 ORDER BY iTimesPlayed DESC "
+     "LIMIT 100"),
+    ('smartplaylist: genre is, rating above',
+     "SELECT songview.* FROM songview WHERE EXISTS (SELECT 1 FROM song_genre "
+     "JOIN genre ON genre.idGenre = song_genre.idGenre "
+     "WHERE song_genre.idSong = songview.idSong AND genre.strGenre = '{genre}') "
+     "AND songview.rating > 5"),
+    ('search: songs', "SELECT * FROM songview WHERE strTitle LIKE '%{word}%' LIMIT 1000"),
+    ('search: albums', "SELECT * FROM albumview WHERE strAlbum LIKE '%{word}%' LIMIT 1000"),
+    ('search: artists',
+     "SELECT * FROM artist WHERE (strArtist LIKE '%{word}%' OR strArtist LIKE '% {word}%') "
+     "AND idArtist <> 1"),
+]
+
+
+def title(rnd, words):
+    return ' '.join(rnd.choice(WORDS).capitalize() for _ in range(words))
+
+
+def date(rnd, years=10):
+    seconds = int(time.time()) - rnd.randrange(years * 365 * 24 * 3600)
+    return time.strftime('%Y-%m-%d %H:%M:%S', time.gmtime(seconds))
+
+
+def next_id(db, table, column):
+    return (db.execute(f'SELECT max({column}) FROM {table}').fetchone()[0] or 0) + 1
+
+
+def video_columns(values):
+    columns = ['NULL'] * VIDEODB_MAX_COLUMNS
+    for index, value in values.items():
+        columns[index] = value
+    return columns
+
+
+class VideoGenerator:
+    def __init__(self, db, rnd, args):
+        self.db = db
+        self.rnd = rnd
+        self.args = args
+
+    def generate(self):
+        self.genres = self.add_names('genre', 'genre_id', GENRES[:18])
+        self.countries = self.add_names('country', 'country_id',
+                                        [f'Country {i}' for i in range(40)])
+        self.studios = self.add_names('studio', 'studio_id', [f'Studio {i}' for i in range(200)])
+        actors = max(100, (self.args.movies + self.args.shows) * 4)
+        self.actors = self.add_names('actor', 'actor_id',
+                                     [f'{title(self.rnd, 2)} {i}' for i in range(actors)])
+        self.path = next_id(self.db, 'path', 'idPath')
+        self.file = next_id(self.db, 'files', 'idFile')
+        self.rating = next_id(self.db, 'rating', 'rating_id')
+        self.uniqueid = next_id(self.db, 'uniqueid', 'uniqueid_id')
+        self.add_movies()
+        self.add_shows()
+
+    def add_names(self, table, column, names):
+        first = next_id(self.db, table, column)
+        self.db.executemany(f'INSERT INTO {table} ({column}, name) VALUES (?, ?)',
+                            [(first + i, f'{name} #{first + i}') for i, name in enumerate(names)])
+        return list(range(first, first + len(names)))
+
+    def add_path(self, path, parent=None, content=None):
+        self.db.execute('INSERT INTO path (idPath, strPath, strContent, idParentPath, dateAdded) '
+                        'VALUES (?, ?, ?, ?, ?)', (self.path, path, content, parent,
+                                                   date(self.rnd)))
+        self.path += 1
+        return self.path - 1
+
+    def add_file(self, path_id, filename):
+        played = self.rnd.random() < 0.3
+        self.db.execute('INSERT INTO files (idFile, idPath, strFilename, playCount, lastPlayed, '
+                        'dateAdded) VALUES (?, ?, ?, ?, ?, ?)',
+                        (self.file, path_id, filename, 1 if played else None,
+                         date(self.rnd, 2) if played else None, date(self.rnd)))
+        self.db.execute('INSERT INTO streamdetails (idFile, iStreamType, strVideoCodec, '
+                        'iVideoWidth, iVideoHeight, iVideoDuration) VALUES (?, 0, ?, ?, ?, ?)',
+                        (self.file, self.rnd.choice(['h264', 'hevc']),
+                         self.rnd.choice([1280, 1920, 3840]), 1080,
+                         self.rnd.randrange(1200, 9000)))
+        self.file += 1
+        return self.file - 1
+
+    def add_details(self, media_id, media_type):
+        rating = self.rating
+        self.db.execute('INSERT INTO rating (rating_id, media_id, media_type, rating_type, rating, '
+                        'votes) VALUES (?, ?, ?, ?, ?, ?)',
+                        (rating, media_id, media_type, 'default',
+                         round(self.rnd.uniform(1, 10), 1), self.rnd.randrange(10000)))
+        self.rating += 1
+        uniqueid = self.uniqueid
+        self.db.execute('INSERT INTO uniqueid (uniqueid_id, media_id, media_type, value, type) '
+                        'VALUES (?, ?, ?, ?, ?)',
+                        (uniqueid, media_id, media_type, f'tt{media_id:07d}', 'imdb'))
+        self.uniqueid += 1
+        for art in ('poster', 'fanart'):
+            self.db.execute('INSERT INTO art (media_id, media_type, type, url) VALUES (?, ?, ?, ?)',
+                            (media_id, media_type, art, f'{PATH_ROOT}art/{media_type}/{media_id}/'
+                             f'{art}.jpg'))
+        for table, ids, count in (('genre', self.genres, 3), ('country', self.countries, 1),
+                                  ('studio', self.studios, 1)):
+            self.db.executemany(f'INSERT INTO {table}_link ({table}_id, media_id, media_type) '
+                                'VALUES (?, ?, ?)', [(link, media_id, media_type)
+                                                     for link in self.rnd.sample(ids, count)])
+        cast = self.rnd.sample(self.actors, min(10, len(self.actors)))
+        self.db.executemany('INSERT INTO actor_link (actor_id, media_id, media_type, role, '
+                            'cast_order) VALUES (?, ?, ?, ?, ?)',
+                            [(actor, media_id, media_type, title(self.rnd, 1), order)
+                             for order, actor in enumerate(cast)])
+        for table in ('director_link', 'writer_link'):
+            self.db.execute(f'INSERT INTO {table} (actor_id, media_id, media_type) '
+                            'VALUES (?, ?, ?)', (self.rnd.choice(self.actors), media_id, media_type))
+        return rating, uniqueid
+
+    def add_movies(self):
+        root = self.add_path(f'{PATH_ROOT}movies/', content='movies')
+        movie = next_id(self.db, 'movie', 'idMovie')
+        placeholders = ', '.join('?' * (VIDEODB_MAX_COLUMNS + 3))
+        for i in range(self.args.movies):
+            path = self.add_path(f'{PATH_ROOT}movies/{movie}/', root)
+            file = self.add_file(path, f'movie{movie}.mkv')
+            rating, uniqueid = self.add_details(movie, 'movie')
+            name = title(self.rnd, 3)
+            columns = video_columns({0: name, 1: title(self.rnd, 30), 5: rating, 9: uniqueid,
+                                     10: name, 11: self.rnd.randrange(4800, 10800), 12: 'PG-13',
+                                     14: ' / '.join(self.rnd.sample(GENRES[:18], 3)),
+                                     22: f'{PATH_ROOT}movies/{movie}/', 23: root})
+            premiered = f'{self.rnd.randrange(1950, 2025)}-01-01'
+            self.db.execute(f'INSERT INTO movie (idMovie, idFile, {self.column_list()}, '
+                            f'premiered) VALUES ({placeholders})',
+                            [movie, file] + columns + [premiered])
+            movie += 1
+            self.progress('movies', i)
+
+    def add_shows(self):
+        root = self.add_path(f'{PATH_ROOT}tvshows/', content='tvshows')
+        show = next_id(self.db, 'tvshow', 'idShow')
+        season = next_id(self.db, 'seasons', 'idSeason')
+        episode = next_id(self.db, 'episode', 'idEpisode')
+        placeholders = ', '.join('?' * (VIDEODB_MAX_COLUMNS + 1))
+        episode_placeholders = ', '.join('?' * (VIDEODB_MAX_COLUMNS + 4))
+        for i in range(self.args.shows):
+            path = self.add_path(f'{PATH_ROOT}tvshows/{show}/', root)
+            rating, uniqueid = self.add_details(show, 'tvshow')
+            name = title(self.rnd, 2)
+            columns = video_columns({0: name, 1: title(self.rnd, 30), 4: rating, 5: date(self.rnd),
+                                     8: ' / '.join(self.rnd.sample(GENRES[:18], 2)),
+                                     12: uniqueid, 15: name})
+            self.db.execute(f'INSERT INTO tvshow (idShow, {self.column_list()}) '
+                            f'VALUES ({placeholders})', [show] + columns)
+            self.db.execute('INSERT INTO tvshowlinkpath (idShow, idPath) VALUES (?, ?)',
+                            (show, path))
+            for number in range(1, self.args.seasons + 1):
+                self.db.execute('INSERT INTO seasons (idSeason, idShow, season) VALUES (?, ?, ?)',
+                                (season, show, number))
+                for number_episode in range(1, self.args.episodes + 1):
+                    file = self.add_file(path, f'S{number:02d}E{number_episode:02d}.mkv')
+                    rating, uniqueid = self.add_details(episode, 'episode')
+                    columns = video_columns({0: title(self.rnd, 3), 1: title(self.rnd, 20),
+                                             3: rating, 5: date(self.rnd), 9: 2700,
+                                             12: number, 13: number_episode, 15: number,
+                                             16: number_episode, 18: f'{PATH_ROOT}tvshows/{show}/',
+                                             19: path})
+                    self.db.execute(f'INSERT INTO episode (idEpisode, idFile, '
+                                    f'{self.column_list()}, idShow, idSeason) '
+                                    f'VALUES ({episode_placeholders})',
+                                    [episode, file] + columns + [show, season])
+                    episode += 1
+                season += 1
+            show += 1
+            self.progress('tvshows', i)
+
+    @staticmethod
+    def column_list():
+        return ', '.join(f'c{i:02d}' for i in range(VIDEODB_MAX_COLUMNS))
+
+    def progress(self, what, i):
+        if (i + 1) % 1000 == 0:
+            print(f'  {i + 1} {what}', file=sys.stderr)
+
+
+class MusicGenerator:
+    def __init__(self, db, rnd, args):
+        self.db = db
+        self.rnd = rnd
+        self.args = args
+
+    def generate(self):
+        songs_per_album = max(1, self.args.songs_per_album)
+        albums = max(1, self.args.songs // songs_per_album)
+        artists = max(1, albums // max(1, self.args.albums_per_artist))
+
+        genre = next_id(self.db, 'genre', 'idGenre')
+        genres = list(range(genre, genre + len(GENRES)))
+        self.db.executemany('INSERT INTO genre (idGenre, strGenre) VALUES (?, ?)',
+                            [(genre + i, f'{name} #{genre + i}') for i, name in enumerate(GENRES)])
+
+        artist = next_id(self.db, 'artist', 'idArtist')
+        artist_ids = list(range(artist, artist + artists))
+        self.db.executemany('INSERT INTO artist (idArtist, strArtist, strSortName, '
+                            'strMusicBrainzArtistID, dateAdded) VALUES (?, ?, ?, ?, ?)',
+                            [(a, f'{title(self.rnd, 2)} {a}', None, f'synthetic-{a}',
+                              date(self.rnd)) for a in artist_ids])
+
+        album = next_id(self.db, 'album', 'idAlbum')
+        song = next_id(self.db, 'song', 'idSong')
+        path = next_id(self.db, 'path', 'idPath')
+        for i in range(albums):
+            album_artist = artist_ids[i % artists]
+            artist_name = self.db.execute('SELECT strArtist FROM artist WHERE idArtist = ?',
+                                          (album_artist,)).fetchone()[0]
+            album_genres = self.rnd.sample(genres, 2)
+            genre_names = ' / '.join(GENRES[g - genre] for g in album_genres)
+            year = str(self.rnd.randrange(1950, 2025))
+            added = date(self.rnd)
+            self.db.execute('INSERT INTO album (idAlbum, strAlbum, strMusicBrainzAlbumID, '
+                            'strArtistDisp, strGenres, strReleaseDate, strType, strReleaseType, '
+                            'fRating, dateAdded) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)',
+                            (album, title(self.rnd, 3), f'synthetic-{album}', artist_name,
+                             genre_names, year, 'album', 'album', self.rnd.uniform(0, 10), added))
+            self.db.execute('INSERT INTO album_artist (idArtist, idAlbum, iOrder, strArtist) '
+                            'VALUES (?, ?, 0, ?)', (album_artist, album, artist_name))
+            self.db.execute('INSERT INTO path (idPath, strPath) VALUES (?, ?)',
+                            (path, f'{PATH_ROOT}music/{album_artist}/{album}/'))
+            for track in range(1, songs_per_album + 1):
+                played = self.rnd.random() < 0.2
+                self.db.execute('INSERT INTO song (idSong, idAlbum, idPath, strArtistDisp, '
+                                'strGenres, strTitle, iTrack, iDuration, strReleaseDate, '
+                                'strFileName, strMusicBrainzTrackID, iTimesPlayed, lastplayed, '
+                                'rating, dateAdded) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, '
+                                '?, ?, ?)',
+                                (song, album, path, artist_name, genre_names,
+                                 title(self.rnd, 3), track, self.rnd.randrange(120, 480), year,
+                                 f'{track:02d}.flac', f'synthetic-{song}',
+                                 self.rnd.randrange(1, 50) if played else 0,
+                                 date(self.rnd, 2) if played else None,
+                                 self.rnd.uniform(0, 10), added))
+                self.db.execute('INSERT INTO song_artist (idArtist, idSong, idRole, iOrder, '
+                                'strArtist) VALUES (?, ?, 1, 0, ?)',
+                                (album_artist, song, artist_name))
+                self.db.executemany('INSERT INTO song_genre (idGenre, idSong, iOrder) '
+                                    'VALUES (?, ?, ?)',
+                                    [(g, song, order) for order, g in enumerate(album_genres)])
+                song += 1
+            album += 1
+            path += 1
+            if (i + 1) % 1000 == 0:
+                print(f'  {i + 1} albums', file=sys.stderr)
+
+
+def open_db(path):
+    db = sqlite3.connect(path)
+    tables = {row[0] for row in db.execute("SELECT name FROM sqlite_master WHERE type='table'")}
+    return db, tables
+
+
+def generate(args):
+    rnd = random.Random(args.seed)
+    if args.video:
+        db, tables = open_db(args.video)
+        if 'movie' not in tables:
+            sys.exit(f'{args.video} is not a video database created by Kodi')
+        print(f'generating {args.movies} movies and {args.shows} tv shows into {args.video}',
+              file=sys.stderr)
+        with db:
+            VideoGenerator(db, rnd, args).generate()
+        db.execute('ANALYZE')
+        db.close()
+    if args.music:
+        db, tables = open_db(args.music)
+        if 'song' not in tables:
+            sys.exit(f'{args.music} is not a music database created by Kodi')
+        print(f'generating {args.songs} songs into {args.music}', file=sys.stderr)
+        with db:
+            MusicGenerator(db, rnd, args).generate()
+        db.execute('ANALYZE')
+        db.close()
+
+
+def parameters(db, kind):
+    """Pick existing ids and names for the queries that show a single item"""
+    def first(sql):
+        row = db.execute(sql).fetchone()
+        return row[0] if row else 0
+
+    if kind == 'video':
+        show = first('SELECT idShow FROM tvshow ORDER BY idShow DESC LIMIT 1')
+        return {'genre_id': first('SELECT genre_id FROM genre LIMIT 1'),
+                'genre': first('SELECT name FROM genre LIMIT 1'),
+                'show_id': show,
+                'season_id': first(f'SELECT idSeason FROM seasons WHERE idShow = {show} LIMIT 1'),
+                'word': WORDS[3]}
+    return {'genre_id': first('SELECT idGenre FROM genre LIMIT 1'),
+            'genre': first('SELECT strGenre FROM genre LIMIT 1'),
+            'artist_id': first('SELECT idArtist FROM album_artist LIMIT 1'),
+            'album_id': first('SELECT idAlbum FROM album ORDER BY idAlbum DESC LIMIT 1'),
+            'word': WORDS[3]}
+
+
+def run_queries(path, kind, queries, args):
+    db = sqlite3.connect(path)
+    values = parameters(db, kind)
+    results = []
+    for name, query in queries:
+        sql = query.format(**values)
+        timings = []
+        rows = 0
+        for _ in range(args.runs):
+            start = time.perf_counter()
+            rows = len(db.execute(sql).fetchall())
+            timings.append((time.perf_counter() - start) * 1000)
+        result = {'database': kind, 'query': name, 'rows': rows,
+                  'median_ms': round(statistics.median(timings), 3),
+                  'min_ms': round(min(timings), 3), 'max_ms': round(max(timings), 3)}
+        if args.explain:
+            result['plan'] = [row[3] for row in db.execute(f'EXPLAIN QUERY PLAN {sql}')]
+        if args.sql:
+            result['sql'] = sql
+        results.append(result)
+
+        print(f'{kind:5} {name:42} {rows:8} rows {result["median_ms"]:10.2f} ms')
+        for step in result.get('plan', []):
+            print(f'        {step}')
+    db.close()
+    return results
+
+
+def run(args):
+    results = []
+    if args.video:
+        results += run_queries(args.video, 'video', VIDEO_QUERIES, args)
+    if args.music:
+        results += run_queries(args.music, 'music', MUSIC_QUERIES, args)
+    if args.json:
+        with open(args.json, 'w') as output:
+            json.dump({'sqlite': sqlite3.sqlite_version, 'runs': args.runs, 'queries': results},
+                      output, indent=2)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest='command', required=True)
+
+    gen = commands.add_parser('generate', help='add synthetic items to the databases')
+    gen.add_argument('--video', help='MyVideos*.db created by Kodi')
+    gen.add_argument('--music', help='MyMusic*.db created by Kodi')
+    gen.add_argument('--movies', type=int, default=10000)
+    gen.add_argument('--shows', type=int, default=200)
+    gen.add_argument('--seasons', type=int, default=4, help='seasons per tv show')
+    gen.add_argument('--episodes', type=int, default=12, help='episodes per season')
+    gen.add_argument('--songs', type=int, default=100000)
+    gen.add_argument('--songs-per-album', type=int, default=12)
+    gen.add_argument('--albums-per-artist', type=int, default=4)
+    gen.add_argument('--seed', type=int, default=1, help='the same seed creates the same items')
+    gen.set_defaults(func=generate)
+
+    bench = commands.add_parser('run', help='time the library queries')
+    bench.add_argument('--video', help='MyVideos*.db')
+    bench.add_argument('--music', help='MyMusic*.db')
+    bench.add_argument('--runs', type=int, default=5, help='runs per query, the median is shown')
+    bench.add_argument('--explain', action='store_true', help='show the query plans')
+    bench.add_argument('--sql', action='store_true', help='include the statements in the json')
+    bench.add_argument('--json', help='write the results to this file')
+    bench.set_defaults(func=run)
+
+    args = parser.parse_args()
+    if not args.video and not args.music:
+        parser.error('at least one of --video and --music is required')
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
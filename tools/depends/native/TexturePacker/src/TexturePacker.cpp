@@ -98,6 +98,8 @@ void Usage()
   puts("  -input <dir>     Input directory. Default: current dir");
   puts("  -output <dir>    Output directory/filename. Default: Textures.xbt");
   puts("  -dupecheck       Enable duplicate file detection. Reduces output file size. Default: off");
+  puts("  -uncompressed    Store images without lzo compression. Larger output file, but images can");
+  puts("                   be used straight from the memory mapped file. Default: off");
   puts("  -verbose         Verbose");
 }
 
@@ -409,6 +411,10 @@ int main(int argc, char* argv[])
     {
       texturePacker.EnableDupeCheck();
     }
+    else if (!strcmp(args[i], "-uncompressed"))
+    {
+      texturePacker.SetFlags(0);
+    }
     else if (!strcmp(args[i], "-verbose"))
     {
       texturePacker.EnableVerboseOutput();
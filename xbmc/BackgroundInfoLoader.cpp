@@ -13,8 +13,20 @@
 #include "threads/Thread.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <chrono>
 #include <mutex>
 
+using namespace std::chrono_literals;
+
+namespace
+{
+// how often the loader catches up with the items shown by the container
+constexpr auto RESCAN_INTERVAL = 100ms;
+// items are loaded in batches, so that loaders can fetch their details with one query per batch
+constexpr size_t LOAD_BATCH_SIZE = 25;
+} // unnamed namespace
+
 CBackgroundInfoLoader::CBackgroundInfoLoader() = default;
 
 CBackgroundInfoLoader::~CBackgroundInfoLoader()
@@ -38,48 +50,10 @@ void CBackgroundInfoLoader::Run()
       OnLoaderStart();
 
       // Stage 1: All "fast" stuff we have already cached
-      for (std::vector<CFileItemPtr>::const_iterator iter = m_vecItems.begin(); iter != m_vecItems.end(); ++iter)
-      {
-        const CFileItemPtr& pItem = *iter;
-
-        // Ask the callback if we should abort
-        if ((m_pProgressCallback && m_pProgressCallback->Abort()) || m_bStop)
-          break;
-
-        try
-        {
-          if (LoadItemCached(pItem.get()) && m_pObserver)
-            m_pObserver->OnItemLoaded(pItem.get());
-        }
-        catch (...)
-        {
-          CLog::Log(LOGERROR,
-                    "CBackgroundInfoLoader::LoadItemCached - Unhandled exception for item {}",
-                    CURL::GetRedacted(pItem->GetPath()));
-        }
-      }
+      LoadItems(false);
 
       // Stage 2: All "slow" stuff that we need to lookup
-      for (std::vector<CFileItemPtr>::const_iterator iter = m_vecItems.begin(); iter != m_vecItems.end(); ++iter)
-      {
-        const CFileItemPtr& pItem = *iter;
-
-        // Ask the callback if we should abort
-        if ((m_pProgressCallback && m_pProgressCallback->Abort()) || m_bStop)
-          break;
-
-        try
-        {
-          if (LoadItemLookup(pItem.get()) && m_pObserver)
-            m_pObserver->OnItemLoaded(pItem.get());
-        }
-        catch (...)
-        {
-          CLog::Log(LOGERROR,
-                    "CBackgroundInfoLoader::LoadItemLookup - Unhandled exception for item {}",
-                    CURL::GetRedacted(pItem->GetPath()));
-        }
-      }
+      LoadItems(true);
     }
 
     OnLoaderFinish();
@@ -92,6 +66,97 @@ void CBackgroundInfoLoader::Run()
   Reset();
 }
 
+void CBackgroundInfoLoader::LoadItems(bool lookup)
+{
+  const size_t count = m_vecItems.size();
+  std::vector<bool> done(count, false);
+  size_t next = 0; // the next item in list order
+  std::vector<size_t> shown; // the items shown by a container, most recently shown first
+  size_t nextShown = 0;
+  auto rescanTime = std::chrono::steady_clock::now();
+
+  std::vector<size_t> batch;
+  while (true)
+  {
+    // Ask the callback if we should abort
+    if ((m_pProgressCallback && m_pProgressCallback->Abort()) || m_bStop)
+      break;
+
+    // follow the container, so that the items the user looks at are loaded first
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= rescanTime)
+    {
+      shown.clear();
+      for (size_t i = next; i < count; ++i)
+      {
+        if (!done[i] && m_vecItems[i]->GetShownTime() > 0)
+          shown.push_back(i);
+      }
+      std::stable_sort(shown.begin(), shown.end(), [this](size_t a, size_t b) {
+        return m_vecItems[a]->GetShownTime() > m_vecItems[b]->GetShownTime();
+      });
+      nextShown = 0;
+      rescanTime = now + RESCAN_INTERVAL;
+    }
+
+    batch.clear();
+    while (batch.size() < LOAD_BATCH_SIZE)
+    {
+      while (nextShown < shown.size() && done[shown[nextShown]])
+        ++nextShown;
+      if (nextShown < shown.size())
+        batch.push_back(shown[nextShown++]);
+      else
+      {
+        while (next < count && done[next])
+          ++next;
+        if (next == count)
+          break;
+        batch.push_back(next++);
+      }
+      done[batch.back()] = true;
+    }
+    if (batch.empty())
+      break;
+
+    if (!lookup)
+    {
+      std::vector<CFileItem*> items;
+      items.reserve(batch.size());
+      for (const size_t index : batch)
+        items.push_back(m_vecItems[index].get());
+
+      try
+      {
+        PrepareItemsCached(items);
+      }
+      catch (...)
+      {
+        CLog::Log(LOGERROR, "CBackgroundInfoLoader::PrepareItemsCached - Unhandled exception");
+      }
+    }
+
+    for (const size_t index : batch)
+    {
+      if ((m_pProgressCallback && m_pProgressCallback->Abort()) || m_bStop)
+        return;
+
+      const CFileItemPtr& pItem = m_vecItems[index];
+      try
+      {
+        if ((lookup ? LoadItemLookup(pItem.get()) : LoadItemCached(pItem.get())) && m_pObserver)
+          m_pObserver->OnItemLoaded(pItem.get());
+      }
+      catch (...)
+      {
+        CLog::Log(LOGERROR, "CBackgroundInfoLoader::{} - Unhandled exception for item {}",
+                  lookup ? "LoadItemLookup" : "LoadItemCached",
+                  CURL::GetRedacted(pItem->GetPath()));
+      }
+    }
+  }
+}
+
 void CBackgroundInfoLoader::Load(CFileItemList& items)
 {
   StopThread();
@@ -48,6 +48,12 @@ protected:
   virtual void OnLoaderStart() {}
   virtual void OnLoaderFinish() {}
 
+  /*!
+   * \brief Called before a batch of items is passed to LoadItemCached, e.g. to fetch the details
+   * of all of them with a single database query instead of one per item
+   */
+  virtual void PrepareItemsCached(const std::vector<CFileItem*>& items) {}
+
   CFileItemList* m_pVecItems{nullptr};
   std::vector<CFileItemPtr> m_vecItems; // FileItemList would delete the items and we only want to keep a reference.
   CCriticalSection m_lock;
@@ -61,5 +67,12 @@ protected:
 
 private:
   void Reset();
+
+  /*!
+   * \brief Load all items, the ones most recently shown by a container first and the others in
+   * list order. Items that scroll out of view are left for later as soon as others are shown.
+   * \param lookup whether to look up the "slow" details rather than the cached ones
+   */
+  void LoadItems(bool lookup);
 };
 
@@ -8,9 +8,11 @@
 
 #include "DatabaseManager.h"
 
+#include "LibraryChangeMonitor.h"
 #include "ServiceBroker.h"
 #include "TextureDatabase.h"
 #include "addons/AddonDatabase.h"
+#include "dbwrappers/dataset.h"
 #include "music/MusicDatabase.h"
 #include "pvr/PVRDatabase.h"
 #include "pvr/epg/EpgDatabase.h"
@@ -20,10 +22,22 @@
 #include "video/VideoDatabase.h"
 #include "view/ViewDatabase.h"
 
+#include <algorithm>
+#include <iterator>
 #include <mutex>
 
 using namespace PVR;
 
+using namespace std::chrono_literals;
+
+namespace
+{
+// idle connections kept per database, enough for the GUI, a scanner and a few jobs at once
+constexpr size_t MAX_POOLED_CONNECTIONS_PER_DATABASE = 4;
+// idle connections older than this are closed, so that the database files aren't held open
+constexpr auto POOLED_CONNECTION_LIFETIME = 60s;
+} // unnamed namespace
+
 CDatabaseManager::CDatabaseManager() :
   m_bIsUpgrading(false)
 {
@@ -32,10 +46,21 @@ CDatabaseManager::CDatabaseManager() :
   UpdateDatabase(db);
 }
 
-CDatabaseManager::~CDatabaseManager() = default;
+CDatabaseManager::~CDatabaseManager()
+{
+  if (m_changeMonitor)
+    m_changeMonitor->Stop();
+
+  ClosePooledConnections();
+}
 
 void CDatabaseManager::Initialize()
 {
+  // the profile may have changed, stop following and connecting to the databases of the old one
+  if (m_changeMonitor)
+    m_changeMonitor->Stop();
+  ClosePooledConnections();
+
   std::unique_lock<CCriticalSection> lock(m_section);
 
   m_dbStatus.clear();
@@ -59,6 +84,10 @@ void CDatabaseManager::Initialize()
 
   CLog::Log(LOGDEBUG, "{}, updating databases... DONE", __FUNCTION__);
 
+  if (!m_changeMonitor)
+    m_changeMonitor = std::make_unique<CLibraryChangeMonitor>();
+  m_changeMonitor->Start();
+
   m_bIsUpgrading = false;
 }
 
@@ -244,3 +273,76 @@ void CDatabaseManager::LocalizationChanged()
               __FUNCTION__);
   }
 }
+
+bool CDatabaseManager::AcquireConnection(const std::string& key, Connection& connection)
+{
+  std::vector<PooledConnection> expired = TakeExpiredConnections();
+  for (PooledConnection& pooled : expired)
+    CloseConnection(pooled.connection);
+
+  std::unique_lock<CCriticalSection> lock(m_poolSection);
+  // take the most recently used connection, its caches are the warmest
+  const auto it = std::find_if(m_pool.rbegin(), m_pool.rend(),
+                               [&key](const PooledConnection& pooled) { return pooled.key == key; });
+  if (it == m_pool.rend())
+    return false;
+
+  connection = std::move(it->connection);
+  m_pool.erase(std::next(it).base());
+  return true;
+}
+
+void CDatabaseManager::ReleaseConnection(const std::string& key, Connection connection)
+{
+  std::vector<PooledConnection> expired = TakeExpiredConnections();
+  {
+    std::unique_lock<CCriticalSection> lock(m_poolSection);
+    const auto count = std::count_if(m_pool.begin(), m_pool.end(),
+                                     [&key](const PooledConnection& pooled)
+                                     { return pooled.key == key; });
+    if (static_cast<size_t>(count) < MAX_POOLED_CONNECTIONS_PER_DATABASE)
+    {
+      m_pool.push_back({key, std::move(connection), std::chrono::steady_clock::now()});
+    }
+  }
+
+  if (connection.db)
+    CloseConnection(connection);
+  for (PooledConnection& pooled : expired)
+    CloseConnection(pooled.connection);
+}
+
+void CDatabaseManager::ClosePooledConnections()
+{
+  std::vector<PooledConnection> pool;
+  {
+    std::unique_lock<CCriticalSection> lock(m_poolSection);
+    pool.swap(m_pool);
+  }
+
+  for (PooledConnection& pooled : pool)
+    CloseConnection(pooled.connection);
+}
+
+std::vector<CDatabaseManager::PooledConnection> CDatabaseManager::TakeExpiredConnections()
+{
+  std::vector<PooledConnection> expired;
+
+  std::unique_lock<CCriticalSection> lock(m_poolSection);
+  const auto now = std::chrono::steady_clock::now();
+  const auto it = std::find_if(m_pool.begin(), m_pool.end(),
+                               [&now](const PooledConnection& pooled)
+                               { return now - pooled.released < POOLED_CONNECTION_LIFETIME; });
+  std::move(m_pool.begin(), it, std::back_inserter(expired));
+  m_pool.erase(m_pool.begin(), it);
+  return expired;
+}
+
+void CDatabaseManager::CloseConnection(Connection& connection)
+{
+  // disconnecting may block on the server, so this is never done with the pool locked
+  connection.ds2.reset();
+  connection.ds.reset();
+  connection.db->disconnect();
+  connection.db.reset();
+}
@@ -11,12 +11,22 @@
 #include "threads/CriticalSection.h"
 
 #include <atomic>
+#include <chrono>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 class CDatabase;
+class CLibraryChangeMonitor;
 class DatabaseSettings;
 
+namespace dbiplus
+{
+class Database;
+class Dataset;
+}
+
 /*!
  \ingroup database
  \brief Database manager class for handling database updating
@@ -53,6 +63,41 @@ public:
 
   void LocalizationChanged();
 
+  /*!
+   \brief An open connection to a database together with the datasets of the CDatabase using it
+   */
+  struct Connection
+  {
+    std::unique_ptr<dbiplus::Database> db;
+    std::unique_ptr<dbiplus::Dataset> ds;
+    std::unique_ptr<dbiplus::Dataset> ds2;
+  };
+
+  /*! \brief Take an idle connection from the connection pool.
+
+   Databases are opened and closed for almost every listing, so their connections are kept open
+   for a while after they are closed and handed to the next database opened on any thread.
+
+   \param key identifies the database and the server the connection is for.
+   \param[out] connection the pooled connection, only set if one is available.
+   \return true if a connection was taken from the pool, false otherwise.
+   */
+  bool AcquireConnection(const std::string& key, Connection& connection);
+
+  /*! \brief Hand a connection that is no longer used to the connection pool.
+
+   The connection is closed instead if the pool already holds enough idle connections to the
+   same database.
+
+   \param key identifies the database and the server the connection is for.
+   \param connection the connection, which must not be within a transaction.
+   */
+  void ReleaseConnection(const std::string& key, Connection connection);
+
+  /*! \brief Close all idle connections in the connection pool.
+   */
+  void ClosePooledConnections();
+
 private:
   std::atomic<bool> m_bIsUpgrading;
 
@@ -64,4 +109,18 @@ private:
 
   CCriticalSection            m_section;     ///< Critical section protecting m_dbStatus.
   std::map<std::string, DB_STATUS> m_dbStatus;    ///< Our database status map.
+
+  struct PooledConnection
+  {
+    std::string key;
+    Connection connection;
+    std::chrono::steady_clock::time_point released;
+  };
+  std::vector<PooledConnection> TakeExpiredConnections();
+  static void CloseConnection(Connection& connection);
+
+  CCriticalSection m_poolSection; ///< Critical section protecting m_pool.
+  std::vector<PooledConnection> m_pool; ///< Idle connections, oldest first.
+
+  std::unique_ptr<CLibraryChangeMonitor> m_changeMonitor; ///< Follows changes of shared libraries.
 };
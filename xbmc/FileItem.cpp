@@ -121,6 +121,12 @@ CFileItem::CFileItem(const CVideoInfoTag& movie)
   SetFromVideoInfoTag(movie);
 }
 
+CFileItem::CFileItem(CVideoInfoTag&& movie)
+{
+  Initialize();
+  SetFromVideoInfoTag(std::move(movie));
+}
+
 namespace
 {
 std::string GetEpgTagTitle(const std::shared_ptr<const CPVREpgInfoTag>& epgTag)
@@ -1881,6 +1887,11 @@ void CFileItem::MergeInfo(const CFileItem& item)
 }
 
 void CFileItem::SetFromVideoInfoTag(const CVideoInfoTag &video)
+{
+  SetFromVideoInfoTag(CVideoInfoTag(video));
+}
+
+void CFileItem::SetFromVideoInfoTag(CVideoInfoTag&& video)
 {
   if (!video.m_strTitle.empty())
     SetLabel(video.m_strTitle);
@@ -1896,12 +1907,13 @@ void CFileItem::SetFromVideoInfoTag(const CVideoInfoTag &video)
     m_bIsFolder = false;
   }
 
+  const bool isSpecial = video.m_iSeason == 0;
   if (m_videoInfoTag)
-    *m_videoInfoTag = video;
+    *m_videoInfoTag = std::move(video);
   else
-    m_videoInfoTag = new CVideoInfoTag(video);
+    m_videoInfoTag = new CVideoInfoTag(std::move(video));
 
-  if (video.m_iSeason == 0)
+  if (isSpecial)
     SetProperty("isspecial", "true");
   FillInDefaultIcon();
   FillInMimeType(false);
@@ -2540,13 +2552,12 @@ void CFileItemList::Sort(SortDescription sortDescription)
   if (m_sortIgnoreFolders)
     sortDescription.sortAttributes = (SortAttribute)((int)sortDescription.sortAttributes | SortAttributeIgnoreFolders);
 
-  const Fields fields = SortUtils::GetFieldsForSorting(sortDescription.sortBy);
-  SortItems sortItems((size_t)Size());
+  const Fields& fields = SortUtils::GetFieldsForSorting(sortDescription.sortBy);
+  DatabaseResults sortItems((size_t)Size());
   for (int index = 0; index < Size(); index++)
   {
-    sortItems[index] = std::make_shared<SortItem>();
-    m_items[index]->ToSortable(*sortItems[index], fields);
-    (*sortItems[index])[FieldId] = index;
+    m_items[index]->ToSortable(sortItems[index], fields);
+    sortItems[index][FieldId] = index;
   }
 
   // do the sorting
@@ -2555,13 +2566,13 @@ void CFileItemList::Sort(SortDescription sortDescription)
   // apply the new order to the existing CFileItems
   VECFILEITEMS sortedFileItems;
   sortedFileItems.reserve(Size());
-  for (SortItems::const_iterator it = sortItems.begin(); it != sortItems.end(); ++it)
+  for (const SortItem& sortItem : sortItems)
   {
-    CFileItemPtr item = m_items[(int)(*it)->at(FieldId).asInteger()];
+    CFileItemPtr item = m_items[(int)sortItem.at(FieldId).asInteger()];
     // Set the sort label in the CFileItem
-    item->SetSortLabel((*it)->at(FieldSort).asWideString());
+    item->SetSortLabel(sortItem.at(FieldSort).asWideString());
 
-    sortedFileItems.push_back(item);
+    sortedFileItems.push_back(std::move(item));
   }
 
   // replace the current list with the re-ordered one
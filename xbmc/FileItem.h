@@ -118,6 +118,7 @@ public:
   explicit CFileItem(const CGenre& genre);
   explicit CFileItem(const MUSIC_INFO::CMusicInfoTag& music);
   explicit CFileItem(const CVideoInfoTag& movie);
+  explicit CFileItem(CVideoInfoTag&& movie);
   explicit CFileItem(const std::shared_ptr<PVR::CPVREpgInfoTag>& tag);
   explicit CFileItem(const std::shared_ptr<PVR::CPVREpgSearchFilter>& filter);
   explicit CFileItem(const std::shared_ptr<PVR::CPVRChannelGroupMember>& channelGroupMember);
@@ -595,6 +596,7 @@ public:
    \param video video details to use and set
    */
   void SetFromVideoInfoTag(const CVideoInfoTag &video);
+  void SetFromVideoInfoTag(CVideoInfoTag&& video);
 
   /*! \brief Sets details using the information from the CMusicInfoTag object
   Sets the musicinfotag and uses its information to set the label and path.
@@ -727,6 +729,12 @@ class CFileItemList : public CFileItem
 public:
   enum CACHE_TYPE { CACHE_NEVER = 0, CACHE_IF_SLOW, CACHE_ALWAYS };
 
+  /*!
+   \brief Format version of archived lists, bump it whenever Archive() of the list, its items or
+   their info tags changes. Archives kept across restarts store it and drop lists of another version.
+   */
+  static constexpr int ARCHIVE_VERSION = 1;
+
   CFileItemList();
   explicit CFileItemList(const std::string& strPath);
   ~CFileItemList() override;
@@ -851,6 +851,15 @@ const infomap integer_bools[] =  {{ "isequal",          INTEGER_IS_EQUAL },
 ///     @skinning_v19 **[New Infolabel]** \link Player_Chapters `Player.Chapters`\endlink
 ///     <p>
 ///   }
+///   \table_row3{   <b>`Player.SeekPreview`</b>,
+///                  \anchor Player_SeekPreview
+///                  _string_,
+///     @return The image of the keyframe closest to the time being seeked to in the currently
+///     playing video\, empty while the previews of the video are not generated.
+///     <p><hr>
+///     @skinning_v21 **[New Infolabel]** \link Player_SeekPreview `Player.SeekPreview`\endlink
+///     <p>
+///   }
 ///   \table_row3{   <b>`Player.IsExternal`</b>,
 ///                  \anchor Player_IsExternal
 ///                  _boolean_,
@@ -924,7 +933,8 @@ const infomap player_labels[] = {{"hasmedia", PLAYER_HAS_MEDIA},
                                  {"cuts", PLAYER_CUTS},
                                  {"scenemarkers", PLAYER_SCENE_MARKERS},
                                  {"hasscenemarkers", PLAYER_HAS_SCENE_MARKERS},
-                                 {"chapters", PLAYER_CHAPTERS}};
+                                 {"chapters", PLAYER_CHAPTERS},
+                                 {"seekpreview", PLAYER_SEEKPREVIEW}};
 
 /// \page modules__infolabels_boolean_conditions
 ///   \table_row3{   <b>`Player.Art(type)`</b>,
@@ -7375,6 +7385,26 @@ const infomap listitem_labels[]= {{ "thumb",            LISTITEM_THUMB },
 ///     @return the name of the visualisation.
 ///     <p>
 ///   }
+///   \table_row3{   <b>`Visualisation.Level`</b>,
+///                  \anchor Visualisation_Level
+///                  _integer_ \, _string_,
+///     @return The level of the audio the visualisation shows\, between 0 (-60 dBFS or
+///     less) and 100 (0 dBFS)\, falling off smoothly after peaks.
+///     <p><hr>
+///     @skinning_v21 **[New Infolabel]** \link Visualisation_Level `Visualisation.Level`\endlink
+///     <p>
+///   }
+///   \table_row3{   <b>`Visualisation.Band(number)`</b>,
+///                  \anchor Visualisation_Band
+///                  _integer_ \, _string_,
+///     @return The level of a frequency band of the audio the visualisation shows\, between 0
+///     and 100 like \ref Visualisation_Level `Visualisation.Level`. The 16 bands are spaced
+///     logarithmically from 60 Hz (band 1) to 16 kHz (band 16).
+///     @param number - the band between 1 and 16
+///     <p><hr>
+///     @skinning_v21 **[New Infolabel]** \link Visualisation_Band `Visualisation.Band(number)`\endlink
+///     <p>
+///   }
 /// \table_end
 ///
 /// -----------------------------------------------------------------------------
@@ -7382,7 +7412,8 @@ const infomap visualisation[] =  {{ "locked",           VISUALISATION_LOCKED },
                                   { "preset",           VISUALISATION_PRESET },
                                   { "haspresets",       VISUALISATION_HAS_PRESETS },
                                   { "name",             VISUALISATION_NAME },
-                                  { "enabled",          VISUALISATION_ENABLED }};
+                                  { "enabled",          VISUALISATION_ENABLED },
+                                  { "level",            VISUALISATION_LEVEL }};
 
 /// \page modules__infolabels_boolean_conditions
 /// \subsection modules__infolabels_boolean_conditions_Fanart Fanart
@@ -10577,6 +10608,9 @@ int CGUIInfoManager::TranslateSingleString(const std::string &strCondition, bool
     }
     else if (cat.name == "visualisation")
     {
+      if (prop.name == "band" && prop.num_params() == 1)
+        return AddMultiInfo(CGUIInfo(VISUALISATION_BAND, atoi(prop.param().c_str())));
+
       for (const infomap& i : visualisation)
       {
         if (prop.name == i.str)
@@ -10974,6 +11008,24 @@ std::string CGUIInfoManager::GetLabel(int info, int contextWindow, std::string *
   return strLabel;
 }
 
+unsigned int CGUIInfoManager::GetLabelVersion(int info) const
+{
+  if (info >= MULTI_INFO_START && info <= MULTI_INFO_END)
+  {
+    const CGUIInfo& multiInfo = m_multiInfo[info - MULTI_INFO_START];
+    if (multiInfo.m_info >= LISTITEM_START && multiInfo.m_info <= LISTITEM_END)
+      return 0;
+    return m_infoProviders.GetLabelVersion(multiInfo);
+  }
+  else if ((info >= CONDITIONAL_LABEL_START && info <= CONDITIONAL_LABEL_END) ||
+           (info >= LISTITEM_START && info <= LISTITEM_END))
+  {
+    return 0;
+  }
+
+  return m_infoProviders.GetLabelVersion(CGUIInfo(info));
+}
+
 bool CGUIInfoManager::GetInt(int &value, int info, int contextWindow, const CGUIListItem *item /* = nullptr */) const
 {
   if (info >= MULTI_INFO_START && info <= MULTI_INFO_END)
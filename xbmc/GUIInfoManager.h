@@ -104,6 +104,13 @@ public:
   int TranslateSingleString(const std::string &strCondition, bool &listItemDependent);
 
   std::string GetLabel(int info, int contextWindow, std::string* fallback = nullptr) const;
+
+  /*! \brief Get a version of a label that changes whenever the label may have changed.
+   \param info the label id
+   \return the version or 0 if the label has to be resolved every time
+   \sa KODI::GUILIB::GUIINFO::IGUIInfoProvider::GetLabelVersion
+   */
+  unsigned int GetLabelVersion(int info) const;
   std::string GetImage(int info, int contextWindow, std::string *fallback = nullptr);
   bool GetInt(int& value, int info, int contextWindow, const CGUIListItem* item = nullptr) const;
   bool GetBool(int condition, int contextWindow, const CGUIListItem* item = nullptr);
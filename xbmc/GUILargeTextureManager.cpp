@@ -11,10 +11,20 @@
 #include "ServiceBroker.h"
 #include "TextureCache.h"
 #include "commons/ilog.h"
+#include "filesystem/File.h"
+#include "guilib/DDSImage.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/Texture.h"
+#include "guilib/TextureFormats.h"
+#include "guilib/TextureManager.h"
+#include "guilib/TextureMemory.h"
+#include "guilib/TextureUploader.h"
+#include "rendering/RenderSystem.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/JobManager.h"
 #include "utils/TimeUtils.h"
+#include "utils/URIUtils.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
@@ -24,6 +34,35 @@
 #include <exception>
 #include <mutex>
 
+namespace
+{
+/*!
+ \brief Whether a cached image should be loaded from, and saved to, a DXT compressed copy.
+
+ Those are uploaded without decoding and need a quarter to an eighth of the video memory.
+ */
+bool UseCompressedCopy(const std::string& loadPath)
+{
+  return CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageUseDDS &&
+         CServiceBroker::GetRenderSystem()->SupportsDXT() &&
+         URIUtils::PathHasParent(loadPath, CTextureCache::GetCachedPath(""), true) &&
+         !URIUtils::HasExtension(loadPath, ".dds");
+}
+
+void SaveCompressedCopy(const CTexture& texture, const std::string& ddsPath)
+{
+  if (texture.GetTextureFormat() != XB_FMT_A8R8G8B8 || !texture.GetPixels() ||
+      texture.GetOrientation() != 0)
+    return;
+
+  CDDSImage image;
+  image.Compress(texture.GetWidth(), texture.GetHeight(), texture.GetPitch(), texture.GetPixels(),
+                 texture.HasAlpha());
+  if (!image.WriteFile(ddsPath))
+    CLog::Log(LOGWARNING, "{} - failed to write {}", __FUNCTION__, ddsPath);
+}
+} // unnamed namespace
+
 CImageLoader::CImageLoader(const std::string& path, const bool useCache)
   : m_path(path), m_texture(nullptr)
 {
@@ -33,6 +72,17 @@ CImageLoader::CImageLoader(const std::string& path, const bool useCache)
 CImageLoader::~CImageLoader() = default;
 
 bool CImageLoader::DoWork()
+{
+  if (!LoadTexture())
+    return false;
+
+  // upload in the background if possible, so the render thread gets a texture ready for drawing.
+  // Otherwise it is uploaded when first drawn.
+  CServiceBroker::GetGUI()->GetTextureManager().GetUploader().Upload(*m_texture);
+  return true;
+}
+
+bool CImageLoader::LoadTexture()
 {
   bool needsChecking = false;
   std::string loadPath;
@@ -48,11 +98,34 @@ bool CImageLoader::DoWork()
 
   if (!loadPath.empty())
   {
-    // direct route - load the image
+    std::string ddsPath;
+    if (UseCompressedCopy(loadPath))
+    {
+      ddsPath = URIUtils::ReplaceExtension(loadPath, ".dds");
+      if (XFILE::CFile::Exists(ddsPath))
+      {
+        m_texture = CTexture::LoadFromFile(ddsPath);
+        if (m_texture)
+        {
+          if (needsChecking)
+            CServiceBroker::GetTextureCache()->BackgroundCacheImage(texturePath);
+          return true;
+        }
+      }
+    }
+
+    // direct route - load the image, at half the screen size if texture memory is short
+    unsigned int width = CServiceBroker::GetWinSystem()->GetGfxContext().GetWidth();
+    unsigned int height = CServiceBroker::GetWinSystem()->GetGfxContext().GetHeight();
+    const bool reduced = CTextureMemory::IsUnderPressure(TextureConsumer::LARGE);
+    if (reduced)
+    {
+      width /= 2;
+      height /= 2;
+    }
+
     auto start = std::chrono::steady_clock::now();
-    m_texture =
-        CTexture::LoadFromFile(loadPath, CServiceBroker::GetWinSystem()->GetGfxContext().GetWidth(),
-                               CServiceBroker::GetWinSystem()->GetGfxContext().GetHeight());
+    m_texture = CTexture::LoadFromFile(loadPath, width, height);
 
     auto end = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
@@ -64,6 +137,8 @@ bool CImageLoader::DoWork()
     {
       if (needsChecking)
         CServiceBroker::GetTextureCache()->BackgroundCacheImage(texturePath);
+      else if (!ddsPath.empty() && !reduced)
+        SaveCompressedCopy(*m_texture, ddsPath);
 
       return true;
     }
@@ -128,12 +203,24 @@ void CGUILargeTextureManager::CLargeTexture::SetTexture(std::unique_ptr<CTexture
   assert(!m_texture.size());
   if (texture)
   {
+    texture->SetMemoryConsumer(TextureConsumer::LARGE);
     const auto width = texture->GetWidth();
     const auto height = texture->GetHeight();
     m_texture.Set(std::move(texture), width, height);
   }
 }
 
+bool CGUILargeTextureManager::CLargeTexture::TakeUploadBudget()
+{
+  if (m_uploadBudgeted || !m_texture.size() || m_texture.m_textures[0]->IsLoadedToGPU())
+    return true;
+
+  const CTexture& texture = *m_texture.m_textures[0];
+  m_uploadBudgeted = CServiceBroker::GetGUI()->GetTextureManager().GetUploader().TakeFrameBudget(
+      static_cast<size_t>(texture.GetPitch()) * texture.GetRows());
+  return m_uploadBudgeted;
+}
+
 CGUILargeTextureManager::CGUILargeTextureManager() = default;
 
 CGUILargeTextureManager::~CGUILargeTextureManager() = default;
@@ -151,6 +238,22 @@ void CGUILargeTextureManager::CleanupUnusedImages(bool immediately)
     else
       ++it;
   }
+
+  while (CTextureMemory::IsUnderPressure(TextureConsumer::LARGE))
+  {
+    listIterator oldest = m_allocated.end();
+    for (it = m_allocated.begin(); it != m_allocated.end(); ++it)
+    {
+      if ((*it)->IsUnused() &&
+          (oldest == m_allocated.end() || (*it)->GetTimeToDelete() < (*oldest)->GetTimeToDelete()))
+        oldest = it;
+    }
+    if (oldest == m_allocated.end())
+      break;
+
+    (*oldest)->DeleteIfRequired(true);
+    m_allocated.erase(oldest);
+  }
 }
 
 // if available, increment reference count, and return the image.
@@ -165,8 +268,11 @@ bool CGUILargeTextureManager::GetImage(const std::string &path, CTextureArray &t
     {
       if (firstRequest)
         image->AddRef();
-      texture = image->GetTexture();
-      return texture.size() > 0;
+      if (!image->GetTexture().size())
+        return false;
+      if (image->TakeUploadBudget())
+        texture = image->GetTexture();
+      return true;
     }
   }
 
@@ -203,8 +309,24 @@ void CGUILargeTextureManager::ReleaseImage(const std::string &path, bool immedia
   }
 }
 
+void CGUILargeTextureManager::PrefetchImage(const std::string &path, bool useCache)
+{
+  std::unique_lock<CCriticalSection> lock(m_listSection);
+  for (listIterator it = m_allocated.begin(); it != m_allocated.end(); ++it)
+  {
+    CLargeTexture *image = *it;
+    if (image->GetPath() == path)
+    {
+      image->AddRef();
+      return;
+    }
+  }
+
+  QueueImage(path, useCache, CJob::PRIORITY_LOW);
+}
+
 // queue the image, and start the background loader if necessary
-void CGUILargeTextureManager::QueueImage(const std::string &path, bool useCache)
+void CGUILargeTextureManager::QueueImage(const std::string &path, bool useCache, CJob::PRIORITY priority)
 {
   if (path.empty())
     return;
@@ -223,7 +345,7 @@ void CGUILargeTextureManager::QueueImage(const std::string &path, bool useCache)
   // queue the item
   CLargeTexture *image = new CLargeTexture(path);
   unsigned int jobID = CServiceBroker::GetJobManager()->AddJob(new CImageLoader(path, useCache),
-                                                               this, CJob::PRIORITY_NORMAL);
+                                                               this, priority);
   m_queued.emplace_back(jobID, image);
 }
 
@@ -41,6 +41,9 @@ public:
   bool          m_use_cache; ///< Whether or not to use any caching with this image
   std::string    m_path; ///< path of image to load
   std::unique_ptr<CTexture> m_texture; ///< Texture object to load the image into \sa CTexture.
+
+private:
+  bool LoadTexture();
 };
 
 /*!
@@ -72,7 +75,9 @@ public:
 
    Loaded textures are reference counted, hence this call may immediately return with the texture
    object filled if the texture has been previously loaded, else will return with an empty texture
-   object if it is being loaded.
+   object if it is being loaded. Loaded textures that still have to be uploaded to the GPU by the
+   render thread are handed out within a per-frame upload budget, so the texture object may stay
+   empty for a few more frames.
 
    \param path path of the image to load.
    \param texture texture object to hold the resulting texture
@@ -96,12 +101,26 @@ public:
    */
   void ReleaseImage(const std::string &path, bool immediately = false);
 
+  /*!
+   \brief Request a texture that is likely to be needed soon, e.g. the next items of a scrolling list.
+
+   Takes a reference like the first GetImage() call would and queues the image at low priority
+   if it isn't loaded yet, so it only uses loader threads that visible images leave idle. Each call
+   has to be balanced by a call to ReleaseImage(), which cancels the load if it hasn't finished.
+
+   \param path path of the image to load.
+   \sa GetImage, ReleaseImage
+   */
+  void PrefetchImage(const std::string &path, bool useCache = true);
+
   /*!
    \brief Cleanup images that are no longer in use.
 
    Loaded textures are reference counted, and upon reaching reference count 0 through ReleaseImage()
    they are flagged as unused with the current time.  After a delay they may be unloaded, hence
-   CleanupUnusedImages() should be called periodically to ensure this occurs.
+   CleanupUnusedImages() should be called periodically to ensure this occurs. While the large
+   textures are under memory pressure (see CTextureMemory) unused images are unloaded right away,
+   least recently used first.
 
    \param immediately set to true to cleanup images regardless of whether the delay has passed
    */
@@ -118,9 +137,16 @@ private:
     bool DecrRef(bool deleteImmediately);
     bool DeleteIfRequired(bool deleteImmediately = false);
     void SetTexture(std::unique_ptr<CTexture> texture);
+    /*!
+     \brief Check whether the texture may be handed out in this frame, see
+     CTextureUploader::TakeFrameBudget. Textures uploaded in the background always may.
+     */
+    bool TakeUploadBudget();
 
     const std::string& GetPath() const { return m_path; }
     const CTextureArray& GetTexture() const { return m_texture; }
+    bool IsUnused() const { return m_refCount == 0; }
+    unsigned int GetTimeToDelete() const { return m_timeToDelete; }
 
   private:
     static const unsigned int TIME_TO_DELETE = 2000;
@@ -129,9 +155,12 @@ private:
     std::string m_path;
     CTextureArray m_texture;
     unsigned int m_timeToDelete;
+    bool m_uploadBudgeted = false;
   };
 
-  void QueueImage(const std::string &path, bool useCache = true);
+  void QueueImage(const std::string &path,
+                  bool useCache = true,
+                  CJob::PRIORITY priority = CJob::PRIORITY_NORMAL);
 
   std::vector< std::pair<unsigned int, CLargeTexture *> > m_queued;
   std::vector<CLargeTexture *> m_allocated;
@@ -0,0 +1,149 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "LibraryChangeMonitor.h"
+
+#include "ServiceBroker.h"
+#include "interfaces/AnnouncementManager.h"
+#include "music/MusicDatabase.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+#include "video/VideoDatabase.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr auto POLL_INTERVAL = 5s;
+// more changes are picked up by the following polls
+constexpr unsigned int MAX_CHANGES_PER_POLL = 500;
+// a missing generation is a change not committed yet, or one rolled back if it stays missing
+constexpr auto MAX_GAP_AGE = 30s;
+constexpr auto PRUNE_INTERVAL = 10min;
+constexpr auto MAX_CHANGE_AGE = 1h;
+} // unnamed namespace
+
+CLibraryChangeMonitor::CLibraryChangeMonitor() : CThread("LibraryChangeMonitor")
+{
+}
+
+CLibraryChangeMonitor::~CLibraryChangeMonitor()
+{
+  Stop();
+}
+
+void CLibraryChangeMonitor::Start()
+{
+  Stop();
+
+  m_video = Source(ANNOUNCEMENT::VideoLibrary);
+  m_music = Source(ANNOUNCEMENT::AudioLibrary);
+  Create();
+}
+
+void CLibraryChangeMonitor::Stop()
+{
+  StopThread(true);
+}
+
+void CLibraryChangeMonitor::Process()
+{
+  while (!m_bStop && (m_video.enabled || m_music.enabled))
+  {
+    if (m_video.enabled)
+      Poll<CVideoDatabase>(m_video);
+    if (m_music.enabled && !m_bStop)
+      Poll<CMusicDatabase>(m_music);
+
+    CThread::Sleep(POLL_INTERVAL);
+  }
+}
+
+template<class TDatabase>
+void CLibraryChangeMonitor::Poll(Source& source)
+{
+  TDatabase db;
+  if (!db.Open())
+    return;
+
+  if (!db.RecordsLibraryChanges())
+  {
+    source.enabled = false;
+    return;
+  }
+
+  if (!source.initialized)
+  {
+    // only the changes made from now on are of interest
+    source.generation = db.GetLibraryChangeGeneration();
+    source.initialized = true;
+    CLog::Log(LOGDEBUG, "{}: following library changes after generation {}", __FUNCTION__,
+              source.generation);
+    return;
+  }
+
+  std::vector<CDatabase::LibraryChange> changes;
+  if (db.GetLibraryChangesSince(source.generation, MAX_CHANGES_PER_POLL, changes))
+    Announce(source.flag, TakeNewChanges(source, changes));
+
+  const auto now = std::chrono::steady_clock::now();
+  if (now - source.lastPrune > PRUNE_INTERVAL)
+  {
+    db.PruneLibraryChanges(MAX_CHANGE_AGE);
+    source.lastPrune = now;
+  }
+}
+
+std::vector<CDatabase::LibraryChange> CLibraryChangeMonitor::TakeNewChanges(
+    Source& source, const std::vector<CDatabase::LibraryChange>& changes)
+{
+  std::vector<CDatabase::LibraryChange> newChanges;
+  for (const auto& change : changes)
+  {
+    if (source.seen.insert(change.generation).second && !change.local)
+      newChanges.emplace_back(change);
+  }
+
+  // generations are assigned when a change is written, but transactions may commit out of order,
+  // so only advance over the changes seen without a gap, unless the gap persists
+  const auto now = std::chrono::steady_clock::now();
+  while (!source.seen.empty())
+  {
+    const int64_t oldest = *source.seen.begin();
+    if (oldest != source.generation + 1)
+    {
+      if (source.gapSince == std::chrono::steady_clock::time_point())
+        source.gapSince = now;
+      if (now - source.gapSince < MAX_GAP_AGE)
+        break;
+    }
+
+    source.generation = oldest;
+    source.seen.erase(source.seen.begin());
+    source.gapSince = {};
+  }
+
+  return newChanges;
+}
+
+void CLibraryChangeMonitor::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
+                                     const std::vector<CDatabase::LibraryChange>& changes)
+{
+  for (size_t i = 0; i < changes.size(); ++i)
+  {
+    CVariant data;
+    data["type"] = changes[i].mediaType;
+    data["id"] = changes[i].id;
+    // listeners refresh once for all changes picked up together, like after a scan
+    if (i + 1 < changes.size())
+      data["transaction"] = true;
+
+    CServiceBroker::GetAnnouncementManager()->Announce(
+        flag, changes[i].removed ? "OnRemove" : "OnUpdate", data);
+  }
+}
@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "dbwrappers/Database.h"
+#include "interfaces/IAnnouncer.h"
+#include "threads/Thread.h"
+
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+/*!
+ \ingroup database
+ \brief Picks up the library changes other instances record in a shared video or music database
+
+ Instances sharing a MySQL library record the items they add, update and remove in the changelog
+ table of the database. This thread polls the tables and announces the changes of the other
+ instances as OnUpdate and OnRemove of the single items, the way local changes are announced, so
+ widgets, caches and JSON-RPC clients refresh what changed instead of everything. The thread ends
+ right away for SQLite databases, which are not shared.
+ */
+class CLibraryChangeMonitor : private CThread
+{
+public:
+  CLibraryChangeMonitor();
+  ~CLibraryChangeMonitor() override;
+
+  /*!
+   \brief Start polling the video and music databases of the current profile.
+   */
+  void Start();
+
+  /*!
+   \brief Stop polling, e.g. before the profile changes.
+   */
+  void Stop();
+
+private:
+  CLibraryChangeMonitor(const CLibraryChangeMonitor&) = delete;
+  CLibraryChangeMonitor& operator=(const CLibraryChangeMonitor&) = delete;
+
+  struct Source
+  {
+    explicit Source(ANNOUNCEMENT::AnnouncementFlag announcementFlag) : flag(announcementFlag) {}
+
+    ANNOUNCEMENT::AnnouncementFlag flag;
+    bool enabled = true;
+    bool initialized = false;
+    int64_t generation = 0; ///< all changes up to this generation have been seen
+    std::set<int64_t> seen; ///< changes seen beyond generation, waiting for older ones to commit
+    std::chrono::steady_clock::time_point gapSince; ///< when the oldest missing change was noticed
+    std::chrono::steady_clock::time_point lastPrune;
+  };
+
+  void Process() override;
+
+  template<class TDatabase>
+  void Poll(Source& source);
+
+  /*!
+   \brief Pick the changes not seen yet and advance the generation.
+   \param source the database the changes were read from.
+   \param changes the changes read, oldest first.
+   \return the changes recorded by other instances that were not seen before.
+   */
+  static std::vector<CDatabase::LibraryChange> TakeNewChanges(
+      Source& source, const std::vector<CDatabase::LibraryChange>& changes);
+
+  static void Announce(ANNOUNCEMENT::AnnouncementFlag flag,
+                       const std::vector<CDatabase::LibraryChange>& changes);
+
+  Source m_video{ANNOUNCEMENT::VideoLibrary};
+  Source m_music{ANNOUNCEMENT::AudioLibrary};
+};
@@ -49,10 +49,45 @@
 #include "utils/log.h"
 #include "weather/WeatherManager.h"
 
+#include <chrono>
 #include <memory>
 
 using namespace KODI;
 
+namespace
+{
+/*!
+ \brief Logs how long each service of an init stage took to start and when it was ready.
+ */
+class CStartupTimeline
+{
+public:
+  explicit CStartupTimeline(const char* stage) : m_stage(stage) {}
+
+  ~CStartupTimeline()
+  {
+    CLog::Log(LOGDEBUG, "CServiceManager::{} - finished after {:.2f} ms", m_stage,
+              std::chrono::duration<double, std::milli>(Clock::now() - m_start).count());
+  }
+
+  void Mark(const char* service)
+  {
+    const auto now = Clock::now();
+    CLog::Log(LOGDEBUG, "CServiceManager::{} - {} took {:.2f} ms, ready at {:.2f} ms", m_stage,
+              service, std::chrono::duration<double, std::milli>(now - m_last).count(),
+              std::chrono::duration<double, std::milli>(now - m_start).count());
+    m_last = now;
+  }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  const char* m_stage;
+  const Clock::time_point m_start = Clock::now();
+  Clock::time_point m_last = m_start;
+};
+} // unnamed namespace
+
 CServiceManager::CServiceManager() = default;
 
 CServiceManager::~CServiceManager()
@@ -99,20 +134,25 @@ void CServiceManager::DeinitTesting()
 
 bool CServiceManager::InitStageOne()
 {
+  CStartupTimeline timeline(__FUNCTION__);
+
   m_Platform.reset(CPlatform::CreateInstance());
   if (!m_Platform->InitStageOne())
     return false;
+  timeline.Mark("platform");
 
 #ifdef HAS_PYTHON
   m_XBPython = std::make_unique<XBPython>();
   CScriptInvocationManager::GetInstance().RegisterLanguageInvocationHandler(m_XBPython.get(),
                                                                             ".py");
+  timeline.Mark("python");
 #endif
 
   m_playlistPlayer = std::make_unique<PLAYLIST::CPlayListPlayer>();
   m_slideShowDelegator = std::make_unique<CSlideShowDelegator>();
 
   m_network = CNetworkBase::GetNetwork();
+  timeline.Mark("network");
 
   init_level = 1;
   return true;
@@ -120,6 +160,8 @@ bool CServiceManager::InitStageOne()
 
 bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
 {
+  CStartupTimeline timeline(__FUNCTION__);
+
   // Initialize the addon database (must be before the addon manager is init'd)
   m_databaseManager = std::make_unique<CDatabaseManager>();
 
@@ -132,6 +174,7 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
     CLog::Log(LOGFATAL, "CServiceManager::{}: Unable to start CAddonMgr", __FUNCTION__);
     return false;
   }
+  timeline.Mark("add-on manager");
 
   m_repositoryUpdater = std::make_unique<ADDON::CRepositoryUpdater>(*m_addonMgr);
 
@@ -139,15 +182,19 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
 
   m_vfsAddonCache = std::make_unique<ADDON::CVFSAddonCache>();
   m_vfsAddonCache->Init();
+  timeline.Mark("VFS add-on cache");
 
   m_PVRManager = std::make_unique<PVR::CPVRManager>();
+  timeline.Mark("PVR manager");
 
   m_dataCacheCore = std::make_unique<CDataCacheCore>();
 
   m_binaryAddonCache = std::make_unique<ADDON::CBinaryAddonCache>();
   m_binaryAddonCache->Init();
+  timeline.Mark("binary add-on cache");
 
   m_favouritesService = std::make_unique<CFavouritesService>(profilesUserDataFolder);
+  timeline.Mark("favourites");
 
   m_serviceAddons = std::make_unique<ADDON::CServiceAddonManager>(*m_addonMgr);
 
@@ -156,9 +203,11 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
   m_gameControllerManager = std::make_unique<GAME::CControllerManager>(*m_addonMgr);
   m_inputManager = std::make_unique<CInputManager>();
   m_inputManager->InitializeInputs();
+  timeline.Mark("input manager");
 
   m_peripherals =
       std::make_unique<PERIPHERALS::CPeripherals>(*m_inputManager, *m_gameControllerManager);
+  timeline.Mark("peripherals");
 
   m_gameRenderManager = std::make_unique<RETRO::CGUIGameRenderManager>();
 
@@ -167,11 +216,13 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
   m_powerManager = std::make_unique<CPowerManager>();
   m_powerManager->Initialize();
   m_powerManager->SetDefaults();
+  timeline.Mark("power manager");
 
   m_weatherManager = std::make_unique<CWeatherManager>();
 
   m_mediaManager = std::make_unique<CMediaManager>();
   m_mediaManager->Initialize();
+  timeline.Mark("media manager");
 
 #if !defined(TARGET_WINDOWS) && defined(HAS_OPTICAL_DRIVE)
   m_DetectDVDType = std::make_unique<MEDIA_DETECT::CDetectDVDMedia>();
@@ -183,6 +234,7 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
 
   if (!m_Platform->InitStageTwo())
     return false;
+  timeline.Mark("platform");
 
   init_level = 2;
   return true;
@@ -191,6 +243,8 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
 // stage 3 is called after successful initialization of WindowManager
 bool CServiceManager::InitStageThree(const std::shared_ptr<CProfileManager>& profileManager)
 {
+  CStartupTimeline timeline(__FUNCTION__);
+
 #if !defined(TARGET_WINDOWS) && defined(HAS_OPTICAL_DRIVE)
   // Start Thread for DVD Mediatype detection
   CLog::Log(LOGINFO, "[Media Detection] starting service for optical media detection");
@@ -199,21 +253,26 @@ bool CServiceManager::InitStageThree(const std::shared_ptr<CProfileManager>& pro
 
   // Peripherals depends on strings being loaded before stage 3
   m_peripherals->Initialise();
+  timeline.Mark("peripherals");
 
   m_gameServices =
       std::make_unique<GAME::CGameServices>(*m_gameControllerManager, *m_gameRenderManager,
                                             *m_peripherals, *profileManager, *m_inputManager);
+  timeline.Mark("game services");
 
   m_contextMenuManager->Init();
+  timeline.Mark("context menu manager");
 
   // Init PVR manager after login, not already on login screen
   if (!profileManager->UsingLoginScreen())
     m_PVRManager->Init();
+  timeline.Mark("PVR manager");
 
   m_playerCoreFactory = std::make_unique<CPlayerCoreFactory>(*profileManager);
 
   if (!m_Platform->InitStageThree())
     return false;
+  timeline.Mark("platform");
 
   init_level = 3;
   return true;
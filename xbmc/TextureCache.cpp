@@ -27,11 +27,20 @@
 #include <exception>
 #include <mutex>
 #include <string.h>
+#include <utility>
 
 using namespace XFILE;
 using namespace std::chrono_literals;
 
-CTextureCache::CTextureCache() : CJobQueue(false, 1, CJob::PRIORITY_LOW_PAUSABLE)
+namespace
+{
+// images decoded and stored at once, and images downloaded at once
+constexpr unsigned int CACHE_JOBS = 2;
+constexpr unsigned int DOWNLOAD_JOBS = 4;
+} // unnamed namespace
+
+CTextureCache::CTextureCache()
+  : CJobQueue(false, CACHE_JOBS, CJob::PRIORITY_LOW_PAUSABLE), m_downloadQueue(*this)
 {
 }
 
@@ -46,10 +55,21 @@ void CTextureCache::Initialize()
 
 void CTextureCache::Deinitialize()
 {
+  m_downloadQueue.CancelJobs();
   CancelJobs();
 
+  // write out the use counts that haven't reached a full batch yet
+  std::vector<CTextureDetails> useCounts;
+  {
+    std::unique_lock<CCriticalSection> lock(m_useCountSection);
+    useCounts.swap(m_useCounts);
+  }
+  if (!useCounts.empty())
+    CTextureUseCountJob(useCounts).DoWork();
+
   std::unique_lock<CCriticalSection> lock(m_databaseSection);
   m_database.Close();
+  CTextureDatabase::ClearLookupCache();
 }
 
 bool CTextureCache::IsCachedImage(const std::string &url) const
@@ -130,8 +150,12 @@ void CTextureCache::BackgroundCacheImage(const std::string &url)
   if (path.empty())
     return;
 
-  // needs (re)caching
-  AddJob(new CTextureCacheJob(path, details.hash));
+  // needs (re)caching, remote images are downloaded first
+  const std::string downloadURL = CTextureCacheJob::GetDownloadURL(path);
+  if (!downloadURL.empty())
+    m_downloadQueue.AddJob(new CTextureDownloadJob(path, downloadURL));
+  else
+    AddJob(new CTextureCacheJob(path, details.hash));
 }
 
 bool CTextureCache::StartCacheImage(const std::string& image)
@@ -253,10 +277,14 @@ bool CTextureCache::AddCachedTexture(const std::string &url, const CTextureDetai
 void CTextureCache::IncrementUseCount(const CTextureDetails &details)
 {
   static const size_t count_before_update = 100;
+  static const float seconds_before_update = 30.0f;
   std::unique_lock<CCriticalSection> lock(m_useCountSection);
+  if (m_useCounts.empty())
+    m_useCountTimer.StartZero();
   m_useCounts.reserve(count_before_update);
   m_useCounts.push_back(details);
-  if (m_useCounts.size() >= count_before_update)
+  if (m_useCounts.size() >= count_before_update ||
+      m_useCountTimer.GetElapsedSeconds() >= seconds_before_update)
   {
     AddJob(new CTextureUseCountJob(m_useCounts));
     m_useCounts.clear();
@@ -323,6 +351,23 @@ void CTextureCache::OnJobComplete(unsigned int jobID, bool success, CJob *job)
   return CJobQueue::OnJobComplete(jobID, success, job);
 }
 
+CTextureCache::CDownloadQueue::CDownloadQueue(CTextureCache& cache)
+  : CJobQueue(false, DOWNLOAD_JOBS, CJob::PRIORITY_DEDICATED), m_cache(cache)
+{
+}
+
+void CTextureCache::CDownloadQueue::OnJobComplete(unsigned int jobID, bool success, CJob* job)
+{
+  if (success)
+  {
+    CTextureDownloadJob* download = static_cast<CTextureDownloadJob*>(job);
+    CTextureCacheJob* cacheJob = new CTextureCacheJob(download->m_url);
+    cacheJob->SetImageData(std::move(download->m_data), download->m_mimeType);
+    m_cache.AddJob(cacheJob);
+  }
+  CJobQueue::OnJobComplete(jobID, success, job);
+}
+
 bool CTextureCache::Export(const std::string &image, const std::string &destination, bool overwrite)
 {
   CTextureDetails details;
@@ -13,6 +13,7 @@
 #include "threads/CriticalSection.h"
 #include "threads/Event.h"
 #include "utils/JobManager.h"
+#include "utils/Stopwatch.h"
 
 #include <memory>
 #include <set>
@@ -196,7 +197,8 @@ private:
   bool ClearCachedTexture(int textureID, std::string &cacheFile);
 
   /*! \brief Increment the use count of a texture
-   Stores locally before calling CTextureDatabase::IncrementUseCount via a CUseCountJob
+   Stores locally before calling CTextureDatabase::IncrementUseCount via a CUseCountJob, once
+   100 uses are pending or the oldest pending use is 30 seconds old.
    \sa CUseCountJob, CTextureDatabase::IncrementUseCount
    */
   void IncrementUseCount(const CTextureDetails &details);
@@ -219,12 +221,29 @@ private:
    */
   void OnCachingComplete(bool success, CTextureCacheJob *job);
 
+  /*! \brief Queue of image downloads, which hands each downloaded image on to the cache queue.
+   Downloads have their own concurrency limit and run on dedicated workers of the job manager,
+   so waiting on slow servers doesn't use up the workers that decode and store images.
+   \sa CTextureDownloadJob
+   */
+  class CDownloadQueue : public CJobQueue
+  {
+  public:
+    explicit CDownloadQueue(CTextureCache& cache);
+    void OnJobComplete(unsigned int jobID, bool success, CJob* job) override;
+
+  private:
+    CTextureCache& m_cache;
+  };
+
   CCriticalSection m_databaseSection;
   CTextureDatabase m_database;
   std::set<std::string> m_processinglist; ///< currently processing list to avoid 2 jobs being processed at once
   CCriticalSection     m_processingSection;
   CEvent               m_completeEvent; ///< Set whenever a job has finished
   std::vector<CTextureDetails> m_useCounts; ///< Use count tracking
+  CStopWatch                   m_useCountTimer; ///< Time since the oldest pending use count
   CCriticalSection             m_useCountSection;
+  CDownloadQueue m_downloadQueue;
 };
 
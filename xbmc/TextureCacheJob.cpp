@@ -25,9 +25,12 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
+#include <map>
+#include <tuple>
 #include <utility>
 
 #include "PlatformDefs.h"
@@ -98,6 +101,26 @@ bool ShouldCheckForChanges(const std::string& additional_info, const std::string
       StringUtils::StartsWith(url, "http://") || StringUtils::StartsWith(url, "https://");
   return !isHTTP;
 }
+
+bool IsImageMimeType(const std::string& mimeType)
+{
+  return mimeType.empty() || StringUtils::StartsWithNoCase(mimeType, "image/") ||
+         StringUtils::EqualsNoCase(mimeType, "application/octet-stream");
+}
+
+// the cache never stores images larger than the image or fanart resolution, so there is no need
+// to decode them at a larger size
+void GetDecodeSize(unsigned int width, unsigned int height,
+                   unsigned int& decodeWidth, unsigned int& decodeHeight)
+{
+  const std::shared_ptr<CAdvancedSettings> advancedSettings =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  const unsigned int maxHeight = std::max(advancedSettings->m_imageRes, advancedSettings->m_fanartRes);
+  const unsigned int maxWidth = maxHeight * 16 / 9;
+
+  decodeWidth = width ? std::min(width, maxWidth) : maxWidth;
+  decodeHeight = height ? std::min(height, maxHeight) : maxHeight;
+}
 } // namespace
 
 bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
@@ -124,7 +147,11 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
     }
   }
 
-  std::unique_ptr<CTexture> texture = LoadImage(image, width, height, additional_info, true);
+  unsigned int decodeWidth, decodeHeight;
+  GetDecodeSize(width, height, decodeWidth, decodeHeight);
+  std::unique_ptr<CTexture> texture =
+      m_imageData.empty() ? LoadImage(image, decodeWidth, decodeHeight, additional_info, true)
+                          : LoadImageData(decodeWidth, decodeHeight, additional_info);
   if (texture)
   {
     if (texture->HasAlpha())
@@ -138,6 +165,12 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
     if (CPicture::CacheTexture(texture.get(), width, height,
                                CTextureCache::GetCachedPath(m_details.file), scalingAlgorithm))
     {
+      // a compressed copy of the previous version is out of date, the loader recreates it
+      const std::string ddsPath =
+          URIUtils::ReplaceExtension(CTextureCache::GetCachedPath(m_details.file), ".dds");
+      if (!m_oldHash.empty() && XFILE::CFile::Exists(ddsPath))
+        XFILE::CFile::Delete(ddsPath);
+
       m_details.width = width;
       m_details.height = height;
       if (out_texture) // caller wants the texture
@@ -268,6 +301,42 @@ std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const std::string& image,
   return texture;
 }
 
+std::unique_ptr<CTexture> CTextureCacheJob::LoadImageData(unsigned int width,
+                                                          unsigned int height,
+                                                          const std::string& additional_info)
+{
+  std::unique_ptr<CTexture> texture = CTexture::LoadFromFileInMemory(
+      m_imageData.data(), m_imageData.size(), m_mimeType, width, height);
+
+  // the decoded texture is all that is needed from here on
+  std::vector<uint8_t>().swap(m_imageData);
+
+  if (texture && additional_info == "flipped")
+    texture->SetOrientation(texture->GetOrientation() ^ 1);
+
+  return texture;
+}
+
+std::string CTextureCacheJob::GetDownloadURL(const std::string &url)
+{
+  unsigned int width, height;
+  CPictureScalingAlgorithm::Algorithm scalingAlgorithm;
+  std::string additional_info;
+  std::string image = DecodeImageURL(url, width, height, scalingAlgorithm, additional_info);
+
+  if (!additional_info.empty() && !IsControl(additional_info))
+    return "";
+  if (!StringUtils::StartsWith(image, "http://") && !StringUtils::StartsWith(image, "https://"))
+    return "";
+  return image;
+}
+
+void CTextureCacheJob::SetImageData(std::vector<uint8_t> data, const std::string &mimeType)
+{
+  m_imageData = std::move(data);
+  m_mimeType = mimeType;
+}
+
 std::string CTextureCacheJob::GetImageHash(const std::string &url)
 {
   // silently ignore - we cannot stat these
@@ -314,10 +383,57 @@ bool CTextureUseCountJob::DoWork()
   CTextureDatabase db;
   if (db.Open())
   {
+    // the same texture is often used many times in a batch, update each of them once
+    std::map<std::tuple<int, unsigned int, unsigned int>, unsigned int> counts;
+    for (const auto& texture : m_textures)
+      counts[std::make_tuple(texture.id, texture.width, texture.height)]++;
+
     db.BeginTransaction();
-    for (std::vector<CTextureDetails>::const_iterator i = m_textures.begin(); i != m_textures.end(); ++i)
-      db.IncrementUseCount(*i);
+    for (const auto& [key, count] : counts)
+    {
+      CTextureDetails details;
+      std::tie(details.id, details.width, details.height) = key;
+      db.IncrementUseCount(details, count);
+    }
     db.CommitTransaction();
   }
   return true;
 }
+
+CTextureDownloadJob::CTextureDownloadJob(const std::string &url, const std::string &downloadURL)
+  : m_url(url), m_downloadURL(downloadURL)
+{
+}
+
+bool CTextureDownloadJob::operator==(const CJob* job) const
+{
+  if (strcmp(job->GetType(), GetType()) == 0)
+  {
+    const CTextureDownloadJob* downloadJob = dynamic_cast<const CTextureDownloadJob*>(job);
+    if (downloadJob && downloadJob->m_url == m_url)
+      return true;
+  }
+  return false;
+}
+
+bool CTextureDownloadJob::DoWork()
+{
+  if (ShouldCancel(0, 0))
+    return false;
+
+  XFILE::CFile file;
+  if (file.LoadFile(m_downloadURL, m_data) <= 0)
+  {
+    CLog::Log(LOGDEBUG, "CTextureDownloadJob::{} - unable to download '{}'", __FUNCTION__,
+              CURL::GetRedacted(m_downloadURL));
+    return false;
+  }
+
+  m_mimeType = file.GetProperty(XFILE::FILE_PROPERTY_MIME_TYPE);
+  if (!IsImageMimeType(m_mimeType))
+  {
+    m_data.clear();
+    return false;
+  }
+  return true;
+}
@@ -67,6 +67,20 @@ public:
 
   static bool ResizeTexture(const std::string &url, uint8_t* &result, size_t &result_size);
 
+  /*! \brief Get the address an image has to be downloaded from before it can be cached
+   Only plain http(s) images are downloaded separately, as they are never checked for changes.
+   \param url location of the image
+   \return the address to download, empty if the image is read while caching it
+   \sa CTextureDownloadJob, SetImageData
+   */
+  static std::string GetDownloadURL(const std::string &url);
+
+  /*! \brief Cache the image from a downloaded copy instead of reading it again
+   \param data the contents of the image file
+   \param mimeType the mime type reported by the server, may be empty
+   */
+  void SetImageData(std::vector<uint8_t> data, const std::string &mimeType);
+
   std::string m_url;
   std::string m_oldHash;
   CTextureDetails m_details;
@@ -105,7 +119,39 @@ private:
                                              const std::string& additional_info,
                                              bool requirePixels = false);
 
+  /*! \brief Load the image from the data set with SetImageData at a given target size.
+   \sa LoadImage
+   */
+  std::unique_ptr<CTexture> LoadImageData(unsigned int width,
+                                          unsigned int height,
+                                          const std::string& additional_info);
+
   std::string    m_cachePath;
+  std::vector<uint8_t> m_imageData;
+  std::string m_mimeType;
+};
+
+/*!
+ \ingroup textures
+ \brief Job class for downloading a remote image ahead of caching it
+
+ Keeps waiting on the network out of the job that decodes and stores the image, so that slow
+ servers don't hold up caching other images.
+ \sa CTextureCacheJob::GetDownloadURL
+ */
+class CTextureDownloadJob : public CJob
+{
+public:
+  CTextureDownloadJob(const std::string &url, const std::string &downloadURL);
+
+  const char* GetType() const override { return "downloadimage"; }
+  bool operator==(const CJob *job) const override;
+  bool DoWork() override;
+
+  std::string m_url;
+  std::string m_downloadURL;
+  std::vector<uint8_t> m_data;
+  std::string m_mimeType;
 };
 
 /* \brief Job class for storing the use count of textures
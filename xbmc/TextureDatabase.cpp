@@ -11,11 +11,17 @@
 #include "URL.h"
 #include "XBDateTime.h"
 #include "dbwrappers/dataset.h"
+#include "threads/CriticalSection.h"
 #include "utils/DatabaseUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
 enum TextureField
 {
   TF_None = 0,
@@ -228,43 +234,174 @@ void CTextureDatabase::UpdateTables(int version)
   }
 }
 
-bool CTextureDatabase::IncrementUseCount(const CTextureDetails &details)
+namespace
+{
+/*! \brief Most recently used lookups of GetCachedTexture, shared by all database instances.
+ Lists ask for the same images every time they are shown, so most lookups are answered without
+ a query. Images that aren't cached are remembered as well, with an id of -1.
+ */
+class CTextureLookupCache
+{
+public:
+  struct Entry
+  {
+    int id = -1;
+    std::string file;
+    std::string imageHash;
+    CDateTime lastHashCheck;
+    unsigned int width = 0;
+    unsigned int height = 0;
+  };
+
+  bool Get(const std::string& url, Entry& entry)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    const auto it = m_index.find(url);
+    if (it == m_index.end())
+      return false;
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    entry = it->second->second;
+    return true;
+  }
+
+  void Set(const std::string& url, const Entry& entry)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    const auto it = m_index.find(url);
+    if (it != m_index.end())
+    {
+      it->second->second = entry;
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      return;
+    }
+
+    m_entries.emplace_front(url, entry);
+    m_index.emplace(url, m_entries.begin());
+    if (m_entries.size() > MAX_ENTRIES)
+    {
+      m_index.erase(m_entries.back().first);
+      m_entries.pop_back();
+    }
+  }
+
+  void SetHashCheck(const std::string& url, const CDateTime& lastHashCheck)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    const auto it = m_index.find(url);
+    if (it != m_index.end())
+      it->second->second.lastHashCheck = lastHashCheck;
+  }
+
+  void Remove(const std::string& url)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    const auto it = m_index.find(url);
+    if (it != m_index.end())
+    {
+      m_entries.erase(it->second);
+      m_index.erase(it);
+    }
+  }
+
+  void Remove(int id)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+    {
+      if (it->second.id == id)
+      {
+        m_index.erase(it->first);
+        m_entries.erase(it);
+        return;
+      }
+    }
+  }
+
+  void Clear()
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    m_index.clear();
+    m_entries.clear();
+  }
+
+private:
+  static constexpr size_t MAX_ENTRIES = 4096;
+
+  CCriticalSection m_section;
+  std::list<std::pair<std::string, Entry>> m_entries; ///< most recently used first
+  std::unordered_map<std::string, std::list<std::pair<std::string, Entry>>::iterator> m_index;
+};
+
+CTextureLookupCache& GetLookupCache()
+{
+  static CTextureLookupCache cache;
+  return cache;
+}
+
+CDateTime GetHashCheck(const std::string& date)
+{
+  CDateTime lastHashCheck;
+  lastHashCheck.SetFromDBDateTime(date);
+  return lastHashCheck;
+}
+} // unnamed namespace
+
+void CTextureDatabase::ClearLookupCache()
 {
-  std::string sql = PrepareSQL("UPDATE sizes SET usecount=usecount+1, lastusetime=CURRENT_TIMESTAMP WHERE idtexture=%u AND width=%u AND height=%u", details.id, details.width, details.height);
+  GetLookupCache().Clear();
+}
+
+bool CTextureDatabase::IncrementUseCount(const CTextureDetails &details, unsigned int count /* = 1 */)
+{
+  std::string sql = PrepareSQL("UPDATE sizes SET usecount=usecount+%u, lastusetime=CURRENT_TIMESTAMP WHERE idtexture=%u AND width=%u AND height=%u", count, details.id, details.width, details.height);
   return ExecuteQuery(sql);
 }
 
 bool CTextureDatabase::GetCachedTexture(const std::string &url, CTextureDetails &details)
 {
-  try
+  CTextureLookupCache::Entry entry;
+  if (!GetLookupCache().Get(url, entry))
   {
-    if (!m_pDB)
-      return false;
-    if (!m_pDS)
-      return false;
-
-    std::string sql = PrepareSQL("SELECT id, cachedurl, lasthashcheck, imagehash, width, height FROM texture JOIN sizes ON (texture.id=sizes.idtexture AND sizes.size=1) WHERE url='%s'", url.c_str());
-    m_pDS->query(sql);
-    if (!m_pDS->eof())
-    { // have some information
-      details.id = m_pDS->fv(0).get_asInt();
-      details.file  = m_pDS->fv(1).get_asString();
-      CDateTime lastCheck;
-      lastCheck.SetFromDBDateTime(m_pDS->fv(2).get_asString());
-      if (lastCheck.IsValid() && lastCheck + CDateTimeSpan(1,0,0,0) < CDateTime::GetCurrentDateTime())
-        details.hash = m_pDS->fv(3).get_asString();
-      details.width = m_pDS->fv(4).get_asInt();
-      details.height = m_pDS->fv(5).get_asInt();
+    try
+    {
+      if (!m_pDB)
+        return false;
+      if (!m_pDS)
+        return false;
+
+      std::string sql = PrepareSQL("SELECT id, cachedurl, lasthashcheck, imagehash, width, height FROM texture JOIN sizes ON (texture.id=sizes.idtexture AND sizes.size=1) WHERE url='%s'", url.c_str());
+      m_pDS->query(sql);
+      if (!m_pDS->eof())
+      { // have some information
+        entry.id = m_pDS->fv(0).get_asInt();
+        entry.file = m_pDS->fv(1).get_asString();
+        entry.lastHashCheck = GetHashCheck(m_pDS->fv(2).get_asString());
+        entry.imageHash = m_pDS->fv(3).get_asString();
+        entry.width = m_pDS->fv(4).get_asInt();
+        entry.height = m_pDS->fv(5).get_asInt();
+      }
       m_pDS->close();
-      return true;
+      GetLookupCache().Set(url, entry);
+    }
+    catch (...)
+    {
+      CLog::Log(LOGERROR, "{}, failed on url '{}'", __FUNCTION__, url);
+      return false;
     }
-    m_pDS->close();
-  }
-  catch (...)
-  {
-    CLog::Log(LOGERROR, "{}, failed on url '{}'", __FUNCTION__, url);
   }
-  return false;
+
+  if (entry.id < 0)
+    return false;
+
+  details.id = entry.id;
+  details.file = entry.file;
+  if (entry.lastHashCheck.IsValid() &&
+      entry.lastHashCheck + CDateTimeSpan(1, 0, 0, 0) < CDateTime::GetCurrentDateTime())
+    details.hash = entry.imageHash;
+  details.width = entry.width;
+  details.height = entry.height;
+  return true;
 }
 
 bool CTextureDatabase::GetTextures(CVariant &items, const Filter &filter)
@@ -319,7 +456,11 @@ bool CTextureDatabase::SetCachedTextureValid(const std::string &url, bool update
 {
   std::string date = updateable ? CDateTime::GetCurrentDateTime().GetAsDBDateTime() : "";
   std::string sql = PrepareSQL("UPDATE texture SET lasthashcheck='%s' WHERE url='%s'", date.c_str(), url.c_str());
-  return ExecuteQuery(sql);
+  if (!ExecuteQuery(sql))
+    return false;
+
+  GetLookupCache().SetHashCheck(url, GetHashCheck(date));
+  return true;
 }
 
 bool CTextureDatabase::AddCachedTexture(const std::string &url, const CTextureDetails &details)
@@ -346,11 +487,21 @@ bool CTextureDatabase::AddCachedTexture(const std::string &url, const CTextureDe
     m_pDS->exec(sql);
 
     CommitTransaction();
+
+    CTextureLookupCache::Entry entry;
+    entry.id = textureID;
+    entry.file = details.file;
+    entry.imageHash = details.hash;
+    entry.lastHashCheck = GetHashCheck(date);
+    entry.width = details.width;
+    entry.height = details.height;
+    GetLookupCache().Set(url, entry);
   }
   catch (...)
   {
     CLog::Log(LOGERROR, "{} failed on url '{}'", __FUNCTION__, url);
     RollbackTransaction();
+    GetLookupCache().Remove(url);
   }
   return true;
 }
@@ -380,6 +531,7 @@ bool CTextureDatabase::ClearCachedTexture(int id, std::string &cacheFile)
       // remove it
       sql = PrepareSQL("delete from texture where id=%u", id);
       m_pDS->exec(sql);
+      GetLookupCache().Remove(id);
       return true;
     }
     m_pDS->close();
@@ -395,7 +547,11 @@ bool CTextureDatabase::InvalidateCachedTexture(const std::string &url)
 {
   std::string date = (CDateTime::GetCurrentDateTime() - CDateTimeSpan(2, 0, 0, 0)).GetAsDBDateTime();
   std::string sql = PrepareSQL("UPDATE texture SET lasthashcheck='%s' WHERE url='%s'", date.c_str(), url.c_str());
-  return ExecuteQuery(sql);
+  if (!ExecuteQuery(sql))
+    return false;
+
+  GetLookupCache().SetHashCheck(url, GetHashCheck(date));
+  return true;
 }
 
 std::string CTextureDatabase::GetTextureForPath(const std::string &url, const std::string &type)
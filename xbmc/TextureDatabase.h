@@ -67,7 +67,7 @@ public:
   bool SetCachedTextureValid(const std::string &originalURL, bool updateable);
   bool ClearCachedTexture(const std::string &originalURL, std::string &cacheFile);
   bool ClearCachedTexture(int textureID, std::string &cacheFile);
-  bool IncrementUseCount(const CTextureDetails &details);
+  bool IncrementUseCount(const CTextureDetails &details, unsigned int count = 1);
 
   /*! \brief Invalidate a previously cached texture
    Invalidates the texture hash, and sets the texture update time to the current time so that
@@ -76,6 +76,11 @@ public:
    */
   bool InvalidateCachedTexture(const std::string &originalURL);
 
+  /*! \brief Forget the texture lookups kept in memory for GetCachedTexture
+   Needed when a different database is used from now on, e.g. after switching profiles.
+   */
+  static void ClearLookupCache();
+
   /*! \brief Get a texture associated with the given path
    Used for retrieval of previously discovered images to save
    stat() on the filesystem all the time
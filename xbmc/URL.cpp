@@ -105,13 +105,11 @@ void CURL::Parse(std::string strURL1)
           archiveName = Encode(archiveName);
           if (is_apk)
           {
-            CURL c("apk://" + archiveName + "/" + std::move(strURL).substr(iPos + 1));
-            *this = c;
+            *this = CURL("apk://" + archiveName + "/" + std::move(strURL).substr(iPos + 1));
           }
           else
           {
-            CURL c("zip://" + archiveName + "/" + std::move(strURL).substr(iPos + 1));
-            *this = c;
+            *this = CURL("zip://" + archiveName + "/" + std::move(strURL).substr(iPos + 1));
           }
           return;
         }
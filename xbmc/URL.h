@@ -24,8 +24,13 @@ public:
   explicit CURL(std::string strURL) { Parse(std::move(strURL)); }
 
   CURL() = default;
+  CURL(const CURL&) = default;
+  CURL(CURL&&) = default;
   virtual ~CURL(void);
 
+  CURL& operator=(const CURL&) = default;
+  CURL& operator=(CURL&&) = default;
+
   // explicit equals operator for std::string comparison
   bool operator==(const std::string &url) const { return Get() == url; }
 
@@ -794,28 +794,6 @@ void CAddonDatabase::DeleteRepository(const std::string& id)
   }
 }
 
-void CAddonDatabase::DeleteRepositoryContents(const std::string& id)
-{
-  try
-  {
-    if (!m_pDB)
-      return;
-    if (!m_pDS)
-      return;
-
-    int idRepo = GetRepositoryId(id);
-    if (idRepo < 0)
-      return;
-
-    m_pDS->exec(PrepareSQL("DELETE FROM addons WHERE id IN (SELECT idAddon FROM addonlinkrepo WHERE idRepo=%i)", idRepo));
-    m_pDS->exec(PrepareSQL("DELETE FROM addonlinkrepo WHERE idRepo=%i", idRepo));
-  }
-  catch (...)
-  {
-    CLog::Log(LOGERROR, "{} failed on repo '{}'", __FUNCTION__, id);
-  }
-}
-
 int CAddonDatabase::GetRepositoryId(const std::string& addonId)
 {
   if (!m_pDB)
@@ -830,10 +808,12 @@ int CAddonDatabase::GetRepositoryId(const std::string& addonId)
   return m_pDS->fv("id").get_asInt();
 }
 
-bool CAddonDatabase::UpdateRepositoryContent(const std::string& repository,
-                                             const CAddonVersion& version,
-                                             const std::string& checksum,
-                                             const std::vector<AddonInfoPtr>& addons)
+bool CAddonDatabase::UpdateRepositoryContent(
+    const std::string& repository,
+    const CAddonVersion& version,
+    const std::string& checksum,
+    const std::vector<AddonInfoPtr>& addons,
+    const std::set<std::pair<std::string, std::string>>& unchanged /* = {} */)
 {
   try
   {
@@ -842,7 +822,6 @@ bool CAddonDatabase::UpdateRepositoryContent(const std::string& repository,
     if (!m_pDS)
       return false;
 
-    DeleteRepositoryContents(repository);
     int idRepo = GetRepositoryId(repository);
     if (idRepo < 0)
       return false;
@@ -850,6 +829,34 @@ bool CAddonDatabase::UpdateRepositoryContent(const std::string& repository,
     assert(idRepo > 0);
 
     m_pDB->start_transaction();
+
+    // remove all addons but the unchanged ones, serializing and storing the metadata of all
+    // addons of a large repository again takes a while on slow devices
+    std::vector<std::string> removed;
+    m_pDS->query(PrepareSQL("SELECT addons.id, addons.addonID, addons.version FROM addons "
+                            "JOIN addonlinkrepo ON addonlinkrepo.idAddon=addons.id "
+                            "WHERE addonlinkrepo.idRepo=%i",
+                            idRepo));
+    while (!m_pDS->eof())
+    {
+      if (unchanged.find({m_pDS->fv(1).get_asString(), m_pDS->fv(2).get_asString()}) ==
+          unchanged.end())
+        removed.emplace_back(m_pDS->fv(0).get_asString());
+      m_pDS->next();
+    }
+    m_pDS->close();
+
+    if (!removed.empty())
+    {
+      const std::string ids = StringUtils::Join(removed, ",");
+      m_pDS->exec(PrepareSQL("DELETE FROM addons WHERE id IN (%s)", ids.c_str()));
+      m_pDS->exec(PrepareSQL("DELETE FROM addonlinkrepo WHERE idRepo=%i AND idAddon IN (%s)",
+                             idRepo, ids.c_str()));
+    }
+
+    CLog::Log(LOGDEBUG, "{} repo '{}': {} addons kept, {} removed, {} added", __FUNCTION__,
+              repository, unchanged.size(), removed.size(), addons.size());
+
     m_pDS->exec(
         PrepareSQL("UPDATE repo SET checksum='%s' WHERE id='%i'", checksum.c_str(), idRepo));
     for (const auto& addon : addons)
@@ -883,6 +890,39 @@ bool CAddonDatabase::UpdateRepositoryContent(const std::string& repository,
   return false;
 }
 
+bool CAddonDatabase::GetRepositoryAddonVersions(
+    const std::string& id, std::set<std::pair<std::string, std::string>>& addons)
+{
+  try
+  {
+    if (!m_pDB)
+      return false;
+    if (!m_pDS)
+      return false;
+
+    int idRepo = GetRepositoryId(id);
+    if (idRepo < 0)
+      return false;
+
+    m_pDS->query(PrepareSQL("SELECT addons.addonID, addons.version FROM addons "
+                            "JOIN addonlinkrepo ON addonlinkrepo.idAddon=addons.id "
+                            "WHERE addonlinkrepo.idRepo=%i",
+                            idRepo));
+    while (!m_pDS->eof())
+    {
+      addons.emplace(m_pDS->fv(0).get_asString(), m_pDS->fv(1).get_asString());
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} failed on repo '{}'", __FUNCTION__, id);
+  }
+  return false;
+}
+
 int CAddonDatabase::GetRepoChecksum(const std::string& id, std::string& checksum)
 {
   try
@@ -16,6 +16,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 class CVariant;
@@ -77,10 +78,24 @@ public:
   /*! Returns all addons in the repositories with id `addonId`. */
   bool FindByAddonId(const std::string& addonId, ADDON::VECADDONS& addons) const;
 
-  bool UpdateRepositoryContent(const std::string& repositoryId,
-                               const ADDON::CAddonVersion& version,
-                               const std::string& checksum,
-                               const std::vector<AddonInfoPtr>& addons);
+  /*!
+   \brief Replace the addons of a repository
+   \param addons the new or changed addons of the repository
+   \param unchanged id and version of addons that are kept as they are stored, all other addons
+   of the repository are removed
+   */
+  bool UpdateRepositoryContent(
+      const std::string& repositoryId,
+      const ADDON::CAddonVersion& version,
+      const std::string& checksum,
+      const std::vector<AddonInfoPtr>& addons,
+      const std::set<std::pair<std::string, std::string>>& unchanged = {});
+
+  /*!
+   \brief Get id and version of the addons stored for repository `id`
+   */
+  bool GetRepositoryAddonVersions(const std::string& id,
+                                  std::set<std::pair<std::string, std::string>>& addons);
 
   int GetRepoChecksum(const std::string& id, std::string& checksum);
 
@@ -240,7 +255,6 @@ protected:
 
   bool GetAddon(int id, ADDON::AddonPtr& addon);
   void DeleteRepository(const std::string& id);
-  void DeleteRepositoryContents(const std::string& id);
   int GetRepositoryId(const std::string& addonId);
 };
 
@@ -16,6 +16,7 @@
 #include "addons/AddonDatabase.h"
 #include "addons/AddonEvents.h"
 #include "addons/AddonInstaller.h"
+#include "addons/AddonManifestIndex.h"
 #include "addons/AddonRepos.h"
 #include "addons/AddonSystemSettings.h"
 #include "addons/AddonUpdateRules.h"
@@ -27,11 +28,12 @@
 #include "events/EventLog.h"
 #include "events/NotificationEvent.h"
 #include "filesystem/Directory.h"
+#include "filesystem/File.h"
 #include "filesystem/SpecialProtocol.h"
-#include "utils/FileUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/XMLUtils.h"
+#include "utils/XmlReader.h"
 #include "utils/log.h"
 
 #include <algorithm>
@@ -85,7 +87,8 @@ static bool LoadManifest(std::set<std::string>& system, std::set<std::string>& o
 
 CAddonMgr::CAddonMgr()
   : m_database(std::make_unique<CAddonDatabase>()),
-    m_updateRules(std::make_unique<CAddonUpdateRules>())
+    m_updateRules(std::make_unique<CAddonUpdateRules>()),
+    m_manifestIndex(std::make_unique<CAddonManifestIndex>("special://temp/addonmanifests.json"))
 {
 }
 
@@ -709,6 +712,8 @@ bool CAddonMgr::FindAddons()
     FindAddons(installedAddons, "special://xbmc/addons");
   FindAddons(installedAddons, "special://home/addons");
 
+  m_manifestIndex->Save();
+
   std::set<std::string> installed;
   for (const auto& addon : installedAddons)
     installed.insert(addon.second->ID());
@@ -1293,9 +1298,17 @@ void CAddonMgr::FindAddons(ADDON_INFO_LIST& addonmap, const std::string& path)
     for (int i = 0; i < items.Size(); ++i)
     {
       std::string path = items[i]->GetPath();
-      if (CFileUtils::Exists(path + "addon.xml"))
+      struct __stat64 manifest;
+      if (XFILE::CFile::Stat(path + "addon.xml", &manifest) == 0)
       {
-        AddonInfoPtr addonInfo = CAddonInfoBuilder::Generate(path);
+        // only add-ons whose addon.xml changed since the last scan are parsed
+        AddonInfoPtr addonInfo = m_manifestIndex->Get(path, manifest.st_mtime, manifest.st_size);
+        if (!addonInfo)
+        {
+          addonInfo = CAddonInfoBuilder::Generate(path);
+          if (addonInfo)
+            m_manifestIndex->Set(path, manifest.st_mtime, manifest.st_size, *addonInfo);
+        }
         if (addonInfo)
         {
           const auto& it = addonmap.find(addonInfo->ID());
@@ -1356,32 +1369,79 @@ bool CAddonMgr::SetAddonOrigin(const std::string& addonId, const std::string& re
   return true;
 }
 
-bool CAddonMgr::AddonsFromRepoXML(const RepositoryDirInfo& repo,
-                                  const std::string& xml,
-                                  std::vector<AddonInfoPtr>& addons)
+bool CAddonMgr::AddonsFromRepoXML(
+    const RepositoryDirInfo& repo,
+    const std::string& xml,
+    std::vector<AddonInfoPtr>& addons,
+    const std::set<std::pair<std::string, std::string>>& known /* = {} */,
+    std::set<std::pair<std::string, std::string>>* unchanged /* = nullptr */)
 {
-  CXBMCTinyXML doc;
-  if (!doc.Parse(xml))
-  {
-    CLog::Log(LOGERROR, "CAddonMgr::{}: Failed to parse addons.xml", __func__);
-    return false;
-  }
-
-  if (doc.RootElement() == nullptr || doc.RootElement()->ValueStr() != "addons")
+  // addons.xml of big repositories has thousands of entries, so the document is not loaded as a
+  // whole: each addon element is skipped or parsed on its own
+  CXmlReader reader(xml);
+  if (reader.Next() != CXmlReader::Node::START_ELEMENT || reader.GetName() != "addons")
   {
     CLog::Log(LOGERROR, "CAddonMgr::{}: Failed to parse addons.xml. Malformed", __func__);
     return false;
   }
 
-  // each addon XML should have a UTF-8 declaration
-  auto element = doc.RootElement()->FirstChildElement("addon");
-  while (element)
+  const size_t count = addons.size();
+  CXmlReader::Node node;
+  while ((node = reader.Next()) != CXmlReader::Node::END_ELEMENT)
   {
-    auto addonInfo = CAddonInfoBuilder::Generate(element, repo);
+    if (node == CXmlReader::Node::END || node == CXmlReader::Node::ERROR)
+    {
+      CLog::Log(LOGERROR, "CAddonMgr::{}: Failed to parse addons.xml", __func__);
+      addons.resize(count);
+      return false;
+    }
+    if (node != CXmlReader::Node::START_ELEMENT)
+      continue;
+
+    // building the info of an addon is the expensive part, skip the ones that did not change
+    bool skip = reader.GetName() != "addon";
+    if (!skip && unchanged && !known.empty())
+    {
+      const std::string* id = reader.GetAttribute("id");
+      const std::string* version = reader.GetAttribute("version");
+      if (id && version)
+      {
+        std::pair<std::string, std::string> key(*id, CAddonVersion(*version).asString());
+        if (known.find(key) != known.end())
+        {
+          unchanged->emplace(std::move(key));
+          skip = true;
+        }
+      }
+    }
+
+    if (skip)
+    {
+      if (!reader.SkipElement())
+      {
+        CLog::Log(LOGERROR, "CAddonMgr::{}: Failed to parse addons.xml", __func__);
+        addons.resize(count);
+        return false;
+      }
+      continue;
+    }
+
+    const std::string_view source = reader.ReadElementSource();
+    if (source.empty())
+    {
+      CLog::Log(LOGERROR, "CAddonMgr::{}: Failed to parse addons.xml", __func__);
+      addons.resize(count);
+      return false;
+    }
+
+    // each addon XML should have a UTF-8 declaration
+    CXBMCTinyXML doc;
+    if (!doc.Parse(std::string(source), TIXML_ENCODING_UTF8) || !doc.RootElement())
+      continue;
+
+    auto addonInfo = CAddonInfoBuilder::Generate(doc.RootElement(), repo);
     if (addonInfo)
       addons.emplace_back(addonInfo);
-
-    element = element->NextSiblingElement("addon");
   }
 
   return true;
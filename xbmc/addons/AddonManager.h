@@ -16,6 +16,7 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace ADDON
@@ -27,6 +28,7 @@ enum class AddonUpdateRule;
 enum class AllowCheckForUpdates : bool;
 
 class CAddonDatabase;
+class CAddonManifestIndex;
 class CAddonUpdateRules;
 class CAddonVersion;
 class IAddonMgrCallback;
@@ -569,6 +571,9 @@ public:
      * @param[in] repo The repository info.
      * @param[in] xml The XML document from repository.
      * @param[out] addons returned list of addons.
+     * @param[in] known id and version of the addons that are already known from an earlier
+     *                  update of the repository, these are not built again.
+     * @param[out] unchanged id and version of the addons in xml that are in known.
      * @return true if the repository XML file is parsed, false otherwise.
      *
      * Currently listed call sources:
@@ -576,7 +581,9 @@ public:
      */
   bool AddonsFromRepoXML(const RepositoryDirInfo& repo,
                          const std::string& xml,
-                         std::vector<AddonInfoPtr>& addons);
+                         std::vector<AddonInfoPtr>& addons,
+                         const std::set<std::pair<std::string, std::string>>& known = {},
+                         std::set<std::pair<std::string, std::string>>* unchanged = nullptr);
 
   /*@}}}*/
 
@@ -679,6 +686,7 @@ private:
   mutable CCriticalSection m_critSection;
   std::unique_ptr<CAddonDatabase> m_database;
   std::unique_ptr<CAddonUpdateRules> m_updateRules;
+  std::unique_ptr<CAddonManifestIndex> m_manifestIndex; ///< parsed addon.xml of installed add-ons
   CEventSource<AddonEvent> m_events;
   CBlockingEventSource<AddonEvent> m_unloadEvents;
   std::set<std::string> m_systemAddons;
@@ -0,0 +1,149 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AddonManifestIndex.h"
+
+#include "CompileInfo.h"
+#include "addons/addoninfo/AddonInfo.h"
+#include "addons/addoninfo/AddonInfoBuilder.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace ADDON;
+
+namespace
+{
+constexpr unsigned int INDEX_VERSION = 1;
+} // unnamed namespace
+
+CAddonManifestIndex::CAddonManifestIndex(std::string file) : m_file(std::move(file))
+{
+}
+
+std::string CAddonManifestIndex::GetBuildId()
+{
+  return StringUtils::Format("{}.{}{} {} {}", CCompileInfo::GetMajor(), CCompileInfo::GetMinor(),
+                             CCompileInfo::GetSuffix(), CCompileInfo::GetSCMID(),
+                             CCompileInfo::GetBuildDate());
+}
+
+void CAddonManifestIndex::Load()
+{
+  m_loaded = true;
+
+  std::vector<uint8_t> buffer;
+  XFILE::CFile file;
+  if (file.LoadFile(m_file, buffer) <= 0)
+    return;
+
+  CVariant index;
+  if (!CJSONVariantParser::Parse(std::string(buffer.begin(), buffer.end()), index) ||
+      index["version"].asUnsignedInteger() != INDEX_VERSION ||
+      index["build"].asString() != GetBuildId())
+  {
+    CLog::Log(LOGDEBUG, "CAddonManifestIndex::{}: ignoring outdated index {}", __FUNCTION__,
+              m_file);
+    return;
+  }
+
+  const CVariant& entries = index["entries"];
+  for (auto it = entries.begin_map(); it != entries.end_map(); ++it)
+  {
+    Entry entry;
+    entry.mtime = it->second["mtime"].asInteger();
+    entry.size = it->second["size"].asInteger();
+    entry.manifest = it->second["manifest"];
+    m_entries.emplace(it->first, std::move(entry));
+  }
+}
+
+AddonInfoPtr CAddonManifestIndex::Get(const std::string& addonPath, int64_t mtime, int64_t size)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (!m_loaded)
+    Load();
+
+  const auto it = m_entries.find(addonPath);
+  if (it == m_entries.end())
+    return nullptr;
+
+  Entry& entry = it->second;
+  // the add-on may have moved together with the special path it was found at
+  if (entry.mtime != mtime || entry.size != size ||
+      entry.manifest["path"].asString() != CSpecialProtocol::TranslatePath(addonPath))
+    return nullptr;
+
+  AddonInfoPtr addon = CAddonInfoBuilder::GenerateFromManifest(entry.manifest);
+  if (addon)
+    entry.used = true;
+  return addon;
+}
+
+void CAddonManifestIndex::Set(const std::string& addonPath,
+                              int64_t mtime,
+                              int64_t size,
+                              const CAddonInfo& addon)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (!m_loaded)
+    Load();
+
+  Entry& entry = m_entries[addonPath];
+  entry.mtime = mtime;
+  entry.size = size;
+  CAddonInfoBuilder::Serialize(addon, entry.manifest);
+  entry.used = true;
+  m_changed = true;
+}
+
+void CAddonManifestIndex::Save()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  for (auto it = m_entries.begin(); it != m_entries.end();)
+  {
+    if (!it->second.used)
+    {
+      it = m_entries.erase(it);
+      m_changed = true;
+      continue;
+    }
+    it->second.used = false;
+    ++it;
+  }
+
+  if (!m_changed)
+    return;
+  m_changed = false;
+
+  CVariant index(CVariant::VariantTypeObject);
+  index["version"] = INDEX_VERSION;
+  index["build"] = GetBuildId();
+  CVariant& entries = index["entries"];
+  entries = CVariant(CVariant::VariantTypeObject);
+  for (const auto& it : m_entries)
+  {
+    CVariant& entry = entries[it.first];
+    entry["mtime"] = it.second.mtime;
+    entry["size"] = it.second.size;
+    entry["manifest"] = it.second.manifest;
+  }
+
+  std::string json;
+  XFILE::CFile file;
+  if (!CJSONVariantWriter::Write(index, json, true) || !file.OpenForWrite(m_file, true) ||
+      file.Write(json.c_str(), json.size()) != static_cast<ssize_t>(json.size()))
+    CLog::Log(LOGWARNING, "CAddonManifestIndex::{}: unable to write {}", __FUNCTION__, m_file);
+}
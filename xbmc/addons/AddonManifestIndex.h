@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "utils/Variant.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace ADDON
+{
+
+class CAddonInfo;
+using AddonInfoPtr = std::shared_ptr<CAddonInfo>;
+
+/*!
+ * @brief Persistent index of the parsed addon.xml of installed add-ons.
+ *
+ * Each entry is keyed by the add-on directory and is only used while the modification time and
+ * size of its addon.xml match the ones it was created from. The whole index is dropped when it
+ * was written by a different build, as platform tags and type identifiers may differ.
+ */
+class CAddonManifestIndex
+{
+public:
+  explicit CAddonManifestIndex(std::string file);
+
+  /*!
+   * @brief Get the add-on info stored for an add-on directory.
+   *
+   * @param[in] addonPath the add-on directory, with a trailing slash
+   * @param[in] mtime modification time of its addon.xml
+   * @param[in] size size of its addon.xml
+   * @return nullptr if there is no valid entry
+   */
+  AddonInfoPtr Get(const std::string& addonPath, int64_t mtime, int64_t size);
+
+  void Set(const std::string& addonPath, int64_t mtime, int64_t size, const CAddonInfo& addon);
+
+  /*!
+   * @brief Write the index if it changed, dropping all entries that were not used since the
+   * index was loaded or last saved.
+   */
+  void Save();
+
+private:
+  struct Entry
+  {
+    int64_t mtime = 0;
+    int64_t size = 0;
+    CVariant manifest;
+    bool used = false;
+  };
+
+  void Load();
+  static std::string GetBuildId();
+
+  const std::string m_file;
+  CCriticalSection m_critSection;
+  std::map<std::string, Entry> m_entries;
+  bool m_loaded = false;
+  bool m_changed = false;
+};
+
+} // namespace ADDON
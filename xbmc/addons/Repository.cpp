@@ -19,10 +19,12 @@
 #include "addons/addoninfo/AddonType.h"
 #include "filesystem/CurlFile.h"
 #include "filesystem/File.h"
+#include "filesystem/HttpCache.h"
 #include "filesystem/ZipFile.h"
 #include "messaging/helpers/DialogHelper.h"
 #include "utils/Base64.h"
 #include "utils/Digest.h"
+#include "utils/HttpHeader.h"
 #include "utils/Mime.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
@@ -30,6 +32,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <future>
 #include <iterator>
 #include <tuple>
 #include <utility>
@@ -200,12 +203,16 @@ bool CRepository::FetchChecksum(const std::string& url,
 
 bool CRepository::FetchIndex(const RepositoryDirInfo& repo,
                              std::string const& digest,
-                             std::vector<AddonInfoPtr>& addons) noexcept
+                             std::vector<AddonInfoPtr>& addons,
+                             const std::set<std::pair<std::string, std::string>>& known,
+                             std::set<std::pair<std::string, std::string>>* unchanged) noexcept
 {
   XFILE::CCurlFile http;
 
+  // the index of a repository is usually unchanged when only one of its other directories changed
   std::string response;
-  if (!http.Get(repo.info, response))
+  std::string contentType;
+  if (!XFILE::CHttpCache::Get(http, repo.info, response, contentType))
   {
     CLog::Log(LOGERROR, "CRepository: failed to read {}", repo.info);
     return false;
@@ -221,8 +228,11 @@ bool CRepository::FetchIndex(const RepositoryDirInfo& repo,
     }
   }
 
+  // a cached response has no headers of its own in http
+  CHttpHeader contentHeader;
+  contentHeader.AddParam("content-type", contentType);
   if (URIUtils::HasExtension(repo.info, ".gz")
-      || CMime::GetFileTypeFromMime(http.GetProperty(XFILE::FILE_PROPERTY_MIME_TYPE)) == CMime::EFileType::FileTypeGZip)
+      || CMime::GetFileTypeFromMime(contentHeader.GetMimeType()) == CMime::EFileType::FileTypeGZip)
   {
     CLog::Log(LOGDEBUG, "CRepository '{}' is gzip. decompressing", repo.info);
     std::string buffer;
@@ -234,36 +244,62 @@ bool CRepository::FetchIndex(const RepositoryDirInfo& repo,
     response = std::move(buffer);
   }
 
-  return CServiceBroker::GetAddonMgr().AddonsFromRepoXML(repo, response, addons);
+  return CServiceBroker::GetAddonMgr().AddonsFromRepoXML(repo, response, addons, known, unchanged);
 }
 
-CRepository::FetchStatus CRepository::FetchIfChanged(const std::string& oldChecksum,
-                                                     std::string& checksum,
-                                                     std::vector<AddonInfoPtr>& addons,
-                                                     int& recheckAfter) const
+CRepository::FetchStatus CRepository::FetchIfChanged(
+    const std::string& oldChecksum,
+    std::string& checksum,
+    std::vector<AddonInfoPtr>& addons,
+    int& recheckAfter,
+    const std::set<std::pair<std::string, std::string>>& known /* = {} */,
+    std::set<std::pair<std::string, std::string>>* unchanged /* = nullptr */) const
 {
   checksum = "";
   std::vector<std::tuple<RepositoryDirInfo const&, std::string>> dirChecksums;
   std::vector<int> recheckAfterTimes;
 
+  // the directories are fetched at the same time, they are mostly on different mirrors anyway
+  struct ChecksumResult
+  {
+    const RepositoryDirInfo* dir;
+    bool success{false};
+    std::string checksum;
+    int recheckAfter{0};
+  };
+  std::vector<std::future<ChecksumResult>> checksumTasks;
   for (const auto& dir : m_dirs)
   {
     if (!dir.checksum.empty())
     {
-      std::string part;
-      int recheckAfterThisDir;
-      if (!FetchChecksum(dir.checksum, part, recheckAfterThisDir))
-      {
-        recheckAfter = 1 * 60 * 60; // retry after 1 hour
-        CLog::Log(LOGERROR, "CRepository: failed read '{}'", dir.checksum);
-        return STATUS_ERROR;
-      }
-      dirChecksums.emplace_back(dir, part);
-      recheckAfterTimes.push_back(recheckAfterThisDir);
-      checksum += part;
+      checksumTasks.emplace_back(std::async(std::launch::async, [&dir]() {
+        ChecksumResult result{&dir};
+        result.success = FetchChecksum(dir.checksum, result.checksum, result.recheckAfter);
+        return result;
+      }));
     }
   }
 
+  bool failed = false;
+  for (auto& task : checksumTasks)
+  {
+    ChecksumResult result = task.get();
+    if (!result.success)
+    {
+      CLog::Log(LOGERROR, "CRepository: failed read '{}'", result.dir->checksum);
+      failed = true;
+      continue;
+    }
+    dirChecksums.emplace_back(*result.dir, result.checksum);
+    recheckAfterTimes.push_back(result.recheckAfter);
+    checksum += result.checksum;
+  }
+  if (failed)
+  {
+    recheckAfter = 1 * 60 * 60; // retry after 1 hour
+    return STATUS_ERROR;
+  }
+
   // Default interval: 24 h
   recheckAfter = 24 * 60 * 60;
   if (dirChecksums.size() == m_dirs.size() && !dirChecksums.empty())
@@ -276,14 +312,37 @@ CRepository::FetchStatus CRepository::FetchIfChanged(const std::string& oldCheck
       return STATUS_NOT_MODIFIED;
   }
 
+  struct IndexResult
+  {
+    bool success{false};
+    std::vector<AddonInfoPtr> addons;
+    std::set<std::pair<std::string, std::string>> unchanged;
+  };
+  std::vector<std::future<IndexResult>> indexTasks;
   for (const auto& dirTuple : dirChecksums)
   {
-    std::vector<AddonInfoPtr> tmp;
-    if (!FetchIndex(std::get<0>(dirTuple), std::get<1>(dirTuple), tmp))
-      return STATUS_ERROR;
-    addons.insert(addons.end(), tmp.begin(), tmp.end());
+    indexTasks.emplace_back(std::async(std::launch::async, [&dirTuple, &known, unchanged]() {
+      IndexResult result;
+      result.success = FetchIndex(std::get<0>(dirTuple), std::get<1>(dirTuple), result.addons,
+                                  known, unchanged ? &result.unchanged : nullptr);
+      return result;
+    }));
+  }
+
+  FetchStatus status = STATUS_OK;
+  for (auto& task : indexTasks)
+  {
+    IndexResult result = task.get();
+    if (!result.success)
+    {
+      status = STATUS_ERROR;
+      continue;
+    }
+    addons.insert(addons.end(), result.addons.begin(), result.addons.end());
+    if (unchanged)
+      unchanged->insert(result.unchanged.begin(), result.unchanged.end());
   }
-  return STATUS_OK;
+  return status;
 }
 
 RepositoryDirInfo CRepository::ParseDirConfiguration(const CAddonExtensions& configuration)
@@ -13,7 +13,9 @@
 #include "utils/Digest.h"
 
 #include <memory>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace ADDON
@@ -46,10 +48,19 @@ public:
     STATUS_ERROR
   };
 
-  FetchStatus FetchIfChanged(const std::string& oldChecksum,
-                             std::string& checksum,
-                             std::vector<AddonInfoPtr>& addons,
-                             int& recheckAfter) const;
+  /*!
+   * \brief Fetch the addons of all directories of the repository if any of them changed
+   * \param known id and version of the addons stored by the last update, only addons that are not
+   * in it are returned in addons
+   * \param[out] unchanged id and version of the addons of the repository that are in known
+   */
+  FetchStatus FetchIfChanged(
+      const std::string& oldChecksum,
+      std::string& checksum,
+      std::vector<AddonInfoPtr>& addons,
+      int& recheckAfter,
+      const std::set<std::pair<std::string, std::string>>& known = {},
+      std::set<std::pair<std::string, std::string>>* unchanged = nullptr) const;
 
   struct ResolveResult
   {
@@ -64,7 +75,9 @@ private:
                             int& recheckAfter) noexcept;
   static bool FetchIndex(const RepositoryDirInfo& repo,
                          std::string const& digest,
-                         std::vector<AddonInfoPtr>& addons) noexcept;
+                         std::vector<AddonInfoPtr>& addons,
+                         const std::set<std::pair<std::string, std::string>>& known,
+                         std::set<std::pair<std::string, std::string>>* unchanged) noexcept;
 
   static RepositoryDirInfo ParseDirConfiguration(const CAddonExtensions& configuration);
 
@@ -35,6 +35,8 @@
 #include <algorithm>
 #include <iterator>
 #include <mutex>
+#include <set>
+#include <utility>
 #include <vector>
 
 using namespace std::chrono_literals;
@@ -68,10 +70,17 @@ bool CRepositoryUpdateJob::DoWork()
   if (updateData.lastCheckedVersion != m_repo->Version())
     oldChecksum = "";
 
+  // addons stored by the last update of this repository version are kept if they did not change
+  std::set<std::pair<std::string, std::string>> known;
+  if (!oldChecksum.empty())
+    database.GetRepositoryAddonVersions(m_repo->ID(), known);
+
   std::string newChecksum;
   std::vector<AddonInfoPtr> addons;
+  std::set<std::pair<std::string, std::string>> unchanged;
   int recheckAfter;
-  auto status = m_repo->FetchIfChanged(oldChecksum, newChecksum, addons, recheckAfter);
+  auto status =
+      m_repo->FetchIfChanged(oldChecksum, newChecksum, addons, recheckAfter, known, &unchanged);
 
   database.SetRepoUpdateData(
       m_repo->ID(), CAddonDatabase::RepoUpdateData(
@@ -118,7 +127,8 @@ bool CRepositoryUpdateJob::DoWork()
     textureDB.CommitMultipleExecute();
   }
 
-  database.UpdateRepositoryContent(m_repo->ID(), m_repo->Version(), newChecksum, addons);
+  database.UpdateRepositoryContent(m_repo->ID(), m_repo->Version(), newChecksum, addons,
+                                   unchanged);
   return true;
 }
 
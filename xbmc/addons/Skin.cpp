@@ -17,6 +17,7 @@
 #include "filesystem/SpecialProtocol.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
+#include "guilib/GUIWindowXMLCache.h"
 #include "guilib/LocalizeStrings.h"
 #include "guilib/WindowIDs.h"
 #include "messaging/ApplicationMessenger.h"
@@ -282,6 +283,9 @@ void CSkinInfo::LoadIncludes()
   CLog::Log(LOGINFO, "Loading skin includes from {}", includesPath);
   m_includes.Clear();
   m_includes.Load(includesPath);
+
+  // windows resolved against the previous includes have to be resolved again
+  CGUIWindowXMLCache::GetInstance().ClearResolved();
 }
 
 void CSkinInfo::LoadTimers()
@@ -424,6 +428,16 @@ void CSkinInfo::Unload()
   m_skinTimerManager->Stop();
 }
 
+bool CSkinInfo::ReloadUserSettings()
+{
+  // a profile without skin settings must not inherit the ones of the previous profile
+  m_settings.clear();
+  m_strings.clear();
+  m_bools.clear();
+
+  return LoadUserSettings();
+}
+
 bool CSkinInfo::TimerIsRunning(const std::string& timer) const
 {
   return m_skinTimerManager->TimerIsRunning(timer);
@@ -186,6 +186,12 @@ public:
    */
   void Unload();
 
+  /*! \brief Replace the skin settings by the ones of the current profile, for a skin that stays
+   loaded when switching profiles.
+   \return true if the settings were loaded, false otherwise.
+   */
+  bool ReloadUserSettings();
+
   void ToggleDebug();
   const INFO::CSkinVariableString* CreateSkinVariable(const std::string& name, int context);
 
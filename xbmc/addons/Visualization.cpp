@@ -36,6 +36,13 @@ void clear_presets(const KODI_HANDLE hdl)
     static_cast<CVisualization*>(hdl)->ClearPresets();
 }
 
+size_t get_spectrum(const KODI_HANDLE hdl, float* spectrum, size_t size)
+{
+  if (hdl && spectrum)
+    return static_cast<CVisualization*>(hdl)->GetSpectrum(spectrum, size);
+  return 0;
+}
+
 } // namespace
 
 CVisualization::CVisualization(const AddonInfoPtr& addonInfo, float x, float y, float w, float h)
@@ -52,6 +59,7 @@ CVisualization::CVisualization(const AddonInfoPtr& addonInfo, float x, float y,
   m_ifc.visualization->toKodi->get_properties = get_properties;
   m_ifc.visualization->toKodi->transfer_preset = transfer_preset;
   m_ifc.visualization->toKodi->clear_presets = clear_presets;
+  m_ifc.visualization->toKodi->get_spectrum = get_spectrum;
 
   /* Open the class "kodi::addon::CInstanceVisualization" on add-on side */
   if (CreateInstance() != ADDON_STATUS_OK)
@@ -80,6 +88,8 @@ bool CVisualization::Start(int channels,
                            int bitsPerSample,
                            const std::string& songName)
 {
+  m_spectrum.Reset(samplesPerSec);
+
   if (m_ifc.visualization->toAddon->start)
     return m_ifc.visualization->toAddon->start(m_ifc.hdl, channels, samplesPerSec, bitsPerSample,
                                                songName.c_str());
@@ -94,6 +104,9 @@ void CVisualization::Stop()
 
 void CVisualization::AudioData(const float* audioData, int audioDataLength)
 {
+  // analyzed before the add-on gets the data, so that it can query the spectrum of this block
+  m_spectrum.Add(audioData, audioDataLength);
+
   if (m_ifc.visualization->toAddon->audio_data)
     m_ifc.visualization->toAddon->audio_data(m_ifc.hdl, audioData, audioDataLength);
 }
@@ -216,6 +229,11 @@ void CVisualization::ClearPresets()
   m_presets.clear();
 }
 
+size_t CVisualization::GetSpectrum(float* spectrum, size_t size)
+{
+  return m_spectrum.GetSpectrum(spectrum, size);
+}
+
 void CVisualization::GetProperties(struct KODI_ADDON_VISUALIZATION_PROPS* props)
 {
   if (!props)
@@ -10,6 +10,7 @@
 
 #include "addons/binary-addons/AddonInstanceHandler.h"
 #include "addons/kodi-dev-kit/include/kodi/addon-instance/Visualization.h"
+#include "utils/SpectrumAnalyzer.h"
 
 namespace KODI
 {
@@ -42,10 +43,16 @@ public:
   std::string GetActivePresetName();
   bool IsLocked();
 
+  /*!
+   * \brief The spectrum of the audio passed to AudioData(), shared with the add-on and skins
+   */
+  const CSpectrumAnalyzer& GetSpectrumAnalyzer() const { return m_spectrum; }
+
   // Addon callback functions
   void GetProperties(struct KODI_ADDON_VISUALIZATION_PROPS* props);
   void TransferPreset(const std::string& preset);
   void ClearPresets();
+  size_t GetSpectrum(float* spectrum, size_t size);
 
 private:
   const int m_x;
@@ -53,6 +60,7 @@ private:
   const int m_width;
   const int m_height;
   std::vector<std::string> m_presets; /*!< cached preset list */
+  CSpectrumAnalyzer m_spectrum;
 };
 
 } // namespace ADDONS
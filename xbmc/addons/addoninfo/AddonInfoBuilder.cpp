@@ -31,6 +31,22 @@ namespace
 {
 // Note that all of these characters are url-safe
 const std::string VALID_ADDON_IDENTIFIER_CHARACTERS = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789.-_@!$";
+
+template<typename Map>
+CVariant MapToVariant(const Map& map)
+{
+  CVariant variant(CVariant::VariantTypeObject);
+  for (const auto& it : map)
+    variant[it.first] = it.second;
+  return variant;
+}
+
+template<typename Map>
+void VariantToMap(const CVariant& variant, Map& map)
+{
+  for (auto it = variant.begin_map(); it != variant.end_map(); ++it)
+    map.emplace(it->first, it->second.asString());
+}
 }
 
 namespace ADDON
@@ -872,4 +888,197 @@ bool CAddonInfoBuilder::PlatformSupportsAddon(const AddonInfoPtr& addon)
       supportedPlatforms.begin(), supportedPlatforms.end()) != addon->m_platforms.end();
 }
 
+
+void CAddonInfoBuilder::Serialize(const CAddonInfo& addon, CVariant& manifest)
+{
+  manifest = CVariant(CVariant::VariantTypeObject);
+  manifest["id"] = addon.m_id;
+  manifest["maintype"] = static_cast<unsigned int>(addon.m_mainType);
+  manifest["version"] = addon.m_version.asString();
+  manifest["minversion"] = addon.m_minversion.asString();
+  manifest["binary"] = addon.m_isBinary;
+  manifest["name"] = addon.m_name;
+  manifest["license"] = addon.m_license;
+  manifest["summary"] = MapToVariant(addon.m_summary);
+  manifest["description"] = MapToVariant(addon.m_description);
+  manifest["author"] = addon.m_author;
+  manifest["source"] = addon.m_source;
+  manifest["website"] = addon.m_website;
+  manifest["forum"] = addon.m_forum;
+  manifest["email"] = addon.m_email;
+  manifest["path"] = addon.m_path;
+  manifest["profilepath"] = addon.m_profilePath;
+  manifest["changelog"] = MapToVariant(addon.m_changelog);
+  manifest["icon"] = addon.m_icon;
+  manifest["art"] = MapToVariant(addon.m_art);
+  manifest["disclaimer"] = MapToVariant(addon.m_disclaimer);
+  manifest["lifecycletype"] = static_cast<unsigned int>(addon.m_lifecycleState);
+  manifest["lifecycledesc"] = MapToVariant(addon.m_lifecycleStateDescription);
+  manifest["size"] = addon.m_packageSize;
+  manifest["libname"] = addon.m_libname;
+  manifest["extrainfo"] = MapToVariant(addon.m_extrainfo);
+  manifest["instancesupport"] = static_cast<unsigned int>(addon.m_addonInstanceSupportType);
+  manifest["addonsettings"] = addon.m_supportsAddonSettings;
+  manifest["instancesettings"] = addon.m_supportsInstanceSettings;
+
+  manifest["screenshots"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& screenshot : addon.m_screenshots)
+    manifest["screenshots"].push_back(screenshot);
+
+  manifest["platforms"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& platform : addon.m_platforms)
+    manifest["platforms"].push_back(platform);
+
+  manifest["dependencies"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& dep : addon.m_dependencies)
+  {
+    CVariant info(CVariant::VariantTypeObject);
+    info["addonId"] = dep.id;
+    info["version"] = dep.version.asString();
+    info["minversion"] = dep.versionMin.asString();
+    info["optional"] = dep.optional;
+    manifest["dependencies"].push_back(std::move(info));
+  }
+
+  manifest["types"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& type : addon.m_types)
+  {
+    CVariant info(CVariant::VariantTypeObject);
+    info["type"] = static_cast<unsigned int>(type.m_type);
+    info["path"] = type.m_path;
+    info["libname"] = type.m_libname;
+    info["provides"] = CVariant(CVariant::VariantTypeArray);
+    for (const auto& content : type.m_providedSubContent)
+      info["provides"].push_back(static_cast<unsigned int>(content));
+    SerializeExtensions(type, info["extension"]);
+    manifest["types"].push_back(std::move(info));
+  }
+}
+
+AddonInfoPtr CAddonInfoBuilder::GenerateFromManifest(const CVariant& manifest,
+                                                     bool platformCheck /* = true */)
+{
+  if (!manifest.isObject() || manifest["id"].asString().empty())
+    return nullptr;
+
+  AddonInfoPtr addon = std::make_shared<CAddonInfo>();
+  addon->m_id = manifest["id"].asString();
+  addon->m_mainType = static_cast<AddonType>(manifest["maintype"].asUnsignedInteger());
+  addon->m_version = CAddonVersion(manifest["version"].asString());
+  addon->m_minversion = CAddonVersion(manifest["minversion"].asString());
+  addon->m_isBinary = manifest["binary"].asBoolean();
+  addon->m_name = manifest["name"].asString();
+  addon->m_license = manifest["license"].asString();
+  VariantToMap(manifest["summary"], addon->m_summary);
+  VariantToMap(manifest["description"], addon->m_description);
+  addon->m_author = manifest["author"].asString();
+  addon->m_source = manifest["source"].asString();
+  addon->m_website = manifest["website"].asString();
+  addon->m_forum = manifest["forum"].asString();
+  addon->m_email = manifest["email"].asString();
+  addon->m_path = manifest["path"].asString();
+  addon->m_profilePath = manifest["profilepath"].asString();
+  VariantToMap(manifest["changelog"], addon->m_changelog);
+  addon->m_icon = manifest["icon"].asString();
+  VariantToMap(manifest["art"], addon->m_art);
+  VariantToMap(manifest["disclaimer"], addon->m_disclaimer);
+  addon->m_lifecycleState =
+      static_cast<AddonLifecycleState>(manifest["lifecycletype"].asUnsignedInteger());
+  VariantToMap(manifest["lifecycledesc"], addon->m_lifecycleStateDescription);
+  addon->m_packageSize = manifest["size"].asUnsignedInteger();
+  addon->m_libname = manifest["libname"].asString();
+  VariantToMap(manifest["extrainfo"], addon->m_extrainfo);
+  addon->m_addonInstanceSupportType =
+      static_cast<AddonInstanceSupport>(manifest["instancesupport"].asUnsignedInteger());
+  addon->m_supportsAddonSettings = manifest["addonsettings"].asBoolean();
+  addon->m_supportsInstanceSettings = manifest["instancesettings"].asBoolean();
+
+  for (auto it = manifest["screenshots"].begin_array(); it != manifest["screenshots"].end_array();
+       ++it)
+    addon->m_screenshots.push_back(it->asString());
+
+  for (auto it = manifest["platforms"].begin_array(); it != manifest["platforms"].end_array(); ++it)
+    addon->m_platforms.push_back(it->asString());
+
+  for (auto it = manifest["dependencies"].begin_array();
+       it != manifest["dependencies"].end_array(); ++it)
+  {
+    addon->m_dependencies.emplace_back(
+        (*it)["addonId"].asString(), CAddonVersion((*it)["minversion"].asString()),
+        CAddonVersion((*it)["version"].asString()), (*it)["optional"].asBoolean());
+  }
+
+  for (auto it = manifest["types"].begin_array(); it != manifest["types"].end_array(); ++it)
+  {
+    CAddonType type(static_cast<AddonType>((*it)["type"].asUnsignedInteger()));
+    type.m_path = (*it)["path"].asString();
+    type.m_libname = (*it)["libname"].asString();
+    for (auto content = (*it)["provides"].begin_array(); content != (*it)["provides"].end_array();
+         ++content)
+      type.m_providedSubContent.insert(static_cast<AddonType>(content->asUnsignedInteger()));
+    DeserializeExtensions((*it)["extension"], type);
+    addon->m_types.push_back(std::move(type));
+  }
+
+  if (!platformCheck || PlatformSupportsAddon(addon))
+    return addon;
+
+  return nullptr;
+}
+
+void CAddonInfoBuilder::SerializeExtensions(const CAddonExtensions& extensions, CVariant& variant)
+{
+  variant = CVariant(CVariant::VariantTypeObject);
+  variant["point"] = extensions.m_point;
+
+  variant["values"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& value : extensions.m_values)
+  {
+    CVariant info(CVariant::VariantTypeObject);
+    info["id"] = value.first;
+    info["content"] = CVariant(CVariant::VariantTypeArray);
+    for (const auto& content : value.second)
+    {
+      CVariant entry(CVariant::VariantTypeObject);
+      entry["key"] = content.first;
+      entry["value"] = content.second.str;
+      info["content"].push_back(std::move(entry));
+    }
+    variant["values"].push_back(std::move(info));
+  }
+
+  variant["children"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& child : extensions.m_children)
+  {
+    CVariant info(CVariant::VariantTypeObject);
+    info["id"] = child.first;
+    SerializeExtensions(child.second, info["child"]);
+    variant["children"].push_back(std::move(info));
+  }
+}
+
+void CAddonInfoBuilder::DeserializeExtensions(const CVariant& variant,
+                                              CAddonExtensions& extensions)
+{
+  extensions.m_point = variant["point"].asString();
+
+  for (auto value = variant["values"].begin_array(); value != variant["values"].end_array();
+       ++value)
+  {
+    EXT_VALUE content;
+    for (auto entry = (*value)["content"].begin_array(); entry != (*value)["content"].end_array();
+         ++entry)
+      content.emplace_back((*entry)["key"].asString(), SExtValue((*entry)["value"].asString()));
+    extensions.m_values.emplace_back((*value)["id"].asString(), content);
+  }
+
+  for (auto child = variant["children"].begin_array(); child != variant["children"].end_array();
+       ++child)
+  {
+    CAddonExtensions childExtensions;
+    DeserializeExtensions((*child)["child"], childExtensions);
+    extensions.m_children.emplace_back((*child)["id"].asString(), std::move(childExtensions));
+  }
+}
+
 }
@@ -17,6 +17,7 @@
 #include <vector>
 
 class CDateTime;
+class CVariant;
 class TiXmlElement;
 
 namespace ADDON
@@ -50,6 +51,15 @@ public:
                              const CDateTime& lastUpdated, const CDateTime& lastUsed, const std::string& origin);
   //@}
 
+  /*!
+    * @brief Parts used by the manifest index of CAddonMgr, which stores the result of parsing
+    * the addon.xml of installed add-ons.
+    */
+  //@{
+  static void Serialize(const CAddonInfo& addon, CVariant& manifest);
+  static AddonInfoPtr GenerateFromManifest(const CVariant& manifest, bool platformCheck = true);
+  //@}
+
 private:
   static bool ParseXML(const AddonInfoPtr& addon,
                        const TiXmlElement* element,
@@ -65,6 +75,8 @@ private:
   static bool GetTextList(const TiXmlElement* element, const std::string& tag, std::unordered_map<std::string, std::string>& translatedValues);
   static const char* GetPlatformLibraryName(const TiXmlElement* element);
   static bool PlatformSupportsAddon(const AddonInfoPtr& addon);
+  static void SerializeExtensions(const CAddonExtensions& extensions, CVariant& variant);
+  static void DeserializeExtensions(const CVariant& variant, CAddonExtensions& extensions);
 };
 
 class CAddonInfoBuilderFromDB
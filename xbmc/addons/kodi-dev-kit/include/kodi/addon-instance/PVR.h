@@ -1778,6 +1778,35 @@ public:
   }
   //----------------------------------------------------------------------------
 
+  //============================================================================
+  /// @brief Request the recordings changed on the backend since the given time, if supported.
+  ///
+  /// Kodi calls this instead of @ref GetRecordings() once it has fetched the full list, so
+  /// backends with many recordings do not have to transfer all of them again on every update.
+  /// Recordings added or modified at or after `since` are transferred with
+  /// @ref cpp_kodi_addon_pvr_Defs_Recording_PVRRecordingsResultSet "PVRRecordingsResultSet::Add()",
+  /// the ids of removed recordings with
+  /// @ref cpp_kodi_addon_pvr_Defs_Recording_PVRRecordingsResultSet "PVRRecordingsResultSet::Remove()".
+  ///
+  /// @param[in] deleted if set return deleted recording (called if
+  ///                    @ref PVRCapabilities::SetSupportsRecordingsUndelete "supportsRecordingsUndelete"
+  ///                    set to true)
+  /// @param[in] since The time Kodi started its previous successful fetch, in UTC.
+  /// @param[out] results The changed and removed recordings, given to Kodi
+  /// @return @ref PVR_ERROR_NO_ERROR if the changes have been fetched successfully. On any
+  ///         error Kodi falls back to @ref GetRecordings().
+  ///
+  /// @remarks Optional, and only used if @ref PVRCapabilities::SetSupportsRecordingsDelta "supportsRecordingsDelta"
+  /// is set to true.
+  ///
+  virtual PVR_ERROR GetRecordingsChangedSince(bool deleted,
+                                              time_t since,
+                                              kodi::addon::PVRRecordingsResultSet& results)
+  {
+    return PVR_ERROR_NOT_IMPLEMENTED;
+  }
+  //----------------------------------------------------------------------------
+
   //============================================================================
   /// @brief Delete a recording on the backend.
   ///
@@ -2772,6 +2801,7 @@ private:
     //--==----==----==----==----==----==----==----==----==----==----==----==----==
     instance->pvr->toAddon->GetRecordingsAmount = ADDON_GetRecordingsAmount;
     instance->pvr->toAddon->GetRecordings = ADDON_GetRecordings;
+    instance->pvr->toAddon->GetRecordingsChangedSince = ADDON_GetRecordingsChangedSince;
     instance->pvr->toAddon->DeleteRecording = ADDON_DeleteRecording;
     instance->pvr->toAddon->UndeleteRecording = ADDON_UndeleteRecording;
     instance->pvr->toAddon->DeleteAllRecordingsFromTrash = ADDON_DeleteAllRecordingsFromTrash;
@@ -3168,6 +3198,16 @@ private:
         ->GetRecordings(deleted, result);
   }
 
+  inline static PVR_ERROR ADDON_GetRecordingsChangedSince(const AddonInstance_PVR* instance,
+                                                          PVR_HANDLE handle,
+                                                          bool deleted,
+                                                          time_t since)
+  {
+    PVRRecordingsResultSet result(instance, handle);
+    return static_cast<CInstancePVRClient*>(instance->toAddon->addonInstance)
+        ->GetRecordingsChangedSince(deleted, since, result);
+  }
+
   inline static PVR_ERROR ADDON_DeleteRecording(const AddonInstance_PVR* instance,
                                                 const PVR_RECORDING* recording)
   {
@@ -693,6 +693,30 @@ public:
   }
   //----------------------------------------------------------------------------
 
+  //============================================================================
+  /// @ingroup cpp_kodi_addon_visualization_CB
+  /// @brief To get the spectrum Kodi computed for the audio data.
+  ///
+  /// Kodi analyzes the stereo audio in blocks of 512 frames before it is
+  /// passed to @ref AudioData, so add-ons which only need magnitudes do not
+  /// have to run their own FFT.
+  ///
+  /// @param[out] spectrum Magnitudes of the last block, interleaved for left
+  ///                      and right channel and ordered by frequency in steps
+  ///                      of `samplesPerSec / 512`
+  /// @return true if a block has been analyzed since @ref Start
+  ///
+  /// @note Can be called from @ref AudioData or @ref Render.
+  ///
+  inline bool GetSpectrum(std::vector<float>& spectrum)
+  {
+    spectrum.resize(512);
+    spectrum.resize(m_instanceData->visualization->toKodi->get_spectrum(
+        m_instanceData->info->kodi, spectrum.data(), spectrum.size()));
+    return !spectrum.empty();
+  }
+  //----------------------------------------------------------------------------
+
   //============================================================================
   /// @ingroup cpp_kodi_addon_visualization_CB
   /// @brief Device that represents the display adapter.
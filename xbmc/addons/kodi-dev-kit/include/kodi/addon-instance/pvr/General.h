@@ -150,6 +150,7 @@ public:
   /// | **Supports async EPG transfer** | `boolean` | @ref PVRCapabilities::SetSupportsAsyncEPGTransfer "SetSupportsAsyncEPGTransfer" | @ref PVRCapabilities::GetSupportsAsyncEPGTransfer "GetSupportsAsyncEPGTransfer"
   /// | **Supports recording size** | `boolean` | @ref PVRCapabilities::SetSupportsRecordingSize "SetSupportsRecordingSize" | @ref PVRCapabilities::GetSupportsRecordingSize "GetSupportsRecordingSize"
   /// | **Supports recordings delete** | `boolean` | @ref PVRCapabilities::SetSupportsRecordingsDelete "SetSupportsRecordingsDelete" | @ref PVRCapabilities::GetSupportsRecordingsDelete "SetSupportsRecordingsDelete"
+  /// | **Supports recordings delta** | `boolean` | @ref PVRCapabilities::SetSupportsRecordingsDelta "SetSupportsRecordingsDelta" | @ref PVRCapabilities::GetSupportsRecordingsDelta "GetSupportsRecordingsDelta"
   /// | **Recordings lifetime values** | @ref cpp_kodi_addon_pvr_Defs_PVRTypeIntValue "PVRTypeIntValue" | @ref PVRCapabilities::SetRecordingsLifetimeValues "SetRecordingsLifetimeValues" | @ref PVRCapabilities::GetRecordingsLifetimeValues "GetRecordingsLifetimeValues"
   ///
   /// @warning This class can not be used outside of @ref kodi::addon::CInstancePVRClient::GetCapabilities()
@@ -376,6 +377,17 @@ public:
   /// @brief To get with @ref SetSupportsRecordingsDelete changed values.
   bool GetSupportsRecordingsDelete() const { return m_capabilities->bSupportsRecordingsDelete; }
 
+  /// @brief Set **true** if this add-on can transfer only the recordings changed
+  /// since a given time, see
+  /// @ref kodi::addon::CInstancePVRClient::GetRecordingsChangedSince().
+  void SetSupportsRecordingsDelta(bool supportsRecordingsDelta)
+  {
+    m_capabilities->bSupportsRecordingsDelta = supportsRecordingsDelta;
+  }
+
+  /// @brief To get with @ref SetSupportsRecordingsDelta changed values.
+  bool GetSupportsRecordingsDelta() const { return m_capabilities->bSupportsRecordingsDelta; }
+
   /// @brief **optional**\n
   /// Set array containing the possible values for @ref PVRRecording::SetLifetime().
   ///
@@ -530,6 +530,17 @@ public:
     m_instance->toKodi->TransferRecordingEntry(m_instance->toKodi->kodiInstance, m_handle, tag);
   }
 
+  /// @brief To tell Kodi a recording was removed from the backend.
+  ///
+  /// Only to be used in @ref kodi::addon::CInstancePVRClient::GetRecordingsChangedSince().
+  ///
+  /// @param[in] recordingId The unique id of the removed recording.
+  void Remove(const std::string& recordingId)
+  {
+    m_instance->toKodi->TransferRecordingRemoved(m_instance->toKodi->kodiInstance, m_handle,
+                                                 recordingId.c_str());
+  }
+
   ///@}
 
 private:
@@ -135,6 +135,10 @@ extern "C"
     //--==----==----==----==----==----==----==----==----==----==----==----==----==
     // New functions becomes added below and can be on another API change (where
     // breaks min API version) moved up.
+
+    void (*TransferRecordingRemoved)(void* kodiInstance,
+                                     const PVR_HANDLE handle,
+                                     const char* strRecordingId);
   } AddonToKodiFuncTable_PVR;
 
   /*!
@@ -327,6 +331,11 @@ extern "C"
     //--==----==----==----==----==----==----==----==----==----==----==----==----==
     // New functions becomes added below and can be on another API change (where
     // breaks min API version) moved up.
+
+    enum PVR_ERROR(__cdecl* GetRecordingsChangedSince)(const struct AddonInstance_PVR*,
+                                                       PVR_HANDLE,
+                                                       bool,
+                                                       time_t);
   } KodiToAddonFuncTable_PVR;
 
   typedef struct AddonInstance_PVR
@@ -291,6 +291,8 @@ extern "C"
 
     unsigned int iRecordingsLifetimesSize;
     struct PVR_ATTRIBUTE_INT_VALUE recordingsLifetimeValues[PVR_ADDON_ATTRIBUTE_VALUES_ARRAY_SIZE];
+
+    bool bSupportsRecordingsDelta;
   } PVR_ADDON_CAPABILITIES;
 
 #ifdef __cplusplus
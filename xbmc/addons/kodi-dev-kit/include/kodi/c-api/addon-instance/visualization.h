@@ -124,6 +124,7 @@ extern "C"
     void (*get_properties)(const KODI_HANDLE hdl, struct KODI_ADDON_VISUALIZATION_PROPS* props);
     void (*transfer_preset)(const KODI_HANDLE hdl, const char* preset);
     void (*clear_presets)(const KODI_HANDLE hdl);
+    size_t (*get_spectrum)(const KODI_HANDLE hdl, float* spectrum, size_t size);
   } AddonToKodiFuncTable_Visualization;
 
   typedef struct AddonInstance_Visualization
@@ -10,6 +10,7 @@
 #include "addons/addoninfo/AddonInfo.h"
 #include "addons/addoninfo/AddonInfoBuilder.h"
 #include "addons/addoninfo/AddonType.h"
+#include "utils/Variant.h"
 #include "utils/XBMCTinyXML.h"
 
 #include <set>
@@ -128,6 +129,48 @@ TEST_F(TestAddonInfoBuilder, TestGenerate_Repo)
   EXPECT_EQ(info->second, "marsian");
 }
 
+TEST_F(TestAddonInfoBuilder, TestGenerate_Manifest)
+{
+  CXBMCTinyXML doc;
+  EXPECT_TRUE(doc.Parse(addonXML));
+  ASSERT_NE(nullptr, doc.RootElement());
+
+  RepositoryDirInfo repo;
+  AddonInfoPtr parsed = CAddonInfoBuilder::Generate(doc.RootElement(), repo);
+  ASSERT_NE(nullptr, parsed);
+
+  CVariant manifest;
+  CAddonInfoBuilder::Serialize(*parsed, manifest);
+  AddonInfoPtr addon = CAddonInfoBuilder::GenerateFromManifest(manifest);
+  ASSERT_NE(nullptr, addon);
+
+  EXPECT_EQ(addon->ID(), "metadata.blablabla.org");
+  EXPECT_EQ(addon->MainType(), AddonType::SCRAPER_MOVIES);
+  EXPECT_EQ(addon->Type(AddonType::SCRAPER_MOVIES)->LibName(), "blablabla.xml");
+  EXPECT_EQ(addon->Type(AddonType::SCRAPER_MOVIES)->GetValue("@language").asString(), "en");
+  EXPECT_EQ(addon->Type(AddonType::SCRIPT_MODULE)->LibName(), "lib.so");
+  EXPECT_EQ(addon->Types().size(), parsed->Types().size());
+
+  EXPECT_EQ(addon->Name(), "The Bla Bla Bla Addon");
+  EXPECT_EQ(addon->Version().asString(), "1.2.3");
+  EXPECT_EQ(addon->Summary(), "Summary bla bla bla");
+  EXPECT_EQ(addon->Description(), "Description bla bla bla");
+  EXPECT_EQ(addon->Disclaimer(), "Disclaimer bla bla bla");
+  EXPECT_EQ(addon->License(), "GPL v2.0");
+  EXPECT_EQ(addon->Source(), "https://github.com/xbmc/xbmc");
+
+  const std::vector<DependencyInfo>& dependencies = addon->GetDependencies();
+  ASSERT_EQ(dependencies.size(), (long unsigned int)4);
+  EXPECT_EQ(dependencies[3].id, "plugin.video.youtube");
+  EXPECT_EQ(dependencies[3].optional, true);
+  EXPECT_EQ(dependencies[3].versionMin.asString(), "4.4.0");
+  EXPECT_EQ(dependencies[3].version.asString(), "4.4.10");
+
+  auto info = addon->ExtraInfo().find("language");
+  ASSERT_NE(info, addon->ExtraInfo().end());
+  EXPECT_EQ(info->second, "marsian");
+}
+
 TEST_F(TestAddonInfoBuilder, TestGenerate_DBEntry)
 {
   CAddonInfoBuilderFromDB builder;
@@ -23,6 +23,11 @@ bool CAppInboundProtocol::OnEvent(XBMC_Event &event)
   return m_pApp.OnEvent(event);
 }
 
+void CAppInboundProtocol::WakeUp()
+{
+  m_pApp.WakeUpRenderLoop();
+}
+
 void CAppInboundProtocol::SetRenderGUI(bool renderGUI)
 {
   auto& components = CServiceBroker::GetAppComponents();
@@ -18,6 +18,7 @@ public:
   CAppInboundProtocol(CApplication &app);
   bool OnEvent(XBMC_Event &event);
   void SetRenderGUI(bool renderGUI);
+  void WakeUp();
 
 protected:
   CApplication &m_pApp;
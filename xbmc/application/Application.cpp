@@ -73,6 +73,7 @@
 #include "guilib/GUIControlProfiler.h"
 #include "guilib/GUIFontManager.h"
 #include "guilib/GUIWindowManager.h"
+#include "guilib/InputLatencyTracker.h"
 #include "guilib/LocalizeStrings.h"
 #include "guilib/StereoscopicsManager.h"
 #include "guilib/TextureManager.h"
@@ -133,6 +134,7 @@
 #include "utils/LangCodeExpander.h"
 #include "utils/PlayerUtils.h"
 #include "utils/RegExp.h"
+#include "utils/SaveFileStateJob.h"
 #include "utils/Screenshot.h"
 #include "utils/StringUtils.h"
 #include "utils/SystemInfo.h"
@@ -173,6 +175,7 @@
 #include "platform/win32/threads/Win32Exception.h"
 #endif
 
+#include <chrono>
 #include <cmath>
 #include <memory>
 #include <mutex>
@@ -246,8 +249,15 @@ CApplication::~CApplication(void)
 
 bool CApplication::OnEvent(XBMC_Event& newEvent)
 {
-  std::unique_lock<CCriticalSection> lock(m_portSection);
-  m_portEvents.push_back(newEvent);
+  if (newEvent.type == XBMC_KEYDOWN || newEvent.type == XBMC_MOUSEBUTTONDOWN ||
+      newEvent.type == XBMC_TOUCH)
+    CInputLatencyTracker::GetInstance().OnInputReceived();
+
+  {
+    std::unique_lock<CCriticalSection> lock(m_portSection);
+    m_portEvents.push_back(newEvent);
+  }
+  WakeUpRenderLoop();
   return true;
 }
 
@@ -635,43 +645,47 @@ bool CApplication::Initialize()
 
   m_ServiceManager->GetNetwork().WaitForNet();
 
-  // initialize (and update as needed) our databases
+  // initialize (and update as needed) our databases and build/update the GUI font cache.
+  // Both only touch their own files and are the longest steps of the startup on slow storage,
+  // so they run side by side.
+  //! @todo Move GUIFontManager into service broker and drop the global reference
   CDatabaseManager &databaseManager = m_ServiceManager->GetDatabaseManager();
+  GUIFontManager& guiFontManager = g_fontManager;
 
-  CEvent event(true);
-  CServiceBroker::GetJobManager()->Submit([&databaseManager, &event]() {
+  CEvent databaseEvent(true);
+  CEvent fontEvent(true);
+  const auto initStart = std::chrono::steady_clock::now();
+  CServiceBroker::GetJobManager()->Submit([&databaseManager, &databaseEvent, initStart]() {
     databaseManager.Initialize();
-    event.Set();
+    CLog::Log(LOGDEBUG, "CApplication::Initialize - databases ready after {:.2f} ms",
+              std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                        initStart)
+                  .count());
+    databaseEvent.Set();
+  });
+  CServiceBroker::GetJobManager()->Submit([&guiFontManager, &fontEvent, initStart]() {
+    guiFontManager.Initialize();
+    CLog::Log(LOGDEBUG, "CApplication::Initialize - font cache ready after {:.2f} ms",
+              std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                        initStart)
+                  .count());
+    fontEvent.Set();
   });
 
-  std::string localizedStr = g_localizeStrings.Get(24150);
+  const std::string upgradingStr = g_localizeStrings.Get(24150);
+  const std::string fontsStr = g_localizeStrings.Get(39175);
   int iDots = 1;
-  while (!event.Wait(1000ms))
+  while (!databaseEvent.Signaled() || !fontEvent.Signaled())
   {
-    if (databaseManager.IsUpgrading())
-      CServiceBroker::GetRenderSystem()->ShowSplash(std::string(iDots, ' ') + localizedStr + std::string(iDots, '.'));
-
-    if (iDots == 3)
-      iDots = 1;
-    else
-      ++iDots;
-  }
-  CServiceBroker::GetRenderSystem()->ShowSplash("");
+    CEvent& pending = databaseEvent.Signaled() ? fontEvent : databaseEvent;
+    if (pending.Wait(1000ms))
+      continue;
 
-  // Initialize GUI font manager to build/update fonts cache
-  //! @todo Move GUIFontManager into service broker and drop the global reference
-  event.Reset();
-  GUIFontManager& guiFontManager = g_fontManager;
-  CServiceBroker::GetJobManager()->Submit([&guiFontManager, &event]() {
-    guiFontManager.Initialize();
-    event.Set();
-  });
-  localizedStr = g_localizeStrings.Get(39175);
-  iDots = 1;
-  while (!event.Wait(1000ms))
-  {
-    if (g_fontManager.IsUpdating())
-      CServiceBroker::GetRenderSystem()->ShowSplash(std::string(iDots, ' ') + localizedStr +
+    if (databaseManager.IsUpgrading())
+      CServiceBroker::GetRenderSystem()->ShowSplash(std::string(iDots, ' ') + upgradingStr +
+                                                    std::string(iDots, '.'));
+    else if (g_fontManager.IsUpdating())
+      CServiceBroker::GetRenderSystem()->ShowSplash(std::string(iDots, ' ') + fontsStr +
                                                     std::string(iDots, '.'));
 
     if (iDots == 3)
@@ -681,6 +695,8 @@ bool CApplication::Initialize()
   }
   CServiceBroker::GetRenderSystem()->ShowSplash("");
 
+  CSaveFileState::ReplayJournal();
+
   // GUI depends on seek handler
   GetComponent<CApplicationPlayer>()->GetSeekHandler().Configure();
 
@@ -923,6 +939,10 @@ void CApplication::Render()
                                                        appPlayer->IsRenderingVideoLayer());
 
   CTimeUtils::UpdateFrameTime(hasRendered);
+  CInputLatencyTracker::GetInstance().OnFramePresented(hasRendered);
+
+  m_frameRendered = hasRendered;
+  m_idleFrames = hasRendered ? 0 : m_idleFrames + 1;
 }
 
 bool CApplication::OnAction(const CAction &action)
@@ -1892,6 +1912,52 @@ void CApplication::FrameMove(bool processEvents, bool processGUI)
 }
 
 
+void CApplication::WakeUpRenderLoop()
+{
+  m_renderLoopEvent.Set();
+}
+
+void CApplication::WaitWhileIdle(std::chrono::steady_clock::time_point frameStart)
+{
+  // frames without anything to render before the render loop may block
+  constexpr unsigned int IDLE_FRAMES = 5;
+
+  const unsigned int refreshRate =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiIdleRefreshRate;
+
+  // Input events reach the application port from other threads on some window systems only,
+  // the others deliver them from their message pump and keep the frame rate of the render
+  // system while nothing is rendered.
+  if (!m_bStop && refreshRate > 0 && m_idleFrames >= IDLE_FRAMES && !m_WaitingExternalCalls &&
+      CServiceBroker::GetWinSystem()->CanWaitForEvents() &&
+      !GetComponent<CApplicationPlayer>()->IsPlaying())
+  {
+    const auto wakeUp = frameStart + std::chrono::milliseconds(1000 / refreshRate);
+    const auto now = std::chrono::steady_clock::now();
+    if (wakeUp > now)
+    {
+      // let external calls (e.g. python) in while waiting
+      CSingleExit ex(CServiceBroker::GetWinSystem()->GetGfxContext());
+      m_frameMoveGuard.unlock();
+      m_renderLoopEvent.Wait(std::chrono::duration_cast<std::chrono::milliseconds>(wakeUp - now));
+      m_frameMoveGuard.lock();
+    }
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  if (!m_frameRendered)
+    m_idleTime += now - frameStart;
+
+  const auto elapsed = now - m_idleStatsStart;
+  if (elapsed >= std::chrono::seconds(1))
+  {
+    m_idlePercent = 100.0f * std::chrono::duration<float>(m_idleTime).count() /
+                    std::chrono::duration<float>(elapsed).count();
+    m_idleTime = {};
+    m_idleStatsStart = now;
+  }
+}
+
 void CApplication::ResetCurrentItem()
 {
   m_itemCurrentFile->Reset();
@@ -1932,6 +1998,7 @@ int CApplication::Run()
     if (renderGUI && !m_bStop)
     {
       Render();
+      WaitWhileIdle(lastFrameTime);
     }
     else if (!renderGUI)
     {
@@ -2079,6 +2146,9 @@ bool CApplication::Stop(int exitCode)
   const auto appPlayer = GetComponent<CApplicationPlayer>();
   appPlayer->ClosePlayer();
 
+  // save the state of the file just closed before the jobs are cancelled
+  CSaveFileState::Flush();
+
   {
     // close inbound port
     CServiceBroker::UnregisterAppPort();
@@ -196,6 +196,17 @@ public:
   */
   void UnlockFrameMoveGuard();
 
+  /*!
+  \brief Wakes up the render loop while it waits for the idle GUI to change. Called when input
+  events or messages arrive from other threads.
+  */
+  void WakeUpRenderLoop();
+
+  /*!
+  \brief Share of the last second in percent during which the GUI had nothing to render.
+  */
+  float GetIdlePercent() const { return m_idlePercent; }
+
 protected:
   bool OnSettingsSaving() const override;
   void PlaybackCleanup();
@@ -243,6 +254,7 @@ public:
 private:
   void PrintStartupLog();
   void ResetCurrentItem();
+  void WaitWhileIdle(std::chrono::steady_clock::time_point frameStart);
 
   mutable CCriticalSection m_critSection; /*!< critical section for all changes to this class, except for changes to triggers */
 
@@ -253,6 +265,13 @@ private:
   int m_ExitCode{EXITCODE_QUIT};
   std::shared_ptr<CFileItem> m_itemCurrentFile; //!< Currently playing file
   CEvent m_playerEvent;
+
+  CEvent m_renderLoopEvent; /*!< wakes up the render loop while the GUI is idle */
+  bool m_frameRendered = true; /*!< whether the last frame rendered anything */
+  unsigned int m_idleFrames = 0; /*!< number of consecutive frames that rendered nothing */
+  std::chrono::steady_clock::time_point m_idleStatsStart;
+  std::chrono::steady_clock::duration m_idleTime{};
+  std::atomic<float> m_idlePercent{0.0f};
 };
 
 XBMC_GLOBAL_REF(CApplication,g_application);
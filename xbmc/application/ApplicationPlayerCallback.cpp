@@ -161,7 +161,7 @@ void CApplicationPlayerCallback::OnPlayerCloseFile(const CFileItem& file,
           ->GetCurrentProfile()
           .canWriteDatabases())
   {
-    CSaveFileState::DoWork(fileItem, resumeBookmark, playCountUpdate);
+    CSaveFileState::Queue(fileItem, resumeBookmark, playCountUpdate);
   }
 }
 
@@ -126,6 +126,9 @@ bool CApplicationSkinHandling::LoadSkin(const std::string& skinID)
             skin->Version().asString());
   g_SkinInfo = skin;
 
+  // parse the windows shown first while the includes and fonts are loaded
+  CServiceBroker::GetGUI()->GetWindowManager().PreloadSkinWindows();
+
   CLog::Log(LOGINFO, "  load fonts for skin...");
   CServiceBroker::GetWinSystem()->GetGfxContext().SetMediaDir(skin->Path());
   g_directoryCache.ClearSubPaths(skin->Path());
@@ -37,7 +37,15 @@ CAEEncoderFFmpeg::~CAEEncoderFFmpeg()
 {
   Reset();
   swr_free(&m_SwrCtx);
-  av_channel_layout_uninit(&m_CodecCtx->ch_layout);
+  if (m_ConvertedData)
+    av_freep(&m_ConvertedData[0]);
+  av_freep(&m_ConvertedData);
+  if (m_Frame)
+    av_channel_layout_uninit(&m_Frame->ch_layout);
+  av_frame_free(&m_Frame);
+  av_packet_free(&m_Packet);
+  if (m_CodecCtx)
+    av_channel_layout_uninit(&m_CodecCtx->ch_layout);
   avcodec_free_context(&m_CodecCtx);
 }
 
@@ -218,22 +226,47 @@ bool CAEEncoderFFmpeg::Initialize(AEAudioFormat &format, bool allow_planar_input
 
   m_CurrentFormat = format;
   m_NeededFrames = format.m_frames;
+  m_OutputSize = static_cast<int>(static_cast<uint64_t>(m_BitRate) * m_NeededFrames /
+                                  (8 * m_CodecCtx->sample_rate));
   m_OutputRatio   = (double)m_NeededFrames / m_OutputSize;
   m_SampleRateMul = 1.0 / (double)m_CodecCtx->sample_rate;
 
+  /* the frame and packet are reused for every encoded frame */
+  m_Frame = av_frame_alloc();
+  m_Packet = av_packet_alloc();
+  if (!m_Frame || !m_Packet)
+  {
+    CLog::Log(LOGERROR, "CAEEncoderFFmpeg::Initialize - Failed to allocate frame or packet.");
+    av_frame_free(&m_Frame);
+    av_packet_free(&m_Packet);
+    av_channel_layout_uninit(&m_CodecCtx->ch_layout);
+    avcodec_free_context(&m_CodecCtx);
+    return false;
+  }
+  m_Frame->nb_samples = m_CodecCtx->frame_size;
+  m_Frame->format = m_CodecCtx->sample_fmt;
+  av_channel_layout_copy(&m_Frame->ch_layout, &m_CodecCtx->ch_layout);
+
   if (m_NeedConversion)
   {
     int ret = swr_alloc_set_opts2(&m_SwrCtx, &m_CodecCtx->ch_layout, m_CodecCtx->sample_fmt,
                                   m_CodecCtx->sample_rate, &m_CodecCtx->ch_layout,
                                   AV_SAMPLE_FMT_FLT, m_CodecCtx->sample_rate, 0, NULL);
-    if (ret || swr_init(m_SwrCtx) < 0)
+    if (ret || swr_init(m_SwrCtx) < 0 ||
+        av_samples_alloc_array_and_samples(&m_ConvertedData, nullptr, channels,
+                                           m_CodecCtx->frame_size, m_CodecCtx->sample_fmt, 0) < 0)
     {
       CLog::Log(LOGERROR, "CAEEncoderFFmpeg::Initialize - Failed to initialise resampler.");
       swr_free(&m_SwrCtx);
+      av_channel_layout_uninit(&m_Frame->ch_layout);
+      av_frame_free(&m_Frame);
+      av_packet_free(&m_Packet);
       av_channel_layout_uninit(&m_CodecCtx->ch_layout);
       avcodec_free_context(&m_CodecCtx);
       return false;
     }
+    m_ConvertedSize = av_samples_get_buffer_size(nullptr, channels, m_CodecCtx->frame_size,
+                                                 m_CodecCtx->sample_fmt, 0);
   }
   CLog::Log(LOGINFO, "CAEEncoderFFmpeg::Initialize - {} encoder ready", m_CodecName);
   return true;
@@ -263,40 +296,37 @@ int CAEEncoderFFmpeg::Encode(uint8_t *in, int in_size, uint8_t *out, int out_siz
 {
   int size = 0;
   int err = AVERROR_UNKNOWN;
-  AVFrame* frame = nullptr;
-  AVPacket* pkt = nullptr;
 
-  if (!m_CodecCtx)
+  if (!m_CodecCtx || !m_Frame || !m_Packet)
     return size;
 
   try
   {
-    /* allocate the input frame and output packet
-     * sadly, we have to alloc/dealloc it everytime since we have no guarantee the
-     * data argument will be constant over iterated calls and the frame needs to
-     * setup pointers inside data */
-    frame = av_frame_alloc();
-    pkt = av_packet_alloc();
-    if (!frame || !pkt)
-      throw FFMpegException(
-          "Failed to allocate \"AVFrame\" or \"AVPacket\" for encoding (error '{}')",
-          strerror(errno));
-
-    frame->nb_samples = m_CodecCtx->frame_size;
-    frame->format = m_CodecCtx->sample_fmt;
-    av_channel_layout_uninit(&frame->ch_layout);
-    av_channel_layout_copy(&frame->ch_layout, &m_CodecCtx->ch_layout);
-    int channelNum = m_CodecCtx->ch_layout.nb_channels;
+    /* the input is interleaved float if the encoder doesn't take any format the engine provides */
+    if (m_NeedConversion)
+    {
+      const uint8_t* input[] = {in};
+      err = swr_convert(m_SwrCtx, m_ConvertedData, m_CodecCtx->frame_size, input,
+                        m_CodecCtx->frame_size);
+      if (err < 0)
+        throw FFMpegException("Error converting a frame for encoding (error '{}')",
+                              FFMpegErrorToString(err));
+
+      in = m_ConvertedData[0];
+      in_size = m_ConvertedSize;
+    }
 
-    avcodec_fill_audio_frame(frame, channelNum, m_CodecCtx->sample_fmt, in, in_size, 0);
+    /* the frame only points into the input, which may be a different buffer on every call */
+    int channelNum = m_CodecCtx->ch_layout.nb_channels;
+    avcodec_fill_audio_frame(m_Frame, channelNum, m_CodecCtx->sample_fmt, in, in_size, 0);
 
     /* encode it */
-    err = avcodec_send_frame(m_CodecCtx, frame);
+    err = avcodec_send_frame(m_CodecCtx, m_Frame);
     if (err < 0)
       throw FFMpegException("Error sending a frame for encoding (error '{}')",
                             FFMpegErrorToString(err));
 
-    err = avcodec_receive_packet(m_CodecCtx, pkt);
+    err = avcodec_receive_packet(m_CodecCtx, m_Packet);
     //! @TODO: This is a workaround for our current design. The caller should be made
     // aware of the potential error values to use the ffmpeg API in a proper way, which means
     // copying with EAGAIN and multiple packet output.
@@ -304,18 +334,18 @@ int CAEEncoderFFmpeg::Encode(uint8_t *in, int in_size, uint8_t *out, int out_siz
     // 1 frame in - 1 packet out. This holds true in practice but the API does not guarantee it.
     if (err >= 0)
     {
-      if (pkt->size <= out_size)
+      if (m_Packet->size <= out_size)
       {
         memset(out, 0, out_size);
-        memcpy(out, pkt->data, pkt->size);
-        size = pkt->size;
+        memcpy(out, m_Packet->data, m_Packet->size);
+        size = m_Packet->size;
       }
       else
       {
-        CLog::LogF(LOGERROR, "Encoded pkt size ({}) is bigger than buffer ({})", pkt->size,
+        CLog::LogF(LOGERROR, "Encoded pkt size ({}) is bigger than buffer ({})", m_Packet->size,
                    out_size);
       }
-      av_packet_unref(pkt);
+      av_packet_unref(m_Packet);
     }
     else
     {
@@ -327,14 +357,6 @@ int CAEEncoderFFmpeg::Encode(uint8_t *in, int in_size, uint8_t *out, int out_siz
     CLog::Log(LOGERROR, "CAEEncoderFFmpeg::{} - {}", __func__, caught.what());
   }
 
-  av_channel_layout_uninit(&frame->ch_layout);
-
-  /* free temporary data */
-  av_frame_free(&frame);
-
-  /* free the packet */
-  av_packet_free(&pkt);
-
   /* return the number of frames used */
   return size;
 }
@@ -353,7 +375,8 @@ double CAEEncoderFFmpeg::GetDelay(unsigned int bufferSize)
   if (!m_CodecCtx)
     return 0;
 
-  int frames = m_CodecCtx->delay;
+  /* the decoder drops the padding the encoder put in front of the audio */
+  int frames = m_CodecCtx->initial_padding;
   if (m_BufferSize)
     frames += m_NeededFrames;
 
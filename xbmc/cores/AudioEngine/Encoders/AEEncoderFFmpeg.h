@@ -43,6 +43,10 @@ private:
   AEAudioFormat m_CurrentFormat;
   AVCodecContext *m_CodecCtx;
   SwrContext *m_SwrCtx;
+  AVFrame* m_Frame = nullptr; ///< reused for every encoded frame
+  AVPacket* m_Packet = nullptr;
+  uint8_t** m_ConvertedData = nullptr; ///< input converted to the encoder's format
+  int m_ConvertedSize = 0;
   CAEChannelInfo m_Layout;
   uint8_t m_Buffer[8 + AV_INPUT_BUFFER_MIN_SIZE];
   int m_BufferSize = 0;
@@ -20,11 +20,15 @@
 #include "cores/AudioEngine/Utils/AEUtil.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
+#include "utils/MemUtils.h"
 #include "utils/log.h"
 #include "windowing/WinSystem.h"
 
 #include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 using namespace AE;
 using namespace ActiveAE;
@@ -36,6 +40,72 @@ namespace
 constexpr float MAX_CACHE_LEVEL = 0.4f; // total cache time of stream in seconds;
 constexpr float MAX_WATER_LEVEL = 0.2f; // buffered time after stream stages in seconds;
 constexpr double MAX_BUFFER_TIME = 0.1; // max time of a buffer in seconds;
+
+/*!
+ * \brief Keeps the sample memory of destroyed buffer pools for the next pools.
+ *
+ * Format switches and stream opens tear down and rebuild all pools, mostly with the same sizes
+ * as before. Blocks are cache line aligned and kept per rounded size up to a total limit.
+ */
+class CSampleArena
+{
+public:
+  static CSampleArena& Get()
+  {
+    static CSampleArena arena;
+    return arena;
+  }
+
+  ~CSampleArena()
+  {
+    for (auto& bucket : m_free)
+      for (uint8_t* block : bucket.second)
+        KODI::MEMORY::AlignedFree(block);
+  }
+
+  uint8_t* Alloc(size_t size)
+  {
+    size = RoundUp(size);
+    {
+      std::unique_lock<CCriticalSection> lock(m_section);
+      auto it = m_free.find(size);
+      if (it != m_free.end() && !it->second.empty())
+      {
+        uint8_t* block = it->second.back();
+        it->second.pop_back();
+        m_cached -= size;
+        return block;
+      }
+    }
+    return static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(size, ALIGNMENT));
+  }
+
+  void Free(uint8_t* block, size_t size)
+  {
+    size = RoundUp(size);
+    {
+      std::unique_lock<CCriticalSection> lock(m_section);
+      if (m_cached + size <= MAX_CACHED)
+      {
+        m_free[size].push_back(block);
+        m_cached += size;
+        return;
+      }
+    }
+    KODI::MEMORY::AlignedFree(block);
+  }
+
+private:
+  static constexpr size_t ALIGNMENT = 64;
+  static constexpr size_t GRANULARITY = 4096;
+  static constexpr size_t MAX_CACHED = 32 * 1024 * 1024;
+
+  static size_t RoundUp(size_t size) { return (size + GRANULARITY - 1) / GRANULARITY * GRANULARITY; }
+
+  CCriticalSection m_section;
+  std::unordered_map<size_t, std::vector<uint8_t*>> m_free;
+  size_t m_cached = 0;
+};
 } // unnamed namespace
 
 void CEngineStats::Reset(unsigned int sampleRate, bool pcm)
@@ -146,7 +216,7 @@ void CEngineStats::GetDelay(AEDelayStatus& status, CActiveAEStream *stream)
 {
   std::unique_lock<CCriticalSection> lock(m_lock);
   status = m_sinkDelay;
-  status.delay += static_cast<double>(m_sinkLatency);
+  status.delay += static_cast<double>(m_sinkLatency + m_encoderLatency);
   if (m_pcmOutput)
     status.delay += (double)m_bufferedSamples / m_sinkSampleRate;
   else
@@ -177,7 +247,7 @@ void CEngineStats::GetSyncInfo(CAESyncInfo& info, CActiveAEStream *stream)
     status.delay +=
         static_cast<double>(m_bufferedSamples) * m_sinkFormat.m_streamInfo.GetDuration() / 1000;
 
-  status.delay += static_cast<double>(m_sinkLatency);
+  status.delay += static_cast<double>(m_sinkLatency + m_encoderLatency);
 
   for (auto &str : m_streamStats)
   {
@@ -1175,6 +1245,8 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
   AEAudioFormat sinkInputFormat, inputFormat;
   AEAudioFormat oldInternalFormat = m_internalFormat;
   AEAudioFormat oldSinkRequestFormat = m_sinkRequestFormat;
+  const bool wasPCMBypass = m_pcmBypass;
+  m_pcmBypass = false;
 
   inputFormat = GetInputFormat(desiredFmt);
 
@@ -1241,6 +1313,7 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
 
     delete m_encoder;
     m_encoder = NULL;
+    m_stats.SetEncoderLatency(0);
 
     if (m_encoderBuffers)
     {
@@ -1260,6 +1333,7 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
   {
     bool streaming = true;
     m_sink.m_controlPort.SendOutMessage(CSinkControlProtocol::STREAMING, &streaming, sizeof(bool));
+    m_stats.SetEncoderLatency(0);
 
     AEAudioFormat outputFormat;
     if (m_mode == MODE_RAW)
@@ -1285,6 +1359,8 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
       else
         outputFormat = m_encoderFormat;
 
+      m_stats.SetEncoderLatency(static_cast<float>(m_encoder->GetDelay(0)));
+
       outputFormat.m_channelLayout = m_encoderFormat.m_channelLayout;
       outputFormat.m_frames = m_encoderFormat.m_frames;
 
@@ -1335,11 +1411,22 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
       uint64_t avlayout = CAEUtil::GetAVChannelLayout(outputFormat.m_channelLayout);
       outputFormat.m_channelLayout = CAEUtil::GetAEChannelLayout(avlayout);
 
+      // a single stream that already is in sink format does not need to go through float.
+      // the bypass is only entered while the stream has no converted samples queued
+      if (IsPCMBypassPossible() &&
+          (wasPCMBypass || initSink || !m_streams.front()->m_processingBuffers))
+      {
+        CLog::Log(LOGDEBUG, "ActiveAE::{} - bypassing conversion for pcm stream", __FUNCTION__);
+        outputFormat = m_sinkFormat;
+        m_pcmBypass = true;
+      }
+
       //! @todo adjust to decoder
       sinkInputFormat = outputFormat;
     }
     m_internalFormat = outputFormat;
 
+    std::deque<CSampleBuffer*> bypassSamples;
     std::list<CActiveAEStream*>::iterator it;
     for(it=m_streams.begin(); it!=m_streams.end(); ++it)
     {
@@ -1356,6 +1443,16 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
         // if input format does not follow ffmpeg channel mask, we may need to remap channels
         (*it)->InitRemapper();
       }
+      if (wasPCMBypass && !initSink && (*it)->m_processingBuffers &&
+          !CompareFormat((*it)->m_processingBuffers->m_outputFormat, outputFormat))
+      {
+        // leaving the bypass: nothing queued has been converted yet, feed it to the new buffers
+        CLog::Log(LOGDEBUG, "ActiveAE::{} - leaving pcm bypass", __FUNCTION__);
+        (*it)->m_processingBuffers->TakeSamples(bypassSamples);
+        m_discardBufferPools.push_back((*it)->m_processingBuffers->GetResampleBuffers());
+        m_discardBufferPools.push_back((*it)->m_processingBuffers->GetAtempoBuffers());
+        (*it)->m_processingBuffers.reset();
+      }
       if (initSink && (*it)->m_processingBuffers)
       {
         (*it)->m_processingBuffers->Flush();
@@ -1370,6 +1467,11 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
         (*it)->m_processingBuffers->ForceResampler((*it)->m_forceResampler);
 
         (*it)->m_processingBuffers->Create(MAX_CACHE_LEVEL*1000, false, m_settings.stereoupmix, m_settings.normalizelevels);
+
+        (*it)->m_processingBuffers->m_inputSamples.insert(
+            (*it)->m_processingBuffers->m_inputSamples.end(), bypassSamples.begin(),
+            bypassSamples.end());
+        bypassSamples.clear();
       }
       if (m_mode == MODE_TRANSCODE || m_streams.size() > 1)
         (*it)->m_processingBuffers->FillBuffer();
@@ -2003,6 +2105,10 @@ bool CActiveAE::RunStages()
     // mix streams and sounds sounds
     if (m_mode != MODE_RAW)
     {
+      // gui sounds, volume, fading or another stream need the full pipeline
+      if (m_pcmBypass && !IsPCMBypassPossible())
+        Configure();
+
       CSampleBuffer *out = NULL;
       if (!m_sounds_playing.empty() && m_streams.empty())
       {
@@ -2056,6 +2162,13 @@ bool CActiveAE::RunStages()
             out = (*it)->m_processingBuffers->m_outputSamples.front();
             (*it)->m_processingBuffers->m_outputSamples.pop_front();
 
+            // samples are in sink format and at unity gain
+            if (m_pcmBypass)
+            {
+              busy = true;
+              continue;
+            }
+
             int nb_floats = out->pkt->nb_samples * out->pkt->config.channels / out->pkt->planes;
             int nb_loops = 1;
             float fadingStep = 0.0f;
@@ -2114,17 +2227,7 @@ bool CActiveAE::RunStages()
                 volume *= (*it)->m_limiter.Run((float**)out->pkt->data, out->pkt->config.channels, i*nb_floats, out->pkt->planes > 1);
 
               for(int j=0; j<out->pkt->planes; j++)
-              {
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
-#else
-                float* fbuffer = (float*) out->pkt->data[j]+i*nb_floats;
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  fbuffer[k] *= volume;
-                }
-#endif
-              }
+                CAEUtil::MulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
             }
           }
           else
@@ -2184,24 +2287,8 @@ bool CActiveAE::RunStages()
               {
                 float *dst = (float*)out->pkt->data[j]+i*nb_floats;
                 float *src = (float*)mix->pkt->data[j]+i*nb_floats;
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulAddArray(dst, src, volume, nb_floats);
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  if (fabs(dst[k]) > 1.0f)
-                  {
-                    needClamp = true;
-                    break;
-                  }
-                }
-#else
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  dst[k] += src[k] * volume;
-                  if (fabs(dst[k]) > 1.0f)
-                    needClamp = true;
-                }
-#endif
+                if (CAEUtil::MulAddArray(dst, src, volume, nb_floats))
+                  needClamp = true;
               }
             }
             mix->Return();
@@ -2592,12 +2679,7 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
       out = (float*)dstSample.data[j];
       sample_buffer = (float*)(it->sound->GetSound(false)->data[j]+start);
       int nb_floats = mix_samples * dstSample.config.channels / dstSample.planes;
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulAddArray(out, sample_buffer, volume, nb_floats);
-#else
-      for (int k = 0; k < nb_floats; ++k)
-        *out++ += *sample_buffer++ * volume;
-#endif
+      CAEUtil::MulAddArray(out, sample_buffer, volume, nb_floats);
     }
 
     it->samples_played += mix_samples;
@@ -2622,13 +2704,7 @@ void CActiveAE::Deamplify(CSoundPacket &dstSample)
     for(int j=0; j<dstSample.planes; j++)
     {
       float* buffer = reinterpret_cast<float*>(dstSample.data[j]);
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulArray(buffer, volume, nb_floats);
-#else
-      float *fbuffer = buffer;
-      for (int i = 0; i < nb_floats; i++)
-        *fbuffer++ *= volume;
-#endif
+      CAEUtil::MulArray(buffer, volume, nb_floats);
     }
   }
 }
@@ -3026,16 +3102,22 @@ uint8_t **CActiveAE::AllocSoundSample(SampleConfig &config, int &samples, int &b
   planes = av_sample_fmt_is_planar(config.fmt) ? config.channels : 1;
   buffer = new uint8_t*[planes];
 
-  // align buffer to 16 in order to be compatible with sse in CAEConvert
-  av_samples_alloc(buffer, &linesize, config.channels,
-                                 samples, config.fmt, 16);
+  // align planes to 16 in order to be compatible with sse in CAEConvert, the block itself
+  // comes cache line aligned from the arena
+  const int size =
+      av_samples_get_buffer_size(&linesize, config.channels, samples, config.fmt, 16);
+  uint8_t* block = size > 0 ? CSampleArena::Get().Alloc(size) : nullptr;
+  av_samples_fill_arrays(buffer, &linesize, block, config.channels, samples, config.fmt, 16);
+  if (block)
+    av_samples_set_silence(buffer, 0, samples, config.channels, config.fmt);
   bytes_per_sample = av_get_bytes_per_sample(config.fmt);
   return buffer;
 }
 
-void CActiveAE::FreeSoundSample(uint8_t **data)
+void CActiveAE::FreeSoundSample(uint8_t** data, int planes, int linesize)
 {
-  av_freep(data);
+  if (data[0])
+    CSampleArena::Get().Free(data[0], static_cast<size_t>(planes) * linesize);
   delete [] data;
 }
 
@@ -3052,6 +3134,31 @@ bool CActiveAE::CompareFormat(const AEAudioFormat& lhs, const AEAudioFormat& rhs
     return true;
 }
 
+bool CActiveAE::IsPCMBypassPossible() const
+{
+  if (m_mode != MODE_PCM || m_streams.size() != 1 || !m_sounds_playing.empty() ||
+      !m_audioCallback.empty())
+    return false;
+
+  // volume is applied to the samples unless the sink does it
+  if (m_muted || (!m_sinkHasVolume && m_volumeScaled < 1.0f))
+    return false;
+
+  const CActiveAEStream* stream = m_streams.front();
+  if (stream->m_pClock || stream->m_forceResampler || stream->m_amplify != 1.0f ||
+      stream->m_volume != 1.0f || stream->m_rgain != 1.0f || stream->m_fadingSamples != 0)
+    return false;
+
+  // the layout must be in ffmpeg order, otherwise the stream remaps its samples
+  const AEAudioFormat& format = stream->m_format;
+  const uint64_t avLayout = CAEUtil::GetAVChannelLayout(format.m_channelLayout);
+  return format.m_dataFormat != AE_FMT_RAW && format.m_dataFormat == m_sinkFormat.m_dataFormat &&
+         format.m_sampleRate == m_sinkFormat.m_sampleRate &&
+         format.m_channelLayout == m_sinkFormat.m_channelLayout &&
+         format.m_channelLayout == CAEUtil::GetAEChannelLayout(avLayout) &&
+         m_sinkFormat.m_channelLayout.Count() == m_sinkRequestFormat.m_channelLayout.Count();
+}
+
 //-----------------------------------------------------------------------------
 // GUI Sounds
 //-----------------------------------------------------------------------------
@@ -199,12 +199,14 @@ public:
   void SetCurrentSinkFormat(const AEAudioFormat& SinkFormat);
   void SetSinkCacheTotal(float time) { m_sinkCacheTotal = time; }
   void SetSinkLatency(float time) { m_sinkLatency = time; }
+  void SetEncoderLatency(float time) { m_encoderLatency = time; }
   void SetSinkNeedIec(bool needIEC) { m_sinkNeedIecPack = needIEC; }
   bool IsSuspended();
   AEAudioFormat GetCurrentSinkFormat();
 protected:
   float m_sinkCacheTotal;
   float m_sinkLatency;
+  float m_encoderLatency = 0; ///< delay added by transcoding, until the encoded audio is decoded
   int m_bufferedSamples;
   unsigned int m_sinkSampleRate;
   AEDelayStatus m_sinkDelay;
@@ -283,7 +285,7 @@ private:
 protected:
   void PlaySound(CActiveAESound *sound);
   static uint8_t **AllocSoundSample(SampleConfig &config, int &samples, int &bytes_per_sample, int &planes, int &linesize);
-  static void FreeSoundSample(uint8_t **data);
+  static void FreeSoundSample(uint8_t** data, int planes, int linesize);
   void GetDelay(AEDelayStatus& status, CActiveAEStream *stream) { m_stats.GetDelay(status, stream); }
   void GetSyncInfo(CAESyncInfo& info, CActiveAEStream *stream) { m_stats.GetSyncInfo(info, stream); }
   float GetCacheTime(CActiveAEStream *stream) { return m_stats.GetCacheTime(stream); }
@@ -335,6 +337,7 @@ protected:
   void Deamplify(CSoundPacket &dstSample);
 
   bool CompareFormat(const AEAudioFormat& lhs, const AEAudioFormat& rhs);
+  bool IsPCMBypassPossible() const;
 
   CEvent m_inMsgEvent;
   CEvent m_outMsgEvent;
@@ -358,6 +361,7 @@ protected:
     MODE_TRANSCODE,
     MODE_PCM
   }m_mode;
+  bool m_pcmBypass = false; ///< a single stream in sink format is passed to the sink unconverted
 
   CActiveAESink m_sink;
   AEAudioFormat m_sinkFormat;
@@ -28,7 +28,7 @@ CSoundPacket::CSoundPacket(const SampleConfig& conf, int samples) : config(conf)
 CSoundPacket::~CSoundPacket()
 {
   if (data)
-    CActiveAE::FreeSoundSample(data);
+    CActiveAE::FreeSoundSample(data, planes, linesize);
 }
 
 CSampleBuffer* CSampleBuffer::Acquire()
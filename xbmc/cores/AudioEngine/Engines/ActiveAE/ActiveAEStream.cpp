@@ -583,6 +583,7 @@ CActiveAEStreamBuffers::CActiveAEStreamBuffers(const AEAudioFormat& inputFormat,
                                                const AEAudioFormat& outputFormat,
                                                AEQuality quality)
   : m_inputFormat(inputFormat),
+    m_outputFormat(outputFormat),
     m_resampleBuffers(
         std::make_unique<CActiveAEBufferPoolResample>(inputFormat, outputFormat, quality)),
     m_atempoBuffers(std::make_unique<CActiveAEBufferPoolAtempo>(outputFormat))
@@ -762,6 +763,17 @@ std::unique_ptr<CActiveAEBufferPool> CActiveAEStreamBuffers::GetAtempoBuffers()
   return std::move(m_atempoBuffers);
 }
 
+void CActiveAEStreamBuffers::TakeSamples(std::deque<CSampleBuffer*>& samples)
+{
+  for (std::deque<CSampleBuffer*>* queue :
+       {&m_outputSamples, &m_atempoBuffers->m_outputSamples, &m_atempoBuffers->m_inputSamples,
+        &m_resampleBuffers->m_outputSamples, &m_resampleBuffers->m_inputSamples, &m_inputSamples})
+  {
+    samples.insert(samples.end(), queue->begin(), queue->end());
+    queue->clear();
+  }
+}
+
 bool CActiveAEStreamBuffers::HasWork()
 {
   if (!m_inputSamples.empty())
@@ -113,8 +113,14 @@ public:
   bool HasWork();
   std::unique_ptr<CActiveAEBufferPool> GetResampleBuffers();
   std::unique_ptr<CActiveAEBufferPool> GetAtempoBuffers();
+  /*!
+   \brief Move all queued samples out, oldest first. Only meaningful while neither resampler
+   nor tempo filter are active, i.e. all samples are still in the input format.
+   */
+  void TakeSamples(std::deque<CSampleBuffer*>& samples);
 
   AEAudioFormat m_inputFormat;
+  AEAudioFormat m_outputFormat;
   std::deque<CSampleBuffer*> m_outputSamples;
   std::deque<CSampleBuffer*> m_inputSamples;
 
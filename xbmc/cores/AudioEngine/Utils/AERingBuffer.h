@@ -18,11 +18,14 @@
 #include "utils/log.h"
 #include "utils/MemUtils.h"
 
+#include <atomic>
 #include <string.h>
 
 /**
  * This buffer can be used by one read and one write thread at any one time
- * without the risk of data corruption.
+ * without the risk of data corruption. Neither side ever blocks: the read and write
+ * counters are atomics, the reader only moves the read position and the writer only
+ * moves the write position, so it is safe to read from a realtime audio callback.
  * If you intend to call the Reset() method, please use Locks.
  * All other operations are thread-safe.
  */
@@ -72,8 +75,8 @@ public:
 #ifdef AE_RING_BUFFER_DEBUG
     CLog::Log(LOGDEBUG, "AERingBuffer::Reset: Buffer reset.");
 #endif
-    m_iWritten = 0;
-    m_iRead = 0;
+    m_iWritten.store(0, std::memory_order_relaxed);
+    m_iRead.store(0, std::memory_order_relaxed);
     m_iReadPos = 0;
     m_iWritePos = 0;
   }
@@ -216,7 +219,9 @@ public:
    */
   unsigned int GetWriteSize()
   {
-    return m_iSize - ( m_iWritten - m_iRead );
+    // acquire pairs with ReadFinished(), the reader is done with the bytes it released
+    return m_iSize - (m_iWritten.load(std::memory_order_relaxed) -
+                      m_iRead.load(std::memory_order_acquire));
   }
 
   /**
@@ -225,7 +230,8 @@ public:
    */
   unsigned int GetReadSize()
   {
-    return m_iWritten - m_iRead;
+    // acquire pairs with WriteFinished(), the written bytes are visible to the reader
+    return m_iWritten.load(std::memory_order_acquire) - m_iRead.load(std::memory_order_relaxed);
   }
 
   /**
@@ -256,7 +262,7 @@ private:
       m_iWritePos = size - (m_iSize - m_iWritePos);
 
     //we can increase the write count now
-    m_iWritten+=size;
+    m_iWritten.store(m_iWritten.load(std::memory_order_relaxed) + size, std::memory_order_release);
   }
 
   /**
@@ -271,13 +277,13 @@ private:
       m_iReadPos = size - (m_iSize - m_iReadPos);
 
     //we can increase the read count now
-    m_iRead+=size;
+    m_iRead.store(m_iRead.load(std::memory_order_relaxed) + size, std::memory_order_release);
   }
 
   unsigned int m_iReadPos = 0;
   unsigned int m_iWritePos = 0;
-  unsigned int m_iRead = 0;
-  unsigned int m_iWritten = 0;
+  std::atomic<unsigned int> m_iRead{0};
+  std::atomic<unsigned int> m_iWritten{0};
   unsigned int m_iSize = 0;
   unsigned int m_planes = 0;
   unsigned char** m_Buffer = nullptr;
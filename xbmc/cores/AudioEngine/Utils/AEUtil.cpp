@@ -17,8 +17,13 @@
 
 #if defined(HAVE_SSE) && defined(__SSE__)
 #include <xmmintrin.h>
+#elif defined(__aarch64__) || (defined(HAS_NEON) && defined(__ARM_NEON))
+#define AE_USE_NEON
+#include <arm_neon.h>
 #endif
 
+#include <cmath>
+
 void AEDelayStatus::SetDelay(double d)
 {
   delay = d;
@@ -313,6 +318,60 @@ void CAEUtil::SSEMulAddArray(float *data, float *add, const float mul, uint32_t
 }
 #endif
 
+void CAEUtil::MulArray(float* data, const float mul, uint32_t count)
+{
+#if defined(HAVE_SSE) && defined(__SSE__)
+  SSEMulArray(data, mul, count);
+#else
+  uint32_t i = 0;
+#if defined(AE_USE_NEON)
+  const float32x4_t m = vdupq_n_f32(mul);
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(data + i, vmulq_f32(vld1q_f32(data + i), m));
+#endif
+  for (; i < count; ++i)
+    data[i] *= mul;
+#endif
+}
+
+bool CAEUtil::MulAddArray(float* data, const float* add, const float mul, uint32_t count)
+{
+  uint32_t i = 0;
+  bool clip = false;
+#if defined(HAVE_SSE) && defined(__SSE__)
+  const __m128 m = _mm_set_ps1(mul);
+  const __m128 sign = _mm_set_ps1(-0.0f);
+  const __m128 one = _mm_set_ps1(1.0f);
+  __m128 over = _mm_setzero_ps();
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 out = _mm_add_ps(_mm_loadu_ps(data + i), _mm_mul_ps(_mm_loadu_ps(add + i), m));
+    _mm_storeu_ps(data + i, out);
+    over = _mm_or_ps(over, _mm_cmpgt_ps(_mm_andnot_ps(sign, out), one));
+  }
+  clip = _mm_movemask_ps(over) != 0;
+#elif defined(AE_USE_NEON)
+  const float32x4_t m = vdupq_n_f32(mul);
+  const float32x4_t one = vdupq_n_f32(1.0f);
+  uint32x4_t over = vdupq_n_u32(0);
+  for (; i + 4 <= count; i += 4)
+  {
+    const float32x4_t out = vmlaq_f32(vld1q_f32(data + i), vld1q_f32(add + i), m);
+    vst1q_f32(data + i, out);
+    over = vorrq_u32(over, vcagtq_f32(out, one));
+  }
+  const uint32x2_t over2 = vorr_u32(vget_low_u32(over), vget_high_u32(over));
+  clip = (vget_lane_u32(over2, 0) | vget_lane_u32(over2, 1)) != 0;
+#endif
+  for (; i < count; ++i)
+  {
+    data[i] += add[i] * mul;
+    if (std::fabs(data[i]) > 1.0f)
+      clip = true;
+  }
+  return clip;
+}
+
 inline float CAEUtil::SoftClamp(const float x)
 {
 #if 1
@@ -350,7 +409,31 @@ inline float CAEUtil::SoftClamp(const float x)
 
 void CAEUtil::ClampArray(float *data, uint32_t count)
 {
-#if !defined(HAVE_SSE) || !defined(__SSE__)
+#if defined(AE_USE_NEON)
+  const float32x4_t c1 = vdupq_n_f32(27.0f);
+  const float32x4_t c9 = vdupq_n_f32(9.0f);
+  const float32x4_t limit = vdupq_n_f32(3.0f);
+  const float32x4_t one = vdupq_n_f32(1.0f);
+
+  uint32_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    /* tanh approx clamp, same as SoftClamp() including the hard limit beyond +-3 */
+    const float32x4_t dt = vld1q_f32(data + i);
+    const float32x4_t tmp = vmulq_f32(dt, dt);
+    const float32x4_t num = vmulq_f32(dt, vaddq_f32(c1, tmp));
+    const float32x4_t den = vmlaq_f32(c1, tmp, c9);
+    float32x4_t inv = vrecpeq_f32(den);
+    inv = vmulq_f32(vrecpsq_f32(den, inv), inv);
+    inv = vmulq_f32(vrecpsq_f32(den, inv), inv);
+    const float32x4_t soft = vmulq_f32(num, inv);
+    const float32x4_t hard = vbslq_f32(vcltq_f32(dt, vdupq_n_f32(0.0f)), vnegq_f32(one), one);
+    vst1q_f32(data + i, vbslq_f32(vcagtq_f32(dt, limit), hard, soft));
+  }
+  for (; i < count; ++i)
+    data[i] = SoftClamp(data[i]);
+
+#elif !defined(HAVE_SSE) || !defined(__SSE__)
   for (uint32_t i = 0; i < count; ++i)
     data[i] = SoftClamp(data[i]);
 
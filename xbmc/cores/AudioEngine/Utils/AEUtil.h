@@ -165,6 +165,15 @@ public:
   static void SSEMulArray     (float *data, const float mul, uint32_t count);
   static void SSEMulAddArray  (float *data, float *add, const float mul, uint32_t count);
   #endif
+
+  /*! \brief multiply count samples by mul, using the fastest kernel available for the build */
+  static void MulArray(float* data, const float mul, uint32_t count);
+
+  /*! \brief add count samples of add, scaled by mul, to data
+   \return true if any of the resulting samples is outside of [-1, 1] and needs clamping
+   */
+  static bool MulAddArray(float* data, const float* add, const float mul, uint32_t count);
+
   static void ClampArray(float *data, uint32_t count);
 
   static bool S16NeedsByteSwap(AEDataFormat in, AEDataFormat out);
@@ -15,15 +15,11 @@
 #include "utils/AgedMap.h"
 #include "utils/BitstreamConverter.h"
 
+#include <memory>
 #include <mutex>
 #include <utility>
 
-CDataCacheCore::CDataCacheCore() :
-  m_playerVideoInfo {},
-  m_playerAudioInfo {},
-  m_contentInfo {},
-  m_renderInfo {},
-  m_stateInfo {}
+CDataCacheCore::CDataCacheCore() : m_contentInfo(std::make_shared<const SContentInfo>())
 {
 }
 
@@ -36,29 +32,45 @@ CDataCacheCore& CDataCacheCore::GetInstance()
 
 void CDataCacheCore::Reset()
 {
-  {
-    std::unique_lock<CCriticalSection> lock(m_stateSection);
-    m_stateInfo = {};
-    m_playerStateChanged = false;
-  }
+  m_stateInfo.Store({});
+  m_playerStateChanged = false;
+  m_videoValues.Store({});
   {
     std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
     m_playerVideoInfo = {};
   }
+  m_audioValues.Store({});
   {
     std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
     m_playerAudioInfo = {};
   }
   m_hasAVInfoChanges = false;
-  {
-    std::unique_lock<CCriticalSection> lock(m_renderSection);
-    m_renderInfo = {};
-  }
+  m_renderInfo.Store({});
+  m_demuxInfo.Store({});
+  ResetStartupTimeline();
   {
     std::unique_lock<CCriticalSection> lock(m_contentSection);
-    m_contentInfo.Reset();
+    std::atomic_store(&m_contentInfo, std::make_shared<const SContentInfo>());
   }
-  m_timeInfo = {};
+  m_timeInfo.Store({});
+
+  for (auto& version : m_versions)
+    version.fetch_add(1, std::memory_order_release);
+}
+
+uint64_t CDataCacheCore::GetVersion(Group group) const
+{
+  return m_versions[static_cast<size_t>(group)].load(std::memory_order_acquire);
+}
+
+bool CDataCacheCore::HasChangedSince(Group group, uint64_t& version) const
+{
+  const uint64_t current = GetVersion(group);
+  if (current == version)
+    return false;
+
+  version = current;
+  return true;
 }
 
 bool CDataCacheCore::HasAVInfoChanges()
@@ -98,7 +110,8 @@ void CDataCacheCore::SetVideoDecoderName(std::string name, bool isHw)
   std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
 
   m_playerVideoInfo.decoderName = std::move(name);
-  m_playerVideoInfo.isHwDecoder = isHw;
+  m_videoValues.Update([isHw](SVideoValues& values) { values.isHwDecoder = isHw; });
+  Changed(Group::VIDEO);
 }
 
 std::string CDataCacheCore::GetVideoDecoderName()
@@ -110,9 +123,7 @@ std::string CDataCacheCore::GetVideoDecoderName()
 
 bool CDataCacheCore::IsVideoHwDecoder()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.isHwDecoder;
+  return m_videoValues.Load().isHwDecoder;
 }
 
 void CDataCacheCore::SetVideoDeintMethod(std::string method)
@@ -120,6 +131,7 @@ void CDataCacheCore::SetVideoDeintMethod(std::string method)
   std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
 
   m_playerVideoInfo.deintMethod = std::move(method);
+  Changed(Group::VIDEO);
 }
 
 std::string CDataCacheCore::GetVideoDeintMethod()
@@ -134,6 +146,7 @@ void CDataCacheCore::SetVideoPixelFormat(std::string pixFormat)
   std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
 
   m_playerVideoInfo.pixFormat = std::move(pixFormat);
+  Changed(Group::VIDEO);
 }
 
 std::string CDataCacheCore::GetVideoPixelFormat()
@@ -148,6 +161,7 @@ void CDataCacheCore::SetVideoStereoMode(std::string mode)
   std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
 
   m_playerVideoInfo.stereoMode = std::move(mode);
+  Changed(Group::VIDEO);
 }
 
 std::string CDataCacheCore::GetVideoStereoMode()
@@ -159,150 +173,123 @@ std::string CDataCacheCore::GetVideoStereoMode()
 
 void CDataCacheCore::SetVideoDimensions(int width, int height)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.width = width;
-  m_playerVideoInfo.height = height;
+  m_videoValues.Update([width, height](SVideoValues& values) {
+    values.width = width;
+    values.height = height;
+  });
+  Changed(Group::VIDEO);
 }
 
 int CDataCacheCore::GetVideoWidth()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.width;
+  return m_videoValues.Load().width;
 }
 
 int CDataCacheCore::GetVideoHeight()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.height;
+  return m_videoValues.Load().height;
 }
 
 void CDataCacheCore::SetVideoPts(double pts)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.pts = pts;
+  m_videoValues.Update([pts](SVideoValues& values) { values.pts = pts; });
+  Changed(Group::VIDEO);
 }
 
 double CDataCacheCore::GetVideoPts()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.pts;
+  return m_videoValues.Load().pts;
 }
 
 void CDataCacheCore::SetVideoBitDepth(int bitDepth)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.bitDepth = bitDepth;
+  m_videoValues.Update([bitDepth](SVideoValues& values) { values.bitDepth = bitDepth; });
+  Changed(Group::VIDEO);
 }
 
 int CDataCacheCore::GetVideoBitDepth()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.bitDepth;
+  return m_videoValues.Load().bitDepth;
 }
 
 void CDataCacheCore::SetVideoHdrType(StreamHdrType hdrType)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.hdrType = hdrType;
+  m_videoValues.Update([hdrType](SVideoValues& values) { values.hdrType = hdrType; });
+  Changed(Group::VIDEO);
 }
 
 StreamHdrType CDataCacheCore::GetVideoHdrType()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.hdrType;
+  return m_videoValues.Load().hdrType;
 }
 
 void CDataCacheCore::SetVideoSourceHdrType(StreamHdrType hdrType)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.sourceHdrType = hdrType;
+  m_videoValues.Update([hdrType](SVideoValues& values) { values.sourceHdrType = hdrType; });
+  Changed(Group::VIDEO);
 }
 
 StreamHdrType CDataCacheCore::GetVideoSourceHdrType()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.sourceHdrType;
+  return m_videoValues.Load().sourceHdrType;
 }
 
 void CDataCacheCore::SetVideoSourceAdditionalHdrType(StreamHdrType hdrType)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.sourceAdditionalHdrType = hdrType;
+  m_videoValues.Update([hdrType](SVideoValues& values)
+                       { values.sourceAdditionalHdrType = hdrType; });
+  Changed(Group::VIDEO);
 }
 
 StreamHdrType CDataCacheCore::GetVideoSourceAdditionalHdrType()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.sourceAdditionalHdrType;
+  return m_videoValues.Load().sourceAdditionalHdrType;
 }
 
 void CDataCacheCore::SetVideoColorSpace(AVColorSpace colorSpace)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.colorSpace = colorSpace;
+  m_videoValues.Update([colorSpace](SVideoValues& values) { values.colorSpace = colorSpace; });
+  Changed(Group::VIDEO);
 }
 
 AVColorSpace CDataCacheCore::GetVideoColorSpace()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.colorSpace;
+  return m_videoValues.Load().colorSpace;
 }
 
 void CDataCacheCore::SetVideoColorRange(AVColorRange colorRange)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.colorRange = colorRange;
+  m_videoValues.Update([colorRange](SVideoValues& values) { values.colorRange = colorRange; });
+  Changed(Group::VIDEO);
 }
 
 AVColorRange CDataCacheCore::GetVideoColorRange()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.colorRange;
+  return m_videoValues.Load().colorRange;
 }
 
 void CDataCacheCore::SetVideoColorPrimaries(AVColorPrimaries colorPrimaries)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.colorPrimaries = colorPrimaries;
+  m_videoValues.Update([colorPrimaries](SVideoValues& values)
+                       { values.colorPrimaries = colorPrimaries; });
+  Changed(Group::VIDEO);
 }
 
 AVColorPrimaries CDataCacheCore::GetVideoColorPrimaries()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.colorPrimaries;
+  return m_videoValues.Load().colorPrimaries;
 }
 
 void CDataCacheCore::SetVideoColorTransferCharacteristic(AVColorTransferCharacteristic colorTransferCharacteristic)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.colorTransferCharacteristic = colorTransferCharacteristic;
+  m_videoValues.Update([colorTransferCharacteristic](SVideoValues& values)
+                       { values.colorTransferCharacteristic = colorTransferCharacteristic; });
+  Changed(Group::VIDEO);
 }
 
 AVColorTransferCharacteristic CDataCacheCore::GetVideoColorTransferCharacteristic()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.colorTransferCharacteristic;
+  return m_videoValues.Load().colorTransferCharacteristic;
 }
 
 void CDataCacheCore::SetVideoDoViFrameMetadata(DOVIFrameMetadata value)
@@ -310,6 +297,7 @@ void CDataCacheCore::SetVideoDoViFrameMetadata(DOVIFrameMetadata value)
   std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
 
   m_playerVideoInfo.doviFrameMetadataMap.insert(value.pts, value);
+  Changed(Group::VIDEO);
 }
 
 DOVIFrameMetadata CDataCacheCore::GetVideoDoViFrameMetadata()
@@ -327,6 +315,7 @@ void CDataCacheCore::SetVideoDoViStreamMetadata(DOVIStreamMetadata value)
   std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
 
   m_playerVideoInfo.doviStreamMetadata = value;
+  Changed(Group::VIDEO);
 }
 
 DOVIStreamMetadata CDataCacheCore::GetVideoDoViStreamMetadata()
@@ -341,6 +330,7 @@ void CDataCacheCore::SetVideoDoViStreamInfo(DOVIStreamInfo value)
   std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
 
   m_playerVideoInfo.doviStreamInfo = value;
+  Changed(Group::VIDEO);
 }
 
 DOVIStreamInfo CDataCacheCore::GetVideoDoViStreamInfo()
@@ -355,6 +345,7 @@ void CDataCacheCore::SetVideoSourceDoViStreamInfo(DOVIStreamInfo value)
   std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
 
   m_playerVideoInfo.sourceDoViStreamInfo = value;
+  Changed(Group::VIDEO);
 }
 
 DOVIStreamInfo CDataCacheCore::GetVideoSourceDoViStreamInfo()
@@ -369,6 +360,7 @@ void CDataCacheCore::SetVideoDoViCodecFourCC(std::string codecFourCC)
   std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
 
   m_playerVideoInfo.doviCodecFourCC = codecFourCC;
+  Changed(Group::VIDEO);
 }
 
 std::string CDataCacheCore::GetVideoDoViCodecFourCC()
@@ -383,6 +375,7 @@ void CDataCacheCore::SetVideoHDRStaticMetadataInfo(HDRStaticMetadataInfo value)
   std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
 
   m_playerVideoInfo.hdrStaticMetadataInfo = value;
+  Changed(Group::VIDEO);
 }
 
 HDRStaticMetadataInfo CDataCacheCore::GetVideoHDRStaticMetadataInfo()
@@ -394,84 +387,97 @@ HDRStaticMetadataInfo CDataCacheCore::GetVideoHDRStaticMetadataInfo()
 
 void CDataCacheCore::SetVideoLiveBitRate(double bitRate)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.liveBitRate = bitRate;
+  m_videoValues.Update([bitRate](SVideoValues& values) { values.liveBitRate = bitRate; });
+  Changed(Group::VIDEO);
 }
 
 double CDataCacheCore::GetVideoLiveBitRate()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.liveBitRate;
+  return m_videoValues.Load().liveBitRate;
 }
 
 void CDataCacheCore::SetVideoQueueLevel(int level)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.queueLevel = level;
+  m_videoValues.Update([level](SVideoValues& values) { values.queueLevel = level; });
+  Changed(Group::VIDEO);
 }
 
 int CDataCacheCore::GetVideoQueueLevel()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  return m_playerVideoInfo.queueLevel;
+  return m_videoValues.Load().queueLevel;
 }
 
 void CDataCacheCore::SetVideoQueueDataLevel(int level)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-
-  m_playerVideoInfo.queueDataLevel = level;
+  m_videoValues.Update([level](SVideoValues& values) { values.queueDataLevel = level; });
+  Changed(Group::VIDEO);
 }
 
 int CDataCacheCore::GetVideoQueueDataLevel()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
+  return m_videoValues.Load().queueDataLevel;
+}
 
-  return m_playerVideoInfo.queueDataLevel;
+void CDataCacheCore::SetVideoQueueMaxDataSize(int size)
+{
+  m_videoValues.Update([size](SVideoValues& values) { values.queueMaxDataSize = size; });
+  Changed(Group::VIDEO);
 }
 
-void CDataCacheCore::SetVideoFps(float fps)
+int CDataCacheCore::GetVideoQueueMaxDataSize()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
+  return m_videoValues.Load().queueMaxDataSize;
+}
 
-  m_playerVideoInfo.fps = fps;
+void CDataCacheCore::SetVideoDecoderStats(uint64_t decoded, uint64_t dropped)
+{
+  m_videoValues.Update([decoded, dropped](SVideoValues& values) {
+    values.decodedFrames = decoded;
+    values.droppedFrames = dropped;
+  });
+  Changed(Group::VIDEO);
 }
 
-float CDataCacheCore::GetVideoFps()
+void CDataCacheCore::GetVideoDecoderStats(uint64_t& decoded, uint64_t& dropped)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
+  const SVideoValues values = m_videoValues.Load();
 
-  return m_playerVideoInfo.fps;
+  decoded = values.decodedFrames;
+  dropped = values.droppedFrames;
 }
 
-void CDataCacheCore::SetVideoDAR(float dar)
+void CDataCacheCore::SetVideoFps(float fps)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
+  m_videoValues.Update([fps](SVideoValues& values) { values.fps = fps; });
+  Changed(Group::VIDEO);
+}
 
-  m_playerVideoInfo.dar = dar;
+float CDataCacheCore::GetVideoFps()
+{
+  return m_videoValues.Load().fps;
 }
 
-float CDataCacheCore::GetVideoDAR()
+void CDataCacheCore::SetVideoDAR(float dar)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
+  m_videoValues.Update([dar](SVideoValues& values) { values.dar = dar; });
+  Changed(Group::VIDEO);
+}
 
-  return m_playerVideoInfo.dar;
+float CDataCacheCore::GetVideoDAR()
+{
+  return m_videoValues.Load().dar;
 }
 
 void CDataCacheCore::SetVideoInterlaced(bool isInterlaced)
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-  m_playerVideoInfo.m_isInterlaced = isInterlaced;
+  m_videoValues.Update([isInterlaced](SVideoValues& values)
+                       { values.m_isInterlaced = isInterlaced; });
+  Changed(Group::VIDEO);
 }
 
 bool CDataCacheCore::IsVideoInterlaced()
 {
-  std::unique_lock<CCriticalSection> lock(m_videoPlayerSection);
-  return m_playerVideoInfo.m_isInterlaced;
+  return m_videoValues.Load().m_isInterlaced;
 }
 
 // player audio info
@@ -480,6 +486,7 @@ void CDataCacheCore::SetAudioDecoderName(std::string name)
   std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
 
   m_playerAudioInfo.decoderName = std::move(name);
+  Changed(Group::AUDIO);
 }
 
 std::string CDataCacheCore::GetAudioDecoderName()
@@ -494,6 +501,7 @@ void CDataCacheCore::SetAudioChannels(std::string channels)
   std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
 
   m_playerAudioInfo.channels = std::move(channels);
+  Changed(Group::AUDIO);
 }
 
 std::string CDataCacheCore::GetAudioChannels()
@@ -505,362 +513,416 @@ std::string CDataCacheCore::GetAudioChannels()
 
 void CDataCacheCore::SetAudioSampleRate(int sampleRate)
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  m_playerAudioInfo.sampleRate = sampleRate;
+  m_audioValues.Update([sampleRate](SAudioValues& values) { values.sampleRate = sampleRate; });
+  Changed(Group::AUDIO);
 }
 
 int CDataCacheCore::GetAudioSampleRate()
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  return m_playerAudioInfo.sampleRate;
+  return m_audioValues.Load().sampleRate;
 }
 
 void CDataCacheCore::SetAudioBitsPerSample(int bitsPerSample)
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  m_playerAudioInfo.bitsPerSample = bitsPerSample;
+  m_audioValues.Update([bitsPerSample](SAudioValues& values)
+                       { values.bitsPerSample = bitsPerSample; });
+  Changed(Group::AUDIO);
 }
 
 int CDataCacheCore::GetAudioBitsPerSample()
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  return m_playerAudioInfo.bitsPerSample;
+  return m_audioValues.Load().bitsPerSample;
 }
 
 void CDataCacheCore::SetAudioPts(double pts)
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  m_playerAudioInfo.pts = pts;
+  m_audioValues.Update([pts](SAudioValues& values) { values.pts = pts; });
+  Changed(Group::AUDIO);
 }
 
 double CDataCacheCore::GetAudioPts()
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  return m_playerAudioInfo.pts;
+  return m_audioValues.Load().pts;
 }
 
 void CDataCacheCore::SetAudioIsDolbyAtmos(bool isDolbyAtmos)
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  m_playerAudioInfo.isDolbyAtmos = isDolbyAtmos;
+  m_audioValues.Update([isDolbyAtmos](SAudioValues& values)
+                       { values.isDolbyAtmos = isDolbyAtmos; });
+  Changed(Group::AUDIO);
 }
 
 bool CDataCacheCore::GetAudioIsDolbyAtmos()
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  return m_playerAudioInfo.isDolbyAtmos;
+  return m_audioValues.Load().isDolbyAtmos;
 }
 
 void CDataCacheCore::SetAudioDtsXType(DtsXType dtsXType)
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  m_playerAudioInfo.dtsXType = dtsXType;
+  m_audioValues.Update([dtsXType](SAudioValues& values) { values.dtsXType = dtsXType; });
+  Changed(Group::AUDIO);
 }
 
 DtsXType CDataCacheCore::GetAudioDtsXType()
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  return m_playerAudioInfo.dtsXType;
+  return m_audioValues.Load().dtsXType;
 }
 
 void CDataCacheCore::SetAudioLiveBitRate(double bitRate)
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  m_playerAudioInfo.liveBitRate = bitRate;
+  m_audioValues.Update([bitRate](SAudioValues& values) { values.liveBitRate = bitRate; });
+  Changed(Group::AUDIO);
 }
 
 double CDataCacheCore::GetAudioLiveBitRate()
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  return m_playerAudioInfo.liveBitRate;
+  return m_audioValues.Load().liveBitRate;
 }
 
 void CDataCacheCore::SetAudioQueueLevel(int level)
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  m_playerAudioInfo.queueLevel = level;
+  m_audioValues.Update([level](SAudioValues& values) { values.queueLevel = level; });
+  Changed(Group::AUDIO);
 }
 
 int CDataCacheCore::GetAudioQueueLevel()
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  return m_playerAudioInfo.queueLevel;
+  return m_audioValues.Load().queueLevel;
 }
 
 void CDataCacheCore::SetAudioQueueDataLevel(int level)
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
-
-  m_playerAudioInfo.queueDataLevel = level;
+  m_audioValues.Update([level](SAudioValues& values) { values.queueDataLevel = level; });
+  Changed(Group::AUDIO);
 }
 
 int CDataCacheCore::GetAudioQueueDataLevel()
 {
-  std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
+  return m_audioValues.Load().queueDataLevel;
+}
 
-  return m_playerAudioInfo.queueDataLevel;
+void CDataCacheCore::SetAudioQueueMaxDataSize(int size)
+{
+  m_audioValues.Update([size](SAudioValues& values) { values.queueMaxDataSize = size; });
+  Changed(Group::AUDIO);
 }
 
-void CDataCacheCore::SetEditList(const std::vector<EDL::Edit>& editList)
+int CDataCacheCore::GetAudioQueueMaxDataSize()
 {
-  std::unique_lock<CCriticalSection> lock(m_contentSection);
-  m_contentInfo.SetEditList(editList);
+  return m_audioValues.Load().queueMaxDataSize;
+}
+
+void CDataCacheCore::SetDemuxPacketPoolStats(uint64_t hits, uint64_t misses)
+{
+  m_demuxInfo.Update([hits, misses](SDemuxInfo& info) {
+    info.packetPoolHits = hits;
+    info.packetPoolMisses = misses;
+  });
+  Changed(Group::DEMUX);
+}
+
+void CDataCacheCore::GetDemuxPacketPoolStats(uint64_t& hits, uint64_t& misses)
+{
+  const SDemuxInfo info = m_demuxInfo.Load();
+
+  hits = info.packetPoolHits;
+  misses = info.packetPoolMisses;
+}
+
+void CDataCacheCore::SetDemuxPrefetchStats(uint64_t level,
+                                           uint64_t capacity,
+                                           unsigned int underruns)
+{
+  m_demuxInfo.Update([level, capacity, underruns](SDemuxInfo& info) {
+    info.prefetchLevel = level;
+    info.prefetchCapacity = capacity;
+    info.prefetchUnderruns = underruns;
+  });
+  Changed(Group::DEMUX);
+}
+
+void CDataCacheCore::GetDemuxPrefetchStats(uint64_t& level,
+                                           uint64_t& capacity,
+                                           unsigned int& underruns)
+{
+  const SDemuxInfo info = m_demuxInfo.Load();
+
+  level = info.prefetchLevel;
+  capacity = info.prefetchCapacity;
+  underruns = info.prefetchUnderruns;
+}
+
+void CDataCacheCore::SetDemuxReadStats(unsigned int readsPerSecond, uint64_t bytesPerSecond)
+{
+  m_demuxInfo.Update([readsPerSecond, bytesPerSecond](SDemuxInfo& info) {
+    info.readsPerSecond = readsPerSecond;
+    info.readBytesPerSecond = bytesPerSecond;
+  });
+  Changed(Group::DEMUX);
+}
+
+void CDataCacheCore::GetDemuxReadStats(unsigned int& readsPerSecond, uint64_t& bytesPerSecond)
+{
+  const SDemuxInfo info = m_demuxInfo.Load();
+
+  readsPerSecond = info.readsPerSecond;
+  bytesPerSecond = info.readBytesPerSecond;
+}
+
+void CDataCacheCore::ResetStartupTimeline()
+{
+  std::unique_lock<CCriticalSection> lock(m_startupSection);
+
+  m_startupTimeline.clear();
+}
+
+void CDataCacheCore::AddStartupStage(const std::string& stage, std::chrono::milliseconds elapsed)
+{
+  std::unique_lock<CCriticalSection> lock(m_startupSection);
+
+  m_startupTimeline.emplace_back(stage, elapsed);
 }
 
-const std::vector<EDL::Edit>& CDataCacheCore::GetEditList() const
+std::vector<std::pair<std::string, std::chrono::milliseconds>> CDataCacheCore::GetStartupTimeline()
+{
+  std::unique_lock<CCriticalSection> lock(m_startupSection);
+
+  return m_startupTimeline;
+}
+
+template<typename F>
+void CDataCacheCore::UpdateContent(F&& modify)
 {
   std::unique_lock<CCriticalSection> lock(m_contentSection);
-  return m_contentInfo.GetEditList();
+
+  // readers may still hold the published copy, so modify a new one and swap it in
+  auto contentInfo = std::make_shared<SContentInfo>(*std::atomic_load(&m_contentInfo));
+  modify(*contentInfo);
+  std::atomic_store(&m_contentInfo, std::shared_ptr<const SContentInfo>(std::move(contentInfo)));
+  Changed(Group::CONTENT);
+}
+
+void CDataCacheCore::SetEditList(const std::vector<EDL::Edit>& editList)
+{
+  UpdateContent([&editList](SContentInfo& info) { info.SetEditList(editList); });
+}
+
+std::vector<EDL::Edit> CDataCacheCore::GetEditList() const
+{
+  return std::atomic_load(&m_contentInfo)->GetEditList();
 }
 
 void CDataCacheCore::SetCuts(const std::vector<int64_t>& cuts)
 {
-  std::unique_lock<CCriticalSection> lock(m_contentSection);
-  m_contentInfo.SetCuts(cuts);
+  UpdateContent([&cuts](SContentInfo& info) { info.SetCuts(cuts); });
 }
 
-const std::vector<int64_t>& CDataCacheCore::GetCuts() const
+std::vector<int64_t> CDataCacheCore::GetCuts() const
 {
-  std::unique_lock<CCriticalSection> lock(m_contentSection);
-  return m_contentInfo.GetCuts();
+  return std::atomic_load(&m_contentInfo)->GetCuts();
 }
 
 void CDataCacheCore::SetSceneMarkers(const std::vector<int64_t>& sceneMarkers)
 {
-  std::unique_lock<CCriticalSection> lock(m_contentSection);
-  m_contentInfo.SetSceneMarkers(sceneMarkers);
+  UpdateContent([&sceneMarkers](SContentInfo& info) { info.SetSceneMarkers(sceneMarkers); });
 }
 
-const std::vector<int64_t>& CDataCacheCore::GetSceneMarkers() const
+std::vector<int64_t> CDataCacheCore::GetSceneMarkers() const
 {
-  std::unique_lock<CCriticalSection> lock(m_contentSection);
-  return m_contentInfo.GetSceneMarkers();
+  return std::atomic_load(&m_contentInfo)->GetSceneMarkers();
 }
 
 void CDataCacheCore::SetChapters(const std::vector<std::pair<std::string, int64_t>>& chapters)
 {
-  std::unique_lock<CCriticalSection> lock(m_contentSection);
-  m_contentInfo.SetChapters(chapters);
+  UpdateContent([&chapters](SContentInfo& info) { info.SetChapters(chapters); });
 }
 
-const std::vector<std::pair<std::string, int64_t>>& CDataCacheCore::GetChapters() const
+std::vector<std::pair<std::string, int64_t>> CDataCacheCore::GetChapters() const
 {
-  std::unique_lock<CCriticalSection> lock(m_contentSection);
-  return m_contentInfo.GetChapters();
+  return std::atomic_load(&m_contentInfo)->GetChapters();
 }
 
 void CDataCacheCore::SetRenderClockSync(bool enable)
 {
-  std::unique_lock<CCriticalSection> lock(m_renderSection);
-
-  m_renderInfo.m_isClockSync = enable;
+  m_renderInfo.Update([enable](SRenderInfo& info) { info.m_isClockSync = enable; });
+  Changed(Group::RENDER);
 }
 
 bool CDataCacheCore::IsRenderClockSync()
 {
-  std::unique_lock<CCriticalSection> lock(m_renderSection);
-
-  return m_renderInfo.m_isClockSync;
+  return m_renderInfo.Load().m_isClockSync;
 }
 
 void CDataCacheCore::SetRenderPts(double pts)
 {
-  std::unique_lock<CCriticalSection> lock(m_renderSection);
-
-  m_renderInfo.pts = pts;
+  m_renderInfo.Update([pts](SRenderInfo& info) { info.pts = pts; });
+  Changed(Group::RENDER);
 }
 
 double CDataCacheCore::GetRenderPts()
 {
-  std::unique_lock<CCriticalSection> lock(m_renderSection);
+  return m_renderInfo.Load().pts;
+}
+
+void CDataCacheCore::SetPresentStats(const SPresentStats& stats)
+{
+  m_renderInfo.Update([&stats](SRenderInfo& info) { info.presentStats = stats; });
+  Changed(Group::RENDER);
+}
 
-  return m_renderInfo.pts;
+CDataCacheCore::SPresentStats CDataCacheCore::GetPresentStats()
+{
+  return m_renderInfo.Load().presentStats;
 }
 
 // player states
 void CDataCacheCore::SeekFinished(int64_t offset)
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-  m_stateInfo.m_lastSeekTime = std::chrono::system_clock::now();
-  m_stateInfo.m_lastSeekOffset = offset;
+  m_stateInfo.Update([offset](SStateInfo& info) {
+    info.m_lastSeekTime = std::chrono::system_clock::now();
+    info.m_lastSeekOffset = offset;
+  });
+  Changed(Group::STATE);
 }
 
 int64_t CDataCacheCore::GetSeekOffSet() const
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-  return m_stateInfo.m_lastSeekOffset;
+  return m_stateInfo.Load().m_lastSeekOffset;
 }
 
 bool CDataCacheCore::HasPerformedSeek(int64_t lastSecondInterval) const
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-  if (m_stateInfo.m_lastSeekTime == std::chrono::time_point<std::chrono::system_clock>{})
+  const auto lastSeekTime = m_stateInfo.Load().m_lastSeekTime;
+  if (lastSeekTime == std::chrono::time_point<std::chrono::system_clock>{})
   {
     return false;
   }
-  return (std::chrono::system_clock::now() - m_stateInfo.m_lastSeekTime) <
+  return (std::chrono::system_clock::now() - lastSeekTime) <
          std::chrono::duration_cast<std::chrono::seconds>(
              std::chrono::duration<int64_t>(lastSecondInterval));
 }
 
 void CDataCacheCore::SetStateSeeking(bool active)
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  m_stateInfo.m_stateSeeking = active;
+  m_stateInfo.Update([active](SStateInfo& info) { info.m_stateSeeking = active; });
   m_playerStateChanged = true;
+  Changed(Group::STATE);
 }
 
 bool CDataCacheCore::IsSeeking()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  return m_stateInfo.m_stateSeeking;
+  return m_stateInfo.Load().m_stateSeeking;
 }
 
 void CDataCacheCore::SetSpeed(float tempo, float speed)
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  m_stateInfo.m_tempo = tempo;
-  m_stateInfo.m_speed = speed;
+  m_stateInfo.Update([tempo, speed](SStateInfo& info) {
+    info.m_tempo = tempo;
+    info.m_speed = speed;
+  });
+  Changed(Group::STATE);
 }
 
 float CDataCacheCore::GetSpeed()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  return m_stateInfo.m_speed;
+  return m_stateInfo.Load().m_speed;
 }
 
 float CDataCacheCore::GetTempo()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  return m_stateInfo.m_tempo;
+  return m_stateInfo.Load().m_tempo;
 }
 
 void CDataCacheCore::SetFrameAdvance(bool fa)
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  m_stateInfo.m_frameAdvance = fa;
+  m_stateInfo.Update([fa](SStateInfo& info) { info.m_frameAdvance = fa; });
+  Changed(Group::STATE);
 }
 
 bool CDataCacheCore::IsFrameAdvance()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  return m_stateInfo.m_frameAdvance;
+  return m_stateInfo.Load().m_frameAdvance;
 }
 
 bool CDataCacheCore::IsPlayerStateChanged()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  bool ret(m_playerStateChanged);
-  m_playerStateChanged = false;
-
-  return ret;
+  return m_playerStateChanged.exchange(false);
 }
 
 void CDataCacheCore::SetGuiRender(bool gui)
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  m_stateInfo.m_renderGuiLayer = gui;
+  m_stateInfo.Update([gui](SStateInfo& info) { info.m_renderGuiLayer = gui; });
   m_playerStateChanged = true;
+  Changed(Group::STATE);
 }
 
 bool CDataCacheCore::GetGuiRender()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  return m_stateInfo.m_renderGuiLayer;
+  return m_stateInfo.Load().m_renderGuiLayer;
 }
 
 void CDataCacheCore::SetVideoRender(bool video)
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  m_stateInfo.m_renderVideoLayer = video;
+  m_stateInfo.Update([video](SStateInfo& info) { info.m_renderVideoLayer = video; });
   m_playerStateChanged = true;
+  Changed(Group::STATE);
 }
 
 bool CDataCacheCore::GetVideoRender()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
-  return m_stateInfo.m_renderVideoLayer;
+  return m_stateInfo.Load().m_renderVideoLayer;
 }
 
 void CDataCacheCore::SetPlayTimes(time_t start, int64_t current, int64_t min, int64_t max)
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-  m_timeInfo.m_startTime = start;
-  m_timeInfo.m_time = current;
-  m_timeInfo.m_timeMin = min;
-  m_timeInfo.m_timeMax = max;
+  STimeInfo info;
+  info.m_startTime = start;
+  info.m_time = current;
+  info.m_timeMin = min;
+  info.m_timeMax = max;
+  m_timeInfo.Store(info);
+  Changed(Group::TIME);
 }
 
 void CDataCacheCore::GetPlayTimes(time_t &start, int64_t &current, int64_t &min, int64_t &max)
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-  start = m_timeInfo.m_startTime;
-  current = m_timeInfo.m_time;
-  min = m_timeInfo.m_timeMin;
-  max = m_timeInfo.m_timeMax;
+  const STimeInfo info = m_timeInfo.Load();
+  start = info.m_startTime;
+  current = info.m_time;
+  min = info.m_timeMin;
+  max = info.m_timeMax;
 }
 
 time_t CDataCacheCore::GetStartTime()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-  return m_timeInfo.m_startTime;
+  return m_timeInfo.Load().m_startTime;
 }
 
 int64_t CDataCacheCore::GetPlayTime()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-  return m_timeInfo.m_time;
+  return m_timeInfo.Load().m_time;
 }
 
 int64_t CDataCacheCore::GetMinTime()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-  return m_timeInfo.m_timeMin;
+  return m_timeInfo.Load().m_timeMin;
 }
 
 int64_t CDataCacheCore::GetMaxTime()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-  return m_timeInfo.m_timeMax;
+  return m_timeInfo.Load().m_timeMax;
 }
 
 float CDataCacheCore::GetPlayPercentage()
 {
-  std::unique_lock<CCriticalSection> lock(m_stateSection);
-
   // Note: To calculate accurate percentage, all time data must be consistent,
-  //       which is the case for data cache core. Calculation can not be done
-  //       outside of data cache core or a possibility to lock the data cache
-  //       core from outside would be needed.
-  int64_t iTotalTime = m_timeInfo.m_timeMax - m_timeInfo.m_timeMin;
+  //       which is the case for a single snapshot of the data cache core.
+  //       Calculation can not be done from separate getters outside of data
+  //       cache core.
+  const STimeInfo info = m_timeInfo.Load();
+  int64_t iTotalTime = info.m_timeMax - info.m_timeMin;
   if (iTotalTime <= 0)
     return 0;
 
-  return m_timeInfo.m_time * 100 / static_cast<float>(iTotalTime);
+  return info.m_time * 100 / static_cast<float>(iTotalTime);
 }
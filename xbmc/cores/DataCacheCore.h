@@ -12,12 +12,17 @@
 #include "EdlEdit.h"
 #include "cores/AudioEngine/Utils/AEStreamInfo.h"
 #include "threads/CriticalSection.h"
+#include "threads/SeqLock.h"
 #include "utils/AgedMap.h"
 #include "utils/BitstreamConverter.h"
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 class CDataCacheCore
@@ -27,6 +32,36 @@ public:
   virtual ~CDataCacheCore();
   static CDataCacheCore& GetInstance();
   void Reset();
+
+  /*!
+   * @brief Groups of cached values. Each group has a version that increases whenever one of its
+   * values is set, which lets readers skip work while nothing changed.
+   */
+  enum class Group
+  {
+    VIDEO,
+    AUDIO,
+    DEMUX,
+    CONTENT,
+    RENDER,
+    STATE,
+    TIME,
+    COUNT
+  };
+
+  /*!
+   * @brief Get the current version of a group.
+   */
+  uint64_t GetVersion(Group group) const;
+
+  /*!
+   * @brief Check if a group changed since the caller looked at it last.
+   * @param group The group to check
+   * @param[in,out] version The version seen last, updated to the current version
+   * @return True if the group changed, otherwise false
+   */
+  bool HasChangedSince(Group group, uint64_t& version) const;
+
   bool HasAVInfoChanges();
   void SignalVideoInfoChange();
   void SignalAudioInfoChange();
@@ -90,6 +125,15 @@ public:
   int GetVideoQueueLevel();
   void SetVideoQueueDataLevel(int level);
   int GetVideoQueueDataLevel();
+  void SetVideoQueueMaxDataSize(int size);
+  int GetVideoQueueMaxDataSize();
+
+  /*!
+   * @brief Set the number of pictures the video decoder delivered and how many of them were
+   * dropped before they got to the renderer, since playback started.
+   */
+  void SetVideoDecoderStats(uint64_t decoded, uint64_t dropped);
+  void GetVideoDecoderStats(uint64_t& decoded, uint64_t& dropped);
 
   /*!
    * @brief Set if the video is interlaced in cache.
@@ -126,6 +170,66 @@ public:
   int GetAudioQueueLevel();
   void SetAudioQueueDataLevel(int level);
   int GetAudioQueueDataLevel();
+  void SetAudioQueueMaxDataSize(int size);
+  int GetAudioQueueMaxDataSize();
+
+  // demuxer info
+
+  /*!
+   * @brief Set the demux packet pool counters in cache.
+   * @param hits Number of packet allocations served from the pool
+   * @param misses Number of packet allocations that had to hit the heap
+   */
+  void SetDemuxPacketPoolStats(uint64_t hits, uint64_t misses);
+
+  /*!
+   * @brief Get the demux packet pool counters from cache.
+   */
+  void GetDemuxPacketPoolStats(uint64_t& hits, uint64_t& misses);
+
+  /*!
+   * @brief Set the state of the read-ahead buffer of a live PVR stream in cache.
+   * @param level Number of bytes in the buffer
+   * @param capacity Size of the buffer in bytes, 0 if there is no read-ahead
+   * @param underruns Number of times the buffer ran empty during playback
+   */
+  void SetDemuxPrefetchStats(uint64_t level, uint64_t capacity, unsigned int underruns);
+
+  /*!
+   * @brief Get the state of the read-ahead buffer of a live PVR stream from cache.
+   */
+  void GetDemuxPrefetchStats(uint64_t& level, uint64_t& capacity, unsigned int& underruns);
+
+  /*!
+   * @brief Set how often the demuxer read from the input stream in cache.
+   * @param readsPerSecond Number of read callbacks per second
+   * @param bytesPerSecond Number of bytes read per second
+   */
+  void SetDemuxReadStats(unsigned int readsPerSecond, uint64_t bytesPerSecond);
+
+  /*!
+   * @brief Get how often the demuxer read from the input stream from cache.
+   */
+  void GetDemuxReadStats(unsigned int& readsPerSecond, uint64_t& bytesPerSecond);
+
+  // startup info
+
+  /*!
+   * @brief Clear the startup timeline in cache, when the player starts opening a file.
+   */
+  void ResetStartupTimeline();
+
+  /*!
+   * @brief Add a finished stage of the player startup to the timeline in cache.
+   * @param stage Name of the stage, e.g. "demuxer"
+   * @param elapsed Time since the player started opening the file
+   */
+  void AddStartupStage(const std::string& stage, std::chrono::milliseconds elapsed);
+
+  /*!
+   * @brief Get the startup timeline from cache, in the order the stages finished.
+   */
+  std::vector<std::pair<std::string, std::chrono::milliseconds>> GetStartupTimeline();
 
   // content info
 
@@ -139,7 +243,7 @@ public:
    * @brief Get the EDL edit list in cache.
    * @return The EDL edits or an empty vector if no edits exist.
    */
-  const std::vector<EDL::Edit>& GetEditList() const;
+  std::vector<EDL::Edit> GetEditList() const;
 
   /*!
    * @brief Set the list of cut markers in cache.
@@ -151,7 +255,7 @@ public:
    * @brief Get the list of cut markers from cache.
    * @return The list of cut markers or an empty vector if no cuts exist.
    */
-  const std::vector<int64_t>& GetCuts() const;
+  std::vector<int64_t> GetCuts() const;
 
   /*!
    * @brief Set the list of scene markers in cache.
@@ -163,7 +267,7 @@ public:
    * @brief Get the list of scene markers markers from cache.
    * @return The list of scene markers or an empty vector if no scene exist.
    */
-  const std::vector<int64_t>& GetSceneMarkers() const;
+  std::vector<int64_t> GetSceneMarkers() const;
 
   void SetChapters(const std::vector<std::pair<std::string, int64_t>>& chapters);
 
@@ -171,7 +275,7 @@ public:
    * @brief Get the chapter list in cache.
    * @return The list of chapters or an empty vector if no chapters exist.
    */
-  const std::vector<std::pair<std::string, int64_t>>& GetChapters() const;
+  std::vector<std::pair<std::string, int64_t>> GetChapters() const;
 
   // render info
   void SetRenderClockSync(bool enabled);
@@ -179,6 +283,24 @@ public:
   void SetRenderPts(double pts);
   double GetRenderPts();
 
+  /*!
+   * \brief Statistics about how the frames of the video were presented
+   */
+  struct SPresentStats
+  {
+    static constexpr int MAX_VSYNCS = 6;
+
+    //! number of frames that were on screen for 1, 2, .. MAX_VSYNCS or more display refreshes
+    std::array<uint64_t, MAX_VSYNCS> vsyncs{};
+    uint64_t frames = 0;
+    //! frames presented a refresh or more after their time
+    uint64_t late = 0;
+    //! frames skipped because they were too late
+    uint64_t dropped = 0;
+  };
+  void SetPresentStats(const SPresentStats& stats);
+  SPresentStats GetPresentStats();
+
   // player states
   /*!
    * @brief Notifies the cache core that a seek operation has finished
@@ -257,22 +379,27 @@ public:
   int64_t GetMaxTime();
 
 protected:
+  void Changed(Group group)
+  {
+    m_versions[static_cast<size_t>(group)].fetch_add(1, std::memory_order_release);
+  }
+
   std::atomic_bool m_AVChange = false;
   std::atomic_bool m_hasAVInfoChanges = false;
 
-  CCriticalSection m_videoPlayerSection;
-  struct SPlayerVideoInfo
-  {    
-    std::string decoderName;
-    bool isHwDecoder;
-    std::string deintMethod;
-    std::string pixFormat;
-    std::string stereoMode;
-    int width;
-    int height;
-    float fps;
-    float dar;
-    bool m_isInterlaced;
+  std::array<std::atomic<uint64_t>, static_cast<size_t>(Group::COUNT)> m_versions{};
+
+  // The values read while playing are published with seqlocks, so readers never block the
+  // player threads. Values that are not trivially copyable are guarded by a lock.
+
+  struct SVideoValues
+  {
+    bool isHwDecoder = false;
+    int width = 0;
+    int height = 0;
+    float fps = 0.0f;
+    float dar = 0.0f;
+    bool m_isInterlaced = false;
     double pts = 0;
     int bitDepth = 0;
     StreamHdrType hdrType = StreamHdrType::HDR_TYPE_NONE;
@@ -282,6 +409,22 @@ protected:
     AVColorRange colorRange = AVCOL_RANGE_UNSPECIFIED;
     AVColorPrimaries colorPrimaries = AVCOL_PRI_UNSPECIFIED;
     AVColorTransferCharacteristic colorTransferCharacteristic = AVCOL_TRC_UNSPECIFIED;
+    double liveBitRate = 0;
+    int queueLevel = 0;
+    int queueDataLevel = 0;
+    int queueMaxDataSize = 0;
+    uint64_t decodedFrames = 0;
+    uint64_t droppedFrames = 0;
+  };
+  XbmcThreads::CSeqLock<SVideoValues> m_videoValues;
+
+  CCriticalSection m_videoPlayerSection;
+  struct SPlayerVideoInfo
+  {
+    std::string decoderName;
+    std::string deintMethod;
+    std::string pixFormat;
+    std::string stereoMode;
     AgedMap<uint64_t, DOVIFrameMetadata> doviFrameMetadataMap;
     DOVIStreamMetadata doviStreamMetadata = {};
     DOVIStreamInfo doviStreamInfo = {};
@@ -290,28 +433,45 @@ protected:
     std::string doviCodecFourCC = "";
 
     HDRStaticMetadataInfo hdrStaticMetadataInfo = {};
+  } m_playerVideoInfo;
 
+  struct SAudioValues
+  {
+    int sampleRate = 0;
+    int bitsPerSample = 0;
+    double pts = 0;
+    bool isDolbyAtmos = false;
+    DtsXType dtsXType = DtsXType::DTS_X_NONE;
     double liveBitRate = 0;
     int queueLevel = 0;
     int queueDataLevel = 0;
-  } m_playerVideoInfo;
+    int queueMaxDataSize = 0;
+  };
+  XbmcThreads::CSeqLock<SAudioValues> m_audioValues;
 
   CCriticalSection m_audioPlayerSection;
   struct SPlayerAudioInfo
   {
     std::string decoderName;
     std::string channels;
-    int sampleRate;
-    int bitsPerSample;
-    double pts = 0;
-    bool isDolbyAtmos = false;
-    DtsXType dtsXType = DtsXType::DTS_X_NONE;
-    double liveBitRate = 0;
-    int queueLevel = 0;
-    int queueDataLevel = 0;
   } m_playerAudioInfo;
 
-  mutable CCriticalSection m_contentSection;
+  struct SDemuxInfo
+  {
+    uint64_t packetPoolHits = 0;
+    uint64_t packetPoolMisses = 0;
+    uint64_t prefetchLevel = 0;
+    uint64_t prefetchCapacity = 0;
+    unsigned int prefetchUnderruns = 0;
+    unsigned int readsPerSecond = 0;
+    uint64_t readBytesPerSecond = 0;
+  };
+  XbmcThreads::CSeqLock<SDemuxInfo> m_demuxInfo;
+
+  CCriticalSection m_startupSection;
+  std::vector<std::pair<std::string, std::chrono::milliseconds>> m_startupTimeline;
+
+  CCriticalSection m_contentSection; ///< serializes the writers of m_contentInfo
   struct SContentInfo
   {
   public:
@@ -389,17 +549,22 @@ protected:
     std::vector<int64_t> m_cuts;
     /*!< position for EDL scene markers */
     std::vector<int64_t> m_sceneMarkers;
-  } m_contentInfo;
+  };
+  /*!< published copy, replaced as a whole on every change and read with std::atomic_load */
+  std::shared_ptr<const SContentInfo> m_contentInfo;
+
+  template<typename F>
+  void UpdateContent(F&& modify);
 
-  CCriticalSection m_renderSection;
   struct SRenderInfo
   {
-    bool m_isClockSync;
+    bool m_isClockSync = false;
     double pts = 0;
-  } m_renderInfo;
+    SPresentStats presentStats;
+  };
+  XbmcThreads::CSeqLock<SRenderInfo> m_renderInfo;
 
-  mutable CCriticalSection m_stateSection;
-  bool m_playerStateChanged = false;
+  std::atomic_bool m_playerStateChanged = false;
   struct SStateInfo
   {
     bool m_stateSeeking{false};
@@ -413,13 +578,15 @@ protected:
         std::chrono::time_point<std::chrono::system_clock>{}};
     /*! Last seek offset */
     int64_t m_lastSeekOffset{0};
-  } m_stateInfo;
+  };
+  XbmcThreads::CSeqLock<SStateInfo> m_stateInfo;
 
   struct STimeInfo
   {
-    time_t m_startTime;
-    int64_t m_time;
-    int64_t m_timeMax;
-    int64_t m_timeMin;
-  } m_timeInfo = {};
+    time_t m_startTime = 0;
+    int64_t m_time = 0;
+    int64_t m_timeMax = 0;
+    int64_t m_timeMin = 0;
+  };
+  XbmcThreads::CSeqLock<STimeInfo> m_timeInfo;
 };
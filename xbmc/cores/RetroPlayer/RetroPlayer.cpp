@@ -488,6 +488,9 @@ void CRetroPlayer::FrameMove()
   if (m_playbackControl)
     m_playbackControl->FrameMove();
 
+  if (m_playback)
+    m_playback->FrameMove();
+
   if (m_processInfo)
     m_processInfo->SetPlayTimes(0, GetTime(), 0, GetTotalTime());
 }
@@ -625,7 +628,7 @@ void CRetroPlayer::CreatePlayback(const std::string& savestatePath)
   {
     m_playback->Deinitialize();
     m_playback = std::make_unique<CReversiblePlayback>(
-        m_gameClient.get(), *m_renderManager, m_cheevos.get(), *m_guiMessenger,
+        m_gameClient.get(), *m_renderManager, *m_streamManager, m_cheevos.get(), *m_guiMessenger,
         m_gameClient->GetFrameRate(), m_gameClient->GetSerializeSize());
   }
   else
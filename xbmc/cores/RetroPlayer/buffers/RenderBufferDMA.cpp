@@ -36,6 +36,7 @@ CRenderBufferDMA::CRenderBufferDMA(CRenderContext& context, int fourcc)
 
 CRenderBufferDMA::~CRenderBufferDMA()
 {
+  ReleaseMemory();
   DeleteTexture();
 }
 
@@ -46,7 +47,9 @@ bool CRenderBufferDMA::Allocate(AVPixelFormat format, unsigned int width, unsign
   m_width = width;
   m_height = height;
 
-  m_bo->CreateBufferObject(m_fourcc, m_width, m_height);
+  // On failure, the buffer pool falls back to the next renderer
+  if (!m_bo->CreateBufferObject(m_fourcc, m_width, m_height))
+    return false;
 
   return true;
 }
@@ -58,14 +61,23 @@ size_t CRenderBufferDMA::GetFrameSize() const
 
 uint8_t* CRenderBufferDMA::GetMemory()
 {
-  m_bo->SyncStart();
-  return m_bo->GetMemory();
+  if (m_memory == nullptr)
+  {
+    m_bo->SyncStart();
+    m_memory = m_bo->GetMemory();
+  }
+
+  return m_memory;
 }
 
 void CRenderBufferDMA::ReleaseMemory()
 {
+  if (m_memory == nullptr)
+    return;
+
   m_bo->ReleaseMemory();
   m_bo->SyncEnd();
+  m_memory = nullptr;
 }
 
 void CRenderBufferDMA::CreateTexture()
@@ -61,6 +61,9 @@ private:
 
   std::unique_ptr<CEGLImage> m_egl;
   std::unique_ptr<IBufferObject> m_bo;
+
+  // Mapped between GetMemory() and ReleaseMemory(), CPU access is synchronized for this time
+  uint8_t* m_memory = nullptr;
 };
 } // namespace RETRO
 } // namespace KODI
@@ -18,6 +18,7 @@
 #include "games/tags/GameInfoTag.h"
 #include "messaging/ApplicationMessenger.h"
 #include "utils/JSONVariantParser.h"
+#include "utils/JobManager.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
@@ -40,6 +41,9 @@ constexpr auto GENRE = "Genre";
 constexpr auto CONSOLE_NAME = "ConsoleName";
 
 constexpr int RESPONSE_SIZE = 64;
+
+// an unchanged rich presence is posted again after this interval to keep the session alive
+constexpr auto RICH_PRESENCE_INTERVAL = std::chrono::minutes(2);
 } // namespace
 
 CCheevos::CCheevos(GAME::CGameClient* gameClient,
@@ -158,19 +162,36 @@ std::string CCheevos::GetRichPresenceEvaluation()
   std::string evaluation;
   m_gameClient->Cheevos().RCGetRichPresenceEvaluation(evaluation, m_consoleID);
 
-  std::string url;
-  std::string postData;
-  if (m_gameClient->Cheevos().RCPostRichPresenceUrl(url, postData, m_userName, m_loginToken,
-                                                    m_gameID, evaluation))
-  {
-    XFILE::CCurlFile curl;
-    std::string res;
-    curl.Post(url, postData, res);
-  }
+  PostRichPresence(evaluation);
 
   return evaluation;
 }
 
+void CCheevos::PostRichPresence(const std::string& evaluation)
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (evaluation == m_postedRichPresence && now - m_richPresencePosted < RICH_PRESENCE_INTERVAL)
+    return;
+
+  std::string url;
+  std::string postData;
+  if (!m_gameClient->Cheevos().RCPostRichPresenceUrl(url, postData, m_userName, m_loginToken,
+                                                     m_gameID, evaluation))
+    return;
+
+  m_postedRichPresence = evaluation;
+  m_richPresencePosted = now;
+
+  // nothing depends on the answer, so the caller doesn't wait for the server
+  CServiceBroker::GetJobManager()->Submit(
+      [url = std::move(url), postData = std::move(postData)]()
+      {
+        XFILE::CCurlFile curl;
+        std::string res;
+        curl.Post(url, postData, res);
+      });
+}
+
 RConsoleID CCheevos::ConsoleID()
 {
   const std::string extension = URIUtils::GetExtension(m_gameClient->GetGamePath());
@@ -10,6 +10,7 @@
 
 #include "RConsoleIDs.h"
 
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -36,6 +37,7 @@ public:
 private:
   bool LoadData();
   RConsoleID ConsoleID();
+  void PostRichPresence(const std::string& evaluation);
 
   GAME::CGameClient* const m_gameClient;
   std::string m_userName;
@@ -45,6 +47,8 @@ private:
   uint32_t m_gameID{};
   RConsoleID m_consoleID = RConsoleID::RC_INVALID_ID;
   bool m_richPresenceLoaded{};
+  std::string m_postedRichPresence;
+  std::chrono::steady_clock::time_point m_richPresencePosted;
 
   const std::map<std::string, RConsoleID> m_extensionToConsole = {
       {".a26", RConsoleID::RC_CONSOLE_ATARI_2600},
@@ -18,6 +18,17 @@ using namespace std::chrono_literals;
 #define DEFAULT_FPS 60 // In case fps is 0 (shouldn't happen)
 #define FOREVER_MS (7 * 24 * 60 * 60 * 1000) // 1 week is large enough
 
+namespace
+{
+// Largest deviation from the nominal speed when synced to the display. Audio
+// is resampled by this factor, so it must stay inaudible.
+constexpr double MAX_DISPLAY_SPEED_ADJUST = 0.02;
+
+// Frames are run on the timer if no frame is presented for this many frames,
+// e.g. when the GUI stops rendering
+constexpr double PRESENT_TIMEOUT_FRAMES = 2.0;
+} // unnamed namespace
+
 CGameLoop::CGameLoop(IGameLoopCallback* callback, double fps)
   : CThread("GameLoop"), m_callback(callback), m_fps(fps ? fps : DEFAULT_FPS), m_speedFactor(0.0)
 {
@@ -37,6 +48,7 @@ void CGameLoop::Stop()
 {
   StopThread(false);
   m_sleepEvent.Set();
+  m_presentEvent.Set();
   StopThread(true);
 }
 
@@ -52,6 +64,14 @@ void CGameLoop::PauseAsync()
   SetSpeed(0.0);
 }
 
+void CGameLoop::PresentEvent(double refreshRate)
+{
+  m_refreshRate = refreshRate;
+  m_presentCount++;
+
+  m_presentEvent.Set();
+}
+
 void CGameLoop::Process(void)
 {
   while (!m_bStop)
@@ -68,6 +88,15 @@ void CGameLoop::Process(void)
       else if (m_speedFactor < 0.0)
         m_callback->RewindEvent();
 
+      if (m_speedFactor == 1.0 && WaitForDisplay())
+      {
+        m_lastFrameMs = 0.0;
+        continue;
+      }
+
+      m_bDisplaySynced = false;
+      m_displaySpeed = 1.0;
+
       if (m_lastFrameMs > 0.0)
       {
         m_lastFrameMs += FrameTimeMs();
@@ -122,6 +151,56 @@ double CGameLoop::SleepTimeMs() const
   return sleepTimeMs;
 }
 
+bool CGameLoop::WaitForDisplay()
+{
+  const double refreshRate = m_refreshRate;
+
+  // Number of refreshes that show a game frame
+  const double refreshesPerFrame = std::round(refreshRate / m_fps);
+  const double displaySpeed =
+      refreshesPerFrame >= 1.0 ? refreshRate / refreshesPerFrame / m_fps : 0.0;
+
+  if (std::abs(displaySpeed - 1.0) > MAX_DISPLAY_SPEED_ADJUST)
+    return false;
+
+  const unsigned int refreshes = static_cast<unsigned int>(refreshesPerFrame);
+
+  if (!m_bDisplaySynced)
+  {
+    // Stay on the timer until the display presents frames again
+    if (m_bPresentTimedOut && m_presentCount == m_syncedPresentCount)
+      return false;
+
+    m_bPresentTimedOut = false;
+    m_bDisplaySynced = true;
+    m_syncedPresentCount = m_presentCount;
+    m_displaySpeed = displaySpeed;
+  }
+
+  const auto timeout = std::chrono::milliseconds(
+      static_cast<unsigned int>(PRESENT_TIMEOUT_FRAMES * 1000.0 / m_fps));
+
+  while (m_presentCount - m_syncedPresentCount < refreshes)
+  {
+    if (!m_presentEvent.Wait(timeout) || m_bStop || m_speedFactor != 1.0)
+    {
+      m_bPresentTimedOut = m_presentCount == m_syncedPresentCount;
+      m_syncedPresentCount = m_presentCount;
+      return false;
+    }
+  }
+
+  m_syncedPresentCount += refreshes;
+
+  // Drop refreshes that were missed instead of running frames in a burst
+  if (m_presentCount - m_syncedPresentCount >= refreshes)
+    m_syncedPresentCount = m_presentCount;
+
+  m_displaySpeed = displaySpeed;
+
+  return true;
+}
+
 double CGameLoop::NowMs() const
 {
   return std::chrono::duration<double, std::milli>(
@@ -49,6 +49,25 @@ public:
   void SetSpeed(double speedFactor);
   void PauseAsync();
 
+  /*!
+   * \brief A frame was presented on the display, called by the render thread
+   *
+   * If the refresh rate is close to a multiple of the game's frame rate, frames
+   * are run on these events instead of on the timer. Every game frame is then
+   * shown for the same number of refreshes, and the game runs slightly faster
+   * or slower than its nominal speed.
+   *
+   * \param refreshRate The refresh rate of the display, or 0 to run frames on
+   *        the timer
+   */
+  void PresentEvent(double refreshRate);
+
+  /*!
+   * \brief The speed of the game relative to its nominal speed when it is
+   *        synced to the display, or 1.0 when it runs on the timer
+   */
+  double GetDisplaySpeed() const { return m_displaySpeed; }
+
 protected:
   // implementation of CThread
   void Process() override;
@@ -58,12 +77,28 @@ private:
   double SleepTimeMs() const;
   double NowMs() const;
 
+  /*!
+   * \brief Wait for the display to present the current frame
+   *
+   * \return False if frames should be run on the timer instead
+   */
+  bool WaitForDisplay();
+
   IGameLoopCallback* const m_callback;
   const double m_fps;
   std::atomic<double> m_speedFactor;
   double m_lastFrameMs = 0.0;
   mutable double m_adjustTime = 0.0;
   CEvent m_sleepEvent;
+
+  // Display sync
+  std::atomic<double> m_refreshRate{0.0};
+  std::atomic<unsigned int> m_presentCount{0};
+  std::atomic<double> m_displaySpeed{1.0};
+  CEvent m_presentEvent;
+  bool m_bDisplaySynced = false; // Only used by the game loop thread
+  bool m_bPresentTimedOut = false; // Only used by the game loop thread
+  unsigned int m_syncedPresentCount = 0; // Only used by the game loop thread
 };
 } // namespace RETRO
 } // namespace KODI
@@ -35,6 +35,7 @@ public:
   virtual double GetSpeed() const = 0;
   virtual void SetSpeed(double speedFactor) = 0;
   virtual void PauseAsync() = 0; // Pauses after the following frame
+  virtual void FrameMove() = 0; // Called by the render thread for every presented frame
 
   // Savestates
   virtual std::string CreateSavestate(
@@ -16,16 +16,23 @@
 #include "cores/RetroPlayer/rendering/RPRenderManager.h"
 #include "cores/RetroPlayer/savestates/ISavestate.h"
 #include "cores/RetroPlayer/savestates/SavestateDatabase.h"
-#include "cores/RetroPlayer/streams/memory/DeltaPairMemoryStream.h"
+#include "cores/RetroPlayer/streams/RPStreamManager.h"
+#include "cores/RetroPlayer/streams/memory/DeltaRunMemoryStream.h"
 #include "filesystem/File.h"
 #include "games/GameServices.h"
 #include "games/GameSettings.h"
 #include "games/addons/GameClient.h"
+#include "settings/Settings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/MathUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
+#include "windowing/GraphicContext.h"
+#include "windowing/WinSystem.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <memory>
 #include <mutex>
 
@@ -33,21 +40,40 @@ using namespace KODI;
 using namespace RETRO;
 
 #define REWIND_FACTOR 0.25 // Rewind at 25% of gameplay speed
+#define REWIND_MAX_MEMORY (256 * 1024 * 1024) // Memory limit of the rewind history in bytes
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// Longest time to wait for the game loop to serialize the game for a savestate
+constexpr auto SNAPSHOT_TIMEOUT = 500ms;
+
+// Run-ahead is turned off if running ahead takes more than this part of a frame on average,
+// measured over the frames after it was turned on
+constexpr double RUNAHEAD_MAX_LOAD = 0.75;
+constexpr unsigned int RUNAHEAD_PROBE_FRAMES = 120;
+} // unnamed namespace
 
 CReversiblePlayback::CReversiblePlayback(GAME::CGameClient* gameClient,
                                          CRPRenderManager& renderManager,
+                                         CRPStreamManager& streamManager,
                                          CCheevos* cheevos,
                                          CGUIGameMessenger& guiMessenger,
                                          double fps,
                                          size_t serializeSize)
   : m_gameClient(gameClient),
     m_renderManager(renderManager),
+    m_streamManager(streamManager),
     m_cheevos(cheevos),
     m_guiMessenger(guiMessenger),
     m_gameLoop(this, fps),
+    m_bSyncToDisplay(CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+        CSettings::SETTING_VIDEOPLAYER_USEDISPLAYASCLOCK)),
     m_savestateDatabase(new CSavestateDatabase)
 {
   UpdateMemoryStream();
+  UpdateRunAhead();
 
   GAME::CGameSettings& gameSettings = CServiceBroker::GetGameServices().GameSettings();
   gameSettings.RegisterObserver(this);
@@ -68,10 +94,14 @@ void CReversiblePlayback::Initialize()
 
 void CReversiblePlayback::Deinitialize()
 {
-  // Wait for autosave tasks
-  for (std::future<void>& task : m_savestateThreads)
-    task.wait();
-  m_savestateThreads.clear();
+  // Wait for the savestates that are still being written
+  std::future<void> savestateWorker;
+  {
+    std::unique_lock<CCriticalSection> lock(m_savestateMutex);
+    savestateWorker = std::move(m_savestateWorker);
+  }
+  if (savestateWorker.valid())
+    savestateWorker.wait();
 
   m_gameLoop.Stop();
 }
@@ -167,53 +197,103 @@ std::string CReversiblePlayback::CreateSavestate(bool autosave,
   // Capture the current video frame
   m_renderManager.CacheVideoFrame(savePath);
 
-  {
-    std::unique_lock<CCriticalSection> lock(m_savestateMutex);
-
-    // Prune any finished autosave threads
-    m_savestateThreads.erase(std::remove_if(m_savestateThreads.begin(), m_savestateThreads.end(),
-                                            [](std::future<void>& task) {
-                                              return task.wait_for(std::chrono::seconds(0)) ==
-                                                     std::future_status::ready;
-                                            }),
-                             m_savestateThreads.end());
-
-    // Save async to not block game loop
-    std::future<void> task =
-        std::async(std::launch::async, [this, autosave, savePath, nowUTC, timestampFrames]()
-                   { CommitSavestate(autosave, savePath, nowUTC, timestampFrames); });
+  // Only the memory is copied here, building and writing the savestate is left to the worker
+  std::unique_ptr<ISavestate> savestate = CSavestateDatabase::AllocateSavestate();
+  if (!SnapshotMemory(savestate->GetMemoryBuffer(memorySize), memorySize))
+    return "";
 
-    m_savestateThreads.emplace_back(std::move(task));
-  }
+  QueueSavestate({autosave, savePath, nowUTC, timestampFrames, std::move(savestate)});
 
   return savePath;
 }
 
-void CReversiblePlayback::CommitSavestate(bool autosave,
-                                          const std::string& savePath,
-                                          const CDateTime& nowUTC,
-                                          uint64_t timestampFrames)
+bool CReversiblePlayback::SnapshotMemory(uint8_t* data, size_t size)
 {
-  std::unique_ptr<ISavestate> savestate = CSavestateDatabase::AllocateSavestate();
-  std::unique_ptr<ISavestate> loadedSavestate;
-
-  const size_t memorySize = m_gameClient->SerializeSize();
-  uint8_t* const memoryData = savestate->GetMemoryBuffer(memorySize);
+  std::unique_lock<CCriticalSection> snapshotLock(m_snapshotMutex);
 
-  // Copy the savestate memory
+  bool waitForGameLoop = false;
   {
     std::unique_lock<CCriticalSection> lock(m_mutex);
     if (m_memoryStream && m_memoryStream->CurrentFrame() != nullptr)
     {
-      std::memcpy(memoryData, m_memoryStream->CurrentFrame(), memorySize);
+      std::memcpy(data, m_memoryStream->CurrentFrame(), size);
+      return true;
     }
-    else
+
+    // Without rewind buffer the game client has to be serialized. This must not happen while
+    // the game loop runs a frame, so while playing let the game loop do it after its next frame.
+    if (m_gameLoop.GetSpeed() != 0.0)
     {
-      lock.unlock();
-      if (!m_gameClient->Serialize(memoryData, memorySize))
+      m_snapshotBuffer = data;
+      m_snapshotSize = size;
+      m_snapshotDone.Reset();
+      waitForGameLoop = true;
+    }
+  }
+
+  if (waitForGameLoop)
+  {
+    m_snapshotDone.Wait(SNAPSHOT_TIMEOUT);
+
+    std::unique_lock<CCriticalSection> lock(m_mutex);
+    if (m_snapshotBuffer == nullptr)
+      return m_snapshotResult;
+
+    // The game loop stopped in the meantime
+    m_snapshotBuffer = nullptr;
+  }
+
+  return m_gameClient->Serialize(data, size);
+}
+
+void CReversiblePlayback::QueueSavestate(SavestateJob job)
+{
+  std::unique_lock<CCriticalSection> lock(m_savestateMutex);
+
+  // A newer autosave to the same slot replaces one that is still waiting to be written
+  auto it = std::find_if(m_pendingSavestates.begin(), m_pendingSavestates.end(),
+                         [&job](const SavestateJob& pending)
+                         { return pending.autosave && pending.savePath == job.savePath; });
+  if (job.autosave && it != m_pendingSavestates.end())
+    *it = std::move(job);
+  else
+    m_pendingSavestates.emplace_back(std::move(job));
+
+  // Save async to not block game loop. Savestates are written one after the other, so two of
+  // them never write the same slot at the same time.
+  if (!m_savestateWorkerRunning)
+  {
+    m_savestateWorkerRunning = true;
+    m_savestateWorker = std::async(std::launch::async, [this]() { ProcessSavestates(); });
+  }
+}
+
+void CReversiblePlayback::ProcessSavestates()
+{
+  while (true)
+  {
+    SavestateJob job;
+    {
+      std::unique_lock<CCriticalSection> lock(m_savestateMutex);
+      if (m_pendingSavestates.empty())
+      {
+        m_savestateWorkerRunning = false;
         return;
+      }
+
+      job = std::move(m_pendingSavestates.front());
+      m_pendingSavestates.pop_front();
     }
+
+    CommitSavestate(job);
   }
+}
+
+void CReversiblePlayback::CommitSavestate(SavestateJob& job)
+{
+  ISavestate& savestate = *job.savestate;
+  const std::string& savePath = job.savePath;
+  std::unique_ptr<ISavestate> loadedSavestate;
 
   // Attempt to get existing properties
   {
@@ -229,29 +309,29 @@ void CReversiblePlayback::CommitSavestate(bool autosave,
   const std::string caption = m_cheevos->GetRichPresenceEvaluation();
   const std::string gameFileName = URIUtils::GetFileName(m_gameClient->GetGamePath());
   const double timestampWallClock =
-      (timestampFrames /
+      (job.timestampFrames /
        m_gameClient->GetFrameRate()); //! @todo Accumulate playtime instead of deriving it
   const std::string gameClientId = m_gameClient->ID();
   const std::string gameClientVersion = m_gameClient->Version().asString();
 
-  savestate->SetType(autosave ? SAVE_TYPE::AUTO : SAVE_TYPE::MANUAL);
-  savestate->SetLabel(loadedSavestate ? loadedSavestate->Label() : "");
-  savestate->SetCaption(caption);
-  savestate->SetCreated(nowUTC);
-  savestate->SetGameFileName(gameFileName);
-  savestate->SetTimestampFrames(timestampFrames);
-  savestate->SetTimestampWallClock(timestampWallClock);
-  savestate->SetGameClientID(gameClientId);
-  savestate->SetGameClientVersion(gameClientVersion);
+  savestate.SetType(job.autosave ? SAVE_TYPE::AUTO : SAVE_TYPE::MANUAL);
+  savestate.SetLabel(loadedSavestate ? loadedSavestate->Label() : "");
+  savestate.SetCaption(caption);
+  savestate.SetCreated(job.nowUTC);
+  savestate.SetGameFileName(gameFileName);
+  savestate.SetTimestampFrames(job.timestampFrames);
+  savestate.SetTimestampWallClock(timestampWallClock);
+  savestate.SetGameClientID(gameClientId);
+  savestate.SetGameClientVersion(gameClientVersion);
 
-  m_renderManager.SaveVideoFrame(savePath, *savestate);
+  m_renderManager.SaveVideoFrame(savePath, savestate);
 
-  savestate->Finalize();
+  savestate.Finalize();
 
   bool success;
   {
     std::unique_lock<CCriticalSection> lock(m_savestateMutex);
-    success = m_savestateDatabase->AddSavestate(savePath, m_gameClient->GetGamePath(), *savestate);
+    success = m_savestateDatabase->AddSavestate(savePath, m_gameClient->GetGamePath(), savestate);
   }
 
   if (success)
@@ -261,7 +341,7 @@ void CReversiblePlayback::CommitSavestate(bool autosave,
   }
 
   // Notify the GUI that the metadata for this savestate should be refreshed
-  m_guiMessenger.RefreshSavestates(savePath, savestate.get());
+  m_guiMessenger.RefreshSavestates(savePath, &savestate);
 }
 
 bool CReversiblePlayback::LoadSavestate(const std::string& savestatePath)
@@ -309,13 +389,88 @@ bool CReversiblePlayback::LoadSavestate(const std::string& savestatePath)
   return bSuccess;
 }
 
+void CReversiblePlayback::FrameMove()
+{
+  double refreshRate = 0.0;
+
+  if (m_bSyncToDisplay)
+  {
+    CWinSystemBase* winSystem = CServiceBroker::GetWinSystem();
+    if (winSystem != nullptr)
+      refreshRate = winSystem->GetGfxContext().GetFPS();
+  }
+
+  m_gameLoop.PresentEvent(refreshRate);
+}
+
 void CReversiblePlayback::FrameEvent()
 {
+  UpdateAudioSpeed();
+
+  const unsigned int runAheadFrames = m_runAheadFrames;
+  if (runAheadFrames > 0 && m_gameLoop.GetSpeed() == 1.0)
+  {
+    RunAhead(runAheadFrames);
+    return;
+  }
+
   m_gameClient->RunFrame();
 
   AddFrame();
 }
 
+void CReversiblePlayback::RunAhead(unsigned int frames)
+{
+  const auto start = std::chrono::steady_clock::now();
+
+  if (m_runAheadMeasuredFrames != frames)
+  {
+    m_runAheadMeasuredFrames = frames;
+    m_runAheadTicks = 0;
+    m_runAheadAverageSecs = 0.0;
+  }
+
+  m_runAheadState.resize(m_gameClient->SerializeSize());
+
+  // The frame that advances the game, only its video is replaced
+  m_streamManager.SuppressVideo(true);
+  m_gameClient->RunFrame();
+  AddFrame();
+
+  if (!m_gameClient->Serialize(m_runAheadState.data(), m_runAheadState.size()))
+  {
+    CLog::Log(LOGERROR, "RetroPlayer[PLAYBACK]: Failed to serialize game, disabling run-ahead");
+    m_streamManager.SuppressVideo(false);
+    m_runAheadFrames = 0;
+    return;
+  }
+
+  m_streamManager.SuppressAudio(true);
+  for (unsigned int i = 1; i < frames; i++)
+    m_gameClient->RunFrame();
+  m_streamManager.SuppressVideo(false);
+  m_gameClient->RunFrame();
+  m_streamManager.SuppressAudio(false);
+
+  m_gameClient->Deserialize(m_runAheadState.data(), m_runAheadState.size());
+
+  // Turn run-ahead off for game clients that can't keep up with it
+  const double secs =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  m_runAheadTicks++;
+  m_runAheadAverageSecs += (secs - m_runAheadAverageSecs) / m_runAheadTicks;
+
+  if (m_runAheadTicks == RUNAHEAD_PROBE_FRAMES &&
+      m_runAheadAverageSecs > RUNAHEAD_MAX_LOAD / m_gameLoop.FPS())
+  {
+    CLog::Log(LOGWARNING,
+              "RetroPlayer[PLAYBACK]: Running {} frames ahead takes {:.1f} ms, disabling run-ahead",
+              frames, m_runAheadAverageSecs * 1000.0);
+    m_runAheadMeasuredFrames = 0;
+    m_runAheadFrames = 0;
+  }
+}
+
 void CReversiblePlayback::RewindEvent()
 {
   RewindFrames(1);
@@ -336,6 +491,14 @@ void CReversiblePlayback::AddFrame()
     }
   }
 
+  // Serialize for a savestate that is waiting for the frame to finish
+  if (m_snapshotBuffer != nullptr)
+  {
+    m_snapshotResult = m_gameClient->Serialize(m_snapshotBuffer, m_snapshotSize);
+    m_snapshotBuffer = nullptr;
+    m_snapshotDone.Set();
+  }
+
   m_totalFrameCount++;
 }
 
@@ -387,12 +550,34 @@ void CReversiblePlayback::Notify(const Observable& obs, const ObservableMessage
   {
     case ObservableMessageSettingsChanged:
       UpdateMemoryStream();
+      UpdateRunAhead();
       break;
     default:
       break;
   }
 }
 
+void CReversiblePlayback::UpdateAudioSpeed()
+{
+  const double audioSpeed = m_gameLoop.GetDisplaySpeed();
+  if (audioSpeed != m_audioSpeed)
+  {
+    CLog::Log(LOGDEBUG, "RetroPlayer[PLAYBACK]: Resampling audio for {:.4f}x speed", audioSpeed);
+    m_streamManager.SetAudioSpeed(audioSpeed);
+    m_audioSpeed = audioSpeed;
+  }
+}
+
+void CReversiblePlayback::UpdateRunAhead()
+{
+  unsigned int runAheadFrames = 0;
+
+  if (m_gameClient->SerializeSize() > 0)
+    runAheadFrames = CServiceBroker::GetGameServices().GameSettings().RunAheadFrames();
+
+  m_runAheadFrames = runAheadFrames;
+}
+
 void CReversiblePlayback::UpdateMemoryStream()
 {
   std::unique_lock<CCriticalSection> lock(m_mutex);
@@ -414,7 +599,7 @@ void CReversiblePlayback::UpdateMemoryStream()
 
     if (!m_memoryStream)
     {
-      m_memoryStream = std::make_unique<CDeltaPairMemoryStream>();
+      m_memoryStream = std::make_unique<CDeltaRunMemoryStream>(REWIND_MAX_MEMORY);
       m_memoryStream->Init(m_gameClient->SerializeSize(), frameCount);
     }
 
@@ -10,16 +10,20 @@
 
 #include "GameLoop.h"
 #include "IPlayback.h"
+#include "XBDateTime.h"
 #include "threads/CriticalSection.h"
+#include "threads/Event.h"
 #include "utils/Observer.h"
 
+#include <atomic>
+#include <deque>
 #include <future>
 #include <memory>
+#include <string>
+#include <vector>
 #include <stddef.h>
 #include <stdint.h>
 
-class CDateTime;
-
 namespace KODI
 {
 namespace GAME
@@ -32,14 +36,17 @@ namespace RETRO
 class CCheevos;
 class CGUIGameMessenger;
 class CRPRenderManager;
+class CRPStreamManager;
 class CSavestateDatabase;
 class IMemoryStream;
+class ISavestate;
 
 class CReversiblePlayback : public IPlayback, public IGameLoopCallback, public Observer
 {
 public:
   CReversiblePlayback(GAME::CGameClient* gameClient,
                       CRPRenderManager& renderManager,
+                      CRPStreamManager& streamManager,
                       CCheevos* cheevos,
                       CGUIGameMessenger& guiMessenger,
                       double fps,
@@ -59,6 +66,7 @@ public:
   double GetSpeed() const override;
   void SetSpeed(double speedFactor) override;
   void PauseAsync() override;
+  void FrameMove() override;
   std::string CreateSavestate(bool autosave, const std::string& savestatePath = "") override;
   bool LoadSavestate(const std::string& savestatePath) override;
 
@@ -75,14 +83,46 @@ private:
   void AdvanceFrames(uint64_t frames);
   void UpdatePlaybackStats();
   void UpdateMemoryStream();
-  void CommitSavestate(bool autosave,
-                       const std::string& savePath,
-                       const CDateTime& nowUTC,
-                       uint64_t timestampFrames);
+  void UpdateRunAhead();
+  void UpdateAudioSpeed();
+
+  /*!
+   * \brief Run a frame, then run the given number of frames ahead and present
+   *        the last of them, and return to the state after the first frame
+   *
+   * Only the audio of the first frame is played, so the sound stays in sync
+   * with the game. Input shows up on screen the given number of frames
+   * earlier than the game client would show it.
+   */
+  void RunAhead(unsigned int frames);
+
+  /*!
+   * \brief A savestate whose memory has been copied, waiting to be written
+   */
+  struct SavestateJob
+  {
+    bool autosave = false;
+    std::string savePath;
+    CDateTime nowUTC;
+    uint64_t timestampFrames = 0;
+    std::unique_ptr<ISavestate> savestate;
+  };
+
+  /*!
+   * \brief Copy the memory of the game client without racing the game loop
+   *
+   * The copy is taken from the rewind buffer if there is one. Otherwise the
+   * game loop thread serializes the game client after its next frame.
+   */
+  bool SnapshotMemory(uint8_t* data, size_t size);
+  void QueueSavestate(SavestateJob job);
+  void ProcessSavestates();
+  void CommitSavestate(SavestateJob& job);
 
   // Construction parameter
   GAME::CGameClient* const m_gameClient;
   CRPRenderManager& m_renderManager;
+  CRPStreamManager& m_streamManager;
   CCheevos* const m_cheevos;
   CGUIGameMessenger& m_guiMessenger;
 
@@ -91,12 +131,32 @@ private:
   std::unique_ptr<IMemoryStream> m_memoryStream;
   CCriticalSection m_mutex;
 
+  // Display sync functionality
+  const bool m_bSyncToDisplay;
+  double m_audioSpeed = 1.0; // Only used by the game loop thread
+
+  // Run-ahead functionality
+  std::atomic<unsigned int> m_runAheadFrames{0};
+  std::vector<uint8_t> m_runAheadState; // Only used by the game loop thread
+  unsigned int m_runAheadMeasuredFrames = 0;
+  unsigned int m_runAheadTicks = 0;
+  double m_runAheadAverageSecs = 0.0;
+
   // Savestate functionality
   std::unique_ptr<CSavestateDatabase> m_savestateDatabase;
   std::string m_autosavePath{};
-  std::vector<std::future<void>> m_savestateThreads;
+  std::deque<SavestateJob> m_pendingSavestates;
+  bool m_savestateWorkerRunning = false;
+  std::future<void> m_savestateWorker;
   CCriticalSection m_savestateMutex;
 
+  // Memory snapshot requested from the game loop thread, guarded by m_mutex
+  CCriticalSection m_snapshotMutex;
+  uint8_t* m_snapshotBuffer = nullptr;
+  size_t m_snapshotSize = 0;
+  bool m_snapshotResult = false;
+  CEvent m_snapshotDone;
+
   // Playback stats
   uint64_t m_totalFrameCount = 0;
   uint64_t m_pastFrameCount = 0;
@@ -85,7 +85,10 @@ void CRPRenderManager::Deinitialize()
   m_renderBuffers.clear();
 
   for (auto buffer : m_pendingBuffers)
+  {
+    buffer->ReleaseMemory();
     buffer->Release();
+  }
   m_pendingBuffers.clear();
 
   for (auto& [savestatePath, renderBuffers] : m_savestateBuffers)
@@ -132,7 +135,10 @@ bool CRPRenderManager::GetVideoBuffer(unsigned int width,
 {
   // Clear any previous pending buffers
   for (IRenderBuffer* buffer : m_pendingBuffers)
+  {
+    buffer->ReleaseMemory();
     buffer->Release();
+  }
   m_pendingBuffers.clear();
 
   if (m_bFlush || m_state != RENDER_STATE::CONFIGURED)
@@ -144,23 +150,37 @@ bool CRPRenderManager::GetVideoBuffer(unsigned int width,
 
   auto bufferPools = m_processInfo.GetBufferManager().GetBufferPools();
 
-  std::sort(bufferPools.begin(), bufferPools.end(),
-            [](const IRenderBufferPool* lhs, const IRenderBufferPool* rhs)
-            {
-              // Prefer buffer pools with a visible renderer
-              if (lhs->HasVisibleRenderer() && !rhs->HasVisibleRenderer())
-                return true;
-              if (!lhs->HasVisibleRenderer() && rhs->HasVisibleRenderer())
-                return false;
+  // Keep the registration order otherwise, windowing systems register the pools that the GPU
+  // can import without a copy (e.g. DMA) first
+  std::stable_sort(bufferPools.begin(), bufferPools.end(),
+                   [](const IRenderBufferPool* lhs, const IRenderBufferPool* rhs)
+                   {
+                     // Prefer buffer pools with a visible renderer
+                     if (lhs->HasVisibleRenderer() && !rhs->HasVisibleRenderer())
+                       return true;
+                     if (!lhs->HasVisibleRenderer() && rhs->HasVisibleRenderer())
+                       return false;
+
+                     //! @todo De-prioritize buffer pools with write-only or unaligned memory
 
-              //! @todo De-prioritize buffer pools with write-only or unaligned memory
+                     return false;
+                   });
 
-              return false;
-            });
+  // The game API has no stride, so the game add-on can only render into buffers without padding
+  const size_t frameSize =
+      static_cast<size_t>(CRenderTranslator::TranslateWidthToBytes(width, m_format)) * height;
 
   for (IRenderBufferPool* bufferPool : bufferPools)
   {
     renderBuffer = bufferPool->GetBuffer(width, height);
+    if (renderBuffer != nullptr && renderBuffer->GetFrameSize() != frameSize)
+    {
+      CLog::Log(LOGDEBUG, "RetroPlayer[RENDER]: Video buffer has padded rows, skipping it");
+      renderBuffer->Release();
+      renderBuffer = nullptr;
+      continue;
+    }
+
     if (renderBuffer != nullptr)
       break;
     else
@@ -200,6 +220,8 @@ void CRPRenderManager::AddFrame(const uint8_t* data,
   {
     if (buffer->GetMemory() == data)
     {
+      // End CPU access, so that the renderer sees the frame written by the game add-on
+      buffer->ReleaseMemory();
       buffer->Acquire();
       renderBuffers.emplace_back(buffer);
     }
@@ -26,6 +26,24 @@ void CRPStreamManager::EnableAudio(bool bEnable)
     m_audioStream->Enable(bEnable);
 }
 
+void CRPStreamManager::SuppressAudio(bool bSuppress)
+{
+  if (m_audioStream != nullptr)
+    m_audioStream->Suppress(bSuppress);
+}
+
+void CRPStreamManager::SetAudioSpeed(double speed)
+{
+  if (m_audioStream != nullptr)
+    m_audioStream->SetSpeed(speed);
+}
+
+void CRPStreamManager::SuppressVideo(bool bSuppress)
+{
+  if (m_videoStream != nullptr)
+    m_videoStream->Suppress(bSuppress);
+}
+
 StreamPtr CRPStreamManager::CreateStream(StreamType streamType)
 {
   switch (streamType)
@@ -40,7 +58,10 @@ StreamPtr CRPStreamManager::CreateStream(StreamType streamType)
     case StreamType::VIDEO:
     case StreamType::SW_BUFFER:
     {
-      return StreamPtr(new CRetroPlayerVideo(m_renderManager, m_processInfo));
+      // Save pointer to video stream
+      m_videoStream = new CRetroPlayerVideo(m_renderManager, m_processInfo);
+
+      return StreamPtr(m_videoStream);
     }
     case StreamType::HW_BUFFER:
     {
@@ -59,6 +80,8 @@ void CRPStreamManager::CloseStream(StreamPtr stream)
   {
     if (stream.get() == m_audioStream)
       m_audioStream = nullptr;
+    else if (stream.get() == m_videoStream)
+      m_videoStream = nullptr;
 
     stream->CloseStream();
   }
@@ -15,6 +15,7 @@ namespace KODI
 namespace RETRO
 {
 class CRetroPlayerAudio;
+class CRetroPlayerVideo;
 class CRPProcessInfo;
 class CRPRenderManager;
 
@@ -26,6 +27,17 @@ public:
 
   void EnableAudio(bool bEnable);
 
+  /*!
+   * \brief Drop the output of frames that are run but not presented
+   */
+  void SuppressAudio(bool bSuppress);
+  void SuppressVideo(bool bSuppress);
+
+  /*!
+   * \brief Resample audio for a game that runs at the given speed
+   */
+  void SetAudioSpeed(double speed);
+
   // Implementation of IStreamManager
   StreamPtr CreateStream(StreamType streamType) override;
   void CloseStream(StreamPtr stream) override;
@@ -37,6 +49,7 @@ private:
 
   // Stream parameters
   CRetroPlayerAudio* m_audioStream = nullptr;
+  CRetroPlayerVideo* m_videoStream = nullptr;
 };
 } // namespace RETRO
 } // namespace KODI
@@ -12,9 +12,12 @@
 #include "cores/AudioEngine/Interfaces/AE.h"
 #include "cores/AudioEngine/Interfaces/AEStream.h"
 #include "cores/AudioEngine/Utils/AEChannelInfo.h"
+#include "cores/AudioEngine/Utils/AEStreamData.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
 #include "cores/RetroPlayer/audio/AudioTranslator.h"
 #include "cores/RetroPlayer/process/RPProcessInfo.h"
+#include "settings/Settings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/log.h"
 
 #include <cmath>
@@ -89,7 +92,13 @@ bool CRetroPlayerAudio::OpenStream(const StreamProperties& properties)
   audioFormat.m_dataFormat = pcmFormat;
   audioFormat.m_sampleRate = iSampleRate;
   audioFormat.m_channelLayout = channelLayout;
-  m_pAudioStream = audioEngine->MakeStream(audioFormat);
+  // The resampler is needed to follow the speed of a game that is synced to the display
+  unsigned int options = 0;
+  if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+          CSettings::SETTING_VIDEOPLAYER_USEDISPLAYASCLOCK))
+    options |= AESTREAM_FORCE_RESAMPLE;
+
+  m_pAudioStream = audioEngine->MakeStream(audioFormat, options);
 
   if (m_pAudioStream == nullptr)
   {
@@ -108,7 +117,7 @@ void CRetroPlayerAudio::AddStreamData(const StreamPacket& packet)
 {
   const AudioStreamPacket& audioPacket = static_cast<const AudioStreamPacket&>(packet);
 
-  if (m_bAudioEnabled)
+  if (m_bAudioEnabled && !m_bSuppressed)
   {
     if (m_pAudioStream)
     {
@@ -131,6 +140,12 @@ void CRetroPlayerAudio::AddStreamData(const StreamPacket& packet)
   }
 }
 
+void CRetroPlayerAudio::SetSpeed(double speed)
+{
+  if (m_pAudioStream && speed > 0.0)
+    m_pAudioStream->SetResampleRatio(1.0 / speed);
+}
+
 void CRetroPlayerAudio::CloseStream()
 {
   if (m_pAudioStream)
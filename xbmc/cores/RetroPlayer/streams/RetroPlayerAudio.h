@@ -49,6 +49,17 @@ public:
 
   void Enable(bool bEnabled) { m_bAudioEnabled = bEnabled; }
 
+  /*!
+   * \brief Drop audio of frames that are run ahead and not played
+   */
+  void Suppress(bool bSuppressed) { m_bSuppressed = bSuppressed; }
+
+  /*!
+   * \brief Resample audio for a game that runs at the given speed, e.g. when
+   *        it's synced to the display
+   */
+  void SetSpeed(double speed);
+
   // implementation of IRetroPlayerStream
   bool OpenStream(const StreamProperties& properties) override;
   bool GetStreamBuffer(unsigned int width, unsigned int height, StreamBuffer& buffer) override
@@ -62,6 +73,7 @@ private:
   CRPProcessInfo& m_processInfo;
   IAE::StreamPtr m_pAudioStream;
   bool m_bAudioEnabled = true;
+  bool m_bSuppressed = false;
 };
 } // namespace RETRO
 } // namespace KODI
@@ -71,7 +71,8 @@ bool CRetroPlayerVideo::GetStreamBuffer(unsigned int width,
 {
   VideoStreamBuffer& videoBuffer = static_cast<VideoStreamBuffer&>(buffer);
 
-  if (m_bOpen)
+  // A suppressed frame is rendered into the game client's own memory
+  if (m_bOpen && !m_bSuppressed)
     return m_renderManager.GetVideoBuffer(width, height, videoBuffer);
 
   return false;
@@ -81,7 +82,7 @@ void CRetroPlayerVideo::AddStreamData(const StreamPacket& packet)
 {
   const VideoStreamPacket& videoPacket = static_cast<const VideoStreamPacket&>(packet);
 
-  if (m_bOpen)
+  if (m_bOpen && !m_bSuppressed)
   {
     unsigned int orientationDegCCW = 0;
     switch (videoPacket.rotation)
@@ -94,6 +94,11 @@ public:
   CRetroPlayerVideo(CRPRenderManager& m_renderManager, CRPProcessInfo& m_processInfo);
   ~CRetroPlayerVideo() override;
 
+  /*!
+   * \brief Drop video of frames that are not shown, e.g. when running ahead
+   */
+  void Suppress(bool bSuppressed) { m_bSuppressed = bSuppressed; }
+
   // implementation of IRetroPlayerStream
   bool OpenStream(const StreamProperties& properties) override;
   bool GetStreamBuffer(unsigned int width, unsigned int height, StreamBuffer& buffer) override;
@@ -107,6 +112,7 @@ private:
 
   // Stream properties
   bool m_bOpen = false;
+  bool m_bSuppressed = false;
 };
 } // namespace RETRO
 } // namespace KODI
@@ -0,0 +1,160 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DeltaRunMemoryStream.h"
+
+#include "utils/log.h"
+
+using namespace KODI;
+using namespace RETRO;
+
+namespace
+{
+// Unchanged memory is skipped a cache line at a time
+constexpr size_t BLOCK_WORDS = 16;
+
+bool BlockEqual(const uint32_t* a, const uint32_t* b)
+{
+  // Fixed length and no early exit, so that the compiler can vectorize it
+  uint32_t diff = 0;
+  for (size_t i = 0; i < BLOCK_WORDS; i++)
+    diff |= a[i] ^ b[i];
+  return diff == 0;
+}
+} // unnamed namespace
+
+CDeltaRunMemoryStream::CDeltaRunMemoryStream(size_t maxBytes) : m_maxBytes(maxBytes)
+{
+}
+
+void CDeltaRunMemoryStream::Reset()
+{
+  CLinearMemoryStream::Reset();
+
+  m_rewindBuffer.clear();
+  m_bufferBytes = 0;
+  m_encodeBuffer.clear();
+  m_encodeBuffer.shrink_to_fit();
+}
+
+void CDeltaRunMemoryStream::SubmitFrameInternal()
+{
+  const uint32_t* currentFrame = m_currentFrame.get();
+  const uint32_t* nextFrame = m_nextFrame.get();
+  const size_t wordCount = m_paddedFrameSize / sizeof(uint32_t);
+
+  m_encodeBuffer.clear();
+
+  size_t i = 0;
+  while (i < wordCount)
+  {
+    const size_t skipStart = i;
+    while (i + BLOCK_WORDS <= wordCount && BlockEqual(currentFrame + i, nextFrame + i))
+      i += BLOCK_WORDS;
+    while (i < wordCount && currentFrame[i] == nextFrame[i])
+      i++;
+
+    if (i == wordCount)
+      break;
+
+    // A single unchanged word costs less inside a run than starting a new run
+    const size_t changedStart = i;
+    while (i < wordCount &&
+           (currentFrame[i] != nextFrame[i] ||
+            (i + 1 < wordCount && currentFrame[i + 1] != nextFrame[i + 1])))
+      i++;
+
+    m_encodeBuffer.push_back(static_cast<uint32_t>(changedStart - skipStart));
+    m_encodeBuffer.push_back(static_cast<uint32_t>(i - changedStart));
+    for (size_t j = changedStart; j < i; j++)
+      m_encodeBuffer.push_back(currentFrame[j] ^ nextFrame[j]);
+  }
+
+  m_rewindBuffer.emplace_back();
+  MemoryFrame& frame = m_rewindBuffer.back();
+  frame.runs.assign(m_encodeBuffer.begin(), m_encodeBuffer.end());
+
+  // Record frame history
+  frame.frameHistoryCount = m_currentFrameHistory++;
+
+  m_bufferBytes += FrameBytes(frame);
+
+  // Delta is generated, bring the new frame forward (m_nextFrame is now disposable)
+  std::swap(m_currentFrame, m_nextFrame);
+
+  m_bHasNextFrame = false;
+
+  if (PastFramesAvailable() + 1 > MaxFrameCount())
+    CullPastFrames(1);
+
+  while (m_maxBytes > 0 && m_bufferBytes > m_maxBytes && m_rewindBuffer.size() > 1)
+    CullPastFrames(1);
+}
+
+uint64_t CDeltaRunMemoryStream::PastFramesAvailable() const
+{
+  return static_cast<uint64_t>(m_rewindBuffer.size());
+}
+
+uint64_t CDeltaRunMemoryStream::RewindFrames(uint64_t frameCount)
+{
+  uint64_t rewound;
+
+  for (rewound = 0; rewound < frameCount; rewound++)
+  {
+    if (m_rewindBuffer.empty())
+      break;
+
+    const MemoryFrame& frame = m_rewindBuffer.back();
+    const uint32_t* run = frame.runs.data();
+    const uint32_t* const end = run + frame.runs.size();
+
+    uint32_t* currentFrame = m_currentFrame.get();
+    while (run < end)
+    {
+      currentFrame += run[0];
+      const uint32_t changedCount = run[1];
+      run += 2;
+
+      for (uint32_t i = 0; i < changedCount; i++)
+        currentFrame[i] ^= run[i];
+
+      currentFrame += changedCount;
+      run += changedCount;
+    }
+
+    // Restore frame history
+    m_currentFrameHistory = frame.frameHistoryCount;
+
+    m_bufferBytes -= FrameBytes(frame);
+    m_rewindBuffer.pop_back();
+  }
+
+  return rewound;
+}
+
+void CDeltaRunMemoryStream::CullPastFrames(uint64_t frameCount)
+{
+  for (uint64_t removedCount = 0; removedCount < frameCount; removedCount++)
+  {
+    if (m_rewindBuffer.empty())
+    {
+      CLog::Log(LOGDEBUG,
+                "CDeltaRunMemoryStream: Tried to cull {} frames too many. Check your math!",
+                frameCount - removedCount);
+      break;
+    }
+    m_bufferBytes -= FrameBytes(m_rewindBuffer.front());
+    m_rewindBuffer.pop_front();
+  }
+}
+
+size_t CDeltaRunMemoryStream::FrameBytes(const MemoryFrame& frame)
+{
+  return sizeof(MemoryFrame) + frame.runs.capacity() * sizeof(uint32_t);
+}
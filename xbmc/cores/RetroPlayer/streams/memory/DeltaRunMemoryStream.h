@@ -0,0 +1,70 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "LinearMemoryStream.h"
+
+#include <deque>
+#include <vector>
+
+namespace KODI
+{
+namespace RETRO
+{
+/*!
+ * \brief Implementation of a linear memory stream using run-length encoded
+ *        XOR deltas, limited by frame count and memory use
+ */
+class CDeltaRunMemoryStream : public CLinearMemoryStream
+{
+public:
+  /*!
+   * \param maxBytes The memory the past frames may use, or 0 for no limit
+   */
+  explicit CDeltaRunMemoryStream(size_t maxBytes = 0);
+
+  ~CDeltaRunMemoryStream() override = default;
+
+  // implementation of IMemoryStream via CLinearMemoryStream
+  void Reset() override;
+  uint64_t PastFramesAvailable() const override;
+  uint64_t RewindFrames(uint64_t frameCount) override;
+
+protected:
+  // implementation of CLinearMemoryStream
+  void SubmitFrameInternal() override;
+  void CullPastFrames(uint64_t frameCount) override;
+
+  /*!
+   * Like CDeltaPairMemoryStream, a past frame is stored as the XOR delta to
+   * the frame following it. Instead of a position for every changed word, the
+   * delta is stored as runs: the number of unchanged words to skip, the number
+   * of changed words and the XOR values of these words. Save states change in
+   * few contiguous areas, so the runs are much smaller than position/value
+   * pairs, and applying a run is a linear loop over contiguous memory.
+   */
+  struct MemoryFrame
+  {
+    std::vector<uint32_t> runs;
+    uint64_t frameHistoryCount;
+  };
+
+  std::deque<MemoryFrame> m_rewindBuffer;
+
+private:
+  static size_t FrameBytes(const MemoryFrame& frame);
+
+  const size_t m_maxBytes;
+  size_t m_bufferBytes = 0;
+
+  // Reused while encoding, so encoding a frame allocates only what it stores
+  std::vector<uint32_t> m_encodeBuffer;
+};
+} // namespace RETRO
+} // namespace KODI
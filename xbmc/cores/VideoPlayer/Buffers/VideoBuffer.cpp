@@ -292,6 +292,11 @@ CVideoBufferPoolSysMem::~CVideoBufferPoolSysMem()
 {
   std::unique_lock<CCriticalSection> lock(m_critSection);
 
+  if (m_gets > 0)
+    CLog::Log(LOGDEBUG,
+              "CVideoBufferPoolSysMem - {} buffers of {} bytes, {} of {} requests served by reuse",
+              m_all.size(), m_size, m_reuses, m_gets);
+
   for (auto buf : m_all)
   {
     delete buf;
@@ -303,12 +308,22 @@ CVideoBuffer* CVideoBufferPoolSysMem::Get()
   std::unique_lock<CCriticalSection> lock(m_critSection);
 
   CVideoBufferSysMem *buf = nullptr;
+  m_gets++;
   if (!m_free.empty())
   {
     int idx = m_free.front();
     m_free.pop_front();
     m_used.push_back(idx);
     buf = m_all[idx];
+    m_reuses++;
+  }
+  else if (m_all.size() >= MAX_BUFFERS)
+  {
+    if (!m_capReported)
+      CLog::Log(LOGERROR, "CVideoBufferPoolSysMem - all {} buffers of {} bytes are in use",
+                m_all.size(), m_size);
+    m_capReported = true;
+    return nullptr;
   }
   else
   {
@@ -361,7 +376,7 @@ inline bool CVideoBufferPoolSysMem::IsConfigured()
 bool CVideoBufferPoolSysMem::IsCompatible(AVPixelFormat format, int size)
 {
   if (m_pixFormat == format &&
-      m_size == size)
+      size <= m_size && size > m_size / 2)
     return true;
 
   return false;
@@ -410,6 +425,7 @@ void CVideoBufferManager::ReleasePools()
   std::unique_lock<CCriticalSection> lock(m_critSection);
   std::list<std::shared_ptr<IVideoBufferPool>> pools = m_pools;
   m_pools.clear();
+  m_createdPools.clear();
 
   m_discardedPools = pools;
 
@@ -465,10 +481,21 @@ CVideoBuffer* CVideoBufferManager::Get(AVPixelFormat format, int size, IVideoBuf
     }
   }
 
+  // pools created here are only used by producers of the current stream, which asks for a
+  // different format or size now. Their buffers are freed as soon as the last one comes back.
+  for (auto it = m_createdPools.begin(); it != m_createdPools.end();)
+  {
+    auto pool = it->lock();
+    it = m_createdPools.erase(it);
+    if (pool)
+      ReleasePool(pool.get());
+  }
+
   for (const auto& fact : m_poolFactories)
   {
     std::shared_ptr<IVideoBufferPool> pool = fact.second();
     m_pools.push_front(pool);
+    m_createdPools.push_back(pool);
     pool->Configure(format, size);
     if (pPool)
       *pPool = pool.get();
@@ -10,6 +10,7 @@
 
 #include "threads/CriticalSection.h"
 #include <atomic>
+#include <cstdint>
 #include <deque>
 #include <list>
 #include <map>
@@ -142,9 +143,19 @@ protected:
 //
 //-----------------------------------------------------------------------------
 
+/*!
+ * \brief Pool of buffers in system memory, for a pixel format and a range of buffer sizes.
+ *
+ * A request is served from the pool if it is no bigger than the buffers of the pool and not
+ * smaller than half of them, so that producers with slightly varying sizes keep reusing the same
+ * buffers instead of allocating new ones. The number of buffers is capped, a producer that keeps
+ * more than that alive gets no further buffers instead of eventually exhausting memory.
+ */
 class CVideoBufferPoolSysMem : public IVideoBufferPool
 {
 public:
+  static constexpr size_t MAX_BUFFERS = 48;
+
   ~CVideoBufferPoolSysMem() override;
   CVideoBuffer* Get() override;
   void Return(int id) override;
@@ -168,6 +179,10 @@ protected:
   std::vector<CVideoBufferSysMem*> m_all;
   std::deque<int> m_used;
   std::deque<int> m_free;
+
+  uint64_t m_gets = 0;
+  uint64_t m_reuses = 0;
+  bool m_capReported = false;
 };
 
 //-----------------------------------------------------------------------------
@@ -191,6 +206,7 @@ protected:
   CCriticalSection m_critSection;
   std::list<std::shared_ptr<IVideoBufferPool>> m_pools;
   std::list<std::shared_ptr<IVideoBufferPool>> m_discardedPools;
+  std::list<std::weak_ptr<IVideoBufferPool>> m_createdPools;
   std::map<std::string, CreatePoolFunc> m_poolFactories;
 
 private:
@@ -266,6 +266,11 @@ bool CDVDClock::GetClockInfo(int& MissedVblanks, double& ClockSpeed, double& Ref
   return m_videoRefClock->GetClockInfo(MissedVblanks, ClockSpeed, RefreshRate);
 }
 
+bool CDVDClock::GetVblankInfo(double& MeasuredRefreshRate, double& Jitter) const
+{
+  return m_videoRefClock->GetVblankInfo(MeasuredRefreshRate, Jitter);
+}
+
 double CDVDClock::SystemToAbsolute(int64_t system)
 {
   return DVD_TIME_BASE * (double)(system - m_systemOffset) / m_systemFrequency;
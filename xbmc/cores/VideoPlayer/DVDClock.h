@@ -49,6 +49,7 @@ public:
   double GetFrequency() { return (double)m_systemFrequency ; }
 
   bool GetClockInfo(int& MissedVblanks, double& ClockSpeed, double& RefreshRate) const;
+  bool GetVblankInfo(double& MeasuredRefreshRate, double& Jitter) const;
   void SetVsyncAdjust(double adjustment);
   double GetVsyncAdjust();
 
@@ -76,6 +76,12 @@ public:
   std::vector<uint8_t> pixels;
   std::vector<uint32_t> palette;
 
+  /*!
+   * \brief Palette image converted to premultiplied RGBA by the subtitle decoder, so that
+   * the renderer only needs to upload it. Empty if not converted.
+   */
+  std::vector<uint32_t> rgba;
+
   int linesize{0};
   int x{0};
   int y{0};
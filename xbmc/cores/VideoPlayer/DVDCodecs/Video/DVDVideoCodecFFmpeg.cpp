@@ -397,12 +397,8 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
     }
     else
     {
-      int num_threads = CServiceBroker::GetCPUInfo()->GetCPUCount() * 3 / 2;
-      num_threads = std::max(1, std::min(num_threads, 16));
-      m_pCodecContext->thread_count = num_threads;
+      SetupThreading(pCodec);
       m_decoderState = STATE_SW_MULTI;
-      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open frame threaded with {} threads",
-                num_threads);
     }
   }
   else
@@ -483,6 +479,105 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
   return true;
 }
 
+void CDVDVideoCodecFFmpeg::SetupThreading(const AVCodec* codec)
+{
+  const std::shared_ptr<CCPUInfo> cpuInfo = CServiceBroker::GetCPUInfo();
+  const int cores = std::max(1, cpuInfo->GetCPUCount());
+  const int bigCores = std::max(1, std::min(cores, cpuInfo->GetPerformanceCoreCount()));
+
+  m_threading.canFrameThread = (codec->capabilities & AV_CODEC_CAP_FRAME_THREADS) != 0;
+  const bool canSliceThread = (codec->capabilities & AV_CODEC_CAP_SLICE_THREADS) != 0;
+
+  // on reopen keep what the evaluation after the first GOP came up with
+  if (m_threading.threadCount == 0)
+  {
+    const int pixels = m_hints.width * m_hints.height;
+
+    if (!m_threading.canFrameThread && !canSliceThread)
+    {
+      m_threading.threadType = 0;
+      m_threading.threadCount = 1;
+    }
+    else if ((pixels > 0 && pixels <= 1024 * 576 && canSliceThread) || !m_threading.canFrameThread)
+    {
+      // SD is cheap, slice threading avoids the extra latency of frame threads
+      m_threading.threadType = FF_THREAD_SLICE;
+      m_threading.threadCount = std::min(bigCores, 4);
+    }
+    else if (pixels > 1920 * 1088)
+    {
+      // UHD, keep all big cores busy and let the little ones help out
+      m_threading.threadType = FF_THREAD_FRAME;
+      m_threading.threadCount = std::min(16, bigCores * 3 / 2 + (cores - bigCores) / 2);
+    }
+    else
+    {
+      m_threading.threadType = FF_THREAD_FRAME;
+      m_threading.threadCount = std::min(8, bigCores * 3 / 2);
+    }
+    m_threading.threadCount = std::max(1, m_threading.threadCount);
+  }
+
+  m_pCodecContext->thread_count = m_threading.threadCount;
+  m_pCodecContext->thread_type = m_threading.threadType;
+
+  const char* type = m_threading.threadType == FF_THREAD_FRAME   ? "frame"
+                     : m_threading.threadType == FF_THREAD_SLICE ? "slice"
+                                                                 : "none";
+  m_processInfo.SetVideoDecoderThreading(
+      StringUtils::Format("{} x{}", type, m_threading.threadCount));
+  CLog::Log(LOGDEBUG,
+            "CDVDVideoCodecFFmpeg - open {} threaded with {} threads ({} of {} cores big)", type,
+            m_threading.threadCount, bigCores, cores);
+}
+
+bool CDVDVideoCodecFFmpeg::EvaluateThreading(bool keyFrame)
+{
+  // one GOP is over with the next key frame, don't wait forever for very long ones
+  constexpr int MAX_EVALUATION_FRAMES = 250;
+
+  m_threading.frames++;
+  if (!(keyFrame && m_threading.frames > 1) && m_threading.frames < MAX_EVALUATION_FRAMES)
+    return false;
+
+  m_threading.evaluated = true;
+
+  if (m_hints.fpsrate <= 0 || m_hints.fpsscale <= 0)
+    return false;
+
+  const double frameDuration = 1e9 * m_hints.fpsscale / m_hints.fpsrate;
+  const double decodeTime =
+      static_cast<double>(m_threading.decodeTime.count()) / m_threading.frames;
+
+  CLog::Log(LOGDEBUG,
+            "CDVDVideoCodecFFmpeg - decode time {:.2f} ms per frame ({:.2f} ms available) after "
+            "{} frames",
+            decodeTime / 1e6, frameDuration / 1e6, m_threading.frames);
+
+  // leave some headroom for frame drops, renderer and audio
+  if (decodeTime < 0.8 * frameDuration)
+    return false;
+
+  const int cores = std::max(1, CServiceBroker::GetCPUInfo()->GetCPUCount());
+  const int maxThreads = std::min(16, std::max(1, cores * 3 / 2));
+
+  if (m_threading.threadType == FF_THREAD_SLICE && m_threading.canFrameThread)
+  {
+    m_threading.threadType = FF_THREAD_FRAME;
+    m_threading.threadCount = std::max(m_threading.threadCount, std::min(8, maxThreads));
+  }
+  else if (m_threading.threadType == FF_THREAD_FRAME && m_threading.threadCount < maxThreads)
+  {
+    m_threading.threadCount = maxThreads;
+  }
+  else
+    return false;
+
+  CLog::Log(LOGINFO, "CDVDVideoCodecFFmpeg - decoding too slow, reopen with {} threads",
+            m_threading.threadCount);
+  return true;
+}
+
 void CDVDVideoCodecFFmpeg::Dispose()
 {
   av_frame_free(&m_pFrame);
@@ -619,6 +714,9 @@ bool CDVDVideoCodecFFmpeg::AddData(const DemuxPacket &packet)
 
   avpkt->data = packet.pData;
   avpkt->size = packet.iSize;
+  // with a buffer reference libavcodec can keep the payload, otherwise it has to copy it
+  if (packet.pBufferRef)
+    avpkt->buf = av_buffer_ref(packet.pBufferRef);
   avpkt->dts = (packet.dts == DVD_NOPTS_VALUE)
                    ? AV_NOPTS_VALUE
                    : static_cast<int64_t>(packet.dts / DVD_TIME_BASE * AV_TIME_BASE);
@@ -628,7 +726,10 @@ bool CDVDVideoCodecFFmpeg::AddData(const DemuxPacket &packet)
   avpkt->side_data = static_cast<AVPacketSideData*>(packet.pSideData);
   avpkt->side_data_elems = packet.iSideDataElems;
 
+  const auto start = std::chrono::steady_clock::now();
   int ret = avcodec_send_packet(m_pCodecContext, avpkt);
+  if (m_decoderState == STATE_SW_MULTI && !m_threading.evaluated)
+    m_threading.decodeTime += std::chrono::steady_clock::now() - start;
 
   //! @todo: properly handle avpkt side_data. this works around our improper use of the side_data
   // as we pass pointers to ffmpeg allocated memory for the side_data. we should really be allocating
@@ -729,7 +830,10 @@ CDVDVideoCodec::VCReturn CDVDVideoCodecFFmpeg::GetPicture(VideoPicture* pVideoPi
     av_packet_free(&avpkt);
   }
 
+  const auto start = std::chrono::steady_clock::now();
   int ret = avcodec_receive_frame(m_pCodecContext, m_pDecodedFrame);
+  if (m_decoderState == STATE_SW_MULTI && !m_threading.evaluated)
+    m_threading.decodeTime += std::chrono::steady_clock::now() - start;
 
   if (m_decoderState == STATE_HW_FAILED && !m_pHardware)
     return VC_REOPEN;
@@ -811,6 +915,13 @@ CDVDVideoCodec::VCReturn CDVDVideoCodecFFmpeg::GetPicture(VideoPicture* pVideoPi
   }
   m_dropCtrl.Process(framePTS, m_pCodecContext->skip_frame > AVDISCARD_DEFAULT);
 
+  if (m_decoderState == STATE_SW_MULTI && !m_threading.evaluated &&
+      EvaluateThreading(m_pDecodedFrame->key_frame))
+  {
+    av_frame_unref(m_pDecodedFrame);
+    return VC_REOPEN;
+  }
+
   if (m_pDecodedFrame->key_frame)
   {
     m_started = true;
@@ -1203,6 +1314,14 @@ int CDVDVideoCodecFFmpeg::FilterOpen(const std::string& filters, bool scale)
     return -1;
   }
 
+  // bwdif, yadif and scale split each frame into slices, without threads deinterlacing 1080i
+  // in software is too slow on many devices
+  const std::shared_ptr<CCPUInfo> cpuInfo = CServiceBroker::GetCPUInfo();
+  const int bigCores =
+      std::max(1, std::min(cpuInfo->GetCPUCount(), cpuInfo->GetPerformanceCoreCount()));
+  m_pFilterGraph->thread_type = AVFILTER_THREAD_SLICE;
+  m_pFilterGraph->nb_threads = std::min(bigCores, 8);
+
   const AVFilter* srcFilter = avfilter_get_by_name("buffer");
   const AVFilter* outFilter = avfilter_get_by_name("buffersink"); // should be last filter in the graph for now
 
@@ -12,6 +12,8 @@
 #include "cores/VideoPlayer/DVDStreamInfo.h"
 #include "DVDVideoCodec.h"
 #include "DVDVideoPPFFmpeg.h"
+
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -117,4 +119,20 @@ protected:
 
 private:
   void SetProcessInfoVideoDetails();
+  void SetupThreading(const AVCodec* codec);
+  bool EvaluateThreading(bool keyFrame);
+
+  /*!
+   * Software decoding threads, chosen from codec, resolution and the core layout when opening
+   * and re-evaluated once after the first GOP using the measured decode time.
+   */
+  struct CThreadingControl
+  {
+    int threadCount = 0;
+    int threadType = 0;
+    bool canFrameThread = false;
+    bool evaluated = false;
+    int frames = 0;
+    std::chrono::nanoseconds decodeTime{0};
+  } m_threading;
 };
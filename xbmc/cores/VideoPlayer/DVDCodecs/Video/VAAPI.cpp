@@ -24,6 +24,7 @@
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 
+#include <algorithm>
 #include <array>
 #include <mutex>
 
@@ -54,6 +55,11 @@ using namespace VAAPI;
 using namespace std::chrono_literals;
 
 #define NUM_RENDER_PICS 7
+// render buffers the renderer may queue, each keeps a surface of the decoder if it is rendered
+// directly
+#define NUM_RENDER_QUEUE 4
+// past and future pictures vaapi deinterlacers keep as references
+#define NUM_VPP_REFERENCES 3
 
 constexpr auto SETTING_VIDEOPLAYER_USEVAAPI = "videoplayer.usevaapi";
 constexpr auto SETTING_VIDEOPLAYER_USEVAAPIAV1 = "videoplayer.usevaapiav1";
@@ -718,9 +724,10 @@ bool CDecoder::Open(AVCodecContext* avctx, AVCodecContext* mainctx, const enum A
   else
     m_vaapiConfig.maxReferences = 2;
 
-  // add an extra surface for safety, some faulty material
-  // make ffmpeg require more buffers
-  m_vaapiConfig.maxReferences += 6;
+  // the output path decides how many surfaces are away from the decoder
+  m_vaapiConfig.directOutput = CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+      SETTING_VIDEOPLAYER_PREFERVAAPIRENDER);
+  m_vaapiConfig.maxReferences += GetOutputSurfaces();
 
   if (!ConfigVAAPI())
   {
@@ -1132,6 +1139,33 @@ bool CDecoder::CheckSuccess(VAStatus status, const std::string& function)
   return true;
 }
 
+unsigned CDecoder::GetAllowedReferences()
+{
+  return NUM_RENDER_QUEUE;
+}
+
+unsigned int CDecoder::GetOutputSurfaces()
+{
+  // decoded pictures not taken by the output yet, see Decode()
+  const unsigned int pending = 2;
+
+  // pictures kept by the output: the references of vaapi deinterlacing or, if decoded surfaces
+  // are rendered without post processing, the render queue. The queue may be smaller if the
+  // renderer was configured already.
+  unsigned int kept = NUM_VPP_REFERENCES;
+  if (m_vaapiConfig.directOutput)
+  {
+    int queued, discard, free;
+    m_processInfo.GetRenderBuffers(queued, discard, free);
+    const int renderBuffers = queued + discard + free;
+    const unsigned int queueDepth =
+        renderBuffers > 0 ? std::min<unsigned int>(renderBuffers, NUM_RENDER_QUEUE)
+                          : NUM_RENDER_QUEUE;
+    kept = std::max(kept, queueDepth);
+  }
+  return pending + kept;
+}
+
 bool CDecoder::ConfigVAAPI()
 {
   m_vaapiConfig.dpy = m_vaapiConfig.context->GetDisplay();
@@ -2108,7 +2142,8 @@ void COutput::InitCycle()
     }
     if (!m_pp)
     {
-      const bool preferVaapiRender = CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(SETTING_VIDEOPLAYER_PREFERVAAPIRENDER);
+      // the decoder sized its surface pool for the render queue if decoded surfaces are rendered
+      const bool preferVaapiRender = m_config.directOutput;
       // For 1080p/i or below, always use CVppPostproc even when not deinterlacing
       // Reason is: mesa cannot dynamically switch surfaces between use for VAAPI post-processing
       // and use for direct export, so we run into trouble if we or the user want to switch
@@ -189,6 +189,7 @@ struct CVaapiConfig
   CProcessInfo *processInfo;
   bool driverIsMesa;
   int bitDepth;
+  bool directOutput; ///< decoded surfaces may be rendered without post processing
 };
 
 /**
@@ -461,7 +462,7 @@ public:
   virtual void Close();
   long Release() override;
   bool CanSkipDeint() override;
-  unsigned GetAllowedReferences() override { return 4; }
+  unsigned GetAllowedReferences() override;
 
   CDVDVideoCodec::VCReturn Check(AVCodecContext* avctx) override;
   const std::string Name() override { return "vaapi"; }
@@ -478,6 +479,7 @@ public:
 protected:
   void SetWidthHeight(int width, int height);
   bool ConfigVAAPI();
+  unsigned int GetOutputSurfaces();
   bool CheckStatus(VAStatus vdp_st, int line);
   void FiniVAAPIOutput();
   void ReturnRenderPicture(CVaapiRenderPicture *renderPic);
@@ -7,6 +7,7 @@
  */
 
 #include "DVDDemuxFFmpeg.h"
+#include "DVDDemuxProbeCache.h"
 #include "DVDDemuxUtils.h"
 #include "DVDInputStreams/DVDInputStream.h"
 #ifdef HAVE_LIBBLURAY
@@ -25,6 +26,7 @@
 #include "filesystem/CurlFile.h"
 #include "filesystem/Directory.h"
 #include "filesystem/File.h"
+#include "filesystem/IFileTypes.h"
 #include "libavutil/intreadwrite.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
@@ -38,6 +40,8 @@
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -107,6 +111,42 @@ bool AttachmentIsFont(const AVDictionaryEntry* dict)
   }
   return false;
 }
+
+// Every refill of the AVIO buffer is one read callback into the input stream. Video gets larger
+// buffers, sized for about AVIO_READS_PER_SECOND callbacks at the rate the input is cached.
+constexpr int AVIO_BUFFER_SIZE = 4096;
+constexpr int AVIO_BUFFER_SIZE_VIDEO = 32 * 1024;
+constexpr int AVIO_BUFFER_SIZE_MAX = 256 * 1024;
+constexpr uint32_t AVIO_READS_PER_SECOND = 25;
+
+// one keyframe per second is enough to land close to any time, broadcasts may have GOPs of several
+// seconds though
+constexpr int64_t KEYFRAME_INDEX_INTERVAL_MS = 1000;
+constexpr int64_t KEYFRAME_INDEX_MAX_GAP_MS = 10000;
+
+int GetIOBufferSize(CDVDInputStream& input)
+{
+  std::string content = input.GetContent();
+  StringUtils::ToLower(content);
+  const std::string extension = StringUtils::ToLower(URIUtils::GetExtension(input.GetFileName()));
+
+  static const std::vector<std::string> videoExtensions = {
+      ".ts", ".m2ts", ".mts", ".mkv", ".mp4", ".mov", ".avi", ".mpg", ".vob", ".webm"};
+  if (!StringUtils::StartsWith(content, "video/") &&
+      std::find(videoExtensions.begin(), videoExtensions.end(), extension) ==
+          videoExtensions.end())
+    return AVIO_BUFFER_SIZE;
+
+  int size = AVIO_BUFFER_SIZE_VIDEO;
+  XFILE::SCacheStatus status{};
+  if (input.GetCacheStatus(&status))
+  {
+    const uint32_t bytesPerRead = std::max(status.currate, status.maxrate) / AVIO_READS_PER_SECOND;
+    while (size < AVIO_BUFFER_SIZE_MAX && static_cast<uint32_t>(size) < bytesPerRead)
+      size *= 2;
+  }
+  return size;
+}
 } // namespace
 
 std::string CDemuxStreamAudioFFmpeg::GetStreamName()
@@ -173,8 +213,9 @@ static int dvd_file_read(void* h, uint8_t* buf, int size)
   if (interrupt_cb(h))
     return AVERROR_EXIT;
 
-  std::shared_ptr<CDVDInputStream> pInputStream = static_cast<CDVDDemuxFFmpeg*>(h)->m_pInput;
-  int len = pInputStream->Read(buf, size);
+  CDVDDemuxFFmpeg* demuxer = static_cast<CDVDDemuxFFmpeg*>(h);
+  int len = demuxer->m_pInput->Read(buf, size);
+  demuxer->AddReadStats(len);
   if (len == 0)
     return AVERROR_EOF;
   else
@@ -358,12 +399,14 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
     {
       seekable = false;
     }
-    int bufferSize = 4096;
+    int bufferSize = GetIOBufferSize(*m_pInput);
     int blockSize = m_pInput->GetBlockSize();
 
     if (blockSize > 1 && seekable) // non seakable input streams are not supposed to set block size
       bufferSize = blockSize;
 
+    CLog::Log(LOGDEBUG, "{} - using {} bytes AVIO buffer", __FUNCTION__, bufferSize);
+
     unsigned char* buffer = (unsigned char*)av_malloc(bufferSize);
     m_ioContext = avio_alloc_context(buffer, bufferSize, 0, this, dvd_file_read, NULL, dvd_file_seek);
 
@@ -514,6 +557,8 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
   if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoFpsDetect == 0)
       m_pFormatContext->fps_probe_size = 0;
 
+  m_zeroCopy = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoZeroCopyDemux;
+
   // analyse very short to speed up mjpeg playback start
   if (iformat && (strcmp(iformat->name, "mjpeg") == 0) && m_ioContext->seekable == 0)
     av_opt_set_int(m_pFormatContext, "analyzeduration", 500000, 0);
@@ -550,32 +595,47 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
   m_bAVI = strcmp(m_pFormatContext->iformat->name, "avi") == 0;
   m_bSup = strcmp(m_pFormatContext->iformat->name, "sup") == 0;
 
+  OpenKeyframeIndex();
+
   if (m_streaminfo)
   {
     /* to speed up dvd switches, only analyse very short */
     if (m_pInput->IsStreamType(DVDSTREAM_TYPE_DVD))
       av_opt_set_int(m_pFormatContext, "analyzeduration", 500000, 0);
 
-    CLog::Log(LOGDEBUG, "{} - avformat_find_stream_info starting", __FUNCTION__);
-    int iErr = avformat_find_stream_info(m_pFormatContext, NULL);
-    if (iErr < 0)
+    // probing reads and decodes packets, which takes long for big files on the network
+    const bool useProbeCache = m_pInput->IsStreamType(DVDSTREAM_TYPE_FILE) && m_ioContext &&
+                               m_ioContext->seekable;
+    if (useProbeCache && CDVDDemuxProbeCache::Restore(strFile, m_pFormatContext))
     {
-      CLog::Log(LOGWARNING, "could not find codec parameters for {}", CURL::GetRedacted(strFile));
-      if (m_pInput->IsStreamType(DVDSTREAM_TYPE_DVD) ||
-          m_pInput->IsStreamType(DVDSTREAM_TYPE_BLURAY) ||
-          (m_pFormatContext->nb_streams == 1 &&
-           m_pFormatContext->streams[0]->codecpar->codec_id == AV_CODEC_ID_AC3) ||
-          m_checkTransportStream)
-      {
-        // special case, our codecs can still handle it.
-      }
-      else
+      CLog::Log(LOGDEBUG, "{} - stream info restored from probe cache", __FUNCTION__);
+    }
+    else
+    {
+      CLog::Log(LOGDEBUG, "{} - avformat_find_stream_info starting", __FUNCTION__);
+      int iErr = avformat_find_stream_info(m_pFormatContext, NULL);
+      if (iErr < 0)
       {
-        Dispose();
-        return false;
+        CLog::Log(LOGWARNING, "could not find codec parameters for {}",
+                  CURL::GetRedacted(strFile));
+        if (m_pInput->IsStreamType(DVDSTREAM_TYPE_DVD) ||
+            m_pInput->IsStreamType(DVDSTREAM_TYPE_BLURAY) ||
+            (m_pFormatContext->nb_streams == 1 &&
+             m_pFormatContext->streams[0]->codecpar->codec_id == AV_CODEC_ID_AC3) ||
+            m_checkTransportStream)
+        {
+          // special case, our codecs can still handle it.
+        }
+        else
+        {
+          Dispose();
+          return false;
+        }
       }
+      else if (useProbeCache)
+        CDVDDemuxProbeCache::Store(strFile, m_pFormatContext);
+      CLog::Log(LOGDEBUG, "{} - av_find_stream_info finished", __FUNCTION__);
     }
-    CLog::Log(LOGDEBUG, "{} - av_find_stream_info finished", __FUNCTION__);
 
     // print some extra information
     av_dump_format(m_pFormatContext, 0, CURL::GetRedacted(strFile).c_str(), 0);
@@ -667,6 +727,86 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
   return true;
 }
 
+void CDVDDemuxFFmpeg::AddReadStats(int bytes)
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (m_readStatsStart == std::chrono::steady_clock::time_point{})
+    m_readStatsStart = now;
+
+  m_reads++;
+  if (bytes > 0)
+    m_readBytes += bytes;
+
+  const auto elapsed = now - m_readStatsStart;
+  if (elapsed < 1s)
+    return;
+
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  m_readsPerSecond = static_cast<unsigned int>(m_reads / seconds);
+  m_readBytesPerSecond = static_cast<uint64_t>(m_readBytes / seconds);
+  m_reads = 0;
+  m_readBytes = 0;
+  m_readStatsStart = now;
+}
+
+void CDVDDemuxFFmpeg::GetReadStats(unsigned int& readsPerSecond, uint64_t& bytesPerSecond) const
+{
+  readsPerSecond = m_readsPerSecond;
+  bytesPerSecond = m_readBytesPerSecond;
+}
+
+void CDVDDemuxFFmpeg::OpenKeyframeIndex()
+{
+  // transport streams have no index of their own, seeking searches the file for the timestamp
+  if (strcmp(m_pFormatContext->iformat->name, "mpegts") != 0 ||
+      !m_pInput->IsStreamType(DVDSTREAM_TYPE_FILE) || m_pInput->IsRealtime() || !m_ioContext ||
+      !m_ioContext->seekable)
+    return;
+
+  m_keyframeIndex =
+      std::make_unique<CSeekIndex>(KEYFRAME_INDEX_INTERVAL_MS, KEYFRAME_INDEX_MAX_GAP_MS);
+  LoadKeyframeIndex();
+}
+
+bool CDVDDemuxFFmpeg::LoadKeyframeIndex()
+{
+  // keep the keyframes collected so far if there is no stored index yet
+  auto index = std::make_unique<CSeekIndex>(KEYFRAME_INDEX_INTERVAL_MS, KEYFRAME_INDEX_MAX_GAP_MS);
+  if (!index->Load(m_pInput->GetFileName()))
+    return false;
+
+  m_keyframeIndex = std::move(index);
+  m_keyframeIndexLoaded = true;
+  return true;
+}
+
+void CDVDDemuxFFmpeg::AddKeyframe(const AVStream* stream, const DemuxPacket* pPacket)
+{
+  if (!(m_pkt.pkt.flags & AV_PKT_FLAG_KEY) || stream->codecpar->codec_type != AVMEDIA_TYPE_VIDEO)
+    return;
+
+  // the first video stream of the file, attached pictures have no position in it
+  if (m_keyframeStream < 0 && !(stream->disposition & AV_DISPOSITION_ATTACHED_PIC))
+    m_keyframeStream = m_pkt.pkt.stream_index;
+  if (m_pkt.pkt.stream_index != m_keyframeStream)
+    return;
+
+  const double pts = pPacket->pts != DVD_NOPTS_VALUE ? pPacket->pts : pPacket->dts;
+  if (pts != DVD_NOPTS_VALUE)
+    m_keyframeIndex->Add(static_cast<int64_t>(DVD_TIME_TO_MSEC(pts)), m_pkt.pkt.pos);
+}
+
+bool CDVDDemuxFFmpeg::NeedsKeyframeIndex() const
+{
+  return m_keyframeIndex && !m_keyframeIndexLoaded;
+}
+
+void CDVDDemuxFFmpeg::SaveKeyframeIndex()
+{
+  if (m_keyframeIndex && !m_keyframeIndexLoaded)
+    m_keyframeIndex->Save();
+}
+
 void CDVDDemuxFFmpeg::Dispose()
 {
   m_pkt.result = -1;
@@ -695,6 +835,16 @@ void CDVDDemuxFFmpeg::Dispose()
   m_pFormatContext = NULL;
   m_speed = DVD_PLAYSPEED_NORMAL;
 
+  m_readStatsStart = {};
+  m_reads = 0;
+  m_readBytes = 0;
+  m_readsPerSecond = 0;
+  m_readBytesPerSecond = 0;
+
+  m_keyframeIndex.reset();
+  m_keyframeIndexLoaded = false;
+  m_keyframeStream = -1;
+
   DisposeStreams();
 
   m_pInput = NULL;
@@ -1024,6 +1174,18 @@ double CDVDDemuxFFmpeg::ConvertTimestamp(int64_t pts, int den, int num)
   return timestamp * DVD_TIME_BASE;
 }
 
+DemuxPacket* CDVDDemuxFFmpeg::AllocatePacket()
+{
+  // reference the refcounted libavformat buffer instead of copying the payload
+  if (m_zeroCopy)
+  {
+    DemuxPacket* pPacket = CDVDDemuxUtils::AllocateDemuxPacketRef(&m_pkt.pkt);
+    if (pPacket)
+      return pPacket;
+  }
+  return CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+}
+
 DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
 {
   DemuxPacket* pPacket = NULL;
@@ -1114,7 +1276,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               if (m_pkt.pkt.stream_index ==
                   (int)m_pFormatContext->programs[m_program]->stream_index[i])
               {
-                pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+                pPacket = AllocatePacket();
                 break;
               }
             }
@@ -1123,7 +1285,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               bReturnEmpty = true;
           }
           else
-            pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+            pPacket = AllocatePacket();
         }
         else
           bReturnEmpty = true;
@@ -1140,8 +1302,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
           // copy contents into our own packet
           pPacket->iSize = m_pkt.pkt.size;
 
-          // maybe we can avoid a memcpy here by detecting where pkt.destruct is pointing too?
-          if (m_pkt.pkt.data)
+          if (m_pkt.pkt.data && !pPacket->pBufferRef)
             memcpy(pPacket->pData, m_pkt.pkt.data, pPacket->iSize);
 
           pPacket->pts =
@@ -1153,6 +1314,9 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
 
           CDVDDemuxUtils::StoreSideData(pPacket, &m_pkt.pkt);
 
+          if (m_keyframeIndex)
+            AddKeyframe(stream, pPacket);
+
           CDVDInputStream::IDisplayTime* inputStream = m_pInput->GetIDisplayTime();
           if (inputStream)
           {
@@ -1352,10 +1516,29 @@ bool CDVDDemuxFFmpeg::SeekTime(double time, bool backwards, double* startpts)
   else if (m_pFormatContext->start_time != (int64_t)AV_NOPTS_VALUE && !ismp3 && !m_bSup)
     seek_pts += m_pFormatContext->start_time;
 
+  // jump straight to the keyframe at or before the time if it is known, the players skip to the
+  // time from there
+  CSeekIndex::Entry keyframe{-1, -1};
+  if (m_keyframeIndex)
+  {
+    // the index job may have finished since
+    if (!m_keyframeIndexLoaded)
+      LoadKeyframeIndex();
+    m_keyframeIndex->Lookup(static_cast<int64_t>(time), keyframe);
+  }
+
   int ret;
   {
     std::unique_lock<CCriticalSection> lock(m_critSection);
-    ret = av_seek_frame(m_pFormatContext, m_seekStream, seek_pts, backwards ? AVSEEK_FLAG_BACKWARD : 0);
+    if (keyframe.pos >= 0)
+    {
+      ret = av_seek_frame(m_pFormatContext, -1, keyframe.pos, AVSEEK_FLAG_BYTE);
+      CLog::Log(LOGDEBUG, "{} - seek to keyframe at {} for time {}", __FUNCTION__,
+                keyframe.timestamp, static_cast<int>(time));
+    }
+    else
+      ret = av_seek_frame(m_pFormatContext, m_seekStream, seek_pts,
+                          backwards ? AVSEEK_FLAG_BACKWARD : 0);
 
     if (ret < 0)
     {
@@ -12,6 +12,10 @@
 #include "DemuxStreamSSIF.h"
 #include "threads/CriticalSection.h"
 #include "threads/SystemClock.h"
+#include "utils/SeekIndex.h"
+
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <vector>
@@ -113,6 +117,27 @@ public:
 
   bool Aborted();
 
+  /*!
+   * \brief Count a read callback of the AVIO context and the bytes it returned
+   */
+  void AddReadStats(int bytes);
+
+  /*!
+   * \brief Get the read callbacks and bytes per second, measured over the last second of reading
+   */
+  void GetReadStats(unsigned int& readsPerSecond, uint64_t& bytesPerSecond) const;
+
+  /*!
+   * \brief Whether seeks can use keyframe positions of the file, but no complete index of them was
+   * stored yet
+   */
+  bool NeedsKeyframeIndex() const;
+
+  /*!
+   * \brief Store the keyframe positions collected while reading, after the file was read to the end
+   */
+  void SaveKeyframeIndex();
+
   AVFormatContext* m_pFormatContext;
   std::shared_ptr<CDVDInputStream> m_pInput;
 
@@ -126,12 +151,16 @@ protected:
   void CreateStreams(unsigned int program = UINT_MAX);
   void DisposeStreams();
   void ParsePacket(AVPacket* pkt);
+  DemuxPacket* AllocatePacket();
   TRANSPORT_STREAM_STATE TransportStreamAudioState();
   TRANSPORT_STREAM_STATE TransportStreamVideoState();
   bool IsTransportStreamReady();
   void ResetVideoStreams();
   AVDictionary* GetFFMpegOptionsFromInput();
   double ConvertTimestamp(int64_t pts, int den, int num);
+  void OpenKeyframeIndex();
+  bool LoadKeyframeIndex();
+  void AddKeyframe(const AVStream* stream, const DemuxPacket* pPacket);
   bool IsProgramChange();
   unsigned int HLSSelectProgram();
 
@@ -152,6 +181,7 @@ protected:
   double   m_currentPts; // used for stream length estimation
   bool     m_bMatroska;
   bool     m_bAVI;
+  bool m_zeroCopy = false;
   bool     m_bSup;
   CDemuxStreamSSIF* m_pSSIF;
   int      m_speed;
@@ -180,5 +210,17 @@ protected:
   double m_startTime = 0;
   bool m_dv_dual_stream = false;
   bool m_dv_dual_stream_started = false;
+
+  // byte positions of video keyframes, lets seeks in transport streams skip the search
+  std::unique_ptr<CSeekIndex> m_keyframeIndex;
+  bool m_keyframeIndexLoaded = false;
+  int m_keyframeStream = -1;
+
+  // AVIO read callbacks, counted on the demux thread and published once per second
+  std::chrono::steady_clock::time_point m_readStatsStart;
+  unsigned int m_reads = 0;
+  uint64_t m_readBytes = 0;
+  std::atomic<unsigned int> m_readsPerSecond{0};
+  std::atomic<uint64_t> m_readBytesPerSecond{0};
 };
 
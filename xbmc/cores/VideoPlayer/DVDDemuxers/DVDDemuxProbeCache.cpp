@@ -0,0 +1,280 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DVDDemuxProbeCache.h"
+
+#include "URL.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <cstring>
+#include <stdexcept>
+
+extern "C"
+{
+#include <libavformat/avformat.h>
+#include <libavutil/channel_layout.h>
+}
+
+using namespace XFILE;
+
+namespace
+{
+constexpr int PROBE_CACHE_VERSION = 1;
+constexpr const char* PROBE_CACHE_PATH = "special://temp/probecache/";
+
+std::string GetToken(const std::string& path)
+{
+  struct __stat64 st;
+  if (CFile::Stat(path, &st) != 0 || st.st_size <= 0)
+    return {};
+
+  return StringUtils::Format("{}:{}", static_cast<int64_t>(st.st_size),
+                             static_cast<int64_t>(st.st_mtime));
+}
+
+std::string GetCacheFile(const std::string& path)
+{
+  return StringUtils::Format("{}{:08x}.probe", PROBE_CACHE_PATH, Crc32::Compute(path));
+}
+
+template<typename T>
+void ReadEnum(CArchive& ar, T& value)
+{
+  int i = 0;
+  ar >> i;
+  value = static_cast<T>(i);
+}
+
+void ReadRational(CArchive& ar, AVRational& value)
+{
+  ar >> value.num;
+  ar >> value.den;
+}
+
+void WriteRational(CArchive& ar, const AVRational& value)
+{
+  ar << value.num;
+  ar << value.den;
+}
+
+void WriteStream(CArchive& ar, const AVStream* stream)
+{
+  const AVCodecParameters* par = stream->codecpar;
+  ar << static_cast<int>(par->codec_type);
+  ar << static_cast<int>(par->codec_id);
+  WriteRational(ar, stream->time_base);
+  ar << par->codec_tag;
+  ar << par->format;
+  ar << par->bit_rate;
+  ar << par->bits_per_coded_sample;
+  ar << par->bits_per_raw_sample;
+  ar << par->profile;
+  ar << par->level;
+  ar << par->width;
+  ar << par->height;
+  WriteRational(ar, par->sample_aspect_ratio);
+  ar << static_cast<int>(par->field_order);
+  ar << static_cast<int>(par->color_range);
+  ar << static_cast<int>(par->color_primaries);
+  ar << static_cast<int>(par->color_trc);
+  ar << static_cast<int>(par->color_space);
+  ar << static_cast<int>(par->chroma_location);
+  ar << par->video_delay;
+  ar << static_cast<int>(par->ch_layout.order);
+  ar << par->ch_layout.nb_channels;
+  ar << static_cast<uint64_t>(
+      par->ch_layout.order == AV_CHANNEL_ORDER_NATIVE ? par->ch_layout.u.mask : 0);
+  ar << par->sample_rate;
+  ar << par->block_align;
+  ar << par->frame_size;
+  ar << par->initial_padding;
+  ar << std::string(reinterpret_cast<const char*>(par->extradata),
+                    par->extradata ? par->extradata_size : 0);
+
+  WriteRational(ar, stream->r_frame_rate);
+  WriteRational(ar, stream->avg_frame_rate);
+  ar << stream->start_time;
+  ar << stream->duration;
+}
+
+bool ReadStream(CArchive& ar, AVStream* stream)
+{
+  AVCodecParameters* par = stream->codecpar;
+
+  // the container has to report the stream the same way as when it was stored
+  AVMediaType codecType;
+  AVCodecID codecId;
+  AVRational timeBase;
+  ReadEnum(ar, codecType);
+  ReadEnum(ar, codecId);
+  ReadRational(ar, timeBase);
+  if (codecType != par->codec_type ||
+      (par->codec_id != AV_CODEC_ID_NONE && par->codec_id != codecId) ||
+      av_cmp_q(timeBase, stream->time_base) != 0)
+    return false;
+
+  par->codec_id = codecId;
+  ar >> par->codec_tag;
+  ar >> par->format;
+  ar >> par->bit_rate;
+  ar >> par->bits_per_coded_sample;
+  ar >> par->bits_per_raw_sample;
+  ar >> par->profile;
+  ar >> par->level;
+  ar >> par->width;
+  ar >> par->height;
+  ReadRational(ar, par->sample_aspect_ratio);
+  ReadEnum(ar, par->field_order);
+  ReadEnum(ar, par->color_range);
+  ReadEnum(ar, par->color_primaries);
+  ReadEnum(ar, par->color_trc);
+  ReadEnum(ar, par->color_space);
+  ReadEnum(ar, par->chroma_location);
+  ar >> par->video_delay;
+
+  AVChannelOrder order;
+  int channels = 0;
+  uint64_t mask = 0;
+  ReadEnum(ar, order);
+  ar >> channels;
+  ar >> mask;
+  av_channel_layout_uninit(&par->ch_layout);
+  if (order == AV_CHANNEL_ORDER_NATIVE)
+    av_channel_layout_from_mask(&par->ch_layout, mask);
+  else
+  {
+    par->ch_layout.order = AV_CHANNEL_ORDER_UNSPEC;
+    par->ch_layout.nb_channels = channels;
+  }
+
+  ar >> par->sample_rate;
+  ar >> par->block_align;
+  ar >> par->frame_size;
+  ar >> par->initial_padding;
+
+  std::string extradata;
+  ar >> extradata;
+  av_freep(&par->extradata);
+  par->extradata_size = 0;
+  if (!extradata.empty())
+  {
+    par->extradata =
+        static_cast<uint8_t*>(av_mallocz(extradata.size() + AV_INPUT_BUFFER_PADDING_SIZE));
+    if (!par->extradata)
+      return false;
+    std::memcpy(par->extradata, extradata.data(), extradata.size());
+    par->extradata_size = static_cast<int>(extradata.size());
+  }
+
+  ReadRational(ar, stream->r_frame_rate);
+  ReadRational(ar, stream->avg_frame_rate);
+  ar >> stream->start_time;
+  ar >> stream->duration;
+  return true;
+}
+} // unnamed namespace
+
+bool CDVDDemuxProbeCache::Restore(const std::string& path, AVFormatContext* context)
+{
+  const std::string token = GetToken(path);
+  if (token.empty())
+    return false;
+
+  CFile file;
+  if (!file.Open(GetCacheFile(path)))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+    int version = 0;
+    ar >> version;
+    if (version != PROBE_CACHE_VERSION)
+      return false;
+
+    std::string cachedPath;
+    std::string cachedToken;
+    std::string formatName;
+    unsigned int streams = 0;
+    ar >> cachedPath;
+    ar >> cachedToken;
+    ar >> formatName;
+    ar >> streams;
+    if (cachedPath != path || cachedToken != token || formatName != context->iformat->name ||
+        streams != context->nb_streams)
+      return false;
+
+    for (unsigned int i = 0; i < context->nb_streams; ++i)
+    {
+      if (!ReadStream(ar, context->streams[i]))
+      {
+        CLog::Log(LOGDEBUG, "CDVDDemuxProbeCache::{} - stream {} of {} changed", __FUNCTION__, i,
+                  CURL::GetRedacted(path));
+        return false;
+      }
+    }
+
+    ar >> context->start_time;
+    ar >> context->duration;
+    ar >> context->bit_rate;
+    return true;
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "CDVDDemuxProbeCache::{} - corrupt probe cache of {}", __FUNCTION__,
+              CURL::GetRedacted(path));
+  }
+  return false;
+}
+
+void CDVDDemuxProbeCache::Store(const std::string& path, const AVFormatContext* context)
+{
+  const std::string token = GetToken(path);
+  if (token.empty() || context->nb_streams == 0)
+    return;
+
+  // a stream the probe could not identify would be probed again on every open anyway
+  for (unsigned int i = 0; i < context->nb_streams; ++i)
+  {
+    const AVCodecParameters* par = context->streams[i]->codecpar;
+    if ((par->codec_type == AVMEDIA_TYPE_VIDEO || par->codec_type == AVMEDIA_TYPE_AUDIO) &&
+        par->codec_id == AV_CODEC_ID_NONE)
+      return;
+  }
+
+  const std::string cacheFile = GetCacheFile(path);
+  CFile file;
+  if (!file.OpenForWrite(cacheFile, true))
+  {
+    // first use, create the cache folder and try again
+    if (!CDirectory::Create(PROBE_CACHE_PATH) || !file.OpenForWrite(cacheFile, true))
+    {
+      CLog::Log(LOGWARNING, "CDVDDemuxProbeCache::{} - unable to write {}", __FUNCTION__,
+                cacheFile);
+      return;
+    }
+  }
+
+  CArchive ar(&file, CArchive::store);
+  ar << PROBE_CACHE_VERSION;
+  ar << path;
+  ar << token;
+  ar << std::string(context->iformat->name);
+  ar << context->nb_streams;
+  for (unsigned int i = 0; i < context->nb_streams; ++i)
+    WriteStream(ar, context->streams[i]);
+  ar << context->start_time;
+  ar << context->duration;
+  ar << context->bit_rate;
+  ar.Close();
+}
@@ -0,0 +1,35 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+
+struct AVFormatContext;
+
+/*!
+ * \brief Stores what avformat_find_stream_info() found out about a file, so that the next open of
+ * the same file, e.g. playback after the library scan, does not need to read and decode packets.
+ *
+ * The results are kept per file under special://temp/probecache/ and are only used while size and
+ * modification time of the file are unchanged and the container reports the same streams.
+ */
+class CDVDDemuxProbeCache
+{
+public:
+  /*!
+   * \brief Fill in the stream parameters of a freshly opened context from the cache
+   * \return true if all streams were restored and find_stream_info can be skipped
+   */
+  static bool Restore(const std::string& path, AVFormatContext* context);
+
+  /*!
+   * \brief Store the stream parameters of a context after find_stream_info
+   */
+  static void Store(const std::string& path, const AVFormatContext* context);
+};
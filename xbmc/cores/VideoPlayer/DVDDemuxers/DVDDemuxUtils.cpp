@@ -8,6 +8,7 @@
 
 #include "DVDDemuxUtils.h"
 
+#include "DemuxPacketPool.h"
 #include "cores/VideoPlayer/Interface/DemuxCrypto.h"
 #include "utils/MemUtils.h"
 #include "utils/log.h"
@@ -20,8 +21,10 @@ void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
 {
   if (pPacket)
   {
-    if (pPacket->pData)
-      KODI::MEMORY::AlignedFree(pPacket->pData);
+    if (pPacket->pBufferRef)
+      av_buffer_unref(&pPacket->pBufferRef);
+    else if (pPacket->pData)
+      CDemuxPacketPool::GetInstance().Release(pPacket->pData, pPacket->iAllocSize);
     if (pPacket->iSideDataElems)
     {
       AVPacket* avPkt = av_packet_alloc();
@@ -63,16 +66,15 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
      * 32 or 64 bit at once and could read over the end<br>
      * Note, if the first 23 bits of the additional bytes are not 0 then damaged
      * MPEG bitstreams could cause overread and segfault
+     *
+     * The pool takes care of the padding and resets it to 0.
      */
-    pPacket->pData = static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(iDataSize + AV_INPUT_BUFFER_PADDING_SIZE, 16));
+    pPacket->pData = CDemuxPacketPool::GetInstance().Acquire(iDataSize, pPacket->iAllocSize);
     if (!pPacket->pData)
     {
       FreeDemuxPacket(pPacket);
       return NULL;
     }
-
-    // reset the last 8 bytes to 0;
-    memset(pPacket->pData + iDataSize, 0, AV_INPUT_BUFFER_PADDING_SIZE);
   }
 
   return pPacket;
@@ -86,6 +88,39 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(unsigned int iDataSize, unsigne
   return ret;
 }
 
+DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacketRef(const AVPacket* src)
+{
+  // libavcodec requires the padding to be present behind the payload, only reference buffers
+  // that were allocated with it
+  if (!src->buf || !src->data || src->size <= 0 ||
+      src->data + src->size + AV_INPUT_BUFFER_PADDING_SIZE > src->buf->data + src->buf->size)
+    return nullptr;
+
+  DemuxPacket* pPacket = new DemuxPacket();
+  pPacket->pBufferRef = av_buffer_ref(src->buf);
+  if (!pPacket->pBufferRef)
+  {
+    delete pPacket;
+    return nullptr;
+  }
+
+  pPacket->pData = src->data;
+  pPacket->iSize = src->size;
+  return pPacket;
+}
+
+void CDVDDemuxUtils::TrimPacketPool()
+{
+  CDemuxPacketPool::GetInstance().Trim();
+}
+
+void CDVDDemuxUtils::GetPacketPoolStats(uint64_t& hits, uint64_t& misses)
+{
+  const CDemuxPacketPool& pool = CDemuxPacketPool::GetInstance();
+  hits = pool.GetHits();
+  misses = pool.GetMisses();
+}
+
 void CDVDDemuxUtils::StoreSideData(DemuxPacket *pkt, AVPacket *src)
 {
   AVPacket* avPkt = av_packet_alloc();
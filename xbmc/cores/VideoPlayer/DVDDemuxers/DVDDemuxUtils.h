@@ -19,6 +19,13 @@ public:
   static void FreeDemuxPacket(DemuxPacket* pPacket);
   static DemuxPacket* AllocateDemuxPacket(int iDataSize = 0);
   static DemuxPacket* AllocateDemuxPacket(unsigned int iDataSize, unsigned int encryptedSubsampleCount);
+  /*!
+   * \brief Create a packet referencing the payload of src without copying it.
+   * \return The packet, or nullptr if src is not backed by a suitably padded buffer
+   */
+  static DemuxPacket* AllocateDemuxPacketRef(const AVPacket* src);
   static void StoreSideData(DemuxPacket *pkt, AVPacket *src);
+  static void TrimPacketPool();
+  static void GetPacketPoolStats(uint64_t& hits, uint64_t& misses);
 };
 
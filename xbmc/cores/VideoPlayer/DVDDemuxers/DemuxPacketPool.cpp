@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DemuxPacketPool.h"
+
+#include "utils/MemUtils.h"
+
+#include <cstring>
+#include <mutex>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+}
+
+CDemuxPacketPool& CDemuxPacketPool::GetInstance()
+{
+  static CDemuxPacketPool pool;
+  return pool;
+}
+
+CDemuxPacketPool::~CDemuxPacketPool()
+{
+  Trim();
+}
+
+int CDemuxPacketPool::GetClass(int size)
+{
+  int shift = MIN_CLASS_SHIFT;
+  while ((1 << shift) < size)
+  {
+    if (++shift > MAX_CLASS_SHIFT)
+      return -1;
+  }
+  return shift - MIN_CLASS_SHIFT;
+}
+
+uint8_t* CDemuxPacketPool::Allocate(int capacity)
+{
+  return static_cast<uint8_t*>(
+      KODI::MEMORY::AlignedMalloc(capacity + AV_INPUT_BUFFER_PADDING_SIZE, 16));
+}
+
+uint8_t* CDemuxPacketPool::Acquire(int size, int& capacity)
+{
+  uint8_t* data = nullptr;
+  const int sizeClass = GetClass(size);
+
+  if (sizeClass < 0)
+  {
+    // oversized, not worth keeping around
+    capacity = size;
+    data = Allocate(capacity);
+    m_misses++;
+  }
+  else
+  {
+    capacity = 1 << (sizeClass + MIN_CLASS_SHIFT);
+    {
+      std::unique_lock<CCriticalSection> lock(m_section);
+      std::vector<uint8_t*>& freeList = m_freeLists[sizeClass];
+      if (!freeList.empty())
+      {
+        data = freeList.back();
+        freeList.pop_back();
+      }
+    }
+
+    if (data)
+    {
+      m_hits++;
+    }
+    else
+    {
+      data = Allocate(capacity);
+      m_misses++;
+    }
+  }
+
+  if (!data)
+    return nullptr;
+
+  // the padding bytes must be zero, see AV_INPUT_BUFFER_PADDING_SIZE
+  memset(data + size, 0, AV_INPUT_BUFFER_PADDING_SIZE);
+  return data;
+}
+
+void CDemuxPacketPool::Release(uint8_t* data, int capacity)
+{
+  if (!data)
+    return;
+
+  const int sizeClass = GetClass(capacity);
+  if (sizeClass >= 0 && (1 << (sizeClass + MIN_CLASS_SHIFT)) == capacity)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    std::vector<uint8_t*>& freeList = m_freeLists[sizeClass];
+    if (freeList.size() < MAX_FREE_PER_CLASS)
+    {
+      freeList.push_back(data);
+      return;
+    }
+  }
+
+  KODI::MEMORY::AlignedFree(data);
+}
+
+void CDemuxPacketPool::Trim()
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  for (std::vector<uint8_t*>& freeList : m_freeLists)
+  {
+    for (uint8_t* data : freeList)
+      KODI::MEMORY::AlignedFree(data);
+    freeList.clear();
+    freeList.shrink_to_fit();
+  }
+}
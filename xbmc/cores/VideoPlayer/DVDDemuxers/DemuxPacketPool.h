@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/*!
+ * \brief Size-class pool for demux packet payload buffers.
+ *
+ * Payloads are rounded up to power-of-two size classes. Freed buffers are kept on per-class
+ * freelists which grow lazily up to a fixed depth, so steady state playback reuses the same
+ * blocks instead of hitting the heap for every packet. Payloads larger than the biggest class
+ * bypass the pool.
+ */
+class CDemuxPacketPool
+{
+public:
+  static CDemuxPacketPool& GetInstance();
+
+  /*!
+   * \brief Get a buffer able to hold at least size bytes plus input padding.
+   * \param size The payload size in bytes
+   * \param[out] capacity The usable payload size of the returned buffer, to be passed back to
+   * Release()
+   * \return The buffer or nullptr on allocation failure
+   */
+  uint8_t* Acquire(int size, int& capacity);
+
+  /*!
+   * \brief Return a buffer obtained from Acquire() to the pool.
+   */
+  void Release(uint8_t* data, int capacity);
+
+  /*!
+   * \brief Drop all cached buffers, e.g. after a stream change when the size distribution of
+   * the packets is likely to change.
+   */
+  void Trim();
+
+  uint64_t GetHits() const { return m_hits; }
+  uint64_t GetMisses() const { return m_misses; }
+
+private:
+  CDemuxPacketPool() = default;
+  ~CDemuxPacketPool();
+  CDemuxPacketPool(const CDemuxPacketPool&) = delete;
+  CDemuxPacketPool& operator=(const CDemuxPacketPool&) = delete;
+
+  static constexpr int MIN_CLASS_SHIFT = 10; // 1 KiB
+  static constexpr int MAX_CLASS_SHIFT = 23; // 8 MiB
+  static constexpr int NUM_CLASSES = MAX_CLASS_SHIFT - MIN_CLASS_SHIFT + 1;
+  static constexpr size_t MAX_FREE_PER_CLASS = 64;
+
+  static int GetClass(int size);
+  static uint8_t* Allocate(int capacity);
+
+  CCriticalSection m_section;
+  std::array<std::vector<uint8_t*>, NUM_CLASSES> m_freeLists;
+  std::atomic<uint64_t> m_hits{0};
+  std::atomic<uint64_t> m_misses{0};
+};
@@ -10,6 +10,7 @@
 
 #include "DVDInputStreams/DVDInputStream.h"
 #include "DVDStreamInfo.h"
+#include "VideoFrameExtractor.h"
 #include "FileItem.h"
 #include "ServiceBroker.h"
 #include "filesystem/StackDirectory.h"
@@ -72,179 +73,29 @@ bool CDVDFileInfo::GetFileDuration(const std::string &path, int& duration)
     return false;
 }
 
-int DegreeToOrientation(int degrees)
-{
-  switch(degrees)
-  {
-    case 90:
-      return 5;
-    case 180:
-      return 2;
-    case 270:
-      return 7;
-    default:
-      return 0;
-  }
-}
-
 std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& fileItem,
                                                               int chapterNumber)
 {
   if (!CanExtract(fileItem))
     return {};
 
-  const std::string redactPath = CURL::GetRedacted(fileItem.GetPath());
   auto start = std::chrono::steady_clock::now();
 
-  CFileItem item(fileItem);
-  item.SetMimeTypeForInternetFile();
-  auto pInputStream = CDVDFactoryInputStream::CreateInputStream(NULL, item);
-  if (!pInputStream)
-  {
-    CLog::Log(LOGERROR, "InputStream: Error creating stream for {}", redactPath);
-    return {};
-  }
-
-  if (!pInputStream->Open())
-  {
-    CLog::Log(LOGERROR, "InputStream: Error opening, {}", redactPath);
+  CVideoFrameExtractor extractor;
+  if (!extractor.Open(fileItem))
     return {};
-  }
-
-  std::unique_ptr<CDVDDemux> demuxer{CDVDFactoryDemuxer::CreateDemuxer(pInputStream, true)};
-  if (!demuxer)
-  {
-    CLog::LogF(LOGERROR, "Error creating demuxer");
-    return {};
-  }
-
-  int nVideoStream = -1;
-  int64_t demuxerId = -1;
-  for (CDemuxStream* pStream : demuxer->GetStreams())
-  {
-    if (pStream)
-    {
-      // ignore if it's a picture attachment (e.g. jpeg artwork)
-      if (pStream->type == STREAM_VIDEO && !(pStream->flags & AV_DISPOSITION_ATTACHED_PIC))
-      {
-        nVideoStream = pStream->uniqueId;
-        demuxerId = pStream->demuxerId;
-      }
-      else
-        demuxer->EnableStream(pStream->demuxerId, pStream->uniqueId, false);
-    }
-  }
 
-  int packetsTried = 0;
+  const bool seekToChapter = chapterNumber > 0 && extractor.GetChapterCount() > 0;
+  const int64_t seekTo =
+      seekToChapter ? extractor.GetChapterPos(chapterNumber) : extractor.GetLength() / 3;
 
-  std::unique_ptr<CTexture> result{};
-  if (nVideoStream != -1)
-  {
-    std::unique_ptr<CProcessInfo> pProcessInfo(CProcessInfo::CreateInstance());
-    std::vector<AVPixelFormat> pixFmts;
-    pixFmts.push_back(AV_PIX_FMT_YUV420P);
-    pProcessInfo->SetPixFormats(pixFmts);
-
-    CDVDStreamInfo hint(*demuxer->GetStream(demuxerId, nVideoStream), true);
-    hint.codecOptions = CODEC_FORCE_SOFTWARE;
-
-    std::unique_ptr<CDVDVideoCodec> pVideoCodec =
-        CDVDFactoryCodec::CreateVideoCodec(hint, *pProcessInfo);
-
-    if (pVideoCodec)
-    {
-      int nTotalLen = demuxer->GetStreamLength();
-
-      bool seekToChapter = chapterNumber > 0 && demuxer->GetChapterCount() > 0;
-      int64_t nSeekTo =
-          seekToChapter ? demuxer->GetChapterPos(chapterNumber) * 1000 : nTotalLen / 3;
-
-      CLog::LogF(LOGDEBUG, "seeking to pos {}ms (total: {}ms) in {}", nSeekTo, nTotalLen,
-                 redactPath);
-
-      if (demuxer->SeekTime(static_cast<double>(nSeekTo), true))
-      {
-        CDVDVideoCodec::VCReturn iDecoderState = CDVDVideoCodec::VC_NONE;
-        VideoPicture picture;
-        picture.Reset();
-
-        // num streams * 160 frames, should get a valid frame, if not abort.
-        int abort_index = demuxer->GetNrOfStreams() * 160;
-        do
-        {
-          DemuxPacket* pPacket = demuxer->Read();
-          packetsTried++;
-
-          if (!pPacket)
-            break;
-
-          if (pPacket->iStreamId != nVideoStream || pPacket->isELPackage)
-          {
-            CDVDDemuxUtils::FreeDemuxPacket(pPacket);
-            continue;
-          }
-
-          pVideoCodec->AddData(*pPacket);
-          CDVDDemuxUtils::FreeDemuxPacket(pPacket);
-
-          iDecoderState = CDVDVideoCodec::VC_NONE;
-          while (iDecoderState == CDVDVideoCodec::VC_NONE)
-          {
-            iDecoderState = pVideoCodec->GetPicture(&picture);
-            picture.Reset();
-          }
-
-          if (iDecoderState == CDVDVideoCodec::VC_PICTURE)
-          {
-            if (!(picture.iFlags & DVP_FLAG_DROPPED))
-              break;
-          }
-
-        } while (abort_index--);
-
-        if (iDecoderState == CDVDVideoCodec::VC_PICTURE && !(picture.iFlags & DVP_FLAG_DROPPED))
-        {
-          unsigned int nWidth =
-              std::min(picture.iDisplayWidth,
-                       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes);
-          double aspect = (double)picture.iDisplayWidth / (double)picture.iDisplayHeight;
-          if (hint.forced_aspect && hint.aspect != 0)
-            aspect = hint.aspect;
-          unsigned int nHeight = (unsigned int)((double)nWidth / aspect);
-
-          result = CTexture::CreateTexture(nWidth, nHeight);
-          result->SetAlpha(false);
-          struct SwsContext* context =
-              sws_getContext(picture.iWidth, picture.iHeight, AV_PIX_FMT_YUV420P, nWidth, nHeight,
-                             AV_PIX_FMT_BGRA, SWS_FAST_BILINEAR, NULL, NULL, NULL);
-
-          if (context)
-          {
-            uint8_t* planes[YuvImage::MAX_PLANES];
-            int stride[YuvImage::MAX_PLANES];
-            picture.videoBuffer->GetPlanes(planes);
-            picture.videoBuffer->GetStrides(stride);
-            uint8_t* src[4] = {planes[0], planes[1], planes[2], 0};
-            int srcStride[] = {stride[0], stride[1], stride[2], 0};
-            uint8_t* dst[] = {result->GetPixels(), 0, 0, 0};
-            int dstStride[] = {static_cast<int>(result->GetPitch()), 0, 0, 0};
-            result->SetOrientation(DegreeToOrientation(hint.orientation));
-            sws_scale(context, src, srcStride, 0, picture.iHeight, dst, dstStride);
-            sws_freeContext(context);
-          }
-        }
-        else
-        {
-          CLog::LogF(LOGDEBUG, "decode failed in {} after {} packets.", redactPath, packetsTried);
-        }
-      }
-    }
-  }
+  std::unique_ptr<CTexture> result = extractor.ExtractFrame(
+      seekTo, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes);
 
   auto end = std::chrono::steady_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-  CLog::LogF(LOGDEBUG, "measured {} ms to extract thumb from file <{}> in {} packets. ",
-             duration.count(), redactPath, packetsTried);
+  CLog::LogF(LOGDEBUG, "measured {} ms to extract thumb from file <{}>", duration.count(),
+             CURL::GetRedacted(fileItem.GetPath()));
 
   return result;
 }
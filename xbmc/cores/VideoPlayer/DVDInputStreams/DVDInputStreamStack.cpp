@@ -13,15 +13,45 @@
 #include "filesystem/StackDirectory.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <limits.h>
 
 using namespace XFILE;
 
+namespace
+{
+// how close to the end of a file reading the beginning of the next one starts
+constexpr int64_t PREFETCH_DISTANCE = 8 * 1024 * 1024;
+constexpr size_t PREFETCH_SIZE = 2 * 1024 * 1024;
+
+std::vector<uint8_t> ReadHead(const std::shared_ptr<CFile>& file)
+{
+  if (file->GetPosition() != 0 && file->Seek(0, SEEK_SET) < 0)
+    return {};
+
+  std::vector<uint8_t> head(PREFETCH_SIZE);
+  size_t size = 0;
+  while (size < head.size())
+  {
+    const ssize_t ret = file->Read(head.data() + size, head.size() - size);
+    if (ret <= 0)
+      break;
+    size += ret;
+  }
+  head.resize(size);
+  return head;
+}
+} // unnamed namespace
+
 CDVDInputStreamStack::CDVDInputStreamStack(const CFileItem& fileitem) : CDVDInputStream(DVDSTREAM_TYPE_FILE, fileitem)
 {
+  m_segment = 0;
   m_eof = true;
   m_pos = 0;
   m_length = 0;
+  m_prefetchSegment = 0;
 }
 
 CDVDInputStreamStack::~CDVDInputStreamStack()
@@ -64,6 +94,7 @@ bool CDVDInputStreamStack::Open()
     }
     TSeg segment;
     segment.file   = file;
+    segment.start  = m_length;
     segment.length = file->GetLength();
 
     if(segment.length <= 0)
@@ -82,8 +113,9 @@ bool CDVDInputStreamStack::Open()
   if(m_files.empty())
     return false;
 
-  m_file = m_files[0].file;
-  m_eof  = false;
+  m_file    = m_files[0].file;
+  m_segment = 0;
+  m_eof     = false;
 
   return true;
 }
@@ -92,6 +124,9 @@ bool CDVDInputStreamStack::Open()
 void CDVDInputStreamStack::Close()
 {
   CDVDInputStream::Close();
+  if (m_prefetch.valid())
+    m_prefetch.wait();
+  m_prefetch = {};
   m_files.clear();
   m_file.reset();
   m_eof = true;
@@ -102,6 +137,24 @@ int CDVDInputStreamStack::Read(uint8_t* buf, int buf_size)
   if(m_file == NULL || m_eof)
     return 0;
 
+  PrefetchNext();
+
+  const TSeg& segment = m_files[m_segment];
+  const int64_t file_pos = m_pos - segment.start;
+
+  // serve the beginning of the file from what was read ahead of time
+  if (file_pos < static_cast<int64_t>(segment.head.size()))
+  {
+    const int size =
+        static_cast<int>(std::min<int64_t>(buf_size, segment.head.size() - file_pos));
+    std::memcpy(buf, segment.head.data() + file_pos, size);
+    m_pos += size;
+    return size;
+  }
+
+  if (m_file->GetPosition() != file_pos && m_file->Seek(file_pos, SEEK_SET) < 0)
+    return -1;
+
   unsigned int ret = m_file->Read(buf, buf_size);
 
   if(ret > INT_MAX)
@@ -126,7 +179,7 @@ int CDVDInputStreamStack::Read(uint8_t* buf, int buf_size)
 
 int64_t CDVDInputStreamStack::Seek(int64_t offset, int whence)
 {
-  int64_t pos, len;
+  int64_t pos;
 
   if     (whence == SEEK_SET)
     pos = offset;
@@ -137,28 +190,38 @@ int64_t CDVDInputStreamStack::Seek(int64_t offset, int whence)
   else
     return -1;
 
-  len = 0;
-  for(TSegVec::iterator it = m_files.begin(); it != m_files.end(); ++it)
+  // find the file containing the position
+  TSegVec::iterator it = std::upper_bound(m_files.begin(), m_files.end(), pos,
+                                          [](int64_t pos, const TSeg& segment)
+                                          { return pos < segment.start; });
+  if (it == m_files.begin())
+    return -1;
+  --it;
+  if (pos >= it->start + it->length)
+    return -1;
+
+  const size_t index = it - m_files.begin();
+  if (m_prefetch.valid() && m_prefetchSegment == index)
+    FinishPrefetch();
+
+  // the position after the beginning read ahead of time is restored when reading past it
+  TFile file = it->file;
+  int64_t file_pos = pos - it->start;
+  if (file_pos >= static_cast<int64_t>(it->head.size()) && file->GetPosition() != file_pos)
   {
-    if(len + it->length > pos)
-    {
-      TFile   file     = it->file;
-      int64_t file_pos = pos - len;
-      if(file->GetPosition() != file_pos)
-      {
-        if(file->Seek(file_pos, SEEK_SET) < 0)
-          return false;
-      }
-
-      m_file = file;
-      m_pos  = pos;
-      m_eof  = false;
-      return pos;
-    }
-    len += it->length;
+    if (file->Seek(file_pos, SEEK_SET) < 0)
+      return -1;
   }
 
-  return -1;
+  // the beginning read ahead of time is only needed once
+  if (index != m_segment)
+    m_files[m_segment].head = {};
+
+  m_file    = file;
+  m_segment = index;
+  m_pos     = pos;
+  m_eof     = false;
+  return pos;
 }
 
 int64_t CDVDInputStreamStack::GetLength()
@@ -167,3 +230,35 @@ int64_t CDVDInputStreamStack::GetLength()
 }
 
 
+
+void CDVDInputStreamStack::PrefetchNext()
+{
+  if (m_prefetch.valid())
+  {
+    if (m_prefetch.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+      FinishPrefetch();
+    return;
+  }
+
+  const size_t next = m_segment + 1;
+  if (next >= m_files.size() || m_files[next].prefetched)
+    return;
+
+  const TSeg& segment = m_files[m_segment];
+  if (segment.start + segment.length - m_pos > PREFETCH_DISTANCE)
+    return;
+
+  m_files[next].prefetched = true;
+  m_prefetchSegment = next;
+  m_prefetch = std::async(std::launch::async, ReadHead, m_files[next].file);
+}
+
+void CDVDInputStreamStack::FinishPrefetch()
+{
+  if (!m_prefetch.valid())
+    return;
+
+  m_files[m_prefetchSegment].head = m_prefetch.get();
+  CLog::Log(LOGDEBUG, "CDVDInputStreamStack::FinishPrefetch - read {} bytes of part {} ahead",
+            m_files[m_prefetchSegment].head.size(), m_prefetchSegment + 1);
+}
@@ -10,7 +10,9 @@
 
 #include "DVDInputStream.h"
 
+#include <future>
 #include <memory>
+#include <stdint.h>
 #include <vector>
 
 class CDVDInputStreamStack : public CDVDInputStream
@@ -33,14 +35,32 @@ protected:
   struct TSeg
   {
     TFile file;
+    int64_t start; ///< position of the file in the stack
     int64_t length;
+    bool prefetched = false;
+    std::vector<uint8_t> head; ///< beginning of the file, read before playback reached it
   };
 
   typedef std::vector<TSeg> TSegVec;
 
+  /*!
+   * \brief Read the beginning of the next file in the background when the current one is about
+   * to end, so playback doesn't stall on the switch on slow sources.
+   */
+  void PrefetchNext();
+
+  /*!
+   * \brief Wait for the beginning of the next file being read in the background.
+   */
+  void FinishPrefetch();
+
   TSegVec m_files;  ///< collection of open ptr's to all files in stack
   TFile m_file;   ///< currently active file
+  size_t m_segment; ///< index of the currently active file
   bool m_eof;
   int64_t m_pos;
   int64_t m_length;
+
+  std::future<std::vector<uint8_t>> m_prefetch;
+  size_t m_prefetchSegment;
 };
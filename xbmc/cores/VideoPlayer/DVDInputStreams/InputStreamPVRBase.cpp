@@ -8,15 +8,20 @@
 
 #include "InputStreamPVRBase.h"
 
+#include "InputStreamPVRPrefetcher.h"
 #include "ServiceBroker.h"
 #include "cores/VideoPlayer/DVDDemuxers/DVDDemux.h"
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "filesystem/IFileTypes.h"
 #include "pvr/PVRManager.h"
 #include "pvr/addons/PVRClient.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/log.h"
 
+#include <mutex>
+
 CInputStreamPVRBase::CInputStreamPVRBase(IVideoPlayer* pPlayer, const CFileItem& fileitem)
   : CDVDInputStream(DVDSTREAM_TYPE_PVRMANAGER, fileitem),
     m_StreamProps(new PVR_STREAM_PROPERTIES()),
@@ -30,6 +35,7 @@ CInputStreamPVRBase::CInputStreamPVRBase(IVideoPlayer* pPlayer, const CFileItem&
 
 CInputStreamPVRBase::~CInputStreamPVRBase()
 {
+  m_prefetcher.reset();
   m_streamMap.clear();
 }
 
@@ -54,6 +60,7 @@ bool CInputStreamPVRBase::Open()
 
 void CInputStreamPVRBase::Close()
 {
+  m_prefetcher.reset();
   ClosePVRStream();
   CDVDInputStream::Close();
   m_eof = true;
@@ -101,9 +108,19 @@ int CInputStreamPVRBase::GetBlockSize()
   return ret;
 }
 
+bool CInputStreamPVRBase::GetCacheStatus(XFILE::SCacheStatus* status)
+{
+  if (!m_prefetcher)
+    return false;
+
+  m_prefetcher->GetCacheStatus(*status);
+  return true;
+}
+
 bool CInputStreamPVRBase::GetTimes(Times &times)
 {
   PVR_STREAM_TIMES streamTimes = {};
+  auto lock = LockDemux();
   if (m_client && m_client->GetStreamTimes(&streamTimes) == PVR_ERROR_NO_ERROR)
   {
     times.startTime = streamTimes.startTime;
@@ -135,6 +152,7 @@ bool CInputStreamPVRBase::CanSeek()
 
 void CInputStreamPVRBase::Pause(bool bPaused)
 {
+  auto lock = LockDemux();
   if (m_client)
     m_client->PauseStream(bPaused);
 }
@@ -155,6 +173,17 @@ bool CInputStreamPVRBase::OpenDemux()
   {
     m_client->GetStreamProperties(m_StreamProps.get());
     UpdateStreamMap();
+
+    const int prefetchSize =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_iPVRDemuxPrefetchSize;
+    if (!m_prefetcher && prefetchSize > 0 && CanPrefetchDemux())
+    {
+      CLog::Log(LOGDEBUG, "CInputStreamPVRBase - {} - reading ahead up to {} KiB", __FUNCTION__,
+                prefetchSize);
+      m_prefetcher = std::make_unique<CInputStreamPVRPrefetcher>(
+          m_client, static_cast<size_t>(prefetchSize) * 1024);
+      m_prefetcher->Start();
+    }
     return true;
   }
   else
@@ -169,21 +198,24 @@ DemuxPacket* CInputStreamPVRBase::ReadDemux()
     return nullptr;
 
   DemuxPacket* pPacket = nullptr;
-  m_client->DemuxRead(pPacket);
-  if (!pPacket)
+  if (m_prefetcher)
   {
-    return nullptr;
+    // the properties were fetched by the prefetch thread when the packet was read
+    std::shared_ptr<PVR_STREAM_PROPERTIES> props;
+    pPacket = m_prefetcher->Read(props);
+    if (props)
+      *m_StreamProps = *props;
   }
-  else if (pPacket->iStreamId == DMX_SPECIALID_STREAMINFO)
+  else
   {
-    m_client->GetStreamProperties(m_StreamProps.get());
-    return pPacket;
+    m_client->DemuxRead(pPacket);
+    if (pPacket && (pPacket->iStreamId == DMX_SPECIALID_STREAMINFO ||
+                    pPacket->iStreamId == DMX_SPECIALID_STREAMCHANGE))
+      m_client->GetStreamProperties(m_StreamProps.get());
   }
-  else if (pPacket->iStreamId == DMX_SPECIALID_STREAMCHANGE)
-  {
-    m_client->GetStreamProperties(m_StreamProps.get());
+
+  if (pPacket && pPacket->iStreamId == DMX_SPECIALID_STREAMCHANGE)
     UpdateStreamMap();
-  }
 
   return pPacket;
 }
@@ -215,34 +247,56 @@ int CInputStreamPVRBase::GetNrOfStreams() const
 
 void CInputStreamPVRBase::SetSpeed(int Speed)
 {
+  auto lock = LockDemux();
   if (m_client)
     m_client->SetSpeed(Speed);
 }
 
 void CInputStreamPVRBase::FillBuffer(bool mode)
 {
+  auto lock = LockDemux();
   if (m_client)
     m_client->FillBuffer(mode);
 }
 
 bool CInputStreamPVRBase::SeekTime(double timems, bool backwards, double *startpts)
 {
-  if (m_client)
-    return m_client->SeekTime(timems, backwards, startpts) == PVR_ERROR_NO_ERROR;
-  else
+  if (!m_client)
     return false;
+
+  auto lock = LockDemux();
+  const bool ret = m_client->SeekTime(timems, backwards, startpts) == PVR_ERROR_NO_ERROR;
+  if (ret && m_prefetcher)
+    m_prefetcher->Flush();
+
+  return ret;
 }
 
 void CInputStreamPVRBase::AbortDemux()
 {
   if (m_client)
     m_client->DemuxAbort();
+
+  if (m_prefetcher)
+    m_prefetcher->Abort();
 }
 
 void CInputStreamPVRBase::FlushDemux()
 {
+  auto lock = LockDemux();
   if (m_client)
     m_client->DemuxFlush();
+
+  if (m_prefetcher)
+    m_prefetcher->Flush();
+}
+
+std::unique_lock<CCriticalSection> CInputStreamPVRBase::LockDemux()
+{
+  if (m_prefetcher)
+    return std::unique_lock<CCriticalSection>(m_prefetcher->ClientSection());
+
+  return {};
 }
 
 std::shared_ptr<CDemuxStream> CInputStreamPVRBase::GetStreamInternal(int iStreamId)
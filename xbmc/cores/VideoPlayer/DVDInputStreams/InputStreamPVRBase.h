@@ -9,12 +9,15 @@
 #pragma once
 
 #include "DVDInputStream.h"
+#include "threads/CriticalSection.h"
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 class CFileItem;
+class CInputStreamPVRPrefetcher;
 class IDemux;
 class IVideoPlayer;
 struct PVR_STREAM_PROPERTIES;
@@ -39,6 +42,7 @@ public:
   bool IsEOF() override;
   int64_t GetLength() override;
   int GetBlockSize() override;
+  bool GetCacheStatus(XFILE::SCacheStatus* status) override;
 
   ENextStream NextStream() override;
   bool IsRealtime() override;
@@ -76,8 +80,21 @@ protected:
   virtual bool CanPausePVRStream() = 0;
   virtual bool CanSeekPVRStream() = 0;
 
+  /*!
+   * @brief Whether packets demuxed by the client may be read ahead on a thread of their own.
+   */
+  virtual bool CanPrefetchDemux() { return false; }
+
   bool m_eof = true;
   std::shared_ptr<PVR_STREAM_PROPERTIES> m_StreamProps;
   std::map<int, std::shared_ptr<CDemuxStream>> m_streamMap;
   std::shared_ptr<PVR::CPVRClient> m_client;
+
+private:
+  /*!
+   * @brief Serialize a client call with the prefetch thread, if there is one.
+   */
+  std::unique_lock<CCriticalSection> LockDemux();
+
+  std::unique_ptr<CInputStreamPVRPrefetcher> m_prefetcher;
 };
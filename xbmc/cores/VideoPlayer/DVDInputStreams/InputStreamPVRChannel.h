@@ -27,6 +27,7 @@ protected:
   ENextStream NextPVRStream() override;
   bool CanPausePVRStream() override;
   bool CanSeekPVRStream() override;
+  bool CanPrefetchDemux() override { return m_bDemuxActive; }
 
 private:
   bool m_bDemuxActive = false;
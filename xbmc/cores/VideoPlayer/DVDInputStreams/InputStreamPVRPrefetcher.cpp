@@ -0,0 +1,184 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "InputStreamPVRPrefetcher.h"
+
+#include "ServiceBroker.h"
+#include "cores/DataCacheCore.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemux.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "filesystem/IFileTypes.h"
+#include "pvr/addons/PVRClient.h"
+
+#include <mutex>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// bounds the buffer for streams of many small packets, e.g. radio
+constexpr size_t MAX_PACKETS = 10000;
+constexpr auto READ_TIMEOUT = 100ms;
+constexpr auto PUBLISH_INTERVAL = 500ms;
+} // unnamed namespace
+
+CInputStreamPVRPrefetcher::CInputStreamPVRPrefetcher(
+    const std::shared_ptr<PVR::CPVRClient>& client, size_t maxBytes)
+  : CThread("PVRPrefetch"), m_client(client), m_maxBytes(maxBytes)
+{
+}
+
+CInputStreamPVRPrefetcher::~CInputStreamPVRPrefetcher()
+{
+  // wake the thread up in a blocking read of the client and when waiting for space
+  StopThread(false);
+  m_client->DemuxAbort();
+  m_spaceAvailable.Set();
+  StopThread(true);
+
+  Flush();
+  CServiceBroker::GetDataCacheCore().SetDemuxPrefetchStats(0, 0, 0);
+}
+
+void CInputStreamPVRPrefetcher::Start()
+{
+  m_readStart = std::chrono::steady_clock::now();
+  Create();
+}
+
+DemuxPacket* CInputStreamPVRPrefetcher::Read(std::shared_ptr<PVR_STREAM_PROPERTIES>& props)
+{
+  props.reset();
+
+  for (int attempt = 0; attempt < 2; ++attempt)
+  {
+    {
+      std::unique_lock<CCriticalSection> lock(m_queueSection);
+      if (!m_queue.empty())
+      {
+        Entry entry = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_bytes -= entry.packet->iSize;
+        m_empty = false;
+        m_spaceAvailable.Set();
+
+        props = std::move(entry.props);
+        return entry.packet;
+      }
+
+      if (attempt > 0 && !m_empty)
+      {
+        m_empty = true;
+        m_underruns++;
+      }
+    }
+
+    if (attempt == 0)
+      m_dataAvailable.Wait(READ_TIMEOUT);
+  }
+
+  return nullptr;
+}
+
+void CInputStreamPVRPrefetcher::Abort()
+{
+  m_dataAvailable.Set();
+}
+
+void CInputStreamPVRPrefetcher::Flush()
+{
+  std::unique_lock<CCriticalSection> lock(m_queueSection);
+  for (const auto& entry : m_queue)
+    CDVDDemuxUtils::FreeDemuxPacket(entry.packet);
+
+  m_queue.clear();
+  m_bytes = 0;
+  m_empty = true;
+  m_readBytes = 0;
+  m_readStart = std::chrono::steady_clock::now();
+  m_spaceAvailable.Set();
+}
+
+void CInputStreamPVRPrefetcher::GetCacheStatus(XFILE::SCacheStatus& status) const
+{
+  std::unique_lock<CCriticalSection> lock(m_queueSection);
+  status.maxforward = m_maxBytes;
+  status.forward = m_bytes;
+  status.maxrate = 0;
+  status.lowrate = 0;
+
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - m_readStart);
+  status.currate =
+      elapsed.count() > 0 ? static_cast<uint32_t>(m_readBytes * 1000 / elapsed.count()) : 0;
+}
+
+void CInputStreamPVRPrefetcher::Process()
+{
+  while (!m_bStop)
+  {
+    bool full;
+    {
+      std::unique_lock<CCriticalSection> lock(m_queueSection);
+      full = m_bytes >= m_maxBytes || m_queue.size() >= MAX_PACKETS;
+    }
+
+    if (full)
+    {
+      PublishStats();
+      AbortableWait(m_spaceAvailable, READ_TIMEOUT);
+      continue;
+    }
+
+    std::unique_lock<CCriticalSection> clientLock(m_clientSection);
+
+    DemuxPacket* packet = nullptr;
+    m_client->DemuxRead(packet);
+    if (!packet)
+    {
+      clientLock.unlock();
+      PublishStats();
+      Sleep(20ms);
+      continue;
+    }
+
+    // the properties belong to the position of the packet, the client may have moved on when
+    // the player gets to the packet
+    std::shared_ptr<PVR_STREAM_PROPERTIES> props;
+    if (packet->iStreamId == DMX_SPECIALID_STREAMINFO ||
+        packet->iStreamId == DMX_SPECIALID_STREAMCHANGE)
+    {
+      props = std::make_shared<PVR_STREAM_PROPERTIES>();
+      m_client->GetStreamProperties(props.get());
+    }
+
+    {
+      std::unique_lock<CCriticalSection> lock(m_queueSection);
+      m_queue.push_back({packet, std::move(props)});
+      m_bytes += packet->iSize;
+      m_readBytes += packet->iSize;
+    }
+    clientLock.unlock();
+
+    m_dataAvailable.Set();
+    PublishStats();
+  }
+}
+
+void CInputStreamPVRPrefetcher::PublishStats()
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (now - m_lastPublish < PUBLISH_INTERVAL)
+    return;
+
+  m_lastPublish = now;
+
+  std::unique_lock<CCriticalSection> lock(m_queueSection);
+  CServiceBroker::GetDataCacheCore().SetDemuxPrefetchStats(m_bytes, m_maxBytes, m_underruns);
+}
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+
+struct DemuxPacket;
+struct PVR_STREAM_PROPERTIES;
+
+namespace PVR
+{
+class CPVRClient;
+}
+
+namespace XFILE
+{
+struct SCacheStatus;
+}
+
+/*!
+ * \brief Reads demux packets of a live PVR stream ahead of the player into a bounded buffer.
+ *
+ * The packets are read on a thread of their own, so a backend that stalls for a moment does not
+ * stall the demuxer as long as the buffer holds data. Client calls that change the position of
+ * the stream have to hold ClientSection() and call Flush() afterwards, so that the thread neither
+ * reads concurrently nor leaves packets of the old position in the buffer.
+ */
+class CInputStreamPVRPrefetcher : private CThread
+{
+public:
+  CInputStreamPVRPrefetcher(const std::shared_ptr<PVR::CPVRClient>& client, size_t maxBytes);
+  ~CInputStreamPVRPrefetcher() override;
+
+  void Start();
+
+  /*!
+   * \brief Take the next buffered packet.
+   * \param[out] props the stream properties of the client when a stream info or stream change
+   * packet was read, nullptr otherwise
+   * \return the packet or nullptr if none arrived in time
+   */
+  DemuxPacket* Read(std::shared_ptr<PVR_STREAM_PROPERTIES>& props);
+
+  /*!
+   * \brief Wake up a pending Read().
+   */
+  void Abort();
+
+  /*!
+   * \brief Drop all buffered packets. The caller has to hold ClientSection().
+   */
+  void Flush();
+
+  CCriticalSection& ClientSection() { return m_clientSection; }
+
+  void GetCacheStatus(XFILE::SCacheStatus& status) const;
+
+private:
+  struct Entry
+  {
+    DemuxPacket* packet;
+    std::shared_ptr<PVR_STREAM_PROPERTIES> props;
+  };
+
+  void Process() override;
+  void PublishStats();
+
+  const std::shared_ptr<PVR::CPVRClient> m_client;
+  const size_t m_maxBytes;
+
+  CCriticalSection m_clientSection;
+
+  mutable CCriticalSection m_queueSection;
+  std::deque<Entry> m_queue;
+  size_t m_bytes = 0;
+  bool m_empty = true; ///< the buffer ran empty and did not deliver a packet since
+  unsigned int m_underruns = 0;
+  uint64_t m_readBytes = 0;
+  std::chrono::steady_clock::time_point m_readStart;
+
+  CEvent m_dataAvailable;
+  CEvent m_spaceAvailable;
+  std::chrono::steady_clock::time_point m_lastPublish;
+};
@@ -10,6 +10,7 @@
 
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "utils/MemUtils.h"
 #include "utils/log.h"
 
 #include <math.h>
@@ -17,6 +18,12 @@
 
 using namespace std::chrono_literals;
 
+namespace
+{
+// enough for several seconds of high bitrate video, the locked list takes the rest
+constexpr size_t DATA_RING_SIZE = 2048;
+}
+
 CDVDMessageQueue::CDVDMessageQueue(const std::string &owner) : m_hEvent(true), m_owner(owner)
 {
   m_iDataSize     = 0;
@@ -36,29 +43,52 @@ CDVDMessageQueue::~CDVDMessageQueue()
 
 void CDVDMessageQueue::Init()
 {
+  // nobody can put before we are initialized, so it is safe to set up the ring here
+  if (m_dataRing.Capacity() == 0)
+    m_dataRing.Resize(DATA_RING_SIZE);
+
   m_iDataSize = 0;
   m_bAbortRequest = false;
-  m_bInitialized = true;
   m_TimeBack = DVD_NOPTS_VALUE;
   m_TimeFront = DVD_NOPTS_VALUE;
   m_drain = false;
+  m_bInitialized = true;
 }
 
 void CDVDMessageQueue::Flush(CDVDMsg::Message type)
 {
   std::unique_lock<CCriticalSection> lock(m_section);
 
-  m_messages.remove_if([type](const DVDMessageListItem &item){
-    return type == CDVDMsg::NONE || item.message->IsType(type);
+  m_messages.remove_if([this, type](const DVDMessageListItem &item){
+    if (type != CDVDMsg::NONE && !item.message->IsType(type))
+      return false;
+
+    if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
+    {
+      DemuxPacket* packet =
+          std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
+      if (packet)
+        m_iDataSize -= packet->iSize;
+    }
+    return true;
   });
 
   m_prioMessages.remove_if([type](const DVDMessageListItem &item){
     return type == CDVDMsg::NONE || item.message->IsType(type);
   });
 
-  if (type == CDVDMsg::DEMUXER_PACKET ||  type == CDVDMsg::NONE)
+  // the ring only holds demuxer packets
+  if (type == CDVDMsg::DEMUXER_PACKET || type == CDVDMsg::NONE)
   {
-    m_iDataSize = 0;
+    DataRingItem item;
+    while (m_dataRing.TryPop(item))
+    {
+      DemuxPacket* packet =
+          std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
+      if (packet)
+        m_iDataSize -= packet->iSize;
+    }
+
     m_TimeBack = DVD_NOPTS_VALUE;
     m_TimeFront = DVD_NOPTS_VALUE;
   }
@@ -95,12 +125,36 @@ MsgQueueReturnCode CDVDMessageQueue::PutBack(const std::shared_ptr<CDVDMsg>& pMs
   return Put(pMsg, priority, false);
 }
 
+bool CDVDMessageQueue::PutData(const std::shared_ptr<CDVDMsg>& pMsg)
+{
+  // a second producer falls back to the locked list instead of corrupting the ring
+  if (m_producerBusy.test_and_set(std::memory_order_acquire))
+    return false;
+
+  DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(pMsg.get())->GetPacket();
+
+  // account before publishing, the consumer must never subtract what was not added yet
+  if (packet)
+    m_iDataSize += packet->iSize;
+
+  DataRingItem item{pMsg, ++m_sequence};
+  const bool queued = m_dataRing.TryPush(std::move(item));
+  if (packet)
+  {
+    if (queued)
+      UpdateTimeFront(packet);
+    else
+      m_iDataSize -= packet->iSize;
+  }
+
+  m_producerBusy.clear(std::memory_order_release);
+  return queued;
+}
+
 MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
                                          int priority,
                                          bool front)
 {
-  std::unique_lock<CCriticalSection> lock(m_section);
-
   if (!m_bInitialized)
   {
     CLog::Log(LOGWARNING, "CDVDMessageQueue({})::Put MSGQ_NOT_INITIALIZED", m_owner);
@@ -112,6 +166,16 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     return MSGQ_INVALID_MSG;
   }
 
+  // fast path for the demuxer, no lock
+  if (priority == 0 && front && pMsg->IsType(CDVDMsg::DEMUXER_PACKET) && PutData(pMsg))
+  {
+    // inform waiter for new packet
+    m_hEvent.Set();
+    return MSGQ_OK;
+  }
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+
   if (priority > 0)
   {
     int prio = priority;
@@ -126,17 +190,11 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
   }
   else
   {
-    if (m_messages.empty())
-    {
-      m_iDataSize = 0;
-      m_TimeBack = DVD_NOPTS_VALUE;
-      m_TimeFront = DVD_NOPTS_VALUE;
-    }
-
+    // messages put back are older than anything else in the queue
     if (front)
-      m_messages.emplace_front(pMsg, priority);
+      m_messages.emplace_front(pMsg, priority, ++m_sequence);
     else
-      m_messages.emplace_back(pMsg, priority);
+      m_messages.emplace_back(pMsg, priority, 0);
   }
 
   if (pMsg->IsType(CDVDMsg::DEMUXER_PACKET) && priority == 0)
@@ -146,7 +204,7 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     {
       m_iDataSize += packet->iSize;
       if (front)
-        UpdateTimeFront();
+        UpdateTimeFront(packet);
       else
         UpdateTimeBack();
     }
@@ -158,6 +216,47 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
   return MSGQ_OK;
 }
 
+bool CDVDMessageQueue::GetNext(std::shared_ptr<CDVDMsg>& pMsg, int& priority)
+{
+  if (priority > 0 || !m_prioMessages.empty())
+  {
+    if (m_prioMessages.empty() || (m_prioMessages.back().priority < priority && !m_drain))
+      return false;
+
+    DVDMessageListItem& item(m_prioMessages.back());
+    priority = item.priority;
+    pMsg = std::move(item.message);
+    m_prioMessages.pop_back();
+    return true;
+  }
+
+  // oldest of the ring and the list goes first
+  DataRingItem* ringItem = m_dataRing.Front();
+  if (ringItem && (m_messages.empty() || ringItem->sequence < m_messages.back().sequence))
+  {
+    DataRingItem item;
+    m_dataRing.TryPop(item);
+    pMsg = std::move(item.message);
+  }
+  else if (!m_messages.empty())
+  {
+    DVDMessageListItem& item(m_messages.back());
+    pMsg = std::move(item.message);
+    m_messages.pop_back();
+  }
+  else
+    return false;
+
+  priority = 0;
+  if (pMsg->IsType(CDVDMsg::DEMUXER_PACKET))
+  {
+    DemuxPacket* packet = std::static_pointer_cast<CDVDMsgDemuxerPacket>(pMsg)->GetPacket();
+    if (packet)
+      m_iDataSize -= packet->iSize;
+  }
+  return true;
+}
+
 MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
                                          std::chrono::milliseconds timeout,
                                          int& priority)
@@ -174,25 +273,8 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
 
   while (!m_bAbortRequest)
   {
-    std::list<DVDMessageListItem> &msgs = (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
-
-    if (!msgs.empty() && (msgs.back().priority >= priority || m_drain))
+    if (GetNext(pMsg, priority))
     {
-      DVDMessageListItem& item(msgs.back());
-      priority = item.priority;
-
-      if (item.message->IsType(CDVDMsg::DEMUXER_PACKET) && item.priority == 0)
-      {
-        DemuxPacket* packet =
-            std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
-        if (packet)
-        {
-          m_iDataSize -= packet->iSize;
-        }
-      }
-
-      pMsg = std::move(item.message);
-      msgs.pop_back();
       UpdateTimeBack();
       ret = MSGQ_OK;
       break;
@@ -205,6 +287,12 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
     else
     {
       m_hEvent.Reset();
+
+      // the demuxer does not take our lock, check the ring again after the reset so that we do
+      // not miss a packet put in between
+      if (priority <= 0 && m_prioMessages.empty() && !m_dataRing.Empty())
+        continue;
+
       lock.unlock();
 
       // wait for a new message
@@ -221,48 +309,39 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
   return (MsgQueueReturnCode)ret;
 }
 
-void CDVDMessageQueue::UpdateTimeFront()
+void CDVDMessageQueue::UpdateTimeFront(const DemuxPacket* packet)
 {
-  if (!m_messages.empty())
-  {
-    auto &item = m_messages.front();
-    if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
-    {
-      DemuxPacket* packet =
-          std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
-      if (packet)
-      {
-        if (packet->dts != DVD_NOPTS_VALUE)
-          m_TimeFront = packet->dts;
-        else if (packet->pts != DVD_NOPTS_VALUE)
-          m_TimeFront = packet->pts;
-
-        if (m_TimeBack == DVD_NOPTS_VALUE)
-          m_TimeBack = m_TimeFront;
-      }
-    }
-  }
+  if (packet->dts != DVD_NOPTS_VALUE)
+    m_TimeFront = packet->dts;
+  else if (packet->pts != DVD_NOPTS_VALUE)
+    m_TimeFront = packet->pts;
+
+  if (m_TimeBack == DVD_NOPTS_VALUE)
+    m_TimeBack = m_TimeFront.load();
 }
 
 void CDVDMessageQueue::UpdateTimeBack()
 {
-  if (!m_messages.empty())
+  // find the oldest non priority message
+  std::shared_ptr<CDVDMsg>* oldest = nullptr;
+  DataRingItem* ringItem = m_dataRing.Front();
+  if (ringItem && (m_messages.empty() || ringItem->sequence < m_messages.back().sequence))
+    oldest = &ringItem->message;
+  else if (!m_messages.empty())
+    oldest = &m_messages.back().message;
+
+  if (oldest && (*oldest)->IsType(CDVDMsg::DEMUXER_PACKET))
   {
-    auto &item = m_messages.back();
-    if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
+    DemuxPacket* packet = std::static_pointer_cast<CDVDMsgDemuxerPacket>(*oldest)->GetPacket();
+    if (packet)
     {
-      DemuxPacket* packet =
-          std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
-      if (packet)
-      {
-        if (packet->dts != DVD_NOPTS_VALUE)
-          m_TimeBack = packet->dts;
-        else if (packet->pts != DVD_NOPTS_VALUE)
-          m_TimeBack = packet->pts;
-
-        if (m_TimeFront == DVD_NOPTS_VALUE)
-          m_TimeFront = m_TimeBack;
-      }
+      if (packet->dts != DVD_NOPTS_VALUE)
+        m_TimeBack = packet->dts;
+      else if (packet->pts != DVD_NOPTS_VALUE)
+        m_TimeBack = packet->pts;
+
+      if (m_TimeFront == DVD_NOPTS_VALUE)
+        m_TimeFront = m_TimeBack.load();
     }
   }
 }
@@ -285,6 +364,8 @@ unsigned CDVDMessageQueue::GetPacketCount(CDVDMsg::Message type)
     if(item.message->IsType(type))
       count++;
   }
+  if (type == CDVDMsg::DEMUXER_PACKET)
+    count += m_dataRing.Size();
 
   return count;
 }
@@ -309,22 +390,24 @@ void CDVDMessageQueue::WaitUntilEmpty()
 
 int CDVDMessageQueue::GetLevel(bool data_level) const
 {
-  std::unique_lock<CCriticalSection> lock(m_section);
+  // lock free, the GUI polls this through the data cache while the demuxer is busy putting
+  const uint64_t dataSize = static_cast<uint64_t>(std::max<int64_t>(0, m_iDataSize));
+  const uint64_t maxDataSize = m_iMaxDataSize;
 
-  if (m_iDataSize > m_iMaxDataSize)
+  if (dataSize > maxDataSize)
     return 100;
-  if (m_iDataSize == 0)
+  if (dataSize == 0)
     return 0;
 
   if (IsDataBased() || data_level)
   {
-    return std::min((uint64_t)100, 100 * m_iDataSize / m_iMaxDataSize);
+    return std::min((uint64_t)100, 100 * dataSize / maxDataSize);
   }
 
   int level = std::min(100.0, ceil(100.0 * m_TimeSize * (m_TimeFront - m_TimeBack) / DVD_TIME_BASE ));
 
   // if we added lots of packets with NOPTS, make sure that the queue is not signalled empty
-  if (level == 0 && m_iDataSize != 0)
+  if (level == 0 && dataSize != 0)
   {
     CLog::Log(LOGDEBUG, "CDVDMessageQueue::GetLevel() - can't determine level");
     return 1;
@@ -333,10 +416,43 @@ int CDVDMessageQueue::GetLevel(bool data_level) const
   return level;
 }
 
-int CDVDMessageQueue::GetTimeSize() const
+bool CDVDMessageQueue::AdaptMaxDataSize(double bitrate)
 {
-  std::unique_lock<CCriticalSection> lock(m_section);
+  constexpr uint64_t MIN_DATA_SIZE = 8 * 1024 * 1024;
+  constexpr uint64_t MAX_DATA_SIZE = 256 * 1024 * 1024;
+  constexpr auto ADAPT_INTERVAL = std::chrono::seconds(2);
+
+  const auto now = std::chrono::steady_clock::now();
+  if (bitrate <= 0.0 || now - m_adaptTime < ADAPT_INTERVAL)
+    return false;
+  m_adaptTime = now;
+
+  // room for the time limit plus peaks of the bitrate
+  const double seconds = 1.0 / m_TimeSize;
+  uint64_t size = static_cast<uint64_t>(bitrate / 8 * seconds * 1.25);
+  size = std::max(MIN_DATA_SIZE, std::min(MAX_DATA_SIZE, size));
+
+  // don't let the queues of a high bitrate stream take the memory the system needs
+  KODI::MEMORY::MemoryStatus memory;
+  KODI::MEMORY::GetMemoryStatus(&memory);
+  if (memory.availPhys > 0)
+    size = std::min(size, std::max(MIN_DATA_SIZE / 2, memory.availPhys / 8));
+
+  // avoid changing the limit for small variations of the bitrate
+  const uint64_t current = m_iMaxDataSize;
+  if (size > current - current / 4 && size < current + current / 4)
+    return false;
+
+  CLog::Log(LOGDEBUG,
+            "CDVDMessageQueue({})::{} - {:.1f} Mbit/s, {} MB free, max data size {} -> {} MB",
+            m_owner, __FUNCTION__, bitrate / 1e6, memory.availPhys / (1024 * 1024),
+            current / (1024 * 1024), size / (1024 * 1024));
+  m_iMaxDataSize = size;
+  return true;
+}
 
+int CDVDMessageQueue::GetTimeSize() const
+{
   if (IsDataBased())
     return 0;
   else
@@ -11,15 +11,18 @@
 #include "DVDMessage.h"
 #include "threads/CriticalSection.h"
 #include "threads/Event.h"
+#include "threads/SPSCQueue.h"
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <list>
 #include <string>
 
 struct DVDMessageListItem
 {
-  DVDMessageListItem(std::shared_ptr<CDVDMsg> msg, int prio) : message(std::move(msg))
+  DVDMessageListItem(std::shared_ptr<CDVDMsg> msg, int prio, uint64_t seq = 0)
+    : message(std::move(msg)), sequence(seq)
   {
     priority = prio;
   }
@@ -31,6 +34,7 @@ struct DVDMessageListItem
 
   std::shared_ptr<CDVDMsg> message;
   int priority;
+  uint64_t sequence; //!< put order of non priority messages, shared with the data ring
 };
 
 enum MsgQueueReturnCode
@@ -73,7 +77,7 @@ public:
     return Get(pMsg, timeout, priority);
   }
 
-  int GetDataSize() const { return m_iDataSize; }
+  int GetDataSize() const { return static_cast<int>(std::max<int64_t>(0, m_iDataSize)); }
   int GetTimeSize() const;
   unsigned GetPacketCount(CDVDMsg::Message type);
   bool ReceivedAbortRequest() { return m_bAbortRequest; }
@@ -84,31 +88,59 @@ public:
   int GetLevel(bool data_level = false) const;
 
   void SetMaxDataSize(int iMaxDataSize) { m_iMaxDataSize = iMaxDataSize; }
-  void SetMaxTimeSize(double sec) { m_TimeSize  = 1.0 / std::max(1.0, sec); }
+  void SetMaxTimeSize(double sec) { m_TimeSize = 1.0 / std::max(1.0, sec); }
   int GetMaxDataSize() const { return m_iMaxDataSize; }
+
+  /*!
+   * \brief Size the data limit for the bitrate of the stream, so that the time limit is reached
+   * first, within what the free memory of the system allows. Only evaluated every few seconds,
+   * must be called from the consumer thread.
+   * \param bitrate measured bitrate of the stream in bit/s
+   * \return true if the limit was changed
+   */
+  bool AdaptMaxDataSize(double bitrate);
   double GetMaxTimeSize() const { return m_TimeSize; }
   bool IsInited() const { return m_bInitialized; }
   bool IsDataBased() const;
 
 private:
+  struct DataRingItem
+  {
+    std::shared_ptr<CDVDMsg> message;
+    uint64_t sequence = 0;
+  };
+
   MsgQueueReturnCode Put(const std::shared_ptr<CDVDMsg>& pMsg, int priority, bool front);
-  void UpdateTimeFront();
+  bool PutData(const std::shared_ptr<CDVDMsg>& pMsg);
+  bool GetNext(std::shared_ptr<CDVDMsg>& pMsg, int& priority);
+  void UpdateTimeFront(const DemuxPacket* packet);
   void UpdateTimeBack();
 
   CEvent m_hEvent;
   mutable CCriticalSection m_section;
 
   std::atomic<bool> m_bAbortRequest = false;
-  bool m_bInitialized;
+  std::atomic<bool> m_bInitialized;
   bool m_drain = false;
 
-  uint64_t m_iDataSize;
-  double m_TimeFront;
-  double m_TimeBack;
-  double m_TimeSize;
+  std::atomic<int64_t> m_iDataSize;
+  std::atomic<double> m_TimeFront;
+  std::atomic<double> m_TimeBack;
+  std::atomic<double> m_TimeSize;
 
-  uint64_t m_iMaxDataSize;
+  std::atomic<uint64_t> m_iMaxDataSize;
   std::string m_owner;
+  std::chrono::steady_clock::time_point m_adaptTime;
+
+  /*!
+   * Plain demuxer packets are put by a single thread (the demuxer) and bypass m_section through
+   * this ring. Everything else, and data that does not fit, goes to the locked lists. All consumer
+   * side access of the ring happens with m_section held. m_sequence keeps the order between the
+   * ring and m_messages.
+   */
+  XbmcThreads::CSPSCQueue<DataRingItem> m_dataRing;
+  std::atomic_flag m_producerBusy = ATOMIC_FLAG_INIT;
+  std::atomic<uint64_t> m_sequence{0};
 
   std::list<DVDMessageListItem> m_messages;
   std::list<DVDMessageListItem> m_prioMessages;
@@ -23,6 +23,8 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <cstring>
 #include <mutex>
 
@@ -35,6 +37,20 @@ constexpr int ASS_BORDER_STYLE_OUTLINE = 1; // Outline + drop shadow
 constexpr int ASS_BORDER_STYLE_BOX = 3; // Box + drop shadow
 constexpr int ASS_BORDER_STYLE_SQUARE_BOX = 4; // Square box + outline
 
+// Number of frames rendered in advance
+constexpr size_t LOOKAHEAD_FRAMES = 8;
+// Longest frame interval to render ahead for, anything longer is a pause or a seek
+constexpr double LOOKAHEAD_MAX_INTERVAL = DVD_MSEC_TO_TIME(200);
+
+bool IsSameRenderOpts(const renderOpts& a, const renderOpts& b)
+{
+  return a.frameWidth == b.frameWidth && a.frameHeight == b.frameHeight &&
+         a.videoWidth == b.videoWidth && a.videoHeight == b.videoHeight &&
+         a.sourceWidth == b.sourceWidth && a.sourceHeight == b.sourceHeight &&
+         a.m_par == b.m_par && a.marginsMode == b.marginsMode && a.position == b.position &&
+         a.horizontalAlignment == b.horizontalAlignment;
+}
+
 // Convert RGB/ARGB to RGBA by also applying the opacity value
 COLOR::Color ConvColor(COLOR::Color argbColor, int opacity = 100)
 {
@@ -51,7 +67,7 @@ static void libass_log(int level, const char* fmt, va_list args, void* data)
   CLog::Log(LOGDEBUG, "CDVDSubtitlesLibass: [ass] {}", log);
 }
 
-CDVDSubtitlesLibass::CDVDSubtitlesLibass()
+CDVDSubtitlesLibass::CDVDSubtitlesLibass() : CThread("SubtitlesLibass")
 {
   CLog::Log(LOGINFO, "CDVDSubtitlesLibass: Using libass version {0:x}", ass_library_version());
   CLog::Log(LOGINFO, "CDVDSubtitlesLibass: Creating ASS library structure");
@@ -71,6 +87,13 @@ CDVDSubtitlesLibass::CDVDSubtitlesLibass()
 
 CDVDSubtitlesLibass::~CDVDSubtitlesLibass()
 {
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    m_bStop = true;
+    m_lookAheadEvent.notifyAll();
+  }
+  StopThread();
+
   if (m_track)
     ass_free_track(m_track);
   ass_renderer_done(m_renderer);
@@ -164,6 +187,7 @@ bool CDVDSubtitlesLibass::DecodeHeader(char* data, int size)
 
   CLog::Log(LOGINFO, "CDVDSubtitlesLibass: Creating new ASS track");
   m_track = ass_new_track(m_library);
+  Invalidate();
 
   ass_process_codec_private(m_track, data, size);
   return true;
@@ -178,6 +202,8 @@ bool CDVDSubtitlesLibass::DecodeDemuxPkt(const char* data, int size, double star
     return false;
   }
 
+  // an event only changes the frames from its start on, which are usually not rendered yet
+  DropLookAheadFrom(DVD_TIME_TO_MSEC(start));
   //! @bug libass isn't const correct
   ass_process_chunk(m_track, const_cast<char*>(data), size, DVD_TIME_TO_MSEC(start),
                     DVD_TIME_TO_MSEC(duration));
@@ -246,6 +272,7 @@ bool CDVDSubtitlesLibass::CreateTrack(char* buf, size_t size)
   CLog::Log(LOGINFO, "CDVDSubtitlesLibass: Creating m_track from SSA buffer");
 
   m_track = ass_read_memory(m_library, buf, size, 0);
+  Invalidate();
   if (m_track == NULL)
     return false;
 
@@ -271,6 +298,12 @@ ASS_Image* CDVDSubtitlesLibass::RenderImage(double pts,
     return nullptr;
   }
 
+  if (updateStyle || m_currentDefaultStyleId == ASS_NO_ID || !IsSameRenderOpts(opts, m_lastOpts))
+  {
+    Invalidate();
+    m_lastOpts = opts;
+  }
+
   if (updateStyle || m_currentDefaultStyleId == ASS_NO_ID)
   {
     ApplyStyle(subStyle, opts);
@@ -332,9 +365,134 @@ ASS_Image* CDVDSubtitlesLibass::RenderImage(double pts,
   // if the playback occurs in sequence (without seeks) the overlapped subtitles lines will be rendered in right order
   // if you seek forward/backward the video, the overlapped subtitles lines could be rendered in the wrong order
   // this is a known side effect from libass devs and not a bug from our part
+  if (m_subtitleType == NATIVE)
+    return RenderLookAhead(pts, changes);
+
   return ass_render_frame(m_renderer, m_track, DVD_TIME_TO_MSEC(pts), changes);
 }
 
+ASS_Image* CDVDSubtitlesLibass::RenderLookAhead(double pts, int* changes)
+{
+  int dummy;
+  if (!changes)
+    changes = &dummy;
+
+  const int64_t time = DVD_TIME_TO_MSEC(pts);
+
+  // the same frame again, e.g. rendered for the next display refresh
+  if (m_currentFrame && m_currentFrame->generation == m_generation &&
+      m_currentFrame->time == time)
+  {
+    *changes = 0;
+    return m_currentFrame->images.empty() ? nullptr : m_currentFrame->images.data();
+  }
+
+  const int64_t previousTime = m_currentFrame ? m_currentFrame->time : -1;
+
+  // frames of an older track or configuration, or from before a seek
+  while (!m_lookAheadFrames.empty() && (m_lookAheadFrames.front()->generation != m_generation ||
+                                        m_lookAheadFrames.front()->time < time - 1))
+    m_lookAheadFrames.pop_front();
+
+  // the timestamps of many containers are in ms, which makes the predicted times of the following
+  // frames off by one ms every now and then
+  std::shared_ptr<RenderedFrame> frame;
+  if (!m_lookAheadFrames.empty() && std::abs(m_lookAheadFrames.front()->time - time) <= 1)
+  {
+    frame = m_lookAheadFrames.front();
+    m_lookAheadFrames.pop_front();
+  }
+  else
+  {
+    m_lookAheadFrames.clear();
+    frame = RenderFrame(pts);
+  }
+
+  // the changes reported by libass are only meaningful relative to the frame shown before
+  *changes = (frame->previousTime == previousTime) ? frame->changes : 2;
+  m_currentFrame = frame;
+
+  const double interval = pts - m_lastPts;
+  m_lastPts = pts;
+  if (interval > 0 && interval < LOOKAHEAD_MAX_INTERVAL)
+  {
+    m_frameInterval = interval;
+    if (!IsRunning())
+      Create();
+    m_lookAheadEvent.notifyAll();
+  }
+  else
+  {
+    m_frameInterval = 0.0;
+  }
+
+  return frame->images.empty() ? nullptr : frame->images.data();
+}
+
+std::shared_ptr<CDVDSubtitlesLibass::RenderedFrame> CDVDSubtitlesLibass::RenderFrame(double pts)
+{
+  auto frame = std::make_shared<RenderedFrame>();
+  frame->pts = pts;
+  frame->time = DVD_TIME_TO_MSEC(pts);
+  frame->previousTime = m_lastRenderedTime;
+  frame->generation = m_generation;
+
+  ASS_Image* images = ass_render_frame(m_renderer, m_track, frame->time, &frame->changes);
+  m_lastRenderedTime = frame->time;
+
+  // the images of libass are only valid until the next call, keep a copy
+  size_t count = 0;
+  size_t size = 0;
+  for (ASS_Image* img = images; img; img = img->next)
+  {
+    count++;
+    size += static_cast<size_t>(img->stride) * img->h;
+  }
+
+  frame->images.resize(count);
+  frame->bitmaps.resize(size);
+  size_t offset = 0;
+  size_t i = 0;
+  for (ASS_Image* img = images; img; img = img->next, i++)
+  {
+    const size_t bitmapSize = static_cast<size_t>(img->stride) * img->h;
+    ASS_Image& copy = frame->images[i];
+    copy = *img;
+    copy.bitmap = frame->bitmaps.data() + offset;
+    std::memcpy(copy.bitmap, img->bitmap, bitmapSize);
+    copy.next = (i + 1 < count) ? &frame->images[i + 1] : nullptr;
+    offset += bitmapSize;
+  }
+
+  return frame;
+}
+
+void CDVDSubtitlesLibass::DropLookAheadFrom(int64_t time)
+{
+  while (!m_lookAheadFrames.empty() && m_lookAheadFrames.back()->time >= time)
+    m_lookAheadFrames.pop_back();
+}
+
+void CDVDSubtitlesLibass::Process()
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+
+  while (!m_bStop)
+  {
+    if (m_frameInterval <= 0.0 || !m_currentFrame || !m_track ||
+        m_currentFrame->generation != m_generation ||
+        m_lookAheadFrames.size() >= LOOKAHEAD_FRAMES)
+    {
+      m_lookAheadEvent.wait(lock, std::chrono::milliseconds(100));
+      continue;
+    }
+
+    const double lastPts =
+        m_lookAheadFrames.empty() ? m_currentFrame->pts : m_lookAheadFrames.back()->pts;
+    m_lookAheadFrames.emplace_back(RenderFrame(lastPts + m_frameInterval));
+  }
+}
+
 void CDVDSubtitlesLibass::ApplyStyle(const std::shared_ptr<struct style>& subStyle, renderOpts opts)
 {
   CLog::Log(LOGDEBUG, "{} - Start setting up the LibAss style", __FUNCTION__);
@@ -628,6 +786,7 @@ int CDVDSubtitlesLibass::AddEvent(const char* text,
   int eventId = ass_alloc_event(m_track);
   if (eventId >= 0)
   {
+    Invalidate();
     ASS_Event* event = m_track->events + eventId;
     event->Start = DVD_TIME_TO_MSEC(startTime);
     event->Duration = DVD_TIME_TO_MSEC(stopTime - startTime);
@@ -676,6 +835,7 @@ void CDVDSubtitlesLibass::AppendTextToEvent(int eventId, const char* text)
     free(assEvent->Text);
     assEvent->Text = strdup(appendedText);
     delete[] appendedText;
+    Invalidate();
   }
 }
 
@@ -700,7 +860,10 @@ void CDVDSubtitlesLibass::ChangeEventStopTime(int eventId, double stopTime)
 
   ASS_Event* assEvent = (assEvents + eventId);
   if (assEvent)
+  {
     assEvent->Duration = (DVD_TIME_TO_MSEC(stopTime) - assEvent->Start);
+    Invalidate();
+  }
 }
 
 void CDVDSubtitlesLibass::FlushEvents()
@@ -713,6 +876,7 @@ void CDVDSubtitlesLibass::FlushEvents()
   }
 
   ass_flush_events(m_track);
+  Invalidate();
 }
 
 int CDVDSubtitlesLibass::DeleteEvents(int nEvents, int threshold)
@@ -731,6 +895,7 @@ int CDVDSubtitlesLibass::DeleteEvents(int nEvents, int threshold)
 
   // Currently LibAss do not have delete event method we have to free the events
   // and reassign all events starting with the first empty position
+  Invalidate();
   int n = 0;
   for (; n < nEvents; n++)
   {
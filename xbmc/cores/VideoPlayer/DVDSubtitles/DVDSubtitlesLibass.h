@@ -9,10 +9,15 @@
 #pragma once
 
 #include "SubtitlesStyle.h"
+#include "threads/Condition.h"
 #include "threads/CriticalSection.h"
+#include "threads/Thread.h"
 #include "utils/ColorUtils.h"
 
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include <ass/ass.h>
 #include <ass/ass_types.h>
@@ -27,11 +32,11 @@ enum ASSSubType
   ADAPTED
 };
 
-class CDVDSubtitlesLibass
+class CDVDSubtitlesLibass : private CThread
 {
 public:
   CDVDSubtitlesLibass();
-  ~CDVDSubtitlesLibass();
+  ~CDVDSubtitlesLibass() override;
 
   /*!
   * \brief Configure libass. This method groups any configurations
@@ -39,6 +44,13 @@ public:
   */
   void Configure();
 
+  /*!
+  * \brief Render the subtitles to show at a pts
+  *
+  * Native ASS/SSA subtitles, which can have heavy typesetting, are rendered ahead of time on a
+  * separate thread for the next frames, so that usually only a prerendered frame is returned here.
+  * The images are valid until the next call.
+  */
   ASS_Image* RenderImage(double pts,
                          KODI::SUBTITLES::STYLE::renderOpts opts,
                          bool updateStyle,
@@ -149,6 +161,26 @@ protected:
 
 
 private:
+  struct RenderedFrame
+  {
+    double pts{0.0};
+    int64_t time{0};
+    //! time of the frame the changes are relative to
+    int64_t previousTime{0};
+    int changes{0};
+    uint64_t generation{0};
+    std::vector<ASS_Image> images;
+    std::vector<unsigned char> bitmaps;
+  };
+
+  // CThread
+  void Process() override;
+
+  ASS_Image* RenderLookAhead(double pts, int* changes);
+  std::shared_ptr<RenderedFrame> RenderFrame(double pts);
+  void Invalidate() { m_generation++; }
+  void DropLookAheadFrom(int64_t time);
+
   void ConfigureAssOverride(const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& subStyle,
                             ASS_Style* style);
   void ApplyStyle(const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& subStyle,
@@ -166,4 +198,15 @@ private:
   // default allocated style ID for the kodi user configured subtitle style
   int m_defaultKodiStyleId{ASS_NO_ID};
   std::string m_defaultFontFamilyName;
+
+  // look-ahead rendering, all protected by m_section
+  XbmcThreads::ConditionVariable m_lookAheadEvent;
+  std::deque<std::shared_ptr<RenderedFrame>> m_lookAheadFrames;
+  std::shared_ptr<RenderedFrame> m_currentFrame;
+  KODI::SUBTITLES::STYLE::renderOpts m_lastOpts{};
+  //! changes with every modification of the track or render options
+  uint64_t m_generation{0};
+  int64_t m_lastRenderedTime{-1};
+  double m_lastPts{0.0};
+  double m_frameInterval{0.0};
 };
@@ -19,6 +19,8 @@ extern "C"
 {
 #endif /* __cplusplus */
 
+  struct AVBufferRef;
+
   struct DemuxPacket : DEMUX_PACKET
   {
     DemuxPacket()
@@ -54,6 +56,10 @@ extern "C"
     bool isELPackage;
     /// @brief The 3D MVC subtitle plane
     int subtitlePlane;
+    //! @brief Usable size of pData as handed out by the packet pool.
+    int iAllocSize{0};
+    //! @brief Reference to the libavformat buffer pData points into, if the payload was not copied.
+    AVBufferRef* pBufferRef{nullptr};
   };
 
 #ifdef __cplusplus
@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "KeyframeIndexJob.h"
+
+#include "DVDDemuxers/DVDDemuxFFmpeg.h"
+#include "DVDDemuxers/DVDDemuxUtils.h"
+#include "DVDInputStreams/DVDFactoryInputStream.h"
+#include "DVDInputStreams/DVDInputStream.h"
+#include "URL.h"
+#include "utils/log.h"
+
+#include <cstring>
+
+namespace
+{
+constexpr unsigned int PACKETS_PER_CANCEL_CHECK = 1000;
+} // unnamed namespace
+
+CKeyframeIndexJob::CKeyframeIndexJob(const CFileItem& item) : m_item(item)
+{
+}
+
+bool CKeyframeIndexJob::operator==(const CJob* job) const
+{
+  if (strcmp(job->GetType(), GetType()) != 0)
+    return false;
+
+  const auto* indexJob = static_cast<const CKeyframeIndexJob*>(job);
+  return indexJob->m_item.GetDynPath() == m_item.GetDynPath();
+}
+
+bool CKeyframeIndexJob::DoWork()
+{
+  const std::string redactPath = CURL::GetRedacted(m_item.GetDynPath());
+
+  std::shared_ptr<CDVDInputStream> inputStream =
+      CDVDFactoryInputStream::CreateInputStream(nullptr, m_item);
+  if (!inputStream || !inputStream->Open())
+  {
+    CLog::LogF(LOGERROR, "unable to open {}", redactPath);
+    return false;
+  }
+
+  CDVDDemuxFFmpeg demuxer;
+  if (!demuxer.Open(inputStream))
+  {
+    CLog::LogF(LOGERROR, "unable to demux {}", redactPath);
+    return false;
+  }
+
+  // indexed by another job in the meantime, or not a file the index is used for
+  if (!demuxer.NeedsKeyframeIndex())
+    return true;
+
+  CLog::LogF(LOGDEBUG, "indexing keyframes of {}", redactPath);
+
+  const int64_t length = inputStream->GetLength();
+  unsigned int packets = 0;
+  while (DemuxPacket* packet = demuxer.Read())
+  {
+    CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+    if (++packets % PACKETS_PER_CANCEL_CHECK != 0 || length <= 0)
+      continue;
+
+    const int64_t pos = inputStream->Seek(0, SEEK_CUR);
+    if (ShouldCancel(static_cast<unsigned int>(pos * 100 / length), 100))
+    {
+      CLog::LogF(LOGDEBUG, "indexing of {} cancelled", redactPath);
+      return false;
+    }
+  }
+
+  if (!inputStream->IsEOF())
+  {
+    CLog::LogF(LOGWARNING, "reading {} failed before the end", redactPath);
+    return false;
+  }
+
+  demuxer.SaveKeyframeIndex();
+  return true;
+}
@@ -0,0 +1,32 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "FileItem.h"
+#include "utils/Job.h"
+
+/*!
+ * \brief Reads a recording to the end to store the byte positions of its keyframes.
+ *
+ * Seeking in transport streams searches the file for the timestamp, which takes a while for every
+ * commercial break skipped. With the stored index, CDVDDemuxFFmpeg seeks right to the keyframe
+ * before the end of the cut instead. The job is queued by the player while the recording plays.
+ */
+class CKeyframeIndexJob : public CJob
+{
+public:
+  explicit CKeyframeIndexJob(const CFileItem& item);
+
+  bool DoWork() override;
+  const char* GetType() const override { return "KeyframeIndexJob"; }
+  bool operator==(const CJob* job) const override;
+
+private:
+  CFileItem m_item;
+};
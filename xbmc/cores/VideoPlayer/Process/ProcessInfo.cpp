@@ -71,6 +71,7 @@ void CProcessInfo::ResetVideoCodecInfo()
 
   m_videoIsHWDecoder = false;
   m_videoDecoderName = "unknown";
+  m_videoDecoderThreading.clear();
   m_videoDeintMethod = "unknown";
   m_videoPixelFormat = "unknown";
   m_videoStereoMode.clear();
@@ -115,6 +116,20 @@ std::string CProcessInfo::GetVideoDecoderName()
   return m_videoDecoderName;
 }
 
+void CProcessInfo::SetVideoDecoderThreading(const std::string& threading)
+{
+  std::unique_lock<CCriticalSection> lock(m_videoCodecSection);
+
+  m_videoDecoderThreading = threading;
+}
+
+std::string CProcessInfo::GetVideoDecoderThreading()
+{
+  std::unique_lock<CCriticalSection> lock(m_videoCodecSection);
+
+  return m_videoDecoderThreading;
+}
+
 bool CProcessInfo::IsVideoHwDecoder()
 {
   std::unique_lock<CCriticalSection> lock(m_videoCodecSection);
@@ -0,0 +1,425 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoFrameExtractor.h"
+
+#include "DVDDemuxers/DVDDemux.h"
+#include "DVDDemuxers/DVDDemuxUtils.h"
+#include "DVDDemuxers/DVDFactoryDemuxer.h"
+#include "DVDInputStreams/DVDFactoryInputStream.h"
+#include "DVDInputStreams/DVDInputStream.h"
+#include "FileItem.h"
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "guilib/Texture.h"
+#include "settings/Settings.h"
+#include "settings/SettingsComponent.h"
+#include "settings/lib/Setting.h"
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+#include "utils/CPUInfo.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+extern "C"
+{
+#include <libavutil/pixdesc.h>
+#include <libswscale/swscale.h>
+}
+
+namespace
+{
+// hardware decoders of embedded devices only have a few sessions, playback needs one of them
+constexpr int MAX_CONCURRENT_EXTRACTIONS = 2;
+
+struct HwDevice
+{
+  AVHWDeviceType type;
+  const char* setting;
+};
+
+// in order of preference, only used if the decoder is also enabled for playback
+constexpr HwDevice HW_DEVICES[] = {
+    {AV_HWDEVICE_TYPE_VAAPI, "videoplayer.usevaapi"},
+    {AV_HWDEVICE_TYPE_DRM, CSettings::SETTING_VIDEOPLAYER_USEPRIMEDECODER},
+    {AV_HWDEVICE_TYPE_VIDEOTOOLBOX, CSettings::SETTING_VIDEOPLAYER_USEVTB},
+    {AV_HWDEVICE_TYPE_D3D11VA, CSettings::SETTING_VIDEOPLAYER_USEDXVA2},
+};
+
+bool IsSettingEnabled(const char* id)
+{
+  const auto settings = CServiceBroker::GetSettingsComponent()->GetSettings();
+  const auto setting = std::dynamic_pointer_cast<CSettingBool>(settings->GetSetting(id));
+  return setting && setting->GetValue();
+}
+
+const char* GetHwDevicePath(AVHWDeviceType type)
+{
+  if (type != AV_HWDEVICE_TYPE_DRM)
+    return nullptr;
+
+  const char* device = getenv("KODI_RENDER_NODE");
+  return device ? device : "/dev/dri/renderD128";
+}
+
+int DegreeToOrientation(int degrees)
+{
+  switch (degrees)
+  {
+    case 90:
+      return 5;
+    case 180:
+      return 2;
+    case 270:
+      return 7;
+    default:
+      return 0;
+  }
+}
+
+/*!
+ * \brief Holds one of the decoding slots shared by all extractors while in scope
+ */
+class CExtractionSlot
+{
+public:
+  CExtractionSlot()
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    m_condition.wait(lock, [] { return m_active < MAX_CONCURRENT_EXTRACTIONS; });
+    m_active++;
+  }
+
+  ~CExtractionSlot()
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    m_active--;
+    m_condition.notifyAll();
+  }
+
+private:
+  static inline CCriticalSection m_section;
+  static inline XbmcThreads::ConditionVariable m_condition;
+  static inline int m_active = 0;
+};
+} // unnamed namespace
+
+CVideoFrameExtractor::CVideoFrameExtractor()
+{
+  m_packet = av_packet_alloc();
+  m_frame = av_frame_alloc();
+  m_swFrame = av_frame_alloc();
+}
+
+CVideoFrameExtractor::~CVideoFrameExtractor()
+{
+  CloseDecoder();
+  av_frame_free(&m_swFrame);
+  av_frame_free(&m_frame);
+  av_packet_free(&m_packet);
+}
+
+bool CVideoFrameExtractor::Open(const CFileItem& item)
+{
+  m_path = item.GetDynPath();
+  const std::string redactPath = CURL::GetRedacted(m_path);
+
+  CFileItem fileItem(item);
+  fileItem.SetMimeTypeForInternetFile();
+  m_inputStream = CDVDFactoryInputStream::CreateInputStream(nullptr, fileItem);
+  if (!m_inputStream)
+  {
+    CLog::Log(LOGERROR, "InputStream: Error creating stream for {}", redactPath);
+    return false;
+  }
+
+  if (!m_inputStream->Open())
+  {
+    CLog::Log(LOGERROR, "InputStream: Error opening, {}", redactPath);
+    return false;
+  }
+
+  m_demuxer.reset(CDVDFactoryDemuxer::CreateDemuxer(m_inputStream, true));
+  if (!m_demuxer)
+  {
+    CLog::LogF(LOGERROR, "Error creating demuxer");
+    return false;
+  }
+
+  CDemuxStream* videoStream = nullptr;
+  for (CDemuxStream* stream : m_demuxer->GetStreams())
+  {
+    if (!stream)
+      continue;
+
+    // ignore if it's a picture attachment (e.g. jpeg artwork)
+    if (stream->type == STREAM_VIDEO && !(stream->flags & AV_DISPOSITION_ATTACHED_PIC))
+      videoStream = stream;
+    else
+      m_demuxer->EnableStream(stream->demuxerId, stream->uniqueId, false);
+  }
+  if (!videoStream)
+    return false;
+
+  m_videoStream = videoStream->uniqueId;
+  m_hint.Assign(*videoStream, true);
+
+  const AVCodec* codec = avcodec_find_decoder(m_hint.codec);
+  if (!codec)
+  {
+    CLog::LogF(LOGDEBUG, "no decoder for codec {} in {}", m_hint.codec, redactPath);
+    return false;
+  }
+
+  for (const HwDevice& device : HW_DEVICES)
+  {
+    if (IsSettingEnabled(device.setting) && OpenDecoder(device.type))
+      return true;
+  }
+  return OpenDecoder(AV_HWDEVICE_TYPE_NONE);
+}
+
+int CVideoFrameExtractor::GetLength() const
+{
+  return m_demuxer ? m_demuxer->GetStreamLength() : 0;
+}
+
+int CVideoFrameExtractor::GetChapterCount() const
+{
+  return m_demuxer ? m_demuxer->GetChapterCount() : 0;
+}
+
+int64_t CVideoFrameExtractor::GetChapterPos(int chapter) const
+{
+  return m_demuxer ? m_demuxer->GetChapterPos(chapter) * 1000 : 0;
+}
+
+bool CVideoFrameExtractor::OpenDecoder(AVHWDeviceType type)
+{
+  CloseDecoder();
+
+  const AVCodec* codec = avcodec_find_decoder(m_hint.codec);
+  if (type != AV_HWDEVICE_TYPE_NONE)
+  {
+    const AVCodecHWConfig* config = nullptr;
+    for (int i = 0; (config = avcodec_get_hw_config(codec, i)); ++i)
+    {
+      if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) &&
+          config->device_type == type)
+        break;
+    }
+    if (!config)
+      return false;
+
+    m_hwPixelFormat = config->pix_fmt;
+  }
+
+  m_codecContext = avcodec_alloc_context3(codec);
+  if (!m_codecContext)
+    return false;
+
+  if (type != AV_HWDEVICE_TYPE_NONE)
+  {
+    if (av_hwdevice_ctx_create(&m_codecContext->hw_device_ctx, type, GetHwDevicePath(type),
+                               nullptr, 0) < 0)
+    {
+      CLog::LogF(LOGDEBUG, "unable to create {} device", av_hwdevice_get_type_name(type));
+      CloseDecoder();
+      return false;
+    }
+    m_codecContext->opaque = this;
+    m_codecContext->get_format = GetFormat;
+  }
+  else
+  {
+    // a thumbnail scaled down from the full frame does not need the deblocking
+    m_codecContext->skip_loop_filter = AVDISCARD_ALL;
+    m_codecContext->thread_type = FF_THREAD_SLICE;
+    m_codecContext->thread_count = CServiceBroker::GetCPUInfo()->GetCPUCount();
+  }
+
+  // after seeking to a keyframe only that frame is needed, the frames depending on it are skipped
+  m_codecContext->skip_frame = AVDISCARD_NONKEY;
+  m_codecContext->codec_tag = m_hint.codec_tag;
+  m_codecContext->coded_width = m_hint.width;
+  m_codecContext->coded_height = m_hint.height;
+  m_codecContext->bits_per_coded_sample = m_hint.bitsperpixel;
+
+  if (m_hint.extradata)
+  {
+    m_codecContext->extradata = static_cast<uint8_t*>(
+        av_mallocz(m_hint.extradata.GetSize() + AV_INPUT_BUFFER_PADDING_SIZE));
+    if (m_codecContext->extradata)
+    {
+      m_codecContext->extradata_size = m_hint.extradata.GetSize();
+      std::memcpy(m_codecContext->extradata, m_hint.extradata.GetData(),
+                  m_hint.extradata.GetSize());
+    }
+  }
+
+  if (avcodec_open2(m_codecContext, codec, nullptr) < 0)
+  {
+    CloseDecoder();
+    return false;
+  }
+
+  m_hwDeviceType = type;
+  CLog::LogF(LOGDEBUG, "using decoder {} ({})", codec->name,
+             type != AV_HWDEVICE_TYPE_NONE ? av_hwdevice_get_type_name(type) : "software");
+  return true;
+}
+
+void CVideoFrameExtractor::CloseDecoder()
+{
+  avcodec_free_context(&m_codecContext);
+  m_hwDeviceType = AV_HWDEVICE_TYPE_NONE;
+  m_hwPixelFormat = AV_PIX_FMT_NONE;
+}
+
+AVPixelFormat CVideoFrameExtractor::GetFormat(AVCodecContext* avctx, const AVPixelFormat* fmt)
+{
+  const CVideoFrameExtractor* extractor = static_cast<CVideoFrameExtractor*>(avctx->opaque);
+  for (const AVPixelFormat* p = fmt; *p != AV_PIX_FMT_NONE; ++p)
+  {
+    if (*p == extractor->m_hwPixelFormat)
+      return *p;
+  }
+
+  // the hardware can't decode this stream, e.g. because of its profile
+  return AV_PIX_FMT_NONE;
+}
+
+std::unique_ptr<CTexture> CVideoFrameExtractor::ExtractFrame(int64_t time, unsigned int maxWidth)
+{
+  if (!m_codecContext)
+    return {};
+
+  CExtractionSlot slot;
+
+  CLog::LogF(LOGDEBUG, "seeking to pos {}ms (total: {}ms) in {}", time, GetLength(),
+             CURL::GetRedacted(m_path));
+
+  bool decoded = false;
+  while (true)
+  {
+    if (!m_demuxer->SeekTime(static_cast<double>(time), true))
+      return {};
+
+    avcodec_flush_buffers(m_codecContext);
+    decoded = DecodeKeyFrame();
+    if (decoded || m_hwDeviceType == AV_HWDEVICE_TYPE_NONE)
+      break;
+
+    CLog::LogF(LOGDEBUG, "{} decoding failed, retrying in software",
+               av_hwdevice_get_type_name(m_hwDeviceType));
+    if (!OpenDecoder(AV_HWDEVICE_TYPE_NONE))
+      return {};
+  }
+
+  if (!decoded)
+  {
+    CLog::LogF(LOGDEBUG, "decode failed in {}", CURL::GetRedacted(m_path));
+    return {};
+  }
+
+  return ConvertFrame(maxWidth);
+}
+
+bool CVideoFrameExtractor::DecodeKeyFrame()
+{
+  // num streams * 160 frames, should get a valid frame, if not abort.
+  int abortIndex = m_demuxer->GetNrOfStreams() * 160;
+  while (true)
+  {
+    int ret = avcodec_receive_frame(m_codecContext, m_frame);
+    if (ret == 0)
+      return true;
+    if (ret != AVERROR(EAGAIN) || abortIndex-- <= 0)
+      return false;
+
+    DemuxPacket* demuxPacket = m_demuxer->Read();
+    if (!demuxPacket)
+    {
+      // end of file, get what is still in the decoder
+      avcodec_send_packet(m_codecContext, nullptr);
+      continue;
+    }
+
+    if (demuxPacket->iStreamId != m_videoStream || demuxPacket->isELPackage)
+    {
+      CDVDDemuxUtils::FreeDemuxPacket(demuxPacket);
+      continue;
+    }
+
+    m_packet->data = demuxPacket->pData;
+    m_packet->size = demuxPacket->iSize;
+    ret = avcodec_send_packet(m_codecContext, m_packet);
+    av_packet_unref(m_packet);
+    CDVDDemuxUtils::FreeDemuxPacket(demuxPacket);
+
+    if (ret < 0 && ret != AVERROR_INVALIDDATA && ret != AVERROR(EAGAIN))
+      return false;
+  }
+}
+
+std::unique_ptr<CTexture> CVideoFrameExtractor::ConvertFrame(unsigned int maxWidth)
+{
+  // hardware frames are copied to system memory first
+  const AVFrame* frame = m_frame;
+  if (m_frame->format == m_hwPixelFormat && m_frame->hw_frames_ctx)
+  {
+    av_frame_unref(m_swFrame);
+    if (av_hwframe_transfer_data(m_swFrame, m_frame, 0) < 0)
+    {
+      CLog::LogF(LOGERROR, "unable to read back {} frame",
+                 av_hwdevice_get_type_name(m_hwDeviceType));
+      av_frame_unref(m_frame);
+      return {};
+    }
+    frame = m_swFrame;
+  }
+
+  if (frame->width <= 0 || frame->height <= 0)
+    return {};
+
+  double displayWidth = frame->width;
+  if (frame->sample_aspect_ratio.num > 0 && frame->sample_aspect_ratio.den > 0)
+    displayWidth *= av_q2d(frame->sample_aspect_ratio);
+
+  double aspect = displayWidth / frame->height;
+  if (m_hint.forced_aspect && m_hint.aspect != 0)
+    aspect = m_hint.aspect;
+
+  const unsigned int width =
+      std::max(1u, std::min(static_cast<unsigned int>(displayWidth), maxWidth));
+  const unsigned int height = std::max(1u, static_cast<unsigned int>(width / aspect));
+
+  std::unique_ptr<CTexture> result;
+  SwsContext* context = sws_getContext(frame->width, frame->height,
+                                       static_cast<AVPixelFormat>(frame->format), width, height,
+                                       AV_PIX_FMT_BGRA, SWS_FAST_BILINEAR, nullptr, nullptr, nullptr);
+  if (context)
+  {
+    result = CTexture::CreateTexture(width, height);
+    result->SetAlpha(false);
+    result->SetOrientation(DegreeToOrientation(m_hint.orientation));
+
+    uint8_t* dst[] = {result->GetPixels(), nullptr, nullptr, nullptr};
+    int dstStride[] = {static_cast<int>(result->GetPitch()), 0, 0, 0};
+    sws_scale(context, frame->data, frame->linesize, 0, frame->height, dst, dstStride);
+    sws_freeContext(context);
+  }
+
+  av_frame_unref(m_swFrame);
+  av_frame_unref(m_frame);
+  return result;
+}
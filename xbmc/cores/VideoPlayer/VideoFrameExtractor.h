@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "DVDStreamInfo.h"
+
+#include <memory>
+#include <string>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavutil/hwcontext.h>
+}
+
+class CDVDDemux;
+class CDVDInputStream;
+class CFileItem;
+class CTexture;
+
+/*!
+ * \brief Extracts still images, e.g. thumbnails and chapter images, from a video file.
+ *
+ * The file is opened once and any number of frames can be extracted from it. Only the keyframe at
+ * or before the requested time is decoded, with a hardware decoder of the platform if there is one
+ * that is enabled in the settings and supports the stream, and the frame is read back and scaled
+ * to the requested width. The number of extractions decoding at the same time is limited, so that
+ * many thumbnail jobs do not starve playback or each other.
+ */
+class CVideoFrameExtractor
+{
+public:
+  CVideoFrameExtractor();
+  ~CVideoFrameExtractor();
+
+  bool Open(const CFileItem& item);
+
+  const std::string& GetPath() const { return m_path; }
+
+  /*!
+   * \return the length of the video in ms
+   */
+  int GetLength() const;
+  int GetChapterCount() const;
+
+  /*!
+   * \return the start of a chapter in ms
+   */
+  int64_t GetChapterPos(int chapter) const;
+
+  /*!
+   * \brief Decode the keyframe at or before a time
+   * \param time Position in ms
+   * \param maxWidth Width of the texture, it is smaller if the video is
+   */
+  std::unique_ptr<CTexture> ExtractFrame(int64_t time, unsigned int maxWidth);
+
+private:
+  bool OpenDecoder(AVHWDeviceType type);
+  void CloseDecoder();
+  bool DecodeKeyFrame();
+  std::unique_ptr<CTexture> ConvertFrame(unsigned int maxWidth);
+
+  static AVPixelFormat GetFormat(AVCodecContext* avctx, const AVPixelFormat* fmt);
+
+  std::string m_path;
+  std::shared_ptr<CDVDInputStream> m_inputStream;
+  std::unique_ptr<CDVDDemux> m_demuxer;
+  CDVDStreamInfo m_hint;
+  int m_videoStream{-1};
+
+  AVCodecContext* m_codecContext{nullptr};
+  AVPacket* m_packet{nullptr};
+  AVFrame* m_frame{nullptr};
+  AVFrame* m_swFrame{nullptr};
+  AVHWDeviceType m_hwDeviceType{AV_HWDEVICE_TYPE_NONE};
+  AVPixelFormat m_hwPixelFormat{AV_PIX_FMT_NONE};
+};
@@ -25,6 +25,7 @@
 #include "DVDMessage.h"
 #include "FileItem.h"
 #include "GUIUserMessages.h"
+#include "KeyframeIndexJob.h"
 #include "LangInfo.h"
 #include "ServiceBroker.h"
 #include "URL.h"
@@ -33,12 +34,14 @@
 #include "VideoPlayerRadioRDS.h"
 #include "VideoPlayerVideo.h"
 #include "application/Application.h"
+#include "cores/AudioEngine/Interfaces/AE.h"
 #include "cores/DataCacheCore.h"
 #include "cores/EdlEdit.h"
 #include "cores/FFmpeg.h"
 #include "cores/VideoPlayer/Process/ProcessInfo.h"
 #include "cores/VideoPlayer/VideoRenderers/RenderManager.h"
 #include "dialogs/GUIDialogKaiToast.h"
+#include "filesystem/File.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/LocalizeStrings.h"
@@ -52,6 +55,7 @@
 #include "threads/SingleLock.h"
 #include "utils/AMLUtils.h"
 #include "utils/FontUtils.h"
+#include "utils/JSONVariantWriter.h"
 #include "utils/JobManager.h"
 #include "utils/LangCodeExpander.h"
 #include "utils/MathUtils.h"
@@ -65,6 +69,8 @@
 #include "video/VideoInfoTag.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -72,6 +78,12 @@
 
 using namespace std::chrono_literals;
 
+namespace
+{
+// written when playback ends if enabled in advancedsettings.xml, see WritePlaybackReport
+constexpr const char* PLAYBACK_REPORT_FILE = "special://temp/playbackreport.json";
+} // unnamed namespace
+
 //------------------------------------------------------------------------------
 // selection streams
 //------------------------------------------------------------------------------
@@ -792,47 +804,64 @@ bool CVideoPlayer::OpenInputStream()
     return false;
   }
 
-  // find any available external subtitles for non dvd files
+  // find any available external subtitles for non dvd files, listing the folder can take a
+  // while on network shares, so it runs while the demuxer is opened
   if (!m_pInputStream->IsStreamType(DVDSTREAM_TYPE_DVD) &&
       !m_pInputStream->IsStreamType(DVDSTREAM_TYPE_PVRMANAGER))
   {
-    // find any available external subtitles
-    std::vector<std::string> filenames;
-
-    if (!URIUtils::IsUPnP(m_item.GetPath()) &&
-        !m_item.GetProperty("no-ext-subs-scan").asBoolean(false))
-      CUtil::ScanForExternalSubtitles(m_item.GetDynPath(), filenames);
+    const bool scan = !URIUtils::IsUPnP(m_item.GetPath()) &&
+                      !m_item.GetProperty("no-ext-subs-scan").asBoolean(false);
 
     // load any subtitles from file item
+    std::vector<std::string> itemSubtitles;
     std::string key("subtitle:1");
     for (unsigned s = 1; m_item.HasProperty(key); key = StringUtils::Format("subtitle:{}", ++s))
-      filenames.push_back(m_item.GetProperty(key).asString());
+      itemSubtitles.push_back(m_item.GetProperty(key).asString());
 
-    for (unsigned int i=0;i<filenames.size();i++)
-    {
-      // if vobsub subtitle:
-      if (URIUtils::HasExtension(filenames[i], ".idx"))
-      {
-        std::string strSubFile;
-        if (CUtil::FindVobSubPair( filenames, filenames[i], strSubFile))
-          AddSubtitleFile(filenames[i], strSubFile);
-      }
-      else
-      {
-        if (!CUtil::IsVobSub(filenames, filenames[i] ))
+    m_externalSubtitles = std::async(
+        std::launch::async,
+        [path = m_item.GetDynPath(), scan, itemSubtitles = std::move(itemSubtitles)]()
         {
-          AddSubtitleFile(filenames[i]);
-        }
-      }
-    } // end loop over all subtitle files
+          std::vector<std::string> filenames;
+          if (scan)
+            CUtil::ScanForExternalSubtitles(path, filenames);
+          filenames.insert(filenames.end(), itemSubtitles.begin(), itemSubtitles.end());
+          return filenames;
+        });
   }
 
   m_clock.Reset();
   m_dvd.Clear();
 
+  MarkStartupStage("inputstream");
   return true;
 }
 
+void CVideoPlayer::AddExternalSubtitles()
+{
+  if (!m_externalSubtitles.valid())
+    return;
+
+  const std::vector<std::string> filenames = m_externalSubtitles.get();
+  for (unsigned int i = 0; i < filenames.size(); i++)
+  {
+    // if vobsub subtitle:
+    if (URIUtils::HasExtension(filenames[i], ".idx"))
+    {
+      std::string strSubFile;
+      if (CUtil::FindVobSubPair(filenames, filenames[i], strSubFile))
+        AddSubtitleFile(filenames[i], strSubFile);
+    }
+    else
+    {
+      if (!CUtil::IsVobSub(filenames, filenames[i]))
+      {
+        AddSubtitleFile(filenames[i]);
+      }
+    }
+  } // end loop over all subtitle files
+}
+
 bool CVideoPlayer::OpenDemuxStream()
 {
   CloseDemuxer();
@@ -876,6 +905,7 @@ bool CVideoPlayer::OpenDemuxStream()
 
   m_offset_pts = 0;
 
+  MarkStartupStage("demuxer");
   return true;
 }
 
@@ -1079,6 +1109,9 @@ bool CVideoPlayer::ReadPacket(DemuxPacket*& packet, CDemuxStream*& stream)
       UpdateContent();
       OpenDefaultStreams(false);
 
+      // packet sizes of the new streams are likely to differ, drop cached buffers
+      CDVDDemuxUtils::TrimPacketPool();
+
       // reevaluate HasVideo/Audio, we may have switched from/to a radio channel
       if(m_CurrentVideo.id < 0)
         m_HasVideo = false;
@@ -1225,6 +1258,10 @@ void CVideoPlayer::CheckBetterStream(CCurrentStream& current, CDemuxStream* stre
 
 void CVideoPlayer::Prepare()
 {
+  m_startupTime = std::chrono::steady_clock::now();
+  m_syncErrorStats = {};
+  CServiceBroker::GetDataCacheCore().ResetStartupTimeline();
+
   CFFmpegLog::SetLogLevel(1);
   SetPlaySpeed(DVD_PLAYSPEED_NORMAL);
   m_processInfo->SetSpeed(1.0);
@@ -1276,11 +1313,14 @@ void CVideoPlayer::Prepare()
     m_error = true;
     return;
   }
+  AddExternalSubtitles();
+
   // give players a chance to reconsider now codecs are known
   CreatePlayers();
 
   if (!discStateRestored)
     OpenDefaultStreams();
+  MarkStartupStage("streams");
 
   /*
    * Check to see if the demuxer should start at something other than time 0. This will be the case
@@ -1418,6 +1458,7 @@ void CVideoPlayer::Process()
         m_bAbortRequest = true;
         break;
       }
+      AddExternalSubtitles();
 
       // on channel switch we don't want to close stream players at this
       // time. we'll get the stream change event later
@@ -2132,6 +2173,7 @@ void CVideoPlayer::HandlePlaySpeed()
           cb->OnAVStarted(fileItem);
         });
         m_State.streamsReady = true;
+        MarkStartupStage("avstarted");
       }
     }
     else
@@ -2556,6 +2598,9 @@ void CVideoPlayer::OnExit()
   // set event to inform openfile something went wrong in case openfile is still waiting for this event
   SetCaching(CACHESTATE_DONE);
 
+  if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoPlaybackReport)
+    WritePlaybackReport();
+
   // close each stream
   if (!m_bAbortRequest)
     CLog::Log(LOGINFO, "VideoPlayer: eof, waiting for queues to empty");
@@ -2611,6 +2656,8 @@ void CVideoPlayer::OnExit()
 
   m_messenger.End();
 
+  CDVDDemuxUtils::TrimPacketPool();
+
   CFFmpegLog::ClearLogLevel();
   m_bStop = true;
 
@@ -2659,6 +2706,11 @@ void CVideoPlayer::HandleMessages()
         cb->OnPlayerCloseFile(fileItem, bookmark);
       });
 
+      // zapping between live tv channels: keep the audio output configured so the next channel
+      // does not have to wait for the sink to be drained and reopened
+      if (m_item.IsLiveTV() && msg.GetItem().IsLiveTV())
+        CServiceBroker::GetActiveAE()->KeepConfiguration(3000);
+
       m_item = msg.GetItem();
       m_playerOptions = msg.GetOptions();
 
@@ -3337,6 +3389,33 @@ void CVideoPlayer::GetGeneralInfo(std::string& strGeneralInfo)
                                     m_State.cache_offset * 100.0);
     }
 
+    uint64_t prefetchLevel;
+    uint64_t prefetchCapacity;
+    unsigned int prefetchUnderruns;
+    CServiceBroker::GetDataCacheCore().GetDemuxPrefetchStats(prefetchLevel, prefetchCapacity,
+                                                             prefetchUnderruns);
+    if (prefetchCapacity > 0)
+    {
+      strBuf += StringUtils::Format(", prefetch: {} / {} / {} underruns",
+                                    StringUtils::SizeToString(prefetchLevel),
+                                    StringUtils::SizeToString(prefetchCapacity), prefetchUnderruns);
+    }
+
+    unsigned int readsPerSecond;
+    uint64_t readBytesPerSecond;
+    CServiceBroker::GetDataCacheCore().GetDemuxReadStats(readsPerSecond, readBytesPerSecond);
+    if (readsPerSecond > 0)
+    {
+      strBuf += StringUtils::Format(", input: {} reads/s, {}/s", readsPerSecond,
+                                    StringUtils::SizeToString(readBytesPerSecond));
+    }
+
+    std::vector<std::string> stages;
+    for (const auto& [stage, elapsed] : CServiceBroker::GetDataCacheCore().GetStartupTimeline())
+      stages.emplace_back(StringUtils::Format("{} {}ms", stage, elapsed.count()));
+    if (!stages.empty())
+      strBuf += ", startup: " + StringUtils::Join(stages, " / ");
+
     strGeneralInfo = StringUtils::Format("Player: a/v:{: 6.3f}, {}", dDiff, strBuf);
   }
 }
@@ -3850,6 +3929,12 @@ bool CVideoPlayer::OpenVideoStream(CDVDStreamInfo& hint, bool reset)
     CServiceBroker::GetDataCacheCore().SetCuts(m_Edl.GetCutMarkers());
     CServiceBroker::GetDataCacheCore().SetSceneMarkers(m_Edl.GetSceneMarkers());
 
+    // index the keyframes of the recording in the background, so skipping cuts and commercial
+    // breaks jumps right to them
+    const auto demuxer = dynamic_cast<CDVDDemuxFFmpeg*>(m_pDemuxer.get());
+    if (m_Edl.HasEdits() && demuxer && demuxer->NeedsKeyframeIndex())
+      CServiceBroker::GetJobManager()->AddJob(new CKeyframeIndexJob(m_item), nullptr);
+
     static_cast<IDVDStreamPlayerVideo*>(player)->SetSpeed(m_streamPlayerSpeed);
     m_CurrentVideo.syncState = IDVDStreamPlayer::SYNC_STARTING;
     m_CurrentVideo.packets = 0;
@@ -4857,12 +4942,106 @@ int CVideoPlayer::AddSubtitleFile(const std::string& filename, const std::string
   return m_SelectionStreams.TypeIndexOf(STREAM_SUBTITLE, s.source, s.demuxerId, s.id);
 }
 
+void CVideoPlayer::SampleSyncError()
+{
+  if (m_CurrentAudio.id < 0 || m_CurrentVideo.id < 0 || m_playSpeed != DVD_PLAYSPEED_NORMAL ||
+      m_caching != CACHESTATE_DONE)
+    return;
+
+  const double apts = m_VideoPlayerAudio->GetCurrentPts();
+  const double vpts = m_VideoPlayerVideo->GetCurrentPts();
+  if (apts == DVD_NOPTS_VALUE || vpts == DVD_NOPTS_VALUE)
+    return;
+
+  const double error = std::abs(apts - vpts) / DVD_TIME_BASE;
+  m_syncErrorStats.samples++;
+  m_syncErrorStats.sum += error;
+  m_syncErrorStats.max = std::max(m_syncErrorStats.max, error);
+}
+
+void CVideoPlayer::WritePlaybackReport()
+{
+  CDataCacheCore& dataCache = CServiceBroker::GetDataCacheCore();
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - m_startupTime);
+
+  CVariant report(CVariant::VariantTypeObject);
+  report["file"] = CURL::GetRedacted(m_item.GetDynPath());
+  report["elapsedms"] = static_cast<int64_t>(elapsed.count());
+  report["mediatimems"] = static_cast<int64_t>(m_State.time);
+
+  CVariant startup(CVariant::VariantTypeObject);
+  for (const auto& [stage, stageElapsed] : dataCache.GetStartupTimeline())
+    startup[stage] = static_cast<int64_t>(stageElapsed.count());
+  report["startupms"] = startup;
+
+  if (m_CurrentVideo.id >= 0)
+  {
+    uint64_t decoded = 0;
+    uint64_t dropped = 0;
+    dataCache.GetVideoDecoderStats(decoded, dropped);
+    const CDataCacheCore::SPresentStats present = dataCache.GetPresentStats();
+
+    CVariant& video = report["video"];
+    video["decoder"] = m_processInfo->GetVideoDecoderName();
+    video["hwdecoder"] = m_processInfo->IsVideoHwDecoder();
+    video["pixelformat"] = m_processInfo->GetVideoPixelFormat();
+    video["deinterlace"] = m_processInfo->GetVideoDeintMethod();
+    int width = 0;
+    int height = 0;
+    m_processInfo->GetVideoDimensions(width, height);
+    video["width"] = width;
+    video["height"] = height;
+    video["fps"] = m_processInfo->GetVideoFps();
+    video["decodedframes"] = decoded;
+    video["decoderdroppedframes"] = dropped;
+    video["presentedframes"] = present.frames;
+    video["lateframes"] = present.late;
+    video["renderdroppedframes"] = present.dropped;
+    video["vsyncs"] = CVariant(CVariant::VariantTypeArray);
+    for (const uint64_t vsyncs : present.vsyncs)
+      video["vsyncs"].push_back(vsyncs);
+    if (elapsed.count() > 0)
+      video["presentedfps"] = static_cast<double>(present.frames) * 1000.0 / elapsed.count();
+  }
+
+  if (m_CurrentAudio.id >= 0)
+  {
+    CVariant& audio = report["audio"];
+    audio["decoder"] = m_processInfo->GetAudioDecoderName();
+    audio["channels"] = m_processInfo->GetAudioChannels();
+    audio["samplerate"] = m_processInfo->GetAudioSampleRate();
+  }
+
+  if (m_syncErrorStats.samples > 0)
+  {
+    CVariant& sync = report["avsync"];
+    sync["samples"] = m_syncErrorStats.samples;
+    sync["averageerrorms"] = m_syncErrorStats.sum * 1000.0 / m_syncErrorStats.samples;
+    sync["maxerrorms"] = m_syncErrorStats.max * 1000.0;
+  }
+
+  std::string json;
+  if (!CJSONVariantWriter::Write(report, json, true))
+    return;
+
+  CLog::Log(LOGINFO, "CVideoPlayer::{} - {}", __FUNCTION__, json);
+
+  XFILE::CFile file;
+  if (!file.OpenForWrite(PLAYBACK_REPORT_FILE, true) ||
+      file.Write(json.c_str(), json.size()) != static_cast<ssize_t>(json.size()))
+    CLog::Log(LOGWARNING, "CVideoPlayer::{} - unable to write {}", __FUNCTION__,
+              PLAYBACK_REPORT_FILE);
+}
+
 void CVideoPlayer::UpdatePlayState(double timeout)
 {
   if (m_State.timestamp != 0 &&
       m_State.timestamp + DVD_MSEC_TO_TIME(timeout) > m_clock.GetAbsoluteClock())
     return;
 
+  SampleSyncError();
+
   SPlayerState state(m_State);
 
   state.dts = DVD_NOPTS_VALUE;
@@ -5054,10 +5233,30 @@ void CVideoPlayer::UpdatePlayState(double timeout)
 
   m_processInfo->SetPlayTimes(state.startTime, state.time, state.timeMin, state.timeMax);
 
+  uint64_t poolHits, poolMisses;
+  CDVDDemuxUtils::GetPacketPoolStats(poolHits, poolMisses);
+  CServiceBroker::GetDataCacheCore().SetDemuxPacketPoolStats(poolHits, poolMisses);
+
+  if (const auto demuxer = dynamic_cast<CDVDDemuxFFmpeg*>(m_pDemuxer.get()))
+  {
+    unsigned int readsPerSecond;
+    uint64_t readBytesPerSecond;
+    demuxer->GetReadStats(readsPerSecond, readBytesPerSecond);
+    CServiceBroker::GetDataCacheCore().SetDemuxReadStats(readsPerSecond, readBytesPerSecond);
+  }
+
   std::unique_lock<CCriticalSection> lock(m_StateSection);
   m_State = state;
 }
 
+void CVideoPlayer::MarkStartupStage(const std::string& stage)
+{
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - m_startupTime);
+  CServiceBroker::GetDataCacheCore().AddStartupStage(stage, elapsed);
+  CLog::Log(LOGDEBUG, "CVideoPlayer::{} - {} after {} ms", __FUNCTION__, stage, elapsed.count());
+}
+
 int64_t CVideoPlayer::GetUpdatedTime()
 {
   UpdatePlayState(0);
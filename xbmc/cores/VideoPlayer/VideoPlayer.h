@@ -27,6 +27,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <future>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -464,11 +465,15 @@ protected:
   void CheckStreamChanges(CCurrentStream& current, CDemuxStream* stream);
 
   bool OpenInputStream();
+  void AddExternalSubtitles();
   bool OpenDemuxStream();
   void CloseDemuxer();
   void OpenDefaultStreams(bool reset = true);
 
   void UpdatePlayState(double timeout);
+  void SampleSyncError();
+  void WritePlaybackReport();
+  void MarkStartupStage(const std::string& stage);
   void GetGeneralInfo(std::string& strVideoInfo);
   int64_t GetUpdatedTime();
   int64_t GetTime();
@@ -537,6 +542,15 @@ protected:
 
   CDVDMessageQueue m_messenger;
   std::unique_ptr<CJobQueue> m_outboundEvents;
+  std::chrono::steady_clock::time_point m_startupTime;
+
+  // A/V sync error sampled during normal playback, for the playback report
+  struct SSyncErrorStats
+  {
+    unsigned int samples = 0;
+    double sum = 0.0; // seconds
+    double max = 0.0; // seconds
+  } m_syncErrorStats;
 
   IDVDStreamPlayerVideo *m_VideoPlayerVideo;
   IDVDStreamPlayerAudio *m_VideoPlayerAudio;
@@ -549,6 +563,7 @@ protected:
   CDVDOverlayContainer m_overlayContainer;
 
   std::shared_ptr<CDVDInputStream> m_pInputStream;
+  std::future<std::vector<std::string>> m_externalSubtitles;
   std::unique_ptr<CDVDDemux> m_pDemuxer;
   std::shared_ptr<CDVDDemux> m_pSubtitleDemuxer;
   std::unordered_map<int64_t, std::shared_ptr<CDVDDemux>> m_subtitleDemuxerMap;
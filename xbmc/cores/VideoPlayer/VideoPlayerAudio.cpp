@@ -199,6 +199,9 @@ void CVideoPlayerAudio::OnStartup()
 
 void CVideoPlayerAudio::UpdatePlayerInfo()
 {
+  if (m_messageQueue.AdaptMaxDataSize(m_audioStats.GetBitrate()))
+    m_dataCacheCore.SetAudioQueueMaxDataSize(m_messageQueue.GetMaxDataSize());
+
   std::ostringstream s;
   s << "aq:"     << std::setw(2) << std::min(99,m_messageQueue.GetLevel()) << "% (" << std::setw(2) << std::min(99,m_messageQueue.GetLevel(true)) << "%)";
   s << ", Kb/s:" << std::fixed << std::setprecision(2) << m_audioStats.GetBitrate() / 1024.0;
@@ -11,10 +11,12 @@
 #include "DVDCodecs/DVDFactoryCodec.h"
 #include "DVDCodecs/Overlay/DVDOverlay.h"
 #include "DVDCodecs/Overlay/DVDOverlayCodec.h"
+#include "DVDCodecs/Overlay/DVDOverlayImage.h"
 #include "DVDCodecs/Overlay/DVDOverlaySpu.h"
 #include "DVDSubtitles/DVDSubtitleParser.h"
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "cores/VideoPlayer/VideoRenderers/OverlayRendererUtil.h"
 #include "utils/log.h"
 
 #include <mutex>
@@ -56,6 +58,11 @@ void CVideoPlayerSubtitle::SendMessage(std::shared_ptr<CDVDMsg> pMsg, int priori
 
         while ((overlay = m_pOverlayCodec->GetOverlay()))
         {
+          // convert bitmaps, e.g. PGS and DVB, here instead of on the render thread, which
+          // then only has to upload them
+          if (overlay->IsOverlayType(DVDOVERLAY_TYPE_IMAGE))
+            OVERLAY::prepare_rgba(*std::static_pointer_cast<CDVDOverlayImage>(overlay));
+
           m_pOverlayContainer->ProcessAndAddOverlayIfValid(overlay);
         }
       }
@@ -212,6 +212,7 @@ void CDVDTeletextData::ResetTeletextCache()
   m_TXTCache->Page                     = 0x100;
   m_TXTCache->SubPage                  = m_TXTCache->SubPageTable[m_TXTCache->Page];
   m_TXTCache->line30                   = "";
+  m_TXTCache->ObjectVersion++;
   if (m_TXTCache->SubPage == 0xff)
     m_TXTCache->SubPage = 0;
 }
@@ -404,7 +405,15 @@ void CDVDTeletextData::Process()
             }
             else if (packet_number == 29 && dehamming[vtxt_row[2]]== 0) /* packet 29/0 replaces 28/0 for a whole magazine */
             {
+              TextExtData_t previous = {};
+              if (m_TXTCache->astP29[magazine])
+                memcpy(&previous, m_TXTCache->astP29[magazine], sizeof(TextExtData_t));
+
               Decode_p2829(vtxt_row, &(m_TXTCache->astP29[magazine]));
+
+              if (m_TXTCache->astP29[magazine] &&
+                  memcmp(&previous, m_TXTCache->astP29[magazine], sizeof(TextExtData_t)) != 0)
+                m_TXTCache->ObjectVersion++;
             }
             else if (m_TXTCache->CurrentPage[magazine] != -1 && m_TXTCache->CurrentSubPage[magazine] != -1)
               /* packet>0, 0 has been correctly received, buffer allocated */
@@ -724,6 +733,10 @@ void CDVDTeletextData::SavePage(int p, int sp, unsigned char* buffer)
     return;
   }
 
+  /* object and DRCS pages are used by other pages, which have to be decoded again */
+  if (!IsDec(p) && memcmp(pg->data, buffer, 23*40) != 0)
+    m_TXTCache->ObjectVersion++;
+
   memcpy(pg->data, buffer, 23*40);
 }
 
@@ -70,11 +70,13 @@ CVideoPlayerVideo::CVideoPlayerVideo(CDVDClock* pClock
   m_iDroppedRequest = 0;
   m_fForcedAspectRatio = 0;
 
-  // 128 MB allows max bitrate of 128 Mbit/s (e.g. UHD Blu-Ray) during 8 seconds
+  // 40 MB hold 8 seconds of 40 Mbit/s, the limit is adapted to the bitrate of the stream once
+  // it is known, see UpdatePlayerInfo
   m_messageQueue.SetMaxDataSize(40 * 1024 * 1024);
   m_messageQueue.SetMaxTimeSize(8.0);
 
   m_iDroppedFrames = 0;
+  m_decodedFrames = 0;
   m_fFrameRate = 25;
   m_fStableFrameRate = 0.0;
   m_iFrameRateCount = 0;
@@ -355,6 +357,7 @@ void CVideoPlayerVideo::Process()
   m_videoStats.Start();
   m_droppingStats.Reset();
   m_iDroppedFrames = 0;
+  m_decodedFrames = 0;
   m_rewindStalled = false;
   m_outputSate = OUTPUT_NORMAL;
 
@@ -665,6 +668,10 @@ void CVideoPlayerVideo::UpdatePlayerInfo()
   m_dataCacheCore.SetVideoLiveBitRate(GetVideoBitrate());  
   m_dataCacheCore.SetVideoQueueLevel(std::min(99, m_messageQueue.GetLevel()));
   m_dataCacheCore.SetVideoQueueDataLevel(std::min(99, m_messageQueue.GetLevel(true)));
+  m_dataCacheCore.SetVideoDecoderStats(m_decodedFrames, static_cast<uint64_t>(m_iDroppedFrames));
+
+  if (m_messageQueue.AdaptMaxDataSize(GetVideoBitrate()))
+    m_dataCacheCore.SetVideoQueueMaxDataSize(m_messageQueue.GetMaxDataSize());
 }
 
 bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
@@ -928,6 +935,7 @@ void CVideoPlayerVideo::ProcessOverlays(const VideoPicture* pSource, double pts)
 CVideoPlayerVideo::EOutputState CVideoPlayerVideo::OutputPicture(const VideoPicture* pPicture)
 {
   m_bAbortOutput = false;
+  m_decodedFrames++;
 
   if (m_processInfo.GetVideoStereoMode() != pPicture->stereoMode)
   {
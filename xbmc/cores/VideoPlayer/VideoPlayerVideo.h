@@ -112,6 +112,7 @@ protected:
   int m_iLateFrames;
   int m_iDroppedFrames;
   int m_iDroppedRequest;
+  uint64_t m_decodedFrames = 0; //!< pictures that came out of the decoder
 
   double m_fFrameRate;       //framerate of the video currently playing
   double m_fStableFrameRate; //place to store calculated framerates
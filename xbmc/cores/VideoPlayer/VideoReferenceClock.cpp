@@ -17,6 +17,8 @@
 #include "windowing/VideoSync.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
+#include <cmath>
 #include <mutex>
 
 CVideoReferenceClock::CVideoReferenceClock() : CThread("RefClock")
@@ -32,6 +34,9 @@ CVideoReferenceClock::CVideoReferenceClock() : CThread("RefClock")
   m_RefreshRate = 0.0;
   m_MissedVblanks = 0;
   m_VblankTime = 0;
+  m_PllTime = 0.0;
+  m_PllPeriod = 0.0;
+  m_PllJitter = 0.0;
   m_vsyncStopEvent.Reset();
 
   Start();
@@ -53,10 +58,42 @@ void CVideoReferenceClock::UpdateClock(int NrVBlanks, uint64_t time)
 {
   std::unique_lock<CCriticalSection> lock(m_CritSection);
 
-  m_VblankTime = time;
+  m_VblankTime = UpdatePll(NrVBlanks, time);
   UpdateClockInternal(NrVBlanks, true);
 }
 
+int64_t CVideoReferenceClock::UpdatePll(int NrVBlanks, int64_t time)
+{
+  // gains of the loop, the period follows slowly, so that single late timestamps do not move it
+  constexpr double PHASE_GAIN = 0.1;
+  constexpr double PERIOD_GAIN = 0.005;
+  constexpr double JITTER_GAIN = 0.02;
+
+  if (NrVBlanks <= 0 || m_RefreshRate <= 0.0)
+    return time;
+
+  const double nominal = static_cast<double>(m_SystemFrequency) / m_RefreshRate;
+
+  const double predicted = m_PllTime + m_PllPeriod * NrVBlanks;
+  const double error = static_cast<double>(time) - predicted;
+
+  // (re)lock on the first vblank and when the timestamps jump, e.g. after a mode switch
+  if (m_PllPeriod <= 0.0 || std::abs(error) > nominal / 2)
+  {
+    m_PllTime = static_cast<double>(time);
+    m_PllPeriod = nominal;
+    m_PllJitter = 0.0;
+    return time;
+  }
+
+  m_PllTime = predicted + PHASE_GAIN * error;
+  m_PllPeriod += PERIOD_GAIN * error / NrVBlanks;
+  m_PllPeriod = std::max(nominal * 0.99, std::min(nominal * 1.01, m_PllPeriod));
+  m_PllJitter += JITTER_GAIN * (std::abs(error) - m_PllJitter);
+
+  return static_cast<int64_t>(m_PllTime);
+}
+
 void CVideoReferenceClock::Process()
 {
   bool SetupSuccess = false;
@@ -80,6 +117,7 @@ void CVideoReferenceClock::Process()
     m_ClockSpeed = 1.0;
     m_TotalMissedVblanks = 0;
     m_MissedVblanks = 0;
+    m_PllPeriod = 0.0;
 
     if (SetupSuccess)
     {
@@ -154,6 +192,10 @@ void CVideoReferenceClock::UpdateClockInternal(int NrVBlanks, bool CheckMissed)
 
 double CVideoReferenceClock::UpdateInterval() const
 {
+  // advance by the measured period, the nominal refresh rate of the mode is only approximate
+  if (m_PllPeriod > 0.0)
+    return m_ClockSpeed * m_PllPeriod;
+
   return m_ClockSpeed / m_RefreshRate * static_cast<double>(m_SystemFrequency);
 }
 
@@ -182,7 +224,8 @@ int64_t CVideoReferenceClock::GetTime(bool interpolated /* = true*/)
       //interpolate from the last time the clock was updated
       double elapsed = static_cast<double>(Now - m_VblankTime) * m_ClockSpeed;
       //don't interpolate more than 2 vblank periods
-      elapsed = std::min(elapsed, UpdateInterval() * 2.0);
+      //the filtered vblank time can be slightly ahead of now
+      elapsed = std::max(0.0, std::min(elapsed, UpdateInterval() * 2.0));
 
       //make sure the clock doesn't go backwards
       int64_t intTime = m_CurrTime + static_cast<int64_t>(elapsed);
@@ -232,6 +275,7 @@ void CVideoReferenceClock::UpdateRefreshrate()
   std::unique_lock<CCriticalSection> SingleLock(m_CritSection);
   m_RefreshRate = static_cast<double>(m_pVideoSync->GetFps());
   m_ClockSpeed = 1.0;
+  m_PllPeriod = 0.0;
 
   CLog::Log(LOGDEBUG, "CVideoReferenceClock: Detected refreshrate: {:.3f} hertz", m_RefreshRate);
 }
@@ -275,3 +319,16 @@ bool CVideoReferenceClock::GetClockInfo(int& MissedVblanks, double& ClockSpeed,
   }
   return false;
 }
+
+bool CVideoReferenceClock::GetVblankInfo(double& MeasuredRefreshRate, double& Jitter) const
+{
+  std::unique_lock<CCriticalSection> SingleLock(m_CritSection);
+
+  if (m_UseVblank && m_PllPeriod > 0.0)
+  {
+    MeasuredRefreshRate = static_cast<double>(m_SystemFrequency) / m_PllPeriod;
+    Jitter = m_PllJitter * 1000.0 / static_cast<double>(m_SystemFrequency);
+    return true;
+  }
+  return false;
+}
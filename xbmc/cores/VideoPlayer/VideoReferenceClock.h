@@ -28,6 +28,13 @@ class CVideoReferenceClock : CThread
     double  GetRefreshRate(double* interval = nullptr);
     bool    GetClockInfo(int& MissedVblanks, double& ClockSpeed, double& RefreshRate) const;
 
+    /*!
+     * \brief Refresh rate measured from the vblank timestamps and how much they jitter
+     * \param MeasuredRefreshRate refresh rate in Hz
+     * \param Jitter mean deviation of the timestamps from the filtered clock in ms
+     */
+    bool GetVblankInfo(double& MeasuredRefreshRate, double& Jitter) const;
+
     void UpdateClock(int NrVBlanks, uint64_t time);
 
   private:
@@ -35,6 +42,7 @@ class CVideoReferenceClock : CThread
     void Start();
     void    UpdateRefreshrate();
     void UpdateClockInternal(int NrVBlanks, bool CheckMissed);
+    int64_t UpdatePll(int NrVBlanks, int64_t time);
     double  UpdateInterval() const;
     int64_t TimeOfNextVblank() const;
 
@@ -50,6 +58,12 @@ class CVideoReferenceClock : CThread
     int     m_TotalMissedVblanks;//total number of clock updates missed, used by codec information screen
     int64_t m_VblankTime;        //last time the clock was updated when using vblank as clock
 
+    // phase locked loop over the vblank timestamps of the video sync, removes the jitter of
+    // sources which only take the time when they notice the vblank
+    double  m_PllTime;           //filtered time of the last vblank
+    double  m_PllPeriod;         //filtered duration of a vblank period, 0 if not locked
+    double  m_PllJitter;         //mean deviation of the timestamps from the filtered time
+
     CEvent m_vsyncStopEvent;
 
     mutable CCriticalSection m_CritSection;
@@ -22,6 +22,7 @@
 #include "windowing/GraphicContext.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdlib> // std::abs(int) prototype
 
 
@@ -52,6 +53,15 @@ void CBaseRenderer::GetVideoRect(CRect& source, CRect& dest, CRect& view) const
   view = m_viewRect;
 }
 
+bool CBaseRenderer::IsUnscaled() const
+{
+  if (m_renderOrientation % 180 != 0)
+    return false;
+
+  return std::abs(m_destRect.Width() - m_sourceRect.Width()) < 0.5f &&
+         std::abs(m_destRect.Height() - m_sourceRect.Height()) < 0.5f;
+}
+
 inline void CBaseRenderer::ReorderDrawPoints()
 {
   // 0 - top left, 1 - top right, 2 - bottom right, 3 - bottom left
@@ -116,6 +116,11 @@ protected:
   void MarkDirty();
   void EnableAlwaysClip();
 
+  /*! \brief Whether the video is drawn at its own size, e.g. 4K video on a 4K display.
+   A scaler has nothing to do then and the video can be rendered without an intermediate pass.
+  */
+  bool IsUnscaled() const;
+
   //@todo drop those
   void saveRotatedCoords();//saves the current state of m_rotatedDestCoords
   void syncDestRectToRotatedPoints();//sync any changes of m_destRect to m_rotatedDestCoords
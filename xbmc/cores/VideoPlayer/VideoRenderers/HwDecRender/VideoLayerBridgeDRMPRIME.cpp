@@ -164,6 +164,8 @@ void CVideoLayerBridgeDRMPRIME::Configure(CVideoBufferDRMPRIME* buffer)
 
   winSystem->SetHDR(&picture);
 
+  SelectPlane(buffer);
+
   auto plane = m_DRM->GetVideoPlane();
 
   std::optional<uint64_t> colorEncoding =
@@ -177,6 +179,30 @@ void CVideoLayerBridgeDRMPRIME::Configure(CVideoBufferDRMPRIME* buffer)
     m_DRM->AddProperty(plane, "COLOR_RANGE", colorRange.value());
 }
 
+void CVideoLayerBridgeDRMPRIME::SelectPlane(CVideoBufferDRMPRIME* buffer)
+{
+  if (!buffer->AcquireDescriptor())
+    return;
+
+  AVDRMFrameDescriptor* descriptor = buffer->GetDescriptor();
+  CDRMPlane* plane = m_DRM->FindVideoPlane(descriptor->layers[0].format,
+                                           descriptor->objects[0].format_modifier);
+  buffer->ReleaseDescriptor();
+
+  auto current = m_DRM->GetVideoPlane();
+  if (!plane || plane == current)
+    return;
+
+  CLog::Log(LOGDEBUG, "CVideoLayerBridgeDRMPRIME::{} - switching video plane {} -> {}",
+            __FUNCTION__, current->GetPlaneId(), plane->GetPlaneId());
+
+  // the old plane may still show the last frame of the previous video, turn it off in the
+  // same commit as the new one is turned on
+  m_DRM->AddProperty(current, "FB_ID", 0);
+  m_DRM->AddProperty(current, "CRTC_ID", 0);
+  m_DRM->SetVideoPlane(plane);
+}
+
 void CVideoLayerBridgeDRMPRIME::SetVideoPlane(CVideoBufferDRMPRIME* buffer, const CRect& destRect)
 {
   if (!Map(buffer))
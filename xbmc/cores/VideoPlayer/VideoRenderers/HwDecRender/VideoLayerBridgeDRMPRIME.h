@@ -47,6 +47,7 @@ private:
   void Release(CVideoBufferDRMPRIME* buffer);
   bool Map(CVideoBufferDRMPRIME* buffer);
   void Unmap(CVideoBufferDRMPRIME* buffer);
+  void SelectPlane(CVideoBufferDRMPRIME* buffer);
 
   CVideoBufferDRMPRIME* m_buffer = nullptr;
   CVideoBufferDRMPRIME* m_prev_buffer = nullptr;
@@ -96,6 +96,7 @@ CLinuxRendererGL::CPictureBuffer::CPictureBuffer()
   memset(&fields, 0, sizeof(fields));
   memset(&image , 0, sizeof(image));
   memset(&pbo   , 0, sizeof(pbo));
+  memset(&pboMapped, 0, sizeof(pboMapped));
   videoBuffer = nullptr;
   loaded = false;
 }
@@ -699,10 +700,12 @@ void CLinuxRendererGL::UpdateVideoFilter()
 
   CRect srcRect, dstRect, viewRect;
   GetVideoRect(srcRect, dstRect, viewRect);
+  const bool unscaled = IsUnscaled();
 
   if (m_scalingMethodGui == m_videoSettings.m_ScalingMethod &&
       viewRect.Height() == m_viewRect.Height() &&
       viewRect.Width() == m_viewRect.Width() &&
+      unscaled == m_unscaled &&
       !nonLinStretchChanged && !cmsChanged)
     return;
   else
@@ -733,6 +736,7 @@ void CLinuxRendererGL::UpdateVideoFilter()
   m_scalingMethodGui = m_videoSettings.m_ScalingMethod;
   m_scalingMethod = m_scalingMethodGui;
   m_viewRect = viewRect;
+  m_unscaled = unscaled;
 
   if (!Supports(m_scalingMethod))
   {
@@ -764,6 +768,15 @@ void CLinuxRendererGL::UpdateVideoFilter()
       m_scalingMethod = VS_SCALINGMETHOD_LINEAR;
   }
 
+  // conversion, tone mapping, 3D LUT and dithering all happen in the single pass then, which
+  // saves writing and reading back a source sized framebuffer every frame
+  if (m_unscaled && !m_nonLinStretch && m_scalingMethod != VS_SCALINGMETHOD_NEAREST &&
+      m_scalingMethod != VS_SCALINGMETHOD_LINEAR)
+  {
+    CLog::Log(LOGDEBUG, "GL: Video is not scaled, using single pass rendering");
+    m_scalingMethod = VS_SCALINGMETHOD_LINEAR;
+  }
+
   switch (m_scalingMethod)
   {
   case VS_SCALINGMETHOD_NEAREST:
@@ -960,9 +973,18 @@ void CLinuxRendererGL::LoadShaders(int field)
   {
     CLog::Log(LOGINFO, "GL: Using GL_ARB_pixel_buffer_object");
     m_pboUsed = true;
+#if defined(GL_MAP_PERSISTENT_BIT)
+    m_pboPersistent =
+        CServiceBroker::GetRenderSystem()->IsExtSupported("GL_ARB_buffer_storage");
+    if (m_pboPersistent)
+      CLog::Log(LOGINFO, "GL: Using persistently mapped pixel buffer objects");
+#endif
   }
   else
+  {
     m_pboUsed = false;
+    m_pboPersistent = false;
+  }
 }
 
 void CLinuxRendererGL::UnInit()
@@ -1801,6 +1823,12 @@ bool CLinuxRendererGL::UploadTexture(int index)
 
     if (ret)
       m_buffers[index].loaded = true;
+
+#if defined(GL_MAP_PERSISTENT_BIT)
+    // the buffers stay mapped, the next copy into them has to wait until the upload is done
+    if (m_pboPersistent && m_buffers[index].pbo[0])
+      m_buffers[index].fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
   }
 
   if (ret)
@@ -1871,11 +1899,11 @@ bool CLinuxRendererGL::CreateYV12Texture(int index)
     for (int i = 0; i < 3; i++)
     {
       glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[i]);
-      glBufferData(GL_PIXEL_UNPACK_BUFFER, im.planesize[i] + PBO_OFFSET, 0, GL_STREAM_DRAW);
-      void* pboPtr = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+      void* pboPtr = MapPbo(im.planesize[i] + PBO_OFFSET);
       if (pboPtr)
       {
         im.plane[i] = (uint8_t*) pboPtr + PBO_OFFSET;
+        buf.pboMapped[i] = m_pboPersistent ? im.plane[i] : nullptr;
         memset(im.plane[i], 0, im.planesize[i]);
       }
       else
@@ -1895,6 +1923,7 @@ bool CLinuxRendererGL::CreateYV12Texture(int index)
       }
       glDeleteBuffers(3, pbo);
       memset(m_buffers[index].pbo, 0, sizeof(m_buffers[index].pbo));
+      memset(m_buffers[index].pboMapped, 0, sizeof(m_buffers[index].pboMapped));
     }
 
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
@@ -2053,8 +2082,10 @@ void CLinuxRendererGL::DeleteYV12Texture(int index)
     }
   }
 
+  WaitPbo(m_buffers[index]);
   for(int p = 0;p<YuvImage::MAX_PLANES;p++)
   {
+    m_buffers[index].pboMapped[p] = nullptr;
     if (pbo[p])
     {
       if (im.plane[p])
@@ -2177,11 +2208,11 @@ bool CLinuxRendererGL::CreateNV12Texture(int index)
     for (int i = 0; i < 2; i++)
     {
       glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[i]);
-      glBufferData(GL_PIXEL_UNPACK_BUFFER, im.planesize[i] + PBO_OFFSET, 0, GL_STREAM_DRAW);
-      void* pboPtr = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+      void* pboPtr = MapPbo(im.planesize[i] + PBO_OFFSET);
       if (pboPtr)
       {
         im.plane[i] = (uint8_t*)pboPtr + PBO_OFFSET;
+        buf.pboMapped[i] = m_pboPersistent ? im.plane[i] : nullptr;
         memset(im.plane[i], 0, im.planesize[i]);
       }
       else
@@ -2201,6 +2232,7 @@ bool CLinuxRendererGL::CreateNV12Texture(int index)
       }
       glDeleteBuffers(2, pbo);
       memset(m_buffers[index].pbo, 0, sizeof(m_buffers[index].pbo));
+      memset(m_buffers[index].pboMapped, 0, sizeof(m_buffers[index].pboMapped));
     }
 
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
@@ -2295,8 +2327,10 @@ void CLinuxRendererGL::DeleteNV12Texture(int index)
     buf.fields[f][2].id = 0;
   }
 
+  WaitPbo(buf);
   for(int p = 0;p<2;p++)
   {
+    buf.pboMapped[p] = nullptr;
     if (pbo[p])
     {
       if (im.plane[p])
@@ -2383,6 +2417,8 @@ void CLinuxRendererGL::DeleteYUV422PackedTexture(int index)
     buf.fields[f][2].id = 0;
   }
 
+  WaitPbo(buf);
+  buf.pboMapped[0] = nullptr;
   if (pbo[0])
   {
     if (im.plane[0])
@@ -2443,11 +2479,11 @@ bool CLinuxRendererGL::CreateYUV422PackedTexture(int index)
     glGenBuffers(1, pbo);
 
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[0]);
-    glBufferData(GL_PIXEL_UNPACK_BUFFER, im.planesize[0] + PBO_OFFSET, 0, GL_STREAM_DRAW);
-    void* pboPtr = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+    void* pboPtr = MapPbo(im.planesize[0] + PBO_OFFSET);
     if (pboPtr)
     {
       im.plane[0] = (uint8_t*)pboPtr + PBO_OFFSET;
+      buf.pboMapped[0] = m_pboPersistent ? im.plane[0] : nullptr;
       memset(im.plane[0], 0, im.planesize[0]);
     }
     else
@@ -2462,6 +2498,7 @@ bool CLinuxRendererGL::CreateYUV422PackedTexture(int index)
       glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
       glDeleteBuffers(1, pbo);
       memset(m_buffers[index].pbo, 0, sizeof(m_buffers[index].pbo));
+      memset(m_buffers[index].pboMapped, 0, sizeof(m_buffers[index].pboMapped));
     }
 
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
@@ -2617,6 +2654,12 @@ void CLinuxRendererGL::BindPbo(CPictureBuffer& buff)
   {
     if(!buff.pbo[plane] || buff.image.plane[plane] == (uint8_t*)PBO_OFFSET)
       continue;
+
+    if (buff.pboMapped[plane])
+    {
+      buff.image.plane[plane] = (uint8_t*)PBO_OFFSET;
+      continue;
+    }
     pbo = true;
 
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buff.pbo[plane]);
@@ -2634,6 +2677,13 @@ void CLinuxRendererGL::UnBindPbo(CPictureBuffer& buff)
   {
     if(!buff.pbo[plane] || buff.image.plane[plane] != (uint8_t*)PBO_OFFSET)
       continue;
+
+    if (buff.pboMapped[plane])
+    {
+      WaitPbo(buff);
+      buff.image.plane[plane] = buff.pboMapped[plane];
+      continue;
+    }
     pbo = true;
 
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buff.pbo[plane]);
@@ -2644,6 +2694,34 @@ void CLinuxRendererGL::UnBindPbo(CPictureBuffer& buff)
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 }
 
+void* CLinuxRendererGL::MapPbo(unsigned int size)
+{
+#if defined(GL_MAP_PERSISTENT_BIT)
+  if (m_pboPersistent)
+  {
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, nullptr, flags);
+    return glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags);
+  }
+#endif
+
+  glBufferData(GL_PIXEL_UNPACK_BUFFER, size, 0, GL_STREAM_DRAW);
+  return glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+}
+
+void CLinuxRendererGL::WaitPbo(CPictureBuffer& buff)
+{
+#if defined(GL_MAP_PERSISTENT_BIT)
+  if (!buff.fence)
+    return;
+
+  if (glClientWaitSync(buff.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 100000000) == GL_TIMEOUT_EXPIRED)
+    CLog::Log(LOGWARNING, "GL: timeout waiting for pixel buffer upload");
+  glDeleteSync(buff.fence);
+  buff.fence = nullptr;
+#endif
+}
+
 CRenderInfo CLinuxRendererGL::GetRenderInfo()
 {
   CRenderInfo info;
@@ -128,6 +128,8 @@ protected:
 
   void BindPbo(CPictureBuffer& buff);
   void UnBindPbo(CPictureBuffer& buff);
+  void* MapPbo(unsigned int size);
+  void WaitPbo(CPictureBuffer& buff);
   void LoadPlane(CYuvPlane& plane, int type,
                  unsigned width,  unsigned height,
                  int stride, int bpp, void* data);
@@ -182,6 +184,8 @@ protected:
     CYuvPlane fields[MAX_FIELDS][YuvImage::MAX_PLANES];
     YuvImage image;
     GLuint pbo[3]; // one pbo for 3 planes
+    uint8_t* pboMapped[3]; // planes of persistently mapped pbos
+    GLsync fence = nullptr; // upload from the persistently mapped pbos
 
     CVideoBuffer *videoBuffer;
     bool loaded;
@@ -215,8 +219,10 @@ protected:
   float m_clearColour = 0.0f;
   bool m_pboSupported = true;
   bool m_pboUsed = false;
+  bool m_pboPersistent = false;
   bool m_nonLinStretch = false;
   bool m_nonLinStretchGui = false;
+  bool m_unscaled = false;
   float m_pixelRatio = 0.0f;
   CRect m_viewRect;
 
@@ -518,10 +518,12 @@ void CLinuxRendererGLES::UpdateVideoFilter()
   CRect dstRect;
   CRect viewRect;
   GetVideoRect(srcRect, dstRect, viewRect);
+  const bool unscaled = IsUnscaled();
 
   if (m_scalingMethodGui == m_videoSettings.m_ScalingMethod &&
       viewRect.Height() == m_viewRect.Height() &&
-      viewRect.Width() == m_viewRect.Width())
+      viewRect.Width() == m_viewRect.Width() &&
+      unscaled == m_unscaled)
   {
     return;
   }
@@ -529,6 +531,7 @@ void CLinuxRendererGLES::UpdateVideoFilter()
   m_scalingMethodGui = m_videoSettings.m_ScalingMethod;
   m_scalingMethod = m_scalingMethodGui;
   m_viewRect = viewRect;
+  m_unscaled = unscaled;
 
   if(!Supports(m_scalingMethod))
   {
@@ -539,6 +542,14 @@ void CLinuxRendererGLES::UpdateVideoFilter()
     m_scalingMethod = VS_SCALINGMETHOD_LINEAR;
   }
 
+  // conversion and tone mapping happen in the single pass then, which saves writing and reading
+  // back a source sized framebuffer every frame
+  if (m_unscaled && m_scalingMethod != VS_SCALINGMETHOD_NEAREST)
+  {
+    CLog::Log(LOGDEBUG, "GLES: Video is not scaled, using single pass rendering");
+    m_scalingMethod = VS_SCALINGMETHOD_LINEAR;
+  }
+
   if (m_pVideoFilterShader)
   {
     delete m_pVideoFilterShader;
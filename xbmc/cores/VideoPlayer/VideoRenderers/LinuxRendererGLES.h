@@ -210,6 +210,7 @@ protected:
   // clear colour for "black" bars
   float m_clearColour{0.0f};
   CRect m_viewRect;
+  bool m_unscaled{false};
 
 private:
   void DrawBlackBars();
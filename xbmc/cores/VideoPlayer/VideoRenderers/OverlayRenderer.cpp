@@ -90,6 +90,7 @@ void CRenderer::Flush()
     Release(buffer);
 
   ReleaseCache();
+  COverlay::ReleaseTexturePool();
   Reset();
 }
 
@@ -47,6 +47,11 @@ namespace OVERLAY {
     static std::shared_ptr<COverlay> Create(const CDVDOverlaySpu& o);
     static std::shared_ptr<COverlay> Create(ASS_Image* images, float width, float height);
 
+    /*!
+     * \brief Free the textures kept for reuse by new overlays
+     */
+    static void ReleaseTexturePool();
+
     COverlay();
     virtual ~COverlay();
 
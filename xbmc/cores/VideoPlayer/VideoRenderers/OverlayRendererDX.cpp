@@ -34,6 +34,11 @@ using namespace DirectX;
 #define USE_PREMULTIPLIED_ALPHA 1
 #define ALPHA_CHANNEL_OFFSET 3
 
+void COverlay::ReleaseTexturePool()
+{
+  // textures are not pooled, each overlay releases its own
+}
+
 static bool LoadTexture(int width, int height, int stride
                       , DXGI_FORMAT format
                       , const void* pixels
@@ -220,9 +225,9 @@ COverlayImageDX::COverlayImageDX(const CDVDOverlayImage& o, CRect& rSource)
   }
   else
   {
-    std::vector<uint32_t> rgba(o.width * o.height);
+    std::vector<uint32_t> buffer;
     m_pma = !!USE_PREMULTIPLIED_ALPHA;
-    convert_rgba(o, m_pma, rgba);
+    const std::vector<uint32_t>& rgba = convert_rgba(o, m_pma, buffer);
     Load(rgba.data(), o.width, o.height, o.width * 4);
   }
 
@@ -24,58 +24,130 @@
 #include "utils/log.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #define USE_PREMULTIPLIED_ALPHA 1
 
 using namespace OVERLAY;
 
-static void LoadTexture(GLenum target
-                      , GLsizei width, GLsizei height, GLsizei stride
-                      , GLfloat* u, GLfloat* v
-                      , bool alpha, const GLvoid* pixels)
+namespace
 {
-  int width2  = width;
-  int height2 = height;
-  char *pixelVector = NULL;
+// Overlay textures are allocated in steps of this size, so that the texture of an overlay that is
+// no longer shown can be reused for the next one, e.g. each time the subtitle text changes
+constexpr GLsizei TEXTURE_SIZE_STEP = 64;
+constexpr size_t MAX_POOLED_TEXTURES = 8;
+
+struct SPooledTexture
+{
+  GLuint id;
+  bool alpha;
+  GLsizei width;
+  GLsizei height;
+};
+
+// only used on the render thread
+std::vector<SPooledTexture> texturePool;
+
+GLsizei AlignTextureSize(GLsizei size)
+{
+  return (size + TEXTURE_SIZE_STEP - 1) / TEXTURE_SIZE_STEP * TEXTURE_SIZE_STEP;
+}
+
+GLuint AcquireTexture(bool alpha, GLsizei width, GLsizei height)
+{
+  auto it = std::find_if(texturePool.begin(), texturePool.end(),
+                         [&](const SPooledTexture& tex)
+                         { return tex.alpha == alpha && tex.width == width && tex.height == height; });
+  if (it != texturePool.end())
+  {
+    GLuint texture = it->id;
+    texturePool.erase(it);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    return texture;
+  }
+
+  GLuint texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+  const GLenum internalFormat = alpha ? GL_RED : GL_RGBA;
+  const GLenum externalFormat = alpha ? GL_RED : GL_BGRA;
+  glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, externalFormat,
+               GL_UNSIGNED_BYTE, NULL);
+  return texture;
+}
+
+void ReleaseTexture(GLuint texture, bool alpha, GLsizei width, GLsizei height)
+{
+  if (!texture)
+    return;
+
+  if (texturePool.size() >= MAX_POOLED_TEXTURES)
+  {
+    glDeleteTextures(1, &texturePool.front().id);
+    texturePool.erase(texturePool.begin());
+  }
+  texturePool.push_back({texture, alpha, width, height});
+}
+} // namespace
+
+void COverlay::ReleaseTexturePool()
+{
+  for (SPooledTexture& tex : texturePool)
+    glDeleteTextures(1, &tex.id);
+  texturePool.clear();
+}
+
+static GLuint LoadTexture(GLsizei width, GLsizei height, GLsizei stride
+                        , GLsizei& texWidth, GLsizei& texHeight
+                        , GLfloat* u, GLfloat* v
+                        , bool alpha, const GLvoid* pixels)
+{
+  int width2 = AlignTextureSize(width);
+  int height2 = AlignTextureSize(height);
   const GLvoid *pixelData = pixels;
 
-  GLenum internalFormat = alpha ? GL_RED : GL_RGBA;
   GLenum externalFormat = alpha ? GL_RED : GL_BGRA;
 
   int bytesPerPixel = KODI::UTILS::GL::glFormatElementByteCount(externalFormat);
 
+  GLuint texture = AcquireTexture(alpha, width2, height2);
+
   glPixelStorei(GL_UNPACK_ROW_LENGTH, stride / bytesPerPixel);
 
   glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-  glTexImage2D   (target, 0, internalFormat
-                , width2, height2, 0
-                , externalFormat, GL_UNSIGNED_BYTE, NULL);
-
-  glTexSubImage2D(target, 0
+  glTexSubImage2D(GL_TEXTURE_2D, 0
                 , 0, 0, width, height
                 , externalFormat, GL_UNSIGNED_BYTE
                 , pixelData);
 
   if(height < height2)
-    glTexSubImage2D( target, 0
+    glTexSubImage2D( GL_TEXTURE_2D, 0
                    , 0, height, width, 1
                    , externalFormat, GL_UNSIGNED_BYTE
                    , (const unsigned char*)pixelData + stride * (height-1));
 
   if(width  < width2)
-    glTexSubImage2D( target, 0
+    glTexSubImage2D( GL_TEXTURE_2D, 0
                    , width, 0, 1, height
                    , externalFormat, GL_UNSIGNED_BYTE
                    , (const unsigned char*)pixelData + bytesPerPixel * (width-1));
 
   glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 
-  free(pixelVector);
-
+  texWidth = width2;
+  texHeight = height2;
   *u = (GLfloat)width  / width2;
   *v = (GLfloat)height / height2;
+  return texture;
 }
 
 std::shared_ptr<COverlay> COverlay::Create(const CDVDOverlayImage& o, CRect& rSource)
@@ -85,26 +157,20 @@ std::shared_ptr<COverlay> COverlay::Create(const CDVDOverlayImage& o, CRect& rSo
 
 COverlayTextureGL::COverlayTextureGL(const CDVDOverlayImage& o, CRect& rSource)
 {
-  glGenTextures(1, &m_texture);
-  glBindTexture(GL_TEXTURE_2D, m_texture);
-
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-
   if (o.palette.empty())
   {
     m_pma = false;
     const uint32_t* rgba = reinterpret_cast<const uint32_t*>(o.pixels.data());
-    LoadTexture(GL_TEXTURE_2D, o.width, o.height, o.linesize, &m_u, &m_v, false, rgba);
+    m_texture = LoadTexture(o.width, o.height, o.linesize, m_texWidth, m_texHeight, &m_u, &m_v,
+                            false, rgba);
   }
   else
   {
-    std::vector<uint32_t> rgba(o.width * o.height);
+    std::vector<uint32_t> buffer;
     m_pma = !!USE_PREMULTIPLIED_ALPHA;
-    convert_rgba(o, m_pma, rgba);
-    LoadTexture(GL_TEXTURE_2D, o.width, o.height, o.width * 4, &m_u, &m_v, false, rgba.data());
+    const std::vector<uint32_t>& rgba = convert_rgba(o, m_pma, buffer);
+    m_texture = LoadTexture(o.width, o.height, o.width * 4, m_texWidth, m_texHeight, &m_u, &m_v,
+                            false, rgba.data());
   }
 
   glBindTexture(GL_TEXTURE_2D, 0);
@@ -162,16 +228,8 @@ COverlayTextureGL::COverlayTextureGL(const CDVDOverlaySpu& o)
 
   convert_rgba(o, USE_PREMULTIPLIED_ALPHA, min_x, max_x, min_y, max_y, rgba);
 
-  glGenTextures(1, &m_texture);
-  glBindTexture(GL_TEXTURE_2D, m_texture);
-
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-
-  LoadTexture(GL_TEXTURE_2D, max_x - min_x, max_y - min_y, o.width * 4, &m_u, &m_v, false,
-              rgba.data() + min_x + min_y * o.width);
+  m_texture = LoadTexture(max_x - min_x, max_y - min_y, o.width * 4, m_texWidth, m_texHeight,
+                          &m_u, &m_v, false, rgba.data() + min_x + min_y * o.width);
 
   glBindTexture(GL_TEXTURE_2D, 0);
 
@@ -202,12 +260,8 @@ COverlayGlyphGL::COverlayGlyphGL(ASS_Image* images, float width, float height)
   if (!convert_quad(images, quads, static_cast<int>(width)))
     return;
 
-  glGenTextures(1, &m_texture);
-  glBindTexture(GL_TEXTURE_2D, m_texture);
-
-  LoadTexture(GL_TEXTURE_2D, quads.size_x, quads.size_y, quads.size_x, &m_u, &m_v, true,
-              quads.texture.data());
-
+  m_texture = LoadTexture(quads.size_x, quads.size_y, quads.size_x, m_texWidth, m_texHeight, &m_u,
+                          &m_v, true, quads.texture.data());
 
   float scale_u = m_u / quads.size_x;
   float scale_v = m_v / quads.size_y;
@@ -261,11 +315,35 @@ COverlayGlyphGL::COverlayGlyphGL(ASS_Image* images, float width, float height)
   }
 
   glBindTexture(GL_TEXTURE_2D, 0);
+
+  // the glyphs do not move, upload the triangles once instead of on every render
+  std::vector<VERTEX> vecVertices(6 * m_vertex.size() / 4);
+  VERTEX* vertices = vecVertices.data();
+
+  for (size_t i = 0; i < m_vertex.size(); i += 4)
+  {
+    *vertices++ = m_vertex[i];
+    *vertices++ = m_vertex[i+1];
+    *vertices++ = m_vertex[i+2];
+
+    *vertices++ = m_vertex[i+1];
+    *vertices++ = m_vertex[i+3];
+    *vertices++ = m_vertex[i+2];
+  }
+  m_vertexCount = vecVertices.size();
+
+  glGenBuffers(1, &m_vertexVBO);
+  glBindBuffer(GL_ARRAY_BUFFER, m_vertexVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(VERTEX) * vecVertices.size(), vecVertices.data(),
+               GL_STATIC_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 COverlayGlyphGL::~COverlayGlyphGL()
 {
-  glDeleteTextures(1, &m_texture);
+  ReleaseTexture(m_texture, true, m_texWidth, m_texHeight);
+  if (m_vertexVBO)
+    glDeleteBuffers(1, &m_vertexVBO);
 }
 
 void COverlayGlyphGL::Render(SRenderState& state)
@@ -294,25 +372,7 @@ void COverlayGlyphGL::Render(SRenderState& state)
   GLint colLoc  = renderSystem->ShaderGetCol();
   GLint tex0Loc = renderSystem->ShaderGetCoord0();
 
-  std::vector<VERTEX> vecVertices(6 * m_vertex.size() / 4);
-  VERTEX* vertices = vecVertices.data();
-
-  for (size_t i = 0; i < m_vertex.size(); i += 4)
-  {
-    *vertices++ = m_vertex[i];
-    *vertices++ = m_vertex[i+1];
-    *vertices++ = m_vertex[i+2];
-
-    *vertices++ = m_vertex[i+1];
-    *vertices++ = m_vertex[i+3];
-    *vertices++ = m_vertex[i+2];
-  }
-  GLuint VertexVBO;
-
-  glGenBuffers(1, &VertexVBO);
-  glBindBuffer(GL_ARRAY_BUFFER, VertexVBO);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(VERTEX) * vecVertices.size(), vecVertices.data(),
-               GL_STATIC_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, m_vertexVBO);
 
   glVertexAttribPointer(posLoc, 3, GL_FLOAT, GL_FALSE, sizeof(VERTEX),
                         reinterpret_cast<const GLvoid*>(offsetof(VERTEX, x)));
@@ -325,14 +385,13 @@ void COverlayGlyphGL::Render(SRenderState& state)
   glEnableVertexAttribArray(colLoc);
   glEnableVertexAttribArray(tex0Loc);
 
-  glDrawArrays(GL_TRIANGLES, 0, vecVertices.size());
+  glDrawArrays(GL_TRIANGLES, 0, m_vertexCount);
 
   glDisableVertexAttribArray(posLoc);
   glDisableVertexAttribArray(colLoc);
   glDisableVertexAttribArray(tex0Loc);
 
   glBindBuffer(GL_ARRAY_BUFFER, 0);
-  glDeleteBuffers(1, &VertexVBO);
 
   renderSystem->DisableShader();
 
@@ -346,7 +405,7 @@ void COverlayGlyphGL::Render(SRenderState& state)
 
 COverlayTextureGL::~COverlayTextureGL()
 {
-  glDeleteTextures(1, &m_texture);
+  ReleaseTexture(m_texture, false, m_texWidth, m_texHeight);
 }
 
 void COverlayTextureGL::Render(SRenderState& state)
@@ -34,6 +34,8 @@ namespace OVERLAY {
     void Render(SRenderState& state) override;
 
     GLuint m_texture = 0;
+    GLsizei m_texWidth = 0;
+    GLsizei m_texHeight = 0;
     float  m_u;
     float  m_v;
     bool   m_pma; /*< is alpha in texture premultiplied in the values */
@@ -56,8 +58,12 @@ namespace OVERLAY {
     };
 
     std::vector<VERTEX> m_vertex;
+    GLuint m_vertexVBO = 0;
+    GLsizei m_vertexCount = 0;
 
     GLuint m_texture = 0;
+    GLsizei m_texWidth = 0;
+    GLsizei m_texHeight = 0;
     float m_u;
     float m_v;
   };
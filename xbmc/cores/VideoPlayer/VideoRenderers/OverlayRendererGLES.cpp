@@ -24,7 +24,9 @@
 #include "utils/log.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 // GLES2.0 cant do CLAMP, but can do CLAMP_TO_EDGE.
 #define GL_CLAMP GL_CLAMP_TO_EDGE
@@ -33,17 +35,90 @@
 
 using namespace OVERLAY;
 
-static void LoadTexture(GLenum target,
-                        GLsizei width,
-                        GLsizei height,
-                        GLsizei stride,
-                        GLfloat* u,
-                        GLfloat* v,
-                        bool alpha,
-                        const GLvoid* pixels)
+namespace
 {
-  int width2 = width;
-  int height2 = height;
+// Overlay textures are allocated in steps of this size, so that the texture of an overlay that is
+// no longer shown can be reused for the next one, e.g. each time the subtitle text changes
+constexpr GLsizei TEXTURE_SIZE_STEP = 64;
+constexpr size_t MAX_POOLED_TEXTURES = 8;
+
+struct SPooledTexture
+{
+  GLuint id;
+  bool alpha;
+  GLsizei width;
+  GLsizei height;
+};
+
+// only used on the render thread
+std::vector<SPooledTexture> texturePool;
+
+GLsizei AlignTextureSize(GLsizei size)
+{
+  return (size + TEXTURE_SIZE_STEP - 1) / TEXTURE_SIZE_STEP * TEXTURE_SIZE_STEP;
+}
+
+GLuint AcquireTexture(
+    bool alpha, GLenum internalFormat, GLenum externalFormat, GLsizei width, GLsizei height)
+{
+  auto it = std::find_if(texturePool.begin(), texturePool.end(),
+                         [&](const SPooledTexture& tex)
+                         { return tex.alpha == alpha && tex.width == width && tex.height == height; });
+  if (it != texturePool.end())
+  {
+    GLuint texture = it->id;
+    texturePool.erase(it);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    return texture;
+  }
+
+  GLuint texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+  glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, externalFormat,
+               GL_UNSIGNED_BYTE, NULL);
+  return texture;
+}
+
+void ReleaseTexture(GLuint texture, bool alpha, GLsizei width, GLsizei height)
+{
+  if (!texture)
+    return;
+
+  if (texturePool.size() >= MAX_POOLED_TEXTURES)
+  {
+    glDeleteTextures(1, &texturePool.front().id);
+    texturePool.erase(texturePool.begin());
+  }
+  texturePool.push_back({texture, alpha, width, height});
+}
+} // namespace
+
+void COverlay::ReleaseTexturePool()
+{
+  for (SPooledTexture& tex : texturePool)
+    glDeleteTextures(1, &tex.id);
+  texturePool.clear();
+}
+
+static GLuint LoadTexture(GLsizei width,
+                          GLsizei height,
+                          GLsizei stride,
+                          GLsizei& texWidth,
+                          GLsizei& texHeight,
+                          GLfloat* u,
+                          GLfloat* v,
+                          bool alpha,
+                          const GLvoid* pixels)
+{
+  int width2 = AlignTextureSize(width);
+  int height2 = AlignTextureSize(height);
   char* pixelVector = NULL;
   const GLvoid* pixelData = pixels;
 
@@ -116,25 +191,27 @@ static void LoadTexture(GLenum target,
     stride = bytesPerLine;
   }
 
-  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  GLuint texture = AcquireTexture(alpha, internalFormat, externalFormat, width2, height2);
 
-  glTexImage2D(target, 0, internalFormat, width2, height2, 0, externalFormat, GL_UNSIGNED_BYTE,
-               NULL);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-  glTexSubImage2D(target, 0, 0, 0, width, height, externalFormat, GL_UNSIGNED_BYTE, pixelData);
+  glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, externalFormat, GL_UNSIGNED_BYTE, pixelData);
 
   if (height < height2)
-    glTexSubImage2D(target, 0, 0, height, width, 1, externalFormat, GL_UNSIGNED_BYTE,
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, height, width, 1, externalFormat, GL_UNSIGNED_BYTE,
                     (const unsigned char*)pixelData + stride * (height - 1));
 
   if (width < width2)
-    glTexSubImage2D(target, 0, width, 0, 1, height, externalFormat, GL_UNSIGNED_BYTE,
+    glTexSubImage2D(GL_TEXTURE_2D, 0, width, 0, 1, height, externalFormat, GL_UNSIGNED_BYTE,
                     (const unsigned char*)pixelData + bytesPerPixel * (width - 1));
 
   free(pixelVector);
 
+  texWidth = width2;
+  texHeight = height2;
   *u = (GLfloat)width / width2;
   *v = (GLfloat)height / height2;
+  return texture;
 }
 
 std::shared_ptr<COverlay> COverlay::Create(const CDVDOverlayImage& o, CRect& rSource)
@@ -144,26 +221,20 @@ std::shared_ptr<COverlay> COverlay::Create(const CDVDOverlayImage& o, CRect& rSo
 
 COverlayTextureGLES::COverlayTextureGLES(const CDVDOverlayImage& o, CRect& rSource)
 {
-  glGenTextures(1, &m_texture);
-  glBindTexture(GL_TEXTURE_2D, m_texture);
-
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-
   if (o.palette.empty())
   {
     m_pma = false;
     const uint32_t* rgba = reinterpret_cast<const uint32_t*>(o.pixels.data());
-    LoadTexture(GL_TEXTURE_2D, o.width, o.height, o.linesize, &m_u, &m_v, false, rgba);
+    m_texture = LoadTexture(o.width, o.height, o.linesize, m_texWidth, m_texHeight, &m_u, &m_v,
+                            false, rgba);
   }
   else
   {
-    std::vector<uint32_t> rgba(o.width * o.height);
+    std::vector<uint32_t> buffer;
     m_pma = !!USE_PREMULTIPLIED_ALPHA;
-    convert_rgba(o, m_pma, rgba);
-    LoadTexture(GL_TEXTURE_2D, o.width, o.height, o.width * 4, &m_u, &m_v, false, rgba.data());
+    const std::vector<uint32_t>& rgba = convert_rgba(o, m_pma, buffer);
+    m_texture = LoadTexture(o.width, o.height, o.width * 4, m_texWidth, m_texHeight, &m_u, &m_v,
+                            false, rgba.data());
   }
 
   glBindTexture(GL_TEXTURE_2D, 0);
@@ -221,16 +292,8 @@ COverlayTextureGLES::COverlayTextureGLES(const CDVDOverlaySpu& o)
 
   convert_rgba(o, USE_PREMULTIPLIED_ALPHA, min_x, max_x, min_y, max_y, rgba);
 
-  glGenTextures(1, &m_texture);
-  glBindTexture(GL_TEXTURE_2D, m_texture);
-
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-
-  LoadTexture(GL_TEXTURE_2D, max_x - min_x, max_y - min_y, o.width * 4, &m_u, &m_v, false,
-              rgba.data() + min_x + min_y * o.width);
+  m_texture = LoadTexture(max_x - min_x, max_y - min_y, o.width * 4, m_texWidth, m_texHeight,
+                          &m_u, &m_v, false, rgba.data() + min_x + min_y * o.width);
 
   glBindTexture(GL_TEXTURE_2D, 0);
 
@@ -261,11 +324,8 @@ COverlayGlyphGLES::COverlayGlyphGLES(ASS_Image* images, float width, float heigh
   if (!convert_quad(images, quads, static_cast<int>(width)))
     return;
 
-  glGenTextures(1, &m_texture);
-  glBindTexture(GL_TEXTURE_2D, m_texture);
-
-  LoadTexture(GL_TEXTURE_2D, quads.size_x, quads.size_y, quads.size_x, &m_u, &m_v, true,
-              quads.texture.data());
+  m_texture = LoadTexture(quads.size_x, quads.size_y, quads.size_x, m_texWidth, m_texHeight, &m_u,
+                          &m_v, true, quads.texture.data());
 
   float scale_u = m_u / quads.size_x;
   float scale_v = m_v / quads.size_y;
@@ -323,7 +383,7 @@ COverlayGlyphGLES::COverlayGlyphGLES(ASS_Image* images, float width, float heigh
 
 COverlayGlyphGLES::~COverlayGlyphGLES()
 {
-  glDeleteTextures(1, &m_texture);
+  ReleaseTexture(m_texture, true, m_texWidth, m_texHeight);
 }
 
 void COverlayGlyphGLES::Render(SRenderState& state)
@@ -398,7 +458,7 @@ void COverlayGlyphGLES::Render(SRenderState& state)
 
 COverlayTextureGLES::~COverlayTextureGLES()
 {
-  glDeleteTextures(1, &m_texture);
+  ReleaseTexture(m_texture, false, m_texWidth, m_texHeight);
 }
 
 void COverlayTextureGLES::Render(SRenderState& state)
@@ -35,6 +35,8 @@ public:
   void Render(SRenderState& state) override;
 
   GLuint m_texture = 0;
+  GLsizei m_texWidth = 0;
+  GLsizei m_texHeight = 0;
   float m_u;
   float m_v;
   bool m_pma; /*< is alpha in texture premultiplied in the values */
@@ -59,6 +61,8 @@ public:
   std::vector<VERTEX> m_vertex;
 
   GLuint m_texture = 0;
+  GLsizei m_texWidth = 0;
+  GLsizei m_texHeight = 0;
   float m_u;
   float m_v;
 };
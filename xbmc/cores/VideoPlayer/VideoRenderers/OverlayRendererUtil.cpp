@@ -16,6 +16,8 @@
 #include "settings/SettingsComponent.h"
 #include "windowing/GraphicContext.h"
 
+#include <algorithm>
+
 namespace OVERLAY
 {
 
@@ -44,17 +46,51 @@ static uint32_t build_rgba(const int yuv[3], int alpha, bool mergealpha)
 }
 #undef clamp
 
-void convert_rgba(const CDVDOverlayImage& o, bool mergealpha, std::vector<uint32_t>& rgba)
+const std::vector<uint32_t>& convert_rgba(const CDVDOverlayImage& o,
+                                          bool mergealpha,
+                                          std::vector<uint32_t>& rgba)
 {
+  const size_t size = static_cast<size_t>(o.width) * o.height;
+  if (mergealpha && o.rgba.size() == size)
+    return o.rgba;
+
   uint32_t palette[256] = {};
-  for (size_t i = 0; i < o.palette.size(); i++)
+  for (size_t i = 0; i < o.palette.size() && i < 256; i++)
     palette[i] = build_rgba(
         (o.palette[i] >> PIXEL_ASHIFT) & 0xff, (o.palette[i] >> PIXEL_RSHIFT) & 0xff,
         (o.palette[i] >> PIXEL_GSHIFT) & 0xff, (o.palette[i] >> PIXEL_BSHIFT) & 0xff, mergealpha);
 
+  rgba.resize(size);
+  uint32_t* trg = rgba.data();
   for (int row = 0; row < o.height; row++)
-    for (int col = 0; col < o.width; col++)
-      rgba[row * o.width + col] = palette[o.pixels[row * o.linesize + col]];
+  {
+    const uint8_t* src = o.pixels.data() + row * o.linesize;
+    const uint8_t* end = src + o.width;
+
+    // bitmap subtitles are mostly transparent, fill runs of the same index at once
+    while (src < end)
+    {
+      const uint8_t idx = *src;
+      const uint8_t* run = src + 1;
+      while (run < end && *run == idx)
+        run++;
+
+      std::fill(trg, trg + (run - src), palette[idx]);
+      trg += run - src;
+      src = run;
+    }
+  }
+  return rgba;
+}
+
+void prepare_rgba(CDVDOverlayImage& o)
+{
+  if (o.palette.empty() || o.width <= 0 || o.height <= 0)
+    return;
+
+  std::vector<uint32_t> rgba;
+  convert_rgba(o, true, rgba);
+  o.rgba = std::move(rgba);
 }
 
 void convert_rgba(const CDVDOverlaySpu& o,
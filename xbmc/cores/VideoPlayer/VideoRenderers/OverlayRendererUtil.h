@@ -36,7 +36,17 @@ struct SQuads
   std::vector<SQuad> quad;
 };
 
-void convert_rgba(const CDVDOverlayImage& o, bool mergealpha, std::vector<uint32_t>& rgba);
+/*!
+ * \brief Convert a palette image to RGBA
+ * \return the converted image of the overlay if there is one, else rgba
+ */
+const std::vector<uint32_t>& convert_rgba(const CDVDOverlayImage& o,
+                                          bool mergealpha,
+                                          std::vector<uint32_t>& rgba);
+/*!
+ * \brief Convert a palette image to premultiplied RGBA ahead of rendering
+ */
+void prepare_rgba(CDVDOverlayImage& o);
 void convert_rgba(const CDVDOverlaySpu& o,
                   bool mergealpha,
                   int& min_x,
@@ -30,6 +30,8 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <mutex>
 
@@ -229,6 +231,9 @@ bool CRenderManager::Configure()
     m_presentstep = PRESENT_IDLE;
     m_presentpts = DVD_NOPTS_VALUE;
     m_lateframes = -1;
+    m_presentStats = {};
+    m_lastPresent = {};
+    m_dataCacheCore.SetPresentStats(m_presentStats);
     m_presentevent.notifyAll();
     m_renderedOverlay = false;
     m_renderDebug = false;
@@ -454,6 +459,7 @@ bool CRenderManager::Flush(bool wait, bool saveBuffers)
         for (int i = 0; i < m_QueueSize; i++)
           m_free.push_back(i);
       }
+      m_lastPresent = {};
 
       m_flushEvent.Set();
     }
@@ -769,6 +775,18 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
           info.vsync += StringUtils::Format("VSync: refresh:{:.3f} missed:{} speed:{:.3f}%",
                                             refreshrate, missedvblanks, clockspeed * 100);
         }
+        double measuredrate, jitter;
+        if (m_dvdClock.GetVblankInfo(measuredrate, jitter))
+          info.vsync += StringUtils::Format(" measured:{:.3f} jitter:{:.3f}ms", measuredrate, jitter);
+
+        const CDataCacheCore::SPresentStats stats = m_dataCacheCore.GetPresentStats();
+        const int maxVsyncs = CDataCacheCore::SPresentStats::MAX_VSYNCS;
+        info.present = "Present vsyncs:";
+        for (int i = 0; i < maxVsyncs; i++)
+          info.present += StringUtils::Format(" {}{}:{}", i + 1, i + 1 == maxVsyncs ? "+" : "",
+                                              stats.vsyncs[i]);
+        info.present += StringUtils::Format("  frames:{} late:{} dropped:{}", stats.frames,
+                                            stats.late, stats.dropped);
 
         m_debugRenderer.SetInfo(info);
       }
@@ -1251,6 +1269,7 @@ void CRenderManager::PrepareNextRender()
    }
 
     double diff = (renderPts - nextFramePts);
+    int dropped = 0;
     while (diff > 62000 && m_queued.size() > 2)
     {
       // skip late frames if possible; if the queue is almost empty, we don't skip
@@ -1260,6 +1279,7 @@ void CRenderManager::PrepareNextRender()
 
       m_discard.push_back(late);
       m_QueueSkip++;
+      dropped++;
 
       diff = (renderPts - m_Queue[m_queued.front()].pts);
     }
@@ -1275,6 +1295,7 @@ void CRenderManager::PrepareNextRender()
     m_presentpts = m_Queue[idx].pts - m_displayLatency;
     m_presentevent.notifyAll();
 
+    UpdatePresentStats(frametime, lateframes >= 1.0, dropped);
   }
   else if (!combined && renderPts > (nextFramePts - frametime))
   {
@@ -1285,12 +1306,39 @@ void CRenderManager::PrepareNextRender()
     m_queued.pop_front();
     m_presentpts = m_Queue[m_presentsource].pts - m_displayLatency - frametime / 2;
     m_presentevent.notifyAll();
+
+    UpdatePresentStats(frametime, false, 0);
   }
 
   m_dataCacheCore.SetRenderPts(m_Queue[m_presentsource].pts);
 
 }
 
+void CRenderManager::UpdatePresentStats(double frametime, bool late, int dropped)
+{
+  const auto now = std::chrono::steady_clock::now();
+  const auto interval = now - m_lastPresent;
+
+  // longer gaps are pauses or seeks, not the cadence of the video
+  if (m_lastPresent != std::chrono::steady_clock::time_point{} &&
+      interval < std::chrono::seconds(1) && frametime > 0)
+  {
+    // frametime is in DVD_TIME_BASE units, which are microseconds
+    const double vsyncs =
+        std::chrono::duration<double, std::micro>(interval).count() / frametime;
+    const int bucket = std::clamp(static_cast<int>(std::lround(vsyncs)), 1,
+                                  CDataCacheCore::SPresentStats::MAX_VSYNCS);
+    m_presentStats.vsyncs[bucket - 1]++;
+  }
+  m_lastPresent = now;
+
+  m_presentStats.frames++;
+  if (late)
+    m_presentStats.late++;
+  m_presentStats.dropped += dropped;
+  m_dataCacheCore.SetPresentStats(m_presentStats);
+}
+
 void CRenderManager::DiscardBuffer()
 {
   std::unique_lock<CCriticalSection> lock2(m_presentlock);
@@ -23,6 +23,7 @@
 #include "windowing/Resolution.h"
 
 #include <atomic>
+#include <chrono>
 #include <deque>
 #include <list>
 #include <map>
@@ -145,6 +146,7 @@ protected:
 
   void UpdateLatencyTweak();
   void CheckEnableClockSync();
+  void UpdatePresentStats(double frametime, bool late, int dropped);
 
   CBaseRenderer *m_pRenderer = nullptr;
   OVERLAY::CRenderer m_overlays;
@@ -220,6 +222,8 @@ protected:
   std::string m_stereomode;
 
   int m_lateframes = -1;
+  CDataCacheCore::SPresentStats m_presentStats;
+  std::chrono::steady_clock::time_point m_lastPresent;
   double m_presentpts = 0.0;
   EPRESENTSTEP m_presentstep = PRESENT_IDLE;
   XbmcThreads::EndTime<> m_presentTimer;
@@ -59,7 +59,9 @@ void CAudioDecoder::Destroy()
   m_canPlay = false;
 }
 
-bool CAudioDecoder::Create(const CFileItem &file, int64_t seekOffset)
+bool CAudioDecoder::Create(const CFileItem &file,
+                           int64_t seekOffset,
+                           unsigned int bufferSecs /* = 2 */)
 {
   Destroy();
 
@@ -97,8 +99,9 @@ bool CAudioDecoder::Create(const CFileItem &file, int64_t seekOffset)
     return false;
   }
 
-  /* allocate the pcmBuffer for 2 seconds of audio */
-  m_pcmBuffer.Create(2 * blockSize * m_codec->m_format.m_sampleRate);
+  /* allocate the pcmBuffer for the requested seconds of audio */
+  m_bufferSecs = bufferSecs;
+  m_pcmBuffer.Create(bufferSecs * blockSize * m_codec->m_format.m_sampleRate);
 
   if (file.HasMusicInfoTag())
   {
@@ -43,7 +43,12 @@ public:
   CAudioDecoder();
   ~CAudioDecoder();
 
-  bool Create(const CFileItem &file, int64_t seekOffset);
+  /*!
+   * \brief Open the file and create the PCM buffer
+   * \param bufferSecs The seconds of audio the PCM buffer holds, a stream that is not played yet
+   *        is decoded that far ahead
+   */
+  bool Create(const CFileItem &file, int64_t seekOffset, unsigned int bufferSecs = 2);
   void Destroy();
 
   int ReadSamples(int numsamples);
@@ -54,6 +59,7 @@ public:
   void SetTotalTime(int64_t time);
   void Start() { m_canPlay = true;}; // cause a pre-buffered stream to start.
   int GetStatus() { return m_status; }
+  unsigned int GetBufferSecs() const { return m_bufferSecs; }
   void SetStatus(int status) { m_status = status; }
 
   AEAudioFormat GetFormat();
@@ -68,6 +74,7 @@ public:
 private:
   // pcm buffer
   CRingBuffer m_pcmBuffer;
+  unsigned int m_bufferSecs = 2;
 
   // output buffer (for transferring data from the Pcm Buffer to the rest of the audio chain)
   float m_outputBuffer[OUTPUT_SAMPLES];
@@ -8,6 +8,8 @@
 
 #include "CodecFactory.h"
 
+#include "FFmpegAudioCodec.h"
+#include "FileItem.h"
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "VideoPlayerCodec.h"
@@ -18,6 +20,24 @@
 
 using namespace KODI::ADDONS;
 
+namespace
+{
+// Decoding with FFmpeg directly is cheaper than through the VideoPlayer stack, but only handles
+// the common music codecs. The codec is initialized here to find out, the decoder calls Init()
+// again which is a no-op for the same file.
+ICodec* CreateFFmpegCodec(const CFileItem& file, unsigned int filecache)
+{
+  if (!CFFmpegAudioCodec::IsSupported(file))
+    return nullptr;
+
+  auto codec = std::make_unique<CFFmpegAudioCodec>();
+  if (!codec->Init(file, filecache))
+    return nullptr;
+
+  return codec.release();
+}
+} // unnamed namespace
+
 ICodec* CodecFactory::CreateCodec(const CURL& urlFile)
 {
   std::string fileType = urlFile.GetFileType();
@@ -81,6 +101,10 @@ ICodec* CodecFactory::CreateCodecDemux(const CFileItem& file, unsigned int filec
       content == "application/x-flac"
       )
   {
+    ICodec* codec = CreateFFmpegCodec(file, filecache);
+    if (codec)
+      return codec;
+
     VideoPlayerCodec *dvdcodec = new VideoPlayerCodec();
     dvdcodec->SetContentType(content);
     return dvdcodec;
@@ -107,6 +131,17 @@ ICodec* CodecFactory::CreateCodecDemux(const CFileItem& file, unsigned int filec
     return dvdcodec;
   }
   else
-    return CreateCodec(urlFile);
+  {
+    ICodec* codec = CreateCodec(urlFile);
+    if (!dynamic_cast<VideoPlayerCodec*>(codec))
+      return codec; // audio decoder add-ons take precedence for their extensions
+
+    ICodec* ffmpegCodec = CreateFFmpegCodec(file, filecache);
+    if (!ffmpegCodec)
+      return codec;
+
+    delete codec;
+    return ffmpegCodec;
+  }
 }
 
@@ -0,0 +1,473 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FFmpegAudioCodec.h"
+
+#include "FileItem.h"
+#include "URL.h"
+#include "cores/AudioEngine/Utils/AEUtil.h"
+#include "music/tags/TagLoaderTagLib.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr int IO_BUFFER_SIZE = 32768;
+constexpr int64_t SEEK_INDEX_INTERVAL_MS = 2000;
+constexpr int64_t SEEK_INDEX_MIN_DURATION_MS = 10 * 60 * 1000;
+
+int vfs_file_read(void* h, uint8_t* buf, int size)
+{
+  CFile* pFile = static_cast<CFile*>(h);
+  const ssize_t read = pFile->Read(buf, size);
+  if (read < 0)
+    return AVERROR(EIO);
+  return read == 0 ? AVERROR_EOF : static_cast<int>(read);
+}
+
+int64_t vfs_file_seek(void* h, int64_t pos, int whence)
+{
+  CFile* pFile = static_cast<CFile*>(h);
+  if (whence == AVSEEK_SIZE)
+    return pFile->GetLength();
+  else
+    return pFile->Seek(pos, whence & ~AVSEEK_FORCE);
+}
+
+bool IsSupportedCodec(AVCodecID codecId)
+{
+  switch (codecId)
+  {
+    case AV_CODEC_ID_FLAC:
+    case AV_CODEC_ID_ALAC:
+    case AV_CODEC_ID_MP3:
+    case AV_CODEC_ID_AAC:
+    case AV_CODEC_ID_OPUS:
+    case AV_CODEC_ID_VORBIS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+AEDataFormat GetPackedDataFormat(AVSampleFormat format)
+{
+  switch (av_get_packed_sample_fmt(format))
+  {
+    case AV_SAMPLE_FMT_U8:
+      return AE_FMT_U8;
+    case AV_SAMPLE_FMT_S16:
+      return AE_FMT_S16NE;
+    case AV_SAMPLE_FMT_S32:
+      return AE_FMT_S32NE;
+    case AV_SAMPLE_FMT_FLT:
+      return AE_FMT_FLOAT;
+    case AV_SAMPLE_FMT_DBL:
+      return AE_FMT_DOUBLE;
+    default:
+      return AE_FMT_INVALID;
+  }
+}
+
+int64_t GetStartTime(const AVStream* stream)
+{
+  return stream->start_time != AV_NOPTS_VALUE ? stream->start_time : 0;
+}
+
+template<typename T>
+void Interleave(uint8_t* const* planes, int offset, int frames, int channels, uint8_t* dst)
+{
+  T* out = reinterpret_cast<T*>(dst);
+  for (int c = 0; c < channels; ++c)
+  {
+    const T* in = reinterpret_cast<const T*>(planes[c]) + offset;
+    for (int i = 0; i < frames; ++i)
+      out[i * channels + c] = in[i];
+  }
+}
+} // unnamed namespace
+
+CFFmpegAudioCodec::CFFmpegAudioCodec()
+{
+  m_CodecName = "FFmpeg";
+}
+
+CFFmpegAudioCodec::~CFFmpegAudioCodec()
+{
+  DeInit();
+}
+
+bool CFFmpegAudioCodec::IsSupported(const CFileItem& file)
+{
+  if (file.IsInternetStream())
+    return false;
+
+  std::string content = file.GetMimeType();
+  StringUtils::ToLower(content);
+  if (content == "audio/flac" || content == "audio/x-flac" || content == "application/x-flac" ||
+      content == "audio/mpeg" || content == "audio/mpeg3" || content == "audio/mp3" ||
+      content == "audio/aac" || content == "audio/mp4" || content == "audio/ogg" ||
+      content == "audio/opus")
+    return true;
+
+  const CURL url(file.GetDynPath());
+  for (const char* type : {"flac", "mp3", "m4a", "aac", "alac", "opus", "ogg", "oga"})
+  {
+    if (url.IsFileType(type))
+      return true;
+  }
+  return false;
+}
+
+bool CFFmpegAudioCodec::Init(const CFileItem& file, unsigned int filecache)
+{
+  // the factory tries Init() before handing the codec out, the decoder calls it again
+  if (m_codecContext)
+  {
+    if (m_fileName == file.GetDynPath())
+      return true;
+    DeInit();
+  }
+
+  const std::string fileName = file.GetDynPath();
+  if (!m_file.Open(fileName, READ_TRUNCATED | READ_CHUNKED))
+  {
+    CLog::Log(LOGERROR, "CFFmpegAudioCodec::{} - error opening file {}", __FUNCTION__,
+              CURL::GetRedacted(fileName));
+    return false;
+  }
+
+  int bufferSize = IO_BUFFER_SIZE;
+  if (m_file.GetChunkSize() > 1)
+    bufferSize = m_file.GetChunkSize();
+  uint8_t* buffer = static_cast<uint8_t*>(av_malloc(bufferSize));
+  m_ioContext =
+      avio_alloc_context(buffer, bufferSize, 0, &m_file, vfs_file_read, nullptr, vfs_file_seek);
+  m_canSeek = m_file.IoControl(IOCTRL_SEEK_POSSIBLE, nullptr) == 1;
+  if (!m_canSeek)
+    m_ioContext->seekable = 0;
+
+  m_formatContext = avformat_alloc_context();
+  m_formatContext->pb = m_ioContext;
+  m_formatContext->flags |= AVFMT_FLAG_CUSTOM_IO;
+
+  const AVInputFormat* iformat = nullptr;
+  av_probe_input_buffer(m_ioContext, &iformat, fileName.c_str(), nullptr, 0, 0);
+  if (avformat_open_input(&m_formatContext, fileName.c_str(), iformat, nullptr) < 0)
+  {
+    CLog::Log(LOGDEBUG, "CFFmpegAudioCodec::{} - unknown format of {}", __FUNCTION__,
+              CURL::GetRedacted(fileName));
+    DeInit();
+    return false;
+  }
+
+  // Music containers describe the stream in their header, probing packets for the stream info
+  // is only needed when they don't, e.g. for raw AAC
+  m_streamIndex = av_find_best_stream(m_formatContext, AVMEDIA_TYPE_AUDIO, -1, -1, nullptr, 0);
+  if (m_streamIndex >= 0)
+  {
+    const AVCodecParameters* par = m_formatContext->streams[m_streamIndex]->codecpar;
+    if (par->sample_rate == 0 || par->ch_layout.nb_channels == 0)
+      avformat_find_stream_info(m_formatContext, nullptr);
+  }
+  if (m_streamIndex < 0 ||
+      !IsSupportedCodec(m_formatContext->streams[m_streamIndex]->codecpar->codec_id))
+  {
+    CLog::Log(LOGDEBUG, "CFFmpegAudioCodec::{} - no supported audio stream in {}", __FUNCTION__,
+              CURL::GetRedacted(fileName));
+    DeInit();
+    return false;
+  }
+
+  // other streams, e.g. cover art, are not read
+  for (unsigned int i = 0; i < m_formatContext->nb_streams; ++i)
+  {
+    if (static_cast<int>(i) != m_streamIndex)
+      m_formatContext->streams[i]->discard = AVDISCARD_ALL;
+  }
+
+  const AVStream* stream = m_formatContext->streams[m_streamIndex];
+  const AVCodec* codec = avcodec_find_decoder(stream->codecpar->codec_id);
+  m_codecContext = avcodec_alloc_context3(codec);
+  if (!codec || !m_codecContext ||
+      avcodec_parameters_to_context(m_codecContext, stream->codecpar) < 0 ||
+      avcodec_open2(m_codecContext, codec, nullptr) < 0)
+  {
+    CLog::Log(LOGERROR, "CFFmpegAudioCodec::{} - failed to open decoder for {}", __FUNCTION__,
+              CURL::GetRedacted(fileName));
+    DeInit();
+    return false;
+  }
+  m_packet = av_packet_alloc();
+  m_frame = av_frame_alloc();
+
+  // the format is only reliable once the first frame is decoded, it stays queued for ReadPCM()
+  if (DecodeFrame() != READ_SUCCESS)
+  {
+    CLog::Log(LOGDEBUG, "CFFmpegAudioCodec::{} - could not decode {}", __FUNCTION__,
+              CURL::GetRedacted(fileName));
+    DeInit();
+    return false;
+  }
+
+  const AVSampleFormat sampleFormat = static_cast<AVSampleFormat>(m_frame->format);
+  m_planar = av_sample_fmt_is_planar(sampleFormat);
+  m_format.m_dataFormat = GetPackedDataFormat(sampleFormat);
+  m_format.m_sampleRate = m_frame->sample_rate;
+  if (m_frame->ch_layout.order == AV_CHANNEL_ORDER_NATIVE)
+    m_format.m_channelLayout = CAEUtil::GetAEChannelLayout(m_frame->ch_layout.u.mask);
+  if (m_format.m_channelLayout.Count() != static_cast<unsigned int>(m_frame->ch_layout.nb_channels))
+    m_format.m_channelLayout = CAEUtil::GuessChLayout(m_frame->ch_layout.nb_channels);
+  m_format.m_frameSize =
+      m_format.m_channelLayout.Count() * (CAEUtil::DataFormatToBits(m_format.m_dataFormat) >> 3);
+
+  if (m_format.m_dataFormat == AE_FMT_INVALID || m_format.m_sampleRate == 0 ||
+      m_format.m_frameSize == 0)
+  {
+    CLog::Log(LOGDEBUG, "CFFmpegAudioCodec::{} - unsupported sample format in {}", __FUNCTION__,
+              CURL::GetRedacted(fileName));
+    DeInit();
+    return false;
+  }
+
+  m_bitsPerSample = CAEUtil::DataFormatToBits(m_format.m_dataFormat);
+  m_bitsPerCodedSample = stream->codecpar->bits_per_raw_sample
+                             ? stream->codecpar->bits_per_raw_sample
+                             : stream->codecpar->bits_per_coded_sample;
+
+  if (stream->duration != AV_NOPTS_VALUE)
+    m_TotalTime = av_rescale_q(stream->duration, stream->time_base, {1, 1000});
+  else if (m_formatContext->duration != AV_NOPTS_VALUE)
+    m_TotalTime = m_formatContext->duration / (AV_TIME_BASE / 1000);
+
+  m_bitRate = static_cast<int>(stream->codecpar->bit_rate);
+  if (!m_bitRate)
+    m_bitRate = static_cast<int>(m_formatContext->bit_rate);
+  if (!m_bitRate && m_TotalTime)
+    m_bitRate = static_cast<int>(m_file.GetLength() * 1000 / m_TotalTime * 8);
+
+  m_CodecName = avcodec_get_name(stream->codecpar->codec_id);
+
+  // The demuxer has to estimate or search the position of a seek in VBR files without a table of
+  // contents, which is slow and inexact for long tracks. Their packet positions are remembered
+  // while playing, so that later seeks go straight to a known packet.
+  if (m_canSeek && m_TotalTime >= SEEK_INDEX_MIN_DURATION_MS &&
+      !(m_formatContext->iformat->flags & AVFMT_NO_BYTE_SEEK))
+  {
+    m_seekIndex = std::make_unique<CSeekIndex>(
+        av_rescale_q(SEEK_INDEX_INTERVAL_MS, {1, 1000}, stream->time_base));
+    m_seekIndex->Load(fileName);
+  }
+
+  // Extract ReplayGain info
+  CTagLoaderTagLib tagLoaderTagLib;
+  tagLoaderTagLib.Load(fileName, m_tag, "");
+
+  m_fileName = fileName;
+  return true;
+}
+
+void CFFmpegAudioCodec::DeInit()
+{
+  if (m_seekIndex)
+  {
+    m_seekIndex->Save();
+    m_seekIndex.reset();
+  }
+
+  av_frame_free(&m_frame);
+  av_packet_free(&m_packet);
+  avcodec_free_context(&m_codecContext);
+  if (m_formatContext)
+    avformat_close_input(&m_formatContext);
+  if (m_ioContext)
+  {
+    av_free(m_ioContext->buffer);
+    avio_context_free(&m_ioContext);
+  }
+  m_file.Close();
+
+  m_streamIndex = -1;
+  m_frameOffset = 0;
+  m_seekTarget = AV_NOPTS_VALUE;
+  m_sampleClock = AV_NOPTS_VALUE;
+  m_decoderDrained = false;
+  m_TotalTime = 0;
+  m_bitRate = 0;
+  m_bitsPerSample = 0;
+  m_format.m_dataFormat = AE_FMT_INVALID;
+  m_fileName.clear();
+}
+
+bool CFFmpegAudioCodec::Seek(int64_t iSeekTime)
+{
+  if (!m_codecContext)
+    return false;
+
+  const AVStream* stream = m_formatContext->streams[m_streamIndex];
+  const AVRational sampleTimeBase = {1, m_codecContext->sample_rate};
+  const int64_t timestamp = av_rescale_q(iSeekTime, {1, 1000}, stream->time_base);
+
+  // packets read after a byte seek carry no timestamps, the samples are counted from the entry
+  CSeekIndex::Entry entry;
+  if (m_seekIndex && m_seekIndex->Lookup(timestamp, entry) &&
+      av_seek_frame(m_formatContext, m_streamIndex, entry.pos, AVSEEK_FLAG_BYTE) >= 0)
+  {
+    m_sampleClock = av_rescale_q(entry.timestamp, stream->time_base, sampleTimeBase);
+  }
+  else if (av_seek_frame(m_formatContext, m_streamIndex, timestamp + GetStartTime(stream),
+                         AVSEEK_FLAG_BACKWARD) >= 0)
+  {
+    m_sampleClock = AV_NOPTS_VALUE;
+  }
+  else
+    return false;
+
+  avcodec_flush_buffers(m_codecContext);
+  av_frame_unref(m_frame);
+  m_frameOffset = 0;
+  m_decoderDrained = false;
+
+  // the demuxer lands on the packet before the target, the samples up to it are dropped
+  m_seekTarget = av_rescale_q(timestamp, stream->time_base, sampleTimeBase);
+  return true;
+}
+
+int CFFmpegAudioCodec::DecodeFrame()
+{
+  const AVStream* stream = m_formatContext->streams[m_streamIndex];
+  while (true)
+  {
+    int ret = avcodec_receive_frame(m_codecContext, m_frame);
+    if (ret == 0)
+    {
+      m_frameOffset = 0;
+      if (m_seekTarget != AV_NOPTS_VALUE)
+      {
+        int64_t start = AV_NOPTS_VALUE;
+        if (m_sampleClock != AV_NOPTS_VALUE)
+        {
+          start = m_sampleClock;
+          m_sampleClock += m_frame->nb_samples;
+        }
+        else if (m_frame->best_effort_timestamp != AV_NOPTS_VALUE)
+        {
+          start = av_rescale_q(m_frame->best_effort_timestamp - GetStartTime(stream),
+                               stream->time_base, {1, m_frame->sample_rate});
+        }
+
+        if (start != AV_NOPTS_VALUE)
+        {
+          if (start + m_frame->nb_samples <= m_seekTarget)
+          {
+            av_frame_unref(m_frame);
+            continue;
+          }
+          m_frameOffset = static_cast<int>(std::max<int64_t>(0, m_seekTarget - start));
+        }
+      }
+      m_seekTarget = AV_NOPTS_VALUE;
+      m_sampleClock = AV_NOPTS_VALUE;
+      return READ_SUCCESS;
+    }
+    if (ret == AVERROR_EOF)
+      return READ_EOF;
+    if (ret != AVERROR(EAGAIN))
+      return READ_ERROR;
+
+    if (m_decoderDrained)
+      return READ_EOF;
+
+    // feed the decoder, at the end of the file it is flushed to get the delayed frames
+    ret = av_read_frame(m_formatContext, m_packet);
+    if (ret < 0)
+    {
+      m_decoderDrained = true;
+      avcodec_send_packet(m_codecContext, nullptr);
+      continue;
+    }
+    if (m_packet->stream_index == m_streamIndex)
+    {
+      if (m_seekIndex && m_packet->pts != AV_NOPTS_VALUE)
+        m_seekIndex->Add(m_packet->pts - GetStartTime(stream), m_packet->pos);
+
+      ret = avcodec_send_packet(m_codecContext, m_packet);
+      if (ret < 0 && ret != AVERROR_INVALIDDATA)
+      {
+        av_packet_unref(m_packet);
+        return READ_ERROR;
+      }
+    }
+    av_packet_unref(m_packet);
+  }
+}
+
+int CFFmpegAudioCodec::ReadPCM(uint8_t* pBuffer, size_t size, size_t* actualsize)
+{
+  *actualsize = 0;
+  if (!m_codecContext)
+    return READ_ERROR;
+
+  if (m_frameOffset >= m_frame->nb_samples)
+  {
+    const int ret = DecodeFrame();
+    if (ret != READ_SUCCESS)
+      return ret;
+
+    if (m_frame->format != m_codecContext->sample_fmt ||
+        m_frame->ch_layout.nb_channels != static_cast<int>(m_format.m_channelLayout.Count()) ||
+        m_frame->sample_rate != static_cast<int>(m_format.m_sampleRate))
+    {
+      CLog::Log(LOGERROR, "CFFmpegAudioCodec::{} - format changed within {}", __FUNCTION__,
+                CURL::GetRedacted(m_fileName));
+      return READ_ERROR;
+    }
+  }
+
+  const int channels = m_frame->ch_layout.nb_channels;
+  const int frames = std::min(m_frame->nb_samples - m_frameOffset,
+                              static_cast<int>(size / m_format.m_frameSize));
+  if (frames <= 0)
+    return READ_SUCCESS;
+
+  if (!m_planar)
+  {
+    std::memcpy(pBuffer, m_frame->extended_data[0] + m_frameOffset * m_format.m_frameSize,
+                frames * m_format.m_frameSize);
+  }
+  else
+  {
+    switch (av_get_bytes_per_sample(static_cast<AVSampleFormat>(m_frame->format)))
+    {
+      case 1:
+        Interleave<uint8_t>(m_frame->extended_data, m_frameOffset, frames, channels, pBuffer);
+        break;
+      case 2:
+        Interleave<uint16_t>(m_frame->extended_data, m_frameOffset, frames, channels, pBuffer);
+        break;
+      case 4:
+        Interleave<uint32_t>(m_frame->extended_data, m_frameOffset, frames, channels, pBuffer);
+        break;
+      case 8:
+        Interleave<uint64_t>(m_frame->extended_data, m_frameOffset, frames, channels, pBuffer);
+        break;
+      default:
+        return READ_ERROR;
+    }
+  }
+
+  m_frameOffset += frames;
+  *actualsize = frames * m_format.m_frameSize;
+  return READ_SUCCESS;
+}
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "ICodec.h"
+#include "utils/SeekIndex.h"
+
+#include <memory>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+}
+
+/*!
+ * \brief Decodes music files with libavformat and libavcodec directly.
+ *
+ * Unlike VideoPlayerCodec there is no input stream, demux packet or audio codec wrapper in
+ * between, decoded frames are copied (and interleaved if planar) straight into the buffer of
+ * ReadPCM(). Only the common music codecs are handled, Init() fails for anything else so that
+ * the caller can fall back to VideoPlayerCodec.
+ */
+class CFFmpegAudioCodec : public ICodec
+{
+public:
+  CFFmpegAudioCodec();
+  ~CFFmpegAudioCodec() override;
+
+  /*!
+   * \brief Whether the file is worth trying with this codec, i.e. not an internet stream and with
+   * the extension or mime type of one of the supported codecs
+   */
+  static bool IsSupported(const CFileItem& file);
+
+  bool Init(const CFileItem& file, unsigned int filecache) override;
+  bool Seek(int64_t iSeekTime) override;
+  int ReadPCM(uint8_t* pBuffer, size_t size, size_t* actualsize) override;
+  bool CanInit() override { return true; }
+  bool CanSeek() override { return m_canSeek; }
+
+private:
+  void DeInit();
+
+  /*!
+   * \brief Decode the next frame into m_frame, dropping samples before a seek target
+   * \return READ_SUCCESS, READ_EOF or READ_ERROR
+   */
+  int DecodeFrame();
+
+  AVFormatContext* m_formatContext{nullptr};
+  AVIOContext* m_ioContext{nullptr};
+  AVCodecContext* m_codecContext{nullptr};
+  AVPacket* m_packet{nullptr};
+  AVFrame* m_frame{nullptr};
+  int m_streamIndex{-1};
+
+  int m_frameOffset{0}; //!< Frames of m_frame already returned by ReadPCM()
+  int64_t m_seekTarget{AV_NOPTS_VALUE}; //!< Sample to resume at after a seek
+  int64_t m_sampleClock{AV_NOPTS_VALUE}; //!< Start of the next frame after a byte seek
+  bool m_planar{false};
+  bool m_decoderDrained{false};
+  bool m_canSeek{false};
+  std::string m_fileName;
+  std::unique_ptr<CSeekIndex> m_seekIndex;
+};
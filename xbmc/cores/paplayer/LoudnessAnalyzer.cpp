@@ -0,0 +1,145 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "LoudnessAnalyzer.h"
+
+#include "CodecFactory.h"
+#include "FileItem.h"
+#include "ICodec.h"
+#include "utils/LoudnessMeter.h"
+#include "utils/log.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace
+{
+constexpr double REFERENCE_LOUDNESS_LUFS = -18.0;
+constexpr size_t READ_SIZE = 64 * 1024;
+
+bool ToFloat(AEDataFormat format, const uint8_t* data, size_t samples, float* out)
+{
+  switch (format)
+  {
+    case AE_FMT_U8:
+      for (size_t i = 0; i < samples; ++i)
+        out[i] = (static_cast<int>(data[i]) - 128) / 128.0f;
+      return true;
+    case AE_FMT_S16NE:
+      for (size_t i = 0; i < samples; ++i)
+      {
+        int16_t sample;
+        std::memcpy(&sample, data + i * sizeof(sample), sizeof(sample));
+        out[i] = sample / 32768.0f;
+      }
+      return true;
+    case AE_FMT_S32NE:
+      for (size_t i = 0; i < samples; ++i)
+      {
+        int32_t sample;
+        std::memcpy(&sample, data + i * sizeof(sample), sizeof(sample));
+        out[i] = static_cast<float>(sample / 2147483648.0);
+      }
+      return true;
+    case AE_FMT_FLOAT:
+      std::memcpy(out, data, samples * sizeof(float));
+      return true;
+    case AE_FMT_DOUBLE:
+      for (size_t i = 0; i < samples; ++i)
+      {
+        double sample;
+        std::memcpy(&sample, data + i * sizeof(sample), sizeof(sample));
+        out[i] = static_cast<float>(sample);
+      }
+      return true;
+    default:
+      return false;
+  }
+}
+
+double ChannelWeight(AEChannel channel)
+{
+  switch (channel)
+  {
+    case AE_CH_LFE:
+      return 0.0;
+    case AE_CH_BL:
+    case AE_CH_BR:
+    case AE_CH_SL:
+    case AE_CH_SR:
+      return 1.41;
+    default:
+      return 1.0;
+  }
+}
+} // unnamed namespace
+
+bool CLoudnessAnalyzer::Analyze(const CFileItem& item,
+                                ReplayGain::Info& info,
+                                const std::function<bool()>& cancelled)
+{
+  // the file is read once from start to end, a file cache would only add a thread
+  std::unique_ptr<ICodec> codec(CodecFactory::CreateCodecDemux(item, 0));
+  if (!codec || !codec->Init(item, 0))
+  {
+    CLog::Log(LOGDEBUG, "CLoudnessAnalyzer: Unable to open {}", item.GetPath());
+    return false;
+  }
+
+  const AEAudioFormat& format = codec->m_format;
+  const unsigned int channels = format.m_channelLayout.Count();
+  const unsigned int bytesPerSample = codec->m_bitsPerSample >> 3;
+  if (format.m_dataFormat == AE_FMT_RAW || channels == 0 || bytesPerSample == 0)
+    return false;
+
+  std::vector<double> weights;
+  for (unsigned int i = 0; i < channels; ++i)
+    weights.push_back(ChannelWeight(format.m_channelLayout[i]));
+
+  CLoudnessMeter meter(format.m_sampleRate, std::move(weights));
+
+  const size_t frameBytes = channels * bytesPerSample;
+  std::vector<uint8_t> buffer(READ_SIZE - READ_SIZE % frameBytes);
+  std::vector<float> samples(buffer.size() / bytesPerSample);
+
+  int result = READ_SUCCESS;
+  while (result == READ_SUCCESS)
+  {
+    if (cancelled())
+      return false;
+
+    size_t readSize = 0;
+    result = codec->ReadPCM(buffer.data(), buffer.size(), &readSize);
+    if (result == READ_ERROR)
+    {
+      CLog::Log(LOGDEBUG, "CLoudnessAnalyzer: Error while decoding {}", item.GetPath());
+      return false;
+    }
+
+    const size_t frames = readSize / frameBytes;
+    if (!ToFloat(format.m_dataFormat, buffer.data(), frames * channels, samples.data()))
+    {
+      CLog::Log(LOGDEBUG, "CLoudnessAnalyzer: Unsupported sample format of {}", item.GetPath());
+      return false;
+    }
+    meter.Add(samples.data(), frames);
+  }
+
+  double loudness;
+  if (!meter.GetIntegratedLoudness(loudness))
+    return false;
+
+  info.SetGain(static_cast<float>(REFERENCE_LOUDNESS_LUFS - loudness));
+  info.SetPeak(meter.GetPeak());
+
+  CLog::Log(LOGDEBUG, "CLoudnessAnalyzer: {} has {:.2f} LUFS, gain {:.2f} dB, peak {:.3f}",
+            item.GetPath(), loudness, info.Gain(), info.Peak());
+  return true;
+}
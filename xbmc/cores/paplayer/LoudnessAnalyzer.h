@@ -0,0 +1,34 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "music/tags/ReplayGain.h"
+
+#include <functional>
+
+class CFileItem;
+
+/*!
+ * \brief Computes the ReplayGain of a file by decoding it as fast as possible and measuring its
+ * EBU R128 loudness, for files that are not tagged with ReplayGain.
+ */
+class CLoudnessAnalyzer
+{
+public:
+  /*!
+   * \brief Decode the file and measure its track gain and peak
+   * \param item The file to analyze
+   * \param[out] info The gain for the ReplayGain 2.0 reference level of -18 LUFS and the sample peak
+   * \param cancelled Polled while decoding, the analysis fails as soon as it returns true
+   * \return true on success, false if the file could not be decoded or is silent
+   */
+  static bool Analyze(const CFileItem& item,
+                      ReplayGain::Info& info,
+                      const std::function<bool()>& cancelled);
+};
@@ -29,6 +29,7 @@
 #include "utils/log.h"
 #include "video/Bookmark.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
@@ -322,7 +323,11 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
     starttime = 0; // No resume point
   }
 
-  if (!si->m_decoder.Create(file, si->m_startOffset))
+  // The PCM buffer holds the decoded start of the file while the previous one is still playing
+  const unsigned int bufferSecs = static_cast<unsigned int>(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioPrebufferNextFileSecs);
+
+  if (!si->m_decoder.Create(file, si->m_startOffset, bufferSecs))
   {
     CLog::Log(LOGWARNING, "PAPlayer::QueueNextFileEx - Failed to create the decoder");
 
@@ -401,10 +406,7 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
   si->m_prepareNextAtFrame = 0;
   // cd drives don't really like it to be crossfaded or prepared
   if (!file.IsCDDA())
-  {
-    if (streamTotalTime >= TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
-      si->m_prepareNextAtFrame = (int)((streamTotalTime - TIME_TO_CACHE_NEXT_FILE - m_defaultCrossfadeMS) * si->m_audioFormat.m_sampleRate / 1000.0f);
-  }
+    UpdateStreamInfoPrepareNextAtFrame(si, streamTotalTime);
 
   if (m_currentStream && ((m_currentStream->m_audioFormat.m_dataFormat == AE_FMT_RAW) || (si->m_audioFormat.m_dataFormat == AE_FMT_RAW)))
   {
@@ -457,6 +459,22 @@ void PAPlayer::UpdateStreamInfoPlayNextAtFrame(StreamInfo *si, unsigned int cros
   }
 }
 
+void PAPlayer::UpdateStreamInfoPrepareNextAtFrame(StreamInfo* si, int64_t streamTotalTime)
+{
+  if (streamTotalTime < TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
+    return;
+
+  // Prepare the next stream early enough for its decoder to fill the PCM buffer before the
+  // transition, so that slowly opening network files don't cause a gap. Short tracks prepare the
+  // next stream as soon as they start.
+  const int64_t prebufferMs = static_cast<int64_t>(si->m_decoder.GetBufferSecs()) * 1000;
+  const int64_t prepareAtMs =
+      streamTotalTime - TIME_TO_CACHE_NEXT_FILE - m_defaultCrossfadeMS - prebufferMs;
+
+  si->m_prepareNextAtFrame =
+      std::max(1, (int)(prepareAtMs * si->m_audioFormat.m_sampleRate / 1000.0f));
+}
+
 inline bool PAPlayer::PrepareStream(StreamInfo *si)
 {
   /* if we have a stream we are already prepared */
@@ -742,7 +760,12 @@ inline bool PAPlayer::ProcessStream(StreamInfo *si, double &freeBufferTime)
   /* if we have not started yet and the stream has been primed */
   unsigned int space = si->m_stream->GetSpace();
   if (!si->m_started && !space)
+  {
+    // keep decoding the start of the file until the PCM buffer is full
+    if (si->m_decoder.GetStatus() == STATUS_QUEUING || si->m_decoder.GetStatus() == STATUS_QUEUED)
+      si->m_decoder.ReadSamples(PACKET_SIZE);
     return true;
+  }
 
   if (!m_playbackSpeed)
     return true;
@@ -808,8 +831,7 @@ inline bool PAPlayer::ProcessStream(StreamInfo *si, double &freeBufferTime)
 
       // calculate time when to prepare next stream
       si->m_prepareNextAtFrame = 0;
-      if (streamTotalTime >= TIME_TO_CACHE_NEXT_FILE + m_defaultCrossfadeMS)
-        si->m_prepareNextAtFrame = (int)((streamTotalTime - TIME_TO_CACHE_NEXT_FILE - m_defaultCrossfadeMS) * si->m_audioFormat.m_sampleRate / 1000.0f);
+      UpdateStreamInfoPrepareNextAtFrame(si, streamTotalTime);
 
       si->m_prepareTriggered = false;
       si->m_playNextAtFrame = 0;
@@ -144,6 +144,7 @@ private:
   int64_t GetTotalTime64();
   void UpdateCrossfadeTime(const CFileItem& file);
   void UpdateStreamInfoPlayNextAtFrame(StreamInfo *si, unsigned int crossFadingTime);
+  void UpdateStreamInfoPrepareNextAtFrame(StreamInfo* si, int64_t streamTotalTime);
   void UpdateGUIData(StreamInfo *si);
   int64_t GetTimeInternal();
   bool SetTimeInternal(int64_t time);
@@ -11,6 +11,7 @@
 #include "DatabaseManager.h"
 #include "DbUrl.h"
 #include "ServiceBroker.h"
+#include "XBDateTime.h"
 #include "filesystem/SpecialProtocol.h"
 #if defined(HAS_MYSQL) || defined(HAS_MARIADB)
 #include "mysqldataset.h"
@@ -19,6 +20,7 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "sqlitedataset.h"
+#include "utils/Random.h"
 #include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
@@ -27,12 +29,76 @@
 #include "platform/posix/ConvUtils.h"
 #endif
 
+#include <algorithm>
 #include <memory>
 
 using namespace dbiplus;
 
 #define MAX_COMPRESS_COUNT 20
 
+using namespace std::chrono_literals;
+
+namespace
+{
+// identifies the library changes recorded by this instance in the changelog tables
+const std::string& GetInstanceId()
+{
+  static const std::string instanceId = StringUtils::CreateUUID();
+  return instanceId;
+}
+
+// longest time the writes of a batch are held back before they are committed
+constexpr auto WRITE_BATCH_MAX_DURATION = 1s;
+
+// size of the memory mapping sqlite reads the database files through, instead of copying pages
+// into its own cache with read calls
+constexpr int64_t SQLITE_MMAP_SIZE = 256 * 1024 * 1024;
+
+struct ParkedConnection
+{
+  std::string key;
+  std::unique_ptr<Database> db;
+  std::unique_ptr<Dataset> ds;
+  std::unique_ptr<Dataset> ds2;
+};
+
+thread_local unsigned int connectionScopeDepth = 0;
+thread_local std::vector<ParkedConnection> parkedConnections;
+
+std::string GetConnectionKey(const std::string& dbName, const DatabaseSettings& settings)
+{
+  return settings.type + ':' + settings.user + '@' + settings.host + ':' + settings.port + '/' +
+         dbName;
+}
+} // unnamed namespace
+
+CDatabase::CConnectionScope::CConnectionScope()
+{
+  connectionScopeDepth++;
+}
+
+CDatabase::CConnectionScope::~CConnectionScope()
+{
+  if (--connectionScopeDepth > 0)
+    return;
+
+  for (ParkedConnection& connection : parkedConnections)
+  {
+    if (CServiceBroker::IsServiceManagerUp())
+    {
+      CServiceBroker::GetDatabaseManager().ReleaseConnection(
+          connection.key,
+          {std::move(connection.db), std::move(connection.ds), std::move(connection.ds2)});
+    }
+    else
+    {
+      connection.ds->close();
+      connection.db->disconnect();
+    }
+  }
+  parkedConnections.clear();
+}
+
 void CDatabase::Filter::AppendField(const std::string& strField)
 {
   if (strField.empty())
@@ -346,6 +412,133 @@ int CDatabase::GetSingleValueInt(const std::string& query) const
   return GetSingleValueInt(query, m_pDS);
 }
 
+int CDatabase::GetRandomIDs(const std::string& query,
+                            unsigned int count,
+                            std::vector<int>& ids) const
+{
+  ids.clear();
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return 0;
+
+    if (!m_pDS->query(query))
+      return 0;
+
+    ids.reserve(m_pDS->num_rows());
+    while (!m_pDS->eof())
+    {
+      ids.push_back(m_pDS->fv(0).get_asInt());
+      m_pDS->next();
+    }
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} - failed on query '{}'", __FUNCTION__, query);
+    ids.clear();
+    return 0;
+  }
+
+  const int total = static_cast<int>(ids.size());
+  if (count == 0)
+    KODI::UTILS::RandomShuffle(ids.begin(), ids.end());
+  else
+    ids.erase(KODI::UTILS::RandomSample(ids.begin(), ids.end(), count), ids.end());
+  return total;
+}
+
+void CDatabase::LogLibraryChange(const std::string& mediaType, int id, bool removed)
+{
+  if (m_sqlite || !m_pDB)
+    return;
+
+  try
+  {
+    // on a dataset of its own, callers may be iterating the results of m_pDS or m_pDS2
+    const std::unique_ptr<Dataset> ds(m_pDB->CreateDataset());
+    ds->exec(PrepareSQL("INSERT INTO changelog (instance, media, idMedia, removed, dateChanged) "
+                        "VALUES ('%s', '%s', %i, %i, '%s')",
+                        GetInstanceId().c_str(), mediaType.c_str(), id, removed ? 1 : 0,
+                        CDateTime::GetUTCDateTime().GetAsDBDateTime().c_str()));
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} - failed for {} {}", __FUNCTION__, mediaType, id);
+  }
+}
+
+int64_t CDatabase::GetLibraryChangeGeneration() const
+{
+  if (!m_pDB || !m_pDS)
+    return 0;
+
+  try
+  {
+    int64_t generation = 0;
+    if (m_pDS->query("SELECT MAX(idChange) FROM changelog"))
+    {
+      if (!m_pDS->eof())
+        generation = m_pDS->fv(0).get_asInt64();
+      m_pDS->close();
+    }
+    return generation;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} failed", __FUNCTION__);
+  }
+  return 0;
+}
+
+bool CDatabase::GetLibraryChangesSince(int64_t generation,
+                                       unsigned int maxChanges,
+                                       std::vector<LibraryChange>& changes) const
+{
+  changes.clear();
+  if (!m_pDB || !m_pDS)
+    return false;
+
+  try
+  {
+    const std::string sql =
+        "SELECT idChange, instance, media, idMedia, removed FROM changelog WHERE idChange > " +
+        std::to_string(generation) + " ORDER BY idChange LIMIT " + std::to_string(maxChanges);
+    if (!m_pDS->query(sql))
+      return false;
+
+    while (!m_pDS->eof())
+    {
+      changes.push_back({m_pDS->fv(0).get_asInt64(), m_pDS->fv(2).get_asString(),
+                         m_pDS->fv(3).get_asInt(), m_pDS->fv(4).get_asBool(),
+                         m_pDS->fv(1).get_asString() == GetInstanceId()});
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} failed", __FUNCTION__);
+    changes.clear();
+  }
+  return false;
+}
+
+void CDatabase::PruneLibraryChanges(std::chrono::seconds maxAge)
+{
+  CDateTime oldest = CDateTime::GetUTCDateTime();
+  oldest -= CDateTimeSpan(0, 0, 0, static_cast<int>(maxAge.count()));
+  ExecuteQuery(PrepareSQL("DELETE FROM changelog WHERE dateChanged < '%s'",
+                          oldest.GetAsDBDateTime().c_str()));
+}
+
+void CDatabase::CreateChangeLogTable()
+{
+  m_pDS->exec("CREATE TABLE changelog (idChange INTEGER PRIMARY KEY, instance TEXT, media TEXT, "
+              "idMedia INTEGER, removed INTEGER, dateChanged TEXT)");
+}
+
 bool CDatabase::DeleteValues(const std::string& strTable, const Filter& filter /* = Filter() */)
 {
   std::string strQuery;
@@ -582,6 +775,37 @@ void CDatabase::DropAnalytics()
 
 bool CDatabase::Connect(const std::string& dbName, const DatabaseSettings& dbSettings, bool create)
 {
+  m_connectionKey.clear();
+  if (!create)
+  {
+    const std::string key = GetConnectionKey(dbName, dbSettings);
+    const auto it =
+        std::find_if(parkedConnections.begin(), parkedConnections.end(),
+                     [&key](const ParkedConnection& connection) { return connection.key == key; });
+    if (it != parkedConnections.end())
+    {
+      m_pDB = std::move(it->db);
+      m_pDS = std::move(it->ds);
+      m_pDS2 = std::move(it->ds2);
+      parkedConnections.erase(it);
+      m_connectionKey = key;
+      m_openCount = 1;
+      return true;
+    }
+
+    CDatabaseManager::Connection connection;
+    if (CServiceBroker::IsServiceManagerUp() &&
+        CServiceBroker::GetDatabaseManager().AcquireConnection(key, connection))
+    {
+      m_pDB = std::move(connection.db);
+      m_pDS = std::move(connection.ds);
+      m_pDS2 = std::move(connection.ds2);
+      m_connectionKey = key;
+      m_openCount = 1;
+      return true;
+    }
+  }
+
   // create the appropriate database structure
   if (dbSettings.type == "sqlite3")
   {
@@ -651,6 +875,11 @@ bool CDatabase::Connect(const std::string& dbName, const DatabaseSettings& dbSet
       m_pDS->exec("PRAGMA cache_size=4096\n");
       m_pDS->exec("PRAGMA synchronous='NORMAL'\n");
       m_pDS->exec("PRAGMA count_changes='OFF'\n");
+      // in write-ahead log mode readers, e.g. the GUI, don't have to wait for a writer, e.g. a
+      // library scan, and the other way around. The mode is persistent, setting it again is
+      // cheap. Databases on file systems without shared memory support keep their journal mode.
+      m_pDS->exec("PRAGMA journal_mode=WAL\n");
+      m_pDS->exec("PRAGMA mmap_size=" + std::to_string(SQLITE_MMAP_SIZE) + "\n");
     }
   }
   catch (DbErrors& error)
@@ -661,6 +890,8 @@ bool CDatabase::Connect(const std::string& dbName, const DatabaseSettings& dbSet
     return false;
   }
 
+  if (!create)
+    m_connectionKey = GetConnectionKey(dbName, dbSettings);
   m_openCount = 1; // our database is open
   return true;
 }
@@ -694,8 +925,33 @@ void CDatabase::Close()
 
   if (nullptr == m_pDB)
     return;
+  EndWriteBatch();
   if (nullptr != m_pDS)
     m_pDS->close();
+
+  // within a connection scope hand the connection to the next database opened on this thread
+  if (connectionScopeDepth > 0 && !m_connectionKey.empty() && m_pDS && m_pDS2 &&
+      !m_pDB->in_transaction())
+  {
+    m_pDS2->close();
+    parkedConnections.push_back(
+        {std::move(m_connectionKey), std::move(m_pDB), std::move(m_pDS), std::move(m_pDS2)});
+    m_connectionKey.clear();
+    return;
+  }
+
+  // otherwise keep it open for the next database opened on any thread
+  if (!m_connectionKey.empty() && m_pDS && m_pDS2 && !m_pDB->in_transaction() &&
+      CServiceBroker::IsServiceManagerUp())
+  {
+    m_pDS2->close();
+    CServiceBroker::GetDatabaseManager().ReleaseConnection(
+        m_connectionKey, {std::move(m_pDB), std::move(m_pDS), std::move(m_pDS2)});
+    m_connectionKey.clear();
+    return;
+  }
+
+  m_connectionKey.clear();
   m_pDB->disconnect();
   m_pDB.reset();
   m_pDS.reset();
@@ -749,8 +1005,23 @@ void CDatabase::BeginTransaction()
 {
   try
   {
-    if (nullptr != m_pDB)
+    if (nullptr == m_pDB)
+      return;
+
+    if (!InWriteBatch())
+    {
       m_pDB->start_transaction();
+      return;
+    }
+
+    if (!m_writeBatchOpen)
+    {
+      m_pDB->start_transaction();
+      m_writeBatchOpen = true;
+      m_writeBatchStart = std::chrono::steady_clock::now();
+    }
+    m_writeBatchDepth++;
+    ExecuteSavepoint("SAVEPOINT");
   }
   catch (...)
   {
@@ -762,8 +1033,18 @@ bool CDatabase::CommitTransaction()
 {
   try
   {
-    if (nullptr != m_pDB)
-      m_pDB->commit_transaction();
+    if (nullptr == m_pDB)
+      return true;
+
+    if (InWriteBatch() && m_writeBatchDepth > 0)
+    {
+      ExecuteSavepoint("RELEASE SAVEPOINT");
+      m_writeBatchDepth--;
+      return true;
+    }
+
+    m_pDB->commit_transaction();
+    m_writeBatchOpen = false;
   }
   catch (...)
   {
@@ -777,8 +1058,19 @@ void CDatabase::RollbackTransaction()
 {
   try
   {
-    if (nullptr != m_pDB)
-      m_pDB->rollback_transaction();
+    if (nullptr == m_pDB)
+      return;
+
+    if (InWriteBatch() && m_writeBatchDepth > 0)
+    {
+      ExecuteSavepoint("ROLLBACK TO SAVEPOINT");
+      ExecuteSavepoint("RELEASE SAVEPOINT");
+      m_writeBatchDepth--;
+      return;
+    }
+
+    m_pDB->rollback_transaction();
+    m_writeBatchOpen = false;
   }
   catch (...)
   {
@@ -786,6 +1078,59 @@ void CDatabase::RollbackTransaction()
   }
 }
 
+void CDatabase::ExecuteSavepoint(const char* statement)
+{
+  if (nullptr != m_pDS)
+    m_pDS->exec(PrepareSQL("%s batch%u", statement, m_writeBatchDepth));
+}
+
+void CDatabase::BeginWriteBatch(unsigned int itemsPerCommit)
+{
+  if (nullptr == m_pDB || InWriteBatch() || itemsPerCommit < 2 || m_pDB->in_transaction())
+    return;
+
+  m_writeBatchSize = itemsPerCommit;
+  m_writeBatchItems = 0;
+  m_writeBatchDepth = 0;
+  m_writeBatchOpen = false;
+}
+
+void CDatabase::WriteBatchItemDone()
+{
+  if (!InWriteBatch())
+    return;
+
+  m_writeBatchItems++;
+  if (m_writeBatchOpen && m_writeBatchDepth == 0 &&
+      (m_writeBatchItems >= m_writeBatchSize ||
+       std::chrono::steady_clock::now() - m_writeBatchStart >= WRITE_BATCH_MAX_DURATION))
+    FlushWriteBatch();
+}
+
+void CDatabase::EndWriteBatch()
+{
+  if (!InWriteBatch())
+    return;
+
+  if (m_writeBatchOpen)
+    FlushWriteBatch();
+  m_writeBatchSize = 0;
+  m_writeBatchDepth = 0;
+}
+
+void CDatabase::FlushWriteBatch()
+{
+  // commit through the regular path with batching suspended, so derived databases update the
+  // state depending on committed data once per batch
+  const unsigned int batchSize = m_writeBatchSize;
+  m_writeBatchSize = 0;
+  m_writeBatchDepth = 0;
+  CommitTransaction();
+  m_writeBatchSize = batchSize;
+  m_writeBatchItems = 0;
+  m_writeBatchOpen = false;
+}
+
 bool CDatabase::CreateDatabase()
 {
   BeginTransaction();
@@ -14,6 +14,8 @@ class Database;
 class Dataset;
 } // namespace dbiplus
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -95,6 +97,23 @@ public:
     std::string where;
   };
 
+  /*!
+   * @brief Keeps the connections of the databases closed on this thread open while it exists.
+   *        A database opened again within the scope takes over the connection of one closed
+   *        before, including its prepared statements, instead of connecting and setting up the
+   *        connection again. Scopes can be nested, the connections are handed to the connection
+   *        pool of CDatabaseManager with the outermost one.
+   */
+  class CConnectionScope
+  {
+  public:
+    CConnectionScope();
+    ~CConnectionScope();
+
+    CConnectionScope(const CConnectionScope&) = delete;
+    CConnectionScope& operator=(const CConnectionScope&) = delete;
+  };
+
   CDatabase();
   virtual ~CDatabase(void);
   bool IsOpen();
@@ -158,6 +177,68 @@ public:
   int GetSingleValueInt(const std::string& query,
                         const std::unique_ptr<dbiplus::Dataset>& ds) const;
 
+  /*!
+   * @brief Pick ids at random from the rows of a query.
+   * @remarks Use this instead of ORDER BY RANDOM() LIMIT count, which makes the database sort
+   *          every matching row, on large libraries and with MySQL in particular. Only the ids are
+   *          transferred and count of them are picked, so the cost is a scan of the matching rows.
+   * @param query A query that selects an integer id as its first column.
+   * @param count The number of ids to pick, 0 to get all of them shuffled.
+   * @param[out] ids The picked ids, in random order.
+   * @return The number of rows of the query, i.e. the population the ids were picked from.
+   */
+  int GetRandomIDs(const std::string& query, unsigned int count, std::vector<int>& ids) const;
+
+  /*!
+   * @brief A change to a library item, as recorded in the changelog table.
+   */
+  struct LibraryChange
+  {
+    int64_t generation; ///< increases with every change recorded by any instance
+    std::string mediaType;
+    int id;
+    bool removed;
+    bool local; ///< recorded by this instance
+  };
+
+  /*!
+   * @brief Record a change to a library item in the changelog table, so that other instances
+   *        sharing the database can pick it up. Does nothing for SQLite databases, which are not
+   *        shared between instances.
+   * @param mediaType The media type of the item.
+   * @param id The database id of the item.
+   * @param removed True if the item was removed, false if it was added or updated.
+   */
+  void LogLibraryChange(const std::string& mediaType, int id, bool removed);
+
+  /*!
+   * @brief Whether library changes are recorded, i.e. the database can be shared between instances.
+   */
+  bool RecordsLibraryChanges() const { return !m_sqlite; }
+
+  /*!
+   * @brief Get the generation of the newest change in the changelog table.
+   * @return The generation, 0 if no change was recorded.
+   */
+  int64_t GetLibraryChangeGeneration() const;
+
+  /*!
+   * @brief Get the changes recorded after a generation, oldest first.
+   * @param generation Only get changes with a newer generation.
+   * @param maxChanges The maximum number of changes to get.
+   * @param[out] changes The changes.
+   * @return True if the changelog could be read, false otherwise.
+   */
+  bool GetLibraryChangesSince(int64_t generation,
+                              unsigned int maxChanges,
+                              std::vector<LibraryChange>& changes) const;
+
+  /*!
+   * @brief Delete the changes that every instance has picked up by now from the changelog table.
+   * @param maxAge Delete the changes recorded longer ago than this.
+   */
+  void PruneLibraryChanges(std::chrono::seconds maxAge);
+
   /*!
    * @brief Delete values from a table.
    * @param strTable The table to delete the values from.
@@ -242,6 +323,30 @@ public:
    */
   size_t GetDeleteQueriesCount();
 
+  /*!
+   * @brief Start a write batch, e.g. for a library scan. Until EndWriteBatch() the transactions
+   *        begun by the database methods become savepoints of one enclosing transaction, which
+   *        is committed after itemsPerCommit calls of WriteBatchItemDone() or once it has been
+   *        open for a second, whichever comes first. A rollback only undoes the work since the
+   *        matching BeginTransaction().
+   * @param itemsPerCommit The number of items per commit, values below 2 disable batching.
+   * @sa WriteBatchItemDone, EndWriteBatch
+   */
+  void BeginWriteBatch(unsigned int itemsPerCommit);
+
+  /*!
+   * @brief Mark the end of the writes for one item of a write batch. Commits the batch if it is
+   *        due and no transaction of the database methods is open.
+   */
+  void WriteBatchItemDone();
+
+  /*!
+   * @brief Commit pending writes and end the write batch.
+   */
+  void EndWriteBatch();
+
+  bool InWriteBatch() const { return m_writeBatchSize > 0; }
+
   virtual bool GetFilter(CDbUrl& dbUrl, Filter& filter, SortDescription& sorting) { return true; }
   virtual bool BuildSQL(const std::string& strBaseDir,
                         const std::string& strQuery,
@@ -298,6 +403,11 @@ protected:
 
   bool BuildSQL(const std::string& strQuery, const Filter& filter, std::string& strSQL) const;
 
+  /*! \brief Create the changelog table of databases that record library changes.
+   \sa LogLibraryChange
+   */
+  void CreateChangeLogTable();
+
   bool m_sqlite; ///< \brief whether we use sqlite (defaults to true)
 
   std::unique_ptr<dbiplus::Database> m_pDB;
@@ -311,6 +421,8 @@ protected:
 private:
   void InitSettings(DatabaseSettings& dbSettings);
   void UpdateVersionNumber();
+  void FlushWriteBatch();
+  void ExecuteSavepoint(const char* statement);
 
   bool m_bMultiInsert =
       false; /*!< True if there are any queries in the insert queue, false otherwise */
@@ -320,4 +432,12 @@ private:
 
   bool m_multipleExecute;
   std::vector<std::string> m_multipleQueries;
+
+  unsigned int m_writeBatchSize = 0; /*!< items per commit of the write batch, 0 if none */
+  unsigned int m_writeBatchItems = 0; /*!< items written since the last commit */
+  unsigned int m_writeBatchDepth = 0; /*!< open savepoints */
+  bool m_writeBatchOpen = false; /*!< whether the batch transaction has been started */
+  std::chrono::steady_clock::time_point m_writeBatchStart;
+
+  std::string m_connectionKey; /*!< identifies the connection for reuse, empty if not reusable */
 };
@@ -80,6 +80,59 @@ std::string Database::prepare(const char* format, ...)
   return result;
 }
 
+std::string Database::bind_params(const std::string& sql, const sql_params& params)
+{
+  std::string result;
+  result.reserve(sql.size() + params.size() * 16);
+
+  size_t next = 0;
+  bool quoted = false;
+  for (const char c : sql)
+  {
+    if (c == '\'')
+      quoted = !quoted;
+    if (c != '?' || quoted)
+    {
+      result += c;
+      continue;
+    }
+
+    if (next >= params.size())
+      throw DbErrors("Too few parameters for query: %s", sql.c_str());
+
+    const field_value& value = params[next++];
+    if (value.get_isNull())
+    {
+      result += "NULL";
+      continue;
+    }
+    switch (value.get_fType())
+    {
+      case ft_Boolean:
+      case ft_Short:
+      case ft_UShort:
+      case ft_Int:
+      case ft_UInt:
+      case ft_Int64:
+        result += std::to_string(value.get_asInt64());
+        break;
+      case ft_Float:
+      case ft_Double:
+      case ft_LongDouble:
+        result += StringUtils::Format("{}", value.get_asDouble());
+        break;
+      default:
+        result += prepare("'%s'", value.get_asString().c_str());
+        break;
+    }
+  }
+
+  if (next != params.size())
+    throw DbErrors("Too many parameters for query: %s", sql.c_str());
+
+  return result;
+}
+
 //************* Dataset implementation ***************
 
 Dataset::Dataset() : select_sql("")
@@ -203,6 +256,16 @@ void Dataset::parse_sql(std::string& sql)
   } //for
 }
 
+int Dataset::exec(const std::string& sql, const sql_params& params)
+{
+  return exec(db->bind_params(sql, params));
+}
+
+bool Dataset::query(const std::string& sql, const sql_params& params)
+{
+  return query(db->bind_params(sql, params));
+}
+
 void Dataset::close(void)
 {
   haveError = false;
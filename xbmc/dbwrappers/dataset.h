@@ -162,6 +162,14 @@ public:
    */
   virtual std::string vprepare(const char* format, va_list args) = 0;
 
+  /*! \brief Substitute the ? placeholders of a SQL statement with escaped parameter values.
+   Used by backends that do not bind parameters natively.
+   \param sql - statement with one ? placeholder per parameter, outside of string literals.
+   \param params - the values to substitute, in order.
+   \return the statement with the values inserted.
+   */
+  std::string bind_params(const std::string& sql, const sql_params& params);
+
   virtual bool in_transaction() { return false; }
 };
 
@@ -313,6 +321,13 @@ public:
   virtual const void* getExecRes() = 0;
   /* as open, but with our query exec Sql */
   virtual bool query(const std::string& sql) = 0;
+  /*! \brief Execute a statement with ? placeholders bound to params.
+   Backends with native parameter binding keep the parsed statement cached per connection, so
+   repeated calls only pay for binding and execution.
+   */
+  virtual int exec(const std::string& sql, const sql_params& params);
+  /*! \brief Run a select query with ? placeholders bound to params, see exec(sql, params). */
+  virtual bool query(const std::string& sql, const sql_params& params);
   /* Close SQL Query*/
   virtual void close();
   /* This function looks for field Field_name with value equal Field_value
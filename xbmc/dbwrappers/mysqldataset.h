@@ -140,6 +140,9 @@ or insert() operations default = false) */
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  /* parametrized versions, the values are substituted client side */
+  using Dataset::exec;
+  using Dataset::query;
   /* func. closes a query */
   void close(void) override;
   /* Cancel changes, made in insert or edit states of dataset */
@@ -67,6 +67,7 @@ private:
 public:
   field_value();
   explicit field_value(const char* s);
+  explicit field_value(const std::string& s);
   explicit field_value(const bool b);
   explicit field_value(const char c);
   explicit field_value(const short s);
@@ -248,6 +249,7 @@ struct field
 
 typedef std::vector<field> Fields;
 typedef std::vector<field_value> sql_record;
+typedef std::vector<field_value> sql_params;
 typedef std::vector<field_prop> record_prop;
 typedef std::vector<sql_record*> query_data;
 typedef field_value variant;
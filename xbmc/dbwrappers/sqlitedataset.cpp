@@ -157,6 +157,9 @@ const std::map<int, const char*> g_SqliteErrorStrings = {
 #endif
 };
 #undef X
+
+// number of parametrized statements kept prepared per connection
+constexpr size_t MAX_CACHED_STATEMENTS = 64;
 } // namespace
 
 namespace dbiplus
@@ -383,10 +386,44 @@ void SqliteDatabase::disconnect(void)
 {
   if (active == false)
     return;
+  clear_statements();
   sqlite3_close(conn);
   active = false;
 }
 
+sqlite3_stmt* SqliteDatabase::get_statement(const std::string& sql)
+{
+  const auto it = statement_index.find(sql);
+  if (it != statement_index.end())
+  {
+    statements.splice(statements.begin(), statements, it->second);
+    return it->second->second;
+  }
+
+  sqlite3_stmt* stmt = nullptr;
+  if (setErr(sqlite3_prepare_v2(conn, sql.c_str(), -1, &stmt, nullptr), sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", getErrorMsg());
+
+  statements.emplace_front(sql, stmt);
+  statement_index.emplace(sql, statements.begin());
+
+  if (statements.size() > MAX_CACHED_STATEMENTS)
+  {
+    sqlite3_finalize(statements.back().second);
+    statement_index.erase(statements.back().first);
+    statements.pop_back();
+  }
+  return stmt;
+}
+
+void SqliteDatabase::clear_statements()
+{
+  for (const auto& statement : statements)
+    sqlite3_finalize(statement.second);
+  statements.clear();
+  statement_index.clear();
+}
+
 int SqliteDatabase::create()
 {
   return connect(true);
@@ -892,6 +929,23 @@ bool SqliteDataset::query(const std::string& query)
       SQLITE_OK)
     throw DbErrors("%s", db->getErrorMsg());
 
+  fetch_rows(stmt);
+
+  if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
+  {
+    active = true;
+    ds_state = dsSelect;
+    this->first();
+    return true;
+  }
+  else
+  {
+    throw DbErrors("%s", db->getErrorMsg());
+  }
+}
+
+void SqliteDataset::fetch_rows(sqlite3_stmt* stmt)
+{
   // column headers
   const unsigned int numColumns = sqlite3_column_count(stmt);
   result.record_header.resize(numColumns);
@@ -931,17 +985,113 @@ bool SqliteDataset::query(const std::string& query)
     }
     result.records.push_back(res);
   }
-  if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
+}
+
+void SqliteDataset::bind_params(sqlite3_stmt* stmt,
+                                const sql_params& params,
+                                const std::string& sql)
+{
+  if (sqlite3_bind_parameter_count(stmt) != static_cast<int>(params.size()))
+    throw DbErrors("Parameter count mismatch for query: %s", sql.c_str());
+
+  for (size_t i = 0; i < params.size(); i++)
   {
-    active = true;
-    ds_state = dsSelect;
-    this->first();
-    return true;
+    const field_value& value = params[i];
+    const int index = static_cast<int>(i) + 1;
+    int rc;
+    if (value.get_isNull())
+    {
+      rc = sqlite3_bind_null(stmt, index);
+    }
+    else
+    {
+      switch (value.get_fType())
+      {
+        case ft_Boolean:
+        case ft_Short:
+        case ft_UShort:
+        case ft_Int:
+        case ft_UInt:
+        case ft_Int64:
+          rc = sqlite3_bind_int64(stmt, index, value.get_asInt64());
+          break;
+        case ft_Float:
+        case ft_Double:
+        case ft_LongDouble:
+          rc = sqlite3_bind_double(stmt, index, value.get_asDouble());
+          break;
+        default:
+        {
+          const std::string str = value.get_asString();
+          rc = sqlite3_bind_text(stmt, index, str.c_str(), static_cast<int>(str.size()),
+                                 SQLITE_TRANSIENT);
+          break;
+        }
+      }
+    }
+    if (db->setErr(rc, sql.c_str()) != SQLITE_OK)
+      throw DbErrors("%s", db->getErrorMsg());
   }
-  else
+}
+
+int SqliteDataset::exec(const std::string& sql, const sql_params& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+  exec_res.clear();
+
+  sqlite3_stmt* stmt = static_cast<SqliteDatabase*>(db)->get_statement(sql);
+  int rc;
+  try
+  {
+    bind_params(stmt, params, sql);
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+      ;
+  }
+  catch (...)
   {
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    throw;
+  }
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+
+  if (db->setErr(rc == SQLITE_DONE ? SQLITE_OK : rc, sql.c_str()) != SQLITE_OK)
     throw DbErrors("%s", db->getErrorMsg());
+  return SQLITE_OK;
+}
+
+bool SqliteDataset::query(const std::string& sql, const sql_params& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  close();
+
+  sqlite3_stmt* stmt = static_cast<SqliteDatabase*>(db)->get_statement(sql);
+  try
+  {
+    bind_params(stmt, params, sql);
+    fetch_rows(stmt);
+  }
+  catch (...)
+  {
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    throw;
   }
+  // returns the error of the last step, if any
+  const int rc = sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+
+  if (db->setErr(rc, sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  active = true;
+  ds_state = dsSelect;
+  this->first();
+  return true;
 }
 
 void SqliteDataset::open(const std::string& sql)
@@ -14,7 +14,11 @@
 
 #include "dataset.h"
 
+#include <list>
 #include <stdio.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
 #include <sqlite3.h>
 
@@ -33,6 +37,11 @@ protected:
   bool _in_transaction;
   int last_err;
 
+  /* prepared statements of parametrized queries, most recently used first */
+  typedef std::list<std::pair<std::string, sqlite3_stmt*>> StatementList;
+  StatementList statements;
+  std::unordered_map<std::string, StatementList::iterator> statement_index;
+
 public:
   /* default constructor */
   SqliteDatabase();
@@ -83,6 +92,12 @@ public:
   std::string vprepare(const char* format, va_list args) override;
 
   bool in_transaction() override { return _in_transaction; }
+
+  /* func. returns the cached prepared statement for sql, preparing it if needed. The statement
+     is reset and has no bindings, it must be reset again before the next call. */
+  sqlite3_stmt* get_statement(const std::string& sql);
+  /* func. finalizes all cached statements */
+  void clear_statements();
 };
 
 /***************** Class SqliteDataset definition *******************
@@ -112,6 +127,10 @@ protected:
   void fill_fields() override;
   /* Changing field values during dataset navigation */
   virtual void free_row(); // free the memory allocated for the current row
+  /* Binds params to the placeholders of stmt */
+  void bind_params(sqlite3_stmt* stmt, const sql_params& params, const std::string& sql);
+  /* Reads all rows of stmt into the result set */
+  void fetch_rows(sqlite3_stmt* stmt);
 
 public:
   /* constructor */
@@ -134,6 +153,9 @@ or insert() operations default = false) */
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  /* parametrized versions of exec and query using the cached statements of the connection */
+  int exec(const std::string& sql, const sql_params& params) override;
+  bool query(const std::string& sql, const sql_params& params) override;
   /* func. closes a query */
   void close(void) override;
   /* Cancel changes, made in insert or edit states of dataset */
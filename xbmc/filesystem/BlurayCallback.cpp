@@ -9,11 +9,22 @@
 #include "BlurayCallback.h"
 
 #include "FileItem.h"
+#include "XBDateTime.h"
 #include "filesystem/Directory.h"
 #include "filesystem/File.h"
+#include "threads/CriticalSection.h"
+#include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 using namespace XFILE;
 
 struct SDirState
@@ -22,6 +33,118 @@ struct SDirState
   int curr = 0;
 };
 
+namespace
+{
+// libbluray reads the playlists, clip info and other navigation files of a disc in many small
+// pieces, once to list the titles and again when playback starts. On network shares and ISOs
+// every piece is a round trip, so these files are loaded whole, in parallel where libbluray is
+// about to read all of them, and kept in memory. An entry is only used while size and
+// modification time in the latest listing of its folder match, which also tells discs apart that
+// are inserted into the same drive.
+constexpr int64_t MAX_METADATA_FILE_SIZE = 1024 * 1024;
+constexpr size_t MAX_METADATA_CACHE_SIZE = 16 * 1024 * 1024;
+constexpr size_t PREFETCH_TASKS = 4;
+
+struct FileStamp
+{
+  int64_t size = 0;
+  CDateTime mtime;
+
+  bool operator==(const FileStamp& other) const
+  {
+    return size == other.size && mtime == other.mtime;
+  }
+};
+
+struct CachedFile
+{
+  FileStamp stamp;
+  std::shared_ptr<const std::vector<uint8_t>> data;
+};
+
+struct SMemFile
+{
+  std::shared_ptr<const std::vector<uint8_t>> data;
+  int64_t pos = 0;
+};
+
+CCriticalSection metadataSection;
+std::map<std::string, FileStamp> listedFiles;
+std::map<std::string, CachedFile> metadataFiles;
+size_t metadataSize = 0;
+
+bool IsMetadataFile(const std::string& path)
+{
+  return URIUtils::HasExtension(path, ".mpls|.clpi|.bdmv");
+}
+
+std::shared_ptr<const std::vector<uint8_t>> GetMetadataFile(const std::string& path)
+{
+  FileStamp stamp;
+  {
+    std::unique_lock<CCriticalSection> lock(metadataSection);
+    const auto listed = listedFiles.find(path);
+    if (listed == listedFiles.end() || listed->second.size > MAX_METADATA_FILE_SIZE)
+      return {};
+
+    stamp = listed->second;
+    const auto cached = metadataFiles.find(path);
+    if (cached != metadataFiles.end() && cached->second.stamp == stamp)
+      return cached->second.data;
+  }
+
+  auto data = std::make_shared<std::vector<uint8_t>>();
+  CFile file;
+  if (file.LoadFile(path, *data) < 0)
+    return {};
+
+  std::unique_lock<CCriticalSection> lock(metadataSection);
+  if (metadataSize + data->size() > MAX_METADATA_CACHE_SIZE)
+  {
+    metadataFiles.clear();
+    metadataSize = 0;
+  }
+  auto& cached = metadataFiles[path];
+  metadataSize -= cached.data ? cached.data->size() : 0;
+  metadataSize += data->size();
+  cached.stamp = stamp;
+  cached.data = data;
+  return data;
+}
+
+void AddListing(const CFileItemList& items)
+{
+  std::unique_lock<CCriticalSection> lock(metadataSection);
+  for (const auto& item : items)
+  {
+    if (!item->m_bIsFolder && IsMetadataFile(item->GetPath()))
+      listedFiles[item->GetPath()] = {item->m_dwSize, item->m_dateTime};
+  }
+}
+
+void PrefetchMetadataFiles(const CFileItemList& items)
+{
+  std::vector<std::string> paths;
+  for (const auto& item : items)
+  {
+    if (!item->m_bIsFolder && IsMetadataFile(item->GetPath()))
+      paths.emplace_back(item->GetPath());
+  }
+
+  std::atomic<size_t> next{0};
+  std::vector<std::future<void>> tasks;
+  for (size_t i = 0; i < std::min(PREFETCH_TASKS, paths.size()); ++i)
+  {
+    tasks.emplace_back(std::async(std::launch::async, [&paths, &next]() {
+      for (size_t j = next++; j < paths.size(); j = next++)
+        GetMetadataFile(paths[j]);
+    }));
+  }
+  for (auto& task : tasks)
+    task.wait();
+}
+} // unnamed namespace
+
 void CBlurayCallback::bluray_logger(const char* msg)
 {
   std::string msgStr(msg);
@@ -68,6 +191,27 @@ BD_DIR_H* CBlurayCallback::dir_open(void *handle, const char* rel_path)
     return nullptr;
   }
 
+  AddListing(st->list);
+
+  // all playlists are read to build the title list, and with them the clip info of their clips
+  std::string relDir(strRelPath);
+  StringUtils::Replace(relDir, '\\', '/');
+  URIUtils::RemoveSlashAtEnd(relDir);
+  if (StringUtils::EqualsNoCase(relDir, "BDMV/PLAYLIST"))
+  {
+    CLog::Log(LOGDEBUG, "CBlurayCallback - Prefetching navigation files of {}",
+              CURL::GetRedacted(*strBasePath));
+    PrefetchMetadataFiles(st->list);
+
+    CFileItemList clipInfo;
+    if (CDirectory::GetDirectory(URIUtils::AddFileToFolder(*strBasePath, "BDMV", "CLIPINF"),
+                                 clipInfo, "", DIR_FLAG_DEFAULTS))
+    {
+      AddListing(clipInfo);
+      PrefetchMetadataFiles(clipInfo);
+    }
+  }
+
   BD_DIR_H *dir = new BD_DIR_H;
   dir->close = dir_close;
   dir->read = dir_read;
@@ -119,6 +263,23 @@ BD_FILE_H * CBlurayCallback::file_open(void *handle, const char *rel_path)
 
   std::string strFilename = URIUtils::AddFileToFolder(*strBasePath, strRelPath);
 
+  if (IsMetadataFile(strFilename))
+  {
+    auto data = GetMetadataFile(strFilename);
+    if (data)
+    {
+      BD_FILE_H* file = new BD_FILE_H;
+      file->close = mem_file_close;
+      file->seek = mem_file_seek;
+      file->read = mem_file_read;
+      file->write = mem_file_write;
+      file->tell = mem_file_tell;
+      file->eof = mem_file_eof;
+      file->internal = new SMemFile{std::move(data)};
+      return file;
+    }
+  }
+
   BD_FILE_H *file = new BD_FILE_H;
 
   file->close = file_close;
@@ -162,3 +323,66 @@ int64_t CBlurayCallback::file_write(BD_FILE_H *file, const uint8_t *buf, int64_t
 {
   return static_cast<int64_t>(static_cast<CFile*>(file->internal)->Write(buf, static_cast<size_t>(size)));
 }
+
+void CBlurayCallback::mem_file_close(BD_FILE_H* file)
+{
+  if (file)
+  {
+    delete static_cast<SMemFile*>(file->internal);
+    delete file;
+  }
+}
+
+int CBlurayCallback::mem_file_eof(BD_FILE_H* file)
+{
+  const SMemFile* memFile = static_cast<SMemFile*>(file->internal);
+  return memFile->pos >= static_cast<int64_t>(memFile->data->size()) ? 1 : 0;
+}
+
+int64_t CBlurayCallback::mem_file_read(BD_FILE_H* file, uint8_t* buf, int64_t size)
+{
+  SMemFile* memFile = static_cast<SMemFile*>(file->internal);
+  const int64_t length = static_cast<int64_t>(memFile->data->size());
+  if (size <= 0 || memFile->pos >= length)
+    return 0;
+
+  size = std::min(size, length - memFile->pos);
+  std::copy_n(memFile->data->data() + memFile->pos, size, buf);
+  memFile->pos += size;
+  return size;
+}
+
+int64_t CBlurayCallback::mem_file_seek(BD_FILE_H* file, int64_t offset, int32_t origin)
+{
+  SMemFile* memFile = static_cast<SMemFile*>(file->internal);
+  int64_t pos;
+  switch (origin)
+  {
+    case SEEK_SET:
+      pos = offset;
+      break;
+    case SEEK_CUR:
+      pos = memFile->pos + offset;
+      break;
+    case SEEK_END:
+      pos = static_cast<int64_t>(memFile->data->size()) + offset;
+      break;
+    default:
+      return -1;
+  }
+  if (pos < 0)
+    return -1;
+
+  memFile->pos = pos;
+  return pos;
+}
+
+int64_t CBlurayCallback::mem_file_tell(BD_FILE_H* file)
+{
+  return static_cast<SMemFile*>(file->internal)->pos;
+}
+
+int64_t CBlurayCallback::mem_file_write(BD_FILE_H* file, const uint8_t* buf, int64_t size)
+{
+  return -1;
+}
@@ -25,6 +25,14 @@ public:
   static int64_t file_tell(BD_FILE_H* file);
   static int64_t file_write(BD_FILE_H* file, const uint8_t* buf, int64_t size);
 
+  // navigation files of the disc are served from memory, see file_open
+  static void mem_file_close(BD_FILE_H* file);
+  static int mem_file_eof(BD_FILE_H* file);
+  static int64_t mem_file_read(BD_FILE_H* file, uint8_t* buf, int64_t size);
+  static int64_t mem_file_seek(BD_FILE_H* file, int64_t offset, int32_t origin);
+  static int64_t mem_file_tell(BD_FILE_H* file);
+  static int64_t mem_file_write(BD_FILE_H* file, const uint8_t* buf, int64_t size);
+
 private:
   CBlurayCallback() = default;
   ~CBlurayCallback() = default;
@@ -16,6 +16,7 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
 #include "threads/SystemClock.h"
 #include "utils/Base64.h"
 #include "utils/XTimeUtils.h"
@@ -23,6 +24,9 @@
 #include <algorithm>
 #include <cassert>
 #include <climits>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #ifdef TARGET_POSIX
@@ -117,6 +121,52 @@ extern "C" size_t header_callback(void *ptr, size_t size, size_t nmemb, void *st
   return state->HeaderCallback(ptr, size, nmemb);
 }
 
+namespace
+{
+struct RangePart
+{
+  CCurlFile::CReadState state;
+  char* dest = nullptr;
+  size_t size = 0;
+  size_t received = 0;
+  bool checked = false;
+  bool done = false;
+  bool failed = false;
+};
+
+// number of range requests currently running per host
+CCriticalSection rangeConnectionsSection;
+std::map<std::string, unsigned int> rangeConnections;
+
+// don't bother splitting blocks into smaller requests than this
+constexpr size_t RANGE_MIN_PART_SIZE = 256 * 1024;
+
+// reads of at least this size are filled by curl directly, smaller ones go through the ring buffer
+constexpr size_t DIRECT_READ_MIN_SIZE = 16 * 1024;
+} // unnamed namespace
+
+/* used by CCurlFile::ReadRanges, writes straight into the destination buffer */
+extern "C" size_t range_write_callback(char* buffer, size_t size, size_t nitems, void* userp)
+{
+  RangePart* part = static_cast<RangePart*>(userp);
+  const size_t amount = size * nitems;
+  if (!part->checked)
+  {
+    // anything but a partial response means the server ignored the range
+    long response = 0;
+    g_curlInterface.easy_getinfo(part->state.m_easyHandle, CURLINFO_RESPONSE_CODE, &response);
+    if (response != 206)
+      return 0;
+    part->checked = true;
+  }
+  if (part->received + amount > part->size)
+    return 0;
+
+  memcpy(part->dest + part->received, buffer, amount);
+  part->received += amount;
+  return amount;
+}
+
 /* used only by CCurlFile::Stat to bail out of unwanted transfers */
 extern "C" int transfer_abort_callback(void *clientp,
                curl_off_t dltotal,
@@ -183,6 +233,20 @@ size_t CCurlFile::CReadState::ReadCallback(char *buffer, size_t size, size_t nit
 size_t CCurlFile::CReadState::WriteCallback(char *buffer, size_t size, size_t nitems)
 {
   unsigned int amount = size * nitems;
+
+  // as long as nothing is buffered the data can go straight to the reader, anything that does not
+  // fit is buffered as usual behind it
+  if (m_directBuffer && m_overflowSize == 0 && m_buffer.getMaxReadSize() == 0)
+  {
+    const size_t direct = std::min<size_t>(m_directSize - m_directWritten, amount);
+    memcpy(m_directBuffer + m_directWritten, buffer, direct);
+    m_directWritten += direct;
+    amount -= direct;
+    buffer += direct;
+    if (amount == 0)
+      return size * nitems;
+  }
+
   if (m_overflowSize)
   {
     // we have our overflow buffer - first get rid of as much as we can
@@ -534,8 +598,8 @@ void CCurlFile::SetCommonOptions(CReadState* state, bool failOnError /* = true *
   if (!m_verifyPeer)
     g_curlInterface.easy_setopt(h, CURLOPT_SSL_VERIFYPEER, 0);
 
-  g_curlInterface.easy_setopt(m_state->m_easyHandle, CURLOPT_URL, m_url.c_str());
-  g_curlInterface.easy_setopt(m_state->m_easyHandle, CURLOPT_TRANSFERTEXT, CURL_OFF);
+  g_curlInterface.easy_setopt(h, CURLOPT_URL, m_url.c_str());
+  g_curlInterface.easy_setopt(h, CURLOPT_TRANSFERTEXT, CURL_OFF);
 
   // setup POST data if it is set (and it may be empty)
   if (m_postdataset)
@@ -671,6 +735,14 @@ void CCurlFile::SetCommonOptions(CReadState* state, bool failOnError /* = true *
   if (!m_cipherlist.empty())
     g_curlInterface.easy_setopt(h, CURLOPT_SSL_CIPHER_LIST, m_cipherlist.c_str());
 
+  // reuse connections and TLS sessions of other sessions instead of a handshake per session
+  if (g_curlInterface.GetShareHandle())
+    g_curlInterface.easy_setopt(h, CURLOPT_SHARE, g_curlInterface.GetShareHandle());
+  g_curlInterface.easy_setopt(
+      h, CURLOPT_MAXCONNECTS,
+      static_cast<long>(
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_curlMaxConnects));
+
   if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_curlDisableHTTP2)
     g_curlInterface.easy_setopt(h, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
   else
@@ -1017,6 +1089,161 @@ bool CCurlFile::Download(const std::string& strURL, const std::string& strFileNa
 }
 
 // Detect whether we are "online" or not! Very simple and dirty!
+ssize_t CCurlFile::ReadRanges(int64_t pos,
+                              char* buffer,
+                              size_t size,
+                              unsigned int connections,
+                              const std::function<bool()>& abort)
+{
+  if (!m_opened || !m_seekable || size == 0)
+    return -1;
+
+  const CURL url(m_url);
+  if (!url.IsProtocol("http") && !url.IsProtocol("https"))
+    return -1;
+
+  const std::string host = url.GetHostName();
+  const unsigned int maxConnections = static_cast<unsigned int>(std::max(
+      1, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_curlRangeConnections));
+  const size_t maxParts = std::max<size_t>(1, size / RANGE_MIN_PART_SIZE);
+  unsigned int count =
+      static_cast<unsigned int>(std::min<size_t>({connections, maxConnections, maxParts}));
+  {
+    std::unique_lock<CCriticalSection> lock(rangeConnectionsSection);
+    unsigned int& inUse = rangeConnections[host];
+    count = std::min(count, maxConnections > inUse ? maxConnections - inUse : 0);
+    inUse += count;
+  }
+  if (count == 0)
+    return -1;
+
+  std::vector<std::unique_ptr<RangePart>> parts;
+  CURLM* multi = nullptr;
+  const size_t partSize = (size + count - 1) / count;
+  for (size_t offset = 0; offset < size; offset += partSize)
+  {
+    auto part = std::make_unique<RangePart>();
+    part->dest = buffer + offset;
+    part->size = std::min(partSize, size - offset);
+
+    CReadState& state = part->state;
+    g_curlInterface.easy_acquire(url.GetProtocol().c_str(), host.c_str(), &state.m_easyHandle,
+                                 &state.m_multiHandle);
+    SetCommonOptions(&state);
+    SetRequestHeaders(&state);
+
+    // the data must arrive unmodified to fit exactly into its part of the buffer
+    g_curlInterface.easy_setopt(state.m_easyHandle, CURLOPT_WRITEDATA, part.get());
+    g_curlInterface.easy_setopt(state.m_easyHandle, CURLOPT_WRITEFUNCTION, range_write_callback);
+    g_curlInterface.easy_setopt(state.m_easyHandle, CURLOPT_ACCEPT_ENCODING, "identity");
+    const std::string range = std::to_string(pos + offset) + "-" +
+                              std::to_string(pos + offset + part->size - 1);
+    g_curlInterface.easy_setopt(state.m_easyHandle, CURLOPT_RANGE, range.c_str());
+
+    // all requests share the multi handle of the first one
+    if (!multi)
+      multi = state.m_multiHandle;
+    g_curlInterface.multi_add_handle(multi, state.m_easyHandle);
+    parts.emplace_back(std::move(part));
+  }
+
+  int running = static_cast<int>(parts.size());
+  while (running && !abort())
+  {
+    CURLMcode result;
+    while ((result = g_curlInterface.multi_perform(multi, &running)) == CURLM_CALL_MULTI_PERFORM)
+      ;
+    if (result != CURLM_OK)
+      break;
+
+    int msgs;
+    CURLMsg* msg;
+    while ((msg = g_curlInterface.multi_info_read(multi, &msgs)))
+    {
+      if (msg->msg != CURLMSG_DONE)
+        continue;
+
+      for (auto& part : parts)
+      {
+        if (part->state.m_easyHandle != msg->easy_handle)
+          continue;
+
+        long response = 0;
+        g_curlInterface.easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &response);
+        part->done = true;
+        part->failed =
+            msg->data.result != CURLE_OK || response != 206 || part->received != part->size;
+        if (part->failed)
+          CLog::Log(LOGDEBUG, "CCurlFile::{} - <{}> Range request failed with code {}: {}",
+                    __FUNCTION__, CURL::GetRedacted(m_url), response,
+                    g_curlInterface.easy_strerror(msg->data.result));
+      }
+    }
+
+    if (!running)
+      break;
+
+    fd_set fdread;
+    fd_set fdwrite;
+    fd_set fdexcep;
+    int maxfd = -1;
+    FD_ZERO(&fdread);
+    FD_ZERO(&fdwrite);
+    FD_ZERO(&fdexcep);
+    g_curlInterface.multi_fdset(multi, &fdread, &fdwrite, &fdexcep, &maxfd);
+
+    // wake up regularly to poll abort
+    long timeout = 0;
+    if (CURLM_OK != g_curlInterface.multi_timeout(multi, &timeout) || timeout < 0 ||
+        timeout > 100)
+      timeout = 100;
+
+    if (maxfd == -1)
+    {
+      KODI::TIME::Sleep(std::chrono::milliseconds(timeout));
+    }
+    else
+    {
+      struct timeval wait = {0, static_cast<int>(timeout) * 1000};
+      if (select(maxfd + 1, &fdread, &fdwrite, &fdexcep, &wait) == SOCKET_ERROR)
+      {
+#ifdef TARGET_WINDOWS
+        if (WSAGetLastError() != WSAEINTR)
+#else
+        if (errno != EINTR)
+#endif
+          break;
+      }
+    }
+  }
+
+  // the contiguous data from the start of the block is usable, even if later parts failed
+  size_t read = 0;
+  bool gap = false;
+  bool failed = false;
+  for (auto& part : parts)
+  {
+    g_curlInterface.multi_remove_handle(multi, part->state.m_easyHandle);
+    if (gap)
+      continue;
+
+    if (part->failed)
+      failed = true;
+    else
+      read += part->received;
+    gap = !part->done || part->failed;
+  }
+
+  {
+    std::unique_lock<CCriticalSection> lock(rangeConnectionsSection);
+    rangeConnections[host] -= count;
+  }
+
+  if (read == 0 && failed)
+    return -1;
+  return static_cast<ssize_t>(read);
+}
+
 bool CCurlFile::IsInternet()
 {
   CURL url("http://www.msftconnecttest.com/connecttest.txt");
@@ -1640,17 +1867,33 @@ int CCurlFile::Stat(const CURL& url, struct __stat64* buffer)
 
 ssize_t CCurlFile::CReadState::Read(void* lpBuf, size_t uiBufSize)
 {
+  if (uiBufSize >= DIRECT_READ_MIN_SIZE && m_buffer.getMaxReadSize() == 0 && m_overflowSize == 0)
+  {
+    m_directBuffer = static_cast<char*>(lpBuf);
+    m_directSize = uiBufSize;
+  }
+
   /* only request 1 byte, for truncated reads (only if not eof) */
+  int8_t result = FILLBUFFER_OK;
   if (m_fileSize == 0 || m_filePos < m_fileSize)
-  {
-    int8_t result = FillBuffer(1);
-    if (result == FILLBUFFER_FAIL)
-      return -1; // Fatal error
+    result = FillBuffer(1);
 
-    if (result == FILLBUFFER_NO_DATA)
-      return 0;
+  const size_t direct = m_directWritten;
+  m_directBuffer = nullptr;
+  m_directSize = 0;
+  m_directWritten = 0;
+  if (direct > 0)
+  {
+    m_filePos += direct;
+    return direct;
   }
 
+  if (result == FILLBUFFER_FAIL)
+    return -1; // Fatal error
+
+  if (result == FILLBUFFER_NO_DATA)
+    return 0;
+
   /* ensure only available data is considered */
   unsigned int want = std::min<unsigned int>(m_buffer.getMaxReadSize(), uiBufSize);
 
@@ -1684,7 +1927,7 @@ int8_t CCurlFile::CReadState::FillBuffer(unsigned int want)
 
   // only attempt to fill buffer if transactions still running and buffer
   // doesn't exceed required size already
-  while (m_buffer.getMaxReadSize() < want && m_buffer.getMaxWriteSize() > 0 )
+  while (m_buffer.getMaxReadSize() + m_directWritten < want && m_buffer.getMaxWriteSize() > 0)
   {
     if (m_cancelled)
       return FILLBUFFER_NO_DATA;
@@ -1710,7 +1953,7 @@ int8_t CCurlFile::CReadState::FillBuffer(unsigned int want)
       if (result == CURLM_OK)
       {
         /* if we still have stuff in buffer, we are fine */
-        if (m_buffer.getMaxReadSize())
+        if (m_buffer.getMaxReadSize() || m_directWritten)
           return FILLBUFFER_OK;
 
         // check for errors
@@ -1785,6 +2028,7 @@ int8_t CCurlFile::CReadState::FillBuffer(unsigned int want)
         free(m_overflowBuffer);
         m_overflowBuffer = NULL;
         m_overflowSize = 0;
+        m_directWritten = 0; // received again after the reconnect
         m_bLastError = true; // Flag error for the next run
 
         // Retry immediately or leave it up to the caller?
@@ -1809,7 +2053,7 @@ int8_t CCurlFile::CReadState::FillBuffer(unsigned int want)
     }
 
     // We've finished out first loop
-    if(m_bFirstLoop && m_buffer.getMaxReadSize() > 0)
+    if (m_bFirstLoop && (m_buffer.getMaxReadSize() > 0 || m_directWritten > 0))
       m_bFirstLoop = false;
 
     // No error this run
@@ -12,6 +12,7 @@
 #include "utils/HttpHeader.h"
 #include "utils/RingBuffer.h"
 
+#include <functional>
 #include <map>
 #include <string>
 
@@ -58,6 +59,23 @@ namespace XFILE
       bool Get(const std::string& strURL, std::string& strHTML);
       bool ReadData(std::string& strHTML);
       bool Download(const std::string& strURL, const std::string& strFileName, unsigned int* pdwSize = NULL);
+
+      /*!
+       \brief Read a block of the opened file with several concurrent HTTP range requests.
+       The position of the regular read stream is not changed.
+       \param pos Position of the block in the file
+       \param buffer Receives the block in file order
+       \param size Size of the block
+       \param connections Number of requests to split the block into, further capped by the
+       per host limit advancedsettings <network><curlrangeconnections>
+       \param abort Polled while transferring, return true to stop early
+       \return Number of contiguous bytes read from pos, -1 if the block can't be read this way
+       */
+      ssize_t ReadRanges(int64_t pos,
+                         char* buffer,
+                         size_t size,
+                         unsigned int connections,
+                         const std::function<bool()>& abort);
       bool IsInternet();
       void Cancel();
       void Reset();
@@ -76,10 +94,12 @@ namespace XFILE
       void SetRequestHeader(const std::string& header, const std::string& value);
       void SetRequestHeader(const std::string& header, long value);
 
+      void RemoveRequestHeader(const std::string& header) { m_requestheaders.erase(header); }
       void ClearRequestHeaders();
       void SetBufferSize(unsigned int size);
 
       const CHttpHeader& GetHttpHeader() const { return m_state->m_httpheader; }
+      long GetResponseCode() const { return m_httpresponse; }
       std::string GetURL(void);
       std::string GetRedirectURL();
 
@@ -104,6 +124,12 @@ namespace XFILE
 
           char* m_overflowBuffer; // in the rare case we would overflow the above buffer
           unsigned int m_overflowSize; // size of the overflow buffer
+
+          // buffer of a large read the received data is written to directly while the ring
+          // buffer is empty, saves copying everything through the ring buffer
+          char* m_directBuffer = nullptr;
+          size_t m_directSize = 0;
+          size_t m_directWritten = 0;
           int m_stillRunning; // Is background url fetch still in progress
           bool m_cancelled;
           int64_t m_fileSize;
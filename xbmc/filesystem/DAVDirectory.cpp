@@ -18,8 +18,69 @@
 #include "utils/XBMCTinyXML2.h"
 #include "utils/log.h"
 
+#include <cstring>
+#include <string_view>
+
 using namespace XFILE;
 
+namespace
+{
+bool IsNameEnd(char c)
+{
+  return c == '>' || c == '/' || c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/*
+ * Find the start tag of an element with the given name in any namespace, e.g. <D:response> for
+ * "response". Returns the position of its '<' and the tag name including the prefix.
+ */
+size_t FindStartTag(const std::string& data, size_t from, const char* name, std::string& tag)
+{
+  const size_t nameLength = strlen(name);
+  for (size_t start = data.find('<', from); start != std::string::npos;
+       start = data.find('<', start + 1))
+  {
+    size_t end = start + 1;
+    while (end < data.size() && !IsNameEnd(data[end]))
+      ++end;
+    if (end == data.size())
+      return std::string::npos; // the tag continues in the next chunk
+
+    const std::string_view qualified(data.data() + start + 1, end - start - 1);
+    const size_t colon = qualified.find(':');
+    const std::string_view local =
+        colon == std::string_view::npos ? qualified : qualified.substr(colon + 1);
+    if (local.size() == nameLength && local.compare(0, nameLength, name) == 0)
+    {
+      tag = qualified;
+      return start;
+    }
+  }
+  return std::string::npos;
+}
+
+/*
+ * Find the end tag of an element, returns the position after its '>'
+ */
+size_t FindEndTag(const std::string& data, size_t from, const std::string& tag)
+{
+  const std::string endTag = "</" + tag;
+  for (size_t end = data.find(endTag, from); end != std::string::npos;
+       end = data.find(endTag, end + 1))
+  {
+    size_t close = end + endTag.size();
+    while (close < data.size() && (data[close] == ' ' || data[close] == '\t' ||
+                                   data[close] == '\r' || data[close] == '\n'))
+      ++close;
+    if (close == data.size())
+      return std::string::npos;
+    if (data[close] == '>')
+      return close + 1;
+  }
+  return std::string::npos;
+}
+} // unnamed namespace
+
 CDAVDirectory::CDAVDirectory(void) = default;
 CDAVDirectory::~CDAVDirectory(void) = default;
 
@@ -96,6 +157,35 @@ void CDAVDirectory::ParseResponse(const tinyxml2::XMLElement* element, CFileItem
   }
 }
 
+void CDAVDirectory::AddResponse(const CURL& url,
+                                const tinyxml2::XMLElement* element,
+                                CFileItemList& items)
+{
+  CFileItem item;
+  ParseResponse(element, item);
+  CURL url3(item.GetPath());
+
+  std::string itemPath(URIUtils::AddFileToFolder(url.GetWithoutFilename(), url3.GetFileName()));
+
+  if (item.GetLabel().empty())
+  {
+    std::string name(itemPath);
+    URIUtils::RemoveSlashAtEnd(name);
+    item.SetLabel(CURL::Decode(URIUtils::GetFileName(name)));
+  }
+
+  if (item.m_bIsFolder)
+    URIUtils::AddSlashAtEnd(itemPath);
+
+  // Add back protocol options
+  if (!url.GetProtocolOptions().empty())
+    itemPath += "|" + url.GetProtocolOptions();
+  item.SetPath(itemPath);
+
+  if (!item.IsURL(url))
+    items.Add(std::make_shared<CFileItem>(item));
+}
+
 bool CDAVDirectory::GetDirectory(const CURL& url, CFileItemList &items)
 {
   CCurlFile dav;
@@ -122,53 +212,61 @@ bool CDAVDirectory::GetDirectory(const CURL& url, CFileItemList &items)
     return false;
   }
 
-  std::string strResponse;
-  dav.ReadData(strResponse);
-
-  std::string fileCharset(dav.GetProperty(XFILE::FILE_PROPERTY_CONTENT_CHARSET));
-  CXBMCTinyXML2 davResponse;
-  davResponse.Parse(strResponse);
-
-  if (!davResponse.Parse(strResponse))
+  // A multistatus of a large collection can be many megabytes, so instead of reading and parsing
+  // it as one document every <response> is parsed on its own as soon as it has been received.
+  // They do not nest and their children only need the namespace prefixes stripped, which
+  // CDAVCommon::ValueWithoutNamespace() does without looking at the declarations.
+  std::string buffer;
+  std::string responseTag;
+  size_t responseStart = std::string::npos;
+  size_t pos = 0;
+  bool foundResponse = false;
+  char chunk[16384];
+  ssize_t bytesRead;
+  while ((bytesRead = dav.Read(chunk, sizeof(chunk))) > 0)
   {
-    CLog::LogF(LOGERROR, "Unable to process dav directory ({})", url.GetRedacted());
-    dav.Close();
-    return false;
-  }
+    buffer.append(chunk, bytesRead);
 
-  // Iterate over all responses
-  for (auto* child = davResponse.RootElement()->FirstChild(); child; child = child->NextSibling())
-  {
-    if (CDAVCommon::ValueWithoutNamespace(child, "response"))
+    while (true)
     {
-      CFileItem item;
-      ParseResponse(child->ToElement(), item);
-      const CURL& url2(url);
-      CURL url3(item.GetPath());
-
-      std::string itemPath(URIUtils::AddFileToFolder(url2.GetWithoutFilename(), url3.GetFileName()));
-
-      if (item.GetLabel().empty())
+      if (responseStart == std::string::npos)
       {
-        std::string name(itemPath);
-        URIUtils::RemoveSlashAtEnd(name);
-        item.SetLabel(CURL::Decode(URIUtils::GetFileName(name)));
+        responseStart = FindStartTag(buffer, pos, "response", responseTag);
+        if (responseStart == std::string::npos)
+          break;
       }
 
-      if (item.m_bIsFolder)
-        URIUtils::AddSlashAtEnd(itemPath);
-
-      // Add back protocol options
-      if (!url2.GetProtocolOptions().empty())
-        itemPath += "|" + url2.GetProtocolOptions();
-      item.SetPath(itemPath);
+      const size_t responseEnd = FindEndTag(buffer, responseStart, responseTag);
+      if (responseEnd == std::string::npos)
+      {
+        pos = responseStart;
+        break;
+      }
 
-      if (!item.IsURL(url))
+      CXBMCTinyXML2 davResponse;
+      if (davResponse.Parse(std::string_view(buffer).substr(responseStart,
+                                                             responseEnd - responseStart)))
       {
-        CFileItemPtr pItem(new CFileItem(item));
-        items.Add(pItem);
+        foundResponse = true;
+        AddResponse(url, davResponse.RootElement(), items);
       }
+
+      pos = responseEnd;
+      responseStart = std::string::npos;
     }
+
+    // drop what has been parsed, a partial tag or response stays in the buffer
+    buffer.erase(0, pos);
+    if (responseStart != std::string::npos)
+      responseStart -= pos;
+    pos = 0;
+  }
+
+  if (!foundResponse)
+  {
+    CLog::LogF(LOGERROR, "Unable to process dav directory ({})", url.GetRedacted());
+    dav.Close();
+    return false;
   }
 
   dav.Close();
@@ -33,5 +33,8 @@ namespace XFILE
 
     private:
       void ParseResponse(const tinyxml2::XMLElement* element, CFileItem& item);
+      void AddResponse(const CURL& url,
+                       const tinyxml2::XMLElement* element,
+                       CFileItemList& items);
   };
 }
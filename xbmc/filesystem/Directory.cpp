@@ -23,6 +23,7 @@
 #include "settings/SettingsComponent.h"
 #include "utils/Job.h"
 #include "utils/JobManager.h"
+#include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
@@ -167,7 +168,33 @@ bool CDirectory::GetDirectory(const CURL& url,
       return false;
 
     // check our cache for this path
-    if (g_directoryCache.GetDirectory(realURL.Get(), items, (hints.flags & DIR_FLAG_READ_CACHE) == DIR_FLAG_READ_CACHE))
+    bool cached = g_directoryCache.GetDirectory(
+        realURL.Get(), items, (hints.flags & DIR_FLAG_READ_CACHE) == DIR_FLAG_READ_CACHE);
+
+    // the persistent cache is validated against the directory itself, e.g. by its mtime
+    std::string cacheToken;
+    bool persistent = false;
+    if (!cached && !(hints.flags & DIR_FLAG_BYPASS_CACHE) && g_directoryCache.IsPersistent())
+    {
+      CURL tokenUrl = realURL;
+      if (CPasswordManager::GetInstance().IsURLSupported(tokenUrl) &&
+          tokenUrl.GetUserName().empty())
+        CPasswordManager::GetInstance().AuthenticateURL(tokenUrl);
+      if (pDirectory->GetCacheToken(tokenUrl, cacheToken))
+      {
+        // the listing depends on these flags as well
+        cacheToken += StringUtils::Format(
+            ":{}", hints.flags & (DIR_FLAG_NO_FILE_INFO | DIR_FLAG_GET_HIDDEN));
+        persistent = true;
+        if (g_directoryCache.GetPersistentDirectory(realURL.Get(), cacheToken, items))
+        {
+          g_directoryCache.SetDirectory(realURL.Get(), items, pDirectory->GetCacheType(url));
+          cached = true;
+        }
+      }
+    }
+
+    if (cached)
       items.SetURL(url);
     else
     {
@@ -250,6 +277,8 @@ bool CDirectory::GetDirectory(const CURL& url,
       // cache the directory, if necessary
       if (!(hints.flags & DIR_FLAG_BYPASS_CACHE))
         g_directoryCache.SetDirectory(realURL.Get(), items, pDirectory->GetCacheType(url));
+      if (persistent)
+        g_directoryCache.SetPersistentDirectory(realURL.Get(), cacheToken, items);
     }
 
     // now filter for allowed files
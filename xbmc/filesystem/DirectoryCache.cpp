@@ -9,8 +9,14 @@
 #include "DirectoryCache.h"
 
 #include "Directory.h"
+#include "File.h"
 #include "FileItem.h"
+#include "ServiceBroker.h"
 #include "URL.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -22,6 +28,10 @@
 // Maximum number of directories to keep in our cache
 #define MAX_CACHED_DIRS 50
 
+// Format version of the persistent cache files, the archived items are versioned on their own
+#define PERSISTENT_CACHE_VERSION 2
+#define PERSISTENT_CACHE_PATH "special://temp/dircache/"
+
 using namespace XFILE;
 
 CDirectoryCache::CDir::CDir(DIR_CACHE_TYPE cacheType) : m_Items(std::make_unique<CFileItemList>())
@@ -191,6 +201,92 @@ bool CDirectoryCache::FileExists(const std::string& strFile, bool& bInCache)
   return false;
 }
 
+bool CDirectoryCache::IsPersistent() const
+{
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  return settingsComponent && settingsComponent->GetAdvancedSettings()->m_persistentDirectoryCache;
+}
+
+bool CDirectoryCache::GetPersistentDirectory(const std::string& strPath,
+                                             const std::string& token,
+                                             CFileItemList& items)
+{
+  // Get rid of any URL options, else the compare may be wrong
+  std::string storedPath = CURL(strPath).GetWithoutOptions();
+  URIUtils::RemoveSlashAtEnd(storedPath);
+
+  const std::string cacheFile = GetPersistentCacheFile(storedPath);
+  CFile file;
+  if (!file.Open(cacheFile))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+    int version = 0;
+    int itemsVersion = 0;
+    ar >> version;
+    if (version != PERSISTENT_CACHE_VERSION)
+      return false;
+    ar >> itemsVersion;
+    if (itemsVersion != CFileItemList::ARCHIVE_VERSION)
+      return false;
+
+    std::string cachedPath;
+    std::string cachedToken;
+    ar >> cachedPath;
+    ar >> cachedToken;
+    if (cachedPath != storedPath || cachedToken != token)
+      return false;
+
+    ar >> items;
+    CLog::Log(LOGDEBUG, "{} - {} items of {} unchanged since last listing", __FUNCTION__,
+              items.Size(), CURL::GetRedacted(storedPath));
+    return true;
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "{} - corrupt cache file {}", __FUNCTION__, cacheFile);
+  }
+
+  items.Clear();
+  return false;
+}
+
+void CDirectoryCache::SetPersistentDirectory(const std::string& strPath,
+                                             const std::string& token,
+                                             CFileItemList& items)
+{
+  // Get rid of any URL options, else the compare may be wrong
+  std::string storedPath = CURL(strPath).GetWithoutOptions();
+  URIUtils::RemoveSlashAtEnd(storedPath);
+
+  const std::string cacheFile = GetPersistentCacheFile(storedPath);
+  CFile file;
+  if (!file.OpenForWrite(cacheFile, true))
+  {
+    // first use, create the cache folder and try again
+    if (!CDirectory::Create(PERSISTENT_CACHE_PATH) || !file.OpenForWrite(cacheFile, true))
+    {
+      CLog::Log(LOGWARNING, "{} - unable to write cache file {}", __FUNCTION__, cacheFile);
+      return;
+    }
+  }
+
+  CArchive ar(&file, CArchive::store);
+  ar << PERSISTENT_CACHE_VERSION;
+  ar << CFileItemList::ARCHIVE_VERSION;
+  ar << storedPath;
+  ar << token;
+  ar << items;
+  ar.Close();
+}
+
+std::string CDirectoryCache::GetPersistentCacheFile(const std::string& storedPath)
+{
+  return StringUtils::Format(PERSISTENT_CACHE_PATH "{:08x}.fi", Crc32::Compute(storedPath));
+}
+
 void CDirectoryCache::Clear()
 {
   // this routine clears everything
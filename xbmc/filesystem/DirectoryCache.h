@@ -14,6 +14,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 
 class CFileItem;
 
@@ -50,6 +51,30 @@ namespace XFILE
     void Clear();
     void AddFile(const std::string& strFile);
     bool FileExists(const std::string& strPath, bool& bInCache);
+
+    /*!
+     \brief Whether listings are kept on disk across restarts, see advancedsettings
+     <persistentdircache>
+     */
+    bool IsPersistent() const;
+
+    /*!
+     \brief Load a listing from the persistent cache
+     \param strPath The directory
+     \param token Validation token of the directory, see IDirectory::GetCacheToken
+     \param items Receives the listing
+     \return true if a listing with exactly this token was stored
+     */
+    bool GetPersistentDirectory(const std::string& strPath,
+                                const std::string& token,
+                                CFileItemList& items);
+
+    /*!
+     \brief Store a listing in the persistent cache, replacing any previous one for strPath
+     */
+    void SetPersistentDirectory(const std::string& strPath,
+                                const std::string& token,
+                                CFileItemList& items);
 #ifdef _DEBUG
     void PrintStats() const;
 #endif
@@ -57,6 +82,7 @@ namespace XFILE
     void InitCache(const std::set<std::string>& dirs);
     void ClearCache(std::set<std::string>& dirs);
     void CheckIfFull();
+    static std::string GetPersistentCacheFile(const std::string& storedPath);
 
     std::map<std::string, CDir> m_cache;
 
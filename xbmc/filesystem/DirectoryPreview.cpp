@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DirectoryPreview.h"
+
+#include "FileItem.h"
+
+#include <mutex>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+// listings that finish quickly are shown complete, without a preview first
+constexpr auto FIRST_PREVIEW_DELAY = 250ms;
+// each preview rebinds the container, so they don't follow each other too closely
+constexpr auto PREVIEW_INTERVAL = 500ms;
+
+thread_local CDirectoryPreview* currentPreview = nullptr;
+} // unnamed namespace
+
+CDirectoryPreview::CScope::CScope(CDirectoryPreview& preview) : m_previous(currentPreview)
+{
+  {
+    std::unique_lock<CCriticalSection> lock(preview.m_section);
+    preview.m_items.reset();
+  }
+  preview.m_event.Reset();
+  preview.m_nextPublish = std::chrono::steady_clock::now() + FIRST_PREVIEW_DELAY;
+  preview.m_publishedSize = 0;
+  currentPreview = &preview;
+}
+
+CDirectoryPreview::CScope::~CScope()
+{
+  currentPreview = m_previous;
+}
+
+bool CDirectoryPreview::IsDue()
+{
+  return currentPreview && std::chrono::steady_clock::now() >= currentPreview->m_nextPublish;
+}
+
+void CDirectoryPreview::Publish(const CFileItemList& items)
+{
+  if (!IsDue() || items.Size() <= currentPreview->m_publishedSize)
+    return;
+
+  auto copy = std::make_unique<CFileItemList>();
+  copy->Copy(items);
+
+  CDirectoryPreview& preview = *currentPreview;
+  preview.m_publishedSize = items.Size();
+  preview.m_nextPublish = std::chrono::steady_clock::now() + PREVIEW_INTERVAL;
+  {
+    std::unique_lock<CCriticalSection> lock(preview.m_section);
+    preview.m_items = std::move(copy);
+  }
+  preview.m_event.Set();
+}
+
+bool CDirectoryPreview::Take(CFileItemList& items)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  if (!m_items)
+    return false;
+
+  items.Assign(*m_items);
+  m_items.reset();
+  return true;
+}
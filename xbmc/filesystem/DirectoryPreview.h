@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+
+#include <chrono>
+#include <memory>
+
+class CFileItemList;
+
+namespace XFILE
+{
+/*!
+ * \brief The items of a directory that is still being listed, so that a window can show the first
+ * items of a slow listing before it's complete.
+ *
+ * The thread listing the directory installs a preview with a CScope. Directories that produce
+ * their items one after another, e.g. database nodes and plugins, hand the items so far to
+ * Publish(), which does nothing unless a scope is installed on the calling thread. The first
+ * preview is published once the listing took a while, later ones at an interval. Items are copied
+ * on publishing, so the directory is free to keep modifying its own.
+ */
+class CDirectoryPreview
+{
+public:
+  class CScope
+  {
+  public:
+    explicit CScope(CDirectoryPreview& preview);
+    ~CScope();
+
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+
+  private:
+    CDirectoryPreview* m_previous;
+  };
+
+  /*!
+   * \brief Whether a preview should be published now, for directories that have to collect their
+   * items before they can publish them
+   */
+  static bool IsDue();
+
+  /*!
+   * \brief Publish the items listed so far, if a preview is due
+   */
+  static void Publish(const CFileItemList& items);
+
+  /*!
+   * \brief Take the latest preview, if one was published since the last call
+   */
+  bool Take(CFileItemList& items);
+
+  /*!
+   * \brief Set whenever a preview is published
+   */
+  CEvent& GetEvent() { return m_event; }
+
+private:
+  CCriticalSection m_section;
+  std::unique_ptr<CFileItemList> m_items;
+  CEvent m_event;
+
+  // only used by the listing thread
+  std::chrono::steady_clock::time_point m_nextPublish;
+  int m_publishedSize = 0;
+};
+} // namespace XFILE
@@ -11,6 +11,7 @@
 #include "threads/SystemClock.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <mutex>
 
@@ -119,6 +120,19 @@ DllLibCurlGlobal::DllLibCurlGlobal()
   {
     CLog::Log(LOGERROR, "Error initializing libcurl");
   }
+
+  m_share = curl_share_init();
+  if (m_share)
+  {
+    curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, LockShare);
+    curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, UnlockShare);
+    curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+  }
 }
 
 DllLibCurlGlobal::~DllLibCurlGlobal()
@@ -132,6 +146,9 @@ DllLibCurlGlobal::~DllLibCurlGlobal()
     if (session.m_multi)
       multi_cleanup(session.m_multi);
   }
+  // only possible once no easy handle uses it anymore
+  if (m_share)
+    curl_share_cleanup(m_share);
   // close libcurl
   curl_global_cleanup();
 }
@@ -166,6 +183,38 @@ void DllLibCurlGlobal::CheckIdle()
     }
     ++it;
   }
+
+  auto stats = m_hostStats.begin();
+  while (stats != m_hostStats.end())
+  {
+    const bool active = std::any_of(m_sessions.begin(), m_sessions.end(),
+                                    [&stats](const SSession& session) {
+                                      return stats->first ==
+                                             session.m_protocol + "://" + session.m_hostname;
+                                    });
+    if (active)
+    {
+      ++stats;
+      continue;
+    }
+
+    CLog::Log(LOGDEBUG, "{} - {} requests to {} used {} new connections", __FUNCTION__,
+              stats->second.m_requests, stats->first, stats->second.m_connects);
+    stats = m_hostStats.erase(stats);
+  }
+}
+
+void DllLibCurlGlobal::LockShare(CURL_HANDLE* handle,
+                                 curl_lock_data data,
+                                 curl_lock_access access,
+                                 void* userptr)
+{
+  static_cast<DllLibCurlGlobal*>(userptr)->m_shareLocks[data].lock();
+}
+
+void DllLibCurlGlobal::UnlockShare(CURL_HANDLE* handle, curl_lock_data data, void* userptr)
+{
+  static_cast<DllLibCurlGlobal*>(userptr)->m_shareLocks[data].unlock();
 }
 
 void DllLibCurlGlobal::easy_acquire(const char* protocol,
@@ -177,6 +226,8 @@ void DllLibCurlGlobal::easy_acquire(const char* protocol,
 
   std::unique_lock<CCriticalSection> lock(m_critSection);
 
+  ++m_hostStats[std::string(protocol) + "://" + hostname].m_requests;
+
   for (auto& it : m_sessions)
   {
     if (!it.m_busy)
@@ -252,6 +303,10 @@ void DllLibCurlGlobal::easy_release(CURL_HANDLE** easy_handle, CURLM** multi_han
   {
     if (it.m_easy == easy && (multi == nullptr || it.m_multi == multi))
     {
+      long connects = 0;
+      if (easy && easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &connects) == CURLE_OK)
+        m_hostStats[it.m_protocol + "://" + it.m_hostname].m_connects += connects;
+
       /* reset session so next caller doesn't reuse options, only connections */
       /* will reset verbose too so it won't print that it closed connections on cleanup*/
       easy_reset(easy);
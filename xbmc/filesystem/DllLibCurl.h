@@ -10,6 +10,8 @@
 
 #include "threads/CriticalSection.h"
 
+#include <array>
+#include <map>
 #include <stdio.h>
 #include <string>
 #include <sys/time.h>
@@ -82,6 +84,12 @@ public:
   CURL_HANDLE* easy_duphandle(CURL_HANDLE* easy_handle) override;
   void CheckIdle();
 
+  /*!
+   * \brief Share handle for all easy handles, so that connections, TLS sessions and DNS results
+   * are reused between sessions and not only by the session that created them
+   */
+  CURLSH* GetShareHandle() const { return m_share; }
+
   /* overloaded load and unload with reference counter */
 
   /* structure holding a session info */
@@ -100,6 +108,24 @@ public:
 
   VEC_CURLSESSIONS m_sessions;
   CCriticalSection m_critSection;
+
+private:
+  static void LockShare(CURL_HANDLE* handle,
+                        curl_lock_data data,
+                        curl_lock_access access,
+                        void* userptr);
+  static void UnlockShare(CURL_HANDLE* handle, curl_lock_data data, void* userptr);
+
+  /* transfers and new connections per protocol://host, logged once all its sessions closed */
+  struct SHostStats
+  {
+    unsigned int m_requests = 0;
+    unsigned int m_connects = 0;
+  };
+
+  std::map<std::string, SHostStats> m_hostStats;
+  CURLSH* m_share = nullptr;
+  std::array<CCriticalSection, CURL_LOCK_DATA_LAST> m_shareLocks;
 };
 } // namespace XCURL
 
@@ -27,6 +27,10 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#if defined(TARGET_POSIX)
+#include "platform/posix/filesystem/PosixMappedFile.h"
+#endif
+
 using namespace XFILE;
 
 //////////////////////////////////////////////////////////////////////
@@ -306,6 +310,24 @@ bool CFile::Open(const CURL& file, const unsigned int flags)
         }
       }
 
+#if defined(TARGET_POSIX)
+      // local files don't need a cache thread, the page cache plus read ahead hints do the job
+      // without copying everything through the circular cache
+      if ((m_flags & READ_MMAP || m_flags & READ_CACHED) && URIUtils::IsHD(pathToUrl) &&
+          (url.IsProtocol("file") || url.GetProtocol().empty()))
+      {
+        m_pFile = std::make_unique<CPosixMappedFile>();
+        if (m_pFile->Open(url))
+        {
+          m_flags |= READ_MMAP;
+          return true;
+        }
+        CLog::Log(LOGDEBUG, "{} - mapping {} failed, using the file cache", __FUNCTION__,
+                  file.GetRedacted());
+        m_pFile.reset();
+      }
+#endif
+
       if (m_flags & READ_CACHED)
       {
         m_pFile = std::make_unique<CFileCache>(m_flags);
@@ -389,6 +411,10 @@ bool CFile::ShouldUseStreamBuffer(const CURL& url)
   if (m_flags & READ_NO_BUFFER)
     return false;
 
+  // demuxers read audio and video in large blocks, which the cache can copy to them directly
+  if ((m_flags & READ_AUDIO_VIDEO) && (m_flags & READ_CACHED))
+    return false;
+
   if (m_flags & READ_CHUNKED || m_pFile->GetChunkSize() > 0)
     return true;
 
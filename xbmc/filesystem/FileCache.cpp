@@ -9,11 +9,15 @@
 #include "FileCache.h"
 
 #include "CircularCache.h"
+#include "CurlFile.h"
+#include "SegmentedCache.h"
 #include "ServiceBroker.h"
 #include "URL.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/Thread.h"
+#include "utils/MemUtils.h"
 #include "utils/log.h"
 
 #include <mutex>
@@ -135,12 +139,36 @@ bool CFileCache::Open(const CURL& url)
 
   m_fileSize = m_source.GetLength();
 
+  // Read ahead with several connections from high latency HTTP servers, see
+  // advancedsettings <network><curlrangeconnections>
+  m_rangeSource = nullptr;
+  m_rangeConnections = static_cast<unsigned int>(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_curlRangeConnections);
+  if (m_seekPossible && m_fileSize > 0 && m_rangeConnections > 1 &&
+      (url.IsProtocol("http") || url.IsProtocol("https")))
+  {
+    m_rangeSource = dynamic_cast<CCurlFile*>(m_source.GetImplementation());
+    if (m_rangeSource)
+      CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using up to {} parallel range requests",
+                __FUNCTION__, m_sourcePath, m_rangeConnections);
+  }
+
   if (!m_pCache)
   {
+    // Number of independently cached ranges. READ_MULTI_STREAM needs at least two, more only
+    // pay off if we can actually seek back into one of them.
+    size_t segments = 1;
+    if (m_seekPossible)
+      segments = static_cast<size_t>(std::max(
+          1, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_cacheSegments));
+    if (m_flags & READ_MULTI_STREAM)
+      segments = std::max<size_t>(segments, 2);
+
     if (cacheMemSize == 0)
     {
-      // Use cache on disk
+      // Use cache on disk, which only supports double buffering
       m_pCache = std::make_unique<CSimpleFileCache>();
+      segments = std::min<size_t>(segments, (m_flags & READ_MULTI_STREAM) ? 2 : 1);
       m_forwardCacheSize = 0;
       m_maxForward = m_fileSize;
     }
@@ -152,6 +180,7 @@ bool CFileCache::Open(const CURL& url)
         // Cap cache size by filesize, but not for audio/video files as those may grow.
         // We don't need to take into account READ_MULTI_STREAM here as that's only used for audio/video
         cacheSize = m_fileSize;
+        segments = 1; // the whole file fits, nothing to gain from more ranges
 
         // Cap chunk size by cache size
         if (m_chunkSize > cacheSize)
@@ -161,21 +190,29 @@ bool CFileCache::Open(const CURL& url)
       {
         cacheSize = cacheMemSize;
 
-        // NOTE: READ_MULTI_STREAM is only used with READ_AUDIO_VIDEO
-        if (m_flags & READ_MULTI_STREAM)
+        // a large configured cache must not push the system into swap while playing
+        KODI::MEMORY::MemoryStatus memory;
+        KODI::MEMORY::GetMemoryStatus(&memory);
+        if (memory.availPhys > 0 && cacheSize > memory.availPhys / 4)
         {
-          // READ_MULTI_STREAM requires double buffering, so use half the amount of memory for each buffer
-          cacheSize /= 2;
+          cacheSize = static_cast<size_t>(memory.availPhys / 4);
+          CLog::Log(LOGDEBUG, "CFileCache::{} - cache of {} limited to {} bytes by free memory",
+                    __FUNCTION__, m_sourcePath, cacheSize);
         }
 
+        // NOTE: READ_MULTI_STREAM is only used with READ_AUDIO_VIDEO
+        // READ_MULTI_STREAM requires double buffering, so the memory is split between the buffers
+        cacheSize /= segments;
+
         // Make sure cache can at least hold 2 chunks
         if (cacheSize < m_chunkSize * 2)
           cacheSize = m_chunkSize * 2;
       }
 
-      if (m_flags & READ_MULTI_STREAM)
-        CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using double memory cache each sized {} bytes",
-                  __FUNCTION__, m_sourcePath, cacheSize);
+      if (segments > 1)
+        CLog::Log(LOGDEBUG,
+                  "CFileCache::{} - <{}> using {} memory cache segments each sized {} bytes",
+                  __FUNCTION__, m_sourcePath, segments, cacheSize);
       else
         CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using single memory cache sized {} bytes",
                   __FUNCTION__, m_sourcePath, cacheSize);
@@ -188,9 +225,15 @@ bool CFileCache::Open(const CURL& url)
       m_maxForward = m_forwardCacheSize;
     }
 
-    if (m_flags & READ_MULTI_STREAM)
+    if (segments > 2)
+    {
+      // Keep several ranges (file head, index, recent playback positions) so seeking back and
+      // forth doesn't have to re-download them
+      m_pCache = std::make_unique<CSegmentedCache>(m_pCache.release(), segments);
+    }
+    else if (segments > 1)
     {
-      // If READ_MULTI_STREAM flag is set: Double buffering is required
+      // Double buffering, required if READ_MULTI_STREAM flag is set
       m_pCache = std::make_unique<CDoubleCache>(m_pCache.release());
     }
   }
@@ -226,8 +269,11 @@ void CFileCache::Process()
     return;
   }
 
-  // create our read buffer
-  std::unique_ptr<char[]> buffer(new char[m_chunkSize]);
+  // create our read buffer, large enough for all parallel requests of one read-ahead block
+  static constexpr size_t RANGE_PART_SIZE = 1024 * 1024;
+  const size_t rangeBlockSize =
+      m_rangeSource ? std::max<size_t>(m_chunkSize, m_rangeConnections * RANGE_PART_SIZE) : 0;
+  std::unique_ptr<char[]> buffer(new char[std::max<size_t>(m_chunkSize, rangeBlockSize)]);
   if (buffer == nullptr)
   {
     CLog::Log(LOGERROR, "CFileCache::{} - <{}> failed to allocate read buffer", __FUNCTION__,
@@ -258,8 +304,9 @@ void CFileCache::Process()
       const int64_t cacheMaxPos = m_pCache->CachedDataEndPosIfSeekTo(m_seekPos);
       const bool cacheReachEOF = (cacheMaxPos == m_fileSize);
 
+      // Range requests carry their own position, the source is repositioned on fallback only
       bool sourceSeekFailed = false;
-      if (!cacheReachEOF)
+      if (!cacheReachEOF && !m_rangeSource)
       {
         m_nSeekResult = m_source.Seek(cacheMaxPos, SEEK_SET);
         if (m_nSeekResult != cacheMaxPos)
@@ -337,7 +384,44 @@ void CFileCache::Process()
     }
 
     ssize_t iRead = 0;
-    if (maxSourceRead > 0)
+    if (maxSourceRead > 0 && m_rangeSource)
+    {
+      int64_t blockSize = m_pCache->GetMaxWriteSize(rangeBlockSize);
+      if (m_fileSize != 0)
+        blockSize = std::min(blockSize, m_fileSize - m_writePos);
+
+      iRead = m_rangeSource->ReadRanges(m_writePos, buffer.get(), static_cast<size_t>(blockSize),
+                                        m_rangeConnections, [this]() {
+                                          if (m_bStop)
+                                            return true;
+                                          if (!m_seekEvent.Wait(0ms))
+                                            return false;
+                                          m_seekEvent.Set(); // handled by the next loop
+                                          return true;
+                                        });
+      if (iRead < 0)
+      {
+        CLog::Log(LOGDEBUG,
+                  "CFileCache::{} - <{}> range requests failed, falling back to a single stream",
+                  __FUNCTION__, m_sourcePath);
+        m_rangeSource = nullptr;
+        iRead = 0;
+        if (m_source.Seek(m_writePos, SEEK_SET) != m_writePos)
+        {
+          CLog::Log(LOGERROR, "CFileCache::{} - <{}> error seeking source to {}", __FUNCTION__,
+                    m_sourcePath, m_writePos);
+          m_seekPossible = m_source.IoControl(IOCTRL_SEEK_POSSIBLE, NULL);
+        }
+        else
+          iRead = m_source.Read(buffer.get(), maxSourceRead);
+      }
+      else if (iRead == 0 && m_seekEvent.Wait(0ms))
+      {
+        m_seekEvent.Set();
+        continue; // aborted for a seek without data
+      }
+    }
+    else if (maxSourceRead > 0)
       iRead = m_source.Read(buffer.get(), maxSourceRead);
     if (iRead <= 0)
     {
@@ -22,6 +22,7 @@ using namespace std::chrono_literals;
 
 namespace XFILE
 {
+  class CCurlFile;
 
   class CFileCache : public IFile, public CThread
   {
@@ -61,6 +62,8 @@ namespace XFILE
     std::unique_ptr<CCacheStrategy> m_pCache;
     int m_seekPossible = 0;
     CFile m_source;
+    CCurlFile* m_rangeSource = nullptr; //!< set if the source is read with parallel range requests
+    unsigned int m_rangeConnections = 0;
     std::string m_sourcePath;
     CEvent m_seekEvent;
     CEvent m_seekEnded;
@@ -0,0 +1,227 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "HttpCache.h"
+
+#include "CurlFile.h"
+#include "FileItem.h"
+#include "URL.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <stdexcept>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr int HTTP_CACHE_VERSION = 1;
+constexpr const char* HTTP_CACHE_PATH = "special://temp/httpcache/";
+constexpr int64_t HTTP_CACHE_SIZE = 32 * 1024 * 1024;
+// the size of the cache folder is only checked every this many stored responses
+constexpr unsigned int TRIM_INTERVAL = 32;
+
+struct CachedResponse
+{
+  std::string url;
+  std::string etag;
+  std::string lastModified;
+  std::string contentType;
+  int64_t expires = 0;
+  std::string content;
+};
+
+std::string GetCacheFile(const std::string& url)
+{
+  return StringUtils::Format("{}{:08x}.http", HTTP_CACHE_PATH, Crc32::Compute(url));
+}
+
+int64_t GetExpires(const CHttpCache::CacheControl& control, int minFresh, int64_t now)
+{
+  if (control.noCache)
+    return now;
+  return now + std::max(control.maxAge, minFresh);
+}
+
+bool Load(const std::string& url, CachedResponse& response)
+{
+  CFile file;
+  if (!file.Open(GetCacheFile(url)))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+    int version = 0;
+    ar >> version;
+    if (version != HTTP_CACHE_VERSION)
+      return false;
+
+    ar >> response.url;
+    ar >> response.etag;
+    ar >> response.lastModified;
+    ar >> response.contentType;
+    ar >> response.expires;
+    ar >> response.content;
+    // different urls may have the same file
+    return response.url == url;
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "CHttpCache::{} - corrupt cache entry of {}", __FUNCTION__,
+              CURL::GetRedacted(url));
+  }
+  return false;
+}
+
+void Trim()
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(HTTP_CACHE_PATH, items, ".http",
+                                DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_BYPASS_CACHE))
+    return;
+
+  int64_t size = 0;
+  for (const auto& item : items)
+    size += item->m_dwSize;
+  if (size <= HTTP_CACHE_SIZE)
+    return;
+
+  // remove the responses that were stored or revalidated longest ago, down to 3/4 of the limit
+  // so that the next stores do not need to trim again right away
+  items.Sort(SortByDate, SortOrderAscending);
+  for (const auto& item : items)
+  {
+    if (size <= HTTP_CACHE_SIZE / 4 * 3)
+      break;
+    if (CFile::Delete(item->GetPath()))
+      size -= item->m_dwSize;
+  }
+}
+
+void Store(const CachedResponse& response)
+{
+  const std::string cacheFile = GetCacheFile(response.url);
+  CFile file;
+  if (!file.OpenForWrite(cacheFile, true))
+  {
+    // first use, create the cache folder and try again
+    if (!CDirectory::Create(HTTP_CACHE_PATH) || !file.OpenForWrite(cacheFile, true))
+    {
+      CLog::Log(LOGWARNING, "CHttpCache::{} - unable to write {}", __FUNCTION__, cacheFile);
+      return;
+    }
+  }
+
+  CArchive ar(&file, CArchive::store);
+  ar << HTTP_CACHE_VERSION;
+  ar << response.url;
+  ar << response.etag;
+  ar << response.lastModified;
+  ar << response.contentType;
+  ar << response.expires;
+  ar << response.content;
+  ar.Close();
+  file.Close();
+
+  static std::atomic<unsigned int> stores{0};
+  if (stores++ % TRIM_INTERVAL == 0)
+    Trim();
+}
+} // unnamed namespace
+
+CHttpCache::CacheControl CHttpCache::ParseCacheControl(const std::string& value)
+{
+  CacheControl control;
+  for (std::string directive : StringUtils::Split(value, ","))
+  {
+    StringUtils::Trim(directive);
+    StringUtils::ToLower(directive);
+    if (directive == "no-store")
+      control.noStore = true;
+    else if (directive == "no-cache")
+      control.noCache = true;
+    else if (StringUtils::StartsWith(directive, "max-age="))
+    {
+      std::string seconds = directive.substr(8);
+      StringUtils::Trim(seconds, "\" ");
+      if (!seconds.empty() && StringUtils::IsNaturalNumber(seconds))
+        control.maxAge = static_cast<int>(std::min(std::stoll(seconds), 365LL * 24 * 60 * 60));
+    }
+  }
+  return control;
+}
+
+bool CHttpCache::Get(CCurlFile& http,
+                     const std::string& url,
+                     std::string& content,
+                     std::string& contentType,
+                     int minFresh /* = 0 */)
+{
+  const int64_t now = static_cast<int64_t>(time(nullptr));
+
+  CachedResponse cached;
+  const bool haveCached = Load(url, cached);
+  if (haveCached && now < cached.expires)
+  {
+    content = std::move(cached.content);
+    contentType = std::move(cached.contentType);
+    return true;
+  }
+
+  if (haveCached && !cached.etag.empty())
+    http.SetRequestHeader("If-None-Match", cached.etag);
+  if (haveCached && !cached.lastModified.empty())
+    http.SetRequestHeader("If-Modified-Since", cached.lastModified);
+
+  std::string body;
+  const bool result = http.Get(url, body);
+  http.RemoveRequestHeader("If-None-Match");
+  http.RemoveRequestHeader("If-Modified-Since");
+  if (!result)
+    return false;
+
+  const CHttpHeader& header = http.GetHttpHeader();
+  const CacheControl control = ParseCacheControl(header.GetValue("cache-control"));
+
+  if (haveCached && http.GetResponseCode() == 304)
+  {
+    CLog::Log(LOGDEBUG, "CHttpCache::{} - {} not modified", __FUNCTION__, CURL::GetRedacted(url));
+    cached.expires = GetExpires(control, minFresh, now);
+    Store(cached);
+    content = std::move(cached.content);
+    contentType = std::move(cached.contentType);
+    return true;
+  }
+
+  content = std::move(body);
+  contentType = header.GetValue("content-type");
+  if (http.GetResponseCode() != 200 || control.noStore)
+    return true;
+
+  CachedResponse response;
+  response.url = url;
+  response.etag = header.GetValue("etag");
+  response.lastModified = header.GetValue("last-modified");
+  response.contentType = contentType;
+  response.expires = GetExpires(control, minFresh, now);
+  // a response that can neither be used as is nor revalidated is of no use
+  if (response.expires <= now && response.etag.empty() && response.lastModified.empty())
+    return true;
+
+  response.content = content;
+  Store(response);
+  return true;
+}
@@ -0,0 +1,58 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+
+namespace XFILE
+{
+class CCurlFile;
+
+/*!
+ * \brief Disk cache for responses of http GET requests, e.g. scraper and add-on repository
+ * metadata that is requested again on every scan or update check.
+ *
+ * Responses are kept under special://temp/httpcache/ by url. A response is used without a
+ * request while it is fresh according to its Cache-Control max-age, afterwards it is revalidated
+ * with If-None-Match / If-Modified-Since and only downloaded again if it changed. Responses with
+ * neither a max-age nor an ETag or Last-Modified header are not stored. If the cache grows beyond
+ * its size limit, the responses that were stored or revalidated longest ago are removed.
+ */
+class CHttpCache
+{
+public:
+  struct CacheControl
+  {
+    bool noStore = false;
+    bool noCache = false;
+    int maxAge = -1; ///< seconds, -1 if not given
+  };
+
+  /*!
+   * \brief Parse the directives of a Cache-Control header that matter to a private cache
+   */
+  static CacheControl ParseCacheControl(const std::string& value);
+
+  /*!
+   * \brief GET an url through the cache
+   * \param http The curl file to use for requests, its other request options are kept
+   * \param url The url to get
+   * \param[out] content The body of the response
+   * \param[out] contentType The Content-Type of the response, also for a cached response
+   * \param minFresh Seconds a response is used without revalidation even if the server sends no
+   * max-age, a hint of callers that know how often their data changes, e.g. scrapers
+   * \return false if the url could not be retrieved
+   */
+  static bool Get(CCurlFile& http,
+                  const std::string& url,
+                  std::string& content,
+                  std::string& contentType,
+                  int minFresh = 0);
+};
+} // namespace XFILE
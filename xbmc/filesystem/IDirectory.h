@@ -122,6 +122,15 @@ public:
   */
   virtual DIR_CACHE_TYPE GetCacheType(const CURL& url) const { return DIR_CACHE_ONCE; }
 
+  /*!
+  \brief Get a token that changes whenever the listing of the directory changes, e.g. its mtime.
+  Allows the listing to be kept in the persistent directory cache.
+  \param url Directory at hand.
+  \param token The token.
+  \return Returns \e false if there is no cheap way to validate a cached listing
+  */
+  virtual bool GetCacheToken(const CURL& url, std::string& token) { return false; }
+
   void SetMask(const std::string& strMask);
   void SetFlags(int flags);
 
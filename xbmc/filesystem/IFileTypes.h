@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace XFILE
@@ -43,12 +44,21 @@ namespace XFILE
 /* indicate that caller want open a file without intermediate buffer regardless to file type */
   static const unsigned int READ_NO_BUFFER = 0x200;
 
+/* access local files through a memory mapping instead of the file cache */
+  static const unsigned int READ_MMAP = 0x400;
+
 struct SNativeIoControl
 {
   unsigned long int   request;
   void*               param;
 };
 
+struct SPeekBuffer
+{
+  const uint8_t* data; /**< out: pointer to the data at the current position */
+  size_t size; /**< in: wanted number of bytes, out: number of bytes available at data */
+};
+
 struct SCacheStatus
 {
   uint64_t maxforward; /**< forward cache max capacity in bytes */
@@ -74,6 +84,7 @@ typedef enum {
   IOCTRL_CACHE_SETRATE = 4,  /**< unsigned int with speed limit for caching in bytes per second */
   IOCTRL_SET_CACHE     = 8,  /**< CFileCache */
   IOCTRL_SET_RETRY     = 16, /**< Enable/disable retry within the protocol handler (if supported) */
+  IOCTRL_PEEK_BUFFER   = 32, /**< SPeekBuffer, access data at the current position without copying, position is not advanced */
 } EIoControl;
 
 enum CURLOPTIONTYPE
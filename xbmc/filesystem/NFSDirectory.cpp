@@ -358,6 +358,30 @@ bool CNFSDirectory::Remove(const CURL& url2)
   return true;
 }
 
+bool CNFSDirectory::GetCacheToken(const CURL& url2, std::string& token)
+{
+  // server and export lists are generated, not read from the server's filesystem
+  if (url2.GetHostName().empty() || url2.GetFileName().empty())
+    return false;
+
+  std::unique_lock<CCriticalSection> lock(gNfsConnection);
+  std::string folderName(url2.Get());
+  URIUtils::RemoveSlashAtEnd(folderName);
+  CURL url(folderName);
+  folderName = "";
+
+  if (!gNfsConnection.Connect(url, folderName))
+    return false;
+
+  nfs_stat_64 info;
+  if (nfs_stat64(gNfsConnection.GetNfsContext(), folderName.c_str(), &info) != 0 ||
+      !S_ISDIR(info.nfs_mode))
+    return false;
+
+  token = StringUtils::Format("{}.{}", info.nfs_mtime, info.nfs_ctime);
+  return true;
+}
+
 bool CNFSDirectory::Exists(const CURL& url2)
 {
   int ret = 0;
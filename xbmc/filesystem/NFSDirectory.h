@@ -22,6 +22,7 @@ namespace XFILE
       ~CNFSDirectory(void) override;
       bool GetDirectory(const CURL& url, CFileItemList &items) override;
       DIR_CACHE_TYPE GetCacheType(const CURL& url) const override { return DIR_CACHE_ONCE; }
+      bool GetCacheToken(const CURL& url, std::string& token) override;
       bool Create(const CURL& url) override;
       bool Exists(const CURL& url) override;
       bool Remove(const CURL& url) override;
@@ -159,9 +159,12 @@ struct nfs_context *CNfsConnection::getContextFromMap(const std::string &exportn
       //refresh access time of that
       //context and return it
       if (!forceCacheHit) // only log it if this isn't the resetkeepalive on each read ;)
+      {
         CLog::Log(LOGDEBUG, "NFS: Refreshing context for {}, old: {}, new: {}", exportname,
                   it->second.lastAccessedTime.time_since_epoch().count(),
                   now.time_since_epoch().count());
+        m_statistics.reuses++;
+      }
       it->second.lastAccessedTime = now;
       pRet = it->second.pContext;
     }
@@ -172,11 +175,23 @@ struct nfs_context *CNfsConnection::getContextFromMap(const std::string &exportn
       CLog::Log(LOGDEBUG, "NFS: Old context timed out - destroying it");
       nfs_destroy_context(it->second.pContext);
       m_openContextMap.erase(it);
+      m_statistics.reconnects++;
     }
   }
   return pRet;
 }
 
+void CNfsConnection::addContextToMap(const std::string& exportname,
+                                     struct nfs_context* pContext)
+{
+  struct contextTimeout tmp;
+  std::unique_lock<CCriticalSection> lock(openContextLock);
+  tmp.pContext = pContext;
+  tmp.lastAccessedTime = std::chrono::steady_clock::now();
+  m_openContextMap[exportname] = tmp; //add context to list of all contexts
+  m_statistics.mounts++;
+}
+
 CNfsConnection::ContextStatus CNfsConnection::getContextForExport(const std::string& exportname)
 {
   CNfsConnection::ContextStatus ret = CNfsConnection::ContextStatus::INVALID;
@@ -196,12 +211,8 @@ CNfsConnection::ContextStatus CNfsConnection::getContextForExport(const std::str
     }
     else
     {
-      struct contextTimeout tmp;
-      std::unique_lock<CCriticalSection> lock(openContextLock);
       setOptions(m_pNfsContext);
-      tmp.pContext = m_pNfsContext;
-      tmp.lastAccessedTime = std::chrono::steady_clock::now();
-      m_openContextMap[exportname] = tmp; //add context to list of all contexts
+      addContextToMap(exportname, m_pNfsContext);
       ret = CNfsConnection::ContextStatus::NEW;
     }
   }
@@ -403,7 +414,14 @@ void CNfsConnection::CheckIfIdle()
 
       if (m_IdleTimeout < now)
       {
-        CLog::Log(LOGINFO, "NFS is idle. Closing the remaining connections.");
+        {
+          std::unique_lock<CCriticalSection> statisticsLock(openContextLock);
+          CLog::Log(LOGINFO,
+                    "NFS is idle. Closing the remaining connections (mounts: {}, reuses: {}, "
+                    "reconnects: {}).",
+                    m_statistics.mounts, m_statistics.reuses, m_statistics.reconnects);
+          m_statistics = {};
+        }
         gNfsConnection.Deinit();
       }
     }
@@ -493,34 +511,47 @@ int CNfsConnection::stat(const CURL& url, nfs_stat_64* statbuff)
   int nfsRet = 0;
   std::string exportPath;
   std::string relativePath;
-  struct nfs_context *pTmpContext = NULL;
 
   resolveHost(url);
 
   if(splitUrlIntoExportAndPath(url, exportPath, relativePath))
   {
-    pTmpContext = nfs_init_context();
+    // symlinks of a listing mostly point into the same few exports, so their contexts are kept
+    // with the others instead of mounting the export for every link. Cached contexts are used
+    // regardless of their timeout, as the current one may be in the middle of a dir traversal
+    // and open files may still use the others.
+    const std::string contextId = url.GetHostName() + exportPath;
+    struct nfs_context* pContext = getContextFromMap(contextId, true);
+    if (pContext)
+    {
+      std::unique_lock<CCriticalSection> statisticsLock(openContextLock);
+      m_statistics.reuses++;
+      statisticsLock.unlock();
+      return nfs_stat64(pContext, relativePath.c_str(), statbuff);
+    }
 
-    if(pTmpContext)
+    pContext = nfs_init_context();
+
+    if(pContext)
     {
-      setOptions(pTmpContext);
+      setOptions(pContext);
       //we connect to the directory of the path. This will be the "root" path of this connection then.
       //So all fileoperations are relative to this mountpoint...
-      nfsRet = nfs_mount(pTmpContext, m_resolvedHostName.c_str(), exportPath.c_str());
+      nfsRet = nfs_mount(pContext, m_resolvedHostName.c_str(), exportPath.c_str());
 
       if(nfsRet == 0)
       {
-        nfsRet = nfs_stat64(pTmpContext, relativePath.c_str(), statbuff);
+        CLog::Log(LOGDEBUG, "NFS: Connected to server {} and export {} in extra context",
+                  url.GetHostName(), exportPath);
+        addContextToMap(contextId, pContext);
+        nfsRet = nfs_stat64(pContext, relativePath.c_str(), statbuff);
       }
       else
       {
         CLog::Log(LOGERROR, "NFS: Failed to mount nfs share: {} ({})", exportPath,
-                  nfs_get_error(m_pNfsContext));
+                  nfs_get_error(pContext));
+        nfs_destroy_context(pContext);
       }
-
-      nfs_destroy_context(pTmpContext);
-      CLog::Log(LOGDEBUG, "NFS: Connected to server {} and export {} in tmpContext",
-                url.GetHostName(), exportPath);
     }
   }
   return nfsRet;
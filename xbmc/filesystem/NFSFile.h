@@ -38,6 +38,13 @@ public:
 
   typedef std::map<std::string, struct contextTimeout> tOpenContextMap;
 
+  struct Statistics
+  {
+    unsigned int mounts = 0; //!< contexts created and mounted
+    unsigned int reuses = 0; //!< connects and stats served by an already mounted context
+    unsigned int reconnects = 0; //!< contexts replaced because they had timed out
+  };
+
   CNfsConnection();
   ~CNfsConnection();
   bool Connect(const CURL &url, std::string &relativePath);
@@ -91,6 +98,7 @@ private:
   std::list<std::string> m_exportList;//list of exported paths of current connected servers
   CCriticalSection keepAliveLock;
   CCriticalSection openContextLock;
+  Statistics m_statistics; //!< protected by openContextLock
 
   void clearMembers();
   struct nfs_context *getContextFromMap(const std::string &exportname, bool forceCacheHit = false);
@@ -99,6 +107,7 @@ private:
   ContextStatus getContextForExport(const std::string& exportname);
   void destroyOpenContexts();
   void destroyContext(const std::string &exportName);
+  void addContextToMap(const std::string& exportname, struct nfs_context* pContext);
   void resolveHost(const CURL &url);//resolve hostname by dnslookup
   void keepAlive(const std::string& _exportPath, struct nfsfh* _pFileHandle);
   static void setOptions(struct nfs_context* context);
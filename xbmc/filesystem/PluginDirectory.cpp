@@ -8,6 +8,7 @@
 
 #include "PluginDirectory.h"
 
+#include "DirectoryPreview.h"
 #include "FileItem.h"
 #include "ServiceBroker.h"
 #include "URL.h"
@@ -163,6 +164,16 @@ bool CPluginDirectory::GetPluginResult(const std::string& strPath, CFileItem &re
   return success;
 }
 
+void CPluginDirectory::OnWaiting()
+{
+  if (!CDirectoryPreview::IsDue())
+    return;
+
+  // the script keeps adding items while they are copied
+  std::unique_lock<CCriticalSection> lock(GetScriptsLock());
+  CDirectoryPreview::Publish(*m_listItems);
+}
+
 bool CPluginDirectory::AddItem(int handle, const CFileItem *item, int totalItems)
 {
   std::unique_lock<CCriticalSection> lock(GetScriptsLock());
@@ -179,13 +190,16 @@ bool CPluginDirectory::AddItem(int handle, const CFileItem *item, int totalItems
 
 bool CPluginDirectory::AddItems(int handle, const CFileItemList *items, int totalItems)
 {
+  // copy the items before taking the lock, large listings would otherwise block every other
+  // plugin call and the waiting gui thread for the whole copy
+  CFileItemList pItemList;
+  pItemList.Copy(*items);
+
   std::unique_lock<CCriticalSection> lock(GetScriptsLock());
   CPluginDirectory* dir = GetScriptFromHandle(handle);
   if (!dir)
     return false;
 
-  CFileItemList pItemList;
-  pItemList.Copy(*items);
   dir->m_listItems->Append(pItemList);
   dir->m_totalItems = totalItems;
 
@@ -76,6 +76,7 @@ protected:
   // implementations of CRunningScriptsHandler / CScriptRunner
   bool IsSuccessful() const override { return m_success; }
   bool IsCancelled() const override { return m_cancelled; }
+  void OnWaiting() override;
 
 private:
   bool StartScript(const std::string& strPath, bool resume);
@@ -0,0 +1,193 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SegmentedCache.h"
+
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace XFILE;
+
+CSegmentedCache::CSegmentedCache(CCacheStrategy* impl, size_t maxSegments)
+  : m_maxSegments(std::max<size_t>(maxSegments, 2))
+{
+  assert(impl != nullptr);
+  m_segments.reserve(m_maxSegments);
+  m_segments.push_back({std::unique_ptr<CCacheStrategy>(impl), 0});
+}
+
+CSegmentedCache::~CSegmentedCache() = default;
+
+int CSegmentedCache::Open()
+{
+  return Active()->Open();
+}
+
+void CSegmentedCache::Close()
+{
+  // keep the active segment only, the others are recreated on demand
+  Active()->Close();
+  Segment active = std::move(m_segments[m_active]);
+  m_segments.clear();
+  m_segments.push_back(std::move(active));
+  m_active = 0;
+}
+
+size_t CSegmentedCache::GetMaxWriteSize(const size_t& iRequestSize)
+{
+  return Active()->GetMaxWriteSize(iRequestSize);
+}
+
+int CSegmentedCache::WriteToCache(const char* pBuffer, size_t iSize)
+{
+  return Active()->WriteToCache(pBuffer, iSize);
+}
+
+int CSegmentedCache::ReadFromCache(char* pBuffer, size_t iMaxSize)
+{
+  return Active()->ReadFromCache(pBuffer, iMaxSize);
+}
+
+int64_t CSegmentedCache::WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout)
+{
+  return Active()->WaitForData(iMinAvail, timeout);
+}
+
+int64_t CSegmentedCache::Seek(int64_t iFilePosition)
+{
+  // Like CDoubleCache: if another segment has the position, return an error to trigger a seek
+  // event which will switch segments instead of waiting for data in the active one
+  if (!Active()->IsCachedPosition(iFilePosition) && FindSegment(iFilePosition) >= 0)
+    return CACHE_RC_ERROR;
+
+  return Active()->Seek(iFilePosition);
+}
+
+bool CSegmentedCache::Reset(int64_t iSourcePosition)
+{
+  const int index = FindSegment(iSourcePosition);
+  if (index >= 0)
+  {
+    if (static_cast<size_t>(index) != m_active)
+      CLog::Log(LOGDEBUG, "CSegmentedCache::{} - ({}) Cache hit for {} in segment {}-{}",
+                __FUNCTION__, fmt::ptr(this), iSourcePosition,
+                m_segments[index].cache->CachedDataStartPos(),
+                m_segments[index].cache->CachedDataEndPos());
+    Activate(index);
+    return Active()->Reset(iSourcePosition);
+  }
+
+  Activate(GetFreeSegment());
+  return Active()->Reset(iSourcePosition);
+}
+
+void CSegmentedCache::EndOfInput()
+{
+  Active()->EndOfInput();
+}
+
+bool CSegmentedCache::IsEndOfInput()
+{
+  return Active()->IsEndOfInput();
+}
+
+void CSegmentedCache::ClearEndOfInput()
+{
+  Active()->ClearEndOfInput();
+}
+
+int64_t CSegmentedCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
+{
+  // Must match the segment Reset() will pick: the one with the most forward data
+  int64_t ret = iFilePosition;
+  for (const Segment& segment : m_segments)
+    ret = std::max(ret, segment.cache->CachedDataEndPosIfSeekTo(iFilePosition));
+  return ret;
+}
+
+int64_t CSegmentedCache::CachedDataStartPos()
+{
+  return Active()->CachedDataStartPos();
+}
+
+int64_t CSegmentedCache::CachedDataEndPos()
+{
+  return Active()->CachedDataEndPos();
+}
+
+bool CSegmentedCache::IsCachedPosition(int64_t iFilePosition)
+{
+  return FindSegment(iFilePosition) >= 0;
+}
+
+CCacheStrategy* CSegmentedCache::CreateNew()
+{
+  return new CSegmentedCache(Active()->CreateNew(), m_maxSegments);
+}
+
+int CSegmentedCache::FindSegment(int64_t iFilePosition) const
+{
+  int found = -1;
+  int64_t foundEnd = 0;
+  for (size_t i = 0; i < m_segments.size(); ++i)
+  {
+    CCacheStrategy* cache = m_segments[i].cache.get();
+    if (!cache->IsCachedPosition(iFilePosition))
+      continue;
+
+    // prefer the active segment on equal forward data to avoid needless switching
+    const int64_t end = cache->CachedDataEndPos();
+    if (found < 0 || end > foundEnd || (end == foundEnd && i == m_active))
+    {
+      found = static_cast<int>(i);
+      foundEnd = end;
+    }
+  }
+  return found;
+}
+
+size_t CSegmentedCache::GetFreeSegment()
+{
+  if (m_segments.size() < m_maxSegments)
+  {
+    std::unique_ptr<CCacheStrategy> cache(Active()->CreateNew());
+    if (cache->Open() == CACHE_RC_OK)
+    {
+      m_segments.push_back({std::move(cache), 0});
+      return m_segments.size() - 1;
+    }
+    CLog::Log(LOGWARNING, "CSegmentedCache::{} - ({}) Failed to open additional segment",
+              __FUNCTION__, fmt::ptr(this));
+  }
+
+  // Least recently used segment other than the active one, sparing the file head if possible
+  size_t victim = m_active;
+  bool victimIsHead = true;
+  for (size_t i = 0; i < m_segments.size(); ++i)
+  {
+    if (i == m_active)
+      continue;
+
+    const bool isHead = m_segments[i].cache->CachedDataStartPos() == 0;
+    if (victim == m_active || (victimIsHead && !isHead) ||
+        (victimIsHead == isHead && m_segments[i].lastUsed < m_segments[victim].lastUsed))
+    {
+      victim = i;
+      victimIsHead = isHead;
+    }
+  }
+  return victim;
+}
+
+void CSegmentedCache::Activate(size_t index)
+{
+  m_active = index;
+  m_segments[index].lastUsed = ++m_useCounter;
+}
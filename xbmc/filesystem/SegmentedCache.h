@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "CacheStrategy.h"
+
+#include <memory>
+#include <vector>
+
+namespace XFILE
+{
+
+/*!
+ \brief Cache strategy keeping several independently cached ranges of a file.
+
+ Generalisation of CDoubleCache: reading and writing always happens on the active segment. On a
+ seek outside of it the segment holding the requested position becomes active, otherwise the
+ least recently used segment is recycled. The segment covering the start of the file (headers,
+ mp4 moov atom at the front) is only recycled if there is no other candidate, so seeking around
+ in a file doesn't have to re-download its index every time.
+ */
+class CSegmentedCache : public CCacheStrategy
+{
+public:
+  /*!
+   \param impl The first segment, further segments are created with impl->CreateNew()
+   \param maxSegments Maximum number of segments kept, at least 2
+   */
+  CSegmentedCache(CCacheStrategy* impl, size_t maxSegments);
+  ~CSegmentedCache() override;
+
+  int Open() override;
+  void Close() override;
+
+  size_t GetMaxWriteSize(const size_t& iRequestSize) override;
+  int WriteToCache(const char* pBuffer, size_t iSize) override;
+  int ReadFromCache(char* pBuffer, size_t iMaxSize) override;
+  int64_t WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout) override;
+
+  int64_t Seek(int64_t iFilePosition) override;
+  bool Reset(int64_t iSourcePosition) override;
+  void EndOfInput() override;
+  bool IsEndOfInput() override;
+  void ClearEndOfInput() override;
+
+  int64_t CachedDataEndPosIfSeekTo(int64_t iFilePosition) override;
+  int64_t CachedDataStartPos() override;
+  int64_t CachedDataEndPos() override;
+  bool IsCachedPosition(int64_t iFilePosition) override;
+
+  CCacheStrategy* CreateNew() override;
+
+protected:
+  struct Segment
+  {
+    std::unique_ptr<CCacheStrategy> cache;
+    uint64_t lastUsed = 0;
+  };
+
+  CCacheStrategy* Active() const { return m_segments[m_active].cache.get(); }
+
+  /*!
+   \brief Segment with the most forward data cached for a position
+   \return Index of the segment or -1 if no segment has the position cached
+   */
+  int FindSegment(int64_t iFilePosition) const;
+
+  /*!
+   \brief Get a segment to be reset to a position that is not cached anywhere
+   \return Index of the segment, never the active one unless it is the only one usable
+   */
+  size_t GetFreeSegment();
+
+  void Activate(size_t index);
+
+  std::vector<Segment> m_segments;
+  size_t m_active = 0;
+  size_t m_maxSegments;
+  uint64_t m_useCounter = 0;
+};
+
+} // namespace XFILE
@@ -13,20 +13,28 @@
 #include "filesystem/Directory.h"
 #include "filesystem/File.h"
 #include "filesystem/FileDirectoryFactory.h"
+#include "interfaces/AnnouncementManager.h"
 #include "music/MusicDatabase.h"
 #include "music/MusicDbUrl.h"
 #include "playlists/PlayListTypes.h"
 #include "playlists/SmartPlayList.h"
+#include "profiles/ProfileManager.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
 #include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "video/VideoDatabase.h"
 #include "video/VideoDbUrl.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <math.h>
 #include <memory>
+#include <mutex>
 
 #define PROPERTY_PATH_DB            "path.db"
 #define PROPERTY_SORT_ORDER         "sort.order"
@@ -34,6 +42,121 @@
 #define PROPERTY_GROUP_BY           "group.by"
 #define PROPERTY_GROUP_MIXED        "group.mixed"
 
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr size_t MAX_CACHED_RESULTS = 32;
+// rules relative to the current date, e.g. added in the last two weeks, change without the
+// library changing, so results are listed again after a while
+constexpr auto CACHED_RESULT_LIFETIME = 5min;
+
+/*!
+ * \brief Results of smart playlists, e.g. of home screen widgets that are listed again whenever
+ * their window opens. A result is kept until the library changes, which is tracked by a
+ * generation counter advanced by every library announcement.
+ */
+class CResultCache : public ANNOUNCEMENT::IAnnouncer
+{
+public:
+  uint64_t GetGeneration()
+  {
+    // not under m_section, announcements are delivered with the manager's lock held
+    if (!m_registered && CServiceBroker::GetAnnouncementManager() && !m_registered.exchange(true))
+      CServiceBroker::GetAnnouncementManager()->AddAnnouncer(this);
+
+    std::unique_lock<CCriticalSection> lock(m_section);
+    return m_generation;
+  }
+
+  bool Get(const std::string& key, CFileItemList& items)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    const auto it = m_results.find(key);
+    if (it == m_results.end())
+      return false;
+
+    if (std::chrono::steady_clock::now() - it->second.created > CACHED_RESULT_LIFETIME)
+    {
+      m_results.erase(it);
+      return false;
+    }
+
+    // callers modify their items, e.g. by sorting and filling in icons
+    items.Copy(*it->second.items);
+    return true;
+  }
+
+  void Set(const std::string& key, uint64_t generation, const CFileItemList& items)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    // the library changed while the playlist was listed, the result may miss the change
+    if (generation != m_generation)
+      return;
+
+    if (m_results.size() >= MAX_CACHED_RESULTS && m_results.find(key) == m_results.end())
+    {
+      const auto oldest =
+          std::min_element(m_results.begin(), m_results.end(), [](const auto& a, const auto& b)
+                           { return a.second.created < b.second.created; });
+      m_results.erase(oldest);
+    }
+
+    Result& result = m_results[key];
+    result.created = std::chrono::steady_clock::now();
+    result.items = std::make_unique<CFileItemList>();
+    result.items->Copy(items);
+  }
+
+  void Announce(ANNOUNCEMENT::AnnouncementFlag flag,
+                const std::string& sender,
+                const std::string& message,
+                const CVariant& data) override
+  {
+    // resume points and play counts change when playback stops
+    if ((flag & (ANNOUNCEMENT::VideoLibrary | ANNOUNCEMENT::AudioLibrary)) == 0 &&
+        !(flag == ANNOUNCEMENT::Player && message == "OnStop"))
+      return;
+
+    std::unique_lock<CCriticalSection> lock(m_section);
+    m_generation++;
+    m_results.clear();
+  }
+
+private:
+  struct Result
+  {
+    std::chrono::steady_clock::time_point created;
+    std::unique_ptr<CFileItemList> items;
+  };
+
+  CCriticalSection m_section;
+  uint64_t m_generation = 0;
+  std::atomic<bool> m_registered{false};
+  std::map<std::string, Result> m_results;
+};
+
+CResultCache& GetResultCache()
+{
+  static CResultCache cache;
+  return cache;
+}
+
+// results depend on the playlist, the databases of the profile and the sort settings
+std::string GetResultCacheKey(const CURL& url, const CSmartPlaylist& playlist)
+{
+  std::string definition;
+  playlist.SaveAsJson(definition);
+
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  const auto settings = settingsComponent->GetSettings();
+  return StringUtils::Format(
+      "{}|{}|{}|{}|{}", settingsComponent->GetProfileManager()->GetCurrentProfileId(),
+      settings->GetBool(CSettings::SETTING_FILELISTS_IGNORETHEWHENSORTING),
+      settings->GetBool(CSettings::SETTING_MUSICLIBRARY_USEARTISTSORTNAME), url.Get(), definition);
+}
+} // unnamed namespace
+
 namespace XFILE
 {
   CSmartPlaylistDirectory::CSmartPlaylistDirectory() = default;
@@ -46,9 +169,19 @@ namespace XFILE
     CSmartPlaylist playlist;
     if (!playlist.Load(url))
       return false;
+
+    CResultCache& cache = GetResultCache();
+    const std::string key = GetResultCacheKey(url, playlist);
+    if (cache.Get(key, items))
+      return true;
+
+    const uint64_t generation = cache.GetGeneration();
     bool result = GetDirectory(playlist, items);
     if (result)
+    {
       items.SetProperty("library.smartplaylist", true);
+      cache.Set(key, generation, items);
+    }
 
     return result;
   }
@@ -9,11 +9,59 @@
 #include "UDFBlockInput.h"
 
 #include "filesystem/File.h"
+#include "utils/StringUtils.h"
 
+#include <algorithm>
+#include <cstring>
+#include <list>
 #include <mutex>
+#include <vector>
 
 #include <udfread/udfread.h>
 
+namespace
+{
+// udfread parses volume descriptors, directories and file entries one or a few blocks at a time,
+// and does so again for every file that is opened in an image. Such small reads are widened to
+// whole clusters that are shared by all block inputs of the same image, so that an image on a
+// network share is not read block by block.
+constexpr uint32_t CLUSTER_BLOCKS = 32;
+constexpr size_t MAX_CLUSTERS = 64;
+
+struct Cluster
+{
+  std::string image;
+  uint32_t index;
+  std::shared_ptr<const std::vector<uint8_t>> data;
+};
+
+CCriticalSection clusterSection;
+std::list<Cluster> clusters; // most recently used first
+
+std::shared_ptr<const std::vector<uint8_t>> FindCluster(const std::string& image, uint32_t index)
+{
+  std::unique_lock<CCriticalSection> lock(clusterSection);
+  const auto it = std::find_if(clusters.begin(), clusters.end(), [&](const Cluster& cluster) {
+    return cluster.index == index && cluster.image == image;
+  });
+  if (it == clusters.end())
+    return {};
+
+  clusters.splice(clusters.begin(), clusters, it);
+  return it->data;
+}
+
+void AddCluster(const std::string& image,
+                uint32_t index,
+                std::shared_ptr<const std::vector<uint8_t>> data)
+{
+  std::unique_lock<CCriticalSection> lock(clusterSection);
+  clusters.push_front({image, index, std::move(data)});
+  if (clusters.size() > MAX_CLUSTERS)
+    clusters.pop_back();
+}
+} // unnamed namespace
+
 int CUDFBlockInput::Close(udfread_block_input* bi)
 {
   auto m_bi = reinterpret_cast<UDF_BI*>(bi);
@@ -32,6 +80,45 @@ uint32_t CUDFBlockInput::Size(udfread_block_input* bi)
 
 int CUDFBlockInput::Read(
     udfread_block_input* bi, uint32_t lba, void* buf, uint32_t blocks, int flags)
+{
+  // file contents are read in large pieces, those do not profit from the cache
+  if (blocks >= CLUSTER_BLOCKS)
+    return ReadBlocks(bi, lba, buf, blocks);
+
+  auto m_bi = reinterpret_cast<UDF_BI*>(bi);
+  uint8_t* dest = static_cast<uint8_t*>(buf);
+  uint32_t done = 0;
+  while (done < blocks)
+  {
+    const uint32_t index = (lba + done) / CLUSTER_BLOCKS;
+    auto cluster = FindCluster(m_bi->image, index);
+    if (!cluster)
+    {
+      auto data = std::make_shared<std::vector<uint8_t>>(CLUSTER_BLOCKS * UDF_BLOCK_SIZE);
+      const int read = ReadBlocks(bi, index * CLUSTER_BLOCKS, data->data(), CLUSTER_BLOCKS);
+      if (read <= 0)
+        break;
+      data->resize(static_cast<size_t>(read) * UDF_BLOCK_SIZE);
+      AddCluster(m_bi->image, index, data);
+      cluster = std::move(data);
+    }
+
+    const uint32_t offset = lba + done - index * CLUSTER_BLOCKS;
+    const uint32_t available = static_cast<uint32_t>(cluster->size() / UDF_BLOCK_SIZE);
+    if (offset >= available)
+      break;
+
+    const uint32_t count = std::min(blocks - done, available - offset);
+    std::memcpy(dest + static_cast<size_t>(done) * UDF_BLOCK_SIZE,
+                cluster->data() + static_cast<size_t>(offset) * UDF_BLOCK_SIZE,
+                static_cast<size_t>(count) * UDF_BLOCK_SIZE);
+    done += count;
+  }
+
+  return done > 0 ? static_cast<int>(done) : -1;
+}
+
+int CUDFBlockInput::ReadBlocks(udfread_block_input* bi, uint32_t lba, void* buf, uint32_t blocks)
 {
   auto m_bi = reinterpret_cast<UDF_BI*>(bi);
   std::unique_lock<CCriticalSection> lock(m_bi->lock);
@@ -41,12 +128,22 @@ int CUDFBlockInput::Read(
   if (m_bi->fp->Seek(pos, SEEK_SET) != pos)
     return -1;
 
-  ssize_t size = blocks * UDF_BLOCK_SIZE;
-  ssize_t read = m_bi->fp->Read(buf, size);
-  if (read > 0)
-    return static_cast<int>(read / UDF_BLOCK_SIZE);
+  // network files return what they have at hand, keep reading so no block is cut short
+  const ssize_t size = static_cast<ssize_t>(blocks) * UDF_BLOCK_SIZE;
+  ssize_t total = 0;
+  while (total < size)
+  {
+    const ssize_t read = m_bi->fp->Read(static_cast<uint8_t*>(buf) + total, size - total);
+    if (read <= 0)
+    {
+      if (total == 0)
+        return static_cast<int>(read);
+      break;
+    }
+    total += read;
+  }
 
-  return static_cast<int>(read);
+  return static_cast<int>(total / UDF_BLOCK_SIZE);
 }
 
 udfread_block_input* CUDFBlockInput::GetBlockInput(const std::string& file)
@@ -59,6 +156,7 @@ udfread_block_input* CUDFBlockInput::GetBlockInput(const std::string& file)
     if (m_bi)
     {
       m_bi->fp = fp;
+      m_bi->image = StringUtils::Format("{}:{}", file, fp->GetLength());
       m_bi->bi.close = CUDFBlockInput::Close;
       m_bi->bi.read = CUDFBlockInput::Read;
       m_bi->bi.size = CUDFBlockInput::Size;
@@ -11,6 +11,7 @@
 #include "threads/CriticalSection.h"
 
 #include <memory>
+#include <string>
 
 #include <udfread/blockinput.h>
 
@@ -31,11 +32,13 @@ private:
   static int Close(udfread_block_input* bi);
   static uint32_t Size(udfread_block_input* bi);
   static int Read(udfread_block_input* bi, uint32_t lba, void* buf, uint32_t nblocks, int flags);
+  static int ReadBlocks(udfread_block_input* bi, uint32_t lba, void* buf, uint32_t nblocks);
 
   struct UDF_BI
   {
     struct udfread_block_input bi;
     std::shared_ptr<XFILE::CFile> fp{nullptr};
+    std::string image; ///< identifies the image in the cluster cache
     CCriticalSection lock;
   };
 
@@ -38,7 +38,7 @@ bool CZipFile::Open(const CURL&url)
   const std::string& strOpts = url.GetOptions();
   CURL url2(url);
   url2.SetOptions("");
-  if (!g_ZipManager.GetZipEntry(url2,mZipItem))
+  if (!g_ZipManager.GetZipEntry(url2, mZipItem, true))
     return false;
 
   if ((mZipItem.flags & 64) == 64)
@@ -9,6 +9,7 @@
 #include "ZipManager.h"
 
 #include <algorithm>
+#include <mutex>
 #include <utility>
 
 #include "File.h"
@@ -42,20 +43,37 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     return false;
   }
 
-  std::map<std::string, std::vector<SZipEntry> >::iterator it = mZipMap.find(strFile);
+  std::unique_lock<CCriticalSection> lock(m_lock);
+  auto it = mZipMap.find(strFile);
   if (it != mZipMap.end()) // already listed, just return it if not changed, else release and reread
   {
-    std::map<std::string,int64_t>::iterator it2=mZipDate.find(strFile);
-
-    if (m_StatData.st_mtime == it2->second)
+    if (m_StatData.st_mtime == it->second.mtime)
     {
-      items = it->second;
+      items = it->second.entries;
       return true;
     }
     mZipMap.erase(it);
-    mZipDate.erase(it2);
   }
+  lock.unlock();
+
+  ZipArchive archive;
+  if (!ReadCentralDirectory(strFile, archive.entries))
+    return false;
+
+  archive.mtime = m_StatData.st_mtime;
+  archive.index.reserve(archive.entries.size());
+  for (size_t i = 0; i < archive.entries.size(); ++i)
+    archive.index.emplace(archive.entries[i].name, i);
 
+  items = archive.entries;
+
+  lock.lock();
+  mZipMap[strFile] = std::move(archive);
+  return true;
+}
+
+bool CZipManager::ReadCentralDirectory(const std::string& strFile, std::vector<SZipEntry>& items)
+{
   CFile mFile;
   if (!mFile.Open(strFile))
   {
@@ -76,10 +94,6 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
   if (Endian_SwapLE32(hdr) == ZIP_SPLIT_ARCHIVE_HEADER)
     CLog::LogF(LOGWARNING, "ZIP split archive header found. Trying to process as a single archive..");
 
-  // push date for update detection
-  mZipDate.insert(make_pair(strFile,m_StatData.st_mtime));
-
-
   // Look for end of central directory record
   // Zipfile comment may be up to 65535 bytes
   // End of central directory record is 22 bytes (ECDREC_SIZE)
@@ -156,32 +170,41 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     return false;
   cdirOffset = Endian_SwapLE32(cdirOffset);
 
-  // Go to the start of central directory
+  if (static_cast<int64_t>(cdirOffset) + cdirSize > fileSize)
+  {
+    CLog::Log(LOGDEBUG, "ZipManager: broken file {}!", strFile);
+    return false;
+  }
+
+  // Read the whole central directory at once instead of a few bytes per entry
+  std::vector<char> cdir(cdirSize);
   mFile.Seek(cdirOffset,SEEK_SET);
+  if (mFile.Read(cdir.data(), cdirSize) != static_cast<ssize_t>(cdirSize))
+    return false;
+  mFile.Close();
 
   CRegExp pathTraversal;
   pathTraversal.RegComp(PATH_TRAVERSAL);
 
-  char temp[CHDR_SIZE];
-  while (mFile.GetPosition() < cdirOffset + cdirSize)
+  size_t pos = 0;
+  while (pos < cdir.size())
   {
     SZipEntry ze;
-    if (mFile.Read(temp, CHDR_SIZE) != CHDR_SIZE)
+    if (cdir.size() - pos < CHDR_SIZE)
+    {
+      CLog::Log(LOGDEBUG, "ZipManager: broken file {}!", strFile);
       return false;
-    readCHeader(temp, ze);
-    if (ze.header != ZIP_CENTRAL_HEADER)
+    }
+    readCHeader(cdir.data() + pos, ze);
+    pos += CHDR_SIZE;
+    if (ze.header != ZIP_CENTRAL_HEADER || cdir.size() - pos < ze.flength)
     {
       CLog::Log(LOGDEBUG, "ZipManager: broken file {}!", strFile);
-      mFile.Close();
       return false;
     }
 
     // Get the filename just after the central file header
-    std::vector<char> bufName(ze.flength);
-    if (mFile.Read(bufName.data(), ze.flength) != ze.flength)
-      return false;
-    std::string strName(bufName.data(), bufName.size());
-    bufName.clear();
+    std::string strName(cdir.data() + pos, ze.flength);
     if ((ze.flags & ZC_FLAG_EFS) == 0)
     {
       std::string tmp(strName);
@@ -190,58 +213,79 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     memset(ze.name, 0, 255);
     strncpy(ze.name, strName.c_str(), strName.size() > 254 ? 254 : strName.size());
 
-    // Jump after central file header extra field and file comment
-    mFile.Seek(ze.eclength + ze.clength,SEEK_CUR);
+    // Jump after filename, central file header extra field and file comment
+    pos += ze.flength + ze.eclength + ze.clength;
 
     if (pathTraversal.RegFind(strName) < 0)
       items.push_back(ze);
   }
 
-  /* go through list and figure out file header lengths */
-  for (auto& ze : items)
-  {
-    // Go to the local file header to get the extra field length
-    // !! local header extra field length != central file header extra field length !!
-    mFile.Seek(ze.lhdrOffset+28,SEEK_SET);
-    if (mFile.Read(&(ze.elength), 2) != 2)
-      return false;
-    ze.elength = Endian_SwapLE16(ze.elength);
-
-    // Compressed data offset = local header offset + size of local header + filename length + local file header extra field length
-    ze.offset = ze.lhdrOffset + LHDR_SIZE + ze.flength + ze.elength;
+  return true;
+}
 
+bool CZipManager::ReadDataOffset(const std::string& strFile, SZipEntry& item)
+{
+  CFile mFile;
+  if (!mFile.Open(strFile))
+  {
+    CLog::Log(LOGDEBUG, "ZipManager: unable to open file {}!", strFile);
+    return false;
   }
 
-  mZipMap.insert(make_pair(strFile,items));
-  mFile.Close();
+  // Go to the local file header to get the extra field length
+  // !! local header extra field length != central file header extra field length !!
+  mFile.Seek(item.lhdrOffset+28,SEEK_SET);
+  if (mFile.Read(&(item.elength), 2) != 2)
+    return false;
+  item.elength = Endian_SwapLE16(item.elength);
+
+  // Compressed data offset = local header offset + size of local header + filename length + local file header extra field length
+  item.offset = item.lhdrOffset + LHDR_SIZE + item.flength + item.elength;
   return true;
 }
 
-bool CZipManager::GetZipEntry(const CURL& url, SZipEntry& item)
+bool CZipManager::GetZipEntry(const CURL& url, SZipEntry& item, bool resolveOffset /* = false */)
 {
   const std::string& strFile = url.GetHostName();
 
-  std::map<std::string, std::vector<SZipEntry> >::iterator it = mZipMap.find(strFile);
-  std::vector<SZipEntry> items;
+  std::unique_lock<CCriticalSection> lock(m_lock);
+  auto it = mZipMap.find(strFile);
   if (it == mZipMap.end()) // we need to list the zip
   {
-    GetZipList(url,items);
-  }
-  else
-  {
-    items = it->second;
+    lock.unlock();
+    std::vector<SZipEntry> items;
+    if (!GetZipList(url, items))
+      return false;
+    lock.lock();
+    it = mZipMap.find(strFile);
+    if (it == mZipMap.end())
+      return false;
   }
 
-  const std::string& strFileName = url.GetFileName();
-  for (const auto& it2 : items)
+  const auto entry = it->second.index.find(url.GetFileName());
+  if (entry == it->second.index.end())
+    return false;
+
+  const size_t position = entry->second;
+  item = it->second.entries[position];
+  if (!resolveOffset || item.offset != 0)
+    return true;
+
+  // the local headers are only read for the entries that are actually opened, listing a large
+  // archive would otherwise seek to every single one of them
+  lock.unlock();
+  if (!ReadDataOffset(strFile, item))
+    return false;
+
+  lock.lock();
+  it = mZipMap.find(strFile);
+  if (it != mZipMap.end() && position < it->second.entries.size() &&
+      it->second.entries[position].lhdrOffset == item.lhdrOffset)
   {
-    if (std::string(it2.name) == strFileName)
-    {
-      item = it2;
-      return true;
-    }
+    it->second.entries[position].elength = item.elength;
+    it->second.entries[position].offset = item.offset;
   }
-  return false;
+  return true;
 }
 
 bool CZipManager::ExtractArchive(const std::string& strArchive, const std::string& strPath)
@@ -308,13 +352,8 @@ void CZipManager::readCHeader(const char* buffer, SZipEntry& info)
 void CZipManager::release(const std::string& strPath)
 {
   CURL url(strPath);
-  std::map<std::string, std::vector<SZipEntry> >::iterator it= mZipMap.find(url.GetHostName());
-  if (it != mZipMap.end())
-  {
-    std::map<std::string,int64_t>::iterator it2=mZipDate.find(url.GetHostName());
-    mZipMap.erase(it);
-    mZipDate.erase(it2);
-  }
+  std::unique_lock<CCriticalSection> lock(m_lock);
+  mZipMap.erase(url.GetHostName());
 }
 
 
@@ -19,9 +19,12 @@
 #define CHDR_SIZE 46
 #define ECDREC_SIZE 22
 
+#include "threads/CriticalSection.h"
+
 #include <cstring>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class CURL;
@@ -43,7 +46,7 @@ struct SZipEntry {
   unsigned short eclength = 0; // extra field length (central file header)
   unsigned short clength = 0; // file comment length (central file header)
   unsigned int lhdrOffset = 0; // Relative offset of local header
-  int64_t offset = 0;         // offset in file to compressed data
+  int64_t offset = 0;         // offset in file to compressed data, 0 if not resolved
   char name[255];
 
   SZipEntry()
@@ -59,15 +62,30 @@ public:
   ~CZipManager();
 
   bool GetZipList(const CURL& url, std::vector<SZipEntry>& items);
-  bool GetZipEntry(const CURL& url, SZipEntry& item);
+  /*!
+   * \brief Look up a single entry of an archive
+   * \param resolveOffset whether to determine the offset of the entry's data, this needs to read its
+   * local header and is only required to read the entry
+   */
+  bool GetZipEntry(const CURL& url, SZipEntry& item, bool resolveOffset = false);
   bool ExtractArchive(const std::string& strArchive, const std::string& strPath);
   bool ExtractArchive(const CURL& archive, const std::string& strPath);
   void release(const std::string& strPath); // release resources used by list zip
   static void readHeader(const char* buffer, SZipEntry& info);
   static void readCHeader(const char* buffer, SZipEntry& info);
 private:
-  std::map<std::string,std::vector<SZipEntry> > mZipMap;
-  std::map<std::string,int64_t> mZipDate;
+  struct ZipArchive
+  {
+    int64_t mtime = 0;
+    std::vector<SZipEntry> entries;
+    std::unordered_map<std::string, size_t> index; // entry name -> position in entries
+  };
+
+  static bool ReadCentralDirectory(const std::string& strFile, std::vector<SZipEntry>& items);
+  static bool ReadDataOffset(const std::string& strFile, SZipEntry& item);
+
+  std::map<std::string, ZipArchive> mZipMap;
+  CCriticalSection m_lock;
 
   template<typename T>
   static T ReadUnaligned(const void* mem)
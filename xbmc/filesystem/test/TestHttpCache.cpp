@@ -0,0 +1,36 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/HttpCache.h"
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+TEST(TestHttpCache, ParseCacheControl)
+{
+  CHttpCache::CacheControl control = CHttpCache::ParseCacheControl("");
+  EXPECT_FALSE(control.noStore);
+  EXPECT_FALSE(control.noCache);
+  EXPECT_EQ(-1, control.maxAge);
+
+  control = CHttpCache::ParseCacheControl("public, max-age=3600");
+  EXPECT_FALSE(control.noStore);
+  EXPECT_FALSE(control.noCache);
+  EXPECT_EQ(3600, control.maxAge);
+
+  control = CHttpCache::ParseCacheControl("No-Cache, Max-Age=\"60\"");
+  EXPECT_TRUE(control.noCache);
+  EXPECT_EQ(60, control.maxAge);
+
+  control = CHttpCache::ParseCacheControl("no-store");
+  EXPECT_TRUE(control.noStore);
+
+  control = CHttpCache::ParseCacheControl("max-age=-5, s-maxage=100");
+  EXPECT_EQ(-1, control.maxAge);
+}
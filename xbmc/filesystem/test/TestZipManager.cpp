@@ -6,8 +6,13 @@
  *  See LICENSES/README.md for more information.
  */
 
+#include "URL.h"
 #include "filesystem/ZipManager.h"
+#include "test/TestUtils.h"
 #include "utils/RegExp.h"
+#include "utils/URIUtils.h"
+
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -28,3 +33,29 @@ TEST(TestZipManager, PathTraversal)
   ASSERT_FALSE(pathTraversal.RegFind("test.txt..") >= 0);
   ASSERT_FALSE(pathTraversal.RegFind("test..test.txt") >= 0);
 }
+
+TEST(TestZipManager, GetZipEntry)
+{
+  const CURL archive(XBMC_REF_FILE_PATH("xbmc/filesystem/test/reffile.txt.zip"));
+
+  std::vector<SZipEntry> items;
+  ASSERT_TRUE(g_ZipManager.GetZipList(URIUtils::CreateArchivePath("zip", archive), items));
+  ASSERT_FALSE(items.empty());
+
+  SZipEntry item;
+  const CURL entry = URIUtils::CreateArchivePath("zip", archive, items[0].name);
+  ASSERT_TRUE(g_ZipManager.GetZipEntry(entry, item));
+  EXPECT_STREQ(items[0].name, item.name);
+  EXPECT_EQ(items[0].usize, item.usize);
+
+  // the data offset is only looked up on request and then kept
+  ASSERT_TRUE(g_ZipManager.GetZipEntry(entry, item, true));
+  EXPECT_EQ(static_cast<int64_t>(item.lhdrOffset) + LHDR_SIZE + item.flength + item.elength,
+            item.offset);
+  SZipEntry cached;
+  ASSERT_TRUE(g_ZipManager.GetZipEntry(entry, cached));
+  EXPECT_EQ(item.offset, cached.offset);
+
+  EXPECT_FALSE(g_ZipManager.GetZipEntry(
+      URIUtils::CreateArchivePath("zip", archive, "does-not-exist.txt"), item));
+}
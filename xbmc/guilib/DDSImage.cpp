@@ -13,9 +13,141 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
 #include <string.h>
 using namespace XFILE;
 
+namespace
+{
+constexpr uint32_t DDS_MAGIC = 0x20534444; // "DDS "
+
+struct Color
+{
+  int r, g, b;
+};
+
+uint16_t PackColor(const Color& c)
+{
+  return static_cast<uint16_t>(((c.r >> 3) << 11) | ((c.g >> 2) << 5) | (c.b >> 3));
+}
+
+Color UnpackColor(uint16_t c)
+{
+  const int r = (c >> 11) & 0x1f;
+  const int g = (c >> 5) & 0x3f;
+  const int b = c & 0x1f;
+  return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+void WriteUInt16(unsigned char* dst, uint16_t value)
+{
+  dst[0] = value & 0xff;
+  dst[1] = value >> 8;
+}
+
+/*!
+ \brief Encode the colors of a 4x4 block in BGRA order as a DXT1 color block.
+
+ The endpoints are the corners of the slightly inset bounding box of the colors, which is fast
+ and good enough for thumbnails.
+ */
+void EncodeColorBlock(const unsigned char* block, unsigned char* dst)
+{
+  Color lo{255, 255, 255};
+  Color hi{0, 0, 0};
+  for (int i = 0; i < 16; i++)
+  {
+    const unsigned char* p = block + i * 4;
+    lo = {std::min<int>(lo.r, p[2]), std::min<int>(lo.g, p[1]), std::min<int>(lo.b, p[0])};
+    hi = {std::max<int>(hi.r, p[2]), std::max<int>(hi.g, p[1]), std::max<int>(hi.b, p[0])};
+  }
+
+  const Color inset{(hi.r - lo.r) >> 4, (hi.g - lo.g) >> 4, (hi.b - lo.b) >> 4};
+  uint16_t c0 = PackColor({hi.r - inset.r, hi.g - inset.g, hi.b - inset.b});
+  uint16_t c1 = PackColor({lo.r + inset.r, lo.g + inset.g, lo.b + inset.b});
+  if (c0 < c1)
+    std::swap(c0, c1);
+
+  WriteUInt16(dst, c0);
+  WriteUInt16(dst + 2, c1);
+
+  uint32_t indices = 0;
+  if (c0 != c1)
+  {
+    // c0 > c1 selects the four color mode: c0, c1, 2/3 c0 + 1/3 c1, 1/3 c0 + 2/3 c1
+    const Color e0 = UnpackColor(c0);
+    const Color e1 = UnpackColor(c1);
+    const Color palette[4] = {e0,
+                              e1,
+                              {(2 * e0.r + e1.r) / 3, (2 * e0.g + e1.g) / 3, (2 * e0.b + e1.b) / 3},
+                              {(e0.r + 2 * e1.r) / 3, (e0.g + 2 * e1.g) / 3, (e0.b + 2 * e1.b) / 3}};
+
+    for (int i = 0; i < 16; i++)
+    {
+      const unsigned char* p = block + i * 4;
+      int best = 0;
+      int bestDistance = INT32_MAX;
+      for (int j = 0; j < 4; j++)
+      {
+        const int dr = palette[j].r - p[2];
+        const int dg = palette[j].g - p[1];
+        const int db = palette[j].b - p[0];
+        const int distance = dr * dr + dg * dg + db * db;
+        if (distance < bestDistance)
+        {
+          bestDistance = distance;
+          best = j;
+        }
+      }
+      indices |= static_cast<uint32_t>(best) << (2 * i);
+    }
+  }
+
+  for (int i = 0; i < 4; i++)
+    dst[4 + i] = (indices >> (8 * i)) & 0xff;
+}
+
+//! \brief Encode the alpha values of a 4x4 block in BGRA order as a DXT5 alpha block.
+void EncodeAlphaBlock(const unsigned char* block, unsigned char* dst)
+{
+  int a0 = 0;
+  int a1 = 255;
+  for (int i = 0; i < 16; i++)
+  {
+    a0 = std::max<int>(a0, block[i * 4 + 3]);
+    a1 = std::min<int>(a1, block[i * 4 + 3]);
+  }
+
+  dst[0] = static_cast<unsigned char>(a0);
+  dst[1] = static_cast<unsigned char>(a1);
+
+  uint64_t indices = 0;
+  if (a0 != a1)
+  {
+    // a0 > a1 selects the eight value mode: a0, a1 and six values in between
+    int palette[8] = {a0, a1};
+    for (int j = 1; j < 7; j++)
+      palette[j + 1] = ((7 - j) * a0 + j * a1) / 7;
+
+    for (int i = 0; i < 16; i++)
+    {
+      const int a = block[i * 4 + 3];
+      int best = 0;
+      for (int j = 1; j < 8; j++)
+      {
+        if (std::abs(palette[j] - a) < std::abs(palette[best] - a))
+          best = j;
+      }
+      indices |= static_cast<uint64_t>(best) << (3 * i);
+    }
+  }
+
+  for (int i = 0; i < 6; i++)
+    dst[2 + i] = (indices >> (8 * i)) & 0xff;
+}
+} // unnamed namespace
+
 CDDSImage::CDDSImage()
 {
   m_data = NULL;
@@ -100,6 +232,62 @@ bool CDDSImage::ReadFile(const std::string &inputFile)
   return true;
 }
 
+bool CDDSImage::WriteFile(const std::string &outputFile) const
+{
+  if (!m_data)
+    return false;
+
+  CFile file;
+  if (!file.OpenForWrite(outputFile, true))
+    return false;
+
+  const uint32_t magic = DDS_MAGIC;
+  if (file.Write(&magic, 4) != 4 ||
+      file.Write(&m_desc, sizeof(m_desc)) != static_cast<ssize_t>(sizeof(m_desc)) ||
+      file.Write(m_data, m_desc.linearSize) != static_cast<ssize_t>(m_desc.linearSize))
+  {
+    file.Close();
+    CFile::Delete(outputFile);
+    return false;
+  }
+
+  file.Close();
+  return true;
+}
+
+void CDDSImage::Compress(unsigned int width,
+                         unsigned int height,
+                         unsigned int pitch,
+                         const unsigned char* bgra,
+                         bool hasAlpha)
+{
+  const XB_FMT format = hasAlpha ? XB_FMT_DXT5 : XB_FMT_DXT1;
+  Allocate(width, height, format);
+
+  const unsigned int blockSize = hasAlpha ? 16 : 8;
+  unsigned char* dst = m_data;
+  unsigned char block[16 * 4];
+
+  for (unsigned int by = 0; by < height; by += 4)
+  {
+    for (unsigned int bx = 0; bx < width; bx += 4)
+    {
+      // blocks at the right and bottom edge repeat the last column and row
+      for (unsigned int y = 0; y < 4; y++)
+      {
+        const unsigned char* row = bgra + std::min(by + y, height - 1) * pitch;
+        for (unsigned int x = 0; x < 4; x++)
+          memcpy(block + (y * 4 + x) * 4, row + std::min(bx + x, width - 1) * 4, 4);
+      }
+
+      if (hasAlpha)
+        EncodeAlphaBlock(block, dst);
+      EncodeColorBlock(block, dst + blockSize - 8);
+      dst += blockSize;
+    }
+  }
+}
+
 unsigned int CDDSImage::GetStorageRequirements(unsigned int width,
                                                unsigned int height,
                                                XB_FMT format)
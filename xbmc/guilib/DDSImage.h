@@ -27,6 +27,21 @@ public:
   unsigned char *GetData() const;
 
   bool ReadFile(const std::string &file);
+  bool WriteFile(const std::string &file) const;
+
+  /*!
+   \brief Compress an image to DXT1, or to DXT5 if it has an alpha channel.
+   \param width width of the image in pixels
+   \param height height of the image in pixels
+   \param pitch bytes per row of the image
+   \param bgra the pixels in XB_FMT_A8R8G8B8 byte order
+   \param hasAlpha whether the alpha channel has to be kept
+   */
+  void Compress(unsigned int width,
+                unsigned int height,
+                unsigned int pitch,
+                const unsigned char* bgra,
+                bool hasAlpha);
 
 private:
   void Allocate(unsigned int width, unsigned int height, XB_FMT format);
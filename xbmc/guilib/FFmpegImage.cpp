@@ -114,6 +114,44 @@ static int64_t mem_file_seek(void *h, int64_t pos, int whence)
   return mbuf->pos;
 }
 
+// reads the dimensions from the start of frame segment of a jpeg
+static bool GetJpegSize(const uint8_t* buffer, size_t bufSize, unsigned int& width, unsigned int& height)
+{
+  size_t pos = 2; // skip SOI
+  while (pos + 4 <= bufSize)
+  {
+    if (buffer[pos] != 0xFF)
+      return false;
+
+    const uint8_t marker = buffer[pos + 1];
+    if (marker == 0xFF) // fill byte
+    {
+      pos++;
+      continue;
+    }
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) // markers without a segment
+    {
+      pos += 2;
+      continue;
+    }
+    if (marker == 0xD9 || marker == 0xDA) // end of image or start of scan before any frame
+      return false;
+
+    // SOF0..SOF15, except DHT, JPG and DAC which share the range
+    if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+    {
+      if (pos + 9 > bufSize)
+        return false;
+      height = (buffer[pos + 5] << 8) | buffer[pos + 6];
+      width = (buffer[pos + 7] << 8) | buffer[pos + 8];
+      return width > 0 && height > 0;
+    }
+
+    pos += 2 + ((buffer[pos + 2] << 8) | buffer[pos + 3]);
+  }
+  return false;
+}
+
 CFFmpegImage::CFFmpegImage(const std::string& strMimeType) : m_strMimeType(strMimeType)
 {
   m_hasAlpha = false;
@@ -143,7 +181,7 @@ bool CFFmpegImage::LoadImageFromMemory(unsigned char* buffer, unsigned int bufSi
                                       unsigned int width, unsigned int height)
 {
 
-  if (!Initialize(buffer, bufSize))
+  if (!Initialize(buffer, bufSize, width, height))
   {
     //log
     return false;
@@ -155,7 +193,10 @@ bool CFFmpegImage::LoadImageFromMemory(unsigned char* buffer, unsigned int bufSi
   return !(m_pFrame == nullptr);
 }
 
-bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
+bool CFFmpegImage::Initialize(unsigned char* buffer,
+                              size_t bufSize,
+                              unsigned int maxWidth /* = 0 */,
+                              unsigned int maxHeight /* = 0 */)
 {
   int bufferSize = 4096;
   uint8_t* fbuffer = (uint8_t*)av_malloc(bufferSize + AV_INPUT_BUFFER_PADDING_SIZE);
@@ -262,6 +303,26 @@ bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
     return false;
   }
 
+  // jpegs can be decoded at 1/2, 1/4 or 1/8 of their size by skipping DCT coefficients, use the
+  // smallest size that still covers the requested one as the full image is scaled down anyway
+  m_fullWidth = m_fullHeight = 0;
+  unsigned int jpegWidth, jpegHeight;
+  if (maxWidth && maxHeight && codec->id == AV_CODEC_ID_MJPEG && codec->max_lowres > 0 &&
+      GetJpegSize(buffer, bufSize, jpegWidth, jpegHeight))
+  {
+    int lowres = 0;
+    while (lowres < codec->max_lowres && ((jpegWidth >> (lowres + 1)) >= maxWidth ||
+                                          (jpegHeight >> (lowres + 1)) >= maxHeight))
+      lowres++;
+
+    if (lowres > 0)
+    {
+      m_codec_ctx->lowres = lowres;
+      m_fullWidth = jpegWidth;
+      m_fullHeight = jpegHeight;
+    }
+  }
+
   if (avcodec_open2(m_codec_ctx, codec, NULL) < 0)
   {
     avformat_close_input(&m_fctx);
@@ -314,8 +375,8 @@ AVFrame* CFFmpegImage::ExtractFrame()
 
   m_height = frame->height;
   m_width = frame->width;
-  m_originalWidth = m_width;
-  m_originalHeight = m_height;
+  m_originalWidth = m_fullWidth ? m_fullWidth : m_width;
+  m_originalHeight = m_fullHeight ? m_fullHeight : m_height;
 
   const AVPixFmtDescriptor* pixDescriptor = av_pix_fmt_desc_get(static_cast<AVPixelFormat>(frame->format));
   if (pixDescriptor && ((pixDescriptor->flags & (AV_PIX_FMT_FLAG_ALPHA | AV_PIX_FMT_FLAG_PAL)) != 0))
@@ -488,9 +549,9 @@ bool CFFmpegImage::DecodeFrame(AVFrame* frame, unsigned int width, unsigned int
   AVPixelFormat pixFormat = ConvertFormats(frame);
 
   // assumption quadratic maximums e.g. 2048x2048
-  float ratio = m_width / (float)m_height;
-  unsigned int nHeight = m_originalHeight;
-  unsigned int nWidth = m_originalWidth;
+  float ratio = frame->width / (float)frame->height;
+  unsigned int nHeight = frame->height;
+  unsigned int nWidth = frame->width;
   if (nHeight > height)
   {
     nHeight = height;
@@ -502,7 +563,7 @@ bool CFFmpegImage::DecodeFrame(AVFrame* frame, unsigned int width, unsigned int
     nHeight = (unsigned int)(nWidth / ratio + 0.5f);
   }
 
-  struct SwsContext* context = sws_getContext(m_originalWidth, m_originalHeight, pixFormat,
+  struct SwsContext* context = sws_getContext(frame->width, frame->height, pixFormat,
     nWidth, nHeight, AV_PIX_FMT_RGB32, SWS_BICUBIC, NULL, NULL, NULL);
 
   if (range == AVCOL_RANGE_JPEG)
@@ -515,7 +576,7 @@ bool CFFmpegImage::DecodeFrame(AVFrame* frame, unsigned int width, unsigned int
     sws_setColorspaceDetails(context, inv_table, srcRange, table, dstRange, brightness, contrast, saturation);
   }
 
-  sws_scale(context, frame->data, frame->linesize, 0, m_originalHeight,
+  sws_scale(context, frame->data, frame->linesize, 0, frame->height,
     pictureRGB->data, pictureRGB->linesize);
   sws_freeContext(context);
 
@@ -69,7 +69,17 @@ public:
                                   unsigned int &bufferoutSize) override;
   void ReleaseThumbnailBuffer() override;
 
-  bool Initialize(unsigned char* buffer, size_t bufSize);
+  /*!
+   \brief Open the decoder for an image in memory.
+   \param maxWidth the width the image is going to be scaled to fit in, 0 for any
+   \param maxHeight the height the image is going to be scaled to fit in, 0 for any
+   \return true if the image can be decoded. If both maximums are set, jpegs are decoded at a
+   reduced size that still covers them.
+   */
+  bool Initialize(unsigned char* buffer,
+                  size_t bufSize,
+                  unsigned int maxWidth = 0,
+                  unsigned int maxHeight = 0);
 
   std::shared_ptr<Frame> ReadFrame();
 
@@ -92,4 +102,7 @@ private:
 
   AVFrame* m_pFrame;
   uint8_t* m_outputBuffer;
+
+  unsigned int m_fullWidth = 0; ///< size of the jpeg when it is decoded at a reduced size
+  unsigned int m_fullHeight = 0;
 };
@@ -9,7 +9,9 @@
 #include "GUIBaseContainer.h"
 
 #include "FileItem.h"
+#include "GUIComponent.h"
 #include "GUIInfoManager.h"
+#include "GUILargeTextureManager.h"
 #include "GUIListItemLayout.h"
 #include "GUIMessage.h"
 #include "ServiceBroker.h"
@@ -38,6 +40,8 @@ using namespace KODI;
 #define HOLD_TIME_END   3000
 #define SCROLLING_GAP   200U
 #define SCROLLING_THRESHOLD 300U
+#define PREFETCH_TIME   1000U // prefetch the rows the list will reach within this time
+#define PREFETCH_PAGES  2     // but never more than this many pages
 
 CGUIBaseContainer::CGUIBaseContainer(int parentID, int controlID, float posX, float posY, float width, float height, ORIENTATION orientation, const CScroller& scroller, int preloadItems)
     : IGUIContainer(parentID, controlID, posX, posY, width, height)
@@ -112,6 +116,8 @@ CGUIBaseContainer::CGUIBaseContainer(const CGUIBaseContainer& other)
 
 CGUIBaseContainer::~CGUIBaseContainer(void)
 {
+  ReleasePrefetch();
+
   // release the container from items
   for (const auto& item : m_items)
     item->FreeMemory();
@@ -159,6 +165,8 @@ void CGUIBaseContainer::Process(unsigned int currentTime, CDirtyRegionList &dirt
   if ((int)m_items.size() > m_itemsPerPage + cacheBefore + cacheAfter)
     FreeMemory(CorrectOffset(offset - cacheBefore, 0), CorrectOffset(offset + m_itemsPerPage + 1 + cacheAfter, 0));
 
+  UpdatePrefetch(offset, cacheBefore, cacheAfter, 1, currentTime);
+
   CPoint origin = CPoint(m_posX, m_posY) + m_renderOffset;
   float pos = (m_orientation == VERTICAL) ? origin.y : origin.x;
   float end = (m_orientation == VERTICAL) ? m_posY + m_height : m_posX + m_width;
@@ -987,6 +995,7 @@ void CGUIBaseContainer::FreeResources(bool immediately)
     }
   }
   m_scroller.Stop();
+  ReleasePrefetch();
 }
 
 void CGUIBaseContainer::UpdateLayout(bool updateAllItems)
@@ -1463,6 +1472,94 @@ int CGUIBaseContainer::GetCurrentPage() const
   return GetOffset() / m_itemsPerPage + 1;
 }
 
+void CGUIBaseContainer::UpdatePrefetch(
+    int offset, int cacheBefore, int cacheAfter, int itemsPerRow, unsigned int currentTime)
+{
+  // stamp the visible rows, then the cached ones, so background loaders fetch their details first
+  for (int row = offset - cacheBefore; row <= offset + m_itemsPerPage + cacheAfter; ++row)
+  {
+    const bool visible = row >= offset && row <= offset + m_itemsPerPage;
+    for (int col = 0; col < itemsPerRow; ++col)
+    {
+      const int itemNo = CorrectOffset(row, col);
+      if (itemNo >= 0 && itemNo < static_cast<int>(m_items.size()))
+        m_items[itemNo]->SetShownTime(visible ? currentTime : currentTime - 1);
+    }
+  }
+
+  const float scrollValue = m_scroller.GetValue();
+  const unsigned int frameTime = currentTime - m_prefetchFrameTime;
+  const float scrollDistance = fabs(scrollValue - m_prefetchScrollValue);
+  m_prefetchScrollValue = scrollValue;
+  m_prefetchFrameTime = currentTime;
+
+  int start = m_prefetchStart;
+  int end = m_prefetchEnd;
+  if (m_scroller.IsScrolling() && frameTime > 0 && frameTime < SCROLLING_THRESHOLD)
+  {
+    // rows per millisecond, extrapolated over the time it takes to decode an image
+    const float speed = scrollDistance / m_layout->Size(m_orientation) / frameTime;
+    const int rows = std::min(MathUtils::round_int(static_cast<double>(speed * PREFETCH_TIME)),
+                              m_itemsPerPage * PREFETCH_PAGES);
+    if (m_scroller.IsScrollingDown())
+    {
+      start = offset + m_itemsPerPage + 1 + cacheAfter;
+      end = start + rows;
+    }
+    else
+    {
+      end = offset - cacheBefore;
+      start = end - rows;
+    }
+    m_prefetchScrollTime = currentTime;
+  }
+  else if (currentTime - m_prefetchScrollTime > PREFETCH_TIME)
+  {
+    // the list has settled, the cached rows cover what is needed now
+    start = end = 0;
+  }
+
+  if (start == m_prefetchStart && end == m_prefetchEnd)
+    return;
+
+  std::vector<std::string> images;
+  for (int row = start; row < end; ++row)
+  {
+    for (int col = 0; col < itemsPerRow; ++col)
+    {
+      const int itemNo = CorrectOffset(row, col);
+      if (itemNo >= 0 && itemNo < static_cast<int>(m_items.size()))
+      {
+        m_layout->GetItemImages(m_items[itemNo].get(), images);
+        m_items[itemNo]->SetShownTime(currentTime - 2);
+      }
+    }
+  }
+
+  // take the new references first so images in both sets are not cancelled in between
+  CGUILargeTextureManager& textureManager = CServiceBroker::GetGUI()->GetLargeTextureManager();
+  for (const auto& image : images)
+    textureManager.PrefetchImage(image);
+  for (const auto& image : m_prefetchImages)
+    textureManager.ReleaseImage(image);
+
+  m_prefetchImages = std::move(images);
+  m_prefetchStart = start;
+  m_prefetchEnd = end;
+}
+
+void CGUIBaseContainer::ReleasePrefetch()
+{
+  if (!m_prefetchImages.empty() && CServiceBroker::GetGUI())
+  {
+    CGUILargeTextureManager& textureManager = CServiceBroker::GetGUI()->GetLargeTextureManager();
+    for (const auto& image : m_prefetchImages)
+      textureManager.ReleaseImage(image);
+  }
+  m_prefetchImages.clear();
+  m_prefetchStart = m_prefetchEnd = 0;
+}
+
 void CGUIBaseContainer::GetCacheOffsets(int &cacheBefore, int &cacheAfter) const
 {
   if (m_scroller.IsScrollingDown())
@@ -19,6 +19,7 @@
 
 #include <list>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -133,6 +134,20 @@ protected:
   int ScrollCorrectionRange() const;
   inline float Size() const;
   void FreeMemory(int keepStart, int keepEnd);
+
+  /*! \brief Prefetch the images of the items the list is scrolling towards
+   Queues the images of the rows following the cached ones in the scroll direction at low priority.
+   The number of rows grows with the scroll speed, and the images are released again once the
+   rows come into view or the list stops scrolling. The visible, cached and prefetched items are
+   stamped with their shown time in that order, see CGUIListItem::SetShownTime.
+   \param offset the first visible row
+   \param cacheBefore the number of rows cached before the visible ones
+   \param cacheAfter the number of rows cached after the visible ones
+   \param itemsPerRow the number of items in each row
+   \param currentTime the time of the current frame
+   */
+  void UpdatePrefetch(int offset, int cacheBefore, int cacheAfter, int itemsPerRow, unsigned int currentTime);
+  void ReleasePrefetch();
   void GetCurrentLayouts();
   CGUIListItemLayout *GetFocusedLayout() const;
 
@@ -235,6 +250,14 @@ private:
 
   bool m_gestureActive = false;
 
+  // images of the items ahead of the scroll direction
+  std::vector<std::string> m_prefetchImages;
+  int m_prefetchStart = 0;
+  int m_prefetchEnd = 0;
+  float m_prefetchScrollValue = 0.0f;
+  unsigned int m_prefetchFrameTime = 0;
+  unsigned int m_prefetchScrollTime = 0;
+
   // early inertial scroll cancellation
   bool m_waitForScrollEnd = false;
   float m_lastScrollValue = 0.0f;
@@ -13,6 +13,7 @@
 #include "GUIControlProfiler.h"
 #include "GUIInfoManager.h"
 #include "GUIMessage.h"
+#include "GUIOcclusionTracker.h"
 #include "GUITexture.h"
 #include "GUIWindowManager.h"
 #include "ServiceBroker.h"
@@ -180,7 +181,7 @@ void CGUIControl::Process(unsigned int currentTime, CDirtyRegionList &dirtyregio
 // 3. reset the animation transform
 void CGUIControl::DoRender()
 {
-  if (IsVisible() && !m_isCulled)
+  if (IsVisible() && !m_isCulled && !m_isOccluded)
   {
     bool hasStereo =
         m_stereo != 0.0f &&
@@ -503,6 +504,28 @@ CRect CGUIControl::CalcRenderRegion() const
   return CRect(tl.x, tl.y, br.x, br.y);
 }
 
+void CGUIControl::UpdateOcclusion(CGUIOcclusionTracker& tracker)
+{
+  m_isOccluded = false;
+  if (!IsVisible() || m_isCulled)
+    return;
+
+  if (tracker.IsCovered(m_renderRegion))
+  {
+    m_isOccluded = true;
+    tracker.AddSkipped(m_renderRegion);
+    return;
+  }
+
+  // the render region is a bounding box, so it is only covered completely if the control is
+  // neither rotated nor skewed nor translucent
+  const bool axisAligned = m_cachedTransform.m[0][1] == 0.0f && m_cachedTransform.m[1][0] == 0.0f &&
+                           m_cachedTransform.m[2][0] == 0.0f && m_cachedTransform.m[2][1] == 0.0f;
+  if (axisAligned && m_cachedTransform.alpha >= 1.0f && !m_hasCamera && m_stereo == 0.0f &&
+      IsOpaque())
+    tracker.AddOccluder(m_renderRegion);
+}
+
 void CGUIControl::SetActions(const ActionMap &actions)
 {
   m_actions = actions;
@@ -24,6 +24,7 @@
 
 class CGUIListItem; // forward
 class CAction;
+class CGUIOcclusionTracker;
 
 class CGUIMessage;
 class CGUIAction;
@@ -196,6 +197,19 @@ public:
    */
   virtual CRect CalcRenderRegion() const;
 
+  /*! \brief Whether the control covers its whole render region with opaque pixels
+   Controls that are completely covered by an opaque control rendered after them are skipped.
+   \sa UpdateOcclusion
+   */
+  virtual bool IsOpaque() const { return false; }
+
+  /*! \brief Check whether the control is hidden behind the opaque controls rendered after it
+   Called once per frame before rendering, in reverse render order. Opaque controls that are not
+   hidden themselves are added to the tracker.
+   \param tracker the opaque controls rendered after this control
+   */
+  virtual void UpdateOcclusion(CGUIOcclusionTracker& tracker);
+
   /*! \brief Set actions to perform on navigation
    \param actions ActionMap of actions
    \sa SetNavigationAction
@@ -382,6 +396,7 @@ protected:
   TransformMatrix m_transform;
   TransformMatrix m_cachedTransform; // Contains the absolute transform the control
   bool m_isCulled{true};
+  bool m_isOccluded{false}; ///< covered by an opaque control, see UpdateOcclusion
 
   static const unsigned int DIRTY_STATE_CONTROL = 1; //This control is dirty
   static const unsigned int DIRTY_STATE_CHILD = 2; //One / more children are dirty
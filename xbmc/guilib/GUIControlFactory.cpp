@@ -908,6 +908,7 @@ CGUIControl* CGUIControlFactory::Create(int parentID,
   int rulerUnit = 12;
   bool useControlCoords = false;
   bool renderFocusedLast = false;
+  bool renderCache = false;
 
   CRect hitRect;
   CPoint camera;
@@ -1169,6 +1170,7 @@ CGUIControl* CGUIControlFactory::Create(int parentID,
 
   XMLUtils::GetBoolean(pControlNode, "usecontrolcoords", useControlCoords);
   XMLUtils::GetBoolean(pControlNode, "renderfocusedlast", renderFocusedLast);
+  XMLUtils::GetBoolean(pControlNode, "rendercache", renderCache);
   XMLUtils::GetBoolean(pControlNode, "resetonlabelchange", resetOnLabelChange);
 
   XMLUtils::GetBoolean(pControlNode, "password", bPassword);
@@ -1257,6 +1259,7 @@ CGUIControl* CGUIControlFactory::Create(int parentID,
         control = new CGUIControlGroup(parentID, id, posX, posY, width, height);
         static_cast<CGUIControlGroup*>(control)->SetDefaultControl(defaultControl, defaultAlways);
         static_cast<CGUIControlGroup*>(control)->SetRenderFocusedLast(renderFocusedLast);
+        static_cast<CGUIControlGroup*>(control)->SetRenderCache(renderCache);
       }
       break;
     }
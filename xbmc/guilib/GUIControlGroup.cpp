@@ -9,6 +9,7 @@
 #include "GUIControlGroup.h"
 
 #include "GUIMessage.h"
+#include "GUIOcclusionTracker.h"
 #include "input/mouse/MouseEvent.h"
 
 #include <cassert>
@@ -41,6 +42,7 @@ CGUIControlGroup::CGUIControlGroup(const CGUIControlGroup &from)
   m_defaultControl = from.m_defaultControl;
   m_defaultAlways = from.m_defaultAlways;
   m_renderFocusedLast = from.m_renderFocusedLast;
+  m_useRenderCache = from.m_useRenderCache;
 
   // run through and add our controls
   for (auto *i : from.m_children)
@@ -69,6 +71,8 @@ void CGUIControlGroup::AllocResources()
 void CGUIControlGroup::FreeResources(bool immediately)
 {
   CGUIControl::FreeResources(immediately);
+  m_renderCache.reset();
+  m_renderCacheValid = false;
   for (auto *control : m_children)
   {
     control->FreeResources(immediately);
@@ -89,6 +93,7 @@ void CGUIControlGroup::Process(unsigned int currentTime, CDirtyRegionList &dirty
   CServiceBroker::GetWinSystem()->GetGfxContext().SetOrigin(pos.x, pos.y);
 
   CRect rect;
+  const size_t groupDirty = dirtyregions.size();
   for (auto *control : m_children)
   {
     control->UpdateVisibility(nullptr);
@@ -98,12 +103,53 @@ void CGUIControlGroup::Process(unsigned int currentTime, CDirtyRegionList &dirty
       rect.Union(control->GetRenderRegion());
   }
 
+  // the cached image is only valid while none of the children changed, moved or faded
+  if (m_renderCacheValid && (groupDirty != dirtyregions.size() || rect != m_renderRegion ||
+                             m_cachedTransform != m_renderCacheTransform))
+    m_renderCacheValid = false;
+
   CServiceBroker::GetWinSystem()->GetGfxContext().RestoreOrigin();
   CGUIControl::Process(currentTime, dirtyregions);
   m_renderRegion = rect;
 }
 
 void CGUIControlGroup::Render()
+{
+  if (m_useRenderCache)
+  {
+    CGraphicContext& gfx = CServiceBroker::GetWinSystem()->GetGfxContext();
+    const bool stereo = gfx.GetStereoMode() != RENDER_STEREO_MODE_OFF &&
+                        gfx.GetStereoMode() != RENDER_STEREO_MODE_MONO;
+    if (!m_renderCache && !stereo)
+    {
+      m_renderCache = CGUIRenderCache::Create();
+      // the render system can't render offscreen
+      if (!m_renderCache)
+        m_useRenderCache = false;
+    }
+
+    if (m_renderCache && !stereo)
+    {
+      if (!m_renderCacheValid && m_renderCache->Begin(m_renderRegion))
+      {
+        RenderChildren();
+        m_renderCache->End();
+        m_renderCacheValid = true;
+        m_renderCacheTransform = m_cachedTransform;
+      }
+      if (m_renderCacheValid)
+      {
+        m_renderCache->Render();
+        return;
+      }
+    }
+    m_renderCacheValid = false;
+  }
+
+  RenderChildren();
+}
+
+void CGUIControlGroup::RenderChildren()
 {
   CPoint pos(GetPosition());
   CServiceBroker::GetWinSystem()->GetGfxContext().SetOrigin(pos.x, pos.y);
@@ -128,6 +174,41 @@ void CGUIControlGroup::RenderEx()
   CGUIControl::RenderEx();
 }
 
+void CGUIControlGroup::UpdateOcclusion(CGUIOcclusionTracker& tracker)
+{
+  CGUIControl::UpdateOcclusion(tracker);
+  if (m_isOccluded || !IsVisible() || m_isCulled)
+    return;
+
+  if (m_useRenderCache)
+  {
+    // the cache has to hold all children, whatever is covering them at the moment
+    CGUIOcclusionTracker disabled;
+    for (auto *control : m_children)
+      control->UpdateOcclusion(disabled);
+    return;
+  }
+
+  // visit the children in reverse order of Render()
+  CGUIControl* focusedControl = nullptr;
+  if (m_renderFocusedLast)
+  {
+    for (auto *control : m_children)
+    {
+      if (control->HasFocus())
+        focusedControl = control;
+    }
+  }
+  if (focusedControl)
+    focusedControl->UpdateOcclusion(tracker);
+
+  for (auto it = m_children.rbegin(); it != m_children.rend(); ++it)
+  {
+    if (!m_renderFocusedLast || !(*it)->HasFocus())
+      (*it)->UpdateOcclusion(tracker);
+  }
+}
+
 bool CGUIControlGroup::OnAction(const CAction &action)
 {
   return false;
@@ -14,7 +14,9 @@
 */
 
 #include "GUIControlLookup.h"
+#include "GUIRenderCache.h"
 
+#include <memory>
 #include <vector>
 
 /*!
@@ -33,6 +35,7 @@ public:
   void Process(unsigned int currentTime, CDirtyRegionList &dirtyregions) override;
   void Render() override;
   void RenderEx() override;
+  void UpdateOcclusion(CGUIOcclusionTracker& tracker) override;
   bool OnAction(const CAction &action) override;
   bool OnMessage(CGUIMessage& message) override;
   virtual bool SendControlMessage(CGUIMessage& message);
@@ -68,6 +71,13 @@ public:
   }
   void SetRenderFocusedLast(bool renderLast) { m_renderFocusedLast = renderLast; }
 
+  /*! \brief Render the group once into an offscreen buffer and draw that buffer as long as none
+   of the children change. Meant for static, layered backgrounds. The buffer is as large as the
+   part of the screen from the left and bottom edges to the group, and controls rendering
+   something new every frame (video, visualisations) must not be part of a cached group.
+   */
+  void SetRenderCache(bool renderCache) { m_useRenderCache = renderCache; }
+
   void SaveStates(std::vector<CControlState> &states) override;
 
   bool IsGroup() const override { return true; }
@@ -89,6 +99,13 @@ protected:
   int m_focusedControl;
   bool m_renderFocusedLast;
 private:
+  void RenderChildren();
+
+  bool m_useRenderCache{false};
+  bool m_renderCacheValid{false};
+  std::unique_ptr<CGUIRenderCache> m_renderCache;
+  TransformMatrix m_renderCacheTransform; ///< transform of the group when the cache was rendered
+
   typedef std::vector< std::vector<CGUIControl *> * > COLLECTORTYPE;
 
   struct IDCollectorList
@@ -12,6 +12,7 @@
 #include "GUIControlProfiler.h"
 #include "GUIFont.h" // for XBFONT_* definitions
 #include "GUIMessage.h"
+#include "GUIOcclusionTracker.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
 #include "input/actions/Action.h"
 #include "input/actions/ActionIDs.h"
@@ -97,6 +98,14 @@ void CGUIControlGroupList::Process(unsigned int currentTime, CDirtyRegionList &d
   CGUIControl::Process(currentTime, dirtyregions);
 }
 
+void CGUIControlGroupList::UpdateOcclusion(CGUIOcclusionTracker& tracker)
+{
+  // our children are clipped to the list, they may only hide each other
+  const size_t occluders = tracker.GetOccluderCount();
+  CGUIControlGroup::UpdateOcclusion(tracker);
+  tracker.RemoveOccluders(occluders);
+}
+
 void CGUIControlGroupList::Render()
 {
   // we run through the controls, rendering as we go
@@ -39,6 +39,7 @@ public:
 
   void Process(unsigned int currentTime, CDirtyRegionList &dirtyregions) override;
   void Render() override;
+  void UpdateOcclusion(CGUIOcclusionTracker& tracker) override;
   bool OnAction(const CAction& action) override;
   bool OnMessage(CGUIMessage& message) override;
 
@@ -7,6 +7,7 @@
  */
 
 #include "GUIFontTTF.h"
+#include "GUIFrameProfiler.h"
 #include "windowing/GraphicContext.h"
 
 #include <stdint.h>
@@ -167,6 +168,7 @@ Value& CGUIFontCacheImpl<Position, Value>::Lookup(const CGraphicContext& context
   {
     // Cache miss
     dirtyCache = true;
+    CGUIFrameProfiler::Count(CGUIFrameProfiler::Phase::FONT_CACHE_MISS);
     std::unique_ptr<CGUIFontCacheEntry<Position, Value>> entry;
 
     if (!m_list.ageMap.empty())
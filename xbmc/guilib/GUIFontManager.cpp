@@ -10,6 +10,7 @@
 
 #include "GUIComponent.h"
 #include "GUIFontTTF.h"
+#include "GUITextLayout.h"
 #include "GUIWindowManager.h"
 #include "addons/AddonManager.h"
 #include "addons/FontResource.h"
@@ -279,6 +280,8 @@ void GUIFontManager::ReloadTTFFonts(void)
   if (m_vecFonts.empty() || !winSystem)
     return; // we haven't even loaded fonts in yet
 
+  CGUITextLayout::ClearLayoutCache();
+
   for (size_t i = 0; i < m_vecFonts.size(); ++i)
   {
     const auto& font = m_vecFonts[i];
@@ -316,6 +319,7 @@ void GUIFontManager::ReloadTTFFonts(void)
 
 void GUIFontManager::Unload(const std::string& strFontName)
 {
+  CGUITextLayout::ClearLayoutCache();
   for (auto iFont = m_vecFonts.begin(); iFont != m_vecFonts.end(); ++iFont)
   {
     if (StringUtils::EqualsNoCase((*iFont)->GetFontName(), strFontName))
@@ -328,6 +332,7 @@ void GUIFontManager::Unload(const std::string& strFontName)
 
 void GUIFontManager::FreeFontFile(CGUIFontTTF* pFont)
 {
+  CGUITextLayout::ClearLayoutCache();
   for (auto it = m_vecFontFiles.begin(); it != m_vecFontFiles.end(); ++it)
   {
     if (pFont == it->get())
@@ -405,6 +410,7 @@ CGUIFont* GUIFontManager::GetDefaultFont(bool border)
 
 void GUIFontManager::Clear()
 {
+  CGUITextLayout::ClearLayoutCache();
   m_vecFonts.clear();
   m_vecFontFiles.clear();
   m_vecFontInfo.clear();
@@ -1022,6 +1022,14 @@ bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character*
         {
           CLog::LogF(LOGDEBUG, "New cache texture is too large ({} > {} pixels long)", newHeight,
                      m_renderSystem->GetMaxTextureSize());
+          // the cache gets cleared now. Make the next texture wider so that fonts with large
+          // character sets (CJK) don't fill it up again with every new page of text.
+          if (m_textureWidth * 2 <= m_renderSystem->GetMaxTextureSize())
+          {
+            m_textureWidth *= 2;
+            m_textureScaleX = 1.0f / m_textureWidth;
+            CLog::LogF(LOGDEBUG, "Increasing cache texture width to {} pixels", m_textureWidth);
+          }
           FT_Done_Glyph(glyph);
           return false;
         }
@@ -1108,10 +1116,10 @@ void CGUIFontTTF::RenderCharacter(CGraphicContext& context,
     context.ClipRect(vertex, texture);
 
   // transform our positions - note, no scaling due to GUI calibration/resolution occurs
-  float x[VERTEX_PER_GLYPH] = {context.ScaleFinalXCoord(vertex.x1, vertex.y1),
-                               context.ScaleFinalXCoord(vertex.x2, vertex.y1),
-                               context.ScaleFinalXCoord(vertex.x2, vertex.y2),
-                               context.ScaleFinalXCoord(vertex.x1, vertex.y2)};
+  float x[VERTEX_PER_GLYPH];
+  float y[VERTEX_PER_GLYPH];
+  float z[VERTEX_PER_GLYPH];
+  context.ScaleFinalQuad(vertex, x, y, z);
 
   if (roundX)
   {
@@ -1138,25 +1146,11 @@ void CGUIFontTTF::RenderCharacter(CGraphicContext& context,
     x[3] = rx3;
   }
 
-  const float y[VERTEX_PER_GLYPH] = {
-      static_cast<float>(MathUtils::round_int(
-          static_cast<double>(context.ScaleFinalYCoord(vertex.x1, vertex.y1)))),
-      static_cast<float>(MathUtils::round_int(
-          static_cast<double>(context.ScaleFinalYCoord(vertex.x2, vertex.y1)))),
-      static_cast<float>(MathUtils::round_int(
-          static_cast<double>(context.ScaleFinalYCoord(vertex.x2, vertex.y2)))),
-      static_cast<float>(MathUtils::round_int(
-          static_cast<double>(context.ScaleFinalYCoord(vertex.x1, vertex.y2))))};
-
-  const float z[VERTEX_PER_GLYPH] = {
-      static_cast<float>(MathUtils::round_int(
-          static_cast<double>(context.ScaleFinalZCoord(vertex.x1, vertex.y1)))),
-      static_cast<float>(MathUtils::round_int(
-          static_cast<double>(context.ScaleFinalZCoord(vertex.x2, vertex.y1)))),
-      static_cast<float>(MathUtils::round_int(
-          static_cast<double>(context.ScaleFinalZCoord(vertex.x2, vertex.y2)))),
-      static_cast<float>(MathUtils::round_int(
-          static_cast<double>(context.ScaleFinalZCoord(vertex.x1, vertex.y2))))};
+  for (int i = 0; i < VERTEX_PER_GLYPH; i++)
+  {
+    y[i] = static_cast<float>(MathUtils::round_int(static_cast<double>(y[i])));
+    z[i] = static_cast<float>(MathUtils::round_int(static_cast<double>(z[i])));
+  }
 
   // tex coords converted to 0..1 range
   const float tl = texture.x1 * m_textureScaleX;
@@ -135,54 +135,36 @@ void CGUIFontTTFGL::LastEnd()
   glEnableVertexAttribArray(colLoc);
   glEnableVertexAttribArray(tex0Loc);
 
+  // Bind our pre-calculated array to GL_ELEMENT_ARRAY_BUFFER
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_elementArrayHandle);
+
   if (!m_vertex.empty())
   {
+    // Deal with vertices that had to use software clipping. They change every frame, so they
+    // go into one stream buffer that is shared by all fonts instead of a new buffer per draw.
+    glBindBuffer(GL_ARRAY_BUFFER, m_streamArrayHandle);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(SVertex) * m_vertex.size(), m_vertex.data(),
+                 GL_STREAM_DRAW);
 
-    // Deal with vertices that had to use software clipping
-    std::vector<SVertex> vecVertices(6 * (m_vertex.size() / 4));
-    SVertex* vertices = &vecVertices[0];
-    for (size_t i = 0; i < m_vertex.size(); i += 4)
-    {
-      *vertices++ = m_vertex[i];
-      *vertices++ = m_vertex[i + 1];
-      *vertices++ = m_vertex[i + 2];
-
-      *vertices++ = m_vertex[i + 1];
-      *vertices++ = m_vertex[i + 3];
-      *vertices++ = m_vertex[i + 2];
-    }
-    vertices = &vecVertices[0];
-
-    GLuint VertexVBO;
-
-    glGenBuffers(1, &VertexVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, VertexVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(SVertex) * vecVertices.size(), &vecVertices[0],
-                 GL_STATIC_DRAW);
-
-    glVertexAttribPointer(posLoc, 3, GL_FLOAT, GL_FALSE, sizeof(SVertex),
-                          reinterpret_cast<const GLvoid*>(offsetof(SVertex, x)));
-    glVertexAttribPointer(colLoc, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SVertex),
-                          reinterpret_cast<const GLvoid*>(offsetof(SVertex, r)));
-    glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, GL_FALSE, sizeof(SVertex),
-                          reinterpret_cast<const GLvoid*>(offsetof(SVertex, u)));
-
-    glDrawArrays(GL_TRIANGLES, 0, vecVertices.size());
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glDeleteBuffers(1, &VertexVBO);
+    DrawQuads(m_vertex.size() / 4, posLoc, colLoc, tex0Loc);
   }
 
   if (!m_vertexTrans.empty())
   {
     // Deal with the vertices that can be hardware clipped and therefore translated
 
-    // Bind our pre-calculated array to GL_ELEMENT_ARRAY_BUFFER
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_elementArrayHandle);
     // Store current scissor
     CGraphicContext& context = winSystem->GetGfxContext();
     CRect scissor = context.StereoCorrection(context.GetScissors());
 
+    // most static labels are drawn untranslated and unclipped, so only touch the scissor and
+    // the model view uniform when they change from one buffer to the next
+    CRect lastClip = scissor;
+    bool translated = false;
+    float lastX = 0.0f;
+    float lastY = 0.0f;
+    float lastZ = 0.0f;
+
     for (size_t i = 0; i < m_vertexTrans.size(); i++)
     {
       if (m_vertexTrans[i].m_vertexBuffer->bufferHandle == 0)
@@ -199,52 +181,48 @@ void CGUIFontTTFGL::LastEnd()
         // skip empty clip
         if (clip.IsEmpty())
           continue;
+      }
+      else
+        clip = scissor;
+      if (clip != lastClip)
+      {
         renderSystem->SetScissors(clip);
+        lastClip = clip;
       }
 
       // Apply the translation to the currently active (top-of-stack) model view matrix
-      glMatrixModview.Push();
-      glMatrixModview.Get().Translatef(m_vertexTrans[i].m_translateX, m_vertexTrans[i].m_translateY,
-                                       m_vertexTrans[i].m_translateZ);
-      glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glMatrixModview.Get());
-
-      // Bind the buffer to the OpenGL context's GL_ARRAY_BUFFER binding point
-      glBindBuffer(GL_ARRAY_BUFFER, m_vertexTrans[i].m_vertexBuffer->bufferHandle);
-
-      // Do the actual drawing operation, split into groups of characters no
-      // larger than the pre-determined size of the element array
-      for (size_t character = 0; m_vertexTrans[i].m_vertexBuffer->size > character;
-           character += ELEMENT_ARRAY_MAX_CHAR_INDEX)
+      const CTranslatedVertices& trans = m_vertexTrans[i];
+      if (!translated || trans.m_translateX != lastX || trans.m_translateY != lastY ||
+          trans.m_translateZ != lastZ)
       {
-        size_t count = m_vertexTrans[i].m_vertexBuffer->size - character;
-        count = std::min<size_t>(count, ELEMENT_ARRAY_MAX_CHAR_INDEX);
-
-        // Set up the offsets of the various vertex attributes within the buffer
-        // object bound to GL_ARRAY_BUFFER
-        glVertexAttribPointer(
-            posLoc, 3, GL_FLOAT, GL_FALSE, sizeof(SVertex),
-            reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, x)));
-        glVertexAttribPointer(
-            colLoc, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SVertex),
-            reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, r)));
-        glVertexAttribPointer(
-            tex0Loc, 2, GL_FLOAT, GL_FALSE, sizeof(SVertex),
-            reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, u)));
-
-        glDrawElements(GL_TRIANGLES, 6 * count, GL_UNSIGNED_SHORT, 0);
+        glMatrixModview.Push();
+        glMatrixModview.Get().Translatef(trans.m_translateX, trans.m_translateY,
+                                         trans.m_translateZ);
+        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glMatrixModview.Get());
+        glMatrixModview.Pop();
+        translated = true;
+        lastX = trans.m_translateX;
+        lastY = trans.m_translateY;
+        lastZ = trans.m_translateZ;
       }
 
-      glMatrixModview.Pop();
+      // Bind the buffer to the OpenGL context's GL_ARRAY_BUFFER binding point
+      glBindBuffer(GL_ARRAY_BUFFER, trans.m_vertexBuffer->bufferHandle);
+
+      DrawQuads(trans.m_vertexBuffer->size, posLoc, colLoc, tex0Loc);
     }
     // Restore the original scissor rectangle
-    renderSystem->SetScissors(scissor);
+    if (lastClip != scissor)
+      renderSystem->SetScissors(scissor);
     // Restore the original model view matrix
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glMatrixModview.Get());
-    // Unbind GL_ARRAY_BUFFER and GL_ELEMENT_ARRAY_BUFFER
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    if (translated)
+      glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glMatrixModview.Get());
   }
 
+  // Unbind GL_ARRAY_BUFFER and GL_ELEMENT_ARRAY_BUFFER
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
   // Disable the attributes used by this shader
   glDisableVertexAttribArray(posLoc);
   glDisableVertexAttribArray(colLoc);
@@ -253,6 +231,29 @@ void CGUIFontTTFGL::LastEnd()
   renderSystem->DisableShader();
 }
 
+void CGUIFontTTFGL::DrawQuads(size_t quads, GLint posLoc, GLint colLoc, GLint tex0Loc)
+{
+  for (size_t character = 0; quads > character; character += ELEMENT_ARRAY_MAX_CHAR_INDEX)
+  {
+    size_t count = quads - character;
+    count = std::min<size_t>(count, ELEMENT_ARRAY_MAX_CHAR_INDEX);
+
+    // Set up the offsets of the various vertex attributes within the buffer
+    // object bound to GL_ARRAY_BUFFER
+    glVertexAttribPointer(
+        posLoc, 3, GL_FLOAT, GL_FALSE, sizeof(SVertex),
+        reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, x)));
+    glVertexAttribPointer(
+        colLoc, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SVertex),
+        reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, r)));
+    glVertexAttribPointer(
+        tex0Loc, 2, GL_FLOAT, GL_FALSE, sizeof(SVertex),
+        reinterpret_cast<GLvoid*>(character * sizeof(SVertex) * 4 + offsetof(SVertex, u)));
+
+    glDrawElements(GL_TRIANGLES, 6 * count, GL_UNSIGNED_SHORT, 0);
+  }
+}
+
 CVertexBuffer CGUIFontTTFGL::CreateVertexBuffer(const std::vector<SVertex>& vertices) const
 {
   assert(vertices.size() % 4 == 0);
@@ -413,6 +414,8 @@ void CGUIFontTTFGL::CreateStaticVertexBuffers(void)
 
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof index, index, GL_STATIC_DRAW);
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+  glGenBuffers(1, &m_streamArrayHandle);
   m_staticVertexBufferCreated = true;
 }
 
@@ -422,8 +425,10 @@ void CGUIFontTTFGL::DestroyStaticVertexBuffers(void)
     return;
 
   glDeleteBuffers(1, &m_elementArrayHandle);
+  glDeleteBuffers(1, &m_streamArrayHandle);
   m_staticVertexBufferCreated = false;
 }
 
 GLuint CGUIFontTTFGL::m_elementArrayHandle{0};
+GLuint CGUIFontTTFGL::m_streamArrayHandle{0};
 bool CGUIFontTTFGL::m_staticVertexBufferCreated{false};
@@ -39,8 +39,15 @@ protected:
   void DeleteHardwareTexture() override;
 
   static GLuint m_elementArrayHandle;
+  static GLuint m_streamArrayHandle; ///< reused every frame for the software clipped vertices
 
 private:
+  /*!
+   \brief Draw quads from the bound GL_ARRAY_BUFFER using the shared element array, split into
+   groups no larger than the element array.
+   */
+  static void DrawQuads(size_t quads, GLint posLoc, GLint colLoc, GLint tex0Loc);
+
   unsigned int m_updateY1{0};
   unsigned int m_updateY2{0};
 
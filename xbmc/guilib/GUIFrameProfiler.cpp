@@ -0,0 +1,162 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFrameProfiler.h"
+
+#include "utils/TimeUtils.h"
+#include "utils/Variant.h"
+
+#include <mutex>
+
+namespace
+{
+const char* const PHASE_NAMES[] = {
+    "Process", "Render", "Dirty regions", "Texture upload", "Font cache miss", "Info evaluation",
+};
+static_assert(sizeof(PHASE_NAMES) / sizeof(PHASE_NAMES[0]) ==
+                  static_cast<size_t>(CGUIFrameProfiler::Phase::COUNT),
+              "missing phase name");
+
+constexpr int TRACE_PID = 1;
+constexpr int FRAME_TID = 1;
+
+CVariant TraceEvent(const char* name, int tid, double ts, double dur)
+{
+  CVariant event(CVariant::VariantTypeObject);
+  event["name"] = name;
+  event["ph"] = "X";
+  event["pid"] = TRACE_PID;
+  event["tid"] = tid;
+  event["ts"] = ts;
+  event["dur"] = dur;
+  return event;
+}
+
+CVariant ThreadName(const char* name, int tid)
+{
+  CVariant event(CVariant::VariantTypeObject);
+  event["name"] = "thread_name";
+  event["ph"] = "M";
+  event["pid"] = TRACE_PID;
+  event["tid"] = tid;
+  event["args"]["name"] = name;
+  return event;
+}
+} // unnamed namespace
+
+std::atomic<bool> CGUIFrameProfiler::m_enabled{false};
+
+CGUIFrameProfiler::CScope::CScope(Phase phase) : m_phase(phase)
+{
+  if (IsEnabled())
+    m_start = CurrentHostCounter();
+}
+
+CGUIFrameProfiler::CScope::~CScope()
+{
+  if (m_start && IsEnabled())
+    GetInstance().AddTime(m_phase, m_start, CurrentHostCounter() - m_start);
+}
+
+CGUIFrameProfiler& CGUIFrameProfiler::GetInstance()
+{
+  static CGUIFrameProfiler profiler;
+  return profiler;
+}
+
+void CGUIFrameProfiler::SetEnabled(bool enabled)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  if (enabled && !IsEnabled())
+  {
+    m_frames.clear();
+    m_frames.reserve(MAX_FRAMES);
+    m_next = 0;
+    m_frameOpen = false;
+  }
+  m_enabled = enabled;
+}
+
+void CGUIFrameProfiler::NewFrame()
+{
+  const int64_t now = CurrentHostCounter();
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  if (m_frameOpen)
+  {
+    m_current.duration = now - m_current.start;
+    if (m_frames.size() < MAX_FRAMES)
+      m_frames.push_back(m_current);
+    else
+      m_frames[m_next] = m_current;
+    m_next = (m_next + 1) % MAX_FRAMES;
+  }
+
+  m_current = Frame();
+  m_current.start = now;
+  m_frameOpen = true;
+}
+
+void CGUIFrameProfiler::AddTime(Phase phase, int64_t start, int64_t duration)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  if (!m_frameOpen)
+    return;
+
+  PhaseStats& stats = m_current.phases[static_cast<size_t>(phase)];
+  if (!stats.count)
+    stats.start = start;
+  stats.duration += duration;
+  stats.count++;
+}
+
+void CGUIFrameProfiler::Count(Phase phase)
+{
+  if (IsEnabled())
+    GetInstance().AddTime(phase, CurrentHostCounter(), 0);
+}
+
+void CGUIFrameProfiler::GetTrace(CVariant& trace) const
+{
+  trace = CVariant(CVariant::VariantTypeObject);
+  trace["displayTimeUnit"] = "ms";
+  CVariant& events = trace["traceEvents"];
+  events = CVariant(CVariant::VariantTypeArray);
+
+  events.push_back(ThreadName("Frame", FRAME_TID));
+  for (size_t i = 0; i < static_cast<size_t>(Phase::COUNT); ++i)
+    events.push_back(ThreadName(PHASE_NAMES[i], FRAME_TID + 1 + static_cast<int>(i)));
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  if (m_frames.empty())
+    return;
+
+  // oldest frame first, timestamps in microseconds relative to it
+  const size_t first = m_frames.size() < MAX_FRAMES ? 0 : m_next;
+  const int64_t origin = m_frames[first].start;
+  const double scale = 1000000.0 / CurrentHostFrequency();
+
+  for (size_t n = 0; n < m_frames.size(); ++n)
+  {
+    const Frame& frame = m_frames[(first + n) % m_frames.size()];
+    events.push_back(TraceEvent("Frame", FRAME_TID, (frame.start - origin) * scale,
+                                frame.duration * scale));
+
+    for (size_t i = 0; i < frame.phases.size(); ++i)
+    {
+      const PhaseStats& stats = frame.phases[i];
+      if (!stats.count)
+        continue;
+
+      CVariant event = TraceEvent(PHASE_NAMES[i], FRAME_TID + 1 + static_cast<int>(i),
+                                  (stats.start - origin) * scale, stats.duration * scale);
+      event["args"]["count"] = stats.count;
+      events.push_back(std::move(event));
+    }
+  }
+}
@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+class CVariant;
+
+/*!
+ * \brief Records per frame timings of the GUI into a ring buffer of the last frames.
+ *
+ * The profiler is off by default. While it is disabled each instrumentation point costs a
+ * single relaxed atomic load. The recorded frames can be exported as a Chrome trace (which
+ * Perfetto reads as well), with one track per phase.
+ */
+class CGUIFrameProfiler
+{
+public:
+  enum class Phase
+  {
+    PROCESS = 0,
+    RENDER,
+    DIRTY_REGIONS,
+    TEXTURE_UPLOAD,
+    FONT_CACHE_MISS,
+    INFO_EVALUATION,
+    COUNT
+  };
+
+  /*!
+   * \brief Adds the time between construction and destruction to a phase of the current frame.
+   */
+  class CScope
+  {
+  public:
+    explicit CScope(Phase phase);
+    ~CScope();
+
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+
+  private:
+    Phase m_phase;
+    int64_t m_start = 0;
+  };
+
+  static CGUIFrameProfiler& GetInstance();
+
+  static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+  /*!
+   * \brief Start or stop recording. Starting drops all previously recorded frames.
+   */
+  void SetEnabled(bool enabled);
+
+  /*!
+   * \brief Close the current frame and open a new one. Called once per frame before processing.
+   */
+  void NewFrame();
+
+  void AddTime(Phase phase, int64_t start, int64_t duration);
+
+  //! \brief Count an event without a duration, e.g. a font cache miss
+  static void Count(Phase phase);
+
+  /*!
+   * \brief Export the recorded frames in the Chrome trace event format.
+   * \param[out] trace object holding traceEvents and displayTimeUnit
+   */
+  void GetTrace(CVariant& trace) const;
+
+private:
+  CGUIFrameProfiler() = default;
+  CGUIFrameProfiler(const CGUIFrameProfiler&) = delete;
+  CGUIFrameProfiler& operator=(const CGUIFrameProfiler&) = delete;
+
+  struct PhaseStats
+  {
+    int64_t start = 0;
+    int64_t duration = 0;
+    unsigned int count = 0;
+  };
+
+  struct Frame
+  {
+    int64_t start = 0;
+    int64_t duration = 0;
+    std::array<PhaseStats, static_cast<size_t>(Phase::COUNT)> phases;
+  };
+
+  static constexpr size_t MAX_FRAMES = 600;
+
+  static std::atomic<bool> m_enabled;
+
+  mutable CCriticalSection m_section;
+  std::vector<Frame> m_frames; ///< ring buffer of finished frames
+  size_t m_next = 0;
+  Frame m_current;
+  bool m_frameOpen = false;
+};
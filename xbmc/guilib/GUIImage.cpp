@@ -9,6 +9,7 @@
 #include "GUIImage.h"
 
 #include "GUIMessage.h"
+#include "TextureManager.h"
 #include "utils/log.h"
 
 #include <cassert>
@@ -87,6 +88,22 @@ void CGUIImage::UpdateInfo(const CGUIListItem *item)
     SetFileName(m_info.GetLabel(m_parentID, true, &m_currentFallback));
 }
 
+std::string CGUIImage::GetItemFileName(const CGUIListItem* item) const
+{
+  if (!item || m_info.IsConstant())
+    return "";
+
+  std::string fallback;
+  std::string fileName = m_info.GetItemLabel(item, true, &fallback);
+  if (fileName.empty())
+    fileName = fallback;
+
+  // skin images are loaded synchronously by the texture manager
+  if (fileName.empty() || (!m_texture->IsLazyLoaded() && CGUITextureManager::CanLoad(fileName)))
+    return "";
+  return fileName;
+}
+
 void CGUIImage::AllocateOnDemand()
 {
   // if we're hidden, we can free our resources and return
@@ -310,6 +327,11 @@ CRect CGUIImage::CalcRenderRegion() const
   return CGUIControl::CalcRenderRegion().Intersect(region);
 }
 
+bool CGUIImage::IsOpaque() const
+{
+  return m_fadingTextures.empty() && m_texture->IsOpaque();
+}
+
 const std::string &CGUIImage::GetFileName() const
 {
   return m_texture->GetFileName();
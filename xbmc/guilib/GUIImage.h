@@ -80,10 +80,18 @@ public:
   void SetCrossFade(unsigned int time);
 
   const std::string& GetFileName() const;
+
+  /*!
+   * \brief Get the image this control would show for an item, without changing what it shows now
+   * \param item the item to resolve the image for
+   * \return the path of the image if it is loaded in the background, empty otherwise
+   */
+  std::string GetItemFileName(const CGUIListItem* item) const;
   float GetTextureWidth() const;
   float GetTextureHeight() const;
 
   CRect CalcRenderRegion() const override;
+  bool IsOpaque() const override;
 
 #ifdef _DEBUG
   void DumpTextureUse() override;
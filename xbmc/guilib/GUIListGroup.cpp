@@ -8,6 +8,7 @@
 
 #include "GUIListGroup.h"
 
+#include "GUIImage.h"
 #include "GUIListLabel.h"
 #include "utils/log.h"
 
@@ -237,3 +238,18 @@ void CGUIListGroup::SelectItemFromPoint(const CPoint &point)
       static_cast<CGUIListGroup*>(child)->SelectItemFromPoint(point);
   }
 }
+
+void CGUIListGroup::GetItemImages(const CGUIListItem* item, std::vector<std::string>& paths) const
+{
+  for (const auto* control : m_children)
+  {
+    if (control->GetControlType() == CGUIControl::GUICONTROL_IMAGE)
+    {
+      std::string path = static_cast<const CGUIImage*>(control)->GetItemFileName(item);
+      if (!path.empty())
+        paths.emplace_back(std::move(path));
+    }
+    else if (control->GetControlType() == CGUIControl::GUICONTROL_LISTGROUP)
+      static_cast<const CGUIListGroup*>(control)->GetItemImages(item, paths);
+  }
+}
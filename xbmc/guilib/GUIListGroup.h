@@ -15,6 +15,9 @@
 
 #include "GUIControlGroup.h"
 
+#include <string>
+#include <vector>
+
 /*!
  \ingroup controls
  \brief a group of controls within a list/panel container
@@ -44,6 +47,13 @@ public:
   void SetState(bool selected, bool focused);
   void SelectItemFromPoint(const CPoint &point);
 
+  /*!
+   \brief Collect the background loaded images that the controls of this group show for an item
+   \param item the item to resolve the images for
+   \param paths [out] the paths of the images are appended to this
+   */
+  void GetItemImages(const CGUIListItem* item, std::vector<std::string>& paths) const;
+
 protected:
   const CGUIListItem *m_item;
 };
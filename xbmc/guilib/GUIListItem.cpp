@@ -14,6 +14,7 @@
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 
+#include <algorithm>
 #include <utility>
 
 bool CGUIListItem::icompare::operator()(const std::string &s1, const std::string &s2) const
@@ -21,6 +22,16 @@ bool CGUIListItem::icompare::operator()(const std::string &s1, const std::string
   return StringUtils::CompareNoCase(s1, s2) < 0;
 }
 
+namespace
+{
+template<typename Iterator>
+Iterator LowerBoundNoCase(Iterator first, Iterator last, const std::string& key)
+{
+  return std::lower_bound(first, last, key, [](const auto& property, const std::string& value)
+                          { return StringUtils::CompareNoCase(property.first, value) < 0; });
+}
+} // unnamed namespace
+
 CGUIListItem::CGUIListItem(const CGUIListItem& item)
 {
   *this = item;
@@ -348,12 +359,29 @@ void CGUIListItem::SetInvalid()
   if (m_focusedLayout) m_focusedLayout->SetInvalid();
 }
 
+CGUIListItem::PropertyMap::iterator CGUIListItem::FindProperty(const std::string& strKey)
+{
+  auto iter = LowerBoundNoCase(m_mapProperties.begin(), m_mapProperties.end(), strKey);
+  if (iter != m_mapProperties.end() && StringUtils::EqualsNoCase(iter->first, strKey))
+    return iter;
+  return m_mapProperties.end();
+}
+
+CGUIListItem::PropertyMap::const_iterator CGUIListItem::FindProperty(
+    const std::string& strKey) const
+{
+  auto iter = LowerBoundNoCase(m_mapProperties.begin(), m_mapProperties.end(), strKey);
+  if (iter != m_mapProperties.end() && StringUtils::EqualsNoCase(iter->first, strKey))
+    return iter;
+  return m_mapProperties.end();
+}
+
 void CGUIListItem::SetProperty(const std::string &strKey, const CVariant &value)
 {
-  PropertyMap::iterator iter = m_mapProperties.find(strKey);
-  if (iter == m_mapProperties.end())
+  auto iter = LowerBoundNoCase(m_mapProperties.begin(), m_mapProperties.end(), strKey);
+  if (iter == m_mapProperties.end() || !StringUtils::EqualsNoCase(iter->first, strKey))
   {
-    m_mapProperties.insert(make_pair(strKey, value));
+    m_mapProperties.emplace(iter, strKey, value);
     SetInvalid();
   }
   else if (iter->second != value)
@@ -365,7 +393,7 @@ void CGUIListItem::SetProperty(const std::string &strKey, const CVariant &value)
 
 const CVariant &CGUIListItem::GetProperty(const std::string &strKey) const
 {
-  PropertyMap::const_iterator iter = m_mapProperties.find(strKey);
+  PropertyMap::const_iterator iter = FindProperty(strKey);
   static CVariant nullVariant = CVariant(CVariant::VariantTypeNull);
 
   if (iter == m_mapProperties.end())
@@ -376,7 +404,7 @@ const CVariant &CGUIListItem::GetProperty(const std::string &strKey) const
 
 bool CGUIListItem::HasProperty(const std::string &strKey) const
 {
-  PropertyMap::const_iterator iter = m_mapProperties.find(strKey);
+  PropertyMap::const_iterator iter = FindProperty(strKey);
   if (iter == m_mapProperties.end())
     return false;
 
@@ -385,7 +413,7 @@ bool CGUIListItem::HasProperty(const std::string &strKey) const
 
 void CGUIListItem::ClearProperty(const std::string &strKey)
 {
-  PropertyMap::iterator iter = m_mapProperties.find(strKey);
+  PropertyMap::iterator iter = FindProperty(strKey);
   if (iter != m_mapProperties.end())
   {
     m_mapProperties.erase(iter);
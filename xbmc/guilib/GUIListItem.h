@@ -13,14 +13,18 @@
 \brief
 */
 
+#include "utils/Variant.h"
+
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 //  Forward
 class CGUIListItemLayout;
 class CArchive;
-class CVariant;
 
 /*!
  \ingroup controls
@@ -174,6 +178,17 @@ public:
    */
   unsigned int GetCurrentItem() const;
 
+  /*! \brief Set the frame time a container last showed the item at
+   Background loaders fetch the details of the most recently shown items first. Items that are
+   about to be shown are stamped slightly earlier than the ones that are already visible.
+   \param time the frame time
+   */
+  void SetShownTime(unsigned int time) { m_shownTime.store(time, std::memory_order_relaxed); }
+
+  /*! \brief Get the frame time a container last showed the item at, 0 if it was never shown
+   */
+  unsigned int GetShownTime() const { return m_shownTime.load(std::memory_order_relaxed); }
+
 protected:
   std::string m_strLabel2;     // text of column2
   GUIIconOverlay m_overlayIcon; // type of overlay icon
@@ -188,13 +203,22 @@ protected:
     bool operator()(const std::string &s1, const std::string &s2) const;
   };
 
-  typedef std::map<std::string, CVariant, icompare> PropertyMap;
+  /*! \brief Properties sorted by key using icompare.
+   Items usually carry a handful of properties, a flat vector needs a single allocation for all of
+   them where a map needs one per property.
+   */
+  typedef std::vector<std::pair<std::string, CVariant>> PropertyMap;
   PropertyMap m_mapProperties;
+
+  PropertyMap::iterator FindProperty(const std::string& strKey);
+  PropertyMap::const_iterator FindProperty(const std::string& strKey) const;
 private:
   std::wstring m_sortLabel;    // text for sorting. Need to be UTF16 for proper sorting
   std::string m_strLabel;      // text of column1
 
   ArtMap m_art;
   ArtMap m_artFallbacks;
+
+  std::atomic<unsigned int> m_shownTime{0}; // read by background loaders
 };
 
@@ -44,6 +44,10 @@ public:
   void SelectItemFromPoint(const CPoint &point);
   bool MoveLeft();
   bool MoveRight();
+  void GetItemImages(const CGUIListItem* item, std::vector<std::string>& paths) const
+  {
+    m_group.GetItemImages(item, paths);
+  }
 
 #ifdef _DEBUG
   void DumpTextureUse();
@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIOcclusionTracker.h"
+
+#include <algorithm>
+
+void CGUIOcclusionTracker::Reset(const CDirtyRegionList& passes, float screenArea, bool enabled)
+{
+  m_enabled = enabled;
+  m_occluders.clear();
+  m_skipped.clear();
+  m_passes = passes;
+
+  m_stats = Stats();
+  m_stats.screenArea = screenArea;
+  for (const auto& pass : m_passes)
+    m_stats.renderedArea += pass.Area();
+}
+
+bool CGUIOcclusionTracker::IsCovered(const CRect& region) const
+{
+  if (!m_enabled || region.IsEmpty())
+    return false;
+
+  return std::any_of(m_occluders.begin(), m_occluders.end(),
+                     [&region](const CRect& occluder)
+                     {
+                       return occluder.x1 <= region.x1 && occluder.y1 <= region.y1 &&
+                              occluder.x2 >= region.x2 && occluder.y2 >= region.y2;
+                     });
+}
+
+void CGUIOcclusionTracker::AddOccluder(const CRect& region)
+{
+  if (m_enabled && !region.IsEmpty())
+    m_occluders.push_back(region);
+}
+
+void CGUIOcclusionTracker::RemoveOccluders(size_t count)
+{
+  if (count < m_occluders.size())
+    m_occluders.resize(count);
+}
+
+void CGUIOcclusionTracker::AddSkipped(const CRect& region)
+{
+  m_skipped.push_back(region);
+  m_stats.skippedControls++;
+  for (const auto& pass : m_passes)
+    m_stats.skippedArea += CRect(region).Intersect(pass).Area();
+}
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "DirtyRegion.h"
+
+#include <vector>
+
+/*!
+ \ingroup controls
+ \brief Tracks the opaque controls of a frame so that controls hidden behind them can be skipped.
+
+ The controls are visited from the last rendered to the first. Each control checks whether an
+ opaque control visited before it, i.e. rendered on top of it, covers its whole render region,
+ and registers itself as an occluder if it is opaque.
+ \sa CGUIControl::UpdateOcclusion
+ */
+class CGUIOcclusionTracker
+{
+public:
+  struct Stats
+  {
+    float screenArea = 0.0f; ///< area of the viewport
+    float renderedArea = 0.0f; ///< area of all render passes of the frame
+    float skippedArea = 0.0f; ///< area of the render passes covered by skipped controls
+    unsigned int skippedControls = 0;
+  };
+
+  /*!
+   \brief Start a new frame.
+   \param passes the regions that are rendered this frame, used for the statistics
+   \param screenArea area of the viewport
+   \param enabled whether controls may be skipped this frame
+   */
+  void Reset(const CDirtyRegionList& passes, float screenArea, bool enabled);
+
+  /*!
+   \brief Whether a region is covered by a single occluder registered so far.
+   */
+  bool IsCovered(const CRect& region) const;
+
+  void AddOccluder(const CRect& region);
+  size_t GetOccluderCount() const { return m_occluders.size(); }
+
+  /*!
+   \brief Drop the occluders registered after the first count ones, e.g. the children of a control
+   that clips them.
+   */
+  void RemoveOccluders(size_t count);
+
+  //! \brief Record a control that is skipped because it is covered
+  void AddSkipped(const CRect& region);
+
+  const Stats& GetStats() const { return m_stats; }
+  const std::vector<CRect>& GetSkippedRegions() const { return m_skipped; }
+
+private:
+  bool m_enabled = false;
+  std::vector<CRect> m_occluders;
+  std::vector<CRect> m_skipped;
+  CDirtyRegionList m_passes;
+  Stats m_stats;
+};
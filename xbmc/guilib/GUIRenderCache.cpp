@@ -0,0 +1,24 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIRenderCache.h"
+
+CreateGUIRenderCacheFunc CGUIRenderCache::m_createFunc;
+
+void CGUIRenderCache::Register(const CreateGUIRenderCacheFunc& createFunction)
+{
+  m_createFunc = createFunction;
+}
+
+std::unique_ptr<CGUIRenderCache> CGUIRenderCache::Create()
+{
+  if (!m_createFunc)
+    return nullptr;
+
+  return std::unique_ptr<CGUIRenderCache>(m_createFunc());
+}
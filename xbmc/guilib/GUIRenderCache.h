@@ -0,0 +1,60 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/Geometry.h"
+
+#include <functional>
+#include <memory>
+
+class CGUIRenderCache;
+
+using CreateGUIRenderCacheFunc = std::function<CGUIRenderCache*()>;
+
+/*!
+ \ingroup controls
+ \brief Offscreen copy of what a control rendered, which can be drawn again instead of rendering
+ the control.
+
+ Render systems that can render to a texture register an implementation, see Register(). The
+ cached image covers a region in screen coordinates and is drawn at the same place, so it is only
+ valid as long as the control doesn't change or move.
+ */
+class CGUIRenderCache
+{
+public:
+  virtual ~CGUIRenderCache() = default;
+
+  static void Register(const CreateGUIRenderCacheFunc& createFunction);
+
+  /*!
+   \brief Create a render cache for the current render system.
+   \return the cache, or nullptr if the render system can't render offscreen
+   */
+  static std::unique_ptr<CGUIRenderCache> Create();
+
+  /*!
+   \brief Redirect all following rendering into the cache.
+   \param region the region in screen coordinates to cache
+   \return false if rendering can't be cached, in which case End() must not be called
+   */
+  virtual bool Begin(const CRect& region) = 0;
+
+  //! \brief Stop rendering into the cache
+  virtual void End() = 0;
+
+  //! \brief Draw the cached image at the region passed to the last Begin()
+  virtual void Render() = 0;
+
+  //! \brief Release the offscreen buffer
+  virtual void Free() = 0;
+
+private:
+  static CreateGUIRenderCacheFunc m_createFunc;
+};
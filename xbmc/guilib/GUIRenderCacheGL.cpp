@@ -0,0 +1,164 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIRenderCacheGL.h"
+
+#include "ServiceBroker.h"
+#include "rendering/gl/RenderSystemGL.h"
+#include "utils/GLUtils.h"
+#include "windowing/GraphicContext.h"
+#include "windowing/WinSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+void CGUIRenderCacheGL::Register()
+{
+  CGUIRenderCache::Register([]() { return new CGUIRenderCacheGL(); });
+}
+
+CGUIRenderCacheGL::~CGUIRenderCacheGL()
+{
+  Free();
+}
+
+bool CGUIRenderCacheGL::Begin(const CRect& region)
+{
+  CGraphicContext& gfx = CServiceBroker::GetWinSystem()->GetGfxContext();
+  const int screenWidth = gfx.GetWidth();
+  const int screenHeight = gfx.GetHeight();
+
+  // The buffer starts at the bottom left corner of the screen, so the GUI can render into it with
+  // the viewport, scissors and projection of the screen. It only has to reach the region.
+  const int width = std::min(static_cast<int>(std::ceil(region.x2)), screenWidth);
+  const int height = std::min(screenHeight - static_cast<int>(std::floor(region.y1)), screenHeight);
+  if (region.IsEmpty() || width <= 0 || height <= 0)
+    return false;
+
+  if (!m_fbo.IsBound() || width != m_fboWidth || height != m_fboHeight)
+  {
+    m_fbo.Cleanup();
+    if (!m_fbo.Initialize() ||
+        !m_fbo.CreateAndBindToTexture(GL_TEXTURE_2D, width, height, GL_RGBA, GL_UNSIGNED_BYTE,
+                                      GL_NEAREST))
+    {
+      m_fbo.Cleanup();
+      return false;
+    }
+    m_fboWidth = width;
+    m_fboHeight = height;
+  }
+
+  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &m_previousFramebuffer);
+  if (!m_fbo.BeginRender())
+    return false;
+
+  m_region = region;
+
+  // everything in the region has to end up in the cache, not only what this pass renders
+  m_scissors = gfx.GetScissors();
+  gfx.ResetScissors();
+
+  glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+  glClear(GL_COLOR_BUFFER_BIT);
+  return true;
+}
+
+void CGUIRenderCacheGL::End()
+{
+  glBindFramebuffer(GL_FRAMEBUFFER, m_previousFramebuffer);
+  CServiceBroker::GetWinSystem()->GetGfxContext().SetScissors(m_scissors);
+}
+
+void CGUIRenderCacheGL::Render()
+{
+  if (!m_fbo.IsBound())
+    return;
+
+  CRenderSystemGL* renderSystem = dynamic_cast<CRenderSystemGL*>(CServiceBroker::GetRenderSystem());
+  const float screenHeight =
+      static_cast<float>(CServiceBroker::GetWinSystem()->GetGfxContext().GetHeight());
+
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, m_fbo.Texture());
+
+  // the GUI blends colors by their alpha into the buffer, so the cached image is premultiplied
+  glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+  glEnable(GL_BLEND);
+
+  renderSystem->EnableShader(ShaderMethodGL::SM_TEXTURE);
+
+  GLint posLoc = renderSystem->ShaderGetPos();
+  GLint tex0Loc = renderSystem->ShaderGetCoord0();
+  GLint uniColLoc = renderSystem->ShaderGetUniCol();
+
+  glUniform4f(uniColLoc, 1.0f, 1.0f, 1.0f, 1.0f);
+
+  struct PackedVertex
+  {
+    float x, y, z;
+    float u1, v1;
+  } vertex[4];
+  GLubyte idx[4] = {0, 1, 3, 2}; //determines order of the vertices
+
+  // rows of the buffer are counted from the bottom of the screen
+  const float u1 = m_region.x1 / m_fboWidth;
+  const float u2 = m_region.x2 / m_fboWidth;
+  const float v1 = (screenHeight - m_region.y1) / m_fboHeight;
+  const float v2 = (screenHeight - m_region.y2) / m_fboHeight;
+
+  vertex[0] = {m_region.x1, m_region.y1, 0.0f, u1, v1};
+  vertex[1] = {m_region.x2, m_region.y1, 0.0f, u2, v1};
+  vertex[2] = {m_region.x2, m_region.y2, 0.0f, u2, v2};
+  vertex[3] = {m_region.x1, m_region.y2, 0.0f, u1, v2};
+
+  if (!m_vertexBuffer)
+  {
+    glGenBuffers(1, &m_vertexBuffer);
+    glGenBuffers(1, &m_indexBuffer);
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex) * 4, &vertex[0], GL_STREAM_DRAW);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLubyte) * 4, idx, GL_STREAM_DRAW);
+
+  glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(PackedVertex),
+                        reinterpret_cast<const GLvoid*>(offsetof(PackedVertex, x)));
+  glEnableVertexAttribArray(posLoc);
+  glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(PackedVertex),
+                        reinterpret_cast<const GLvoid*>(offsetof(PackedVertex, u1)));
+  glEnableVertexAttribArray(tex0Loc);
+
+  glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_BYTE, 0);
+
+  glDisableVertexAttribArray(posLoc);
+  glDisableVertexAttribArray(tex0Loc);
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  renderSystem->DisableShader();
+  VerifyGLState();
+}
+
+void CGUIRenderCacheGL::Free()
+{
+  m_fbo.Cleanup();
+  m_fboWidth = 0;
+  m_fboHeight = 0;
+
+  if (m_vertexBuffer)
+  {
+    glDeleteBuffers(1, &m_vertexBuffer);
+    glDeleteBuffers(1, &m_indexBuffer);
+    m_vertexBuffer = 0;
+    m_indexBuffer = 0;
+  }
+}
@@ -0,0 +1,37 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "GUIRenderCache.h"
+#include "cores/VideoPlayer/VideoRenderers/FrameBufferObject.h"
+
+#include "system_gl.h"
+
+class CGUIRenderCacheGL : public CGUIRenderCache
+{
+public:
+  static void Register();
+
+  ~CGUIRenderCacheGL() override;
+
+  bool Begin(const CRect& region) override;
+  void End() override;
+  void Render() override;
+  void Free() override;
+
+private:
+  CFrameBufferObject m_fbo;
+  int m_fboWidth = 0;
+  int m_fboHeight = 0;
+  CRect m_region;
+  CRect m_scissors;
+  GLint m_previousFramebuffer = 0;
+  GLuint m_vertexBuffer = 0;
+  GLuint m_indexBuffer = 0;
+};
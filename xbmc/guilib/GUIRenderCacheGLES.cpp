@@ -0,0 +1,139 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIRenderCacheGLES.h"
+
+#include "ServiceBroker.h"
+#include "rendering/gles/RenderSystemGLES.h"
+#include "utils/GLUtils.h"
+#include "windowing/GraphicContext.h"
+#include "windowing/WinSystem.h"
+
+#include <algorithm>
+#include <cmath>
+
+void CGUIRenderCacheGLES::Register()
+{
+  CGUIRenderCache::Register([]() { return new CGUIRenderCacheGLES(); });
+}
+
+CGUIRenderCacheGLES::~CGUIRenderCacheGLES()
+{
+  Free();
+}
+
+bool CGUIRenderCacheGLES::Begin(const CRect& region)
+{
+  CGraphicContext& gfx = CServiceBroker::GetWinSystem()->GetGfxContext();
+  const int screenWidth = gfx.GetWidth();
+  const int screenHeight = gfx.GetHeight();
+
+  // The buffer starts at the bottom left corner of the screen, so the GUI can render into it with
+  // the viewport, scissors and projection of the screen. It only has to reach the region.
+  const int width = std::min(static_cast<int>(std::ceil(region.x2)), screenWidth);
+  const int height = std::min(screenHeight - static_cast<int>(std::floor(region.y1)), screenHeight);
+  if (region.IsEmpty() || width <= 0 || height <= 0)
+    return false;
+
+  if (!m_fbo.IsBound() || width != m_fboWidth || height != m_fboHeight)
+  {
+    m_fbo.Cleanup();
+    if (!m_fbo.Initialize() ||
+        !m_fbo.CreateAndBindToTexture(GL_TEXTURE_2D, width, height, GL_RGBA, GL_UNSIGNED_BYTE,
+                                      GL_NEAREST))
+    {
+      m_fbo.Cleanup();
+      return false;
+    }
+    m_fboWidth = width;
+    m_fboHeight = height;
+  }
+
+  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &m_previousFramebuffer);
+  if (!m_fbo.BeginRender())
+    return false;
+
+  m_region = region;
+
+  // everything in the region has to end up in the cache, not only what this pass renders
+  m_scissors = gfx.GetScissors();
+  gfx.ResetScissors();
+
+  glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+  glClear(GL_COLOR_BUFFER_BIT);
+  return true;
+}
+
+void CGUIRenderCacheGLES::End()
+{
+  glBindFramebuffer(GL_FRAMEBUFFER, m_previousFramebuffer);
+  CServiceBroker::GetWinSystem()->GetGfxContext().SetScissors(m_scissors);
+}
+
+void CGUIRenderCacheGLES::Render()
+{
+  if (!m_fbo.IsBound())
+    return;
+
+  CRenderSystemGLES* renderSystem =
+      dynamic_cast<CRenderSystemGLES*>(CServiceBroker::GetRenderSystem());
+  const float screenHeight =
+      static_cast<float>(CServiceBroker::GetWinSystem()->GetGfxContext().GetHeight());
+
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, m_fbo.Texture());
+
+  // the GUI blends colors by their alpha into the buffer, so the cached image is premultiplied
+  glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+  glEnable(GL_BLEND);
+
+  renderSystem->EnableGUIShader(ShaderMethodGLES::SM_TEXTURE);
+
+  GLint posLoc = renderSystem->GUIShaderGetPos();
+  GLint tex0Loc = renderSystem->GUIShaderGetCoord0();
+  GLint uniColLoc = renderSystem->GUIShaderGetUniCol();
+
+  glUniform4f(uniColLoc, 1.0f, 1.0f, 1.0f, 1.0f);
+
+  GLfloat ver[4][3];
+  GLfloat tex[4][2];
+  GLubyte idx[4] = {0, 1, 3, 2}; //determines order of triangle strip
+
+  glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, 0, ver);
+  glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, 0, tex);
+  glEnableVertexAttribArray(posLoc);
+  glEnableVertexAttribArray(tex0Loc);
+
+  ver[0][0] = ver[3][0] = m_region.x1;
+  ver[0][1] = ver[1][1] = m_region.y1;
+  ver[1][0] = ver[2][0] = m_region.x2;
+  ver[2][1] = ver[3][1] = m_region.y2;
+  ver[0][2] = ver[1][2] = ver[2][2] = ver[3][2] = 0;
+
+  // rows of the buffer are counted from the bottom of the screen
+  tex[0][0] = tex[3][0] = m_region.x1 / m_fboWidth;
+  tex[0][1] = tex[1][1] = (screenHeight - m_region.y1) / m_fboHeight;
+  tex[1][0] = tex[2][0] = m_region.x2 / m_fboWidth;
+  tex[2][1] = tex[3][1] = (screenHeight - m_region.y2) / m_fboHeight;
+
+  glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_BYTE, idx);
+
+  glDisableVertexAttribArray(posLoc);
+  glDisableVertexAttribArray(tex0Loc);
+
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  renderSystem->DisableGUIShader();
+  VerifyGLState();
+}
+
+void CGUIRenderCacheGLES::Free()
+{
+  m_fbo.Cleanup();
+  m_fboWidth = 0;
+  m_fboHeight = 0;
+}
@@ -14,9 +14,109 @@
 #include "GUIFont.h"
 #include "utils/CharsetConverter.h"
 #include "utils/StringUtils.h"
+#include "threads/CriticalSection.h"
 #include "utils/log.h"
 
 #include <limits>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+namespace
+{
+// Labels of list items repeat the same few strings over and over, so layouts of short texts are
+// shared by all text layouts instead of being parsed, wrapped and bidi transformed again on every
+// scroll. The fonts the layouts were measured with are part of the key, the cache is emptied by
+// the font manager whenever fonts are reloaded or unloaded.
+constexpr size_t LAYOUT_CACHE_SIZE = 1000;
+constexpr size_t LAYOUT_CACHE_MAX_TEXT = 256;
+
+struct LayoutKey
+{
+  std::string text;
+  const CGUIFont* font;
+  UTILS::COLOR::Color color;
+  float maxWidth;
+  float maxHeight;
+  bool wrap;
+  bool forceLTR;
+
+  bool operator<(const LayoutKey& other) const
+  {
+    return std::tie(text, font, color, maxWidth, maxHeight, wrap, forceLTR) <
+           std::tie(other.text, other.font, other.color, other.maxWidth, other.maxHeight,
+                    other.wrap, other.forceLTR);
+  }
+};
+
+struct Layout
+{
+  std::vector<CGUIString> lines;
+  std::vector<UTILS::COLOR::Color> colors;
+  float textWidth;
+  float textHeight;
+};
+
+class CTextLayoutCache
+{
+public:
+  bool Get(const LayoutKey& key, Layout& layout)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    const auto it = m_layouts.find(key);
+    if (it == m_layouts.end())
+      return false;
+
+    // most recently used entries are kept at the front
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lru);
+    layout = it->second.layout;
+    return true;
+  }
+
+  void Add(const LayoutKey& key, const Layout& layout)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    const auto [it, inserted] = m_layouts.try_emplace(key);
+    if (!inserted)
+      return;
+
+    it->second.layout = layout;
+    m_lru.push_front(&it->first);
+    it->second.lru = m_lru.begin();
+
+    if (m_layouts.size() > LAYOUT_CACHE_SIZE)
+    {
+      m_layouts.erase(*m_lru.back());
+      m_lru.pop_back();
+    }
+  }
+
+  void Clear()
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    m_lru.clear();
+    m_layouts.clear();
+  }
+
+private:
+  struct Entry
+  {
+    Layout layout;
+    std::list<const LayoutKey*>::iterator lru;
+  };
+
+  CCriticalSection m_section;
+  std::map<LayoutKey, Entry> m_layouts;
+  std::list<const LayoutKey*> m_lru;
+};
+
+CTextLayoutCache& GetLayoutCache()
+{
+  static CTextLayoutCache cache;
+  return cache;
+}
+} // unnamed namespace
 
 CGUIString::CGUIString(iString start, iString end, bool carriageReturn)
 {
@@ -227,12 +327,39 @@ bool CGUITextLayout::Update(const std::string &text, float maxWidth, bool forceU
 
   m_lastUtf8Text = text;
   m_lastUpdateW = false;
+
+  if (text.size() > LAYOUT_CACHE_MAX_TEXT)
+  {
+    std::wstring utf16;
+    g_charsetConverter.utf8ToW(text, utf16, false);
+    UpdateCommon(utf16, maxWidth, forceLTRReadingOrder);
+    return true;
+  }
+
+  const LayoutKey key{text,   m_font, m_textColor, maxWidth, m_maxHeight,
+                      m_wrap, forceLTRReadingOrder};
+  Layout layout;
+  if (GetLayoutCache().Get(key, layout))
+  {
+    m_lines = std::move(layout.lines);
+    m_colors = std::move(layout.colors);
+    m_textWidth = layout.textWidth;
+    m_textHeight = layout.textHeight;
+    return true;
+  }
+
   std::wstring utf16;
   g_charsetConverter.utf8ToW(text, utf16, false);
   UpdateCommon(utf16, maxWidth, forceLTRReadingOrder);
+  GetLayoutCache().Add(key, {m_lines, m_colors, m_textWidth, m_textHeight});
   return true;
 }
 
+void CGUITextLayout::ClearLayoutCache()
+{
+  GetLayoutCache().Clear();
+}
+
 bool CGUITextLayout::UpdateW(const std::wstring &text, float maxWidth /*= 0*/, bool forceUpdate /*= false*/, bool forceLTRReadingOrder /*= false*/)
 {
   if (text == m_lastText && !forceUpdate && m_lastUpdateW)
@@ -138,6 +138,11 @@ public:
                        uint32_t align);
   static void Filter(std::string &text);
 
+  /*! \brief Drop the layouts shared between controls, e.g. because the fonts they were measured
+   with were reloaded.
+   */
+  static void ClearLayoutCache();
+
 protected:
   void LineBreakText(const vecText &text, std::vector<CGUIString> &lines);
   void WrapText(const vecText &text, float maxWidth);
@@ -9,6 +9,7 @@
 #include "GUITexture.h"
 
 #include "GUILargeTextureManager.h"
+#include "Texture.h"
 #include "TextureManager.h"
 #include "utils/MathUtils.h"
 #include "utils/StringUtils.h"
@@ -268,6 +269,11 @@ void CGUITexture::Render(float left,
   int orientation = GetOrientation();
   OrientateTexture(texture, u3, v3, orientation);
 
+  // images packed into an atlas are offset within the shared texture
+  if (m_texture.m_texOffsetX || m_texture.m_texOffsetY)
+    texture += CPoint(m_texture.m_texOffsetX * m_texCoordsScaleU,
+                      m_texture.m_texOffsetY * m_texCoordsScaleV);
+
   if (m_diffuse.size())
   {
     // flip the texture as necessary.  Diffuse just gets flipped according to m_info.orientation.
@@ -276,24 +282,23 @@ void CGUITexture::Render(float left,
     diffuse.y1 *= m_diffuseScaleV / v3; diffuse.y2 *= m_diffuseScaleV / v3;
     diffuse += m_diffuseOffset;
     OrientateTexture(diffuse, m_diffuseU, m_diffuseV, m_info.orientation);
+
+    if (m_diffuse.m_texOffsetX || m_diffuse.m_texOffsetY)
+      diffuse += CPoint(static_cast<float>(m_diffuse.m_texOffsetX) / m_diffuse.m_texWidth,
+                        static_cast<float>(m_diffuse.m_texOffsetY) / m_diffuse.m_texHeight);
   }
 
   float x[4], y[4], z[4];
 
 #define ROUND_TO_PIXEL(x) static_cast<float>(MathUtils::round_int(static_cast<double>(x)))
 
-  x[0] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalXCoord(vertex.x1, vertex.y1));
-  y[0] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalYCoord(vertex.x1, vertex.y1));
-  z[0] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalZCoord(vertex.x1, vertex.y1));
-  x[1] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalXCoord(vertex.x2, vertex.y1));
-  y[1] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalYCoord(vertex.x2, vertex.y1));
-  z[1] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalZCoord(vertex.x2, vertex.y1));
-  x[2] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalXCoord(vertex.x2, vertex.y2));
-  y[2] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalYCoord(vertex.x2, vertex.y2));
-  z[2] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalZCoord(vertex.x2, vertex.y2));
-  x[3] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalXCoord(vertex.x1, vertex.y2));
-  y[3] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalYCoord(vertex.x1, vertex.y2));
-  z[3] = ROUND_TO_PIXEL(CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalZCoord(vertex.x1, vertex.y2));
+  CServiceBroker::GetWinSystem()->GetGfxContext().ScaleFinalQuad(vertex, x, y, z);
+  for (int i = 0; i < 4; i++)
+  {
+    x[i] = ROUND_TO_PIXEL(x[i]);
+    y[i] = ROUND_TO_PIXEL(y[i]);
+    z[i] = ROUND_TO_PIXEL(z[i]);
+  }
 
   if (y[2] == y[0]) y[2] += 1.0f;
   if (x[2] == x[0]) x[2] += 1.0f;
@@ -578,6 +583,22 @@ bool CGUITexture::ReadyToRender() const
   return m_texture.size() > 0;
 }
 
+bool CGUITexture::IsOpaque() const
+{
+  if (!m_visible || !m_info.m_infill || m_currentFrame >= m_texture.m_textures.size() ||
+      m_vertex.IsEmpty())
+    return false;
+
+  const UTILS::COLOR::Color color =
+      (m_info.diffuseColor) ? (UTILS::COLOR::Color)m_info.diffuseColor : m_diffuseColor;
+  if (m_alpha != 0xFF || (color >> 24) != 0xFF)
+    return false;
+
+  if (m_texture.m_textures[m_currentFrame]->HasAlpha())
+    return false;
+  return m_diffuse.m_textures.empty() || !m_diffuse.m_textures[0]->HasAlpha();
+}
+
 void CGUITexture::OrientateTexture(CRect& rect, float width, float height, int orientation)
 {
   switch (orientation & 3)
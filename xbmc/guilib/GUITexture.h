@@ -133,6 +133,11 @@ public:
   }
   bool ReadyToRender() const;
 
+  /*!
+   * @brief Whether the render rect of the texture is covered with opaque pixels once rendered
+   */
+  bool IsOpaque() const;
+
 protected:
   CGUITexture(float posX, float posY, float width, float height, const CTextureInfo& texture);
   CGUITexture(const CGUITexture& left);
@@ -20,6 +20,9 @@
 
 #include "PlatformDefs.h"
 
+GLuint CGUITextureGL::m_streamVertexBuffer{0};
+GLuint CGUITextureGL::m_streamIndexBuffer{0};
+
 void CGUITextureGL::Register()
 {
   CGUITexture::Register(CGUITextureGL::CreateTexture, CGUITextureGL::DrawQuad);
@@ -109,12 +112,9 @@ void CGUITextureGL::End()
     GLint tex1Loc = m_renderSystem->ShaderGetCoord1();
     GLint uniColLoc = m_renderSystem->ShaderGetUniCol();
 
-    GLuint VertexVBO;
-    GLuint IndexVBO;
-
-    glGenBuffers(1, &VertexVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, VertexVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex)*m_packedVertices.size(), &m_packedVertices[0], GL_STATIC_DRAW);
+    BindStreamBuffers();
+    glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex) * m_packedVertices.size(),
+                 m_packedVertices.data(), GL_STREAM_DRAW);
 
     if (uniColLoc >= 0)
     {
@@ -135,9 +135,8 @@ void CGUITextureGL::End()
                           reinterpret_cast<const GLvoid*>(offsetof(PackedVertex, u1)));
     glEnableVertexAttribArray(tex0Loc);
 
-    glGenBuffers(1, &IndexVBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexVBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(ushort)*m_idx.size(), m_idx.data(), GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * m_idx.size(), m_idx.data(),
+                 GL_STREAM_DRAW);
 
     glDrawElements(GL_TRIANGLES, m_packedVertices.size()*6 / 4, GL_UNSIGNED_SHORT, 0);
 
@@ -149,8 +148,6 @@ void CGUITextureGL::End()
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    glDeleteBuffers(1, &VertexVBO);
-    glDeleteBuffers(1, &IndexVBO);
   }
 
   if (m_diffuse.size())
@@ -271,8 +268,6 @@ void CGUITextureGL::DrawQuad(const CRect& rect,
 
   GLubyte col[4];
   GLubyte idx[4] = {0, 1, 3, 2};  //determines order of the vertices
-  GLuint vertexVBO;
-  GLuint indexVBO;
 
   struct PackedVertex
   {
@@ -326,9 +321,8 @@ void CGUITextureGL::DrawQuad(const CRect& rect,
     vertex[2].v1 = vertex[3].v1 = coords.y2;
   }
 
-  glGenBuffers(1, &vertexVBO);
-  glBindBuffer(GL_ARRAY_BUFFER, vertexVBO);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex)*4, &vertex[0], GL_STATIC_DRAW);
+  BindStreamBuffers();
+  glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex) * 4, &vertex[0], GL_STREAM_DRAW);
 
   glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(PackedVertex),
                         reinterpret_cast<const GLvoid*>(offsetof(PackedVertex, x)));
@@ -341,9 +335,7 @@ void CGUITextureGL::DrawQuad(const CRect& rect,
     glEnableVertexAttribArray(tex0Loc);
   }
 
-  glGenBuffers(1, &indexVBO);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexVBO);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLubyte)*4, idx, GL_STATIC_DRAW);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLubyte) * 4, idx, GL_STREAM_DRAW);
 
   glDrawElements(GL_TRIANGLE_STRIP, 4, GL_UNSIGNED_BYTE, 0);
 
@@ -352,10 +344,30 @@ void CGUITextureGL::DrawQuad(const CRect& rect,
     glDisableVertexAttribArray(tex0Loc);
 
   glBindBuffer(GL_ARRAY_BUFFER, 0);
-  glDeleteBuffers(1, &vertexVBO);
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-  glDeleteBuffers(1, &indexVBO);
 
   renderSystem->DisableShader();
 }
 
+void CGUITextureGL::BindStreamBuffers()
+{
+  if (!m_streamVertexBuffer)
+  {
+    glGenBuffers(1, &m_streamVertexBuffer);
+    glGenBuffers(1, &m_streamIndexBuffer);
+  }
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_streamVertexBuffer);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_streamIndexBuffer);
+}
+
+void CGUITextureGL::DestroyStreamBuffers()
+{
+  if (!m_streamVertexBuffer)
+    return;
+
+  glDeleteBuffers(1, &m_streamVertexBuffer);
+  glDeleteBuffers(1, &m_streamIndexBuffer);
+  m_streamVertexBuffer = 0;
+  m_streamIndexBuffer = 0;
+}
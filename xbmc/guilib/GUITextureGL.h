@@ -29,6 +29,11 @@ public:
                        CTexture* texture = nullptr,
                        const CRect* texCoords = nullptr);
 
+  /*!
+   \brief Release the buffers shared by all textures, called when the GL context goes away.
+   */
+  static void DestroyStreamBuffers();
+
   CGUITextureGL(float posX, float posY, float width, float height, const CTextureInfo& texture);
   ~CGUITextureGL() override = default;
 
@@ -42,6 +47,15 @@ protected:
 private:
   CGUITextureGL(const CGUITextureGL& texture) = default;
 
+  /*!
+   \brief Bind the vertex and index buffers that every draw streams its data into, creating them
+   on first use. Reusing them avoids allocating and freeing two buffer objects per draw.
+   */
+  static void BindStreamBuffers();
+
+  static GLuint m_streamVertexBuffer;
+  static GLuint m_streamIndexBuffer;
+
   std::array<GLubyte, 4> m_col;
 
   struct PackedVertex
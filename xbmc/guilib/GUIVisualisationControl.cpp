@@ -355,6 +355,22 @@ bool CGUIVisualisationControl::GetPresetList(std::vector<std::string>& vecpreset
   return false;
 }
 
+int CGUIVisualisationControl::GetSpectrumLevel()
+{
+  if (m_instance && m_alreadyStarted)
+    return m_instance->GetSpectrumAnalyzer().GetLevel();
+
+  return 0;
+}
+
+int CGUIVisualisationControl::GetSpectrumBand(unsigned int band)
+{
+  if (m_instance && m_alreadyStarted)
+    return m_instance->GetSpectrumAnalyzer().GetBand(band);
+
+  return 0;
+}
+
 bool CGUIVisualisationControl::InitVisualization()
 {
   IAE* ae = CServiceBroker::GetActiveAE();
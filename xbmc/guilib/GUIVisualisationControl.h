@@ -73,6 +73,8 @@ public:
   int GetActivePreset();
   std::string GetActivePresetName();
   bool GetPresetList(std::vector<std::string>& vecpresets);
+  int GetSpectrumLevel();
+  int GetSpectrumBand(unsigned int band);
 
 private:
   bool InitVisualization();
@@ -15,7 +15,9 @@
 #include "GUIControlProfiler.h"
 #include "GUIInfoManager.h"
 #include "GUIWindowManager.h"
+#include "GUIWindowXMLCache.h"
 #include "ServiceBroker.h"
+#include "TextureManager.h"
 #include "addons/Skin.h"
 #include "input/WindowTranslator.h"
 #include "input/actions/Action.h"
@@ -32,10 +34,36 @@
 #include "utils/XMLUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <cstring>
 #include <mutex>
 
 using namespace KODI;
 
+namespace
+{
+// textures are given by elements like <texture>, <texturefocus> or <alttexturenofocus>, either as
+// text or as diffuse attribute. Names containing infolabels are only known once shown.
+void GetTextureNames(const TiXmlElement* element, std::vector<std::string>& textureNames)
+{
+  for (const TiXmlElement* child = element->FirstChildElement(); child;
+       child = child->NextSiblingElement())
+  {
+    if (strstr(child->Value(), "texture"))
+    {
+      const TiXmlNode* text = child->FirstChild();
+      if (text && text->Type() == TiXmlNode::TINYXML_TEXT && !strchr(text->Value(), '$'))
+        textureNames.emplace_back(text->Value());
+
+      const char* diffuse = child->Attribute("diffuse");
+      if (diffuse && !strchr(diffuse, '$'))
+        textureNames.emplace_back(diffuse);
+    }
+    GetTextureNames(child, textureNames);
+  }
+}
+} // unnamed namespace
+
 bool CGUIWindow::icompare::operator()(const std::string &s1, const std::string &s2) const
 {
   return StringUtils::CompareNoCase(s1, s2) < 0;
@@ -124,13 +152,31 @@ bool CGUIWindow::Load(const std::string& strFileName, bool bContainsPath)
 
 bool CGUIWindow::LoadXML(const std::string &strPath, const std::string &strLowerPath)
 {
+  // window files opened before are kept parsed as long as they don't change
+  if (!m_windowXMLRootElement)
+  {
+    m_windowXMLRootElement = CGUIWindowXMLCache::GetInstance().GetParsed(strPath);
+    if (m_windowXMLRootElement)
+    {
+      CLog::Log(LOGDEBUG, "Using cached xml root node for {}", strPath);
+      m_windowXMLPath = strPath;
+      return Load(Prepare(m_windowXMLRootElement).get());
+    }
+  }
+
   // load window xml if we don't have it stored yet
   if (!m_windowXMLRootElement)
   {
     CXBMCTinyXML xmlDoc;
     std::string strPathLower = strPath;
     StringUtils::ToLower(strPathLower);
-    if (!xmlDoc.LoadFile(strPath) && !xmlDoc.LoadFile(strPathLower) && !xmlDoc.LoadFile(strLowerPath))
+    if (xmlDoc.LoadFile(strPath))
+      m_windowXMLPath = strPath;
+    else if (xmlDoc.LoadFile(strPathLower))
+      m_windowXMLPath = strPathLower;
+    else if (xmlDoc.LoadFile(strLowerPath))
+      m_windowXMLPath = strLowerPath;
+    else
     {
       CLog::Log(LOGERROR, "Unable to load window XML: {}. Line {}\n{}", strPath, xmlDoc.ErrorRow(),
                 xmlDoc.ErrorDesc());
@@ -148,6 +194,7 @@ bool CGUIWindow::LoadXML(const std::string &strPath, const std::string &strLower
 
     // store XML for further processing if window's load type is LOAD_EVERY_TIME or a reload is needed
     m_windowXMLRootElement.reset(static_cast<TiXmlElement*>(xmlDoc.RootElement()->Clone()));
+    CGUIWindowXMLCache::GetInstance().SetParsed(m_windowXMLPath, *m_windowXMLRootElement);
   }
   else
     CLog::Log(LOGDEBUG, "Using already stored xml root node for {}", strPath);
@@ -160,6 +207,15 @@ std::unique_ptr<TiXmlElement> CGUIWindow::Prepare(const std::unique_ptr<TiXmlEle
   if (!rootElement)
     return nullptr;
 
+  CGUIWindowXMLCache& cache = CGUIWindowXMLCache::GetInstance();
+  const bool cached = rootElement == m_windowXMLRootElement && !m_windowXMLPath.empty();
+  if (cached)
+  {
+    auto resolvedRoot = cache.GetResolved(m_windowXMLPath, m_xmlIncludeConditions);
+    if (resolvedRoot)
+      return resolvedRoot;
+  }
+
   // copy the root element as we will manipulate it
   auto preparedRoot = std::make_unique<TiXmlElement>(*rootElement);
 
@@ -167,6 +223,9 @@ std::unique_ptr<TiXmlElement> CGUIWindow::Prepare(const std::unique_ptr<TiXmlEle
   // and save include's conditions to the given map
   g_SkinInfo->ResolveIncludes(preparedRoot.get(), &m_xmlIncludeConditions);
 
+  if (cached)
+    cache.SetResolved(m_windowXMLPath, *preparedRoot, m_xmlIncludeConditions);
+
   return preparedRoot;
 }
 
@@ -188,6 +247,12 @@ bool CGUIWindow::Load(TiXmlElement *pRootElement)
   CRect parentRect(0, 0, static_cast<float>(m_coordsRes.iWidth), static_cast<float>(m_coordsRes.iHeight));
   CGUIControlFactory::GetHitRect(pRootElement, m_hitRect, parentRect);
 
+  m_textureNames.clear();
+  GetTextureNames(pRootElement, m_textureNames);
+  std::sort(m_textureNames.begin(), m_textureNames.end());
+  m_textureNames.erase(std::unique(m_textureNames.begin(), m_textureNames.end()),
+                       m_textureNames.end());
+
   TiXmlElement *pChild = pRootElement->FirstChildElement();
   while (pChild)
   {
@@ -358,6 +423,17 @@ void CGUIWindow::DoRender()
   if (CGUIControlProfiler::IsRunning()) CGUIControlProfiler::Instance().EndFrame();
 }
 
+void CGUIWindow::UpdateOcclusion(CGUIOcclusionTracker& tracker)
+{
+  // windows that aren't allocated aren't rendered, see DoRender
+  if (!m_bAllocated)
+  {
+    m_isOccluded = false;
+    return;
+  }
+  CGUIControlGroup::UpdateOcclusion(tracker);
+}
+
 void CGUIWindow::AfterRender()
 {
   // Check to see if we should close at this point
@@ -748,8 +824,9 @@ void CGUIWindow::AllocResources(bool forceLoad /*= false */)
 #ifdef _DEBUG
   const auto start = std::chrono::steady_clock::now();
 #endif
-  // use forceLoad to determine if window needs (re)loading
-  forceLoad |= NeedLoad() || (m_loadType == LOAD_EVERY_TIME);
+  // use forceLoad to determine if window needs (re)loading. Windows loaded every time may still
+  // have their controls from the last time they were open, see CGUIWindowManager::CacheWindow
+  forceLoad |= NeedLoad();
 
   // if window is loaded and load is forced we have to free window resources first
   if (m_windowLoaded && forceLoad)
@@ -770,6 +847,9 @@ void CGUIWindow::AllocResources(bool forceLoad /*= false */)
   const auto skinLoadEnd = std::chrono::steady_clock::now();
 #endif
 
+  // decompress the bundled textures of the window in parallel before the controls load them
+  CServiceBroker::GetGUI()->GetTextureManager().PreloadTextures(m_textureNames);
+
   // and now allocate resources
   CGUIControlGroup::AllocResources();
 
@@ -796,10 +876,14 @@ void CGUIWindow::FreeResources(bool forceUnload /*= false */)
   CGUIControlGroup::FreeResources();
   //CServiceBroker::GetGUI()->GetTextureManager().Dump();
   // unload the skin
-  if (m_loadType == LOAD_EVERY_TIME || forceUnload) ClearAll();
+  if (forceUnload ||
+      (m_loadType == LOAD_EVERY_TIME &&
+       !CServiceBroker::GetGUI()->GetWindowManager().CacheWindow(GetID())))
+    ClearAll();
   if (forceUnload)
   {
     m_windowXMLRootElement.reset();
+    m_windowXMLPath.clear();
     m_xmlIncludeConditions.clear();
   }
 }
@@ -814,6 +898,7 @@ void CGUIWindow::ClearAll()
 {
   OnWindowUnload();
   CGUIControlGroup::ClearAll();
+  m_textureNames.clear();
   m_windowLoaded = false;
   m_dynamicResourceAlloc = true;
   m_visibleCondition.reset();
@@ -77,6 +77,7 @@ public:
    \sa FrameMove
    */
   void DoRender() override;
+  void UpdateOcclusion(CGUIOcclusionTracker& tracker) override;
 
   /*! \brief Do any post render activities.
     Check if window closing animation is finished and finalize window closing.
@@ -136,6 +137,8 @@ public:
   const RESOLUTION_INFO& GetCoordsRes() const { return m_coordsRes; }
   void SetLoadType(LOAD_TYPE loadType) { m_loadType = loadType; }
   LOAD_TYPE GetLoadType() { return m_loadType; }
+  bool IsWindowLoaded() const { return m_windowLoaded; }
+  bool IsAllocated() const { return m_bAllocated; }
   int GetRenderOrder() { return m_renderOrder; }
   void SetInitialVisibility() override;
   bool IsVisible() const override { return true; }; // windows are always considered visible as they implement their own
@@ -277,6 +280,7 @@ protected:
     Stored to avoid parsing the XML every time the window is loaded.
    */
   std::unique_ptr<TiXmlElement> m_windowXMLRootElement;
+  std::string m_windowXMLPath; ///< file m_windowXMLRootElement was loaded from
 
   bool m_manualRunActions;
 
@@ -289,5 +293,6 @@ protected:
 private:
   std::map<std::string, CVariant, icompare> m_mapProperties;
   std::map<INFO::InfoPtr, bool> m_xmlIncludeConditions; ///< \brief used to store conditions used to resolve includes for this window
+  std::vector<std::string> m_textureNames; ///< textures named by the window xml, preloaded on allocation
 };
 
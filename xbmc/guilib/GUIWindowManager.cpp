@@ -10,14 +10,21 @@
 
 #include "GUIAudioManager.h"
 #include "GUIDialog.h"
+#include "GUIFrameProfiler.h"
 #include "GUIInfoManager.h"
+#include "GUILargeTextureManager.h"
 #include "GUIPassword.h"
 #include "GUITexture.h"
+#include "InputLatencyTracker.h"
+#include "GUIWindowXMLCache.h"
 #include "ServiceBroker.h"
+#include "TextureManager.h"
+#include "TextureMemory.h"
 #include "WindowIDs.h"
 #include "addons/Skin.h"
 #include "addons/gui/GUIWindowAddonBrowser.h"
 #include "addons/interfaces/gui/Window.h"
+#include "application/AppInboundProtocol.h"
 #include "application/Application.h"
 #include "application/ApplicationComponents.h"
 #include "application/ApplicationPlayer.h"
@@ -44,6 +51,7 @@
 #include "settings/windows/GUIWindowSettingsScreenCalibration.h"
 #include "threads/SingleLock.h"
 #include "utils/StringUtils.h"
+#include "utils/TimeUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
@@ -162,6 +170,15 @@ using namespace KODI;
 using namespace PVR;
 using namespace PERIPHERALS;
 
+namespace
+{
+//! number of closed windows loaded every time that keep their controls
+constexpr size_t MAX_CACHED_WINDOWS = 8;
+
+//! interval in ms to check whether the textures of inactive windows should be released
+constexpr unsigned int MEMORY_CHECK_INTERVAL = 1000;
+} // unnamed namespace
+
 CGUIWindowManager::CGUIWindowManager()
 {
   m_pCallback = nullptr;
@@ -670,6 +687,7 @@ void CGUIWindowManager::Remove(int id)
                                          m_activeDialogs.end(),
                                          [window](CGUIWindow* w){ return w == window; }),
                           m_activeDialogs.end());
+    m_cachedWindows.remove(id);
     m_mapWindows.erase(it);
   }
   else
@@ -1147,6 +1165,8 @@ bool CGUIWindowManager::OnAction(const CAction &action) const
     m_touchGestureActive = true;
   }
 
+  CInputLatencyTracker::GetInstance().OnActionDispatched(GetActiveWindowOrDialog());
+
   bool ret;
   if (!m_inhibitTouchGestureEvents || !action.IsGesture())
   {
@@ -1219,6 +1239,10 @@ void CGUIWindowManager::Process(unsigned int currentTime)
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   std::unique_lock<CCriticalSection> lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
+  if (CGUIFrameProfiler::IsEnabled())
+    CGUIFrameProfiler::GetInstance().NewFrame();
+  CGUIFrameProfiler::CScope profilerScope(CGUIFrameProfiler::Phase::PROCESS);
+
   m_dirtyregions.clear();
 
   CGUIWindow* pWindow = GetWindow(GetActiveWindow());
@@ -1277,6 +1301,33 @@ void CGUIWindowManager::RenderPass() const
   }
 }
 
+void CGUIWindowManager::UpdateOcclusion(const CDirtyRegionList& passes)
+{
+  CGraphicContext& gfx = CServiceBroker::GetWinSystem()->GetGfxContext();
+  // with stereoscopic rendering each eye sees the controls at a different position
+  const bool enabled =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiOcclusionCulling &&
+      (gfx.GetStereoMode() == RENDER_STEREO_MODE_OFF ||
+       gfx.GetStereoMode() == RENDER_STEREO_MODE_MONO);
+  m_occlusion.Reset(passes, static_cast<float>(gfx.GetWidth()) * gfx.GetHeight(), enabled);
+  if (passes.empty())
+    return;
+
+  // walk the windows from the top most dialog down to the active window
+  auto renderList = m_activeDialogs;
+  stable_sort(renderList.begin(), renderList.end(), RenderOrderSortFunction);
+
+  for (auto it = renderList.rbegin(); it != renderList.rend(); ++it)
+  {
+    if ((*it)->IsDialogRunning())
+      (*it)->UpdateOcclusion(m_occlusion);
+  }
+
+  CGUIWindow* pWindow = GetWindow(GetActiveWindow());
+  if (pWindow)
+    pWindow->UpdateOcclusion(m_occlusion);
+}
+
 void CGUIWindowManager::RenderEx() const
 {
   CGUIWindow* pWindow = GetWindow(GetActiveWindow());
@@ -1299,19 +1350,43 @@ bool CGUIWindowManager::Render()
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   CSingleExit lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  CGUIFrameProfiler::CScope profilerScope(CGUIFrameProfiler::Phase::RENDER);
 
-  CDirtyRegionList dirtyRegions = m_tracker.GetDirtyRegions();
+  CDirtyRegionList dirtyRegions;
+  {
+    CGUIFrameProfiler::CScope dirtyRegionsScope(CGUIFrameProfiler::Phase::DIRTY_REGIONS);
+    dirtyRegions = m_tracker.GetDirtyRegions();
+  }
 
-  bool hasRendered = false;
   // If we visualize the regions we will always render the entire viewport
-  if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiVisualizeDirtyRegions || CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions == DIRTYREGION_SOLVER_FILL_VIEWPORT_ALWAYS)
+  const bool fillViewport =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiVisualizeDirtyRegions ||
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions ==
+          DIRTYREGION_SOLVER_FILL_VIEWPORT_ALWAYS;
+  const bool fillViewportOnChange =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions ==
+      DIRTYREGION_SOLVER_FILL_VIEWPORT_ON_CHANGE;
+
+  CDirtyRegionList passes;
+  if (fillViewport || (fillViewportOnChange && !dirtyRegions.empty()))
+    passes.emplace_back(0.0f, 0.0f,
+                        static_cast<float>(CServiceBroker::GetWinSystem()->GetGfxContext().GetWidth()),
+                        static_cast<float>(CServiceBroker::GetWinSystem()->GetGfxContext().GetHeight()));
+  else if (!fillViewportOnChange)
   {
-    RenderPass();
-    hasRendered = true;
+    for (const auto& i : dirtyRegions)
+    {
+      if (!i.IsEmpty())
+        passes.push_back(i);
+    }
   }
-  else if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions == DIRTYREGION_SOLVER_FILL_VIEWPORT_ON_CHANGE)
+
+  UpdateOcclusion(passes);
+
+  bool hasRendered = false;
+  if (fillViewport || fillViewportOnChange)
   {
-    if (!dirtyRegions.empty())
+    if (!passes.empty())
     {
       RenderPass();
       hasRendered = true;
@@ -1319,11 +1394,8 @@ bool CGUIWindowManager::Render()
   }
   else
   {
-    for (const auto& i : dirtyRegions)
+    for (const auto& i : passes)
     {
-      if (i.IsEmpty())
-        continue;
-
       CServiceBroker::GetWinSystem()->GetGfxContext().SetScissors(i);
       RenderPass();
       hasRendered = true;
@@ -1339,6 +1411,8 @@ bool CGUIWindowManager::Render()
       CGUITexture::DrawQuad(i, 0x0fff0000);
     for (const auto& i : dirtyRegions)
       CGUITexture::DrawQuad(i, 0x4c00ff00);
+    for (const auto& i : m_occlusion.GetSkippedRegions())
+      CGUITexture::DrawQuad(i, 0x4c0000ff);
   }
 
   return hasRendered;
@@ -1381,6 +1455,22 @@ void CGUIWindowManager::FrameMove()
       delete window;
     }
     m_deleteWindows.clear();
+
+    // release the memory of inactive windows when the platform or the texture budget asks for it
+    const unsigned int now = CTimeUtils::GetFrameTime();
+    if (m_lowMemory.exchange(false))
+    {
+      CLog::Log(LOGINFO, "Low memory, unloading inactive windows");
+      ReleaseInactiveWindows(true);
+      CServiceBroker::GetGUI()->GetLargeTextureManager().CleanupUnusedImages(true);
+      CServiceBroker::GetGUI()->GetTextureManager().FreeUnusedTextures(0);
+    }
+    else if (now - m_lastMemoryCheck >= MEMORY_CHECK_INTERVAL)
+    {
+      m_lastMemoryCheck = now;
+      if (CTextureMemory::IsUnderPressure(TextureConsumer::GUI))
+        ReleaseInactiveWindows(false);
+    }
   }
 
   CGUIWindow* pWindow = GetWindow(GetActiveWindow());
@@ -1464,6 +1554,7 @@ void CGUIWindowManager::DeInitialize()
     pWindow->FreeResources(true);
   }
   UnloadNotOnDemandWindows();
+  m_cachedWindows.clear();
 
   m_vecMsgTargets.erase( m_vecMsgTargets.begin(), m_vecMsgTargets.end() );
 
@@ -1542,6 +1633,11 @@ void CGUIWindowManager::SendThreadMessage(CGUIMessage& message, int window /*= 0
 
   CGUIMessage* msg = new CGUIMessage(message);
   m_vecThreadMessages.emplace_back(msg, window);
+  lock.unlock();
+
+  std::shared_ptr<CAppInboundProtocol> appPort = CServiceBroker::GetAppPort();
+  if (appPort)
+    appPort->WakeUp();
 }
 
 void CGUIWindowManager::DispatchThreadMessages()
@@ -1693,6 +1789,76 @@ void CGUIWindowManager::LoadNotOnDemandWindows()
   }
 }
 
+bool CGUIWindowManager::CacheWindow(int id)
+{
+  std::unique_lock<CCriticalSection> lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  const CGUIWindow* window = GetWindow(id);
+  if (!window || !window->IsWindowLoaded())
+    return false;
+
+  m_cachedWindows.remove(id);
+  m_cachedWindows.push_front(id);
+  while (m_cachedWindows.size() > MAX_CACHED_WINDOWS)
+  {
+    CGUIWindow* oldest = GetWindow(m_cachedWindows.back());
+    m_cachedWindows.pop_back();
+    if (oldest && oldest->GetLoadType() == CGUIWindow::LOAD_EVERY_TIME && !oldest->IsActive() &&
+        !oldest->IsAllocated())
+      oldest->ClearAll();
+  }
+  return true;
+}
+
+void CGUIWindowManager::OnLowMemory()
+{
+  m_lowMemory = true;
+}
+
+void CGUIWindowManager::ReleaseInactiveWindows(bool unload)
+{
+  std::unique_lock<CCriticalSection> lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  for (const auto& entry : m_mapWindows)
+  {
+    CGUIWindow* window = entry.second;
+    // the application takes care of the windows loaded on init
+    if (window->GetLoadType() == CGUIWindow::LOAD_ON_GUI_INIT || window->IsActive())
+      continue;
+
+    if (unload && window->IsWindowLoaded())
+      window->FreeResources(true);
+    else if (window->IsAllocated())
+      window->FreeResources();
+  }
+
+  if (unload)
+    m_cachedWindows.clear();
+}
+
+void CGUIWindowManager::PreloadSkinWindows()
+{
+  std::vector<std::string> paths;
+  std::unique_lock<CCriticalSection> lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  for (const auto& entry : m_mapWindows)
+  {
+    CGUIWindow* window = entry.second;
+    if (window->GetLoadType() != CGUIWindow::LOAD_ON_GUI_INIT && entry.first != WINDOW_HOME &&
+        entry.first != g_SkinInfo->GetStartWindow())
+      continue;
+
+    const std::string xmlFile = window->GetProperty("xmlfile").asString();
+    if (xmlFile.empty())
+      continue;
+
+    if (xmlFile.find('\\') != std::string::npos || xmlFile.find('/') != std::string::npos)
+      paths.push_back(xmlFile);
+    else
+      paths.push_back(g_SkinInfo->GetSkinPath(xmlFile));
+  }
+  lock.unlock();
+
+  CGUIWindowXMLCache::GetInstance().Preload(paths);
+}
+
 void CGUIWindowManager::UnloadNotOnDemandWindows()
 {
   std::unique_lock<CCriticalSection> lock(CServiceBroker::GetWinSystem()->GetGfxContext());
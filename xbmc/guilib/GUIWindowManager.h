@@ -9,12 +9,14 @@
 #pragma once
 
 #include "DirtyRegionTracker.h"
+#include "GUIOcclusionTracker.h"
 #include "GUIWindow.h"
 #include "IMsgTargetCallback.h"
 #include "IWindowManagerCallback.h"
 #include "guilib/WindowIDs.h"
 #include "messaging/IMessageTarget.h"
 
+#include <atomic>
 #include <list>
 #include <unordered_map>
 #include <utility>
@@ -107,6 +109,11 @@ public:
 
   void RenderEx() const;
 
+  /*! \brief Statistics of the controls skipped in the last Render() because they were hidden
+   behind opaque controls
+   */
+  const CGUIOcclusionTracker::Stats& GetOcclusionStats() const { return m_occlusion.GetStats(); }
+
   /*! \brief Do any post render activities.
    */
   void AfterRender();
@@ -226,14 +233,47 @@ public:
 
   bool HasVisibleControls();
 
+  /*!
+   \brief Keep the controls of a window that is loaded every time while it is closed, so it opens
+   again without being rebuilt. Only the most recently closed windows are kept.
+
+   \param id the id of the window being closed
+   \return false if the window should unload its controls
+   */
+  bool CacheWindow(int id);
+
+  /*!
+   \brief Signal that the system runs low on memory. With the next frame the inactive windows
+   release their controls and textures. Can be called from any thread.
+   */
+  void OnLowMemory();
+
 #ifdef _DEBUG
   void DumpTextureUse();
 #endif
 private:
   void RenderPass() const;
 
+  /*! \brief Find the controls that are hidden behind opaque controls, so RenderPass skips them
+   \param passes the regions rendered this frame
+   */
+  void UpdateOcclusion(const CDirtyRegionList& passes);
+
   void LoadNotOnDemandWindows();
+
+  /*!
+   \brief Start parsing the files of the windows loaded together with the skin in the background,
+   while the skin loads its includes and fonts.
+   */
+  void PreloadSkinWindows();
   void UnloadNotOnDemandWindows();
+
+  /*!
+   \brief Release the textures of all inactive windows that keep them allocated
+   \param unload also unload the controls of the cached and the kept in memory windows
+   */
+  void ReleaseInactiveWindows(bool unload);
+
   void AddToWindowHistory(int newWindowID);
 
   /*!
@@ -269,6 +309,9 @@ private:
   std::vector<CGUIWindow*> m_deleteWindows;
 
   std::deque<int> m_windowHistory;
+  std::list<int> m_cachedWindows; ///< closed windows that keep their controls, most recent first
+  std::atomic<bool> m_lowMemory{false};
+  unsigned int m_lastMemoryCheck{0};
 
   IWindowManagerCallback* m_pCallback;
   std::list< std::pair<CGUIMessage*,int> > m_vecThreadMessages;
@@ -282,4 +325,5 @@ private:
 
   CDirtyRegionList m_dirtyregions;
   CDirtyRegionTracker m_tracker;
+  CGUIOcclusionTracker m_occlusion;
 };
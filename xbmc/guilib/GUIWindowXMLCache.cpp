@@ -0,0 +1,172 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIWindowXMLCache.h"
+
+#include "GUIComponent.h"
+#include "GUIInfoManager.h"
+#include "ServiceBroker.h"
+#include "filesystem/File.h"
+#include "utils/JobManager.h"
+#include "utils/StringUtils.h"
+#include "utils/XBMCTinyXML.h"
+#include "utils/log.h"
+
+#include <mutex>
+
+CGUIWindowXMLCache& CGUIWindowXMLCache::GetInstance()
+{
+  static CGUIWindowXMLCache cache;
+  return cache;
+}
+
+bool CGUIWindowXMLCache::GetModificationTime(const std::string& path, time_t& mtime)
+{
+  struct __stat64 buffer;
+  if (XFILE::CFile::Stat(path, &buffer) != 0)
+    return false;
+  mtime = buffer.st_mtime;
+  return true;
+}
+
+std::unique_ptr<TiXmlElement> CGUIWindowXMLCache::GetParsed(const std::string& path)
+{
+  time_t mtime;
+  if (!GetModificationTime(path, mtime))
+    return nullptr;
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  const auto it = m_entries.find(path);
+  if (it == m_entries.end())
+    return nullptr;
+
+  if (it->second.mtime != mtime)
+  {
+    if (it->second.resolved)
+      m_resolvedCount--;
+    m_entries.erase(it);
+    return nullptr;
+  }
+  return std::make_unique<TiXmlElement>(*it->second.parsed);
+}
+
+void CGUIWindowXMLCache::SetParsed(const std::string& path, const TiXmlElement& root)
+{
+  time_t mtime;
+  if (!GetModificationTime(path, mtime))
+    return;
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  Entry& entry = m_entries[path];
+  if (entry.resolved)
+    m_resolvedCount--;
+  entry = Entry();
+  entry.mtime = mtime;
+  entry.parsed = std::make_unique<TiXmlElement>(root);
+}
+
+bool CGUIWindowXMLCache::HasParsed(const std::string& path)
+{
+  time_t mtime;
+  if (!GetModificationTime(path, mtime))
+    return false;
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  const auto it = m_entries.find(path);
+  return it != m_entries.end() && it->second.mtime == mtime;
+}
+
+void CGUIWindowXMLCache::Preload(const std::vector<std::string>& paths)
+{
+  for (const std::string& path : paths)
+  {
+    CServiceBroker::GetJobManager()->Submit(
+        [path]() {
+          CGUIWindowXMLCache& cache = GetInstance();
+          if (cache.HasParsed(path))
+            return;
+
+          CXBMCTinyXML xmlDoc;
+          if (!xmlDoc.LoadFile(path) || !xmlDoc.RootElement() ||
+              !StringUtils::EqualsNoCase(xmlDoc.RootElement()->Value(), "window"))
+            return; // the window reports the error once it loads the file
+
+          cache.SetParsed(path, *xmlDoc.RootElement());
+          CLog::Log(LOGDEBUG, "CGUIWindowXMLCache::Preload - parsed {}", path);
+        },
+        CJob::PRIORITY_NORMAL);
+  }
+}
+
+std::unique_ptr<TiXmlElement> CGUIWindowXMLCache::GetResolved(
+    const std::string& path, std::map<INFO::InfoPtr, bool>& includeConditions)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  const auto it = m_entries.find(path);
+  if (it == m_entries.end() || !it->second.resolved)
+    return nullptr;
+
+  Entry& entry = it->second;
+  if (CServiceBroker::GetGUI()->GetInfoManager().ConditionsChangedValues(entry.includeConditions))
+    return nullptr;
+
+  entry.lastUse = ++m_useCounter;
+  includeConditions = entry.includeConditions;
+  return std::make_unique<TiXmlElement>(*entry.resolved);
+}
+
+void CGUIWindowXMLCache::SetResolved(const std::string& path,
+                                     const TiXmlElement& root,
+                                     const std::map<INFO::InfoPtr, bool>& includeConditions)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  const auto it = m_entries.find(path);
+  if (it == m_entries.end())
+    return; // only files known to be unchanged are kept
+
+  Entry& entry = it->second;
+  if (!entry.resolved)
+  {
+    if (m_resolvedCount >= MAX_RESOLVED)
+    {
+      auto oldest = m_entries.end();
+      for (auto i = m_entries.begin(); i != m_entries.end(); ++i)
+      {
+        if (i->second.resolved && (oldest == m_entries.end() ||
+                                   i->second.lastUse < oldest->second.lastUse))
+          oldest = i;
+      }
+      oldest->second.resolved.reset();
+      oldest->second.includeConditions.clear();
+      m_resolvedCount--;
+    }
+    m_resolvedCount++;
+  }
+
+  entry.resolved = std::make_unique<TiXmlElement>(root);
+  entry.includeConditions = includeConditions;
+  entry.lastUse = ++m_useCounter;
+}
+
+void CGUIWindowXMLCache::ClearResolved()
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  for (auto& it : m_entries)
+  {
+    it.second.resolved.reset();
+    it.second.includeConditions.clear();
+  }
+  m_resolvedCount = 0;
+}
+
+void CGUIWindowXMLCache::Clear()
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  m_entries.clear();
+  m_resolvedCount = 0;
+}
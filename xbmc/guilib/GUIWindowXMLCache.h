@@ -0,0 +1,90 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "interfaces/info/InfoBool.h"
+#include "threads/CriticalSection.h"
+
+#include <ctime>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class TiXmlElement;
+
+/*!
+ \ingroup winman
+ \brief Keeps the parsed and the include resolved XML of window files, so opening a window again
+ does neither parse nor resolve it again.
+
+ Parsed files are checked against the modification time of the file and survive skin reloads.
+ Resolved files depend on the include files and on the values of the conditions of conditional
+ includes. They are dropped whenever the skin includes are loaded and are only used while
+ those conditions still evaluate to the values they had when the file was resolved.
+ */
+class CGUIWindowXMLCache
+{
+public:
+  static CGUIWindowXMLCache& GetInstance();
+
+  /*!
+   \brief Get a copy of the parsed root element of a window file.
+   \return nullptr if the file is not cached or changed since it was parsed
+   */
+  std::unique_ptr<TiXmlElement> GetParsed(const std::string& path);
+  void SetParsed(const std::string& path, const TiXmlElement& root);
+
+  /*!
+   \brief Parse window files on job workers ahead of their first use. Windows loading a file that
+   is not parsed yet parse it themselves, so nothing waits for the workers.
+   */
+  void Preload(const std::vector<std::string>& paths);
+
+  /*!
+   \brief Get a copy of the include resolved root element of a window file.
+   \param[out] includeConditions the conditions used to resolve the includes
+   \return nullptr if the file is not cached or one of the conditions changed its value
+   */
+  std::unique_ptr<TiXmlElement> GetResolved(const std::string& path,
+                                            std::map<INFO::InfoPtr, bool>& includeConditions);
+  void SetResolved(const std::string& path,
+                   const TiXmlElement& root,
+                   const std::map<INFO::InfoPtr, bool>& includeConditions);
+
+  //! \brief Drop all resolved files, called when the skin includes are (re)loaded
+  void ClearResolved();
+
+  void Clear();
+
+private:
+  CGUIWindowXMLCache() = default;
+  CGUIWindowXMLCache(const CGUIWindowXMLCache&) = delete;
+  CGUIWindowXMLCache& operator=(const CGUIWindowXMLCache&) = delete;
+
+  struct Entry
+  {
+    time_t mtime = 0;
+    std::unique_ptr<TiXmlElement> parsed;
+    std::unique_ptr<TiXmlElement> resolved;
+    std::map<INFO::InfoPtr, bool> includeConditions;
+    unsigned int lastUse = 0; ///< for dropping the least recently used resolved file
+  };
+
+  //! \brief Resolved files take a lot more memory than parsed ones, so only a few are kept
+  static constexpr size_t MAX_RESOLVED = 32;
+
+  static bool GetModificationTime(const std::string& path, time_t& mtime);
+  bool HasParsed(const std::string& path);
+
+  CCriticalSection m_section;
+  std::map<std::string, Entry> m_entries;
+  size_t m_resolvedCount = 0;
+  unsigned int m_useCounter = 0;
+};
@@ -0,0 +1,141 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "InputLatencyTracker.h"
+
+#include "input/WindowTranslator.h"
+#include "utils/TimeUtils.h"
+#include "utils/Variant.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+// inputs that didn't lead to a rendered frame within this time are dropped
+constexpr int64_t MAX_LATENCY_MS = 2000;
+} // unnamed namespace
+
+std::atomic<bool> CInputLatencyTracker::m_enabled{false};
+
+CInputLatencyTracker& CInputLatencyTracker::GetInstance()
+{
+  static CInputLatencyTracker tracker;
+  return tracker;
+}
+
+void CInputLatencyTracker::SetEnabled(bool enabled)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  if (enabled && !IsEnabled())
+  {
+    m_samples.clear();
+    m_inputTime = 0;
+    m_windowId = -1;
+  }
+  m_enabled = enabled;
+}
+
+void CInputLatencyTracker::OnInputReceived()
+{
+  if (!IsEnabled())
+    return;
+
+  int64_t none = 0;
+  m_inputTime.compare_exchange_strong(none, CurrentHostCounter());
+}
+
+void CInputLatencyTracker::OnActionDispatched(int windowId)
+{
+  if (!IsEnabled() || !m_inputTime.load(std::memory_order_relaxed))
+    return;
+
+  if (m_windowId < 0)
+    m_windowId = windowId;
+}
+
+void CInputLatencyTracker::OnFramePresented(bool rendered)
+{
+  if (!IsEnabled())
+    return;
+
+  const int64_t inputTime = m_inputTime.load(std::memory_order_relaxed);
+  if (!inputTime)
+    return;
+
+  const float latency =
+      static_cast<float>(CurrentHostCounter() - inputTime) * 1000.0f / CurrentHostFrequency();
+
+  if (latency > MAX_LATENCY_MS)
+  {
+    m_windowId = -1;
+    m_inputTime = 0;
+    return;
+  }
+
+  if (!rendered || m_windowId < 0)
+    return;
+
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    Samples& samples = m_samples[m_windowId];
+    if (samples.latencies.size() < MAX_SAMPLES)
+      samples.latencies.push_back(latency);
+    else
+      samples.latencies[samples.next] = latency;
+    samples.next = (samples.next + 1) % MAX_SAMPLES;
+    samples.count++;
+  }
+
+  m_windowId = -1;
+  m_inputTime = 0;
+}
+
+float CInputLatencyTracker::Percentile(std::vector<float> latencies, float percentile)
+{
+  const size_t n = static_cast<size_t>(percentile * (latencies.size() - 1));
+  std::nth_element(latencies.begin(), latencies.begin() + n, latencies.end());
+  return latencies[n];
+}
+
+bool CInputLatencyTracker::GetPercentiles(int windowId, float& p50, float& p90, float& p99) const
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  const auto it = m_samples.find(windowId);
+  if (it == m_samples.end() || it->second.latencies.empty())
+    return false;
+
+  p50 = Percentile(it->second.latencies, 0.5f);
+  p90 = Percentile(it->second.latencies, 0.9f);
+  p99 = Percentile(it->second.latencies, 0.99f);
+  return true;
+}
+
+void CInputLatencyTracker::GetReport(CVariant& report) const
+{
+  report = CVariant(CVariant::VariantTypeObject);
+  CVariant& windows = report["windows"];
+  windows = CVariant(CVariant::VariantTypeArray);
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  for (const auto& [windowId, samples] : m_samples)
+  {
+    if (samples.latencies.empty())
+      continue;
+
+    CVariant window(CVariant::VariantTypeObject);
+    window["window"] = CWindowTranslator::TranslateWindow(windowId);
+    window["id"] = windowId;
+    window["count"] = samples.count;
+    window["p50"] = Percentile(samples.latencies, 0.5f);
+    window["p90"] = Percentile(samples.latencies, 0.9f);
+    window["p99"] = Percentile(samples.latencies, 0.99f);
+    window["max"] = *std::max_element(samples.latencies.begin(), samples.latencies.end());
+    windows.push_back(std::move(window));
+  }
+}
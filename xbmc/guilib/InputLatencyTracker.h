@@ -0,0 +1,90 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+class CVariant;
+
+/*!
+ * \brief Measures the time from receiving a key press, button press or queued action until the
+ * first frame that renders something after the action was dispatched to a window.
+ *
+ * One input is followed at a time, inputs arriving while one is in flight are not measured. The
+ * latencies are kept per window, so they can be reported as percentiles. The tracker is off by
+ * default, while it is disabled each instrumentation point costs a single relaxed atomic load.
+ */
+class CInputLatencyTracker
+{
+public:
+  static CInputLatencyTracker& GetInstance();
+
+  static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+  /*!
+   * \brief Start or stop tracking. Starting drops all previously recorded latencies.
+   */
+  void SetEnabled(bool enabled);
+
+  /*!
+   * \brief An input event was received. Can be called from any thread.
+   */
+  void OnInputReceived();
+
+  /*!
+   * \brief The action resulting from the input is dispatched to a window. Called on the GUI thread.
+   */
+  void OnActionDispatched(int windowId);
+
+  /*!
+   * \brief A frame was presented. Closes the measurement if the frame rendered anything.
+   */
+  void OnFramePresented(bool rendered);
+
+  /*!
+   * \brief Get the latency percentiles per window.
+   * \param[out] report object holding a windows array
+   */
+  void GetReport(CVariant& report) const;
+
+  /*!
+   * \brief Get the latency percentiles of a window in ms.
+   * \return false if no latency was recorded for the window
+   */
+  bool GetPercentiles(int windowId, float& p50, float& p90, float& p99) const;
+
+private:
+  CInputLatencyTracker() = default;
+  CInputLatencyTracker(const CInputLatencyTracker&) = delete;
+  CInputLatencyTracker& operator=(const CInputLatencyTracker&) = delete;
+
+  struct Samples
+  {
+    std::vector<float> latencies; ///< ring buffer of the last latencies in ms
+    size_t next = 0;
+    unsigned int count = 0;
+  };
+
+  static float Percentile(std::vector<float> latencies, float percentile);
+
+  static constexpr size_t MAX_SAMPLES = 200;
+
+  static std::atomic<bool> m_enabled;
+
+  std::atomic<int64_t> m_inputTime{0}; ///< host counter of the input in flight, 0 if none
+  std::atomic<int> m_windowId{-1}; ///< window the action was dispatched to, -1 if not dispatched yet
+
+  mutable CCriticalSection m_section;
+  std::map<int, Samples> m_samples;
+};
@@ -9,12 +9,17 @@
 #include "Shader.h"
 
 #include "ServiceBroker.h"
+#include "filesystem/Directory.h"
 #include "filesystem/File.h"
 #include "rendering/RenderSystem.h"
+#include "utils/Digest.h"
 #include "utils/GLUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <cstring>
+#include <vector>
+
 #ifdef HAS_GLES
 #define GLchar char
 #endif
@@ -24,6 +29,101 @@
 using namespace Shaders;
 using namespace XFILE;
 
+#if defined(HAS_GL) || HAS_GLES == 3
+#define HAS_PROGRAM_BINARY
+#endif
+
+namespace
+{
+#ifdef HAS_PROGRAM_BINARY
+constexpr const char* PROGRAM_BINARY_PATH = "special://temp/shadercache/";
+
+bool IsProgramBinarySupported()
+{
+  static const bool supported = []() {
+    const CRenderSystemBase* renderSystem = CServiceBroker::GetRenderSystem();
+    unsigned int major = 0;
+    unsigned int minor = 0;
+    renderSystem->GetRenderVersion(major, minor);
+#if defined(HAS_GL)
+    if ((major < 4 || (major == 4 && minor < 1)) &&
+        !renderSystem->IsExtSupported("GL_ARB_get_program_binary"))
+      return false;
+#else
+    if (major < 3)
+      return false;
+#endif
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    CLog::Log(LOGDEBUG, "GL: {} shader program binary formats", formats);
+    return formats > 0;
+  }();
+  return supported;
+}
+
+/*!
+ \brief Path of the cached binary of a program. Binaries only work with the driver that created
+ them, so the driver is part of the key.
+ */
+std::string GetProgramBinaryPath(const std::string& vertexSource, const std::string& pixelSource)
+{
+  const CRenderSystemBase* renderSystem = CServiceBroker::GetRenderSystem();
+  const std::string key = renderSystem->GetRenderVendor() + '\n' +
+                          renderSystem->GetRenderRenderer() + '\n' +
+                          renderSystem->GetRenderVersionString() + '\n' + vertexSource + '\n' +
+                          pixelSource;
+  return PROGRAM_BINARY_PATH +
+         KODI::UTILITY::CDigest::Calculate(KODI::UTILITY::CDigest::Type::SHA256, key) + ".bin";
+}
+
+bool LoadProgramBinary(GLuint program, const std::string& path)
+{
+  std::vector<uint8_t> data;
+  CFile file;
+  if (file.LoadFile(path, data) <= static_cast<ssize_t>(sizeof(GLenum)))
+    return false;
+
+  GLenum format;
+  std::memcpy(&format, data.data(), sizeof(format));
+  glProgramBinary(program, format, data.data() + sizeof(format),
+                  static_cast<GLsizei>(data.size() - sizeof(format)));
+
+  GLint status = GL_FALSE;
+  glGetProgramiv(program, GL_LINK_STATUS, &status);
+  if (status != GL_TRUE)
+  {
+    // most likely the driver was updated, the program is compiled and stored again
+    CLog::Log(LOGDEBUG, "GL: Discarding cached shader program {}", path);
+    glGetError();
+    CFile::Delete(path);
+    return false;
+  }
+  return true;
+}
+
+void SaveProgramBinary(GLuint program, const std::string& path)
+{
+  GLint length = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0)
+    return;
+
+  std::vector<uint8_t> data(sizeof(GLenum) + length);
+  GLenum format = 0;
+  glGetProgramBinary(program, length, nullptr, &format, data.data() + sizeof(format));
+  if (glGetError() != GL_NO_ERROR)
+    return;
+  std::memcpy(data.data(), &format, sizeof(format));
+
+  CDirectory::Create(PROGRAM_BINARY_PATH);
+  CFile file;
+  if (!file.OpenForWrite(path, true) ||
+      file.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+    CLog::Log(LOGWARNING, "GL: Unable to store shader program {}", path);
+}
+#endif
+} // unnamed namespace
+
 //////////////////////////////////////////////////////////////////////
 // CShader
 //////////////////////////////////////////////////////////////////////
@@ -277,6 +377,27 @@ bool CGLSLShaderProgram::CompileAndLink()
   // free resources
   Free();
 
+  std::string binaryPath;
+#ifdef HAS_PROGRAM_BINARY
+  // linking a cached binary skips compiling, which takes long with some drivers
+  if (IsProgramBinarySupported())
+  {
+    binaryPath = GetProgramBinaryPath(m_pVP->GetSource(), m_pFP->GetSource());
+    m_shaderProgram = glCreateProgram();
+    if (m_shaderProgram && LoadProgramBinary(m_shaderProgram, binaryPath))
+    {
+      m_validated = false;
+      m_ok = true;
+      OnCompiledAndLinked();
+      VerifyGLState();
+      return true;
+    }
+    if (m_shaderProgram)
+      glDeleteProgram(m_shaderProgram);
+    m_shaderProgram = 0;
+  }
+#endif
+
   // compiled vertex shader
   if (!m_pVP->Compile())
   {
@@ -313,6 +434,11 @@ bool CGLSLShaderProgram::CompileAndLink()
     VerifyGLState();
   }
 
+#ifdef HAS_PROGRAM_BINARY
+  if (!binaryPath.empty())
+    glProgramParameteri(m_shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
   // link the program
   glLinkProgram(m_shaderProgram);
   glGetProgramiv(m_shaderProgram, GL_LINK_STATUS, params);
@@ -326,6 +452,11 @@ bool CGLSLShaderProgram::CompileAndLink()
   }
   VerifyGLState();
 
+#ifdef HAS_PROGRAM_BINARY
+  if (!binaryPath.empty())
+    SaveProgramBinary(m_shaderProgram, binaryPath);
+#endif
+
   m_validated = false;
   m_ok = true;
   OnCompiledAndLinked();
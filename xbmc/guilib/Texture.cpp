@@ -48,6 +48,17 @@ CTexture::~CTexture()
 {
   KODI::MEMORY::AlignedFree(m_pixels);
   m_pixels = NULL;
+  CTextureMemory::Remove(m_memoryConsumer, m_accountedMemory);
+}
+
+void CTexture::SetMemoryConsumer(TextureConsumer consumer)
+{
+  if (consumer == m_memoryConsumer)
+    return;
+
+  CTextureMemory::Remove(m_memoryConsumer, m_accountedMemory);
+  CTextureMemory::Add(consumer, m_accountedMemory);
+  m_memoryConsumer = consumer;
 }
 
 void CTexture::Allocate(unsigned int width, unsigned int height, XB_FMT format)
@@ -102,6 +113,12 @@ void CTexture::Allocate(unsigned int width, unsigned int height, XB_FMT format)
 
   KODI::MEMORY::AlignedFree(m_pixels);
   m_pixels = NULL;
+
+  // the texture object on the GPU keeps this size after the pixels are uploaded and freed
+  CTextureMemory::Remove(m_memoryConsumer, m_accountedMemory);
+  m_accountedMemory = static_cast<size_t>(GetPitch()) * GetRows();
+  CTextureMemory::Add(m_memoryConsumer, m_accountedMemory);
+
   if (GetPitch() * GetRows() > 0)
   {
     size_t size = GetPitch() * GetRows();
@@ -124,7 +141,7 @@ void CTexture::Update(unsigned int width,
   if (pixels == NULL)
     return;
 
-  if (format & XB_FMT_DXT_MASK)
+  if ((format & XB_FMT_DXT_MASK) && !CServiceBroker::GetRenderSystem()->SupportsDXT())
     return;
 
   Allocate(width, height, format);
@@ -244,9 +261,11 @@ bool CTexture::LoadFromFileInternal(const std::string& texturePath,
   if (URIUtils::HasExtension(texturePath, ".dds"))
   { // special case for DDS images
     CDDSImage image;
-    if (image.ReadFile(texturePath))
+    if (image.ReadFile(texturePath) && (!(image.GetFormat() & XB_FMT_DXT_MASK) ||
+                                        CServiceBroker::GetRenderSystem()->SupportsDXT()))
     {
-      Update(image.GetWidth(), image.GetHeight(), 0, image.GetFormat(), image.GetData(), false);
+      LoadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetFormat(),
+                     image.GetFormat() != XB_FMT_DXT1, image.GetData());
       return true;
     }
     return false;
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "guilib/TextureFormats.h"
+#include "guilib/TextureMemory.h"
 
 #include <cstddef>
 #include <memory>
@@ -96,10 +97,15 @@ public:
   void SetCacheMemory(bool bCacheMemory) { m_bCacheMemory = bCacheMemory; }
   bool GetCacheMemory() const { return m_bCacheMemory; }
 
+  /*! \brief Account the memory of this texture to another consumer, see CTextureMemory */
+  void SetMemoryConsumer(TextureConsumer consumer);
+  TextureConsumer GetMemoryConsumer() const { return m_memoryConsumer; }
+
   virtual void CreateTextureObject() = 0;
   virtual void DestroyTextureObject() = 0;
   virtual void LoadToGPU() = 0;
   virtual void BindToUnit(unsigned int unit) = 0;
+  bool IsLoadedToGPU() const { return m_loadedToGPU; }
 
   unsigned char* GetPixels() const { return m_pixels; }
   unsigned int GetPitch() const { return GetPitch(m_textureWidth); }
@@ -108,6 +114,7 @@ public:
   unsigned int GetTextureHeight() const { return m_textureHeight; }
   unsigned int GetWidth() const { return m_imageWidth; }
   unsigned int GetHeight() const { return m_imageHeight; }
+  XB_FMT GetTextureFormat() const { return m_format; }
   /*! \brief return the original width of the image, before scaling/cropping */
   unsigned int GetOriginalWidth() const { return m_originalWidth; }
   /*! \brief return the original height of the image, before scaling/cropping */
@@ -157,4 +164,6 @@ protected:
   bool m_mipmapping =  false ;
   TEXTURE_SCALING m_scalingMethod = TEXTURE_SCALING::LINEAR;
   bool m_bCacheMemory = false;
+  TextureConsumer m_memoryConsumer = TextureConsumer::GUI;
+  size_t m_accountedMemory = 0; ///< bytes added to CTextureMemory for this texture
 };
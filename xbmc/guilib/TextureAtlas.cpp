@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TextureAtlas.h"
+
+#include "Texture.h"
+#include "TextureFormats.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+constexpr unsigned int BORDER = 1;
+constexpr unsigned int BYTES_PER_PIXEL = 4;
+} // unnamed namespace
+
+CTextureAtlas::CTextureAtlas(unsigned int size)
+  : m_texture(CTexture::CreateTexture(size, size, XB_FMT_A8R8G8B8))
+{
+  if (m_texture->GetPixels())
+    memset(m_texture->GetPixels(), 0, m_texture->GetPitch() * m_texture->GetRows());
+}
+
+bool CTextureAtlas::CanPack(const CTexture& texture)
+{
+  return texture.GetTextureFormat() == XB_FMT_A8R8G8B8 && texture.GetPixels() &&
+         texture.GetWidth() && texture.GetHeight() && texture.GetWidth() <= MAX_IMAGE_SIZE &&
+         texture.GetHeight() <= MAX_IMAGE_SIZE;
+}
+
+bool CTextureAtlas::Add(const CTexture& texture, unsigned int& x, unsigned int& y)
+{
+  // the pixels are released once the atlas is on the GPU, later images would never show up
+  unsigned char* const pixels = m_texture->GetPixels();
+  if (!pixels)
+    return false;
+
+  const unsigned int width = texture.GetWidth();
+  const unsigned int height = texture.GetHeight();
+  const unsigned int cellWidth = width + 2 * BORDER;
+  const unsigned int cellHeight = height + 2 * BORDER;
+
+  if (m_shelfX + cellWidth > m_texture->GetWidth())
+  {
+    m_shelfX = 0;
+    m_shelfY += m_shelfHeight;
+    m_shelfHeight = 0;
+  }
+  if (cellWidth > m_texture->GetWidth() || m_shelfY + cellHeight > m_texture->GetHeight())
+    return false;
+
+  const unsigned int dstPitch = m_texture->GetPitch();
+  const unsigned int srcPitch = texture.GetPitch();
+  const unsigned char* const src = texture.GetPixels();
+
+  // copy each row including the border, the rows above and below repeat the first and last row
+  for (unsigned int row = 0; row < cellHeight; ++row)
+  {
+    const unsigned int srcRow = row < BORDER ? 0 : std::min(row - BORDER, height - 1);
+    const unsigned char* srcLine = src + srcRow * srcPitch;
+    unsigned char* dstLine = pixels + (m_shelfY + row) * dstPitch + m_shelfX * BYTES_PER_PIXEL;
+
+    memcpy(dstLine, srcLine, BYTES_PER_PIXEL);
+    memcpy(dstLine + BORDER * BYTES_PER_PIXEL, srcLine, width * BYTES_PER_PIXEL);
+    memcpy(dstLine + (BORDER + width) * BYTES_PER_PIXEL,
+           srcLine + (width - 1) * BYTES_PER_PIXEL, BYTES_PER_PIXEL);
+  }
+
+  x = m_shelfX + BORDER;
+  y = m_shelfY + BORDER;
+
+  m_shelfX += cellWidth;
+  m_shelfHeight = std::max(m_shelfHeight, cellHeight);
+  return true;
+}
@@ -0,0 +1,53 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <memory>
+
+class CTexture;
+
+/*!
+ \ingroup textures
+ \brief Packs small textures into one shared texture so that they can be drawn without binding
+ a texture of their own.
+
+ Images are placed on shelves with a one pixel border that repeats their edge pixels, so
+ filtering at the edge of an image does not pick up its neighbours. Images can only be added
+ until the atlas has been uploaded to the GPU, after which a new atlas has to be started.
+ */
+class CTextureAtlas
+{
+public:
+  //! \brief Images larger than this in either dimension are not packed
+  static constexpr unsigned int MAX_IMAGE_SIZE = 64;
+
+  explicit CTextureAtlas(unsigned int size);
+
+  /*!
+   \brief Whether a texture is small enough and in a format that can be packed.
+   */
+  static bool CanPack(const CTexture& texture);
+
+  /*!
+   \brief Copy the image of a texture into the atlas.
+   \param texture the texture to copy, must pass CanPack()
+   \param[out] x horizontal position of the image in the atlas in pixels
+   \param[out] y vertical position of the image in the atlas in pixels
+   \return false if the atlas is full or has already been uploaded
+   */
+  bool Add(const CTexture& texture, unsigned int& x, unsigned int& y);
+
+  const std::shared_ptr<CTexture>& GetTexture() const { return m_texture; }
+
+private:
+  std::shared_ptr<CTexture> m_texture;
+  unsigned int m_shelfX = 0;
+  unsigned int m_shelfY = 0;
+  unsigned int m_shelfHeight = 0;
+};
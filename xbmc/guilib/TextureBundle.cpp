@@ -60,6 +60,12 @@ std::optional<CTextureBundleXBT::Animation> CTextureBundle::LoadAnim(const std::
     return {};
 }
 
+void CTextureBundle::Preload(const std::vector<std::string>& filenames)
+{
+  if (m_useXBT)
+    m_tbXBT.Preload(filenames);
+}
+
 void CTextureBundle::Close()
 {
   m_tbXBT.CloseBundle();
@@ -45,6 +45,13 @@ public:
    */
   std::optional<CTextureBundleXBT::Animation> LoadAnim(const std::string& filename);
 
+  /*!
+   * \brief Decompress textures ahead of loading them, see CTextureBundleXBT::Preload
+   *
+   * \param[in] filenames names of the textures to preload
+   */
+  void Preload(const std::vector<std::string>& filenames);
+
   void Close();
 private:
   CTextureBundleXBT m_tbXBT;
@@ -25,8 +25,11 @@
 #include "windowing/WinSystem.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <exception>
+#include <future>
+#include <thread>
 
 #include <lzo/lzo1x.h>
 #include <lzo/lzoconf.h>
@@ -40,6 +43,11 @@
 #endif
 #endif
 
+namespace
+{
+constexpr size_t MAX_PRELOAD_TASKS = 4;
+} // unnamed namespace
+
 CTextureBundleXBT::CTextureBundleXBT()
   : m_TimeStamp{0}
   , m_themeBundle{false}
@@ -59,6 +67,8 @@ CTextureBundleXBT::~CTextureBundleXBT(void)
 
 void CTextureBundleXBT::CloseBundle()
 {
+  m_preloaded.clear();
+
   if (m_XBTFReader != nullptr && m_XBTFReader->IsOpen())
   {
     XFILE::CXbtManager::GetInstance().Release(CURL(m_path));
@@ -161,12 +171,14 @@ std::optional<CTextureBundleXBT::Texture> CTextureBundleXBT::LoadTexture(
     return {};
 
   const CXBTFFrame& frame = file.GetFrames().at(0);
+  std::vector<std::vector<uint8_t>> preloaded = TakePreloaded(name);
+  preloaded.resize(1);
 
   Texture texture;
   texture.width = frame.GetWidth();
   texture.height = frame.GetHeight();
 
-  texture.texture = ConvertFrameToTexture(filename, frame);
+  texture.texture = ConvertFrameToTexture(filename, frame, preloaded[0]);
   if (!texture.texture)
     return {};
 
@@ -185,6 +197,8 @@ std::optional<CTextureBundleXBT::Animation> CTextureBundleXBT::LoadAnim(const st
     return {};
 
   size_t nTextures = file.GetFrames().size();
+  std::vector<std::vector<uint8_t>> preloaded = TakePreloaded(name);
+  preloaded.resize(nTextures);
 
   Animation animation;
   animation.textures.reserve(nTextures);
@@ -193,7 +207,7 @@ std::optional<CTextureBundleXBT::Animation> CTextureBundleXBT::LoadAnim(const st
   {
     CXBTFFrame& frame = file.GetFrames().at(i);
 
-    std::unique_ptr<CTexture> texture = ConvertFrameToTexture(filename, frame);
+    std::unique_ptr<CTexture> texture = ConvertFrameToTexture(filename, frame, preloaded[i]);
     if (!texture)
       return {};
 
@@ -207,42 +221,100 @@ std::optional<CTextureBundleXBT::Animation> CTextureBundleXBT::LoadAnim(const st
   return std::make_optional<Animation>(std::move(animation));
 }
 
-std::unique_ptr<CTexture> CTextureBundleXBT::ConvertFrameToTexture(const std::string& name,
-                                                                   const CXBTFFrame& frame)
+std::unique_ptr<CTexture> CTextureBundleXBT::ConvertFrameToTexture(
+    const std::string& name, const CXBTFFrame& frame, const std::vector<uint8_t>& pixels)
 {
-  // found texture - allocate the necessary buffers
-  std::vector<unsigned char> buffer(static_cast<size_t>(frame.GetPackedSize()));
+  const uint8_t* data = pixels.empty() ? nullptr : pixels.data();
 
-  // load the compressed texture
-  if (!m_XBTFReader->Load(frame, buffer.data()))
-  {
-    CLog::Log(LOGERROR, "Error loading texture: {}", name);
-    return {};
-  }
+  // uncompressed frames of a mapped bundle are used in place
+  if (!data && !frame.IsPacked())
+    data = m_XBTFReader->GetData(frame);
 
-  // check if it's packed with lzo
-  if (frame.IsPacked())
-  { // unpack
-    std::vector<unsigned char> unpacked(static_cast<size_t>(frame.GetUnpackedSize()));
-    lzo_uint s = (lzo_uint)frame.GetUnpackedSize();
-    if (lzo1x_decompress_safe(buffer.data(), static_cast<lzo_uint>(buffer.size()), unpacked.data(),
-                              &s, NULL) != LZO_E_OK ||
-        s != frame.GetUnpackedSize())
+  std::vector<uint8_t> unpacked;
+  if (!data)
+  {
+    unpacked = UnpackFrame(*m_XBTFReader, frame);
+    if (unpacked.empty())
     {
-      CLog::Log(LOGERROR, "Error loading texture: {}: Decompression error", name);
+      CLog::Log(LOGERROR, "Error loading texture: {}", name);
       return {};
     }
-    buffer = std::move(unpacked);
+    data = unpacked.data();
   }
 
   // create an xbmc texture
   std::unique_ptr<CTexture> texture = CTexture::CreateTexture();
   texture->LoadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, frame.GetFormat(),
-                          frame.HasAlpha(), buffer.data());
+                          frame.HasAlpha(), data);
 
   return texture;
 }
 
+std::vector<std::vector<uint8_t>> CTextureBundleXBT::TakePreloaded(const std::string& name)
+{
+  auto it = m_preloaded.find(name);
+  if (it == m_preloaded.end())
+    return {};
+
+  std::vector<std::vector<uint8_t>> frames = std::move(it->second);
+  m_preloaded.erase(it);
+  return frames;
+}
+
+void CTextureBundleXBT::Preload(const std::vector<std::string>& filenames)
+{
+  m_preloaded.clear();
+
+  if (m_XBTFReader == nullptr || !m_XBTFReader->IsOpen())
+    return;
+
+  std::vector<std::pair<std::string, CXBTFFile>> files;
+  for (const auto& filename : filenames)
+  {
+    std::string name = Normalize(filename);
+    CXBTFFile file;
+    if (m_XBTFReader->Get(name, file) && !file.GetFrames().empty())
+      files.emplace_back(std::move(name), std::move(file));
+  }
+
+  // decompressing a single texture is cheaper than starting a thread for it
+  if (files.size() < 2)
+    return;
+
+  const size_t tasks = std::min<size_t>(
+      {files.size(), MAX_PRELOAD_TASKS, std::max(1u, std::thread::hardware_concurrency())});
+
+  // every task writes its own slots, the map is only touched on this thread
+  const CXBTFReader& reader = *m_XBTFReader;
+  std::vector<std::vector<std::vector<uint8_t>>> unpacked(files.size());
+  std::atomic<size_t> next{0};
+  std::vector<std::future<void>> futures;
+  for (size_t i = 0; i < tasks; ++i)
+  {
+    futures.emplace_back(std::async(std::launch::async, [&reader, &files, &unpacked, &next]() {
+      for (size_t j = next++; j < files.size(); j = next++)
+      {
+        for (const auto& frame : files[j].second.GetFrames())
+        {
+          // uncompressed frames of a mapped bundle are used in place, keep an empty entry
+          if (!frame.IsPacked() && reader.GetData(frame))
+            unpacked[j].emplace_back();
+          else
+            unpacked[j].emplace_back(UnpackFrame(reader, frame));
+        }
+      }
+    }));
+  }
+  for (auto& future : futures)
+    future.wait();
+
+  for (size_t i = 0; i < files.size(); ++i)
+    m_preloaded[files[i].first] = std::move(unpacked[i]);
+
+  CLog::Log(LOGDEBUG, "{} - Preloaded {} textures on {} threads", __FUNCTION__, files.size(),
+            tasks);
+}
+
 void CTextureBundleXBT::SetThemeBundle(bool themeBundle)
 {
   m_themeBundle = themeBundle;
@@ -262,17 +334,24 @@ std::string CTextureBundleXBT::Normalize(std::string name)
 std::vector<uint8_t> CTextureBundleXBT::UnpackFrame(const CXBTFReader& reader,
                                                     const CXBTFFrame& frame)
 {
-  // load the compressed texture
-  std::vector<uint8_t> packedBuffer(static_cast<size_t>(frame.GetPackedSize()));
-  if (!reader.Load(frame, packedBuffer.data()))
+  // read packed frames of a mapped bundle in place, load everything else
+  std::vector<uint8_t> packedBuffer;
+  const uint8_t* packedData = frame.IsPacked() ? reader.GetData(frame) : nullptr;
+  if (!packedData)
   {
-    CLog::Log(LOGERROR, "CTextureBundleXBT: error loading frame");
-    return {};
-  }
+    packedBuffer.resize(static_cast<size_t>(frame.GetPackedSize()));
+    if (!reader.Load(frame, packedBuffer.data()))
+    {
+      CLog::Log(LOGERROR, "CTextureBundleXBT: error loading frame");
+      return {};
+    }
 
-  // if the frame isn't packed there's nothing else to be done
-  if (!frame.IsPacked())
-    return packedBuffer;
+    // if the frame isn't packed there's nothing else to be done
+    if (!frame.IsPacked())
+      return packedBuffer;
+
+    packedData = packedBuffer.data();
+  }
 
   // make sure lzo is initialized
   if (lzo_init() != LZO_E_OK)
@@ -283,7 +362,7 @@ std::vector<uint8_t> CTextureBundleXBT::UnpackFrame(const CXBTFReader& reader,
 
   lzo_uint size = static_cast<lzo_uint>(frame.GetUnpackedSize());
   std::vector<uint8_t> unpackedBuffer(static_cast<size_t>(frame.GetUnpackedSize()));
-  if (lzo1x_decompress_safe(packedBuffer.data(), static_cast<lzo_uint>(packedBuffer.size()),
+  if (lzo1x_decompress_safe(packedData, static_cast<lzo_uint>(frame.GetPackedSize()),
                             unpackedBuffer.data(), &size, nullptr) != LZO_E_OK ||
       size != frame.GetUnpackedSize())
   {
@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <ctime>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -58,6 +59,16 @@ public:
    */
   std::optional<Animation> LoadAnim(const std::string& filename);
 
+  /*!
+   * \brief Decompress textures on worker threads ahead of loading them
+   *
+   * Following LoadTexture and LoadAnim calls for these textures only have to create them.
+   * Textures preloaded by a previous call and not loaded since are dropped.
+   *
+   * \param[in] filenames names of the textures a window is about to load
+   */
+  void Preload(const std::vector<std::string>& filenames);
+
   //! @todo Change return to std::optional<std::vector<uint8_t>>> when c++17 is allowed
   static std::vector<uint8_t> UnpackFrame(const CXBTFReader& reader, const CXBTFFrame& frame);
 
@@ -65,13 +76,17 @@ public:
 
 private:
   bool OpenBundle();
-  std::unique_ptr<CTexture> ConvertFrameToTexture(const std::string& name, const CXBTFFrame& frame);
+  std::unique_ptr<CTexture> ConvertFrameToTexture(const std::string& name,
+                                                  const CXBTFFrame& frame,
+                                                  const std::vector<uint8_t>& pixels);
+  std::vector<std::vector<uint8_t>> TakePreloaded(const std::string& name);
 
   time_t m_TimeStamp;
 
   bool m_themeBundle;
   std::string m_path;
   std::shared_ptr<CXBTFReader> m_XBTFReader;
+  std::map<std::string, std::vector<std::vector<uint8_t>>> m_preloaded; ///< unpacked frames by name
 };
 
 
@@ -9,6 +9,7 @@
 #include "TextureGL.h"
 
 #include "ServiceBroker.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/TextureManager.h"
 #include "rendering/RenderSystem.h"
 #include "settings/AdvancedSettings.h"
@@ -57,6 +58,8 @@ void CGLTexture::LoadToGPU()
     // nothing to load - probably same image (no change)
     return;
   }
+
+  CGUIFrameProfiler::CScope profilerScope(CGUIFrameProfiler::Phase::TEXTURE_UPLOAD);
   if (m_texture == 0)
   {
     // Have OpenGL generate a texture object handle for us
@@ -10,12 +10,16 @@
 
 #include "ServiceBroker.h"
 #include "Texture.h"
+#include "TextureAtlas.h"
+#include "TextureUploader.h"
 #include "URL.h"
 #include "commons/ilog.h"
 #include "filesystem/Directory.h"
 #include "filesystem/File.h"
 #include "guilib/TextureBundle.h"
 #include "guilib/TextureFormats.h"
+#include "guilib/TextureMemory.h"
+#include "rendering/RenderSystem.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -45,6 +49,11 @@
 #include <cassert>
 #include <exception>
 
+namespace
+{
+constexpr unsigned int ATLAS_SIZE = 1024;
+} // unnamed namespace
+
 /************************************************************************/
 /*                                                                      */
 /************************************************************************/
@@ -56,6 +65,8 @@ CTextureArray::CTextureArray(int width, int height, int loops,  bool texCoordsAr
   m_orientation = 0;
   m_texWidth = 0;
   m_texHeight = 0;
+  m_texOffsetX = 0;
+  m_texOffsetY = 0;
   m_texCoordsArePixels = false;
 }
 
@@ -82,6 +93,8 @@ void CTextureArray::Reset()
   m_orientation = 0;
   m_texWidth = 0;
   m_texHeight = 0;
+  m_texOffsetX = 0;
+  m_texOffsetY = 0;
   m_texCoordsArePixels = false;
 }
 
@@ -212,10 +225,19 @@ void CTextureMap::Add(std::unique_ptr<CTexture> texture, int delay)
   m_texture.Add(std::move(texture), delay);
 }
 
+void CTextureMap::AddFromAtlas(std::shared_ptr<CTexture> atlas, int x, int y)
+{
+  m_memUsage += m_texture.m_width * m_texture.m_height * 4;
+
+  m_texture.Add(std::move(atlas), 100);
+  m_texture.m_texOffsetX = x;
+  m_texture.m_texOffsetY = y;
+}
+
 /************************************************************************/
 /*                                                                      */
 /************************************************************************/
-CGUITextureManager::CGUITextureManager(void)
+CGUITextureManager::CGUITextureManager(void) : m_uploader(std::make_unique<CTextureUploader>())
 {
   // we set the theme bundle to be the first bundle (thus prioritizing it)
   m_TexBundle[0].SetThemeBundle(true);
@@ -455,7 +477,8 @@ const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName,
   if (!pTexture) return emptyTexture;
 
   CTextureMap* pMap = new CTextureMap(strTextureName, width, height, 0);
-  pMap->Add(std::move(pTexture), 100);
+  if (bundle < 0 || !AddToAtlas(*pTexture, *pMap))
+    pMap->Add(std::move(pTexture), 100);
   m_vecTextures.push_back(pMap);
 
 #ifdef _DEBUG_TEXTURES
@@ -468,6 +491,34 @@ const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName,
   return pMap->GetTexture();
 }
 
+void CGUITextureManager::PreloadTextures(const std::vector<std::string>& textureNames)
+{
+  std::unique_lock<CCriticalSection> lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+
+  std::vector<std::string> bundled[2];
+  for (const auto& textureName : textureNames)
+  {
+    const auto isNamed = [&textureName](const CTextureMap* pMap)
+    { return pMap->GetName() == textureName; };
+    if (std::any_of(m_vecTextures.begin(), m_vecTextures.end(), isNamed) ||
+        std::any_of(m_unusedTextures.begin(), m_unusedTextures.end(),
+                    [&isNamed](const auto& unused) { return isNamed(unused.first); }))
+      continue;
+
+    const std::string bundledName = CTextureBundle::Normalize(textureName);
+    for (int i = 0; i < 2; i++)
+    {
+      if (m_TexBundle[i].HasFile(bundledName))
+      {
+        bundled[i].emplace_back(textureName);
+        break;
+      }
+    }
+  }
+
+  for (int i = 0; i < 2; i++)
+    m_TexBundle[i].Preload(bundled[i]);
+}
 
 void CGUITextureManager::ReleaseTexture(const std::string& strTextureName, bool immediately /*= false */)
 {
@@ -507,7 +558,9 @@ void CGUITextureManager::FreeUnusedTextures(unsigned int timeDelay)
     auto now = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - i->second);
 
-    if (duration.count() >= timeDelay)
+    // the list is ordered by the time of release, so under memory pressure the least recently
+    // used textures go first
+    if (duration.count() >= timeDelay || CTextureMemory::IsUnderPressure(TextureConsumer::GUI))
     {
       delete i->first;
       i = m_unusedTextures.erase(i);
@@ -540,6 +593,9 @@ void CGUITextureManager::ReleaseHwTexture(unsigned int texture)
 
 void CGUITextureManager::Cleanup()
 {
+  // releases the shared render context while the render system is still alive
+  m_uploader->Stop();
+
   std::unique_lock<CCriticalSection> lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
   ivecTextures i;
@@ -555,9 +611,30 @@ void CGUITextureManager::Cleanup()
   m_TexBundle[1].Close();
   m_TexBundle[0] = CTextureBundle(true);
   m_TexBundle[1] = CTextureBundle();
+  m_atlas.reset();
   FreeUnusedTextures();
 }
 
+bool CGUITextureManager::AddToAtlas(const CTexture& texture, CTextureMap& map)
+{
+  if (!CTextureAtlas::CanPack(texture))
+    return false;
+
+  unsigned int x;
+  unsigned int y;
+  if (!m_atlas || !m_atlas->Add(texture, x, y))
+  {
+    // the current atlas is full or already uploaded, textures keep it alive as long as needed
+    m_atlas = std::make_unique<CTextureAtlas>(
+        std::min(ATLAS_SIZE, CServiceBroker::GetRenderSystem()->GetMaxTextureSize()));
+    if (!m_atlas->Add(texture, x, y))
+      return false;
+  }
+
+  map.AddFromAtlas(m_atlas->GetTexture(), x, y);
+  return true;
+}
+
 void CGUITextureManager::Dump() const
 {
   CLog::Log(LOGDEBUG, "{0}: total texturemaps size: {1}", __FUNCTION__, m_vecTextures.size());
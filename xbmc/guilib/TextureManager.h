@@ -22,6 +22,8 @@
 #include <vector>
 
 class CTexture;
+class CTextureAtlas;
+class CTextureUploader;
 
 /************************************************************************/
 /*                                                                      */
@@ -49,6 +51,8 @@ public:
   int m_loops;
   int m_texWidth;
   int m_texHeight;
+  int m_texOffsetX; ///< position of the image within a shared texture in pixels
+  int m_texOffsetY;
   bool m_texCoordsArePixels;
 };
 
@@ -67,6 +71,13 @@ public:
   virtual ~CTextureMap();
 
   void Add(std::unique_ptr<CTexture> texture, int delay);
+  /*!
+   \brief Use an image packed into a texture atlas as the only frame.
+   \param atlas the atlas texture
+   \param x horizontal position of the image in the atlas in pixels
+   \param y vertical position of the image in the atlas in pixels
+   */
+  void AddFromAtlas(std::shared_ptr<CTexture> atlas, int x, int y);
   bool Release();
 
   const std::string& GetName() const;
@@ -102,6 +113,12 @@ public:
   bool HasTexture(const std::string &textureName, std::string *path = NULL, int *bundle = NULL, int *size = NULL);
   static bool CanLoad(const std::string &texturePath); ///< Returns true if the texture manager can load this texture
   const CTextureArray& Load(const std::string& strTextureName, bool checkBundleOnly = false);
+  /*!
+   \brief Decompress the bundled textures among the given ones that aren't loaded yet in parallel,
+   so loading them afterwards doesn't have to.
+   \param textureNames textures a window is about to load
+   */
+  void PreloadTextures(const std::vector<std::string>& textureNames);
   void ReleaseTexture(const std::string& strTextureName, bool immediately = false);
   void Cleanup();
   void Dump() const;
@@ -116,7 +133,16 @@ public:
 
   void FreeUnusedTextures(unsigned int timeDelay = 0); ///< Free textures (called from app thread only)
   void ReleaseHwTexture(unsigned int texture);
+
+  /*!
+   \brief Get the service uploading textures loaded in the background to the GPU
+   */
+  CTextureUploader& GetUploader() { return *m_uploader; }
+
 protected:
+  bool AddToAtlas(const CTexture& texture, CTextureMap& map);
+
+
   std::vector<CTextureMap*> m_vecTextures;
   std::list<std::pair<CTextureMap*, std::chrono::time_point<std::chrono::steady_clock>>>
       m_unusedTextures;
@@ -126,6 +152,8 @@ protected:
   CTextureBundle m_TexBundle[2];
 
   std::vector<std::string> m_texturePaths;
+  std::unique_ptr<CTextureAtlas> m_atlas; ///< atlas that small bundled images are packed into
+  std::unique_ptr<CTextureUploader> m_uploader;
   CCriticalSection m_section;
 };
 
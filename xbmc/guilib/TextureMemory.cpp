@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TextureMemory.h"
+
+#include "ServiceBroker.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/MemUtils.h"
+
+#include <array>
+#include <atomic>
+
+namespace
+{
+constexpr size_t CONSUMERS = static_cast<size_t>(TextureConsumer::COUNT);
+
+//! share of the budget in percent, in the order of TextureConsumer
+constexpr std::array<int64_t, CONSUMERS> SHARES = {50, 30, 20};
+
+std::array<std::atomic<int64_t>, CONSUMERS> usage{};
+
+int64_t GetDefaultBudget()
+{
+  static const int64_t budget = []
+  {
+    KODI::MEMORY::MemoryStatus stat;
+    KODI::MEMORY::GetMemoryStatus(&stat);
+    return static_cast<int64_t>(stat.totalPhys / 4);
+  }();
+  return budget;
+}
+} // unnamed namespace
+
+void CTextureMemory::Add(TextureConsumer consumer, int64_t bytes)
+{
+  usage[static_cast<size_t>(consumer)].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void CTextureMemory::Remove(TextureConsumer consumer, int64_t bytes)
+{
+  usage[static_cast<size_t>(consumer)].fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+int64_t CTextureMemory::GetUsage(TextureConsumer consumer)
+{
+  return usage[static_cast<size_t>(consumer)].load(std::memory_order_relaxed);
+}
+
+int64_t CTextureMemory::GetTotalUsage()
+{
+  int64_t total = 0;
+  for (const auto& bytes : usage)
+    total += bytes.load(std::memory_order_relaxed);
+  return total;
+}
+
+int64_t CTextureMemory::GetBudget(TextureConsumer consumer)
+{
+  return GetTotalBudget() * SHARES[static_cast<size_t>(consumer)] / 100;
+}
+
+int64_t CTextureMemory::GetTotalBudget()
+{
+  const auto settings = CServiceBroker::GetSettingsComponent();
+  if (settings && settings->GetAdvancedSettings() &&
+      settings->GetAdvancedSettings()->m_textureMemoryBudget > 0)
+    return static_cast<int64_t>(settings->GetAdvancedSettings()->m_textureMemoryBudget) * 1024 *
+           1024;
+
+  return GetDefaultBudget();
+}
+
+bool CTextureMemory::IsUnderPressure(TextureConsumer consumer)
+{
+  const int64_t budget = GetTotalBudget();
+  if (budget <= 0 || GetTotalUsage() < budget)
+    return false;
+
+  return GetUsage(consumer) >= budget * SHARES[static_cast<size_t>(consumer)] / 100;
+}
+
+const char* CTextureMemory::GetName(TextureConsumer consumer)
+{
+  switch (consumer)
+  {
+    case TextureConsumer::GUI:
+      return "gui";
+    case TextureConsumer::LARGE:
+      return "large";
+    case TextureConsumer::SLIDESHOW:
+      return "slideshow";
+    default:
+      return "unknown";
+  }
+}
@@ -0,0 +1,53 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/*!
+ \ingroup textures
+ \brief The parts of Kodi that hold textures, each with its own share of the texture memory budget
+ */
+enum class TextureConsumer
+{
+  GUI, ///< skin and artwork textures of CGUITextureManager
+  LARGE, ///< fanart and other images of CGUILargeTextureManager
+  SLIDESHOW, ///< pictures of the slideshow
+  COUNT
+};
+
+/*!
+ \ingroup textures
+ \brief Accounts the memory taken by textures against a budget.
+
+ Every CTexture adds the size of its pixel data to the consumer it belongs to. The budget is set by
+ the texturememorybudget advanced setting (in MB) and defaults to a quarter of the physical memory,
+ which is shared by GUI, large textures and slideshow in the ratio 50:30:20. A consumer may use the
+ unused shares of the others, it is only under pressure when the whole budget is used up and it
+ holds more than its own share. Consumers under pressure evict their unreferenced textures early
+ and load new ones at a reduced size.
+ */
+class CTextureMemory
+{
+public:
+  static void Add(TextureConsumer consumer, int64_t bytes);
+  static void Remove(TextureConsumer consumer, int64_t bytes);
+
+  static int64_t GetUsage(TextureConsumer consumer);
+  static int64_t GetTotalUsage();
+  static int64_t GetBudget(TextureConsumer consumer);
+  static int64_t GetTotalBudget();
+
+  /*!
+   \brief Whether the consumer should release textures and load new ones at a reduced size
+   */
+  static bool IsUnderPressure(TextureConsumer consumer);
+
+  static const char* GetName(TextureConsumer consumer);
+};
@@ -0,0 +1,134 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TextureUploader.h"
+
+#include "ServiceBroker.h"
+#include "guilib/Texture.h"
+#include "utils/TimeUtils.h"
+#include "utils/log.h"
+#include "windowing/WinSystem.h"
+
+#include <mutex>
+
+namespace
+{
+// texture data the render thread may upload per frame without shared contexts, a 1080p RGBA
+// image is about 8 MB
+constexpr size_t FRAME_UPLOAD_BUDGET = 8 * 1024 * 1024;
+} // unnamed namespace
+
+CTextureUploader::CTextureUploader() : CThread("TextureUploader")
+{
+}
+
+CTextureUploader::~CTextureUploader()
+{
+  Stop();
+}
+
+bool CTextureUploader::Upload(CTexture& texture)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  if (m_state == State::STOPPED)
+  {
+    m_state = State::STARTING;
+    Create();
+  }
+
+  m_stateChanged.wait(lock, [this] { return m_state != State::STARTING; });
+  if (m_state != State::RUNNING)
+    return false;
+
+  Request request{&texture};
+  m_requests.emplace_back(&request);
+  m_requestsChanged.notifyAll();
+
+  m_stateChanged.wait(lock,
+                      [this, &request] { return request.done || m_state != State::RUNNING; });
+  return request.done;
+}
+
+void CTextureUploader::Stop()
+{
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    m_bStop = true;
+    m_requestsChanged.notifyAll();
+  }
+
+  StopThread();
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  m_requests.clear();
+  m_state = State::STOPPED;
+  m_stateChanged.notifyAll();
+}
+
+bool CTextureUploader::TakeFrameBudget(size_t bytes)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+
+  const unsigned int frameTime = CTimeUtils::GetFrameTime();
+  if (frameTime != m_budgetFrameTime)
+  {
+    m_budgetFrameTime = frameTime;
+    m_budgetUsed = 0;
+  }
+
+  if (m_budgetUsed > 0 && m_budgetUsed + bytes > FRAME_UPLOAD_BUDGET)
+    return false;
+
+  m_budgetUsed += bytes;
+  return true;
+}
+
+void CTextureUploader::Process()
+{
+  CWinSystemBase* winSystem = CServiceBroker::GetWinSystem();
+  std::unique_ptr<KODI::WINDOWING::ISharedContext> context;
+  if (winSystem)
+    context = winSystem->CreateSharedContext();
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  if (!context)
+  {
+    CLog::Log(LOGDEBUG, "CTextureUploader: no shared render context, textures are uploaded by "
+                        "the render thread");
+    m_state = State::UNSUPPORTED;
+    m_stateChanged.notifyAll();
+    return;
+  }
+
+  CLog::Log(LOGDEBUG, "CTextureUploader: uploading textures with a shared render context");
+  m_state = State::RUNNING;
+  m_stateChanged.notifyAll();
+
+  while (true)
+  {
+    m_requestsChanged.wait(lock, [this] { return m_bStop || !m_requests.empty(); });
+    if (m_bStop)
+      break;
+
+    std::vector<Request*> requests;
+    requests.swap(m_requests);
+    lock.unlock();
+
+    for (Request* request : requests)
+      request->texture->LoadToGPU();
+
+    // the textures are uploaded either way, at worst the first frames drawing them are incomplete
+    if (!context->Finish())
+      CLog::Log(LOGWARNING, "CTextureUploader: failed to wait for texture uploads");
+
+    lock.lock();
+    for (Request* request : requests)
+      request->done = true;
+    m_stateChanged.notifyAll();
+  }
+}
@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+#include "threads/Thread.h"
+
+#include <cstddef>
+#include <vector>
+
+class CTexture;
+
+/*!
+ \ingroup textures
+ \brief Uploads textures to the GPU on a thread with a render context shared with the GUI one
+
+ Loader jobs hand their decoded textures to Upload(), which returns once the texture is uploaded
+ and fenced, so the render thread gets it ready for use. Where the windowing system doesn't support
+ shared contexts the render thread uploads textures when they are first drawn, and
+ TakeFrameBudget() limits how much new texture data it is handed per frame.
+ */
+class CTextureUploader : private CThread
+{
+public:
+  CTextureUploader();
+  ~CTextureUploader() override;
+
+  /*!
+   \brief Upload a texture on the upload thread and wait until it is ready for use.
+   The thread is started on the first upload. Never call this from the render thread.
+   \param texture the texture to upload, must not be used by other threads until this returns.
+   \return true if the texture was uploaded, false if it has to be uploaded by the render thread.
+   */
+  bool Upload(CTexture& texture);
+
+  /*!
+   \brief Stop the upload thread and release its render context. Waiting uploads fail.
+   */
+  void Stop();
+
+  /*!
+   \brief Check whether the render thread may upload another texture in the current frame.
+   The first texture of a frame is always allowed, so large textures don't starve.
+   \param bytes size of the texture data to upload.
+   \return true if the texture fits into the per-frame upload budget, which is then reduced.
+   */
+  bool TakeFrameBudget(size_t bytes);
+
+private:
+  CTextureUploader(const CTextureUploader&) = delete;
+  CTextureUploader& operator=(const CTextureUploader&) = delete;
+
+  struct Request
+  {
+    CTexture* texture;
+    bool done = false;
+  };
+
+  enum class State
+  {
+    STOPPED,
+    STARTING,
+    RUNNING,
+    UNSUPPORTED,
+  };
+
+  void Process() override;
+
+  CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_requestsChanged;
+  XbmcThreads::ConditionVariable m_stateChanged;
+  std::vector<Request*> m_requests;
+  State m_state = State::STOPPED;
+
+  unsigned int m_budgetFrameTime = 0;
+  size_t m_budgetUsed = 0;
+};
@@ -14,6 +14,15 @@
 #include "XBTFReader.h"
 #include "guilib/XBTF.h"
 #include "utils/EndianSwap.h"
+#include "utils/log.h"
+
+#include <mutex>
+
+#if defined(TARGET_POSIX)
+#include "platform/posix/utils/Mmap.h"
+
+#include <system_error>
+#endif
 
 #ifdef TARGET_WINDOWS
 #include "filesystem/SpecialProtocol.h"
@@ -163,6 +172,25 @@ bool CXBTFReader::Open(const std::string& path)
   if (pos != GetHeaderSize())
     return false;
 
+#if defined(TARGET_POSIX)
+  // map the whole bundle, so frames can be read by several threads at once and without copying
+  struct stat fileStat;
+  if (fstat(fileno(m_file), &fileStat) == 0 && fileStat.st_size > 0)
+  {
+    try
+    {
+      m_mapping = std::make_unique<KODI::UTILS::POSIX::CMmap>(
+          nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fileno(m_file),
+          0);
+    }
+    catch (const std::system_error& e)
+    {
+      CLog::Log(LOGDEBUG, "CXBTFReader: unable to map {}, reading it instead: {}", m_path,
+                e.what());
+    }
+  }
+#endif
+
   return true;
 }
 
@@ -173,6 +201,10 @@ bool CXBTFReader::IsOpen() const
 
 void CXBTFReader::Close()
 {
+#if defined(TARGET_POSIX)
+  m_mapping.reset();
+#endif
+
   if (m_file != nullptr)
   {
     fclose(m_file);
@@ -195,11 +227,31 @@ time_t CXBTFReader::GetLastModificationTimestamp() const
   return fileStat.st_mtime;
 }
 
+const uint8_t* CXBTFReader::GetData(const CXBTFFrame& frame) const
+{
+#if defined(TARGET_POSIX)
+  if (m_mapping && frame.GetOffset() <= m_mapping->Size() &&
+      frame.GetPackedSize() <= m_mapping->Size() - frame.GetOffset())
+    return static_cast<const uint8_t*>(m_mapping->Data()) + frame.GetOffset();
+#endif
+
+  return nullptr;
+}
+
 bool CXBTFReader::Load(const CXBTFFrame& frame, unsigned char* buffer) const
 {
   if (m_file == nullptr)
     return false;
 
+  const uint8_t* data = GetData(frame);
+  if (data)
+  {
+    memcpy(buffer, data, static_cast<size_t>(frame.GetPackedSize()));
+    return true;
+  }
+
+  std::unique_lock<CCriticalSection> lock(m_fileSection);
+
 #if defined(TARGET_DARWIN) || defined(TARGET_FREEBSD)
   if (fseeko(m_file, static_cast<off_t>(frame.GetOffset()), SEEK_SET) == -1)
 #elif defined(TARGET_ANDROID)
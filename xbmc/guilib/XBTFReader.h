@@ -9,12 +9,26 @@
 #pragma once
 
 #include "XBTF.h"
+#include "threads/CriticalSection.h"
 
 #include <memory>
 #include <stdint.h>
 #include <string>
 #include <vector>
 
+#if defined(TARGET_POSIX)
+namespace KODI
+{
+namespace UTILS
+{
+namespace POSIX
+{
+class CMmap;
+}
+} // namespace UTILS
+} // namespace KODI
+#endif
+
 class CXBTFReader : public CXBTFBase
 {
 public:
@@ -29,9 +43,19 @@ public:
 
   bool Load(const CXBTFFrame& frame, unsigned char* buffer) const;
 
+  /*!
+   * \brief Get the stored data of a frame without copying it.
+   * \return pointer into the memory mapped bundle, nullptr if the bundle isn't mapped
+   */
+  const uint8_t* GetData(const CXBTFFrame& frame) const;
+
 private:
   std::string m_path;
   FILE* m_file = nullptr;
+  mutable CCriticalSection m_fileSection; ///< serializes seeking and reading m_file
+#if defined(TARGET_POSIX)
+  std::unique_ptr<KODI::UTILS::POSIX::CMmap> m_mapping;
+#endif
 };
 
 typedef std::shared_ptr<CXBTFReader> CXBTFReaderPtr;
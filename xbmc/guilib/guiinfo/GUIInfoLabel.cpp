@@ -53,12 +53,18 @@ bool CGUIInfoLabel::LabelNeedsUpdate(int context,
   {
     if (portion.m_info)
     {
+      // skip labels whose value is known to be unchanged since the last time
+      const unsigned int version = infoMgr.GetLabelVersion(portion.m_info);
+      if (version && version == portion.m_version)
+        continue;
+
       std::string infoLabel;
       if (preferImages)
         infoLabel = infoMgr.GetImage(portion.m_info, context, fallback);
       if (infoLabel.empty())
         infoLabel = infoMgr.GetLabel(portion.m_info, context, fallback);
       needsUpdate |= portion.NeedsUpdate(infoLabel);
+      portion.m_version = version;
     }
   }
   return needsUpdate;
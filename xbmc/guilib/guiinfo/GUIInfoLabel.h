@@ -131,6 +131,7 @@ private:
     bool NeedsUpdate(const std::string &label) const;
     std::string Get() const;
     int m_info;
+    mutable unsigned int m_version = 0; ///< label version m_label was resolved at, 0 if unversioned
   private:
     bool m_escaped;
     mutable std::string m_label;
@@ -78,6 +78,7 @@
 #define PLAYER_CUTS 70
 #define PLAYER_SCENE_MARKERS 71
 #define PLAYER_HAS_SCENE_MARKERS 72
+#define PLAYER_SEEKPREVIEW 73
 // Keep player infolabels that work with offset and position together
 #define PLAYER_PATH                  81
 #define PLAYER_FILEPATH              82
@@ -390,6 +391,8 @@
 #define VISUALISATION_NAME          412
 #define VISUALISATION_ENABLED       413
 #define VISUALISATION_HAS_PRESETS   414
+#define VISUALISATION_LEVEL         415
+#define VISUALISATION_BAND          416
 
 #define STRING_IS_EMPTY             420
 #define STRING_IS_EQUAL             421
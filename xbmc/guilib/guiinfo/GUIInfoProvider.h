@@ -35,6 +35,8 @@ public:
     return false;
   }
 
+  unsigned int GetLabelVersion(const CGUIInfo& info) const override { return 0; }
+
   void UpdateAVInfo(const AudioStreamInfo& audioInfo, const VideoStreamInfo& videoInfo, const SubtitleStreamInfo& subtitleInfo) override
   { m_audioInfo = audioInfo, m_videoInfo = videoInfo, m_subtitleInfo = subtitleInfo; }
 
@@ -93,6 +93,17 @@ bool CGUIInfoProviders::GetLabel(std::string& value, const CFileItem *item, int
   return false;
 }
 
+unsigned int CGUIInfoProviders::GetLabelVersion(const CGUIInfo& info) const
+{
+  for (const auto& provider : m_providers)
+  {
+    const unsigned int version = provider->GetLabelVersion(info);
+    if (version)
+      return version;
+  }
+  return 0;
+}
+
 bool CGUIInfoProviders::GetInt(int& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const
 {
   for (const auto& provider : m_providers)
@@ -77,6 +77,13 @@ public:
    */
   bool GetLabel(std::string& value, const CFileItem *item, int contextWindow, const CGUIInfo &info, std::string *fallback) const;
 
+  /*!
+   * @brief Get the version of a GUIInfoManager label string from one of the registered providers.
+   * @param info The GUI info (label id + additional data).
+   * @return The version or 0 if the label is not versioned, see IGUIInfoProvider::GetLabelVersion.
+   */
+  unsigned int GetLabelVersion(const CGUIInfo& info) const;
+
   /*!
    * @brief Get a GUIInfoManager integer value from one of the registered providers.
    * @param value Will be filled with the requested value.
@@ -64,6 +64,16 @@ public:
                                 const CGUIInfo& info,
                                 std::string* fallback) = 0;
 
+  /*!
+   * @brief Get a version of a GUIInfoManager label string that changes whenever the label may
+   * have changed, allowing callers to skip resolving labels that are known to be unchanged.
+   * Labels whose version is not 0 must neither depend on the context window nor touch the
+   * fallback value.
+   * @param info The GUI info (label id + additional data).
+   * @return The version or 0 if the label is not versioned and must be resolved every time.
+   */
+  virtual unsigned int GetLabelVersion(const CGUIInfo& info) const = 0;
+
   /*!
    * @brief Get a GUIInfoManager integer value.
    * @param value Will be filled with the requested value.
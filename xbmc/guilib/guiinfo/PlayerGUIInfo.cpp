@@ -11,6 +11,7 @@
 #include "FileItem.h"
 #include "PlayListPlayer.h"
 #include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "URL.h"
 #include "Util.h"
 #include "application/Application.h"
@@ -20,17 +21,21 @@
 #include "cores/AudioEngine/Utils/AEUtil.h"
 #include "cores/DataCacheCore.h"
 #include "cores/EdlEdit.h"
+#include "cores/VideoPlayer/DVDFileInfo.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIDialog.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/guiinfo/GUIInfo.h"
 #include "guilib/guiinfo/GUIInfoHelper.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
+#include "settings/Settings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "utils/AMLUtils.h"
+#include "video/VideoSeekPreviewImageFileLoader.h"
 #include "utils/BitstreamConverter.h"
 
 #include "platform/linux/SysfsPath.h"
@@ -39,6 +44,7 @@
 #include <cmath>
 #include <fmt/format.h>
 #include <memory>
+#include <mutex>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -50,6 +56,7 @@ extern "C"
 }
 
 using namespace KODI::GUILIB::GUIINFO;
+using namespace std::chrono_literals;
 
 CPlayerGUIInfo::CPlayerGUIInfo()
   : m_appPlayer(CServiceBroker::GetAppComponents().GetComponent<CApplicationPlayer>()),
@@ -215,14 +222,58 @@ bool CPlayerGUIInfo::InitCurrentItem(CFileItem *item)
   {
     CLog::Log(LOGDEBUG, "CPlayerGUIInfo::InitCurrentItem({})", CURL::GetRedacted(item->GetPath()));
     m_currentItem = std::make_unique<CFileItem>(*item);
+    InitSeekPreview(*item);
   }
   else
   {
     m_currentItem.reset();
+    InitSeekPreview(CFileItem());
   }
   return false;
 }
 
+void CPlayerGUIInfo::InitSeekPreview(const CFileItem& item)
+{
+  std::unique_lock<CCriticalSection> lock(m_seekPreviewSection);
+  m_seekPreview = {};
+
+  // generated from the same keyframes as the video thumbnails
+  if (!item.IsVideo() || !CDVDFileInfo::CanExtract(item) ||
+      !CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+          CSettings::SETTING_MYVIDEOS_EXTRACTTHUMB))
+    return;
+
+  m_seekPreview.path = item.GetDynPath();
+  CServiceBroker::GetTextureCache()->BackgroundCacheImage(
+      VIDEO::CVideoSeekPreviewImageFileLoader::GetSheetURL(m_seekPreview.path));
+}
+
+std::string CPlayerGUIInfo::GetSeekPreview() const
+{
+  std::unique_lock<CCriticalSection> lock(m_seekPreviewSection);
+  if (m_seekPreview.path.empty())
+    return {};
+
+  if (!m_seekPreview.ready)
+  {
+    // the sheet is generated in the background, don't ask the texture database every frame
+    const auto now = std::chrono::steady_clock::now();
+    if (now - m_seekPreview.lastCheck < 5s)
+      return {};
+
+    m_seekPreview.lastCheck = now;
+    m_seekPreview.ready = CServiceBroker::GetTextureCache()->HasCachedImage(
+        VIDEO::CVideoSeekPreviewImageFileLoader::GetSheetURL(m_seekPreview.path));
+    if (!m_seekPreview.ready)
+      return {};
+  }
+
+  const double seekTime = g_application.GetTime() + m_appPlayer->GetSeekHandler().GetSeekSize();
+  return VIDEO::CVideoSeekPreviewImageFileLoader::GetPreviewURL(
+      m_seekPreview.path, std::llrint(seekTime * 1000),
+      std::llrint(g_application.GetTotalTime() * 1000));
+}
+
 std::string HdrTypeToString(StreamHdrType hdrType) {
   switch (hdrType) {
     case StreamHdrType::HDR_TYPE_NONE: return "SDR";
@@ -449,6 +500,9 @@ bool CPlayerGUIInfo::GetLabel(std::string& value, const CFileItem *item, int con
     case PLAYER_SEEKNUMERIC:
       value = GetSeekTime(static_cast<TIME_FORMAT>(info.GetData1()));
       return !value.empty();
+    case PLAYER_SEEKPREVIEW:
+      value = GetSeekPreview();
+      return true;
     case PLAYER_CACHELEVEL:
     {
       int iLevel = m_appPlayer->GetCacheLevel();
@@ -1069,6 +1123,17 @@ std::string CPlayerGUIInfo::GetContentRanges(int iInfo) const
   data.GetPlayTimes(start, current, min, max);
 
   std::time_t duration = max - start * 1000;
+
+  // the ranges only change with the content or the duration, so they are built once per change
+  const uint64_t version = data.GetVersion(CDataCacheCore::Group::CONTENT);
+  {
+    std::unique_lock<CCriticalSection> lock(m_contentRangesSection);
+    const auto it = m_contentRanges.find(iInfo);
+    if (it != m_contentRanges.end() && it->second.version == version &&
+        it->second.duration == duration)
+      return it->second.values;
+  }
+
   if (duration > 0)
   {
     switch (iInfo)
@@ -1099,6 +1164,9 @@ std::string CPlayerGUIInfo::GetContentRanges(int iInfo) const
       values.pop_back(); // remove trailing comma
   }
 
+  std::unique_lock<CCriticalSection> lock(m_contentRangesSection);
+  m_contentRanges[iInfo] = {version, duration, values};
+
   return values;
 }
 
@@ -9,12 +9,17 @@
 #pragma once
 
 #include "guilib/guiinfo/GUIInfoProvider.h"
+#include "threads/CriticalSection.h"
 #include "utils/EventStream.h"
 #include "utils/TimeFormat.h"
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <ctime>
+#include <map>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -70,6 +75,8 @@ private:
   std::string GetDuration(TIME_FORMAT format) const;
   std::string GetCurrentSeekTime(TIME_FORMAT format) const;
   std::string GetSeekTime(TIME_FORMAT format) const;
+  void InitSeekPreview(const CFileItem& item);
+  std::string GetSeekPreview() const;
 
   std::string GetContentRanges(int iInfo) const;
   std::vector<std::pair<float, float>> GetEditList(const CDataCacheCore& data,
@@ -87,6 +94,24 @@ private:
   const std::shared_ptr<CApplicationPlayer> m_appPlayer;
   const std::shared_ptr<CApplicationVolumeHandling> m_appVolume;
   CEventSource<PlayerShowInfoChangedEvent> m_events;
+
+  struct ContentRanges
+  {
+    uint64_t version = 0; ///< content version of the data cache the ranges were built from
+    std::time_t duration = 0;
+    std::string values;
+  };
+  mutable CCriticalSection m_contentRangesSection;
+  mutable std::map<int, ContentRanges> m_contentRanges;
+
+  struct SeekPreview
+  {
+    std::string path; ///< the video previews are generated for, empty if they are not
+    bool ready = false; ///< whether the sprite sheet of the previews is cached
+    std::chrono::steady_clock::time_point lastCheck;
+  };
+  mutable CCriticalSection m_seekPreviewSection;
+  mutable SeekPreview m_seekPreview;
 };
 
 } // namespace GUIINFO
@@ -83,6 +83,18 @@ bool CSkinGUIInfo::GetLabel(std::string& value, const CFileItem *item, int conte
   return false;
 }
 
+unsigned int CSkinGUIInfo::GetLabelVersion(const CGUIInfo& info) const
+{
+  switch (info.m_info)
+  {
+    case SKIN_BOOL:
+    case SKIN_STRING:
+      return CSkinSettings::GetInstance().GetVersion();
+  }
+
+  return 0;
+}
+
 bool CSkinGUIInfo::GetInt(int& value, const CGUIListItem *gitem, int contextWindow, const CGUIInfo &info) const
 {
   switch (info.m_info)
@@ -23,6 +23,24 @@
 
 using namespace KODI::GUILIB::GUIINFO;
 
+namespace
+{
+bool GetSpectrumValue(int& value, const CGUIInfo& info)
+{
+  CGUIMessage msg(GUI_MSG_GET_VISUALISATION, 0, 0);
+  CServiceBroker::GetGUI()->GetWindowManager().SendMessage(msg);
+  CGUIVisualisationControl* viz = static_cast<CGUIVisualisationControl*>(msg.GetPointer());
+  if (!viz)
+    return false;
+
+  if (info.m_info == VISUALISATION_LEVEL)
+    value = viz->GetSpectrumLevel();
+  else
+    value = viz->GetSpectrumBand(static_cast<unsigned int>(info.GetData1() - 1)); // 1-based in skins
+  return true;
+}
+} // unnamed namespace
+
 bool CVisualisationGUIInfo::InitCurrentItem(CFileItem *item)
 {
   return false;
@@ -63,6 +81,17 @@ bool CVisualisationGUIInfo::GetLabel(std::string& value, const CFileItem *item,
       }
       break;
     }
+    case VISUALISATION_LEVEL:
+    case VISUALISATION_BAND:
+    {
+      int level;
+      if (GetSpectrumValue(level, info))
+      {
+        value = std::to_string(level);
+        return true;
+      }
+      break;
+    }
   }
 
   return false;
@@ -70,6 +99,16 @@ bool CVisualisationGUIInfo::GetLabel(std::string& value, const CFileItem *item,
 
 bool CVisualisationGUIInfo::GetInt(int& value, const CGUIListItem *gitem, int contextWindow, const CGUIInfo &info) const
 {
+  switch (info.m_info)
+  {
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // VISUALISATION_*
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    case VISUALISATION_LEVEL:
+    case VISUALISATION_BAND:
+      return GetSpectrumValue(value, info);
+  }
+
   return false;
 }
 
@@ -20,8 +20,10 @@
 #include "interfaces/AnnouncementManager.h"
 #include "music/MusicThumbLoader.h"
 #include "pictures/PictureThumbLoader.h"
+#include "profiles/ProfileManager.h"
 #include "pvr/PVRManager.h"
 #include "pvr/PVRThumbLoader.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/ExecString.h"
@@ -40,6 +42,9 @@
 #include "video/guilib/VideoPlayActionProcessor.h"
 #include "video/guilib/VideoSelectActionProcessor.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -48,6 +53,169 @@ using namespace XFILE;
 using namespace KODI::MESSAGING;
 using namespace PVR;
 
+namespace
+{
+// enough for the widgets of a few windows
+constexpr size_t MAX_CACHED_CONTENTS = 64;
+
+/*!
+ * \brief The last fetched items of each widget content, so that a window can show them right away
+ * when it's opened again instead of waiting for the directory to be fetched.
+ *
+ * Library changes and playback bump generation counters, which tell whether a cached content is
+ * still up to date. Only library content is known to be; everything else is refreshed in the
+ * background once it was shown.
+ */
+class CContentCache : public ANNOUNCEMENT::IAnnouncer
+{
+public:
+  struct Generations
+  {
+    uint64_t video = 0;
+    uint64_t music = 0;
+    uint64_t playback = 0;
+  };
+
+  struct Content
+  {
+    std::vector<CGUIStaticItemPtr> items;
+    std::string target;
+    std::vector<InfoTagType> itemTypes;
+  };
+
+  Generations GetGenerations()
+  {
+    // not under any lock, announcements are delivered with the manager's lock held
+    if (!m_registered && CServiceBroker::GetAnnouncementManager() && !m_registered.exchange(true))
+      CServiceBroker::GetAnnouncementManager()->AddAnnouncer(this);
+
+    std::unique_lock<CCriticalSection> lock(m_section);
+    return m_generations;
+  }
+
+  /*!
+   * \brief Get a copy of a cached content
+   * \param fresh [out] whether the content is known to be up to date
+   */
+  bool Get(const std::string& key, const std::string& url, SortBy sortBy, Content& content, bool& fresh)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    const auto it = m_contents.find(key);
+    if (it == m_contents.end())
+      return false;
+
+    Entry& entry = it->second;
+    entry.lastUsed = std::chrono::steady_clock::now();
+    content.items = CopyItems(entry.content.items);
+    content.target = entry.content.target;
+    content.itemTypes = entry.content.itemTypes;
+    fresh = IsLibraryContent(url) && entry.generations.video == m_generations.video &&
+            entry.generations.music == m_generations.music &&
+            (entry.generations.playback == m_generations.playback || !IsPlaybackSorted(sortBy));
+    return true;
+  }
+
+  /*!
+   * \brief Cache a content
+   * \param generations the generations from before the content was fetched
+   */
+  void Set(const std::string& key, const Generations& generations, const Content& content)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    if (m_contents.size() >= MAX_CACHED_CONTENTS && m_contents.find(key) == m_contents.end())
+    {
+      const auto leastUsed =
+          std::min_element(m_contents.begin(), m_contents.end(), [](const auto& a, const auto& b)
+                           { return a.second.lastUsed < b.second.lastUsed; });
+      m_contents.erase(leastUsed);
+    }
+
+    Entry& entry = m_contents[key];
+    entry.lastUsed = std::chrono::steady_clock::now();
+    entry.generations = generations;
+    entry.content.items = CopyItems(content.items);
+    entry.content.target = content.target;
+    entry.content.itemTypes = content.itemTypes;
+  }
+
+  void Announce(ANNOUNCEMENT::AnnouncementFlag flag,
+                const std::string& sender,
+                const std::string& message,
+                const CVariant& data) override
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    if (flag & ANNOUNCEMENT::Player)
+    {
+      if (message == "OnPlay" || message == "OnResume" || message == "OnStop")
+        m_generations.playback++;
+      return;
+    }
+
+    if ((flag & (ANNOUNCEMENT::VideoLibrary | ANNOUNCEMENT::AudioLibrary)) == 0 ||
+        (data.isMember("transaction") && data["transaction"].asBoolean()))
+      return;
+
+    // the same library changes CDirectoryProvider refreshes its items on
+    if (message == "OnScanFinished" || message == "OnCleanFinished" || message == "OnUpdate" ||
+        message == "OnRemove" || message == "OnRefresh")
+    {
+      if (flag & ANNOUNCEMENT::VideoLibrary)
+        m_generations.video++;
+      if (flag & ANNOUNCEMENT::AudioLibrary)
+        m_generations.music++;
+    }
+  }
+
+private:
+  struct Entry
+  {
+    std::chrono::steady_clock::time_point lastUsed;
+    Generations generations;
+    Content content;
+  };
+
+  // the items are shown by several containers over time, each needs its own layouts
+  static std::vector<CGUIStaticItemPtr> CopyItems(const std::vector<CGUIStaticItemPtr>& items)
+  {
+    std::vector<CGUIStaticItemPtr> copies;
+    copies.reserve(items.size());
+    for (const auto& item : items)
+      copies.emplace_back(std::make_shared<CGUIStaticItem>(*item));
+    return copies;
+  }
+
+  static bool IsLibraryContent(const std::string& url)
+  {
+    // changes to shared databases made by other clients are not announced
+    const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+    if (StringUtils::EqualsNoCase(advancedSettings->m_databaseVideo.type, "mysql") ||
+        StringUtils::EqualsNoCase(advancedSettings->m_databaseMusic.type, "mysql"))
+      return false;
+
+    return URIUtils::IsProtocol(url, "videodb") || URIUtils::IsProtocol(url, "musicdb") ||
+           URIUtils::HasExtension(url, ".xsp");
+  }
+
+  // lists without a sort order are refreshed as well, e.g. in progress movies
+  static bool IsPlaybackSorted(SortBy sortBy)
+  {
+    return sortBy == SortByNone || sortBy == SortByLastPlayed || sortBy == SortByPlaycount ||
+           sortBy == SortByLastUsed;
+  }
+
+  CCriticalSection m_section;
+  Generations m_generations;
+  std::atomic<bool> m_registered{false};
+  std::map<std::string, Entry> m_contents;
+};
+
+CContentCache& GetContentCache()
+{
+  static CContentCache cache;
+  return cache;
+}
+} // unnamed namespace
+
 class CDirectoryJob : public CJob
 {
 public:
@@ -56,13 +224,17 @@ public:
                 SortDescription sort,
                 int limit,
                 CDirectoryProvider::BrowseMode browse,
-                int parentID)
+                int parentID,
+                const std::string& cacheKey,
+                const CContentCache::Generations& generations)
     : m_url(url),
       m_target(target),
       m_sort(sort),
       m_limit(limit),
       m_browse(browse),
-      m_parentID(parentID)
+      m_parentID(parentID),
+      m_cacheKey(cacheKey),
+      m_generations(generations)
   { }
   ~CDirectoryJob() override = default;
 
@@ -176,6 +348,8 @@ public:
       itemTypes.push_back(i.first);
     return itemTypes;
   }
+  const std::string& GetCacheKey() const { return m_cacheKey; }
+  const CContentCache::Generations& GetGenerations() const { return m_generations; }
 private:
   std::string m_url;
   std::string m_target;
@@ -183,6 +357,8 @@ private:
   unsigned int m_limit;
   CDirectoryProvider::BrowseMode m_browse{CDirectoryProvider::BrowseMode::AUTO};
   int m_parentID;
+  std::string m_cacheKey;
+  CContentCache::Generations m_generations;
   std::vector<CGUIStaticItemPtr> m_items;
   std::map<InfoTagType, std::shared_ptr<CThumbLoader> > m_thumbloaders;
 };
@@ -257,7 +433,29 @@ bool CDirectoryProvider::Update(bool forceRefresh)
   fireJob |= UpdateBrowse();
   fireJob &= !m_currentUrl.empty();
 
+  CContentCache& cache = GetContentCache();
+  const CContentCache::Generations generations = cache.GetGenerations();
+
   std::unique_lock<CCriticalSection> lock(m_section);
+  const std::string target = m_target.GetLabel(m_parentID, false);
+  const std::string cacheKey = GetCacheKey(target);
+
+  // a different content, e.g. when the window was opened again: show its items from the last time
+  if (fireJob)
+  {
+    CContentCache::Content content;
+    bool fresh = false;
+    if (cache.Get(cacheKey, m_currentUrl, m_currentSort.sortBy, content, fresh))
+    {
+      CLog::Log(LOGDEBUG, "CDirectoryProvider[{}]: showing cached items", m_currentUrl);
+      m_items = std::move(content.items);
+      m_currentTarget = std::move(content.target);
+      m_itemTypes = std::move(content.itemTypes);
+      changed = true;
+      fireJob = !fresh;
+    }
+  }
+
   if (m_updateState == INVALIDATED)
     fireJob = true;
   else if (m_updateState == DONE)
@@ -271,8 +469,8 @@ bool CDirectoryProvider::Update(bool forceRefresh)
     if (m_jobID)
       CServiceBroker::GetJobManager()->CancelJob(m_jobID);
     m_jobID = CServiceBroker::GetJobManager()->AddJob(
-        new CDirectoryJob(m_currentUrl, m_target.GetLabel(m_parentID, false), m_currentSort,
-                          m_currentLimit, m_currentBrowse, m_parentID),
+        new CDirectoryJob(m_currentUrl, target, m_currentSort, m_currentLimit, m_currentBrowse,
+                          m_parentID, cacheKey, generations),
         this);
   }
 
@@ -430,11 +628,15 @@ void CDirectoryProvider::OnJobComplete(unsigned int jobID, bool success, CJob *j
   std::unique_lock<CCriticalSection> lock(m_section);
   if (success)
   {
-    m_items = static_cast<CDirectoryJob*>(job)->GetItems();
-    m_currentTarget = static_cast<CDirectoryJob*>(job)->GetTarget();
-    static_cast<CDirectoryJob*>(job)->GetItemTypes(m_itemTypes);
+    const CDirectoryJob* dirJob = static_cast<CDirectoryJob*>(job);
+    m_items = dirJob->GetItems();
+    m_currentTarget = dirJob->GetTarget();
+    dirJob->GetItemTypes(m_itemTypes);
     if (m_updateState == OK)
       m_updateState = DONE;
+
+    GetContentCache().Set(dirJob->GetCacheKey(), dirJob->GetGenerations(),
+                          {m_items, m_currentTarget, m_itemTypes});
   }
   m_jobID = 0;
 }
@@ -649,6 +851,17 @@ bool CDirectoryProvider::OnContextMenu(const std::shared_ptr<CGUIListItem>& item
   return OnContextMenu(fileItem);
 }
 
+std::string CDirectoryProvider::GetCacheKey(const std::string& target) const
+{
+  // the items depend on the profile, and their visibility conditions on the window
+  return StringUtils::Format(
+      "{}|{}|{}|{}|{}|{}|{}|{}|{}",
+      CServiceBroker::GetSettingsComponent()->GetProfileManager()->GetCurrentProfileId(),
+      m_parentID, m_currentUrl, target, static_cast<int>(m_currentSort.sortBy),
+      static_cast<int>(m_currentSort.sortOrder), static_cast<int>(m_currentSort.sortAttributes),
+      m_currentLimit, static_cast<int>(m_currentBrowse));
+}
+
 bool CDirectoryProvider::IsUpdating() const
 {
   std::unique_lock<CCriticalSection> lock(m_section);
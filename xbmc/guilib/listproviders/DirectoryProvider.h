@@ -109,6 +109,7 @@ private:
   void OnPVRManagerEvent(const PVR::PVREvent& event);
   void OnFavouritesEvent(const CFavouritesService::FavouritesUpdated& event);
   std::string GetTarget(const CFileItem& item) const;
+  std::string GetCacheKey(const std::string& target) const;
 
   CCriticalSection m_subscriptionSection;
   bool m_isSubscribed{false};
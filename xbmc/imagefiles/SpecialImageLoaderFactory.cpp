@@ -15,6 +15,7 @@
 #include "video/VideoChapterImageFileLoader.h"
 #include "video/VideoEmbeddedImageFileLoader.h"
 #include "video/VideoGeneratedImageFileLoader.h"
+#include "video/VideoSeekPreviewImageFileLoader.h"
 
 using namespace IMAGE_FILES;
 
@@ -26,6 +27,7 @@ CSpecialImageLoaderFactory::CSpecialImageLoaderFactory()
   m_specialImageLoaders[3] = std::make_unique<CPictureFolderImageFileLoader>();
   m_specialImageLoaders[4] = std::make_unique<VIDEO::CVideoChapterImageFileLoader>();
   m_specialImageLoaders[5] = std::make_unique<PVR::CPVRChannelGroupImageFileLoader>();
+  m_specialImageLoaders[6] = std::make_unique<VIDEO::CVideoSeekPreviewImageFileLoader>();
 }
 
 std::unique_ptr<CTexture> CSpecialImageLoaderFactory::Load(const std::string& specialType,
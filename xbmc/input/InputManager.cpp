@@ -16,6 +16,7 @@
 #include "guilib/GUIAudioManager.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIControl.h"
+#include "guilib/InputLatencyTracker.h"
 #include "guilib/GUIWindow.h"
 #include "guilib/GUIWindowManager.h"
 #include "input/actions/Action.h"
@@ -60,6 +61,9 @@ const std::unordered_map<uint8_t, int> keyComposeactionEventMap = {
     {XBMC_KEYCOMPOSING_COMPOSING, ACTION_KEYBOARD_COMPOSING_KEY},
     {XBMC_KEYCOMPOSING_CANCELLED, ACTION_KEYBOARD_COMPOSING_KEY_CANCELLED},
     {XBMC_KEYCOMPOSING_FINISHED, ACTION_KEYBOARD_COMPOSING_KEY_FINISHED}};
+
+// bounds the time a flood of event server actions can take from rendering a frame
+constexpr int MAX_EVENTSERVER_ACTIONS_PER_FRAME = 16;
 }
 
 CInputManager::CInputManager()
@@ -186,15 +190,25 @@ bool CInputManager::ProcessEventServer(int windowId, float frameTime)
   if (!es || !es->Running() || es->GetNumberOfClients() == 0)
     return false;
 
-  // process any queued up actions
-  if (es->ExecuteNextAction())
+  // process the queued up actions, a burst of them is handled within one frame instead of one
+  // action per frame
+  for (int i = 0; i < MAX_EVENTSERVER_ACTIONS_PER_FRAME; ++i)
   {
+    if (!es->ExecuteNextAction())
+      break;
+
     // reset idle timers
     auto& components = CServiceBroker::GetAppComponents();
     const auto appPower = components.GetComponent<CApplicationPowerHandling>();
     appPower->ResetSystemIdleTimer();
     appPower->ResetScreenSaver();
     appPower->WakeUpScreenSaverAndDPMS();
+
+    // es->ExecuteNextAction() invalidates the ref to the CEventServer instance
+    // when the action exits XBMC
+    es = CEventServer::GetInstance();
+    if (!es || !es->Running() || es->GetNumberOfClients() == 0)
+      return false;
   }
 
   // now handle any buttons or axis
@@ -202,12 +216,6 @@ bool CInputManager::ProcessEventServer(int windowId, float frameTime)
   bool isAxis = false;
   float fAmount = 0.0;
   bool isJoystick = false;
-
-  // es->ExecuteNextAction() invalidates the ref to the CEventServer instance
-  // when the action exits XBMC
-  es = CEventServer::GetInstance();
-  if (!es || !es->Running() || es->GetNumberOfClients() == 0)
-    return false;
   unsigned int wKeyID = es->GetButtonCode(strMapName, isAxis, fAmount, isJoystick);
 
   if (wKeyID)
@@ -318,6 +326,9 @@ void CInputManager::ProcessQueuedActions()
 
 void CInputManager::QueueAction(const CAction& action)
 {
+  if (!action.IsAnalog())
+    CInputLatencyTracker::GetInstance().OnInputReceived();
+
   std::unique_lock<CCriticalSection> lock(m_actionMutex);
 
   // Avoid dispatching multiple analog actions per frame with the same ID
@@ -480,6 +491,9 @@ bool CInputManager::OnEvent(XBMC_Event& newEvent)
 
 bool CInputManager::OnKey(const CKey& key)
 {
+  // key presses of the event server don't pass the application port
+  CInputLatencyTracker::GetInstance().OnInputReceived();
+
   bool bHandled = false;
 
   for (auto handler : m_keyboardHandlers)
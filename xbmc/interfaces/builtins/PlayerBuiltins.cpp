@@ -307,12 +307,12 @@ static int PlayerControl(const std::vector<std::string>& params)
       case PLAYLIST::TYPE_MUSIC:
         CMediaSettings::GetInstance().SetMusicPlaylistShuffled(
             CServiceBroker::GetPlaylistPlayer().IsShuffled(playlistId));
-        CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+        CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
         break;
       case PLAYLIST::TYPE_VIDEO:
         CMediaSettings::GetInstance().SetVideoPlaylistShuffled(
             CServiceBroker::GetPlaylistPlayer().IsShuffled(playlistId));
-        CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+        CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
       default:
         break;
     }
@@ -359,12 +359,12 @@ static int PlayerControl(const std::vector<std::string>& params)
       case PLAYLIST::TYPE_MUSIC:
         CMediaSettings::GetInstance().SetMusicPlaylistRepeat(repeatState ==
                                                              PLAYLIST::RepeatState::ALL);
-        CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+        CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
         break;
       case PLAYLIST::TYPE_VIDEO:
         CMediaSettings::GetInstance().SetVideoPlaylistRepeat(repeatState ==
                                                              PLAYLIST::RepeatState::ALL);
-        CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+        CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
     }
 
     // send messages so now playing window can get updated
@@ -68,7 +68,7 @@ static int ToggleSetting(const std::vector<std::string>& params)
 {
   int setting = CSkinSettings::GetInstance().TranslateBool(params[0]);
   CSkinSettings::GetInstance().SetBool(setting, !CSkinSettings::GetInstance().GetBool(setting));
-  CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+  CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
 
   return 0;
 }
@@ -92,7 +92,7 @@ static int SetAddon(const std::vector<std::string>& params)
   if (!types.empty() && CGUIWindowAddonBrowser::SelectAddonID(types, result, true) == 1)
   {
     CSkinSettings::GetInstance().SetString(string, result);
-    CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+    CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
   }
 
   return 0;
@@ -140,7 +140,7 @@ static int SelectBool(const std::vector<std::string>& params)
       else
         CSkinSettings::GetInstance().SetBool(setting, false);
     }
-    CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+    CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
   }
 
   return 0;
@@ -157,13 +157,13 @@ static int SetBool(const std::vector<std::string>& params)
   {
     int string = CSkinSettings::GetInstance().TranslateBool(params[0]);
     CSkinSettings::GetInstance().SetBool(string, StringUtils::EqualsNoCase(params[1], "true"));
-    CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+    CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
     return 0;
   }
   // default is to set it to true
   int setting = CSkinSettings::GetInstance().TranslateBool(params[0]);
   CSkinSettings::GetInstance().SetBool(setting, true);
-  CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+  CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
 
   return 0;
 }
@@ -211,7 +211,7 @@ static int SetPath(const std::vector<std::string>& params)
   if (CGUIDialogFileBrowser::ShowAndGetDirectory(localShares, g_localizeStrings.Get(657), value))
     CSkinSettings::GetInstance().SetString(string, value);
 
-  CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+  CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
 
   return 0;
 }
@@ -368,7 +368,7 @@ static int SetString(const std::vector<std::string>& params)
   {
     string = CSkinSettings::GetInstance().TranslateString(params[0]);
     CSkinSettings::GetInstance().SetString(string, params[1]);
-    CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+    CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
     return 0;
   }
   else
@@ -440,7 +440,7 @@ static int SetTheme(const std::vector<std::string>& params)
 static int SkinReset(const std::vector<std::string>& params)
 {
   CSkinSettings::GetInstance().Reset(params[0]);
-  CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+  CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
 
   return 0;
 }
@@ -451,7 +451,7 @@ static int SkinReset(const std::vector<std::string>& params)
 static int SkinResetAll(const std::vector<std::string>& params)
 {
   CSkinSettings::GetInstance().Reset();
-  CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
+  CServiceBroker::GetSettingsComponent()->GetSettings()->SaveDeferred();
 
   return 0;
 }
@@ -17,12 +17,20 @@
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <memory>
 #include <mutex>
 #include <utility>
 #include <vector>
 
+namespace
+{
+// number of idle interpreters kept around, e.g. for a video plugin, its context menu entries and
+// a script it runs, so that switching between them does not set up an interpreter every time
+constexpr size_t MAX_REUSABLE_INVOKERS = 4;
+} // unnamed namespace
+
 CScriptInvocationManager::~CScriptInvocationManager()
 {
   Uninitialize();
@@ -73,8 +81,8 @@ void CScriptInvocationManager::Uninitialize()
   // execute Process() once more to handle the remaining scripts
   Process();
 
-  // it is safe to release early, thread must be in m_scripts too
-  m_lastInvokerThread = nullptr;
+  // it is safe to release early, threads must be in m_scripts too
+  m_reusableInvokers.clear();
 
   // make sure all scripts are done
   std::vector<LanguageInvokerThread> tempList;
@@ -176,17 +184,33 @@ bool CScriptInvocationManager::HasLanguageInvoker(const std::string &script) con
   return it != m_invocationHandlers.end() && it->second != NULL;
 }
 
-int CScriptInvocationManager::GetReusablePluginHandle(const std::string& script)
+CScriptInvocationManager::ReusableInvokerList::iterator CScriptInvocationManager::
+    FindReusableInvoker(const std::string& script)
 {
-  std::unique_lock<CCriticalSection> lock(m_critSection);
+  auto it = std::find_if(m_reusableInvokers.begin(), m_reusableInvokers.end(),
+                         [&script](const ReusableInvoker& invoker)
+                         { return invoker.script == script; });
+  if (it == m_reusableInvokers.end())
+    return it;
 
-  if (m_lastInvokerThread)
+  if (!it->thread->Reuseable(script))
   {
-    if (m_lastInvokerThread->Reuseable(script))
-      return m_lastPluginHandle;
-    m_lastInvokerThread->Release();
-    m_lastInvokerThread = nullptr;
+    it->thread->Release();
+    m_reusableInvokers.erase(it);
+    return m_reusableInvokers.end();
   }
+
+  m_reusableInvokers.splice(m_reusableInvokers.begin(), m_reusableInvokers, it);
+  return m_reusableInvokers.begin();
+}
+
+int CScriptInvocationManager::GetReusablePluginHandle(const std::string& script)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+
+  auto it = FindReusableInvoker(script);
+  if (it != m_reusableInvokers.end())
+    return it->pluginHandle;
   return -1;
 }
 
@@ -194,17 +218,13 @@ LanguageInvokerPtr CScriptInvocationManager::GetLanguageInvoker(const std::strin
 {
   std::unique_lock<CCriticalSection> lock(m_critSection);
 
-  if (m_lastInvokerThread)
+  auto reusable = FindReusableInvoker(script);
+  if (reusable != m_reusableInvokers.end())
   {
-    if (m_lastInvokerThread->Reuseable(script))
-    {
-      CLog::Log(LOGDEBUG, "{} - Reusing LanguageInvokerThread {} for script {}", __FUNCTION__,
-                m_lastInvokerThread->GetId(), script);
-      m_lastInvokerThread->GetInvoker()->Reset();
-      return m_lastInvokerThread->GetInvoker();
-    }
-    m_lastInvokerThread->Release();
-    m_lastInvokerThread = nullptr;
+    CLog::Log(LOGDEBUG, "{} - Reusing LanguageInvokerThread {} for script {}", __FUNCTION__,
+              reusable->thread->GetId(), script);
+    reusable->thread->GetInvoker()->Reset();
+    return reusable->thread->GetInvoker();
   }
 
   std::string extension = URIUtils::GetExtension(script);
@@ -256,34 +276,53 @@ int CScriptInvocationManager::ExecuteAsync(
 
   std::unique_lock<CCriticalSection> lock(m_critSection);
 
-  if (m_lastInvokerThread && m_lastInvokerThread->GetInvoker() == languageInvoker)
+  auto reusable = std::find_if(m_reusableInvokers.begin(), m_reusableInvokers.end(),
+                               [&languageInvoker](const ReusableInvoker& invoker)
+                               { return invoker.thread->GetInvoker() == languageInvoker; });
+  if (reusable != m_reusableInvokers.end())
   {
     if (addon != NULL)
-      m_lastInvokerThread->SetAddon(addon);
+      reusable->thread->SetAddon(addon);
 
-    // After we leave the lock, m_lastInvokerThread can be released -> copy!
-    CLanguageInvokerThreadPtr invokerThread = m_lastInvokerThread;
+    // After we leave the lock, the pooled thread can be released -> copy!
+    CLanguageInvokerThreadPtr invokerThread = reusable->thread;
     lock.unlock();
     invokerThread->Execute(script, arguments);
 
     return invokerThread->GetId();
   }
 
-  m_lastInvokerThread = std::make_shared<CLanguageInvokerThread>(languageInvoker, this, reuseable);
-  if (m_lastInvokerThread == NULL)
-    return -1;
+  CLanguageInvokerThreadPtr invokerThread =
+      std::make_shared<CLanguageInvokerThread>(languageInvoker, this, reuseable);
 
   if (addon != NULL)
-    m_lastInvokerThread->SetAddon(addon);
+    invokerThread->SetAddon(addon);
 
-  m_lastInvokerThread->SetId(m_nextId++);
-  m_lastPluginHandle = pluginHandle;
+  invokerThread->SetId(m_nextId++);
+
+  if (reuseable)
+  {
+    // a script only keeps its newest thread, a busy one is not reusable for it anyway
+    auto previous = std::find_if(m_reusableInvokers.begin(), m_reusableInvokers.end(),
+                                 [&script](const ReusableInvoker& invoker)
+                                 { return invoker.script == script; });
+    if (previous != m_reusableInvokers.end())
+    {
+      previous->thread->Release();
+      m_reusableInvokers.erase(previous);
+    }
+
+    m_reusableInvokers.push_front({invokerThread, script, pluginHandle});
+    if (m_reusableInvokers.size() > MAX_REUSABLE_INVOKERS)
+    {
+      m_reusableInvokers.back().thread->Release();
+      m_reusableInvokers.pop_back();
+    }
+  }
 
-  LanguageInvokerThread thread = {m_lastInvokerThread, script, false};
-  m_scripts.insert(std::make_pair(m_lastInvokerThread->GetId(), thread));
-  m_scriptPaths.insert(std::make_pair(script, m_lastInvokerThread->GetId()));
-  // After we leave the lock, m_lastInvokerThread can be released -> copy!
-  CLanguageInvokerThreadPtr invokerThread = m_lastInvokerThread;
+  LanguageInvokerThread thread = {invokerThread, script, false};
+  m_scripts.insert(std::make_pair(invokerThread->GetId(), thread));
+  m_scriptPaths.insert(std::make_pair(script, invokerThread->GetId()));
   lock.unlock();
   invokerThread->Execute(script, arguments);
 
@@ -12,9 +12,11 @@
 #include "interfaces/generic/ILanguageInvoker.h"
 #include "threads/CriticalSection.h"
 
+#include <list>
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 class CLanguageInvokerThread;
@@ -35,7 +37,7 @@ public:
   LanguageInvokerPtr GetLanguageInvoker(const std::string& script);
 
   /*!
-  * \brief Returns addon_handle if last reusable invoker is ready to use.
+  * \brief Returns addon_handle if a reusable invoker for the script is ready to use.
   */
   int GetReusablePluginHandle(const std::string& script);
 
@@ -145,10 +147,25 @@ private:
 
   LanguageInvokerThread getInvokerThread(int scriptId) const;
 
+  struct ReusableInvoker
+  {
+    CLanguageInvokerThreadPtr thread;
+    std::string script;
+    int pluginHandle;
+  };
+  typedef std::list<ReusableInvoker> ReusableInvokerList;
+
+  /*!
+   * \brief Find the idle invoker thread of a script for reuse and mark it as most recently used.
+   * A pooled thread of the script that can't be reused any more is released.
+   */
+  ReusableInvokerList::iterator FindReusableInvoker(const std::string& script);
+
   LanguageInvocationHandlerMap m_invocationHandlers;
   LanguageInvokerThreadMap m_scripts;
-  CLanguageInvokerThreadPtr m_lastInvokerThread;
-  int m_lastPluginHandle = -1;
+  // threads of add-ons with reuselanguageinvoker that keep their interpreter alive after the
+  // script is done, most recently used first
+  ReusableInvokerList m_reusableInvokers;
 
   std::map<std::string, int> m_scriptPaths;
   int m_nextId = 0;
@@ -153,7 +153,7 @@ bool CScriptRunner::WaitOnScriptResult(int scriptId,
     // wait for the script to finish or be cancelled
     while (!IsCancelled() && CScriptInvocationManager::GetInstance().IsRunning(scriptId) &&
            !m_scriptDone.Wait(20ms))
-      ;
+      OnWaiting();
 
     // give the script 30 seconds to exit before we attempt to stop it
     XbmcThreads::EndTime<> timer(30s);
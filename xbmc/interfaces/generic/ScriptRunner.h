@@ -21,6 +21,11 @@ protected:
 
   virtual bool IsSuccessful() const = 0;
   virtual bool IsCancelled() const = 0;
+  /*!
+   * \brief Called periodically while waiting for a script that was started from a thread other
+   * than the main thread
+   */
+  virtual void OnWaiting() {}
 
   ADDON::AddonPtr GetAddon() const;
 
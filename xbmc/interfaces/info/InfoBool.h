@@ -66,6 +66,12 @@ public:
    */
   virtual void Update(int contextWindow, const CGUIListItem* item) {}
 
+  /*! \brief Check whether this info bool never changes its value
+   \param[out] value the value if it is constant
+   \return true if the value is constant, e.g. for "true" or "false"
+   */
+  virtual bool IsConstant(bool& value) const { return false; }
+
   const std::string &GetExpression() const { return m_expression; }
   bool ListItemDependent() const { return m_listItemDependent; }
 protected:
@@ -9,8 +9,12 @@
 #include "InfoExpression.h"
 
 #include "GUIInfoManager.h"
+#include "guilib/GUIFrameProfiler.h"
+#include "guilib/guiinfo/GUIInfoLabels.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <list>
 #include <memory>
 #include <stack>
@@ -25,12 +29,24 @@ void InfoSingle::Initialize(CGUIInfoManager* infoMgr)
 
 void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
 {
+  CGUIFrameProfiler::CScope profilerScope(CGUIFrameProfiler::Phase::INFO_EVALUATION);
+
   // use propagated context in case this info has the default context (i.e. if not tied to a specific window)
   // its value might depend on the context in which the evaluation was called
   int context = m_context == DEFAULT_CONTEXT ? contextWindow : m_context;
   m_value = m_infoMgr->GetBool(m_condition, context, item);
 }
 
+bool InfoSingle::IsConstant(bool& value) const
+{
+  const int condition = std::abs(m_condition);
+  if (condition != SYSTEM_ALWAYS_TRUE && condition != SYSTEM_ALWAYS_FALSE)
+    return false;
+
+  value = (condition == SYSTEM_ALWAYS_TRUE) == (m_condition > 0);
+  return true;
+}
+
 void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
@@ -39,14 +55,34 @@ void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
     CLog::Log(LOGERROR, "Error parsing boolean expression {}", m_expression);
     m_expression_tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
   }
+
+  m_root = Compile(m_expression_tree, m_constantValue);
+  m_expression_tree.reset();
+  if (m_root < 0)
+    m_listItemDependent = false;
 }
 
 void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
 {
+  if (m_root < 0)
+  {
+    m_value = m_constantValue;
+    return;
+  }
+
   // use propagated context in case this info expression has the default context (i.e. if not tied to a specific window)
   // its value might depend on the context in which the evaluation was called
   int context = m_context == DEFAULT_CONTEXT ? contextWindow : m_context;
-  m_value = m_expression_tree->Evaluate(context, item);
+  m_value = Evaluate(m_root, context, item);
+}
+
+bool InfoExpression::IsConstant(bool& value) const
+{
+  if (m_root >= 0)
+    return false;
+
+  value = m_constantValue;
+  return true;
 }
 
 /* Expressions are rewritten at parse time into a form which favours the
@@ -67,11 +103,6 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
  *    operations. So [A|B]|[C|D+[[E|F]|G] becomes A|B|C|[D+[E|F|G]].
  */
 
-bool InfoExpression::InfoLeaf::Evaluate(int contextWindow, const CGUIListItem* item)
-{
-  return m_invert ^ m_info->Get(contextWindow, item);
-}
-
 InfoExpression::InfoAssociativeGroup::InfoAssociativeGroup(
     node_type_t type,
     const InfoSubexpressionPtr &left,
@@ -92,27 +123,74 @@ void InfoExpression::InfoAssociativeGroup::Merge(const std::shared_ptr<InfoAssoc
   m_children.splice(m_children.end(), other->m_children);
 }
 
-bool InfoExpression::InfoAssociativeGroup::Evaluate(int contextWindow, const CGUIListItem* item)
+int InfoExpression::Compile(const InfoSubexpressionPtr& node, bool& value)
 {
+  if (node->Type() == NODE_LEAF)
+  {
+    const auto leaf = std::static_pointer_cast<InfoLeaf>(node);
+    if (leaf->GetInfo()->IsConstant(value))
+    {
+      value ^= leaf->Inverted();
+      return -1;
+    }
+
+    m_infos.push_back(leaf->GetInfo());
+    m_nodes.push_back({NODE_LEAF, leaf->GetInfo().get(), leaf->Inverted(), {}});
+    return static_cast<int>(m_nodes.size() - 1);
+  }
+
+  /* A constant child that decides the group (false for AND, true for OR) makes the whole group
+   * constant, any other constant child can be dropped.
+   */
+  const node_type_t type = node->Type();
+  const bool decisive = type == NODE_OR;
+  std::vector<unsigned int> children;
+  for (const auto& child : std::static_pointer_cast<InfoAssociativeGroup>(node)->GetChildren())
+  {
+    bool childValue;
+    const int index = Compile(child, childValue);
+    if (index >= 0)
+      children.push_back(index);
+    else if (childValue == decisive)
+    {
+      value = decisive;
+      return -1;
+    }
+  }
+
+  if (children.empty())
+  {
+    value = !decisive;
+    return -1;
+  }
+  if (children.size() == 1)
+    return children.front();
+
+  m_nodes.push_back({type, nullptr, false, std::move(children)});
+  return static_cast<int>(m_nodes.size() - 1);
+}
+
+bool InfoExpression::Evaluate(unsigned int index, int contextWindow, const CGUIListItem* item)
+{
+  Node& node = m_nodes[index];
+  if (node.type == NODE_LEAF)
+    return node.invert ^ node.info->Get(contextWindow, item);
+
   /* Handle either AND or OR by using the relation
    * A AND B == !(!A OR !B)
    * to convert ANDs into ORs
    */
-  std::list<InfoSubexpressionPtr>::iterator last = m_children.end();
-  std::list<InfoSubexpressionPtr>::iterator it = m_children.begin();
-  bool use_and = (m_type == NODE_AND);
-  bool result = use_and ^ (*it)->Evaluate(contextWindow, item);
-  while (!result && ++it != last)
+  const bool use_and = (node.type == NODE_AND);
+  for (auto it = node.children.begin(); it != node.children.end(); ++it)
   {
-    result = use_and ^ (*it)->Evaluate(contextWindow, item);
-    if (result)
+    if (use_and ^ Evaluate(*it, contextWindow, item))
     {
       /* Move this child to the head of the list so we evaluate faster next time */
-      m_children.push_front(*it);
-      m_children.erase(it);
+      std::rotate(node.children.begin(), it, it + 1);
+      return !use_and;
     }
   }
-  return use_and ^ result;
+  return use_and;
 }
 
 /* Expressions are parsed using the shunting-yard algorithm. Binary operators
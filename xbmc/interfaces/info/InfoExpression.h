@@ -31,6 +31,7 @@ public:
   void Initialize(CGUIInfoManager* infoMgr) override;
 
   void Update(int contextWindow, const CGUIListItem* item) override;
+  bool IsConstant(bool& value) const override;
 
 private:
   int m_condition;             ///< actual condition this represents
@@ -50,6 +51,7 @@ public:
   void Initialize(CGUIInfoManager* infoMgr) override;
 
   void Update(int contextWindow, const CGUIListItem* item) override;
+  bool IsConstant(bool& value) const override;
 
 private:
   typedef enum
@@ -69,12 +71,11 @@ private:
     NODE_OR,
   } node_type_t;
 
-  // An abstract base class for nodes in the expression tree
+  // An abstract base class for nodes in the expression tree built by the parser
   class InfoSubexpression
   {
   public:
     virtual ~InfoSubexpression(void) = default; // so we can destruct derived classes using a pointer to their base class
-    virtual bool Evaluate(int contextWindow, const CGUIListItem* item) = 0;
     virtual node_type_t Type() const=0;
   };
 
@@ -85,9 +86,11 @@ private:
   {
   public:
     InfoLeaf(InfoPtr info, bool invert) : m_info(std::move(info)), m_invert(invert) {}
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return NODE_LEAF; }
 
+    const InfoPtr& GetInfo() const { return m_info; }
+    bool Inverted() const { return m_invert; }
+
   private:
     InfoPtr m_info;
     bool m_invert;
@@ -100,18 +103,43 @@ private:
     InfoAssociativeGroup(node_type_t type, const InfoSubexpressionPtr &left, const InfoSubexpressionPtr &right);
     void AddChild(const InfoSubexpressionPtr &child);
     void Merge(const std::shared_ptr<InfoAssociativeGroup>& other);
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return m_type; }
 
+    const std::list<InfoSubexpressionPtr>& GetChildren() const { return m_children; }
+
   private:
     node_type_t m_type;
     std::list<InfoSubexpressionPtr> m_children;
   };
 
+  /*! \brief A node of the compiled expression.
+   Leaves point to the info they test, groups hold the indices of their children in m_nodes.
+   */
+  struct Node
+  {
+    node_type_t type;
+    InfoBool* info;
+    bool invert;
+    std::vector<unsigned int> children;
+  };
+
   static operator_t GetOperator(char ch);
   static void OperatorPop(std::stack<operator_t> &operator_stack, bool &invert, std::stack<InfoSubexpressionPtr> &nodes);
   bool Parse(const std::string &expression);
-  InfoSubexpressionPtr m_expression_tree;
+
+  /*! \brief Flatten the parsed tree into m_nodes, folding constant leaves.
+   \param node the subtree to compile
+   \param[out] value the value of the subtree if it is constant
+   \return the index of the compiled subtree in m_nodes or -1 if it is constant
+   */
+  int Compile(const InfoSubexpressionPtr& node, bool& value);
+  bool Evaluate(unsigned int index, int contextWindow, const CGUIListItem* item);
+
+  InfoSubexpressionPtr m_expression_tree; ///< only used while parsing
+  std::vector<Node> m_nodes;
+  std::vector<InfoPtr> m_infos; ///< keeps the infos of the leaves alive
+  int m_root = -1; ///< index of the root in m_nodes or -1 if the expression is constant
+  bool m_constantValue = false;
 };
 
 };
@@ -16,6 +16,8 @@
 #include "application/Application.h"
 #include "dialogs/GUIDialogKaiToast.h"
 #include "guilib/GUIComponent.h"
+#include "guilib/GUIFrameProfiler.h"
+#include "guilib/InputLatencyTracker.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/StereoscopicsManager.h"
 #include "input/WindowTranslator.h"
@@ -139,6 +141,38 @@ JSONRPC_STATUS CGUIOperations::ActivateScreenSaver(const std::string& method,
   return ACK;
 }
 
+JSONRPC_STATUS CGUIOperations::SetFrameProfiler(const std::string& method,
+                                                ITransportLayer* transport,
+                                                IClient* client,
+                                                const CVariant& parameterObject,
+                                                CVariant& result)
+{
+  CGUIFrameProfiler::GetInstance().SetEnabled(parameterObject["enabled"].asBoolean());
+  CInputLatencyTracker::GetInstance().SetEnabled(parameterObject["enabled"].asBoolean());
+  result = CGUIFrameProfiler::IsEnabled();
+  return OK;
+}
+
+JSONRPC_STATUS CGUIOperations::GetFrameProfile(const std::string& method,
+                                               ITransportLayer* transport,
+                                               IClient* client,
+                                               const CVariant& parameterObject,
+                                               CVariant& result)
+{
+  CGUIFrameProfiler::GetInstance().GetTrace(result);
+  return OK;
+}
+
+JSONRPC_STATUS CGUIOperations::GetInputLatency(const std::string& method,
+                                               ITransportLayer* transport,
+                                               IClient* client,
+                                               const CVariant& parameterObject,
+                                               CVariant& result)
+{
+  CInputLatencyTracker::GetInstance().GetReport(result);
+  return OK;
+}
+
 JSONRPC_STATUS CGUIOperations::GetPropertyValue(const std::string &property, CVariant &result)
 {
   if (property == "currentwindow")
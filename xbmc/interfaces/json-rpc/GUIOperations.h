@@ -31,6 +31,21 @@ namespace JSONRPC
                                                   IClient* client,
                                                   const CVariant& parameterObject,
                                                   CVariant& result);
+    static JSONRPC_STATUS SetFrameProfiler(const std::string& method,
+                                           ITransportLayer* transport,
+                                           IClient* client,
+                                           const CVariant& parameterObject,
+                                           CVariant& result);
+    static JSONRPC_STATUS GetFrameProfile(const std::string& method,
+                                          ITransportLayer* transport,
+                                          IClient* client,
+                                          const CVariant& parameterObject,
+                                          CVariant& result);
+    static JSONRPC_STATUS GetInputLatency(const std::string& method,
+                                          ITransportLayer* transport,
+                                          IClient* client,
+                                          const CVariant& parameterObject,
+                                          CVariant& result);
   private:
     static JSONRPC_STATUS GetPropertyValue(const std::string &property, CVariant &result);
     static CVariant GetStereoModeObjectFromGuiMode(const RENDER_STEREO_MODE &mode);
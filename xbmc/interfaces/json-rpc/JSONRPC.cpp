@@ -17,6 +17,7 @@
 #include "addons/IAddon.h"
 #include "addons/addoninfo/AddonInfo.h"
 #include "addons/addoninfo/AddonType.h"
+#include "dbwrappers/Database.h"
 #include "dbwrappers/DatabaseQuery.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIMessage.h"
@@ -258,6 +259,8 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
       }
       else
       {
+        // the calls of a batch share their database connections instead of each connecting anew
+        CDatabase::CConnectionScope connections;
         for (CVariant::const_iterator_array itr = inputroot.begin_array();
              itr != inputroot.end_array(); ++itr)
         {
@@ -176,6 +176,9 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "GUI.SetStereoscopicMode",                      CGUIOperations::SetStereoscopicMode },
   { "GUI.GetStereoscopicModes",                     CGUIOperations::GetStereoscopicModes },
   { "GUI.ActivateScreenSaver",                      CGUIOperations::ActivateScreenSaver},
+  { "GUI.SetFrameProfiler",                         CGUIOperations::SetFrameProfiler },
+  { "GUI.GetFrameProfile",                          CGUIOperations::GetFrameProfile },
+  { "GUI.GetInputLatency",                          CGUIOperations::GetInputLatency },
 
 // PVR operations
   { "PVR.GetProperties",                            CPVROperations::GetProperties },
@@ -240,6 +243,7 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
 // Textures operations
   { "Textures.GetTextures",                         CTextureOperations::GetTextures },
   { "Textures.RemoveTexture",                       CTextureOperations::RemoveTexture },
+  { "Textures.CacheTextures",                       CTextureOperations::CacheTextures },
 
 // Settings operations
   { "Settings.GetSections",                         CSettingsOperations::GetSections },
@@ -254,7 +258,8 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
 
 // XBMC operations
   { "XBMC.GetInfoLabels",                           CXBMCOperations::GetInfoLabels },
-  { "XBMC.GetInfoBooleans",                         CXBMCOperations::GetInfoBooleans }
+  { "XBMC.GetInfoBooleans",                         CXBMCOperations::GetInfoBooleans },
+  { "XBMC.GetJobStatistics",                        CXBMCOperations::GetJobStatistics }
 };
 
 // clang-format on
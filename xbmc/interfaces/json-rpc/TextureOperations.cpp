@@ -95,3 +95,12 @@ JSONRPC_STATUS CTextureOperations::RemoveTexture(const std::string &method, ITra
 
   return ACK;
 }
+
+JSONRPC_STATUS CTextureOperations::CacheTextures(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
+{
+  const CVariant &urls = parameterObject["urls"];
+  for (CVariant::const_iterator_array it = urls.begin_array(); it != urls.end_array(); ++it)
+    CServiceBroker::GetTextureCache()->BackgroundCacheImage(it->asString());
+
+  return ACK;
+}
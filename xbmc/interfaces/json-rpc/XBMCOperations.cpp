@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "messaging/ApplicationMessenger.h"
 #include "powermanagement/PowerManager.h"
+#include "utils/JobManager.h"
 #include "utils/Variant.h"
 
 using namespace JSONRPC;
@@ -86,3 +87,39 @@ JSONRPC_STATUS CXBMCOperations::GetInfoBooleans(const std::string &method, ITran
 
   return OK;
 }
+
+JSONRPC_STATUS CXBMCOperations::GetJobStatistics(const std::string& method,
+                                                 ITransportLayer* transport,
+                                                 IClient* client,
+                                                 const CVariant& parameterObject,
+                                                 CVariant& result)
+{
+  const auto jobManager = CServiceBroker::GetJobManager();
+
+  size_t queued, processing, workers;
+  jobManager->GetQueueInfo(queued, processing, workers);
+  result["queued"] = static_cast<uint64_t>(queued);
+  result["processing"] = static_cast<uint64_t>(processing);
+  result["workers"] = static_cast<uint64_t>(workers);
+
+  result["jobs"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& stats : jobManager->GetStatistics())
+  {
+    CVariant job(CVariant::VariantTypeObject);
+    job["type"] = stats.type;
+    job["completed"] = stats.completed;
+    job["cancelled"] = stats.cancelled;
+    job["queuedtime"] = static_cast<int64_t>(stats.queuedTime.count());
+    job["maxqueuedtime"] = static_cast<int64_t>(stats.maxQueuedTime.count());
+    job["runtime"] = static_cast<int64_t>(stats.runTime.count());
+    job["maxruntime"] = static_cast<int64_t>(stats.maxRunTime.count());
+    job["running"] = stats.running;
+    job["maxrunning"] = stats.maxRunning;
+    result["jobs"].push_back(job);
+  }
+
+  if (parameterObject["reset"].asBoolean())
+    jobManager->ResetStatistics();
+
+  return OK;
+}
@@ -21,19 +21,26 @@ namespace XBMCAddonUtils
   GuiLock::GuiLock(XBMCAddon::LanguageHook* languageHook, bool offScreen)
     : m_languageHook(languageHook), m_offScreen(offScreen)
   {
+    // offscreen items are modified without waiting for the gui, so there is no reason to let
+    // other interpreter threads run in the meantime. Releasing and re-acquiring the interpreter
+    // lock on every setter call is what makes building large plugin listings slow.
+    if (m_offScreen)
+      return;
+
     if (!m_languageHook)
       m_languageHook = XBMCAddon::LanguageHook::GetLanguageHook();
     if (m_languageHook)
       m_languageHook->DelayedCallOpen();
 
-    if (!m_offScreen)
-      g_application.LockFrameMoveGuard();
+    g_application.LockFrameMoveGuard();
   }
 
   GuiLock::~GuiLock()
   {
-    if (!m_offScreen)
-      g_application.UnlockFrameMoveGuard();
+    if (m_offScreen)
+      return;
+
+    g_application.UnlockFrameMoveGuard();
 
     if (m_languageHook)
       m_languageHook->DelayedCallClose();
@@ -83,6 +83,9 @@ namespace XBMCAddon
     ///                                          WindowXML or WindowXMLDialog classes) subsquent
     ///                                          modifications to the item will require locking.
     ///                                          Thus, in such cases, use the default value (`False`).
+    ///                                          Setters of offscreen items also keep the
+    ///                                          interpreter lock, which makes building
+    ///                                          large listings considerably faster.
     ///
     ///
     ///-----------------------------------------------------------------------
@@ -115,8 +115,11 @@ namespace XBMCAddon
       }
 
       if (wait)
+      {
+        DelayedCallGuard dg;
         CServiceBroker::GetAppMessenger()->SendMsg(TMSG_EXECUTE_BUILT_IN, -1, -1, nullptr,
                                                    function);
+      }
       else
         CServiceBroker::GetAppMessenger()->PostMsg(TMSG_EXECUTE_BUILT_IN, -1, -1, nullptr,
                                                    function);
@@ -328,6 +331,7 @@ namespace XBMCAddon
       if (!filename)
         return;
 
+      DelayedCallGuard dg;
       CGUIComponent* gui = CServiceBroker::GetGUI();
       if (CFileUtils::Exists(filename) && gui)
       {
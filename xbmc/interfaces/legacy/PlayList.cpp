@@ -8,6 +8,7 @@
 
 #include "PlayList.h"
 
+#include "LanguageHook.h"
 #include "PlayListPlayer.h"
 #include "ServiceBroker.h"
 #include "playlists/PlayListFactory.h"
@@ -70,9 +71,12 @@ namespace XBMCAddon
         if (nullptr != pPlayList)
         {
           // load it
-          if (!pPlayList->Load(item.GetPath()))
-            //hmmm unable to load playlist?
-            return false;
+          {
+            DelayedCallGuard dc(languageHook);
+            if (!pPlayList->Load(item.GetPath()))
+              //hmmm unable to load playlist?
+              return false;
+          }
 
           // clear current playlist
           CServiceBroker::GetPlaylistPlayer().ClearPlaylist(this->iPlayList);
@@ -23,6 +23,7 @@ namespace XBMCAddon
     void WindowDialogMixin::show()
     {
       XBMC_TRACE;
+      DelayedCallGuard dcguard(w->GetLanguageHook());
       CServiceBroker::GetAppMessenger()->SendMsg(TMSG_GUI_PYTHON_DIALOG, HACK_CUSTOM_ACTION_OPENING,
                                                  0, static_cast<void*>(w->window->get()));
     }
@@ -33,6 +34,7 @@ namespace XBMCAddon
       w->bModal = false;
       w->PulseActionEvent();
 
+      DelayedCallGuard dcguard(w->GetLanguageHook());
       CServiceBroker::GetAppMessenger()->SendMsg(TMSG_GUI_PYTHON_DIALOG, HACK_CUSTOM_ACTION_CLOSING,
                                                  0, static_cast<void*>(w->window->get()));
 
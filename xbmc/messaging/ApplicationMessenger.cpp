@@ -8,12 +8,15 @@
 
 #include "ApplicationMessenger.h"
 
+#include "ServiceBroker.h"
+#include "application/AppInboundProtocol.h"
 #include "guilib/GUIMessage.h"
 #include "messaging/IMessageTarget.h"
 #include "threads/SingleLock.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -23,6 +26,12 @@ namespace KODI
 namespace MESSAGING
 {
 
+namespace
+{
+// time spent on window messages per frame, at least one message is processed
+constexpr auto WINDOW_MESSAGES_BUDGET = std::chrono::milliseconds(8);
+} // unnamed namespace
+
 class CDelayedMessage : public CThread
 {
   public:
@@ -96,7 +105,10 @@ int CApplicationMessenger::SendMsg(ThreadMessage&& message, bool wait)
     // forever!
     if (m_guiThreadId != CThread::GetCurrentThreadId())
     {
-      message.waitEvent = std::make_shared<CEvent>(true);
+      // a thread waits for one message at a time, so it can keep using the same event
+      thread_local std::shared_ptr<CEvent> threadWaitEvent = std::make_shared<CEvent>(true);
+      threadWaitEvent->Reset();
+      message.waitEvent = threadWaitEvent;
       waitEvent = message.waitEvent;
       result = message.result;
     }
@@ -127,6 +139,12 @@ int CApplicationMessenger::SendMsg(ThreadMessage&& message, bool wait)
       //   of the message itself after this point constitutes
       //   a race condition (yarc - "yet another race condition")
       //
+
+  // the render loop may wait for something to happen while the GUI is idle
+  std::shared_ptr<CAppInboundProtocol> appPort = CServiceBroker::GetAppPort();
+  if (appPort)
+    appPort->WakeUp();
+
   if (waitEvent) // ... it just so happens we have a spare reference to the
                  //  waitEvent ... just for such contingencies :)
   {
@@ -249,10 +267,22 @@ void CApplicationMessenger::ProcessMessage(ThreadMessage *pMsg)
 
 void CApplicationMessenger::ProcessWindowMessages()
 {
+  // a flood of posted messages is spread over several frames instead of dropping frames
+  const auto end = std::chrono::steady_clock::now() + WINDOW_MESSAGES_BUDGET;
+  bool first = true;
+
   std::unique_lock<CCriticalSection> lock(m_critSection);
   //message type is window, process window messages
   while (!m_vecWindowMessages.empty())
   {
+    if (!first && std::chrono::steady_clock::now() >= end)
+    {
+      CLog::LogF(LOGDEBUG, "{} window messages left for the next frame",
+                 m_vecWindowMessages.size());
+      break;
+    }
+    first = false;
+
     ThreadMessage* pMsg = m_vecWindowMessages.front();
     //first remove the message from the queue, else the message could be processed more then once
     m_vecWindowMessages.pop();
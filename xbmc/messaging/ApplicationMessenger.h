@@ -382,7 +382,9 @@ public:
   /*!
    * \brief Called from the UI thread to dispatch UI messages
    * This is only of value to implementers of the message pump, do not rely on a specific thread
-   * being used other than that it's appropriate for UI messages
+   * being used other than that it's appropriate for UI messages.
+   * Processing stops after a few milliseconds, the remaining messages are processed on the next
+   * call.
    */
   void ProcessWindowMessages();
 
@@ -53,6 +53,7 @@
 #include "settings/SettingsComponent.h"
 #include "storage/MediaManager.h"
 #include "utils/FileUtils.h"
+#include "utils/FileWriteQueue.h"
 #include "utils/LegacyPathTranslation.h"
 #include "utils/MathUtils.h"
 #include "utils/Random.h"
@@ -79,8 +80,10 @@ using namespace CDDB;
 using namespace MEDIA_DETECT;
 #endif
 
-static void AnnounceRemove(const std::string& content, int id)
+void CMusicDatabase::AnnounceRemove(const std::string& content, int id)
 {
+  LogLibraryChange(content, id, true);
+
   CVariant data;
   data["type"] = content;
   data["id"] = id;
@@ -89,8 +92,12 @@ static void AnnounceRemove(const std::string& content, int id)
   CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::AudioLibrary, "OnRemove", data);
 }
 
-static void AnnounceUpdate(const std::string& content, int id, bool added = false)
+void CMusicDatabase::AnnounceUpdate(const std::string& content,
+                                    int id,
+                                    bool added /* = false */)
 {
+  LogLibraryChange(content, id, false);
+
   CVariant data;
   data["type"] = content;
   data["id"] = id;
@@ -101,6 +108,16 @@ static void AnnounceUpdate(const std::string& content, int id, bool added = fals
   CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::AudioLibrary, "OnUpdate", data);
 }
 
+//! Statement that recomputes the albumcounts rows of the albums matching a condition on idAlbum
+static std::string RefreshAlbumCounts(const std::string& albumCondition)
+{
+  return "REPLACE INTO albumcounts (idAlbum, iTimesPlayed, lastplayed) "
+         "SELECT album.idAlbum, ROUND(AVG(song.iTimesPlayed)), MAX(song.lastplayed) "
+         "FROM album LEFT JOIN song ON song.idAlbum = album.idAlbum "
+         "WHERE album.idAlbum" +
+         albumCondition + " GROUP BY album.idAlbum";
+}
+
 CMusicDatabase::CMusicDatabase(void)
 {
   m_translateBlankArtist = true;
@@ -173,6 +190,12 @@ void CMusicDatabase::CreateTables()
   m_pDS->exec("CREATE TABLE album_artist (idArtist integer, idAlbum integer, iOrder integer, "
               "strArtist text)");
 
+  CLog::Log(LOGINFO, "create albumcounts table");
+  CreateAlbumCountsTable();
+
+  CLog::Log(LOGINFO, "create changelog table");
+  CreateChangeLogTable();
+
   CLog::Log(LOGINFO, "create album_source table");
   m_pDS->exec("CREATE TABLE album_source (idSource INTEGER, idAlbum INTEGER)");
 
@@ -287,6 +310,9 @@ void CMusicDatabase::CreateAnalytics()
 
   m_pDS->exec("CREATE INDEX idxRole on role(strRole(255))");
 
+  m_pDS->exec("CREATE INDEX idxAlbumCounts_1 ON albumcounts(iTimesPlayed)");
+  m_pDS->exec("CREATE INDEX idxAlbumCounts_2 ON albumcounts(lastplayed)");
+
   m_pDS->exec("CREATE INDEX idxDiscography_1 ON discography ( idArtist )");
 
   m_pDS->exec("CREATE INDEX ix_art ON art(media_id, media_type(20), type(20))");
@@ -297,6 +323,7 @@ void CMusicDatabase::CreateAnalytics()
               "  DELETE FROM album_artist WHERE album_artist.idAlbum = old.idAlbum;"
               "  DELETE FROM album_source WHERE album_source.idAlbum = old.idAlbum;"
               "  DELETE FROM art WHERE media_id=old.idAlbum AND media_type='album';"
+              "  DELETE FROM albumcounts WHERE albumcounts.idAlbum = old.idAlbum;"
               " END");
   m_pDS->exec("CREATE TRIGGER tgrDeleteArtist AFTER delete ON artist FOR EACH ROW BEGIN"
               "  DELETE FROM album_artist WHERE album_artist.idArtist = old.idArtist;"
@@ -307,8 +334,9 @@ void CMusicDatabase::CreateAnalytics()
   m_pDS->exec("CREATE TRIGGER tgrDeleteSong AFTER delete ON song FOR EACH ROW BEGIN"
               "  DELETE FROM song_artist WHERE song_artist.idSong = old.idSong;"
               "  DELETE FROM song_genre WHERE song_genre.idSong = old.idSong;"
-              "  DELETE FROM art WHERE media_id=old.idSong AND media_type='song';"
-              " END");
+              "  DELETE FROM art WHERE media_id=old.idSong AND media_type='song'; " +
+              RefreshAlbumCounts(" = old.idAlbum") +
+              "; END");
   m_pDS->exec("CREATE TRIGGER tgrDeleteSource AFTER delete ON source FOR EACH ROW BEGIN"
               "  DELETE FROM source_path WHERE source_path.idSource = old.idSource;"
               "  DELETE FROM album_source WHERE album_source.idSource = old.idSource;"
@@ -396,6 +424,19 @@ void CMusicDatabase::CreateAnalytics()
               "END");
   CreateRemovedLinkTriggers(); // DELETE ON song_artist and album_artist tables
 
+  // Triggers to maintain the play counts of albums, instead of aggregating the songs of every
+  // album whenever albumview is queried. Both SQLite and MySQL allow these as AFTER triggers,
+  // as they modify albumcounts rather than the song table
+  m_pDS->exec("CREATE TRIGGER tgrInsertSongCounts AFTER INSERT ON song FOR EACH ROW BEGIN " +
+              RefreshAlbumCounts(" = NEW.idAlbum") + "; END");
+  m_pDS->exec("CREATE TRIGGER tgrUpdateSongCounts AFTER UPDATE ON song FOR EACH ROW BEGIN " +
+              RefreshAlbumCounts(" IN (OLD.idAlbum, NEW.idAlbum)") + "; END");
+  m_pDS->exec("CREATE TRIGGER tgrInsertAlbumCounts AFTER INSERT ON album FOR EACH ROW BEGIN " +
+              RefreshAlbumCounts(" = NEW.idAlbum") + "; END");
+  // Triggers are dropped while the tables are updated to a new version, so fill the table again
+  m_pDS->exec("DELETE FROM albumcounts");
+  m_pDS->exec(RefreshAlbumCounts(" IS NOT NULL"));
+
   // Create native functions stored in DB (MySQL/MariaDB only)
   CreateNativeDBFunctions();
 
@@ -403,6 +444,13 @@ void CMusicDatabase::CreateAnalytics()
   CreateViews();
 }
 
+void CMusicDatabase::CreateAlbumCountsTable()
+{
+  // Play counts of albums, derived from their songs and maintained by triggers
+  m_pDS->exec("CREATE TABLE albumcounts (idAlbum INTEGER PRIMARY KEY, iTimesPlayed INTEGER, "
+              "lastplayed VARCHAR(20) DEFAULT NULL)");
+}
+
 void CMusicDatabase::CreateRemovedLinkTriggers()
 {
   // DELETE ON song_artist and album_artist tables need to be recreated after cleanup
@@ -492,14 +540,13 @@ void CMusicDatabase::CreateViews()
               "bScrapedMBID,"
               "lastScraped,"
               "dateAdded, dateNew, dateModified, "
-              "(SELECT ROUND(AVG(song.iTimesPlayed)) FROM song "
-              "WHERE song.idAlbum = album.idAlbum) AS iTimesPlayed, "
+              "albumcounts.iTimesPlayed AS iTimesPlayed, "
               "strReleaseType, "
               "iDiscTotal, "
-              "(SELECT MAX(song.lastplayed) FROM song "
-              "WHERE song.idAlbum = album.idAlbum) AS lastplayed, "
+              "albumcounts.lastplayed AS lastplayed, "
               "iAlbumDuration "
-              "FROM album");
+              "FROM album "
+              "LEFT JOIN albumcounts ON albumcounts.idAlbum = album.idAlbum");
 
   CLog::Log(LOGINFO, "create artist view");
   m_pDS->exec("CREATE VIEW artistview AS SELECT"
@@ -6180,13 +6227,37 @@ bool CMusicDatabase::GetSongsFullByWhere(
     if (!BuildSQL(strSQLExtra, extFilter, strSQLExtra))
       return false;
 
+    // Pick a random selection by id rather than with ORDER BY RANDOM() and LIMIT, which makes the
+    // db sort every matching song, then fetch the picked songs like any other list of ids
+    const size_t randomCount =
+        DatabaseUtils::GetLimitCount(sortDescription.limitEnd, sortDescription.limitStart);
+    if (limitedInSQL && sorting.sortBy == SortByRandom && randomCount > 0)
+    {
+      std::vector<int> ids;
+      total = GetRandomIDs("SELECT songview.idSong FROM songview " + strSQLExtra,
+                           static_cast<unsigned int>(randomCount), ids);
+      if (ids.empty())
+        return true;
+
+      std::string idList;
+      for (int id : ids)
+        idList += StringUtils::Format("{},", id);
+      idList.pop_back();
+      extFilter.where = "songview.idSong IN (" + idList + ")";
+      limitedInSQL = false;
+
+      strSQLExtra.clear();
+      if (!BuildSQL(strSQLExtra, extFilter, strSQLExtra))
+        return false;
+    }
     // Count (without group by) number of songs that satisfy selection criteria
     // Much quicker to use song table, not songview, when filtering only on song fields
-    if (extended ||
-        (!extFilter.where.empty() && (extFilter.where.find("strAlbum") != std::string::npos ||
-                                      extFilter.where.find("strPath") != std::string::npos ||
-                                      extFilter.where.find("bCompilation") != std::string::npos ||
-                                      extFilter.where.find("bBoxedset") != std::string::npos)))
+    else if (extended ||
+             (!extFilter.where.empty() &&
+              (extFilter.where.find("strAlbum") != std::string::npos ||
+               extFilter.where.find("strPath") != std::string::npos ||
+               extFilter.where.find("bCompilation") != std::string::npos ||
+               extFilter.where.find("bBoxedset") != std::string::npos)))
       total = GetSingleValueInt("SELECT COUNT(1) FROM songview " + strSQLExtra, m_pDS);
     else
     {
@@ -6276,8 +6347,8 @@ bool CMusicDatabase::GetSongsFullByWhere(
 
     CLog::Log(LOGDEBUG, "{} query = {}", __FUNCTION__, strSQL);
     auto queryStart = std::chrono::steady_clock::now();
-    // run query
-    if (!m_pDS->query(strSQL))
+    // run query, as a prepared statement since list views repeat the same query
+    if (!m_pDS->query(strSQL, dbiplus::sql_params()))
       return false;
 
     int iRowsFound = m_pDS->num_rows();
@@ -7292,11 +7363,11 @@ static const translateJSONField JSONtoDBAlbum[] = {
   { "totaldiscs",               "integer", true,  "iDiscTotal",             "" },
   { "sortartist",                "string", true,  "strArtistSort",          "" },
   { "musicbrainzreleasegroupid", "string", true,  "strReleaseGroupMBID",    "" },
-  { "playcount",                "integer", true,  "iTimesPlayed",           "" },  // Scalar subquery in view
+  { "playcount",                "integer", true,  "iTimesPlayed",           "" },  // From albumcounts table in view
   { "dateadded",                 "string", true,  "dateAdded",              "" },
   { "datenew",                   "string", true,  "dateNew",                "" },
   { "datemodified",              "string", true,  "dateModified",           "" },
-  { "lastplayed",                "string", true,  "lastPlayed",             "" },  // Scalar subquery in view
+  { "lastplayed",                "string", true,  "lastPlayed",             "" },  // From albumcounts table in view
   { "originaldate",              "string", true,  "strOrigReleaseDate",     "" },
   { "releasedate",               "string", true,  "strReleaseDate",         "" },
   { "albumstatus",               "string", true,  "strReleaseStatus",       "" },
@@ -7316,12 +7387,9 @@ static const translateJSONField JSONtoDBAlbum[] = {
    Album "fanart" and "art" fields of JSON schema are fetched using thumbloader
    and separate queries to allow for fallback strategy.
 
-   Using albmview, rather than album table, as view has scalar subqueries for
-   playcount and lastplayed already defined. Needed as MySQL does
-   not support use of scalar subquery field alias names in where clauses (they
-   have to be repeated) and these fields can be used by filter rules.
-   Using this view is no slower than the album table as these scalar fields are
-   only calculated (slowing query) when field is in field list.
+   Using albmview, rather than album table, as view has playcount and lastplayed
+   from the albumcounts table already joined. These fields can be used by filter
+   rules.
   */
 };
 // clang-format on
@@ -9421,6 +9489,15 @@ void CMusicDatabase::UpdateTables(int version)
   if (version < 83)
     m_pDS->exec("ALTER TABLE song ADD strVideoURL TEXT");
 
+  if (version < 84)
+  {
+    // Filled when the triggers are created
+    CreateAlbumCountsTable();
+  }
+
+  if (version < 85)
+    CreateChangeLogTable();
+
   // Set the version of tag scanning required.
   // Not every schema change requires the tags to be rescanned, set to the highest schema version
   // that needs this. Forced rescanning (of music files that have not changed since they were
@@ -9441,7 +9518,7 @@ void CMusicDatabase::UpdateTables(int version)
 
 int CMusicDatabase::GetSchemaVersion() const
 {
-  return 83;
+  return 85;
 }
 
 int CMusicDatabase::GetMusicNeedsTagScan()
@@ -9564,40 +9641,22 @@ std::string CMusicDatabase::GetArtistsLastModified()
 unsigned int CMusicDatabase::GetRandomSongIDs(const Filter& filter,
                                               std::vector<std::pair<int, int>>& songIDs)
 {
-  try
-  {
-    if (nullptr == m_pDB)
-      return 0;
-    if (nullptr == m_pDS)
-      return 0;
+  songIDs.clear();
+  if (nullptr == m_pDB || nullptr == m_pDS)
+    return 0;
 
-    std::string strSQL = "SELECT idSong FROM songview ";
-    if (!CDatabase::BuildSQL(strSQL, filter, strSQL))
-      return false;
-    strSQL += PrepareSQL(" ORDER BY RANDOM()");
+  std::string strSQL = "SELECT idSong FROM songview ";
+  if (!CDatabase::BuildSQL(strSQL, filter, strSQL))
+    return 0;
 
-    if (!m_pDS->query(strSQL))
-      return 0;
-    songIDs.clear();
-    if (m_pDS->num_rows() == 0)
-    {
-      m_pDS->close();
-      return 0;
-    }
-    songIDs.reserve(m_pDS->num_rows());
-    while (!m_pDS->eof())
-    {
-      songIDs.push_back(std::make_pair<int, int>(1, m_pDS->fv(song_idSong).get_asInt()));
-      m_pDS->next();
-    } // cleanup
-    m_pDS->close();
-    return static_cast<unsigned int>(songIDs.size());
-  }
-  catch (...)
-  {
-    CLog::Log(LOGERROR, "{}({}) failed", __FUNCTION__, filter.where);
-  }
-  return 0;
+  // Shuffled here rather than with ORDER BY RANDOM(), so the db does not sort the whole library
+  std::vector<int> ids;
+  GetRandomIDs(strSQL, 0, ids);
+
+  songIDs.reserve(ids.size());
+  for (int id : ids)
+    songIDs.emplace_back(1, id);
+  return static_cast<unsigned int>(songIDs.size());
 }
 
 int CMusicDatabase::GetSongsCount(const Filter& filter)
@@ -11552,7 +11611,11 @@ int CMusicDatabase::GetSongIDFromPath(const std::string& filePath)
 bool CMusicDatabase::CommitTransaction()
 {
   if (CDatabase::CommitTransaction())
-  { // number of items in the db has likely changed, so reset the infomanager cache
+  {
+    if (InWriteBatch())
+      return true; // reset when the batch is committed
+
+    // number of items in the db has likely changed, so reset the infomanager cache
     CGUIComponent* gui = CServiceBroker::GetGUI();
     if (gui)
     {
@@ -11902,6 +11965,9 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
     if (nullptr == m_pDS2)
       return;
 
+    // NFO files and artwork are written in the background while the next items are read
+    CFileWriteQueue writer;
+
     // Create our xml document
     CXBMCTinyXML xmlDoc;
     TiXmlDeclaration decl("1.0", "UTF-8", "yes");
@@ -12017,18 +12083,7 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
               // Save album to NFO, including album path
               album.Save(pMain, "album", strAlbumPath);
               std::string nfoFile = URIUtils::AddFileToFolder(strPath, "album.nfo");
-              if (settings.m_overwrite || !CFile::Exists(nfoFile))
-              {
-                if (!xmlDoc.SaveFile(nfoFile))
-                {
-                  CLog::Log(LOGERROR, "CMusicDatabase::{}: Album nfo export failed! ('{}')",
-                            __FUNCTION__, nfoFile);
-                  CGUIDialogKaiToast::QueueNotification(CGUIDialogKaiToast::Error,
-                                                        g_localizeStrings.Get(20302),
-                                                        CURL::GetRedacted(nfoFile));
-                  iFailCount++;
-                }
-              }
+              writer.SaveNfo(xmlDoc, nfoFile, settings.m_overwrite);
             }
             if (settings.m_artwork)
             {
@@ -12044,8 +12099,7 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
                     savedArtfile = URIUtils::AddFileToFolder(strPath, "folder");
                   else
                     savedArtfile = URIUtils::AddFileToFolder(strPath, art.first);
-                  CServiceBroker::GetTextureCache()->Export(art.second, savedArtfile,
-                                                            settings.m_overwrite);
+                  writer.ExportImage(art.second, savedArtfile, settings.m_overwrite);
                 }
               }
             }
@@ -12162,18 +12216,7 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
               {
                 artist.Save(pMain, "artist", strPath);
                 std::string nfoFile = URIUtils::AddFileToFolder(strPath, "artist.nfo");
-                if (settings.m_overwrite || !CFile::Exists(nfoFile))
-                {
-                  if (!xmlDoc.SaveFile(nfoFile))
-                  {
-                    CLog::Log(LOGERROR, "CMusicDatabase::{}: Artist nfo export failed! ('{}')",
-                              __FUNCTION__, nfoFile);
-                    CGUIDialogKaiToast::QueueNotification(CGUIDialogKaiToast::Error,
-                                                          g_localizeStrings.Get(20302),
-                                                          CURL::GetRedacted(nfoFile));
-                    iFailCount++;
-                  }
-                }
+                writer.SaveNfo(xmlDoc, nfoFile, settings.m_overwrite);
               }
               if (settings.m_artwork)
               {
@@ -12186,8 +12229,7 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
                       savedArtfile = URIUtils::AddFileToFolder(strPath, "folder");
                     else
                       savedArtfile = URIUtils::AddFileToFolder(strPath, art.first);
-                    CServiceBroker::GetTextureCache()->Export(art.second, savedArtfile,
-                                                              settings.m_overwrite);
+                    writer.ExportImage(art.second, savedArtfile, settings.m_overwrite);
                   }
                 }
               }
@@ -12207,6 +12249,9 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
       }
     }
 
+    iFailCount += writer.Wait();
+    writer.LogStatistics("CMusicDatabase::ExportToXML");
+
     if (settings.IsSingleFile())
     {
       std::string xmlFile = URIUtils::AddFileToFolder(
@@ -13048,6 +13093,92 @@ bool CMusicDatabase::GetArtForItem(
   return false;
 }
 
+bool CMusicDatabase::GetArtForItems(const std::string& mediaType,
+                                    const std::vector<int>& mediaIds,
+                                    std::map<int, std::vector<ArtForThumbLoader>>& art)
+{
+  std::string strSQL;
+  try
+  {
+    if (mediaIds.empty())
+      return true;
+    if (mediaType != MediaTypeSong && mediaType != MediaTypeAlbum && mediaType != MediaTypeArtist)
+      return false;
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS2)
+      return false;
+
+    std::string ids;
+    for (const int id : mediaIds)
+    {
+      if (!ids.empty())
+        ids += ',';
+      ids += std::to_string(id);
+    }
+
+    // the same art as GetArtForItem gives for each item, with the item it belongs to as owner
+    strSQL = PrepareSQL("SELECT art_id, media_id AS owner, media_type, type, '' AS prefix, url, "
+                        "0 AS iorder FROM art WHERE media_type = '%s' AND media_id IN (%s)",
+                        mediaType.c_str(), ids.c_str());
+    if (mediaType == MediaTypeAlbum)
+    {
+      strSQL += PrepareSQL(
+          " UNION SELECT art_id, album_artist.idAlbum AS owner, media_type, type, "
+          "'albumartist' AS prefix, url, album_artist.iOrder AS iorder FROM art "
+          "JOIN album_artist ON art.media_id = album_artist.idArtist AND art.media_type = '%s' "
+          "WHERE album_artist.idAlbum IN (%s)",
+          MediaTypeArtist, ids.c_str());
+    }
+    else if (mediaType == MediaTypeSong)
+    {
+      strSQL += PrepareSQL(
+          " UNION SELECT art_id, song.idSong AS owner, media_type, type, '' AS prefix, url, "
+          "0 AS iorder FROM art "
+          "JOIN song ON art.media_id = song.idAlbum AND art.media_type = '%s' "
+          "WHERE song.idSong IN (%s)",
+          MediaTypeAlbum, ids.c_str());
+      strSQL += PrepareSQL(
+          " UNION SELECT art_id, song.idSong AS owner, media_type, type, "
+          "'albumartist' AS prefix, url, album_artist.iOrder AS iorder FROM art "
+          "JOIN album_artist ON art.media_id = album_artist.idArtist AND art.media_type = '%s' "
+          "JOIN song ON song.idAlbum = album_artist.idAlbum "
+          "WHERE song.idSong IN (%s)",
+          MediaTypeArtist, ids.c_str());
+      strSQL += PrepareSQL(
+          " UNION SELECT art_id, song_artist.idSong AS owner, media_type, type, "
+          "'artist' AS prefix, url, song_artist.iOrder AS iorder FROM art "
+          "JOIN song_artist ON art.media_id = song_artist.idArtist AND art.media_type = '%s' "
+          "WHERE song_artist.idSong IN (%s) AND song_artist.idRole = %i",
+          MediaTypeArtist, ids.c_str(), ROLE_ARTIST);
+    }
+
+    m_pDS2->query(strSQL);
+    while (!m_pDS2->eof())
+    {
+      ArtForThumbLoader artitem;
+      artitem.artType = m_pDS2->fv("type").get_asString();
+      artitem.mediaType = m_pDS2->fv("media_type").get_asString();
+      artitem.prefix = m_pDS2->fv("prefix").get_asString();
+      artitem.url = m_pDS2->fv("url").get_asString();
+      int iOrder = m_pDS2->fv("iorder").get_asInt();
+      // Add order to prefix for multiple artist art for songs and albums e.g. "albumartist2"
+      if (iOrder > 0)
+        artitem.prefix += m_pDS2->fv("iorder").get_asString();
+
+      art[m_pDS2->fv("owner").get_asInt()].emplace_back(std::move(artitem));
+      m_pDS2->next();
+    }
+    m_pDS2->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}({}) failed", __FUNCTION__, strSQL);
+  }
+  return false;
+}
+
 bool CMusicDatabase::GetArtForItem(int mediaId,
                                    const std::string& mediaType,
                                    std::map<std::string, std::string>& art)
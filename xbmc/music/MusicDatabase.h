@@ -777,6 +777,19 @@ public:
                      bool bPrimaryArtist,
                      std::vector<ArtForThumbLoader>& art);
 
+  /*! \brief Fetch all related art for several database items of the same media type at once.
+  Gives the same art for each item as GetArtForItem does for a song, an album or an artist id
+  alone, but with a single query for all of them.
+  \param mediaType the media type of the items, song, album or artist
+  \param mediaIds the ids of the items
+  \param art [out] the art by item id, items without art are left out
+  \return false if the query failed
+  \sa GetArtForItem
+  */
+  bool GetArtForItems(const std::string& mediaType,
+                      const std::vector<int>& mediaIds,
+                      std::map<int, std::vector<ArtForThumbLoader>>& art);
+
   /*! \brief Fetch art for a database item.
    Fetches multiple pieces of art for a database item.
    \param mediaId the id in the media (song/artist/album) table.
@@ -899,6 +912,14 @@ private:
   virtual void CreateViews();
   void CreateNativeDBFunctions();
   void CreateRemovedLinkTriggers();
+  void CreateAlbumCountsTable();
+
+  /*! \brief Announce the removal of a library item and record it for other instances
+   */
+  void AnnounceRemove(const std::string& content, int id);
+  /*! \brief Announce an added or updated library item and record it for other instances
+   */
+  void AnnounceUpdate(const std::string& content, int id, bool added = false);
 
   void SplitPath(const std::string& strFileNameAndPath,
                  std::string& strPath,
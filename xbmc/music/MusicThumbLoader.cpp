@@ -40,9 +40,45 @@ void CMusicThumbLoader::OnLoaderFinish()
 {
   m_musicDatabase->Close();
   m_albumArt.clear();
+  m_preparedArt.clear();
   CThumbLoader::OnLoaderFinish();
 }
 
+void CMusicThumbLoader::PrepareItemsCached(const std::vector<CFileItem*>& items)
+{
+  m_preparedArt.clear();
+
+  // collect the library items FillLibraryArt would otherwise query one by one
+  std::map<std::string, std::vector<int>> mediaIds;
+  for (const CFileItem* item : items)
+  {
+    if (item->m_bIsShareOrDrive || !item->HasMusicInfoTag() ||
+        item->GetProperty("libraryartfilled").asBoolean())
+      continue;
+
+    const CMusicInfoTag& tag = *item->GetMusicInfoTag();
+    if (tag.GetDatabaseId() > -1 &&
+        (tag.GetType() == MediaTypeSong || tag.GetType() == MediaTypeAlbum ||
+         tag.GetType() == MediaTypeArtist))
+      mediaIds[tag.GetType()].push_back(tag.GetDatabaseId());
+  }
+
+  if (mediaIds.empty())
+    return;
+
+  m_musicDatabase->Open();
+  for (const auto& [mediaType, ids] : mediaIds)
+  {
+    std::map<int, std::vector<ArtForThumbLoader>> art;
+    if (!m_musicDatabase->GetArtForItems(mediaType, ids, art))
+      continue;
+    // items without art are prepared as well, so that they aren't queried again
+    for (const int id : ids)
+      m_preparedArt[std::make_pair(mediaType, id)] = std::move(art[id]);
+  }
+  m_musicDatabase->Close();
+}
+
 bool CMusicThumbLoader::LoadItem(CFileItem* pItem)
 {
   bool result  = LoadItemCached(pItem);
@@ -163,9 +199,15 @@ bool CMusicThumbLoader::FillLibraryArt(CFileItem &item)
       (tag.GetType() == MediaTypeSong || tag.GetType() == MediaTypeAlbum ||
        tag.GetType() == MediaTypeArtist))
   {
-    // Item in music library, fetch the art
+    // Item in music library, fetch the art unless it was fetched along with its batch
+    const auto prepared = m_preparedArt.find(std::make_pair(tag.GetType(), tag.GetDatabaseId()));
     m_musicDatabase->Open();
-    if (tag.GetType() == MediaTypeSong)
+    if (prepared != m_preparedArt.end())
+    {
+      art = prepared->second;
+      artfound = !art.empty();
+    }
+    else if (tag.GetType() == MediaTypeSong)
       artfound = m_musicDatabase->GetArtForItem(tag.GetDatabaseId(), tag.GetAlbumId(), -1, false, art);
     else if (tag.GetType() == MediaTypeAlbum)
       artfound = m_musicDatabase->GetArtForItem(-1, tag.GetDatabaseId(), -1, false, art);
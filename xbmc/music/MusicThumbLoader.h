@@ -9,11 +9,14 @@
 #pragma once
 
 #include "ThumbLoader.h"
+#include "music/MusicDatabase.h"
 
 #include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 class CFileItem;
-class CMusicDatabase;
 class EmbeddedArt;
 
 class CMusicThumbLoader : public CThumbLoader
@@ -24,6 +27,7 @@ public:
 
   void OnLoaderStart() override;
   void OnLoaderFinish() override;
+  void PrepareItemsCached(const std::vector<CFileItem*>& items) override;
 
   bool LoadItem(CFileItem* pItem) override;
   bool LoadItemCached(CFileItem* pItem) override;
@@ -55,4 +59,6 @@ protected:
   CMusicDatabase *m_musicDatabase;
   typedef std::map<int, std::map<std::string, std::string> > ArtCache;
   ArtCache m_albumArt;
+  // art of the library items of the current batch, by media type and id
+  std::map<std::pair<std::string, int>, std::vector<ArtForThumbLoader>> m_preparedArt;
 };
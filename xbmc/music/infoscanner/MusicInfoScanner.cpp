@@ -21,6 +21,7 @@
 #include "addons/AddonSystemSettings.h"
 #include "addons/Scraper.h"
 #include "addons/addoninfo/AddonType.h"
+#include "cores/paplayer/LoudnessAnalyzer.h"
 #include "dialogs/GUIDialogExtendedProgressBar.h"
 #include "dialogs/GUIDialogProgress.h"
 #include "dialogs/GUIDialogSelect.h"
@@ -44,15 +45,19 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
 #include "utils/Digest.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/FileUtils.h"
+#include "utils/JobManager.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
 #include <algorithm>
+#include <mutex>
 #include <utility>
 
 using namespace MUSIC_INFO;
@@ -141,7 +146,11 @@ void CMusicInfoScanner::Process()
 
         // Clear list of albums added by this scan
         m_albumsAdded.clear();
+        m_musicDatabase.BeginWriteBatch(
+            CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_libraryWriteBatch);
         bool scancomplete = DoScan(it);
+        // commit before the slower scraping, which must not hold the database locked
+        m_musicDatabase.EndWriteBatch();
         if (scancomplete)
         {
           if (m_albumsAdded.size() > 0)
@@ -565,13 +574,13 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
 CInfoScanner::INFO_RET CMusicInfoScanner::ScanTags(const CFileItemList& items,
                                                    CFileItemList& scannedItems)
 {
-  std::vector<std::string> regexps = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioExcludeFromScanRegExps;
+  const std::shared_ptr<CAdvancedSettings> advancedSettings =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  const std::vector<std::string>& regexps = advancedSettings->m_audioExcludeFromScanRegExps;
 
+  std::vector<CFileItemPtr> songItems;
   for (int i = 0; i < items.Size(); ++i)
   {
-    if (m_bStop)
-      return INFO_CANCELLED;
-
     CFileItemPtr pItem = items[i];
 
     if (CUtil::ExcludeFileOrFolder(pItem->GetPath(), regexps))
@@ -580,15 +589,89 @@ CInfoScanner::INFO_RET CMusicInfoScanner::ScanTags(const CFileItemList& items,
     if (pItem->m_bIsFolder || pItem->IsPlayList() || pItem->IsPicture() || pItem->IsLyrics())
       continue;
 
-    m_currentItem++;
+    songItems.emplace_back(std::move(pItem));
+  }
 
-    CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
-    if (!tag.Loaded())
+  // Reading a tag is mostly waiting for the file system, so the tags of several files are read
+  // at the same time. The results are still collected in the order of the items. Measuring the
+  // loudness of files without ReplayGain decodes them in the same jobs, so that files are
+  // decoded in parallel as well.
+  const bool analyzeLoudness = advancedSettings->m_bMusicLibraryAnalyzeLoudness;
+  CCriticalSection loadedSection;
+  CEvent itemLoaded;
+  std::vector<bool> loaded(songItems.size(), false);
+
+  const auto waitLoaded = [&](size_t i)
+  {
+    while (true)
     {
-      std::unique_ptr<IMusicInfoTagLoader> pLoader (CMusicInfoTagLoaderFactory::CreateLoader(*pItem));
-      if (nullptr != pLoader)
-        pLoader->Load(pItem->GetPath(), tag);
+      {
+        std::unique_lock<CCriticalSection> lock(loadedSection);
+        if (loaded[i])
+          return;
+      }
+      itemLoaded.Wait();
     }
+  };
+
+  CJobQueue queue(false, advancedSettings->m_iMusicLibraryTagReadConcurrency, CJob::PRIORITY_LOW);
+  for (size_t i = 0; i < songItems.size(); ++i)
+  {
+    CFileItemPtr pItem = songItems[i];
+    if (pItem->GetMusicInfoTag()->Loaded())
+    {
+      loaded[i] = true;
+      continue;
+    }
+
+    queue.Submit(
+        [&, i, pItem]()
+        {
+          if (!m_bStop)
+          {
+            std::unique_ptr<IMusicInfoTagLoader> pLoader(
+                CMusicInfoTagLoaderFactory::CreateLoader(*pItem));
+            if (nullptr != pLoader)
+              pLoader->Load(pItem->GetPath(), *pItem->GetMusicInfoTag());
+
+            CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
+            // the tracks of a cue sheet share the file, its loudness is not the one of a track
+            if (analyzeLoudness && tag.Loaded() && tag.GetCueSheet().empty() &&
+                !pItem->HasCueDocument() && !tag.GetReplayGain().Get(ReplayGain::TRACK).Valid())
+            {
+              ReplayGain::Info info;
+              if (CLoudnessAnalyzer::Analyze(*pItem, info, [this]() { return m_bStop; }))
+              {
+                ReplayGain replayGain = tag.GetReplayGain();
+                replayGain.Set(ReplayGain::TRACK, info);
+                tag.SetReplayGain(replayGain);
+              }
+            }
+          }
+
+          std::unique_lock<CCriticalSection> lock(loadedSection);
+          loaded[i] = true;
+          itemLoaded.Set();
+        });
+  }
+
+  INFO_RET ret = INFO_ADDED;
+
+  for (size_t i = 0; i < songItems.size(); ++i)
+  {
+    waitLoaded(i);
+
+    if (m_bStop)
+    {
+      ret = INFO_CANCELLED;
+      break;
+    }
+
+    const CFileItemPtr& pItem = songItems[i];
+
+    m_currentItem++;
+
+    const CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
 
     if (m_handle && m_itemCount>0)
       m_handle->SetPercentage(static_cast<float>(m_currentItem * 100) / static_cast<float>(m_itemCount));
@@ -609,7 +692,12 @@ CInfoScanner::INFO_RET CMusicInfoScanner::ScanTags(const CFileItemList& items,
     else
       scannedItems.Add(pItem);
   }
-  return INFO_ADDED;
+
+  // The jobs use the state of this function, wait for the ones still running
+  for (size_t i = 0; i < songItems.size(); ++i)
+    waitLoaded(i);
+
+  return ret;
 }
 
 static bool SortSongsByTrack(const CSong& song, const CSong& song2)
@@ -965,6 +1053,7 @@ int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileI
 
     album.strPath = strDirectory;
     m_musicDatabase.AddAlbum(album, m_idSourcePath);
+    m_musicDatabase.WriteBatchItemDone();
     m_albumsAdded.insert(album.idAlbum);
 
     numAdded += static_cast<int>(album.songs.size());
@@ -9,6 +9,7 @@
 
 #include "filesystem/File.h"
 
+#include <algorithm>
 #include <limits.h>
 
 #include <taglib/taglib.h>
@@ -18,6 +19,11 @@ using namespace XFILE;
 using namespace TagLib;
 using namespace MUSIC_INFO;
 
+namespace
+{
+constexpr size_t READ_AHEAD_SIZE = 64 * 1024;
+} // unnamed namespace
+
 /*!
  * Construct a File object and opens the \a file.  \a file should be a
  * be an XBMC Vfile.
@@ -37,6 +43,12 @@ TagLibVFSStream::TagLibVFSStream(const std::string& strFileName, bool readOnly)
   }
   m_strFileName = strFileName;
   m_bIsReadOnly = readOnly || !m_bIsOpen;
+
+  if (readOnly && m_bIsOpen)
+  {
+    m_length = m_file.GetLength();
+    m_bReadAhead = m_length > 0;
+  }
 }
 
 /*!
@@ -64,6 +76,9 @@ ByteVector TagLibVFSStream::readBlock(unsigned long length)
 ByteVector TagLibVFSStream::readBlock(TagLib::ulong length)
 #endif
 {
+  if (m_bReadAhead)
+    return readBuffered(static_cast<size_t>(length));
+
 #if (TAGLIB_MAJOR_VERSION >= 2)
   ByteVector byteVector(static_cast<unsigned int>(length));
 #else
@@ -78,6 +93,69 @@ ByteVector TagLibVFSStream::readBlock(TagLib::ulong length)
   return byteVector;
 }
 
+ByteVector TagLibVFSStream::readBuffered(size_t length)
+{
+  ByteVector byteVector;
+
+  while (length > 0 && m_position < m_length)
+  {
+    if (m_position < m_bufferStart ||
+        m_position >= m_bufferStart + static_cast<int64_t>(m_bufferSize))
+    {
+      // Large reads, e.g. of embedded art, are not worth buffering
+      if (length >= READ_AHEAD_SIZE)
+      {
+        ByteVector block(static_cast<unsigned int>(length));
+        m_file.Seek(m_position, SEEK_SET);
+        const ssize_t read = m_file.Read(block.data(), length);
+        if (read > 0)
+        {
+          block.resize(static_cast<unsigned int>(read));
+          byteVector.append(block);
+          m_position += read;
+        }
+        break;
+      }
+
+      if (!fillBuffer())
+        break;
+    }
+
+    const size_t offset = static_cast<size_t>(m_position - m_bufferStart);
+    const size_t count = std::min(length, m_bufferSize - offset);
+    byteVector.append(ByteVector(m_buffer.data() + offset, static_cast<unsigned int>(count)));
+    m_position += count;
+    length -= count;
+  }
+
+  return byteVector;
+}
+
+bool TagLibVFSStream::fillBuffer()
+{
+  // Near the end of the file, buffer the end of the file: tags found there are parsed backwards
+  const int64_t start =
+      std::min(m_position, std::max<int64_t>(0, m_length - static_cast<int64_t>(READ_AHEAD_SIZE)));
+
+  m_buffer.resize(READ_AHEAD_SIZE);
+  m_bufferSize = 0;
+
+  if (m_file.Seek(start, SEEK_SET) != start)
+    return false;
+
+  while (m_bufferSize < READ_AHEAD_SIZE)
+  {
+    const ssize_t read =
+        m_file.Read(m_buffer.data() + m_bufferSize, READ_AHEAD_SIZE - m_bufferSize);
+    if (read <= 0)
+      break;
+    m_bufferSize += static_cast<size_t>(read);
+  }
+  m_bufferStart = start;
+
+  return m_position < m_bufferStart + static_cast<int64_t>(m_bufferSize);
+}
+
 /*!
  * Attempts to write the block \a data at the current get pointer.  If the
  * file is currently only opened read only -- i.e. readOnly() returns true --
@@ -284,6 +362,23 @@ bool TagLibVFSStream::isOpen() const
  */
 void TagLibVFSStream::seek(long offset, Position p)
 {
+  if (m_bReadAhead)
+  {
+    int64_t position;
+    if (p == Beginning)
+      position = offset;
+    else if (p == Current)
+      position = m_position + offset;
+    else if (p == End)
+      position = m_length + offset;
+    else
+      return; // wrong Position value
+
+    // Stay within the file, as for unbuffered reads below
+    m_position = std::clamp<int64_t>(position, 0, m_length);
+    return;
+  }
+
   const long fileLen = length();
   if (m_bIsReadOnly && fileLen > 0)
   {
@@ -342,7 +437,7 @@ void TagLibVFSStream::clear()
  */
 long TagLibVFSStream::tell() const
 {
-  int64_t pos = m_file.GetPosition();
+  int64_t pos = m_bReadAhead ? m_position : m_file.GetPosition();
   if(pos > LONG_MAX)
     return -1;
   else
@@ -354,6 +449,9 @@ long TagLibVFSStream::tell() const
  */
 long TagLibVFSStream::length()
 {
+  if (m_bReadAhead)
+    return (long)m_length;
+
   return (long)m_file.GetLength();
 }
 
@@ -10,6 +10,9 @@
 
 #include "filesystem/File.h"
 
+#include <stdint.h>
+#include <vector>
+
 #include <taglib/taglib.h>
 #include <taglib/tiostream.h>
 
@@ -132,10 +135,33 @@ namespace MUSIC_INFO
 #endif
 
   private:
+    /*!
+     * Reads a block at the current position through the read-ahead buffer.
+     */
+    TagLib::ByteVector readBuffered(size_t length);
+
+    /*!
+     * Fills the read-ahead buffer so that it contains the current position.
+     */
+    bool fillBuffer();
+
     std::string   m_strFileName;
     XFILE::CFile  m_file;
     bool          m_bIsReadOnly;
     bool          m_bIsOpen;
+
+    /*!
+     * TagLib parses tags in many small reads and seeks around the start and
+     * the end of the file. When reading, these are served from a buffer that
+     * is filled in large blocks, so that a network file system is not asked
+     * for every 1 KiB separately.
+     */
+    bool          m_bReadAhead = false;
+    std::vector<char> m_buffer;
+    int64_t       m_bufferStart = 0;
+    size_t        m_bufferSize = 0;
+    int64_t       m_position = 0;
+    int64_t       m_length = 0;
   };
 }
 
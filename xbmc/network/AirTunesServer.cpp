@@ -41,7 +41,9 @@
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <mutex>
 #include <string>
@@ -59,6 +61,14 @@
 #define TMP_COVERART_PATH_PNG "special://temp/airtunes_album_thumb.png"
 #define ZEROCONF_DACP_SERVICE "_dacp._tcp"
 
+namespace
+{
+// audio that stays in the pipe for a whole window is not needed to absorb network jitter and only
+// adds latency, everything above the target is skipped
+constexpr auto BACKLOG_WINDOW = 2s;
+constexpr int BACKLOG_TARGET_MS = 250;
+} // unnamed namespace
+
 using namespace XFILE;
 using namespace std::chrono_literals;
 
@@ -79,6 +89,10 @@ int CAirTunesServer::m_sampleRate = 44100;
 unsigned int CAirTunesServer::m_cachedStartTime = 0;
 unsigned int CAirTunesServer::m_cachedEndTime = 0;
 unsigned int CAirTunesServer::m_cachedCurrentTime = 0;
+int CAirTunesServer::m_bytesPerSecond = 0;
+int64_t CAirTunesServer::m_minBacklog = std::numeric_limits<int64_t>::max();
+int64_t CAirTunesServer::m_skipBytes = 0;
+std::chrono::steady_clock::time_point CAirTunesServer::m_backlogWindowStart;
 
 
 //parse daap metadata - thx to project MythTV
@@ -386,6 +400,10 @@ void* CAirTunesServer::AudioOutputFunctions::audio_init(void *cls, int bits, int
   item->SetMimeType("audio/x-xbmc-pcm");
   m_streamStarted = true;
   m_sampleRate = samplerate;
+  m_bytesPerSecond = samplerate * channels * bits / 8;
+  m_minBacklog = std::numeric_limits<int64_t>::max();
+  m_skipBytes = 0;
+  m_backlogWindowStart = std::chrono::steady_clock::now();
 
   CServiceBroker::GetAppMessenger()->PostMsg(TMSG_MEDIA_PLAY, 0, 0, static_cast<void*>(item));
 
@@ -436,6 +454,33 @@ void CAirTunesServer::InformPlayerAboutPlayTimes()
   }
 }
 
+bool CAirTunesServer::SkipForLatency(XFILE::CPipeFile* pipe, int size)
+{
+  if (m_skipBytes > 0)
+  {
+    // whole packets are skipped so that the samples stay aligned
+    m_skipBytes -= size;
+    return true;
+  }
+
+  m_minBacklog = std::min(m_minBacklog, pipe->GetAvailableRead());
+
+  const auto now = std::chrono::steady_clock::now();
+  if (now - m_backlogWindowStart < BACKLOG_WINDOW)
+    return false;
+
+  const int64_t target = static_cast<int64_t>(m_bytesPerSecond) * BACKLOG_TARGET_MS / 1000;
+  if (m_minBacklog > target && m_bytesPerSecond > 0)
+  {
+    m_skipBytes = m_minBacklog - target;
+    CLog::Log(LOGDEBUG, "AIRTUNES: skipping {} ms of audio to reduce latency",
+              m_skipBytes * 1000 / m_bytesPerSecond);
+  }
+  m_minBacklog = std::numeric_limits<int64_t>::max();
+  m_backlogWindowStart = now;
+  return false;
+}
+
 void CAirTunesServer::AudioOutputFunctions::audio_set_progress(void *cls, void *session, unsigned int start, unsigned int curr, unsigned int end)
 {
   m_cachedStartTime = start;
@@ -506,7 +551,8 @@ void  CAirTunesServer::AudioOutputFunctions::audio_set_volume(void *cls, void *s
 void  CAirTunesServer::AudioOutputFunctions::audio_process(void *cls, void *session, const void *buffer, int buflen)
 {
   XFILE::CPipeFile *pipe=(XFILE::CPipeFile *)cls;
-  pipe->Write(buffer, buflen);
+  if (!SkipForLatency(pipe, buflen))
+    pipe->Write(buffer, buflen);
 
   // in case there are some play times cached that are not yet sent to the player - do it here
   InformPlayerAboutPlayTimes();
@@ -17,6 +17,7 @@
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
 
+#include <chrono>
 #include <list>
 #include <string>
 #include <vector>
@@ -67,6 +68,7 @@ private:
   static void RefreshMetadata();
   static void ResetMetadata();
   static void InformPlayerAboutPlayTimes();
+  static bool SkipForLatency(XFILE::CPipeFile* pipe, int size);
 
   int m_port;
   raop_t* m_pRaop = nullptr;
@@ -87,6 +89,10 @@ private:
   static unsigned int m_cachedStartTime;
   static unsigned int m_cachedEndTime;
   static unsigned int m_cachedCurrentTime;
+  static int m_bytesPerSecond;
+  static int64_t m_minBacklog;
+  static int64_t m_skipBytes;
+  static std::chrono::steady_clock::time_point m_backlogWindowStart;
 
   class AudioOutputFunctions
   {
@@ -8,15 +8,18 @@
 
 #include "DNSNameCache.h"
 
+#include "ServiceBroker.h"
 #include "network/Network.h"
+#include "threads/Condition.h"
 #include "threads/CriticalSection.h"
+#include "utils/JobManager.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <mutex>
+#include <set>
 
 #if !defined(TARGET_WINDOWS) && defined(HAS_FILESYSTEM_SMB)
-#include "ServiceBroker.h"
-
 #include "platform/posix/filesystem/SMBWSDiscovery.h"
 #endif
 
@@ -28,6 +31,18 @@
 #include <sys/socket.h>
 #endif
 
+namespace
+{
+// getaddrinfo() doesn't tell the TTL of its answers
+constexpr auto POSITIVE_TTL = std::chrono::minutes(30);
+// a dead host of a source shouldn't block every listing for the full resolver timeout
+constexpr auto NEGATIVE_TTL = std::chrono::minutes(1);
+
+// host names being resolved, later lookups of the same name wait for the first one
+std::set<std::string> pendingLookups;
+XbmcThreads::ConditionVariable lookupDone;
+} // unnamed namespace
+
 CDNSNameCache g_DNSCache;
 
 CCriticalSection CDNSNameCache::m_critical;
@@ -53,10 +68,34 @@ bool CDNSNameCache::Lookup(const std::string& strHostName, std::string& strIpAdd
     return true;
   }
 
+  {
+    std::unique_lock<CCriticalSection> lock(m_critical);
+    lookupDone.wait(lock, [&strHostName]
+                    { return pendingLookups.find(strHostName) == pendingLookups.end(); });
+
+    const CDNSName* dnsName = Find(strHostName);
+    if (dnsName && dnsName->m_strIpAddress.empty())
+    {
+      CLog::Log(LOGDEBUG, "CDNSNameCache::{} - lookup of '{}' failed recently", __FUNCTION__,
+                strHostName);
+      return false;
+    }
+  }
+
   // check if there's a custom entry or if it's already cached
   if (g_DNSCache.GetCached(strHostName, strIpAddress))
     return true;
 
+  {
+    std::unique_lock<CCriticalSection> lock(m_critical);
+    if (!pendingLookups.insert(strHostName).second)
+    {
+      // someone else started the same lookup meanwhile
+      lock.unlock();
+      return Lookup(strHostName, strIpAddress);
+    }
+  }
+
   // perform dns lookup
   addrinfo hints{};
   addrinfo* res;
@@ -65,16 +104,47 @@ bool CDNSNameCache::Lookup(const std::string& strHostName, std::string& strIpAdd
   hints.ai_socktype = SOCK_STREAM;
   hints.ai_flags |= AI_CANONNAME;
 
-  if (getaddrinfo(strHostName.c_str(), nullptr, &hints, &res) == 0)
+  const bool resolved = getaddrinfo(strHostName.c_str(), nullptr, &hints, &res) == 0;
+  if (resolved)
   {
     strIpAddress = CNetworkBase::GetIpStr(res->ai_addr);
     freeaddrinfo(res);
-    g_DNSCache.Add(strHostName, strIpAddress);
-    return true;
   }
+  else
+    CLog::Log(LOGERROR, "Unable to lookup host: '{}'", strHostName);
 
-  CLog::Log(LOGERROR, "Unable to lookup host: '{}'", strHostName);
-  return false;
+  AddResult(strHostName, strIpAddress, resolved ? POSITIVE_TTL : NEGATIVE_TTL);
+  return resolved;
+}
+
+void CDNSNameCache::Prefetch(const std::vector<std::string>& hostNames)
+{
+  const auto jobManager = CServiceBroker::GetJobManager();
+  if (!jobManager)
+    return;
+
+  for (const auto& hostName : hostNames)
+  {
+    jobManager->Submit(
+        [hostName]
+        {
+          std::string ipAddress;
+          Lookup(hostName, ipAddress);
+        });
+  }
+}
+
+CDNSNameCache::CDNSName* CDNSNameCache::Find(const std::string& strHostName)
+{
+  const auto now = std::chrono::steady_clock::now();
+  auto& names = g_DNSCache.m_vecDNSNames;
+  names.erase(std::remove_if(names.begin(), names.end(),
+                             [now](const CDNSName& name) { return name.m_expires < now; }),
+              names.end());
+
+  const auto it = std::find_if(names.begin(), names.end(), [&strHostName](const CDNSName& name)
+                               { return name.m_strHostName == strHostName; });
+  return it != names.end() ? &*it : nullptr;
 }
 
 bool CDNSNameCache::GetCached(const std::string& strHostName, std::string& strIpAddress)
@@ -82,17 +152,14 @@ bool CDNSNameCache::GetCached(const std::string& strHostName, std::string& strIp
   {
     std::unique_lock<CCriticalSection> lock(m_critical);
 
-    // loop through all DNSname entries and see if strHostName is cached
-    for (const auto& DNSname : g_DNSCache.m_vecDNSNames)
+    // see if strHostName is cached
+    const CDNSName* dnsName = Find(strHostName);
+    if (dnsName && !dnsName->m_strIpAddress.empty())
     {
-      if (DNSname.m_strHostName == strHostName)
-      {
-        strIpAddress = DNSname.m_strIpAddress;
-        return true;
-      }
+      strIpAddress = dnsName->m_strIpAddress;
+      return true;
     }
   }
-
 #if !defined(TARGET_WINDOWS) && defined(HAS_FILESYSTEM_SMB)
   if (WSDiscovery::CWSDiscoveryPosix::IsInitialized())
   {
@@ -121,3 +188,18 @@ void CDNSNameCache::Add(const std::string& strHostName, const std::string& strIp
   g_DNSCache.m_vecDNSNames.push_back(dnsName);
 }
 
+void CDNSNameCache::AddResult(const std::string& strHostName,
+                              const std::string& strIpAddress,
+                              std::chrono::steady_clock::duration ttl)
+{
+  CDNSName dnsName;
+
+  dnsName.m_strHostName = strHostName;
+  dnsName.m_strIpAddress = strIpAddress;
+  dnsName.m_expires = std::chrono::steady_clock::now() + ttl;
+
+  std::unique_lock<CCriticalSection> lock(m_critical);
+  g_DNSCache.m_vecDNSNames.push_back(dnsName);
+  pendingLookups.erase(strHostName);
+  lookupDone.notifyAll();
+}
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -20,7 +21,8 @@ public:
   {
   public:
     std::string m_strHostName;
-    std::string m_strIpAddress;
+    std::string m_strIpAddress; ///< empty if the lookup failed
+    std::chrono::steady_clock::time_point m_expires{std::chrono::steady_clock::time_point::max()};
   };
   CDNSNameCache(void);
   virtual ~CDNSNameCache(void);
@@ -28,7 +30,18 @@ public:
   static bool GetCached(const std::string& strHostName, std::string& strIpAddress);
   static bool Lookup(const std::string& strHostName, std::string& strIpAddress);
 
+  /*!
+   * \brief Resolve host names in the background, e.g. the ones of the media sources at startup,
+   * so that browsing them doesn't wait for the resolver
+   */
+  static void Prefetch(const std::vector<std::string>& hostNames);
+
 protected:
+  static void AddResult(const std::string& strHostName,
+                        const std::string& strIpAddress,
+                        std::chrono::steady_clock::duration ttl);
+  static CDNSName* Find(const std::string& strHostName);
+
   static CCriticalSection m_critical;
   std::vector<CDNSName> m_vecDNSNames;
 };
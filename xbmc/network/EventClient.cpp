@@ -23,6 +23,7 @@
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 
+#include <algorithm>
 #include <map>
 #include <mutex>
 #include <queue>
@@ -31,6 +32,11 @@ using namespace KODI;
 using namespace EVENTCLIENT;
 using namespace EVENTPACKET;
 
+namespace
+{
+constexpr unsigned int LATENCY_LOG_INTERVAL = 100;
+} // unnamed namespace
+
 struct ButtonStateFinder
 {
   explicit ButtonStateFinder(const CEventButtonState& state)
@@ -167,6 +173,7 @@ bool CEventClient::GetNextAction(CEventAction &action)
     // grab the next action in line
     action = m_actionQueue.front();
     m_actionQueue.pop();
+    UpdateLatency(action.received);
     return true;
   }
   else
@@ -736,6 +743,11 @@ unsigned int CEventClient::GetButtonCode(std::string& strMapName, bool& isAxis,
       /* MUST update m_iNextRepeat before resend */
       bool skip = !it->Axis() && !CheckButtonRepeat(it->m_iNextRepeat);
 
+      if (!skip && !it->m_bDelivered)
+      {
+        UpdateLatency(it->m_received);
+        it->m_bDelivered = true;
+      }
       repeat.push_back(*it);
       if(skip)
       {
@@ -743,6 +755,8 @@ unsigned int CEventClient::GetButtonCode(std::string& strMapName, bool& isAxis,
         continue;
       }
     }
+    else if (bcode)
+      UpdateLatency(it->m_received);
   }
 
   m_buttonQueue.erase(m_buttonQueue.begin(), it);
@@ -763,6 +777,25 @@ bool CEventClient::GetMousePos(float& x, float& y)
   return false;
 }
 
+void CEventClient::UpdateLatency(std::chrono::steady_clock::time_point received)
+{
+  const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - received);
+  m_latencyTotal += latency;
+  m_latencyMax = std::max(m_latencyMax, latency);
+
+  if (++m_latencyCount < LATENCY_LOG_INTERVAL)
+    return;
+
+  CLog::Log(LOGDEBUG,
+            "ES: Client {} - input latency of the last {} inputs: {:.1f} ms average, {:.1f} ms max",
+            m_deviceName, m_latencyCount, m_latencyTotal.count() / 1000.0 / m_latencyCount,
+            m_latencyMax.count() / 1000.0);
+  m_latencyCount = 0;
+  m_latencyTotal = std::chrono::microseconds(0);
+  m_latencyMax = std::chrono::microseconds(0);
+}
+
 bool CEventClient::CheckButtonRepeat(std::chrono::time_point<std::chrono::steady_clock>& next)
 {
   auto now = std::chrono::steady_clock::now();
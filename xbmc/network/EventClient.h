@@ -35,13 +35,14 @@ namespace EVENTCLIENT
       actionType = 0;
     }
     CEventAction(const char* action, unsigned char type):
-      actionName(action)
+      actionName(action), received(std::chrono::steady_clock::now())
     {
       actionType = type;
     }
 
     std::string    actionName;
     unsigned char  actionType;
+    std::chrono::steady_clock::time_point received;
   };
 
   class CEventButtonState
@@ -65,7 +66,10 @@ namespace EVENTCLIENT
                       bool isAxis,
                       bool bRepeat,
                       bool bUseAmount)
-      : m_buttonName(std::move(buttonName)), m_mapName(std::move(mapName)), m_iNextRepeat{}
+      : m_buttonName(std::move(buttonName)),
+        m_mapName(std::move(mapName)),
+        m_iNextRepeat{},
+        m_received(std::chrono::steady_clock::now())
     {
       m_iKeyCode   = iKeyCode;
       m_fAmount    = fAmount;
@@ -102,6 +106,8 @@ namespace EVENTCLIENT
     bool              m_bActive;
     bool              m_bAxis;
     std::chrono::time_point<std::chrono::steady_clock> m_iNextRepeat;
+    std::chrono::steady_clock::time_point m_received; // when the button packet arrived
+    bool              m_bDelivered = false; // whether it was handed to the input manager once
   };
 
 
@@ -199,6 +205,10 @@ namespace EVENTCLIENT
     virtual bool OnPacketACTION(EVENTPACKET::CEventPacket *packet);
     bool CheckButtonRepeat(std::chrono::time_point<std::chrono::steady_clock>& next);
 
+    // accounts the time from the arrival of a button or action until the input manager picked it
+    // up and logs the statistics every few inputs
+    void UpdateLatency(std::chrono::steady_clock::time_point received);
+
     // returns true if the client has received the HELO packet
     bool Greeted() { return m_bGreeted; }
 
@@ -252,6 +262,11 @@ namespace EVENTCLIENT
     std::list<CEventButtonState>  m_buttonQueue;
     std::queue<CEventAction>      m_actionQueue;
     CEventButtonState m_currentButton;
+
+    // input latency statistics since they were logged last
+    unsigned int m_latencyCount = 0;
+    std::chrono::microseconds m_latencyTotal{0};
+    std::chrono::microseconds m_latencyMax{0};
   };
 
 }
@@ -34,6 +34,12 @@ using namespace EVENTCLIENT;
 using namespace SOCKETS;
 using namespace std::chrono_literals;
 
+namespace
+{
+// upper bound of packets read in one go, so that a flooding client cannot stall event processing
+constexpr int MAX_PACKETS_PER_WAKEUP = 64;
+} // unnamed namespace
+
 /************************************************************************/
 /* CEventServer                                                         */
 /************************************************************************/
@@ -168,10 +174,17 @@ void CEventServer::Run()
       // start listening until we timeout
       if (listener.Listen(m_iListenTimeout))
       {
-        CAddress addr;
-        if ((packetSize = m_pSocket->Read(addr, PACKET_SIZE, m_pPacketBuffer.data())) > -1)
+        // a key press usually arrives as several packets, read everything that is already
+        // waiting before the events are processed instead of one packet per wakeup
+        for (int i = 0; i < MAX_PACKETS_PER_WAKEUP; ++i)
         {
-          ProcessPacket(addr, packetSize);
+          CAddress addr;
+          if ((packetSize = m_pSocket->Read(addr, PACKET_SIZE, m_pPacketBuffer.data())) > -1)
+          {
+            ProcessPacket(addr, packetSize);
+          }
+          if (!listener.Listen(0))
+            break;
         }
       }
     }
@@ -18,6 +18,7 @@
 #include "utils/log.h"
 #include "websocket/WebSocketManager.h"
 
+#include <memory>
 #include <mutex>
 #include <stdio.h>
 #include <stdlib.h>
@@ -58,7 +59,14 @@ using namespace JSONRPC;
 namespace
 {
 constexpr size_t maxBufferLength = 64 * 1024;
+
+// announcements that can come in quick succession and of which the last one is enough
+bool IsCoalesced(ANNOUNCEMENT::AnnouncementFlag flag, const std::string& message)
+{
+  return (flag == ANNOUNCEMENT::Player && (message == "OnSeek" || message == "OnPropertyChanged")) ||
+         (flag == ANNOUNCEMENT::Application && message == "OnVolumeChanged");
 }
+} // unnamed namespace
 
 CTCPServer *CTCPServer::ServerInstance = NULL;
 
@@ -97,7 +105,12 @@ bool CTCPServer::IsRunning()
   return ((CThread*)ServerInstance)->IsRunning();
 }
 
-CTCPServer::CTCPServer(int port, bool nonlocal) : CThread("TCPServer")
+CTCPServer::CTCPServer(int port, bool nonlocal)
+  : CThread("TCPServer"),
+    m_coalesceTime(CServiceBroker::GetSettingsComponent()
+                       ->GetAdvancedSettings()
+                       ->m_jsonNotificationCoalesceTime),
+    m_coalesceTimer([this]() { FlushAnnouncements(); })
 {
   m_port = port;
   m_nonlocal = nonlocal;
@@ -240,7 +253,47 @@ void CTCPServer::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
   if (m_connections.empty())
     return;
 
+  std::unique_lock<CCriticalSection> lock(m_announceSection);
+
+  if (m_coalesceTime > 0ms && IsCoalesced(flag, message))
+  {
+    // one announcement per player and window goes out right away, later ones are merged and sent
+    // by the timer
+    const std::string key = message + ":" + data["player"]["playerid"].asString();
+    const auto now = std::chrono::steady_clock::now();
+    const auto last = m_lastAnnouncements.find(key);
+    if (last != m_lastAnnouncements.end() && now - last->second < m_coalesceTime)
+    {
+      const auto pending = m_pendingAnnouncements.find(key);
+      if (pending == m_pendingAnnouncements.end())
+        m_pendingAnnouncements.emplace(key, PendingAnnouncement{flag, sender, message, data});
+      else if (message == "OnPropertyChanged")
+      {
+        // each announcement only carries the properties that changed
+        CVariant& properties = pending->second.data["property"];
+        for (auto it = data["property"].begin_map(); it != data["property"].end_map(); ++it)
+          properties[it->first] = it->second;
+        pending->second.data["player"] = data["player"];
+      }
+      else
+        pending->second.data = data;
+      return;
+    }
+    m_lastAnnouncements[key] = now;
+  }
+  else
+    FlushAnnouncements(); // merged announcements must not arrive after later ones
+
+  Broadcast(flag, sender, message, data);
+}
+
+void CTCPServer::Broadcast(ANNOUNCEMENT::AnnouncementFlag flag,
+                           const std::string& sender,
+                           const std::string& message,
+                           const CVariant& data)
+{
   std::string str = IJSONRPCAnnouncer::AnnouncementToJSONRPC(flag, sender, message, data, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+  std::string framed;
 
   for (unsigned int i = 0; i < m_connections.size(); i++)
   {
@@ -250,8 +303,23 @@ void CTCPServer::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
         continue;
     }
 
-    m_connections[i]->Send(str.c_str(), str.size());
+    m_connections[i]->SendAnnouncement(str, framed);
+  }
+}
+
+void CTCPServer::FlushAnnouncements()
+{
+  std::unique_lock<CCriticalSection> lock(m_announceSection);
+  if (m_pendingAnnouncements.empty())
+    return;
+
+  const auto now = std::chrono::steady_clock::now();
+  for (const auto& [key, announcement] : m_pendingAnnouncements)
+  {
+    Broadcast(announcement.flag, announcement.sender, announcement.message, announcement.data);
+    m_lastAnnouncements[key] = now;
   }
+  m_pendingAnnouncements.clear();
 }
 
 bool CTCPServer::Initialize()
@@ -265,6 +333,8 @@ bool CTCPServer::Initialize()
 
   if (started)
   {
+    if (m_coalesceTime > 0ms)
+      m_coalesceTimer.Start(m_coalesceTime, true);
     CServiceBroker::GetAnnouncementManager()->AddAnnouncer(this);
     CLog::Log(LOGINFO, "JSONRPC Server: Successfully initialized");
     return true;
@@ -499,6 +569,11 @@ void CTCPServer::Deinitialize()
 #endif
 
   CServiceBroker::GetAnnouncementManager()->RemoveAnnouncer(this);
+
+  m_coalesceTimer.Stop(true);
+  std::unique_lock<CCriticalSection> lock(m_announceSection);
+  m_pendingAnnouncements.clear();
+  m_lastAnnouncements.clear();
 }
 
 CTCPServer::CTCPClient::CTCPClient()
@@ -551,6 +626,11 @@ void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
   } while (sent < size);
 }
 
+void CTCPServer::CTCPClient::SendAnnouncement(const std::string& data, std::string& framed)
+{
+  Send(data.c_str(), static_cast<unsigned int>(data.size()));
+}
+
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   m_new = false;
@@ -693,6 +773,25 @@ void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
   std::vector<const CWebSocketFrame *> frames = msg->GetFrames();
   for (unsigned int index = 0; index < frames.size(); index++)
     CTCPClient::Send(frames.at(index)->GetFrameData(), (unsigned int)frames.at(index)->GetFrameLength());
+
+  delete msg;
+}
+
+void CTCPServer::CWebSocketClient::SendAnnouncement(const std::string& data, std::string& framed)
+{
+  // the frames sent by the server are not masked, so they are the same for every websocket client
+  if (framed.empty())
+  {
+    std::unique_ptr<const CWebSocketMessage> msg(
+        m_websocket->Send(WebSocketTextFrame, data.c_str(), static_cast<uint32_t>(data.size())));
+    if (msg == nullptr || !msg->IsComplete())
+      return;
+
+    for (const CWebSocketFrame* frame : msg->GetFrames())
+      framed.append(frame->GetFrameData(), static_cast<size_t>(frame->GetFrameLength()));
+  }
+
+  CTCPClient::Send(framed.c_str(), static_cast<unsigned int>(framed.size()));
 }
 
 void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
@@ -13,8 +13,13 @@
 #include "interfaces/json-rpc/ITransportLayer.h"
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
+#include "threads/Timer.h"
+#include "utils/Variant.h"
 #include "websocket/WebSocket.h"
 
+#include <chrono>
+#include <map>
+#include <string>
 #include <vector>
 
 #include <sys/socket.h>
@@ -50,6 +55,15 @@ namespace JSONRPC
     bool InitializeTCP();
     void Deinitialize();
 
+    /*!
+     * \brief Send an announcement to all clients that are interested in it.
+     */
+    void Broadcast(ANNOUNCEMENT::AnnouncementFlag flag,
+                   const std::string& sender,
+                   const std::string& message,
+                   const CVariant& data);
+    void FlushAnnouncements();
+
     class CTCPClient : public IClient
     {
     public:
@@ -65,6 +79,12 @@ namespace JSONRPC
       bool SetAnnouncementFlags(int flags) override;
 
       virtual void Send(const char *data, unsigned int size);
+      /*!
+       * \brief Send an announcement that is sent to other clients as well.
+       * \param framed the announcement as framed by the transport of a previous client, filled
+       * if empty and the client frames its messages
+       */
+      virtual void SendAnnouncement(const std::string& data, std::string& framed);
       virtual void PushBuffer(CTCPServer *host, const char *buffer, int length);
       virtual void Disconnect();
 
@@ -96,6 +116,7 @@ namespace JSONRPC
       ~CWebSocketClient() override;
 
       void Send(const char *data, unsigned int size) override;
+      void SendAnnouncement(const std::string& data, std::string& framed) override;
       void PushBuffer(CTCPServer *host, const char *buffer, int length) override;
       void Disconnect() override;
 
@@ -113,6 +134,20 @@ namespace JSONRPC
     bool m_nonlocal;
     void* m_sdpd;
 
+    struct PendingAnnouncement
+    {
+      ANNOUNCEMENT::AnnouncementFlag flag;
+      std::string sender;
+      std::string message;
+      CVariant data;
+    };
+
+    CCriticalSection m_announceSection;
+    std::map<std::string, PendingAnnouncement> m_pendingAnnouncements;
+    std::map<std::string, std::chrono::steady_clock::time_point> m_lastAnnouncements;
+    std::chrono::milliseconds m_coalesceTime;
+    CTimer m_coalesceTimer;
+
     static CTCPServer *ServerInstance;
   };
 }
@@ -10,8 +10,10 @@
 
 #include "CompileInfo.h"
 #include "ServiceBroker.h"
+#include "URL.h"
 #include "XBDateTime.h"
 #include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
 #include "settings/Settings.h"
@@ -30,12 +32,21 @@
 #include <utility>
 
 #if defined(TARGET_POSIX)
+#include <fcntl.h>
 #include <pthread.h>
+#include <unistd.h>
 #endif
 
 #include <inttypes.h>
 
 #define MAX_POST_BUFFER_SIZE 2048
+// size of the blocks in which file downloads are read, large enough to keep the disk busy
+#define FILE_READ_BLOCK_SIZE (64 * 1024)
+
+#if defined(TARGET_POSIX) && (MHD_VERSION >= 0x00094400)
+// libmicrohttpd can send local files itself, using sendfile() where possible
+#define HAS_FILE_DESCRIPTOR_RESPONSE
+#endif
 
 #define PAGE_FILE_NOT_FOUND \
   "<html><head><title>File not found</title></head><body>File not found</body></html>"
@@ -92,6 +103,50 @@ static MHD_Response* create_response(size_t size, const void* data, int free, in
   return MHD_create_response_from_buffer(size, const_cast<void*>(data), mode);
 }
 
+// checks the entity tags of an If-None-Match header with the weak comparison of RFC 7232
+static bool matches_entity_tag(const std::string& ifNoneMatch, const std::string& entityTag)
+{
+  const auto opaqueTag = [](std::string tag)
+  {
+    StringUtils::Trim(tag);
+    if (StringUtils::StartsWith(tag, "W/"))
+      tag.erase(0, 2);
+    return tag;
+  };
+
+  const std::string tag = opaqueTag(entityTag);
+  for (const std::string& candidate : StringUtils::Split(ifNoneMatch, ','))
+  {
+    const std::string candidateTag = opaqueTag(candidate);
+    if (candidateTag == "*" || candidateTag == tag)
+      return true;
+  }
+
+  return false;
+}
+
+#if defined(HAS_FILE_DESCRIPTOR_RESPONSE)
+static MHD_Response* create_file_response(const std::string& filePath,
+                                          uint64_t offset,
+                                          uint64_t length)
+{
+  // only plain local files, everything else has to go through the VFS
+  const std::string path = CSpecialProtocol::TranslatePath(filePath);
+  if (!CURL(path).GetProtocol().empty())
+    return nullptr;
+
+  const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return nullptr;
+
+  // the response takes over the file descriptor
+  MHD_Response* response = MHD_create_response_from_fd_at_offset64(length, fd, offset);
+  if (response == nullptr)
+    close(fd);
+  return response;
+}
+#endif
+
 MHD_RESULT CWebServer::AskForAuthentication(const HTTPRequest& request) const
 {
   struct MHD_Response* response = create_response(0, nullptr, MHD_NO, MHD_NO);
@@ -209,6 +264,15 @@ MHD_RESULT CWebServer::HandlePartialRequest(struct MHD_Connection* connection,
         {
           bool cacheable = IsRequestCacheable(request);
 
+          // handle If-None-Match (but only if the response is cacheable), which takes precedence
+          // over If-Modified-Since
+          bool notModified = false;
+          std::string entityTag;
+          std::string ifNoneMatch = HTTPRequestHandlerUtils::GetRequestHeaderValue(
+              connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_IF_NONE_MATCH);
+          if (cacheable && !ifNoneMatch.empty() && handler->GetEntityTag(entityTag))
+            notModified = matches_entity_tag(ifNoneMatch, entityTag);
+
           CDateTime lastModified;
           if (handler->GetLastModifiedDate(lastModified) && lastModified.IsValid())
           {
@@ -221,24 +285,28 @@ MHD_RESULT CWebServer::HandlePartialRequest(struct MHD_Connection* connection,
             CDateTime ifModifiedSinceDate;
             CDateTime ifUnmodifiedSinceDate;
             // handle If-Modified-Since (but only if the response is cacheable)
-            if (cacheable && ifModifiedSinceDate.SetFromRFC1123DateTime(ifModifiedSince) &&
+            if (cacheable && ifNoneMatch.empty() &&
+                ifModifiedSinceDate.SetFromRFC1123DateTime(ifModifiedSince) &&
                 lastModified.GetAsUTCDateTime() <= ifModifiedSinceDate)
-            {
-              struct MHD_Response* response = create_response(0, nullptr, MHD_NO, MHD_NO);
-              if (response == nullptr)
-              {
-                m_logger->error("failed to create a HTTP 304 response");
-                return MHD_NO;
-              }
-
-              return FinalizeRequest(handler, MHD_HTTP_NOT_MODIFIED, response);
-            }
+              notModified = true;
             // handle If-Unmodified-Since
             else if (ifUnmodifiedSinceDate.SetFromRFC1123DateTime(ifUnmodifiedSince) &&
                      lastModified.GetAsUTCDateTime() > ifUnmodifiedSinceDate)
               return SendErrorResponse(request, MHD_HTTP_PRECONDITION_FAILED, request.method);
           }
 
+          if (notModified)
+          {
+            struct MHD_Response* response = create_response(0, nullptr, MHD_NO, MHD_NO);
+            if (response == nullptr)
+            {
+              m_logger->error("failed to create a HTTP 304 response");
+              return MHD_NO;
+            }
+
+            return FinalizeRequest(handler, MHD_HTTP_NOT_MODIFIED, response);
+          }
+
           // pass the requested ranges on to the request handler
           handler->SetRequestRanged(IsRequestRanged(request, lastModified));
         }
@@ -394,6 +462,11 @@ MHD_RESULT CWebServer::FinalizeRequest(const std::shared_ptr<IHTTPRequestHandler
   if (handler->GetLastModifiedDate(lastModified) && lastModified.IsValid())
     handler->AddResponseHeader(MHD_HTTP_HEADER_LAST_MODIFIED, lastModified.GetAsRFC1123DateTime());
 
+  // if the request handler has set an entity tag and it hasn't been set as a header, add it
+  std::string entityTag;
+  if (handler->CanBeCached() && handler->GetEntityTag(entityTag) && !entityTag.empty())
+    handler->AddResponseHeader(MHD_HTTP_HEADER_ETAG, entityTag);
+
   // check if the request handler has set Cache-Control and add it if not
   if (!handler->HasResponseHeader(MHD_HTTP_HEADER_CACHE_CONTROL))
   {
@@ -887,18 +960,28 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   // set the initial write position
   context->ranges.GetFirstPosition(context->writePosition);
 
-  // create the response object
-  response =
-      MHD_create_response_from_callback(totalLength, 2048, &CWebServer::ContentReaderCallback,
-                                        context.get(), &CWebServer::ContentReaderFreeCallback);
+  response = nullptr;
+#if defined(HAS_FILE_DESCRIPTOR_RESPONSE)
+  // a single range of a local file doesn't need to be copied through our buffers
+  if (context->rangeCountTotal == 1)
+    response = create_file_response(filePath, context->writePosition, totalLength);
+#endif
+
   if (response == nullptr)
   {
-    m_logger->error("failed to create a HTTP response for {} to be filled from{}", request.pathUrl,
-                    filePath);
-    return MHD_NO;
-  }
+    // create the response object
+    response = MHD_create_response_from_callback(totalLength, FILE_READ_BLOCK_SIZE,
+                                                 &CWebServer::ContentReaderCallback, context.get(),
+                                                 &CWebServer::ContentReaderFreeCallback);
+    if (response == nullptr)
+    {
+      m_logger->error("failed to create a HTTP response for {} to be filled from{}",
+                      request.pathUrl, filePath);
+      return MHD_NO;
+    }
 
-  context.release(); // ownership was passed to mhd
+    context.release(); // ownership was passed to mhd
+  }
 
   // add Content-Range header
   if (ranged)
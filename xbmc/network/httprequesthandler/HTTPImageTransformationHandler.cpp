@@ -8,16 +8,23 @@
 
 #include "HTTPImageTransformationHandler.h"
 
+#include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "TextureCacheJob.h"
 #include "URL.h"
 #include "filesystem/ImageFile.h"
 #include "network/WebServer.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/Crc32.h"
 #include "utils/Mime.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 
+#include <cstdlib>
 #include <map>
+#include <vector>
 
 #define TRANSFORMATION_OPTION_WIDTH             "width"
 #define TRANSFORMATION_OPTION_HEIGHT            "height"
@@ -25,8 +32,30 @@
 
 static const std::string ImageBasePath = "/image/";
 
+static std::string GetTransformationOptions(struct MHD_Connection* connection)
+{
+  std::map<std::string, std::string> options;
+  HTTPRequestHandlerUtils::GetRequestHeaderValues(connection, MHD_GET_ARGUMENT_KIND, options);
+
+  std::vector<std::string> urlOptions;
+  std::map<std::string, std::string>::const_iterator option = options.find(TRANSFORMATION_OPTION_WIDTH);
+  if (option != options.end())
+    urlOptions.push_back(TRANSFORMATION_OPTION_WIDTH "=" + option->second);
+
+  option = options.find(TRANSFORMATION_OPTION_HEIGHT);
+  if (option != options.end())
+    urlOptions.push_back(TRANSFORMATION_OPTION_HEIGHT "=" + option->second);
+
+  option = options.find(TRANSFORMATION_OPTION_SCALING_ALGORITHM);
+  if (option != options.end())
+    urlOptions.push_back(TRANSFORMATION_OPTION_SCALING_ALGORITHM "=" + option->second);
+
+  return StringUtils::Join(urlOptions, "&");
+}
+
 CHTTPImageTransformationHandler::CHTTPImageTransformationHandler()
   : m_url(),
+    m_options(),
     m_lastModified(),
     m_buffer(NULL),
     m_responseData()
@@ -35,6 +64,7 @@ CHTTPImageTransformationHandler::CHTTPImageTransformationHandler()
 CHTTPImageTransformationHandler::CHTTPImageTransformationHandler(const HTTPRequest &request)
   : IHTTPRequestHandler(request),
     m_url(),
+    m_options(),
     m_lastModified(),
     m_buffer(NULL),
     m_responseData()
@@ -56,6 +86,8 @@ CHTTPImageTransformationHandler::CHTTPImageTransformationHandler(const HTTPReque
     return;
   }
 
+  m_options = GetTransformationOptions(m_request.connection);
+
   m_response.type = HTTPMemoryDownloadNoFreeCopy;
   m_response.status = MHD_HTTP_OK;
 
@@ -82,6 +114,12 @@ CHTTPImageTransformationHandler::CHTTPImageTransformationHandler(const HTTPReque
     return;
 
   m_lastModified = *time;
+
+  // the same transformation of the same version of the image always results in the same image, but
+  // not necessarily byte for byte, e.g. when the texture cache settings change
+  const std::string identity = StringUtils::Format("{}?{}@{}:{}", m_url, m_options,
+                                                   statBuffer.st_mtime, statBuffer.st_size);
+  m_entityTag = StringUtils::Format("W/\"{:08x}\"", Crc32::Compute(identity));
 }
 
 CHTTPImageTransformationHandler::~CHTTPImageTransformationHandler()
@@ -110,28 +148,23 @@ MHD_RESULT CHTTPImageTransformationHandler::HandleRequest()
   if (m_response.type == HTTPError)
     return MHD_YES;
 
-  // get the transformation options
-  std::map<std::string, std::string> options;
-  HTTPRequestHandlerUtils::GetRequestHeaderValues(m_request.connection, MHD_GET_ARGUMENT_KIND, options);
-
-  std::vector<std::string> urlOptions;
-  std::map<std::string, std::string>::const_iterator option = options.find(TRANSFORMATION_OPTION_WIDTH);
-  if (option != options.end())
-    urlOptions.push_back(TRANSFORMATION_OPTION_WIDTH "=" + option->second);
+  // serve the transformed image from the texture cache so it is only transformed once
+  if (CacheTransformedImage())
+  {
+    m_response.type = HTTPFileDownload;
 
-  option = options.find(TRANSFORMATION_OPTION_HEIGHT);
-  if (option != options.end())
-    urlOptions.push_back(TRANSFORMATION_OPTION_HEIGHT "=" + option->second);
+    std::string ext = URIUtils::GetExtension(m_cachedFile);
+    StringUtils::ToLower(ext);
+    m_response.contentType = CMime::GetMimeType(ext);
 
-  option = options.find(TRANSFORMATION_OPTION_SCALING_ALGORITHM);
-  if (option != options.end())
-    urlOptions.push_back(TRANSFORMATION_OPTION_SCALING_ALGORITHM "=" + option->second);
+    return MHD_YES;
+  }
 
   std::string imagePath = m_url;
-  if (!urlOptions.empty())
+  if (!m_options.empty())
   {
     imagePath += "?";
-    imagePath += StringUtils::Join(urlOptions, "&");
+    imagePath += m_options;
   }
 
   // resize the image into the local buffer
@@ -161,6 +194,45 @@ MHD_RESULT CHTTPImageTransformationHandler::HandleRequest()
   return MHD_YES;
 }
 
+bool CHTTPImageTransformationHandler::GetEntityTag(std::string& entityTag) const
+{
+  if (m_entityTag.empty())
+    return false;
+
+  entityTag = m_entityTag;
+  return true;
+}
+
+bool CHTTPImageTransformationHandler::CacheTransformedImage()
+{
+  // only images wrapped without any options of their own are cached with the transformation
+  CURL url(m_url);
+  if (!url.IsProtocol("image") || !url.GetFileName().empty() || !url.GetOptions().empty())
+    return false;
+
+  url.SetFileName("transform");
+  url.SetOptions("?" + m_options);
+
+  CTextureDetails details;
+  if (!CServiceBroker::GetTextureCache()->CacheImage(url.Get(), details))
+    return false;
+
+  // the texture cache limits the size of the cached images, transformations to larger sizes are
+  // done without it
+  const unsigned int width =
+      std::strtoul(url.GetOption(TRANSFORMATION_OPTION_WIDTH).c_str(), nullptr, 0);
+  const unsigned int height =
+      std::strtoul(url.GetOption(TRANSFORMATION_OPTION_HEIGHT).c_str(), nullptr, 0);
+  const unsigned int maxHeight =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes;
+  if ((width == 0 || details.width < width) && (height == 0 || details.height < height) &&
+      (details.height >= maxHeight || details.width >= maxHeight * 16 / 9))
+    return false;
+
+  m_cachedFile = CTextureCache::GetCachedPath(details.file);
+  return true;
+}
+
 bool CHTTPImageTransformationHandler::GetLastModifiedDate(CDateTime &lastModified) const
 {
   if (!m_lastModified.IsValid())
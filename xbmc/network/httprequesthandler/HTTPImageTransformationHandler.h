@@ -28,8 +28,10 @@ public:
   bool CanHandleRanges() const override { return true; }
   bool CanBeCached() const override { return true; }
   bool GetLastModifiedDate(CDateTime &lastModified) const override;
+  bool GetEntityTag(std::string& entityTag) const override;
 
   HttpResponseRanges GetResponseData() const override { return m_responseData; }
+  std::string GetResponseFile() const override { return m_cachedFile; }
 
   // priority must be higher than the one of CHTTPImageHandler
   int GetPriority() const override { return 6; }
@@ -38,8 +40,20 @@ protected:
   explicit CHTTPImageTransformationHandler(const HTTPRequest &request);
 
 private:
+  /*!
+   * \brief Cache the transformed image in the texture cache.
+   *
+   * \details Concurrent requests for the same transformation wait for the first one to finish.
+   *
+   * \return True if the transformed image was cached, otherwise false.
+   */
+  bool CacheTransformedImage();
+
   std::string m_url;
+  std::string m_options;
   CDateTime m_lastModified;
+  std::string m_entityTag;
+  std::string m_cachedFile;
 
   uint8_t* m_buffer;
   HttpResponseRanges m_responseData;
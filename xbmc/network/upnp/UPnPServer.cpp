@@ -57,6 +57,26 @@ namespace UPNP
 
 NPT_UInt32 CUPnPServer::m_MaxReturnedItems = 0;
 
+namespace
+{
+// number of containers kept for paging and how long they are used at most, library updates
+// invalidate them right away but file listings are only refreshed when they expire
+constexpr size_t BROWSE_CACHE_SIZE = 16;
+constexpr auto BROWSE_CACHE_TTL = std::chrono::minutes(5);
+
+std::string GetDidlCacheKey(const char* filter, bool search, const PLT_HttpRequestContext& context)
+{
+  // the resources of an item point to the interface the request came in on and their mime types
+  // and the item classes depend on the quirks of the client
+  const NPT_HttpHeaders& headers = context.GetRequest().GetHeaders();
+  const NPT_String* agent = headers.GetHeaderValue(NPT_HTTP_HEADER_USER_AGENT);
+  const NPT_String* server = headers.GetHeaderValue(NPT_HTTP_HEADER_SERVER);
+  return StringUtils::Format("{}|{}|{}|{}|{}", filter ? filter : "", search,
+                             context.GetLocalAddress().ToString().GetChars(),
+                             agent ? agent->GetChars() : "", server ? server->GetChars() : "");
+}
+} // unnamed namespace
+
 const char* audio_containers[] = {"musicdb://genres/",
                                   "musicdb://artists/",
                                   "musicdb://albums/",
@@ -154,6 +174,8 @@ void CUPnPServer::OnScanCompleted(int type)
 +---------------------------------------------------------------------*/
 void CUPnPServer::UpdateContainer(const std::string& id)
 {
+  InvalidateBrowseCache();
+
   std::map<std::string, std::pair<bool, unsigned long>>::iterator itr = m_UpdateIDs.find(id);
   unsigned long count = 0;
   if (itr != m_UpdateIDs.end())
@@ -520,6 +542,9 @@ void CUPnPServer::Announce(AnnouncementFlag flag,
   }
   else
   {
+    // any change, e.g. a new playcount, may be part of the cached listings
+    InvalidateBrowseCache();
+
     // handle both updates & removals
     if (!data["item"].isNull())
     {
@@ -765,7 +790,6 @@ NPT_Result CUPnPServer::OnBrowseDirectChildren(PLT_ActionReference& action,
                                                const char* sort_criteria,
                                                const PLT_HttpRequestContext& context)
 {
-  CFileItemList items;
   const NPT_String decodedObjectId = DecodeObjectId(object_id);
   m_logger->info("Received Browse DirectChildren request for encoded object '{}' (plain value: "
                  "'{}'), with sort criteria {}",
@@ -779,6 +803,34 @@ NPT_Result CUPnPServer::OnBrowseDirectChildren(PLT_ActionReference& action,
     return NPT_FAILURE;
   }
 
+  std::shared_ptr<BrowseCacheEntry> entry = GetBrowseCacheEntry(std::string(parent_id));
+  if (!entry)
+  {
+    entry = std::make_shared<BrowseCacheEntry>();
+    // read before listing, so that an update during the listing expires the entry
+    entry->generation = m_BrowseGeneration;
+    entry->items = std::make_shared<CFileItemList>();
+    ListDirectChildren(parent_id, *entry->items);
+    AddBrowseCacheEntry(std::string(parent_id), entry);
+  }
+
+  // Don't pass parent_id if action is Search not BrowseDirectChildren, as
+  // we want the engine to determine the best parent id, not necessarily the one
+  // passed
+  NPT_String action_name = action->GetActionDesc().GetName();
+  const bool is_search = action_name.Compare("Search", true) == 0;
+
+  NPT_AutoLock lock(entry->lock);
+  DidlFragments& fragments = entry->didl[GetDidlCacheKey(filter, is_search, context)];
+  return BuildResponse(action, *entry->items, filter, starting_index, requested_count,
+                       sort_criteria, context, is_search ? NULL : parent_id.GetChars(), &fragments);
+}
+
+/*----------------------------------------------------------------------
+|   CUPnPServer::ListDirectChildren
++---------------------------------------------------------------------*/
+void CUPnPServer::ListDirectChildren(const NPT_String& parent_id, CFileItemList& items)
+{
   items.SetPath(std::string(parent_id));
 
   // guard against loading while saving to the same cache file
@@ -853,14 +905,53 @@ NPT_Result CUPnPServer::OnBrowseDirectChildren(PLT_ActionReference& action,
       items.Add(mvideos);
     }
   }
+}
 
-  // Don't pass parent_id if action is Search not BrowseDirectChildren, as
-  // we want the engine to determine the best parent id, not necessarily the one
-  // passed
-  NPT_String action_name = action->GetActionDesc().GetName();
-  return BuildResponse(action, items, filter, starting_index, requested_count, sort_criteria,
-                       context,
-                       (action_name.Compare("Search", true) == 0) ? NULL : parent_id.GetChars());
+/*----------------------------------------------------------------------
+|   CUPnPServer::GetBrowseCacheEntry
++---------------------------------------------------------------------*/
+std::shared_ptr<CUPnPServer::BrowseCacheEntry> CUPnPServer::GetBrowseCacheEntry(
+    const std::string& path)
+{
+  NPT_AutoLock lock(m_BrowseCacheMutex);
+  auto it = m_BrowseCache.find(path);
+  if (it == m_BrowseCache.end())
+    return nullptr;
+
+  const auto now = std::chrono::steady_clock::now();
+  if (it->second->generation != m_BrowseGeneration || now >= it->second->expires)
+  {
+    m_BrowseCache.erase(it);
+    return nullptr;
+  }
+
+  it->second->lastUsed = now;
+  return it->second;
+}
+
+/*----------------------------------------------------------------------
+|   CUPnPServer::AddBrowseCacheEntry
++---------------------------------------------------------------------*/
+void CUPnPServer::AddBrowseCacheEntry(const std::string& path,
+                                      const std::shared_ptr<BrowseCacheEntry>& entry)
+{
+  const auto now = std::chrono::steady_clock::now();
+  entry->expires = now + BROWSE_CACHE_TTL;
+  entry->lastUsed = now;
+
+  NPT_AutoLock lock(m_BrowseCacheMutex);
+  m_BrowseCache[path] = entry;
+  if (m_BrowseCache.size() <= BROWSE_CACHE_SIZE)
+    return;
+
+  // evict the container that was not browsed for the longest time
+  auto oldest = m_BrowseCache.begin();
+  for (auto it = m_BrowseCache.begin(); it != m_BrowseCache.end(); ++it)
+  {
+    if (it->second->lastUsed < oldest->second->lastUsed)
+      oldest = it;
+  }
+  m_BrowseCache.erase(oldest);
 }
 
 /*----------------------------------------------------------------------
@@ -873,7 +964,8 @@ NPT_Result CUPnPServer::BuildResponse(PLT_ActionReference& action,
                                       NPT_UInt32 requested_count,
                                       const char* sort_criteria,
                                       const PLT_HttpRequestContext& context,
-                                      const char* parent_id /* = NULL */)
+                                      const char* parent_id /* = NULL */,
+                                      DidlFragments* fragments /* = nullptr */)
 {
   NPT_COMPILER_UNUSED(sort_criteria);
 
@@ -912,6 +1004,9 @@ NPT_Result CUPnPServer::BuildResponse(PLT_ActionReference& action,
     }
   }
 
+  if (fragments)
+    fragments->resize(items.Size());
+
   // won't return more than UPNP_MAX_RETURNED_ITEMS items at a time to keep things smooth
   // 0 requested means as many as possible
   NPT_UInt32 max_count = (requested_count == 0) ? m_MaxReturnedItems
@@ -926,17 +1021,27 @@ NPT_Result CUPnPServer::BuildResponse(PLT_ActionReference& action,
   PLT_MediaObjectReference object;
   for (unsigned long i = starting_index; i < stop_index; ++i)
   {
-    object = Build(items[i], true, context, thumb_loader, parent_id);
-    if (object.IsNull())
+    NPT_String tmp;
+    if (fragments && (*fragments)[i])
+    {
+      tmp = *(*fragments)[i];
+    }
+    else
+    {
+      object = Build(items[i], true, context, thumb_loader, parent_id);
+      if (!object.IsNull())
+        NPT_CHECK(PLT_Didl::ToDidl(*object.AsPointer(), filter, tmp));
+      if (fragments)
+        (*fragments)[i] = tmp;
+    }
+
+    if (tmp.IsEmpty())
     {
       // don't tell the client this item ever existed
       --total;
       continue;
     }
 
-    NPT_String tmp;
-    NPT_CHECK(PLT_Didl::ToDidl(*object.AsPointer(), filter, tmp));
-
     // Neptunes string growing is dead slow for small additions
     if (didl.GetCapacity() < tmp.GetLength() + didl.GetLength())
     {
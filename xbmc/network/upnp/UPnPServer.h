@@ -11,10 +11,14 @@
 #include "interfaces/IAnnouncer.h"
 #include "utils/logtypes.h"
 
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <Platinum/Source/Devices/MediaConnect/PltMediaConnect.h>
 
@@ -109,6 +113,32 @@ public:
 
 
   private:
+    // DIDL-Lite of the items of a container, nullopt if not yet built and empty if the item is
+    // hidden from clients
+    using DidlFragments = std::vector<std::optional<NPT_String>>;
+
+    /*!
+     * \brief The listing of a container as returned to clients, so that paging through a large
+     * container does not list it again for every page
+     */
+    struct BrowseCacheEntry
+    {
+      std::shared_ptr<CFileItemList> items;
+      unsigned int generation = 0;
+      std::chrono::steady_clock::time_point expires;
+      std::chrono::steady_clock::time_point lastUsed;
+      // keyed by filter and client, as these change the DIDL built for an item
+      std::map<std::string, DidlFragments> didl;
+      // items and thumb loaders are not thread safe, so pages of a container are built one by one
+      NPT_Mutex lock;
+    };
+
+    void ListDirectChildren(const NPT_String& parent_id, CFileItemList& items);
+    std::shared_ptr<BrowseCacheEntry> GetBrowseCacheEntry(const std::string& path);
+    void AddBrowseCacheEntry(const std::string& path,
+                             const std::shared_ptr<BrowseCacheEntry>& entry);
+    void InvalidateBrowseCache() { ++m_BrowseGeneration; }
+
     void OnScanCompleted(int type);
     void UpdateContainer(const std::string& id);
     void PropagateUpdates();
@@ -125,7 +155,8 @@ public:
                              NPT_UInt32                    requested_count,
                              const char*                   sort_criteria,
                              const PLT_HttpRequestContext& context,
-                             const char*                   parent_id /* = NULL */);
+                             const char*                   parent_id /* = NULL */,
+                             DidlFragments*                fragments = nullptr);
 
     // class methods
     static void DefaultSortItems(CFileItemList& items);
@@ -142,6 +173,10 @@ public:
 
     NPT_Mutex m_CacheMutex;
 
+    NPT_Mutex m_BrowseCacheMutex;
+    std::map<std::string, std::shared_ptr<BrowseCacheEntry>> m_BrowseCache;
+    std::atomic<unsigned int> m_BrowseGeneration{0};
+
     NPT_Mutex m_FileMutex;
     NPT_Map<NPT_String, NPT_String> m_FileMap;
 
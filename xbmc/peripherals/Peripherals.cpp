@@ -18,6 +18,7 @@
 #include "bus/PeripheralBus.h"
 #include "bus/PeripheralBusUSB.h"
 
+#include <algorithm>
 #include <mutex>
 #include <utility>
 #if defined(TARGET_ANDROID)
@@ -157,6 +158,7 @@ void CPeripherals::Clear()
   for (const auto& bus : busses)
     bus->Clear();
   busses.clear();
+  m_joystickCount = 0;
 
   {
     std::unique_lock<CCriticalSection> mappingsLock(m_critSectionMappings);
@@ -195,6 +197,29 @@ void CPeripherals::TriggerDeviceScan(const PeripheralBusType type /* = PERIPHERA
   }
 }
 
+void CPeripherals::OnHotplugEvent()
+{
+  std::vector<PeripheralBusPtr> busses;
+  {
+    std::unique_lock<CCriticalSection> lock(m_critSectionBusses);
+    busses = m_busses;
+  }
+
+  for (auto& bus : busses)
+  {
+    if (bus->NeedsPolling())
+      bus->TriggerDeviceScan();
+  }
+}
+
+bool CPeripherals::HasHotplugEvents() const
+{
+  std::unique_lock<CCriticalSection> lock(m_critSectionBusses);
+
+  return std::any_of(m_busses.begin(), m_busses.end(),
+                     [](const PeripheralBusPtr& bus) { return bus->ReportsHotplug(); });
+}
+
 PeripheralBusPtr CPeripherals::GetBusByType(const PeripheralBusType type) const
 {
   std::unique_lock<CCriticalSection> lock(m_critSectionBusses);
@@ -389,6 +414,9 @@ void CPeripherals::CreatePeripheral(CPeripheralBus& bus, const PeripheralScanRes
 
 void CPeripherals::OnDeviceAdded(const CPeripheralBus& bus, const CPeripheral& peripheral)
 {
+  if (peripheral.HasFeature(FEATURE_JOYSTICK) && m_joystickCount++ == 0)
+    m_eventScanner->HandleEvents(false);
+
   OnDeviceChanged();
 
   //! @todo Improve device notifications in v18
@@ -406,6 +434,9 @@ void CPeripherals::OnDeviceAdded(const CPeripheralBus& bus, const CPeripheral& p
 
 void CPeripherals::OnDeviceDeleted(const CPeripheralBus& bus, const CPeripheral& peripheral)
 {
+  if (peripheral.HasFeature(FEATURE_JOYSTICK) && m_joystickCount > 0)
+    m_joystickCount--;
+
   OnDeviceChanged();
 
   //! @todo Improve device notifications in v18
@@ -878,6 +909,11 @@ void CPeripherals::ProcessEvents(void)
     bus->ProcessEvents();
 }
 
+bool CPeripherals::HasEventSources(void) const
+{
+  return m_joystickCount > 0;
+}
+
 void CPeripherals::EnableButtonMapping()
 {
   std::vector<PeripheralBusPtr> busses;
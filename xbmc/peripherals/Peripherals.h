@@ -18,6 +18,7 @@
 #include "threads/Thread.h"
 #include "utils/Observer.h"
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -163,6 +164,19 @@ public:
    */
   void TriggerDeviceScan(const PeripheralBusType type = PERIPHERAL_BUS_UNKNOWN);
 
+  /*!
+   * @brief Called by a bus that reports hotplug events when a device was added or removed
+   *
+   * Rescans all busses that poll for changes, so they pick up the device without waiting for
+   * their next poll.
+   */
+  void OnHotplugEvent();
+
+  /*!
+   * @return True if any bus is notified by the system about added and removed devices
+   */
+  bool HasHotplugEvents() const;
+
   /*!
    * @brief Get the instance of a bus given it's type.
    * @param type The bus type.
@@ -279,6 +293,7 @@ public:
 
   // implementation of IEventScannerCallback
   void ProcessEvents(void) override;
+  bool HasEventSources(void) const override;
 
   /*!
    * \brief Initialize button mapping
@@ -380,6 +395,7 @@ private:
   std::vector<PeripheralBusPtr> m_busses;
   std::vector<PeripheralDeviceMapping> m_mappings;
   std::unique_ptr<CEventScanner> m_eventScanner;
+  std::atomic<unsigned int> m_joystickCount{0};
   mutable CCriticalSection m_critSectionBusses;
   mutable CCriticalSection m_critSectionMappings;
   CCriticalSection m_addonInstallMutex;
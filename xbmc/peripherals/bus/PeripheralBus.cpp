@@ -24,6 +24,10 @@ using namespace std::chrono_literals;
 namespace
 {
 constexpr auto PERIPHERAL_DEFAULT_RESCAN_INTERVAL = 5000ms;
+
+// rescan interval of polling busses while another bus reports hotplug events. This only catches
+// devices that change without a hotplug event.
+constexpr auto PERIPHERAL_HOTPLUG_RESCAN_INTERVAL = 60000ms;
 }
 
 CPeripheralBus::CPeripheralBus(const std::string& threadname,
@@ -223,7 +227,8 @@ void CPeripheralBus::Process(void)
       break;
 
     if (!m_bStop)
-      m_triggerEvent.Wait(m_iRescanTime);
+      m_triggerEvent.Wait(m_manager.HasHotplugEvents() ? PERIPHERAL_HOTPLUG_RESCAN_INTERVAL
+                                                       : m_iRescanTime);
   }
 }
 
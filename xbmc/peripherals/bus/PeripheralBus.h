@@ -11,6 +11,7 @@
 #include "peripherals/PeripheralTypes.h"
 #include "threads/Thread.h"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -39,6 +40,11 @@ class CPeripherals;
  * m_bNeedsPolling to false in the constructor, and implement the OnDeviceAdded(), OnDeviceChanged()
  * and OnDeviceRemoved() methods.
  *
+ * A bus that is notified by the system about hotplugged devices sets m_bReportsHotplug and calls
+ * CPeripherals::OnHotplugEvent() when a device is added or removed. As long as any bus reports
+ * hotplug events, the polling busses are rescanned on these events and only poll at a long safety
+ * interval.
+ *
  * The PerformDeviceScan() method has to be implemented by each specific bus implementation.
  */
 class CPeripheralBus : protected CThread
@@ -62,6 +68,11 @@ public:
     return m_bNeedsPolling;
   }
 
+  /*!
+   * @return True if this bus is notified by the system when devices are added or removed
+   */
+  bool ReportsHotplug(void) const { return m_bReportsHotplug; }
+
   /*!
    * \brief Initialize the properties of a peripheral with a known location
    */
@@ -214,6 +225,8 @@ protected:
   bool m_bNeedsPolling =
       true; /*!< true when this bus needs to be polled for new devices, false when it
                            uses callbacks to notify this bus of changed */
+  std::atomic<bool> m_bReportsHotplug{
+      false}; /*!< true when the system notifies this bus of added and removed devices */
   CPeripherals& m_manager;
   const PeripheralBusType m_type;
   mutable CCriticalSection m_critSection;
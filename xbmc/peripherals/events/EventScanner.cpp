@@ -19,6 +19,10 @@ using namespace PERIPHERALS;
 // Default event scan rate when no polling handles are held
 #define DEFAULT_SCAN_RATE_HZ 60
 
+// Scan rate when no connected device delivers input through the scanner. The
+// scanner is woken up immediately when such a device is connected.
+#define IDLE_SCAN_RATE_HZ 1
+
 // Timeout when a polling handle is held but doesn't trigger scan. This reduces
 // input latency when the game is running at < 1/4 speed.
 #define WATCHDOG_TIMEOUT_MS 80
@@ -164,6 +168,9 @@ std::chrono::milliseconds CEventScanner::GetScanIntervalMs() const
     bHasActiveHandle = !m_activeHandles.empty();
   }
 
+  if (!bHasActiveHandle && !m_callback.HasEventSources())
+    return std::chrono::milliseconds(1000 / IDLE_SCAN_RATE_HZ);
+
   if (!bHasActiveHandle)
   {
     // this truncates to 16 (from 16.666) should it round up to 17 using std::nearbyint or should we use nanoseconds?
@@ -19,5 +19,12 @@ public:
   virtual ~IEventScannerCallback(void) = default;
 
   virtual void ProcessEvents(void) = 0;
+
+  /*!
+   * \brief Whether any connected device delivers its input through ProcessEvents()
+   *
+   * When there is none, the event scanner only wakes up at an idle rate.
+   */
+  virtual bool HasEventSources(void) const { return true; }
 };
 } // namespace PERIPHERALS
@@ -25,6 +25,7 @@
 #include "guilib/GUIWindowManager.h"
 #include "guilib/LocalizeStrings.h"
 #include "guilib/Texture.h"
+#include "guilib/TextureMemory.h"
 #include "input/actions/Action.h"
 #include "input/actions/ActionIDs.h"
 #include "input/mouse/MouseEvent.h"
@@ -43,6 +44,7 @@
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <memory>
 #include <random>
 
@@ -69,6 +71,9 @@ using namespace std::chrono_literals;
 
 static float zoomamount[10] = { 1.0f, 1.2f, 1.5f, 2.0f, 2.8f, 4.0f, 6.0f, 9.0f, 13.5f, 20.0f };
 
+//! number of pictures after the next one decoded ahead
+static constexpr size_t DECODE_AHEAD = 2;
+
 CBackgroundPicLoader::CBackgroundPicLoader() : CThread("BgPicLoader")
 {
 }
@@ -95,15 +100,18 @@ void CBackgroundPicLoader::Process()
     {
       if (m_pCallback)
       {
-        auto start = std::chrono::steady_clock::now();
-        std::unique_ptr<CTexture> texture =
-            CTexture::LoadFromFile(m_strFileName, m_maxWidth, m_maxHeight);
+        std::unique_ptr<CTexture> texture;
+        if (!TakeDecoded(texture))
+        {
+          auto start = std::chrono::steady_clock::now();
+          texture = Decode(m_strFileName, m_maxWidth, m_maxHeight);
 
-        auto end = std::chrono::steady_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+          auto end = std::chrono::steady_clock::now();
+          auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
 
-        totalTime += duration;
-        count++;
+          totalTime += duration;
+          count++;
+        }
         // tell our parent
         bool bFullSize = false;
         if (texture)
@@ -125,12 +133,90 @@ void CBackgroundPicLoader::Process()
         m_isLoading = false;
       }
     }
+    else
+      DecodeNextAhead();
   }
   if (count > 0)
     CLog::Log(LOGDEBUG, "Time for loading {} images: {} ms, average {} ms", count,
               totalTime.count(), totalTime.count() / count);
 }
 
+std::unique_ptr<CTexture> CBackgroundPicLoader::Decode(const std::string& fileName,
+                                                       int maxWidth,
+                                                       int maxHeight) const
+{
+  std::unique_ptr<CTexture> texture = CTexture::LoadFromFile(fileName, maxWidth, maxHeight);
+  if (texture)
+    texture->SetMemoryConsumer(TextureConsumer::SLIDESHOW);
+  return texture;
+}
+
+bool CBackgroundPicLoader::TakeDecoded(std::unique_ptr<CTexture>& texture)
+{
+  std::unique_lock<CCriticalSection> lock(m_aheadSection);
+  for (auto it = m_decoded.begin(); it != m_decoded.end(); ++it)
+  {
+    if (it->fileName == m_strFileName && it->maxWidth == m_maxWidth &&
+        it->maxHeight == m_maxHeight && it->texture)
+    {
+      texture = std::move(it->texture);
+      m_decoded.erase(it);
+      return true;
+    }
+  }
+  return false;
+}
+
+void CBackgroundPicLoader::DecodeNextAhead()
+{
+  std::string fileName;
+  int maxWidth;
+  int maxHeight;
+  {
+    std::unique_lock<CCriticalSection> lock(m_aheadSection);
+    // forget the pictures that are no longer ahead
+    m_decoded.remove_if(
+        [this](const DecodedPic& pic)
+        {
+          return std::find(m_aheadFiles.begin(), m_aheadFiles.end(), pic.fileName) ==
+                     m_aheadFiles.end() ||
+                 pic.maxWidth != m_aheadWidth || pic.maxHeight != m_aheadHeight;
+        });
+
+    for (const auto& file : m_aheadFiles)
+    {
+      if (std::none_of(m_decoded.begin(), m_decoded.end(),
+                       [&file](const DecodedPic& pic) { return pic.fileName == file; }))
+      {
+        fileName = file;
+        break;
+      }
+    }
+    maxWidth = m_aheadWidth;
+    maxHeight = m_aheadHeight;
+  }
+
+  if (fileName.empty() || CTextureMemory::IsUnderPressure(TextureConsumer::SLIDESHOW))
+    return;
+
+  std::unique_ptr<CTexture> texture = Decode(fileName, maxWidth, maxHeight);
+
+  std::unique_lock<CCriticalSection> lock(m_aheadSection);
+  if (std::find(m_aheadFiles.begin(), m_aheadFiles.end(), fileName) != m_aheadFiles.end() &&
+      maxWidth == m_aheadWidth && maxHeight == m_aheadHeight)
+    m_decoded.push_back({fileName, maxWidth, maxHeight, std::move(texture)});
+}
+
+void CBackgroundPicLoader::DecodeAhead(const std::vector<std::string>& fileNames,
+                                       int maxWidth,
+                                       int maxHeight)
+{
+  std::unique_lock<CCriticalSection> lock(m_aheadSection);
+  m_aheadFiles = fileNames;
+  m_aheadWidth = maxWidth;
+  m_aheadHeight = maxHeight;
+}
+
 void CBackgroundPicLoader::LoadPic(int iPic, int iSlideNumber, const std::string &strFileName, const int maxWidth, const int maxHeight)
 {
   m_iPic = iPic;
@@ -247,6 +333,7 @@ void CGUIWindowSlideShow::Reset()
   m_iCurrentPic = 0;
   m_iDirection = 1;
   m_iLastFailedNextSlide = -1;
+  m_iFullSizeSlide = -1;
   m_slides.clear();
   AnnouncePlaylistClear();
   m_Resolution = CServiceBroker::GetWinSystem()->GetGfxContext().GetVideoResolution();
@@ -545,6 +632,29 @@ void CGUIWindowSlideShow::Process(unsigned int currentTime, CDirtyRegionList &re
                      (float)res.iHeight * m_fZoom,
                      maxWidth, maxHeight);
       m_pBackgroundLoader->LoadPic(1 - m_iCurrentPic, m_iNextSlide, picturePath, maxWidth, maxHeight);
+
+      // and the pictures after it, while the loader has nothing else to do
+      GetCheckedSize(static_cast<float>(res.iWidth), static_cast<float>(res.iHeight), maxWidth,
+                     maxHeight);
+      m_pBackgroundLoader->DecodeAhead(GetPicturesAhead(m_iNextSlide), maxWidth, maxHeight);
+    }
+  }
+
+  // zoomed into a picture that was decoded at screen size, decode it again at full size
+  if (m_fZoom > 1.0f && m_Image[m_iCurrentPic]->IsLoaded() &&
+      !m_Image[m_iCurrentPic]->FullSize() &&
+      m_Image[m_iCurrentPic]->SlideNumber() == m_iCurrentSlide &&
+      m_iFullSizeSlide != m_iCurrentSlide && !m_pBackgroundLoader->IsLoading() &&
+      !CTextureMemory::IsUnderPressure(TextureConsumer::SLIDESHOW))
+  {
+    const std::string picturePath = GetPicturePath(m_slides.at(m_iCurrentSlide).get());
+    if (!picturePath.empty())
+    {
+      CLog::Log(LOGDEBUG, "Loading the current image {} at full size: {}", m_iCurrentSlide,
+                m_slides.at(m_iCurrentSlide)->GetPath());
+      const int maxSize = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
+      m_iFullSizeSlide = m_iCurrentSlide;
+      m_pBackgroundLoader->LoadPic(m_iCurrentPic, m_iCurrentSlide, picturePath, maxSize, maxSize);
     }
   }
 
@@ -657,6 +767,7 @@ void CGUIWindowSlideShow::Process(unsigned int currentTime, CDirtyRegionList &re
     m_iZoomFactor = 1;
     m_fZoom = 1.0f;
     m_fRotate = 0.0f;
+    m_iFullSizeSlide = -1;
   }
 
   if (bPlayVideo && !PlayVideo())
@@ -732,6 +843,29 @@ void CGUIWindowSlideShow::RenderEx()
   CGUIWindow::RenderEx();
 }
 
+std::vector<std::string> CGUIWindowSlideShow::GetPicturesAhead(int slide) const
+{
+  std::vector<std::string> pictures;
+  if (m_slides.size() <= 1)
+    return pictures;
+
+  const int step = m_iDirection >= 0 ? 1 : -1;
+  const int count = static_cast<int>(m_slides.size());
+  for (int i = 1; i < count && pictures.size() < DECODE_AHEAD; ++i)
+  {
+    const int index = ((slide + i * step) % count + count) % count;
+    if (index == m_iCurrentSlide)
+      break;
+
+    const CFileItemPtr& item = m_slides.at(index);
+    // video thumbs are looked up on demand
+    if (item->IsVideo() || item->HasProperty("unplayable"))
+      continue;
+    pictures.emplace_back(item->GetDynPath());
+  }
+  return pictures;
+}
+
 int CGUIWindowSlideShow::GetNextSlide()
 {
   if (m_slides.size() <= 1)
@@ -1212,6 +1346,13 @@ void CGUIWindowSlideShow::OnLoadPic(int iPic,
               m_slides.at(iSlideNumber)->GetPath());
     m_Image[iPic]->SetOriginalSize(pTexture->GetOriginalWidth(), pTexture->GetOriginalHeight(),
                                    bFullSize);
+    if (iSlideNumber == m_iFullSizeSlide && m_Image[iPic]->IsLoaded() &&
+        m_Image[iPic]->SlideNumber() == iSlideNumber)
+    { // the full size picture replaces the one shown, keeping zoom and position
+      m_Image[iPic]->UpdateTexture(std::move(pTexture));
+      MarkDirtyRegion();
+      return;
+    }
     m_Image[iPic]->SetTexture(iSlideNumber, std::move(pTexture), GetDisplayEffect(iSlideNumber));
 
     m_Image[iPic]->m_bIsComic = false;
@@ -1370,8 +1511,11 @@ void CGUIWindowSlideShow::AddItems(const std::string &strPath, path_set *recursi
 
 void CGUIWindowSlideShow::GetCheckedSize(float width, float height, int &maxWidth, int &maxHeight)
 {
-  maxWidth = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
-  maxHeight = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
+  // decode only what is needed to fill the (zoomed) screen, the current picture is decoded again
+  // at full size when zooming in. The size is square to fit pictures rotated by their orientation
+  const int size = static_cast<int>(std::max(width, height));
+  maxWidth = std::min(size, static_cast<int>(CServiceBroker::GetRenderSystem()->GetMaxTextureSize()));
+  maxHeight = maxWidth;
 }
 
 std::string CGUIWindowSlideShow::GetPicturePath(CFileItem *item)
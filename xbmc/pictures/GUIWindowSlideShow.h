@@ -11,11 +11,15 @@
 #include "SlideShowPicture.h"
 #include "guilib/GUIDialog.h"
 #include "interfaces/ISlideShowDelegate.h"
+#include "threads/CriticalSection.h"
 #include "threads/Event.h"
 #include "threads/Thread.h"
 
+#include <list>
 #include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 class CFileItemList;
 class CVariant;
@@ -30,12 +34,31 @@ public:
 
   void Create(CGUIWindowSlideShow *pCallback);
   void LoadPic(int iPic, int iSlideNumber, const std::string &strFileName, const int maxWidth, const int maxHeight);
+
+  /*!
+   \brief Decode the given pictures while no picture is requested, so they are ready when LoadPic()
+   asks for them. Replaces the pictures given before.
+   */
+  void DecodeAhead(const std::vector<std::string>& fileNames, int maxWidth, int maxHeight);
+
   bool IsLoading() { return m_isLoading; }
   int SlideNumber() const { return m_iSlideNumber; }
   int Pic() const { return m_iPic; }
 
 private:
+  struct DecodedPic
+  {
+    std::string fileName;
+    int maxWidth;
+    int maxHeight;
+    std::unique_ptr<CTexture> texture; ///< nullptr if the picture failed to decode
+  };
+
   void Process() override;
+  std::unique_ptr<CTexture> Decode(const std::string& fileName, int maxWidth, int maxHeight) const;
+  bool TakeDecoded(std::unique_ptr<CTexture>& texture);
+  void DecodeNextAhead();
+
   int m_iPic = 0;
   int m_iSlideNumber = 0;
   std::string m_strFileName;
@@ -45,6 +68,12 @@ private:
   CEvent m_loadPic;
   bool m_isLoading = false;
 
+  CCriticalSection m_aheadSection;
+  std::vector<std::string> m_aheadFiles;
+  int m_aheadWidth = 0;
+  int m_aheadHeight = 0;
+  std::list<DecodedPic> m_decoded;
+
   CGUIWindowSlideShow* m_pCallback = nullptr;
 };
 
@@ -122,6 +151,7 @@ private:
   void ZoomRelative(float fZoom, bool immediate = false);
   void Move(float fX, float fY);
   void GetCheckedSize(float width, float height, int &maxWidth, int &maxHeight);
+  std::vector<std::string> GetPicturesAhead(int slide) const;
   std::string GetPicturePath(CFileItem *item);
   int  GetNextSlide();
 
@@ -156,6 +186,7 @@ private:
   // background loader
   std::unique_ptr<CBackgroundPicLoader> m_pBackgroundLoader;
   int m_iLastFailedNextSlide;
+  int m_iFullSizeSlide = -1; ///< slide decoded again at full size for zooming
   bool m_bLoadNextPic;
   RESOLUTION m_Resolution;
   CPoint m_firstGesturePoint;
@@ -418,7 +418,10 @@ void CXBMCApp::onConfigurationChanged()
 void CXBMCApp::onLowMemory()
 {
   android_printf("%s: ", __PRETTY_FUNCTION__);
-  // can't do much as we don't want to close completely
+  // we don't want to close completely, but the windows not shown can give up their memory
+  CGUIComponent* gui = CServiceBroker::GetGUI();
+  if (gui)
+    gui->GetWindowManager().OnLowMemory();
 }
 
 void CXBMCApp::onCreateWindow(ANativeWindow* window)
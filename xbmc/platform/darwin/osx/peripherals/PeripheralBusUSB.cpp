@@ -48,6 +48,8 @@ CPeripheralBusUSB::CPeripheralBusUSB(CPeripherals& manager) :
     (IOServiceMatchingCallback)DeviceAttachCallback, this, &m_attach_iterator);
   if (result == kIOReturnSuccess)
   {
+    m_bReportsHotplug = true;
+
     //call the callback to 'arm' the notification
     DeviceAttachCallback(this, m_attach_iterator);
   }
@@ -113,6 +115,7 @@ void CPeripheralBusUSB::DeviceDetachCallback(void *refCon, io_service_t service,
         ++it;
     }
     privateDataRef->refCon->ScanForDevices();
+    privateDataRef->refCon->m_manager.OnHotplugEvent();
 
     CLog::Log(LOGDEBUG, "USB Device Detach:{}, {}", privateDataRef->deviceName,
               privateDataRef->result.m_strLocation);
@@ -284,4 +287,5 @@ void CPeripheralBusUSB::DeviceAttachCallback(CPeripheralBusUSB* refCon, io_itera
     IOObjectRelease(usbDevice);
   }
   refCon->ScanForDevices();
+  refCon->m_manager.OnHotplugEvent();
 }
@@ -134,11 +134,27 @@ CCPUInfoLinux::CCPUInfoLinux()
 
   m_cpuCount = sysconf(_SC_NPROCESSORS_ONLN);
 
+  int maxFreq = 0;
   for (int core = 0; core < m_cpuCount; core++)
   {
     CoreInfo coreInfo;
     coreInfo.m_id = core;
     m_cores.emplace_back(coreInfo);
+
+    // asymmetric (big.LITTLE) systems are told apart by the max frequency of the cores
+    CSysfsPath maxFreqPath{"/sys/devices/system/cpu/cpu" + std::to_string(core) +
+                           "/cpufreq/cpuinfo_max_freq"};
+    if (!maxFreqPath.Exists())
+      continue;
+
+    const int freq = maxFreqPath.Get<int>().value_or(0);
+    if (freq > maxFreq)
+    {
+      maxFreq = freq;
+      m_performanceCoreCount = 1;
+    }
+    else if (freq == maxFreq && freq > 0)
+      m_performanceCoreCount++;
   }
 
 #if defined(__i386__) || defined(__x86_64__)
@@ -13,6 +13,8 @@ extern "C" {
 }
 #include <cassert>
 #include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
 #include "utils/log.h"
 
 #ifndef USB_CLASS_PER_INTERFACE
@@ -73,11 +75,22 @@ CPeripheralBusUSB::CPeripheralBusUSB(CPeripherals& manager) :
 
   m_udev          = NULL;
   m_udevMon       = NULL;
+
+  /* used to wake up the thread when it's waiting for udev events */
+  m_wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (m_wakeFd < 0)
+    CLog::Log(LOGWARNING, "{} - failed to create wake up event, falling back to polling",
+              __FUNCTION__);
 }
 
 CPeripheralBusUSB::~CPeripheralBusUSB(void)
 {
+  StopThread(false);
+  WakeUp();
   StopThread(true);
+
+  if (m_wakeFd >= 0)
+    close(m_wakeFd);
 }
 
 bool CPeripheralBusUSB::PerformDeviceScan(PeripheralScanResults &results)
@@ -193,17 +206,29 @@ void CPeripheralBusUSB::Process(void)
     CLog::Log(LOGERROR, "Could not limit filter on USB only");
   }
 
+  /* input devices that aren't on the USB bus (e.g. bluetooth joysticks) are scanned by the
+     add-on bus, which only needs a hint that something changed */
+  if (udev_monitor_filter_add_match_subsystem_devtype(m_udevMon, "input", nullptr) < 0)
+  {
+    CLog::Log(LOGERROR, "Could not add input devices to filter");
+  }
+
   CLog::Log(LOGDEBUG, "{} - initialised udev monitor", __FUNCTION__);
 
-  udev_monitor_enable_receiving(m_udevMon);
+  if (udev_monitor_enable_receiving(m_udevMon) == 0)
+    m_bReportsHotplug = true;
   bool bUpdated(false);
   ScanForDevices();
   while (!m_bStop)
   {
     bUpdated = WaitForUpdate();
     if (bUpdated && !m_bStop)
+    {
       ScanForDevices();
+      m_manager.OnHotplugEvent();
+    }
   }
+  m_bReportsHotplug = false;
   udev_monitor_unref(m_udevMon);
   udev_unref(m_udev);
 }
@@ -211,6 +236,7 @@ void CPeripheralBusUSB::Process(void)
 void CPeripheralBusUSB::Clear(void)
 {
   StopThread(false);
+  WakeUp();
 
   CPeripheralBus::Clear();
 }
@@ -225,24 +251,51 @@ bool CPeripheralBusUSB::WaitForUpdate()
     return false;
   }
 
-  /* poll for udev changes */
-  struct pollfd pollFd;
-  pollFd.fd = udevFd;
-  pollFd.events = POLLIN;
+  /* wait for udev changes, or until the thread is woken up to stop. without a wake up event the
+     stop flag has to be polled */
+  struct pollfd pollFds[2];
+  pollFds[0].fd = udevFd;
+  pollFds[0].events = POLLIN;
+  pollFds[0].revents = 0;
+  pollFds[1].fd = m_wakeFd;
+  pollFds[1].events = POLLIN;
+  pollFds[1].revents = 0;
+  const nfds_t nFds = m_wakeFd >= 0 ? 2 : 1;
+  const int iTimeout = m_wakeFd >= 0 ? -1 : 100;
   int iPollResult;
-  while (!m_bStop && ((iPollResult = poll(&pollFd, 1, 100)) <= 0))
+  while (!m_bStop && ((iPollResult = poll(pollFds, nFds, iTimeout)) <= 0))
     if (errno != EINTR && iPollResult != 0)
       break;
 
+  /* reset the wake up event, so it doesn't trigger again if the thread is restarted */
+  if (nFds > 1 && (pollFds[1].revents & POLLIN))
+  {
+    uint64_t value;
+    if (read(m_wakeFd, &value, sizeof(value)) < 0)
+      CLog::Log(LOGDEBUG, "{} - failed to reset wake up event", __FUNCTION__);
+  }
+
   /* the thread is being stopped, so just return false */
   if (m_bStop)
     return false;
 
-  /* we have to read the message from the queue, even though we're not actually using it */
-  struct udev_device *dev = udev_monitor_receive_device(m_udevMon);
-  if (dev)
+  if (!(pollFds[0].revents & POLLIN))
+    return false;
+
+  /* we have to read the messages from the queue, even though we're not actually using them. a
+     hotplugged device sends a burst of events, which is handled by a single scan */
+  bool bReceived = false;
+  do
+  {
+    struct udev_device *dev = udev_monitor_receive_device(m_udevMon);
+    if (!dev)
+      break;
     udev_device_unref(dev);
-  else
+    bReceived = true;
+    pollFds[0].revents = 0;
+  } while (poll(pollFds, 1, 0) > 0 && (pollFds[0].revents & POLLIN));
+
+  if (!bReceived)
   {
     CLog::Log(LOGERROR, "{} - failed to get device from udev_monitor_receive_device()",
               __FUNCTION__);
@@ -252,3 +305,13 @@ bool CPeripheralBusUSB::WaitForUpdate()
 
   return true;
 }
+
+void CPeripheralBusUSB::WakeUp()
+{
+  if (m_wakeFd >= 0)
+  {
+    const uint64_t value = 1;
+    if (write(m_wakeFd, &value, sizeof(value)) < 0)
+      CLog::Log(LOGERROR, "{} - failed to wake up udev monitor thread", __FUNCTION__);
+  }
+}
@@ -36,8 +36,10 @@ namespace PERIPHERALS
 
     void Process(void) override;
     bool WaitForUpdate(void);
+    void WakeUp(void);
 
     struct udev *        m_udev;
     struct udev_monitor *m_udevMon;
+    int                  m_wakeFd = -1;
   };
 }
@@ -0,0 +1,224 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PosixMappedFile.h"
+
+#include "URL.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <string.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace XFILE;
+
+namespace
+{
+// size of the mapping, large enough to keep remapping rare even for UHD remuxes
+constexpr int64_t WINDOW_SIZE = 64 * 1024 * 1024;
+// how far ahead of the read position the kernel is asked to read
+constexpr int64_t READAHEAD_SIZE = 8 * 1024 * 1024;
+} // namespace
+
+CPosixMappedFile::~CPosixMappedFile()
+{
+  UnmapWindow();
+}
+
+bool CPosixMappedFile::Open(const CURL& url)
+{
+  if (!CPosixFile::Open(url))
+    return false;
+
+  m_length = CPosixFile::GetLength();
+  m_position = 0;
+  m_advisedPos = -1;
+
+  if (m_length < 0)
+  {
+    Close();
+    return false;
+  }
+
+  return true;
+}
+
+void CPosixMappedFile::Close()
+{
+  UnmapWindow();
+  m_position = 0;
+  m_length = 0;
+  CPosixFile::Close();
+}
+
+void CPosixMappedFile::UnmapWindow()
+{
+  if (m_window)
+  {
+    munmap(m_window, m_windowSize);
+    m_window = nullptr;
+    m_windowSize = 0;
+  }
+}
+
+bool CPosixMappedFile::MapWindow(int64_t position)
+{
+  UnmapWindow();
+
+  // the file might be growing (recordings), look again before giving up at the end
+  if (position >= m_length)
+    m_length = CPosixFile::GetLength();
+  if (position >= m_length)
+    return false;
+
+  static const int64_t pageSize = sysconf(_SC_PAGESIZE);
+  m_windowStart = position - position % pageSize;
+  m_windowSize = static_cast<size_t>(std::min(WINDOW_SIZE, m_length - m_windowStart));
+
+  void* window = mmap(nullptr, m_windowSize, PROT_READ, MAP_SHARED, m_fd, m_windowStart);
+  if (window == MAP_FAILED)
+  {
+    CLog::LogF(LOGERROR, "mmap failed: {}", strerror(errno));
+    m_windowSize = 0;
+    return false;
+  }
+
+  m_window = static_cast<uint8_t*>(window);
+  madvise(m_window, m_windowSize, MADV_SEQUENTIAL);
+  m_advisedPos = -1;
+  return true;
+}
+
+void CPosixMappedFile::Advise()
+{
+  const int64_t windowEnd = m_windowStart + m_windowSize;
+  const int64_t ahead = std::min(windowEnd, m_position + READAHEAD_SIZE);
+
+  // only ask again once half of the read ahead is consumed
+  if (m_advisedPos >= 0 && ahead - m_advisedPos < READAHEAD_SIZE / 2)
+    return;
+
+  const int64_t start = std::max(m_position, m_advisedPos);
+  static const int64_t pageSize = sysconf(_SC_PAGESIZE);
+  const int64_t alignedStart = start - start % pageSize;
+  if (ahead > alignedStart)
+    madvise(m_window + (alignedStart - m_windowStart), ahead - alignedStart, MADV_WILLNEED);
+
+  // pages behind us won't be read again in sequential playback
+  const int64_t behind = m_position - READAHEAD_SIZE;
+  if (behind - m_windowStart >= pageSize)
+  {
+    const int64_t alignedBehind = behind - behind % pageSize;
+    madvise(m_window, alignedBehind - m_windowStart, MADV_DONTNEED);
+  }
+
+  m_advisedPos = ahead;
+}
+
+ssize_t CPosixMappedFile::Read(void* lpBuf, size_t uiBufSize)
+{
+  if (m_fd < 0)
+    return -1;
+
+  SPeekBuffer peek{nullptr, uiBufSize};
+  if (IoControl(IOCTRL_PEEK_BUFFER, &peek) < 0)
+    return -1;
+
+  if (peek.size > 0)
+  {
+    memcpy(lpBuf, peek.data, peek.size);
+    m_position += peek.size;
+  }
+
+  return static_cast<ssize_t>(peek.size);
+}
+
+int64_t CPosixMappedFile::Seek(int64_t iFilePosition, int iWhence)
+{
+  if (m_fd < 0)
+    return -1;
+
+  int64_t position;
+  switch (iWhence)
+  {
+    case SEEK_SET:
+      position = iFilePosition;
+      break;
+    case SEEK_CUR:
+      position = m_position + iFilePosition;
+      break;
+    case SEEK_END:
+      position = GetLength() + iFilePosition;
+      break;
+    default:
+      return -1;
+  }
+
+  if (position < 0)
+    return -1;
+
+  m_position = position;
+  return m_position;
+}
+
+int64_t CPosixMappedFile::GetPosition()
+{
+  if (m_fd < 0)
+    return -1;
+
+  return m_position;
+}
+
+int64_t CPosixMappedFile::GetLength()
+{
+  if (m_fd < 0)
+    return -1;
+
+  m_length = std::max(m_length, CPosixFile::GetLength());
+  return m_length;
+}
+
+int CPosixMappedFile::IoControl(EIoControl request, void* param)
+{
+  if (m_fd < 0)
+    return -1;
+
+  if (request == IOCTRL_SEEK_POSSIBLE)
+    return 1;
+
+  if (request == IOCTRL_PEEK_BUFFER)
+  {
+    SPeekBuffer* peek = static_cast<SPeekBuffer*>(param);
+    if (!peek)
+      return -1;
+
+    if (!m_window || m_position < m_windowStart ||
+        m_position >= m_windowStart + static_cast<int64_t>(m_windowSize))
+    {
+      if (!MapWindow(m_position))
+      {
+        // end of file
+        peek->data = nullptr;
+        peek->size = 0;
+        return 0;
+      }
+    }
+
+    Advise();
+
+    const int64_t offset = m_position - m_windowStart;
+    peek->data = m_window + offset;
+    peek->size = std::min(peek->size, static_cast<size_t>(m_windowSize - offset));
+    return 0;
+  }
+
+  return CPosixFile::IoControl(request, param);
+}
@@ -0,0 +1,55 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "PosixFile.h"
+
+#include <stdint.h>
+
+namespace XFILE
+{
+
+  /*!
+   * \brief Read only local file accessed through a sliding mmap window.
+   *
+   * Used instead of CFileCache for local files, Read() copies straight out of the page cache and
+   * IOCTRL_PEEK_BUFFER hands out pointers into the mapping without any copy. Read ahead and
+   * drop behind hints are given to the kernel based on the read position.
+   */
+  class CPosixMappedFile : public CPosixFile
+  {
+  public:
+    ~CPosixMappedFile() override;
+
+    bool Open(const CURL& url) override;
+    bool OpenForWrite(const CURL& url, bool bOverWrite = false) override { return false; }
+    void Close() override;
+
+    ssize_t Read(void* lpBuf, size_t uiBufSize) override;
+    ssize_t Write(const void* lpBuf, size_t uiBufSize) override { return -1; }
+    int64_t Seek(int64_t iFilePosition, int iWhence = SEEK_SET) override;
+    int Truncate(int64_t size) override { return -1; }
+    int64_t GetPosition() override;
+    int64_t GetLength() override;
+    int IoControl(EIoControl request, void* param) override;
+
+  protected:
+    bool MapWindow(int64_t position);
+    void UnmapWindow();
+    void Advise();
+
+    uint8_t* m_window = nullptr;
+    int64_t m_windowStart = 0; //!< file offset of the mapping, page aligned
+    size_t m_windowSize = 0;
+    int64_t m_position = 0;
+    int64_t m_length = 0;
+    int64_t m_advisedPos = -1; //!< read ahead was requested up to here
+  };
+
+}
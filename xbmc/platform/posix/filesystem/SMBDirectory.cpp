@@ -354,6 +354,28 @@ bool CSMBDirectory::Remove(const CURL& url2)
   return true;
 }
 
+bool CSMBDirectory::GetCacheToken(const CURL& url2, std::string& token)
+{
+  // server and share lists have no meaningful mtime
+  if (url2.GetHostName().empty() || url2.GetShareName().empty())
+    return false;
+
+  std::unique_lock<CCriticalSection> lock(smb);
+  smb.Init();
+
+  CURL url = CSMB::GetResolvedUrl(url2);
+  CPasswordManager::GetInstance().AuthenticateURL(url);
+  std::string strFileName = smb.URLEncode(url);
+
+  struct stat info;
+  if (smbc_stat(strFileName.c_str(), &info) != 0 || !S_ISDIR(info.st_mode))
+    return false;
+
+  token = StringUtils::Format("{}.{}", static_cast<int64_t>(info.st_mtime),
+                              static_cast<int64_t>(info.st_ctime));
+  return true;
+}
+
 bool CSMBDirectory::Exists(const CURL& url2)
 {
   std::unique_lock<CCriticalSection> lock(smb);
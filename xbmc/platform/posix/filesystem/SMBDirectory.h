@@ -21,6 +21,7 @@ public:
   ~CSMBDirectory(void) override;
   bool GetDirectory(const CURL& url, CFileItemList &items) override;
   DIR_CACHE_TYPE GetCacheType(const CURL& url) const override { return DIR_CACHE_ONCE; }
+  bool GetCacheToken(const CURL& url, std::string& token) override;
   bool Create(const CURL& url) override;
   bool Exists(const CURL& url) override;
   bool Remove(const CURL& url) override;
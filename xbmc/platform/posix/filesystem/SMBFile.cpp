@@ -27,6 +27,7 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstring>
 #include <inttypes.h>
 #include <mutex>
@@ -377,6 +378,8 @@ int64_t CSMBFile::GetPosition()
 {
   if (m_fd == -1)
     return -1;
+  if (m_readAheadFill > 0)
+    return m_readAheadOffset + m_readAheadPos;
   std::unique_lock<CCriticalSection> lock(smb);
   if (!smb.IsSmbValid())
     return -1;
@@ -439,6 +442,12 @@ bool CSMBFile::Open(const CURL& url)
     m_fd = -1;
     return false;
   }
+
+  const size_t readAhead = static_cast<size_t>(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_sambareadahead) * 1024;
+  if (m_readAhead.size() != readAhead)
+    m_readAhead = std::vector<uint8_t>(readAhead);
+
   // We've successfully opened the file!
   return true;
 }
@@ -573,6 +582,53 @@ ssize_t CSMBFile::Read(void *lpBuf, size_t uiBufSize)
   if (uiBufSize == 0 && lpBuf == NULL)
     return 0;
 
+  uint8_t* buffer = static_cast<uint8_t*>(lpBuf);
+  size_t copied = 0;
+  if (m_readAheadPos < m_readAheadFill)
+  {
+    copied = std::min(uiBufSize, m_readAheadFill - m_readAheadPos);
+    std::memcpy(buffer, m_readAhead.data() + m_readAheadPos, copied);
+    m_readAheadPos += copied;
+    if (copied == uiBufSize)
+      return copied;
+  }
+
+  // like without the buffer, one read from the server at most for every call
+  ssize_t bytesRead;
+  const size_t remaining = uiBufSize - copied;
+  if (remaining >= m_readAhead.size())
+  {
+    // reads at least as large as the buffer gain nothing from it
+    DropReadAhead();
+    bytesRead = ReadDirect(buffer + copied, remaining);
+  }
+  else
+  {
+    // the file is positioned right after the data in the buffer
+    const int64_t offset =
+        m_readAheadFill > 0 ? m_readAheadOffset + m_readAheadFill : GetPosition();
+    DropReadAhead();
+    if (offset < 0)
+      return copied > 0 ? copied : -1;
+
+    m_readAheadOffset = offset;
+    bytesRead = ReadDirect(m_readAhead.data(), m_readAhead.size());
+    if (bytesRead > 0)
+    {
+      m_readAheadFill = bytesRead;
+      m_readAheadPos = std::min(remaining, m_readAheadFill);
+      std::memcpy(buffer + copied, m_readAhead.data(), m_readAheadPos);
+      bytesRead = m_readAheadPos;
+    }
+  }
+
+  if (bytesRead < 0)
+    return copied > 0 ? copied : bytesRead;
+  return copied + bytesRead;
+}
+
+ssize_t CSMBFile::ReadDirect(void* lpBuf, size_t uiBufSize)
+{
   std::unique_lock<CCriticalSection> lock(
       smb); // Init not called since it has to be "inited" by now
   if (!smb.IsSmbValid())
@@ -595,10 +651,35 @@ ssize_t CSMBFile::Read(void *lpBuf, size_t uiBufSize)
   return bytesRead;
 }
 
+void CSMBFile::DropReadAhead()
+{
+  m_readAheadFill = 0;
+  m_readAheadPos = 0;
+}
+
 int64_t CSMBFile::Seek(int64_t iFilePosition, int iWhence)
 {
   if (m_fd == -1) return -1;
 
+  if (m_readAheadFill > 0)
+  {
+    // the file is positioned after the buffer, relative seeks are from the read position
+    if (iWhence == SEEK_CUR)
+    {
+      iFilePosition += m_readAheadOffset + m_readAheadPos;
+      iWhence = SEEK_SET;
+    }
+
+    if (iWhence == SEEK_SET && iFilePosition >= m_readAheadOffset &&
+        iFilePosition <= m_readAheadOffset + static_cast<int64_t>(m_readAheadFill))
+    {
+      m_readAheadPos = static_cast<size_t>(iFilePosition - m_readAheadOffset);
+      return iFilePosition;
+    }
+
+    DropReadAhead();
+  }
+
   std::unique_lock<CCriticalSection> lock(
       smb); // Init not called since it has to be "inited" by now
   if (!smb.IsSmbValid())
@@ -617,6 +698,7 @@ int64_t CSMBFile::Seek(int64_t iFilePosition, int iWhence)
 
 void CSMBFile::Close()
 {
+  DropReadAhead();
   if (m_fd != -1)
   {
     CLog::Log(LOGDEBUG, "CSMBFile::Close closing fd {}", m_fd);
@@ -632,6 +714,14 @@ ssize_t CSMBFile::Write(const void* lpBuf, size_t uiBufSize)
 {
   if (m_fd == -1) return -1;
 
+  if (m_readAheadFill > 0)
+  {
+    const int64_t position = GetPosition();
+    DropReadAhead();
+    if (Seek(position, SEEK_SET) < 0)
+      return -1;
+  }
+
   // lpBuf can be safely casted to void* since xbmc_write will only read from it.
   std::unique_lock<CCriticalSection> lock(smb);
   if (!smb.IsSmbValid())
@@ -679,6 +769,7 @@ bool CSMBFile::OpenForWrite(const CURL& url, bool bOverWrite)
   m_fileSize = 0;
 
   Close();
+  m_readAhead.clear();
 
   // we can't open files like smb://file.f or smb://server/file.f
   // if a file matches the if below return false, it can't exist on a samba share.
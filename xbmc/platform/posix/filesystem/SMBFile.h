@@ -19,6 +19,8 @@
 #include "filesystem/IFile.h"
 #include "threads/CriticalSection.h"
 
+#include <vector>
+
 #define NT_STATUS_CONNECTION_REFUSED long(0xC0000000 | 0x0236)
 #define NT_STATUS_INVALID_HANDLE long(0xC0000000 | 0x0008)
 #define NT_STATUS_ACCESS_DENIED long(0xC0000000 | 0x0022)
@@ -86,8 +88,17 @@ protected:
   CURL m_url;
   bool IsValidFile(const std::string& strFileName);
   std::string GetAuthenticatedPath(const CURL &url);
+  ssize_t ReadDirect(void* lpBuf, size_t uiBufSize);
+  void DropReadAhead();
   int64_t m_fileSize;
   int m_fd;
   bool m_allowRetry;
+
+  // every smbc_read() costs at least one round trip to the server, so small reads are served from
+  // a buffer that is filled with reads of the read-ahead size from advancedsettings.xml
+  std::vector<uint8_t> m_readAhead;
+  int64_t m_readAheadOffset = 0; ///< file position of the start of the buffer
+  size_t m_readAheadFill = 0; ///< bytes in the buffer, the file is positioned after them
+  size_t m_readAheadPos = 0; ///< bytes of the buffer already returned by Read()
 };
 }
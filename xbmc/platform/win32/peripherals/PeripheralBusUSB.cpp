@@ -30,6 +30,9 @@ CPeripheralBusUSB::CPeripheralBusUSB(CPeripherals& manager) :
 {
   /* device removals aren't always triggering OnDeviceRemoved events, so poll for changes every 5 seconds to be sure we don't miss anything */
   m_iRescanTime = 5000ms;
+
+  /* WM_DEVICECHANGE notifications are handled in CWinEventsWin32 */
+  m_bReportsHotplug = true;
 }
 
 bool CPeripheralBusUSB::PerformDeviceScan(PeripheralScanResults &results)
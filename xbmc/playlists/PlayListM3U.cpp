@@ -11,14 +11,19 @@
 #include "FileItem.h"
 #include "URL.h"
 #include "Util.h"
+#include "filesystem/CurlFile.h"
 #include "filesystem/File.h"
+#include "filesystem/HttpCache.h"
 #include "music/tags/MusicInfoTag.h"
 #include "utils/CharsetConverter.h"
+#include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
+#include "utils/Utf8Utils.h"
 #include "utils/log.h"
 #include "video/VideoInfoTag.h"
 
 #include <inttypes.h>
+#include <vector>
 
 using namespace PLAYLIST;
 using namespace XFILE;
@@ -60,7 +65,36 @@ CPlayListM3U::~CPlayListM3U(void) = default;
 
 bool CPlayListM3U::Load(const std::string& strFileName)
 {
-  char szLine[4096];
+  Clear();
+
+  m_strPlayListName = URIUtils::GetFileName(strFileName);
+  URIUtils::GetParentPath(strFileName, m_strBasePath);
+  m_utf8 = URIUtils::GetExtension(strFileName) == ".m3u8";
+
+  // read the playlist in one go, IPTV playlists with tens of thousands of entries are common
+  std::string data;
+  if (URIUtils::IsInternetStream(strFileName) &&
+      (URIUtils::IsProtocol(strFileName, "http") || URIUtils::IsProtocol(strFileName, "https")))
+  {
+    // remote playlists are revalidated instead of downloaded again if they didn't change
+    CCurlFile http;
+    std::string contentType;
+    if (!CHttpCache::Get(http, strFileName, data, contentType))
+      return false;
+  }
+  else
+  {
+    std::vector<uint8_t> buffer;
+    if (CFile().LoadFile(strFileName, buffer) < 0)
+      return false;
+    data.assign(buffer.begin(), buffer.end());
+  }
+
+  return LoadData(data);
+}
+
+bool CPlayListM3U::LoadData(const std::string& strData)
+{
   std::string strLine;
   std::string strInfo;
   std::vector<std::pair<std::string, std::string> > properties;
@@ -69,26 +103,20 @@ bool CPlayListM3U::Load(const std::string& strFileName)
   int iStartOffset = 0;
   int iEndOffset = 0;
 
-  bool utf8 = false;
-  if (URIUtils::GetExtension(strFileName) == ".m3u8")
-    utf8 = true;
-
-  Clear();
-
-  m_strPlayListName = URIUtils::GetFileName(strFileName);
-  URIUtils::GetParentPath(strFileName, m_strBasePath);
+  // a playlist that is valid utf8 as a whole needs no conversion of each line
+  const bool utf8 = m_utf8 || CUtf8Utils::isValidUtf8(strData);
 
-  CFile file;
-  if (!file.Open(strFileName) )
-  {
-    file.Close();
-    return false;
-  }
-
-  while (file.ReadString(szLine, 4095))
+  size_t lineStart = 0;
+  while (lineStart < strData.size())
   {
-    strLine = szLine;
+    size_t lineEnd = strData.find_first_of("\r\n", lineStart);
+    if (lineEnd == std::string::npos)
+      lineEnd = strData.size();
+    strLine.assign(strData, lineStart, lineEnd - lineStart);
+    lineStart = lineEnd + 1;
     StringUtils::Trim(strLine);
+    if (strLine.empty())
+      continue;
 
     if (StringUtils::StartsWith(strLine, InfoMarker))
     {
@@ -209,7 +237,6 @@ bool CPlayListM3U::Load(const std::string& strFileName)
     }
   }
 
-  file.Close();
   return true;
 }
 
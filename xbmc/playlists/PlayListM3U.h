@@ -31,8 +31,12 @@ public:
   CPlayListM3U(void);
   ~CPlayListM3U(void) override;
   bool Load(const std::string& strFileName) override;
+  bool LoadData(const std::string& strData) override;
   void Save(const std::string& strFileName) const override;
 
   static std::map<std::string,std::string> ParseStreamLine(const std::string &streamLine);
+
+private:
+  bool m_utf8 = false; ///< the playlist is known to be utf8 encoded, e.g. by its .m3u8 extension
 };
 }
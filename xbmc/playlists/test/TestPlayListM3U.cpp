@@ -0,0 +1,44 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "playlists/PlayListM3U.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace PLAYLIST;
+
+TEST(TestPlayListM3U, LoadData)
+{
+  // IPTV playlists carry long attribute lists in their EXTINF lines
+  const std::string attributes(5000, 'a');
+  const std::string data = "#EXTM3U\r\n"
+                           "#EXTINF:-1 tvg-id=\"" +
+                           attributes +
+                           "\",Channel 1\r\n"
+                           "#KODIPROP:mimetype=video/mp2t\r\n"
+                           "http://example.com/channel1.ts\r\n"
+                           "\r\n"
+                           "# a comment\n"
+                           "#EXTINF:-1,Channel 2\n"
+                           "http://example.com/channel2.ts";
+
+  CPlayListM3U playlist;
+  EXPECT_TRUE(playlist.LoadData(data));
+  ASSERT_EQ(2, playlist.size());
+
+  EXPECT_EQ("Channel 1", playlist[0]->GetLabel());
+  EXPECT_EQ("http://example.com/channel1.ts", playlist[0]->GetPath());
+  EXPECT_EQ("video/mp2t", playlist[0]->GetMimeType());
+
+  EXPECT_EQ("Channel 2", playlist[1]->GetLabel());
+  EXPECT_EQ("http://example.com/channel2.ts", playlist[1]->GetPath());
+  EXPECT_TRUE(playlist[1]->GetMimeType().empty());
+}
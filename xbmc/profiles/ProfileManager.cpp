@@ -44,12 +44,14 @@
 #include "pvr/PVRManager.h" //! @todo Remove me
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "settings/SkinSettings.h"
 #include "settings/lib/SettingsManager.h"
 #if !defined(TARGET_WINDOWS) && defined(HAS_OPTICAL_DRIVE)
 #include "storage/DetectDVDType.h"
 #endif
 #include "threads/SingleLock.h"
 #include "utils/FileUtils.h"
+#include "utils/SaveFileStateJob.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
@@ -59,6 +61,7 @@
 #include "weather/WeatherManager.h" //! @todo Remove me
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -81,6 +84,36 @@ using namespace XFILE;
 
 static CProfile EmptyProfile;
 
+namespace
+{
+// logs how long each phase of loading a profile takes
+class CProfileLoadTimer
+{
+public:
+  void Phase(const char* phase)
+  {
+    const auto now = std::chrono::steady_clock::now();
+    CLog::Log(LOGINFO, "CProfileManager: {} took {} ms", phase,
+              std::chrono::duration_cast<std::chrono::milliseconds>(now - m_start).count());
+    m_start = now;
+  }
+
+private:
+  std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+};
+
+// the settings the loaded skin, its fonts and textures and its localized labels depend on
+std::vector<std::string> GetSkinState(const CSettings& settings)
+{
+  return {settings.GetString(CSettings::SETTING_LOOKANDFEEL_SKIN),
+          settings.GetString(CSettings::SETTING_LOOKANDFEEL_SKINTHEME),
+          settings.GetString(CSettings::SETTING_LOOKANDFEEL_SKINCOLORS),
+          settings.GetString(CSettings::SETTING_LOOKANDFEEL_FONT),
+          std::to_string(settings.GetInt(CSettings::SETTING_LOOKANDFEEL_SKINZOOM)),
+          settings.GetString(CSettings::SETTING_LOCALE_LANGUAGE)};
+}
+} // unnamed namespace
+
 CProfileManager::CProfileManager() : m_eventLogs(new CEventLogManager)
 {
 }
@@ -264,6 +297,7 @@ void CProfileManager::PrepareLoadProfile(unsigned int profileIndex)
   ADDON::CServiceAddonManager &serviceAddons = CServiceBroker::GetServiceAddons();
   PVR::CPVRManager &pvrManager = CServiceBroker::GetPVRManager();
   CNetworkBase &networkManager = CServiceBroker::GetNetwork();
+  CProfileLoadTimer timer;
 
   contextMenuManager.Deinit();
 
@@ -274,6 +308,8 @@ void CProfileManager::PrepareLoadProfile(unsigned int profileIndex)
 
   if (profileIndex != 0 || !IsMasterProfile())
     networkManager.NetworkMessage(CNetworkBase::SERVICES_DOWN, 1);
+
+  timer.Phase("stopping services");
 }
 
 bool CProfileManager::LoadProfile(unsigned int index)
@@ -286,6 +322,9 @@ bool CProfileManager::LoadProfile(unsigned int index)
     if (pWindow)
       pWindow->ResetControlStates();
 
+    // nothing the skin depends on changed
+    m_keepSkinLoaded = g_SkinInfo != nullptr;
+
     UpdateCurrentProfileDate();
     FinalizeLoadProfile();
 
@@ -301,6 +340,9 @@ bool CProfileManager::LoadProfile(unsigned int index)
   if (m_currentProfile == index)
     return true;
 
+  // file states still to be saved belong to the databases of the current profile
+  CSaveFileState::Flush();
+
   // save any settings of the currently used skin but only if the (master)
   // profile hasn't just been loaded as a temporary profile for login
   if (g_SkinInfo != nullptr && !m_previousProfileLoadedForLogin)
@@ -308,6 +350,8 @@ bool CProfileManager::LoadProfile(unsigned int index)
 
   // @todo: why is m_settings not used here?
   const std::shared_ptr<CSettings> settings = CServiceBroker::GetSettingsComponent()->GetSettings();
+  const std::vector<std::string> previousSkinState = GetSkinState(*settings);
+  CProfileLoadTimer timer;
 
   // unload any old settings
   settings->Unload();
@@ -324,9 +368,17 @@ bool CProfileManager::LoadProfile(unsigned int index)
   }
   settings->SetLoaded();
 
+  // the skin, its fonts and textures are shared by the profiles using the same look and feel, so
+  // only the skin settings have to be swapped
+  m_keepSkinLoaded = g_SkinInfo != nullptr && GetSkinState(*settings) == previousSkinState;
+  timer.Phase("loading settings");
+
   CreateProfileFolders();
 
   CServiceBroker::GetDatabaseManager().Initialize();
+  CSaveFileState::ReplayJournal();
+  timer.Phase("initializing databases");
+
   CServiceBroker::GetInputManager().LoadKeymaps();
 
   CServiceBroker::GetInputManager().SetMouseEnabled(settings->GetBool(CSettings::SETTING_INPUT_ENABLEMOUSE));
@@ -363,6 +415,7 @@ bool CProfileManager::LoadProfile(unsigned int index)
 
   CUtil::DeleteDirectoryCache();
   g_directoryCache.Clear();
+  timer.Phase("resetting the interface");
 
   lock.unlock();
 
@@ -385,6 +438,7 @@ void CProfileManager::FinalizeLoadProfile()
   CFavouritesService &favouritesManager = CServiceBroker::GetFavouritesService();
   PLAYLIST::CPlayListPlayer &playlistManager = CServiceBroker::GetPlaylistPlayer();
   CStereoscopicsManager &stereoscopicsManager = CServiceBroker::GetGUI()->GetStereoscopicsManager();
+  CProfileLoadTimer timer;
 
   if (m_lastUsedProfile != m_currentProfile)
   {
@@ -397,17 +451,34 @@ void CProfileManager::FinalizeLoadProfile()
 
   // reload the add-ons, or we will first load all add-ons from the master account without checking disabled status
   addonManager.ReInit();
+  timer.Phase("loading add-ons");
 
   // let CApplication know that we are logging into a new profile
   g_application.SetLoggingIn(true);
 
-  if (!g_application.LoadLanguage(true))
+  // the skin can only stay loaded if it is enabled in this profile as well
+  const bool keepSkinLoaded = m_keepSkinLoaded && g_SkinInfo != nullptr &&
+                              !addonManager.IsAddonDisabled(g_SkinInfo->ID());
+  m_keepSkinLoaded = false;
+
+  // reloading the language reloads the skin as well
+  if (!g_application.LoadLanguage(!keepSkinLoaded))
   {
     CLog::Log(LOGFATAL, "Unable to load language for profile \"{}\"",
               GetCurrentProfile().getName());
     return;
   }
 
+  if (keepSkinLoaded)
+  {
+    CSkinSettings::GetInstance().MigrateSettings(g_SkinInfo);
+    if (!g_SkinInfo->ReloadUserSettings())
+      CLog::Log(LOGWARNING, "CProfileManager: failed to load skin settings for profile \"{}\"",
+                GetCurrentProfile().getName());
+  }
+  timer.Phase(keepSkinLoaded ? "loading language and skin settings"
+                             : "loading language, reloading skin");
+
   weatherManager.Refresh();
 
   JSONRPC::CJSONRPC::Initialize();
@@ -429,6 +500,7 @@ void CProfileManager::FinalizeLoadProfile()
   }
 
   stereoscopicsManager.Initialize();
+  timer.Phase("starting services");
 
   // Load initial window
   int firstWindow = g_SkinInfo->GetFirstWindow();
@@ -209,6 +209,7 @@ private:
   bool m_usingLoginScreen = false;
   bool m_profileLoadedForLogin = false;
   bool m_previousProfileLoadedForLogin = false;
+  bool m_keepSkinLoaded = false; ///< the loaded profile uses the same skin as the previous one
   int m_autoLoginProfile = -1;
   unsigned int m_lastUsedProfile = 0;
   unsigned int m_currentProfile =
@@ -895,20 +895,34 @@ int CPVRDatabase::Get(CPVRChannelGroups& results,
   return GetGroups(results, query);
 }
 
-std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRDatabase::Get(
-    const CPVRChannelGroup& group, const std::vector<std::shared_ptr<CPVRClient>>& clients) const
+std::map<int, std::vector<std::shared_ptr<CPVRChannelGroupMember>>> CPVRDatabase::GetGroupMembers(
+    const std::vector<std::shared_ptr<CPVRChannelGroup>>& groups,
+    const std::vector<std::shared_ptr<CPVRClient>>& clients) const
 {
-  std::vector<std::shared_ptr<CPVRChannelGroupMember>> results;
+  std::map<int, std::vector<std::shared_ptr<CPVRChannelGroupMember>>> results;
 
-  /* invalid group id */
-  if (group.GroupID() < 0)
+  std::map<int, std::shared_ptr<const CPVRChannelGroup>> groupsById;
+  for (const auto& group : groups)
   {
-    CLog::LogF(LOGERROR, "Invalid channel group id: {}", group.GroupID());
+    if (group->GroupID() > 0)
+      groupsById.emplace(group->GroupID(), group);
+  }
+
+  if (groupsById.empty())
     return results;
+
+  std::string groupIds;
+  for (const auto& group : groupsById)
+  {
+    if (!groupIds.empty())
+      groupIds += ", ";
+
+    groupIds += std::to_string(group.first);
   }
 
   std::string strQuery =
-      "SELECT map_channelgroups_channels.idChannel, "
+      "SELECT map_channelgroups_channels.idGroup, "
+      "map_channelgroups_channels.idChannel, "
       "map_channelgroups_channels.iChannelNumber, "
       "map_channelgroups_channels.iSubChannelNumber, "
       "map_channelgroups_channels.iOrder, "
@@ -917,20 +931,31 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRDatabase::Get(
       "channels.iClientId, channels.iUniqueId, channels.bIsRadio "
       "FROM map_channelgroups_channels "
       "LEFT JOIN channels ON channels.idChannel = map_channelgroups_channels.idChannel "
-      "WHERE map_channelgroups_channels.idGroup = %i ";
+      "WHERE map_channelgroups_channels.idGroup IN (" +
+      groupIds + ") ";
   const std::string clientIds = GetClientIdsSQL(clients);
   if (!clientIds.empty())
     strQuery += "AND " + clientIds;
-  strQuery += " ORDER BY map_channelgroups_channels.iChannelNumber";
+  strQuery += " ORDER BY map_channelgroups_channels.idGroup, "
+              "map_channelgroups_channels.iChannelNumber";
 
   std::unique_lock<CCriticalSection> lock(m_critSection);
-  strQuery = PrepareSQL(strQuery, group.GroupID());
+  strQuery = PrepareSQL(strQuery);
   if (ResultQuery(strQuery))
   {
     try
     {
       while (!m_pDS->eof())
       {
+        const auto groupIt = groupsById.find(m_pDS->fv("idGroup").get_asInt());
+        if (groupIt == groupsById.end())
+        {
+          m_pDS->next();
+          continue;
+        }
+
+        const CPVRChannelGroup& group = *groupIt->second;
+
         const auto newMember = std::make_shared<CPVRChannelGroupMember>();
         newMember->m_iChannelDatabaseID = m_pDS->fv("idChannel").get_asInt();
         newMember->m_iChannelClientID = m_pDS->fv("iClientId").get_asInt();
@@ -947,7 +972,7 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRDatabase::Get(
         newMember->m_iOrder = static_cast<int>(m_pDS->fv("iOrder").get_asInt());
         newMember->SetGroupName(group.GroupName());
 
-        results.emplace_back(newMember);
+        results[group.GroupID()].emplace_back(newMember);
         m_pDS->next();
       }
       m_pDS->close();
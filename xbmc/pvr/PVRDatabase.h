@@ -232,13 +232,13 @@ namespace PVR
             const std::vector<std::shared_ptr<CPVRClient>>& clients) const;
 
     /*!
-     * @brief Get the members of a channel group.
-     * @param group The group to get the members for.
+     * @brief Get the members of channel groups, for all groups in a single query.
+     * @param groups The groups to get the members for. Groups without database id are skipped.
      * @param clients The PVR clients the group members should be loaded for. Leave empty for all clients.
-     * @return The group members.
+     * @return The group members, by group id and ordered by channel number.
      */
-    std::vector<std::shared_ptr<CPVRChannelGroupMember>> Get(
-        const CPVRChannelGroup& group,
+    std::map<int, std::vector<std::shared_ptr<CPVRChannelGroupMember>>> GetGroupMembers(
+        const std::vector<std::shared_ptr<CPVRChannelGroup>>& groups,
         const std::vector<std::shared_ptr<CPVRClient>>& clients) const;
 
     /*!
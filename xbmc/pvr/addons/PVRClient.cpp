@@ -144,6 +144,7 @@ void CPVRClient::ResetProperties()
   m_ifc.pvr->toKodi->TransferProviderEntry = cb_transfer_provider_entry;
   m_ifc.pvr->toKodi->TransferTimerEntry = cb_transfer_timer_entry;
   m_ifc.pvr->toKodi->TransferRecordingEntry = cb_transfer_recording_entry;
+  m_ifc.pvr->toKodi->TransferRecordingRemoved = cb_transfer_recording_removed;
   m_ifc.pvr->toKodi->AddMenuHook = cb_add_menu_hook;
   m_ifc.pvr->toKodi->RecordingNotification = cb_recording_notification;
   m_ifc.pvr->toKodi->TriggerChannelUpdate = cb_trigger_channel_update;
@@ -814,6 +815,22 @@ PVR_ERROR CPVRClient::GetRecordings(CPVRRecordings* results, bool deleted) const
                          (!deleted || m_clientCapabilities.SupportsRecordingsUndelete()));
 }
 
+PVR_ERROR CPVRClient::GetRecordingsChangedSince(CPVRRecordings* results,
+                                                bool deleted,
+                                                time_t since) const
+{
+  return DoAddonCall(
+      __func__,
+      [this, results, deleted, since](const AddonInstance* addon) {
+        PVR_HANDLE_STRUCT handle = {};
+        handle.callerAddress = this;
+        handle.dataAddress = results;
+        return addon->toAddon->GetRecordingsChangedSince(addon, &handle, deleted, since);
+      },
+      m_clientCapabilities.SupportsRecordingsDelta() &&
+          (!deleted || m_clientCapabilities.SupportsRecordingsUndelete()));
+}
+
 PVR_ERROR CPVRClient::DeleteRecording(const CPVRRecording& recording)
 {
   return DoAddonCall(
@@ -1807,6 +1824,22 @@ void CPVRClient::cb_transfer_recording_entry(void* kodiInstance,
   });
 }
 
+void CPVRClient::cb_transfer_recording_removed(void* kodiInstance,
+                                               const PVR_HANDLE handle,
+                                               const char* recordingId)
+{
+  HandleAddonCallback(__func__, kodiInstance, [&](CPVRClient* client) {
+    if (!handle || !recordingId)
+    {
+      CLog::LogF(LOGERROR, "Invalid callback parameter(s)");
+      return;
+    }
+
+    CPVRRecordings* recordings = static_cast<CPVRRecordings*>(handle->dataAddress);
+    recordings->RemoveFromClient(client->GetID(), recordingId);
+  });
+}
+
 void CPVRClient::cb_transfer_timer_entry(void* kodiInstance,
                                          const PVR_HANDLE handle,
                                          const PVR_TIMER* timer)
@@ -366,6 +366,15 @@ public:
    */
   PVR_ERROR GetRecordings(CPVRRecordings* results, bool deleted) const;
 
+  /*!
+   * @brief Request the recordings added, changed or removed on the backend since the given time.
+   * @param results The container to apply the changes to.
+   * @param deleted True to return deleted recordings.
+   * @param since The time the previous fetch started, in UTC.
+   * @return PVR_ERROR_NO_ERROR if the changes have been fetched successfully.
+   */
+  PVR_ERROR GetRecordingsChangedSince(CPVRRecordings* results, bool deleted, time_t since) const;
+
   /*!
    * @brief Delete a recording on the backend.
    * @param recording The recording to delete.
@@ -937,6 +946,16 @@ private:
                                           const PVR_HANDLE handle,
                                           const PVR_RECORDING* entry);
 
+  /*!
+   * @brief Transfer the id of a recording removed on the backend from the add-on to Kodi.
+   * @param kodiInstance Pointer to Kodi's CPVRClient class
+   * @param handle The handle parameter that Kodi used when requesting the recording changes
+   * @param recordingId The id of the removed recording
+   */
+  static void cb_transfer_recording_removed(void* kodiInstance,
+                                            const PVR_HANDLE handle,
+                                            const char* recordingId);
+
   /*!
    * @brief Add or replace a menu hook for the context menu for this add-on
    * @param kodiInstance Pointer to Kodi's CPVRClient class
@@ -243,6 +243,17 @@ public:
            m_addonCapabilities->bSupportsRecordingsDelete;
   }
 
+  /*!
+   * @brief Check whether this add-on supports transferring only the recordings changed since a
+   * given time.
+   * @return True if supported, false otherwise.
+   */
+  bool SupportsRecordingsDelta() const
+  {
+    return m_addonCapabilities && m_addonCapabilities->bSupportsRecordings &&
+           m_addonCapabilities->bSupportsRecordingsDelta;
+  }
+
   /////////////////////////////////////////////////////////////////////////////////
   //
   // Streams
@@ -96,9 +96,9 @@ std::shared_ptr<CPVRChannelGroupSettings> CPVRChannelGroup::GetSettings() const
 
 bool CPVRChannelGroup::LoadFromDatabase(
     const std::map<std::pair<int, int>, std::shared_ptr<CPVRChannel>>& channels,
-    const std::vector<std::shared_ptr<CPVRClient>>& clients)
+    const std::vector<std::shared_ptr<CPVRChannelGroupMember>>& members)
 {
-  const int iChannelCount = m_iGroupId > 0 ? LoadFromDatabase(clients) : 0;
+  const int iChannelCount = m_iGroupId > 0 ? LoadFromDatabase(members) : 0;
   CLog::LogFC(LOGDEBUG, LOGPVR, "Fetched {} {} group members from the database for group '{}'",
               iChannelCount, IsRadio() ? "radio" : "TV", GroupName());
 
@@ -482,16 +482,9 @@ void CPVRChannelGroup::GetChannelNumbers(std::vector<std::string>& channelNumber
   }
 }
 
-int CPVRChannelGroup::LoadFromDatabase(const std::vector<std::shared_ptr<CPVRClient>>& clients)
+int CPVRChannelGroup::LoadFromDatabase(
+    const std::vector<std::shared_ptr<CPVRChannelGroupMember>>& results)
 {
-  const std::shared_ptr<const CPVRDatabase> database(
-      CServiceBroker::GetPVRManager().GetTVDatabase());
-  if (!database)
-    return -1;
-
-  const std::vector<std::shared_ptr<CPVRChannelGroupMember>> results =
-      database->Get(*this, clients);
-
   std::vector<std::shared_ptr<CPVRChannelGroupMember>> membersToDelete;
   if (!results.empty())
   {
@@ -84,11 +84,11 @@ public:
   /*!
    * @brief Load the channels from the database.
    * @param channels All available channels.
-   * @param clients The PVR clients data should be loaded for. Leave empty for all clients.
+   * @param members The members of this group fetched from the database.
    * @return True when loaded successfully, false otherwise.
    */
   bool LoadFromDatabase(const std::map<std::pair<int, int>, std::shared_ptr<CPVRChannel>>& channels,
-                        const std::vector<std::shared_ptr<CPVRClient>>& clients);
+                        const std::vector<std::shared_ptr<CPVRChannelGroupMember>>& members);
 
   /*!
    * @brief Clear all data.
@@ -544,11 +544,11 @@ private:
   virtual int GroupType() const = 0;
 
   /*!
-   * @brief Load the channel group members stored in the database.
-   * @param clients The PVR clients to load data for. Leave empty for all clients.
+   * @brief Add the channel group members stored in the database.
+   * @param results The members of this group fetched from the database.
    * @return The amount of channel group members that were added.
    */
-  int LoadFromDatabase(const std::vector<std::shared_ptr<CPVRClient>>& clients);
+  int LoadFromDatabase(const std::vector<std::shared_ptr<CPVRChannelGroupMember>>& results);
 
   /*!
    * @brief Delete channel group members from database.
@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <chrono>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <numeric>
@@ -423,10 +424,16 @@ bool CPVRChannelGroups::LoadFromDatabase(const std::vector<std::shared_ptr<CPVRC
   CLog::LogFC(LOGDEBUG, LOGPVR, "Fetched {} {} groups from the database", iLoaded,
               m_bRadio ? "radio" : "TV");
 
-  // load all group members from the database
+  // load the members of all groups from the database at once
+  const std::map<int, std::vector<std::shared_ptr<CPVRChannelGroupMember>>> members =
+      database->GetGroupMembers(m_groups, clients);
+
+  static const std::vector<std::shared_ptr<CPVRChannelGroupMember>> noMembers;
   for (const auto& group : m_groups)
   {
-    if (!group->LoadFromDatabase(channels, clients))
+    const auto membersIt = members.find(group->GroupID());
+    if (!group->LoadFromDatabase(channels,
+                                 membersIt != members.end() ? membersIt->second : noMembers))
     {
       CLog::LogFC(LOGERROR, LOGPVR,
                   "Failed to load members of {} channel group '{}' from the database",
@@ -322,6 +322,12 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpg::GetTags() const
   return m_tags.GetAllTags();
 }
 
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpg::GetAndResetUpdatedTags()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  return m_tags.GetAndResetUpdatedTags();
+}
+
 bool CPVREpg::QueuePersistQuery(const std::shared_ptr<CPVREpgDatabase>& database)
 {
   // Note: It is guaranteed that both this EPG instance and database instance are already
@@ -197,6 +197,13 @@ namespace PVR
      */
     std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTags() const;
 
+    /*!
+     * @brief Get the EPG tags added or changed since the last call, so that timer rules only need
+     * to be matched against new EPG data.
+     * @return The tags.
+     */
+    std::vector<std::shared_ptr<CPVREpgInfoTag>> GetAndResetUpdatedTags();
+
     /*!
      * @brief Get all EPG tags for the given time frame, including "gap" tags.
      * @param timelineStart Start of time line
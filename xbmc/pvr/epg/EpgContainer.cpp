@@ -12,6 +12,7 @@
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_channels.h" // PVR_CHANNEL_INVALID_UID
 #include "guilib/LocalizeStrings.h"
 #include "pvr/PVRManager.h"
+#include "pvr/PVRPlaybackState.h"
 #include "pvr/epg/Epg.h"
 #include "pvr/epg/EpgChannelData.h"
 #include "pvr/epg/EpgContainer.h"
@@ -21,11 +22,14 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/Event.h"
 #include "threads/SystemClock.h"
+#include "utils/JobManager.h"
 #include "utils/log.h"
 
 #include <algorithm>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <numeric>
@@ -745,38 +749,86 @@ bool CPVREpgContainer::UpdateEPG(bool bOnlyPending /* = false */)
     progressHandler = std::make_unique<CPVRGUIProgressHandler>(
         g_localizeStrings.Get(19004)); // Loading programme guide
 
+  // the tables of each client are fetched by a queue of their own, so that a slow backend does
+  // not hold up the others and no backend gets more requests at once than configured
+  const auto& playbackState = CServiceBroker::GetPVRManager().PlaybackState();
+  const int playingClientId = playbackState->GetPlayingClientID();
+  const int playingChannelUid = playbackState->GetPlayingChannelUniqueID();
+
+  std::map<int, std::vector<std::shared_ptr<CPVREpg>>> epgsByClient;
   for (const auto& epgEntry : epgsToUpdate)
   {
-    if (InterruptUpdate())
-    {
-      bInterrupted = true;
-      break;
-    }
-
-    const std::shared_ptr<CPVREpg> epg = epgEntry.second;
-    if (!epg)
+    const std::shared_ptr<CPVREpg>& epg = epgEntry.second;
+    if (!epg || (bOnlyPending && !epg->UpdatePending()))
       continue;
 
-    if (progressHandler)
-      progressHandler->UpdateProgress(epg->GetChannelData()->ChannelName(), ++iCounter,
-                                      epgsToUpdate.size());
-
-    if ((!bOnlyPending || epg->UpdatePending()) &&
-        epg->Update(start,
-                    end,
-                    m_settings.GetIntValue(CSettings::SETTING_EPG_EPGUPDATE) * 60,
-                    m_settings.GetIntValue(CSettings::SETTING_EPG_PAST_DAYSTODISPLAY),
-                    database,
-                    bOnlyPending))
-    {
+    const std::shared_ptr<CPVREpgChannelData> channelData = epg->GetChannelData();
+    auto& epgs = epgsByClient[channelData->ClientId()];
+    // the channel that is playing comes first
+    if (channelData->ClientId() == playingClientId &&
+        channelData->UniqueClientChannelId() == playingChannelUid)
+      epgs.insert(epgs.begin(), epg);
+    else
+      epgs.push_back(epg);
+  }
+
+  const int iUpdateTime = m_settings.GetIntValue(CSettings::SETTING_EPG_EPGUPDATE) * 60;
+  const int iPastDays = m_settings.GetIntValue(CSettings::SETTING_EPG_PAST_DAYSTODISPLAY);
+  const unsigned int concurrency =
+      static_cast<unsigned int>(std::max(advancedSettings->m_iEpgUpdateConcurrency, 1));
+
+  CCriticalSection resultSection;
+  CEvent allDone;
+  size_t remaining = 0;
+  for (const auto& clientEpgs : epgsByClient)
+    remaining += clientEpgs.second.size();
+  const bool hasUpdates = remaining > 0;
+
+  const auto finished = [&](const std::shared_ptr<CPVREpg>& epg, bool updated)
+  {
+    std::unique_lock<CCriticalSection> lock(resultSection);
+    if (updated)
       iUpdatedTables++;
-    }
-    else if (!epg->IsValid())
-    {
+    else if (epg && !epg->IsValid())
       invalidTables.push_back(epg);
+
+    if (--remaining == 0)
+      allDone.Set();
+  };
+
+  std::vector<std::unique_ptr<CJobQueue>> queues;
+  for (const auto& clientEpgs : epgsByClient)
+  {
+    queues.emplace_back(std::make_unique<CJobQueue>(false, concurrency, CJob::PRIORITY_NORMAL));
+    for (const std::shared_ptr<CPVREpg>& epg : clientEpgs.second)
+    {
+      queues.back()->Submit([&, epg]() {
+        if (InterruptUpdate())
+        {
+          {
+            std::unique_lock<CCriticalSection> lock(resultSection);
+            bInterrupted = true;
+          }
+          finished(nullptr, false);
+          return;
+        }
+
+        if (progressHandler)
+        {
+          std::unique_lock<CCriticalSection> lock(resultSection);
+          progressHandler->UpdateProgress(epg->GetChannelData()->ChannelName(), ++iCounter,
+                                          epgsToUpdate.size());
+        }
+
+        finished(epg, epg->Update(start, end, iUpdateTime, iPastDays, database, bOnlyPending));
+      });
     }
   }
 
+  if (hasUpdates)
+    allDone.Wait();
+  queues.clear();
+
   progressHandler.reset();
 
   QueueDeleteEpgs(invalidTables);
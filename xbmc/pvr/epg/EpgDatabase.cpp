@@ -19,6 +19,7 @@
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -140,6 +141,62 @@ void CPVREpgDatabase::CreateAnalytics()
   std::unique_lock<CCriticalSection> lock(m_critSection);
   m_pDS->exec("CREATE UNIQUE INDEX idx_epg_idEpg_iStartTime on epgtags(idEpg, iStartTime desc);");
   m_pDS->exec("CREATE INDEX idx_epg_iEndTime on epgtags(iEndTime);");
+
+  if (m_sqlite)
+    CreateFullTextIndex();
+}
+
+void CPVREpgDatabase::CreateFullTextIndex()
+{
+  // the trigram tokenizer matches substrings, like the LIKE '%term%' filters of the searches do
+  try
+  {
+    m_pDS->exec("CREATE VIRTUAL TABLE IF NOT EXISTS epgtags_fts "
+                "USING fts5(sTitle, sPlotOutline, sPlot, tokenize = 'trigram');");
+  }
+  catch (...)
+  {
+    CLog::Log(LOGINFO, "EPG database: SQLite has no FTS5 trigram tokenizer, searches will scan "
+                       "all EPG tags");
+    m_hasFullTextIndex = false;
+    return;
+  }
+
+  CLog::LogFC(LOGDEBUG, LOGEPG, "Creating EPG full text index");
+
+  // the triggers are dropped with the other analytics before database updates, fill it anew
+  m_pDS->exec("DELETE FROM epgtags_fts;");
+  m_pDS->exec("INSERT INTO epgtags_fts (rowid, sTitle, sPlotOutline, sPlot) "
+              "SELECT idBroadcast, sTitle, sPlotOutline, sPlot FROM epgtags;");
+
+  // REPLACE INTO epgtags deletes the old row without firing the delete trigger, so the insert
+  // trigger replaces the entry of the row id. A stale entry left behind by a REPLACE resolving the
+  // (idEpg, iStartTime) index can't cause wrong results, searches join it with epgtags.
+  m_pDS->exec("CREATE TRIGGER epgtags_fts_insert AFTER INSERT ON epgtags BEGIN "
+              "INSERT OR REPLACE INTO epgtags_fts (rowid, sTitle, sPlotOutline, sPlot) "
+              "VALUES (new.idBroadcast, new.sTitle, new.sPlotOutline, new.sPlot); "
+              "END;");
+  m_pDS->exec("CREATE TRIGGER epgtags_fts_update AFTER UPDATE ON epgtags BEGIN "
+              "DELETE FROM epgtags_fts WHERE rowid = old.idBroadcast; "
+              "INSERT INTO epgtags_fts (rowid, sTitle, sPlotOutline, sPlot) "
+              "VALUES (new.idBroadcast, new.sTitle, new.sPlotOutline, new.sPlot); "
+              "END;");
+  m_pDS->exec("CREATE TRIGGER epgtags_fts_delete AFTER DELETE ON epgtags BEGIN "
+              "DELETE FROM epgtags_fts WHERE rowid = old.idBroadcast; "
+              "END;");
+
+  m_hasFullTextIndex = true;
+}
+
+bool CPVREpgDatabase::HasFullTextIndex() const
+{
+  if (!m_hasFullTextIndex)
+    m_hasFullTextIndex =
+        m_sqlite && !GetSingleValue("SELECT name FROM sqlite_master "
+                                    "WHERE type = 'table' AND name = 'epgtags_fts'")
+                         .empty();
+
+  return *m_hasFullTextIndex;
 }
 
 void CPVREpgDatabase::UpdateTables(int iVersion)
@@ -549,6 +606,35 @@ public:
 
   bool HasSearchTerm() const { return !m_fragments.empty(); }
 
+  /*!
+   * @brief Get a full text query that matches at least all rows the SQL of the search term
+   * matches, to narrow down the rows the SQL has to be evaluated for.
+   * @return The query, empty if the search term can't be looked up in the full text index.
+   */
+  std::string ToFullTextQuery() const
+  {
+    if (m_bHasNegation)
+      return {};
+
+    std::string result;
+    for (const std::string& term : m_terms)
+    {
+      // trigrams can't find shorter terms, and LIKE wildcards have no equivalent
+      const size_t length = std::count_if(term.begin(), term.end(),
+                                          [](char c) { return (c & 0xC0) != 0x80; }); // UTF-8
+      if (length < 3 || term.find_first_of("%_") != std::string::npos)
+        return {};
+
+      if (!result.empty())
+        result += " OR ";
+
+      std::string quoted(term);
+      StringUtils::Replace(quoted, "\"", "\"\"");
+      result += "\"" + quoted + "\"";
+    }
+    return result;
+  }
+
   std::string ToSQL(const std::string& strFieldName) const
   {
     std::string result = "(";
@@ -587,6 +673,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " NOT ";
         bNextOR = false;
+        m_bHasNegation = true;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "+") ||
                StringUtils::StartsWithNoCase(strParsedSearchTerm, "and"))
@@ -619,6 +706,7 @@ private:
           strFragment.clear();
 
           strFragment += ") LIKE UPPER('%";
+          m_terms.emplace_back(strTerm);
           StringUtils::Replace(strTerm, "'", "''"); // escape '
           strFragment += strTerm;
           strFragment += "%')) ";
@@ -662,6 +750,8 @@ private:
   }
 
   std::vector<std::string> m_fragments;
+  std::vector<std::string> m_terms;
+  bool m_bHasNegation = false;
 };
 
 } // unnamed namespace
@@ -744,6 +834,17 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
   const CSearchTermConverter conv{searchData.m_strSearchTerm};
   if (conv.HasSearchTerm())
   {
+    // let the full text index pick the candidates, the LIKE filters below stay for exact results
+    const std::string fullTextQuery = conv.ToFullTextQuery();
+    if (!fullTextQuery.empty() && HasFullTextIndex())
+    {
+      const char* columns =
+          searchData.m_bSearchInDescription ? "{sTitle sPlotOutline sPlot}" : "{sTitle sPlotOutline}";
+      filter.AppendWhere(PrepareSQL("idBroadcast IN (SELECT rowid FROM epgtags_fts "
+                                    "WHERE epgtags_fts MATCH '%s : (%s)')",
+                                    columns, fullTextQuery.c_str()));
+    }
+
     // title
     std::string strWhere = conv.ToSQL("sTitle");
 
@@ -1014,7 +1115,8 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTagsByMinEnd
 
 bool CPVREpgDatabase::QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(int iEpgID,
                                                                   const CDateTime& minEndTime,
-                                                                  const CDateTime& maxStartTime)
+                                                                  const CDateTime& maxStartTime,
+                                                                  int iKeepDatabaseID)
 {
   time_t minEnd;
   minEndTime.GetAsTime(minEnd);
@@ -1028,6 +1130,8 @@ bool CPVREpgDatabase::QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(int iEpgID,
   filter.AppendWhere(PrepareSQL("idEpg = %u AND iEndTime >= %u AND iStartTime <= %u", iEpgID,
                                 static_cast<unsigned int>(minEnd),
                                 static_cast<unsigned int>(maxStart)));
+  if (iKeepDatabaseID > 0)
+    filter.AppendWhere(PrepareSQL("idBroadcast <> %i", iKeepDatabaseID));
 
   std::string strQuery;
   if (BuildSQL("DELETE FROM epgtags", filter, strQuery))
@@ -12,6 +12,7 @@
 #include "threads/CriticalSection.h"
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 class CDateTime;
@@ -66,7 +67,7 @@ namespace PVR
      * @brief Get the minimal database version that is required to operate correctly.
      * @return The minimal database version.
      */
-    int GetSchemaVersion() const override { return 16; }
+    int GetSchemaVersion() const override { return 17; }
 
     /*!
      * @brief Get the default sqlite database filename.
@@ -231,11 +232,14 @@ namespace PVR
      * @param iEpgID The ID of the EPG for the tags to delete.
      * @param minEndTime The min end time for the tags to delete.
      * @param maxStartTime The max start time for the tags to delete.
+     * @param iKeepDatabaseID The database id of a tag to keep although it is in range, e.g. the
+     * tag that is about to be persisted. Values <= 0 keep nothing.
      * @return True if it was removed or queued successfully, false otherwise.
      */
     bool QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(int iEpgID,
                                                      const CDateTime& minEndTime,
-                                                     const CDateTime& maxStartTime);
+                                                     const CDateTime& maxStartTime,
+                                                     int iKeepDatabaseID = -1);
 
     /*!
      * @brief Get the last stored EPG scan time.
@@ -368,6 +372,18 @@ namespace PVR
      */
     void UpdateTables(int version) override;
 
+    /*!
+     * @brief Create the full text index over the titles and plots of the EPG tags, if SQLite
+     * supports it, and fill it from the EPG tags. Triggers keep it up to date afterwards.
+     */
+    void CreateFullTextIndex();
+
+    /*!
+     * @brief Check whether the database has a full text index for searches.
+     * @return True if the index exists, false otherwise.
+     */
+    bool HasFullTextIndex() const;
+
     int GetMinSchemaVersion() const override { return 4; }
 
     std::shared_ptr<CPVREpgInfoTag> CreateEpgTag(
@@ -377,5 +393,6 @@ namespace PVR
         bool bRadio, const std::unique_ptr<dbiplus::Dataset>& pDS) const;
 
     mutable CCriticalSection m_critSection;
+    mutable std::optional<bool> m_hasFullTextIndex;
   };
 }
@@ -22,6 +22,11 @@ using namespace PVR;
 namespace
 {
 const CDateTimeSpan ONE_SECOND(0, 0, 0, 1);
+
+// the guide grid shows a couple of hours, so a bucket usually serves it and the adjacent pages
+constexpr int TIME_BUCKET_HOURS = 6;
+const CDateTimeSpan TIME_BUCKET_DURATION(0, TIME_BUCKET_HOURS, 0, 0);
+constexpr size_t MAX_TIME_BUCKETS = 4;
 }
 
 CPVREpgTagsContainer::CPVREpgTagsContainer(int iEpgID,
@@ -39,6 +44,7 @@ CPVREpgTagsContainer::~CPVREpgTagsContainer() = default;
 void CPVREpgTagsContainer::SetEpgID(int iEpgID)
 {
   m_iEpgID = iEpgID;
+  ResetTimeBuckets();
   for (const auto& tag : m_changedTags)
     tag.second->SetEpgID(iEpgID);
 }
@@ -47,6 +53,7 @@ void CPVREpgTagsContainer::SetChannelData(const std::shared_ptr<CPVREpgChannelDa
 {
   m_channelData = data;
   m_tagsCache->SetChannelData(data);
+  ResetTimeBuckets();
   for (const auto& tag : m_changedTags)
     tag.second->SetChannelData(data);
 }
@@ -182,6 +189,7 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
         {
           // tag differs from existing tag and must be persisted
           m_changedTags.insert({existingTag->StartAsUTC(), existingTag});
+          m_updatedTags.insert({existingTag->StartAsUTC(), existingTag});
           bResetCache = true;
         }
       }
@@ -189,6 +197,7 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
       {
         // new tags must always be persisted
         m_changedTags.insert({tag->StartAsUTC(), tag});
+        m_updatedTags.insert({tag->StartAsUTC(), tag});
         bResetCache = true;
       }
     }
@@ -287,6 +296,7 @@ bool CPVREpgTagsContainer::UpdateEntry(const std::shared_ptr<CPVREpgInfoTag>& ta
     {
       // tag differs from existing tag and must be persisted
       m_changedTags.insert({existingTag->StartAsUTC(), existingTag});
+      m_updatedTags.insert({existingTag->StartAsUTC(), existingTag});
       m_tagsCache->Reset();
     }
   }
@@ -294,6 +304,7 @@ bool CPVREpgTagsContainer::UpdateEntry(const std::shared_ptr<CPVREpgInfoTag>& ta
   {
     // new tags must always be persisted
     m_changedTags.insert({tag->StartAsUTC(), tag});
+    m_updatedTags.insert({tag->StartAsUTC(), tag});
     m_tagsCache->Reset();
   }
 
@@ -303,6 +314,7 @@ bool CPVREpgTagsContainer::UpdateEntry(const std::shared_ptr<CPVREpgInfoTag>& ta
 bool CPVREpgTagsContainer::DeleteEntry(const std::shared_ptr<CPVREpgInfoTag>& tag)
 {
   m_changedTags.erase(tag->StartAsUTC());
+  m_updatedTags.erase(tag->StartAsUTC());
   m_deletedTags.insert({tag->StartAsUTC(), tag});
   m_tagsCache->Reset();
   return true;
@@ -331,14 +343,95 @@ void CPVREpgTagsContainer::Cleanup(const CDateTime& time)
   if (bResetCache)
     m_tagsCache->Reset();
 
+  for (auto it = m_updatedTags.begin(); it != m_updatedTags.end();)
+  {
+    if (it->second->EndAsUTC() < time)
+      it = m_updatedTags.erase(it);
+    else
+      ++it;
+  }
+
   if (m_database)
+  {
     m_database->DeleteEpgTags(m_iEpgID, time);
+    ResetTimeBuckets();
+  }
 }
 
 void CPVREpgTagsContainer::Clear()
 {
   m_changedTags.clear();
+  m_updatedTags.clear();
   m_tagsCache->Reset();
+  ResetTimeBuckets();
+}
+
+void CPVREpgTagsContainer::ResetTimeBuckets()
+{
+  m_timeBuckets.clear();
+}
+
+const std::vector<std::shared_ptr<CPVREpgInfoTag>>& CPVREpgTagsContainer::GetTimeBucket(
+    const CDateTime& bucketStart) const
+{
+  const auto it =
+      std::find_if(m_timeBuckets.begin(), m_timeBuckets.end(),
+                   [&bucketStart](const TimeBucket& bucket) { return bucket.start == bucketStart; });
+  if (it != m_timeBuckets.end())
+  {
+    if (it != m_timeBuckets.begin())
+    {
+      TimeBucket bucket = std::move(*it);
+      m_timeBuckets.erase(it);
+      m_timeBuckets.emplace_front(std::move(bucket));
+    }
+    return m_timeBuckets.front().tags;
+  }
+
+  if (m_timeBuckets.size() >= MAX_TIME_BUCKETS)
+    m_timeBuckets.pop_back();
+
+  m_timeBuckets.push_front({bucketStart, CreateEntries(m_database->GetEpgTagsByMinEndMaxStartTime(
+                                             m_iEpgID, bucketStart,
+                                             bucketStart + TIME_BUCKET_DURATION))});
+  return m_timeBuckets.front().tags;
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetPersistedTags(
+    const CDateTime& minEventEnd, const CDateTime& maxEventStart) const
+{
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> result;
+  if (!minEventEnd.IsValid() || !maxEventStart.IsValid() || maxEventStart < minEventEnd)
+    return result;
+
+  // buckets are aligned to whole multiples of their duration within the day
+  CDateTime bucketStart(minEventEnd.GetYear(), minEventEnd.GetMonth(), minEventEnd.GetDay(),
+                        minEventEnd.GetHour() - minEventEnd.GetHour() % TIME_BUCKET_HOURS, 0, 0);
+
+  for (; bucketStart <= maxEventStart; bucketStart += TIME_BUCKET_DURATION)
+  {
+    const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags = GetTimeBucket(bucketStart);
+
+    // events don't overlap, so the first one ending at or after minEventEnd is found by going back
+    // from the first one starting at or after it
+    auto first = std::lower_bound(tags.begin(), tags.end(), minEventEnd,
+                                  [](const std::shared_ptr<CPVREpgInfoTag>& tag,
+                                     const CDateTime& time) { return tag->StartAsUTC() < time; });
+    while (first != tags.begin() && (*(first - 1))->EndAsUTC() >= minEventEnd)
+      --first;
+
+    for (auto it = first; it != tags.end() && (*it)->StartAsUTC() <= maxEventStart; ++it)
+    {
+      // events spanning a bucket boundary are contained in both buckets
+      if ((*it)->EndAsUTC() < minEventEnd ||
+          (!result.empty() && (*it)->StartAsUTC() <= result.back()->StartAsUTC()))
+        continue;
+
+      result.emplace_back(*it);
+    }
+  }
+
+  return result;
 }
 
 bool CPVREpgTagsContainer::IsEmpty() const
@@ -498,7 +591,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
 
     if (loadFromDb)
     {
-      tags = m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
+      tags = GetPersistedTags(minEventEnd, maxEventStart);
 
       if (!m_changedTags.empty())
       {
@@ -614,6 +707,16 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetAllTags()
   return {};
 }
 
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetAndResetUpdatedTags()
+{
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+  tags.reserve(m_updatedTags.size());
+  std::transform(m_updatedTags.cbegin(), m_updatedTags.cend(), std::back_inserter(tags),
+                 [](const auto& tag) { return tag.second; });
+  m_updatedTags.clear();
+  return tags;
+}
+
 std::pair<CDateTime, CDateTime> CPVREpgTagsContainer::GetFirstAndLastUncommitedEPGDate() const
 {
   if (m_changedTags.empty())
@@ -646,9 +749,11 @@ void CPVREpgTagsContainer::QueuePersistQuery()
 
     for (const auto& tag : m_changedTags)
     {
-      // remove any conflicting events from database before persisting the new event
+      // remove any conflicting events from database before persisting the new event. the row of
+      // the event itself is kept, the replace below rewrites it in place
       m_database->QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(
-          m_iEpgID, tag.second->StartAsUTC() + ONE_SECOND, tag.second->EndAsUTC() - ONE_SECOND);
+          m_iEpgID, tag.second->StartAsUTC() + ONE_SECOND, tag.second->EndAsUTC() - ONE_SECOND,
+          tag.second->DatabaseID());
 
       tag.second->QueuePersistQuery(m_database);
     }
@@ -10,6 +10,7 @@
 
 #include "XBDateTime.h"
 
+#include <deque>
 #include <map>
 #include <memory>
 #include <vector>
@@ -152,6 +153,13 @@ public:
    */
   std::vector<std::shared_ptr<CPVREpgInfoTag>> GetAllTags() const;
 
+  /*!
+   * @brief Get the tags added or changed since the last call, so that timer rules only need to be
+   * matched against new EPG data.
+   * @return The tags.
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetAndResetUpdatedTags();
+
   /*!
    * @brief Get the start and end time of the last not yet commited entry in this EPG.
    * @return The times; first: start time, second: end time.
@@ -215,6 +223,32 @@ private:
   void FixOverlappingEvents(std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags) const;
   void FixOverlappingEvents(std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>& tags) const;
 
+  /*!
+   * @brief Get the persisted events that overlap a time range, sorted by start time.
+   * @param minEventEnd The minimum end time of the events to return
+   * @param maxEventStart The maximum start time of the events to return
+   * @return The events, read from the database in time buckets that are kept in memory.
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetPersistedTags(
+      const CDateTime& minEventEnd, const CDateTime& maxEventStart) const;
+
+  /*!
+   * @brief Get the persisted events that overlap the time bucket starting at the given time.
+   */
+  const std::vector<std::shared_ptr<CPVREpgInfoTag>>& GetTimeBucket(
+      const CDateTime& bucketStart) const;
+
+  /*!
+   * @brief Drop the time buckets, to be called whenever the persisted events change.
+   */
+  void ResetTimeBuckets();
+
+  struct TimeBucket
+  {
+    CDateTime start;
+    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags; // sorted by start time
+  };
+
   int m_iEpgID = 0;
   std::shared_ptr<CPVREpgChannelData> m_channelData;
   const std::shared_ptr<CPVREpgDatabase> m_database;
@@ -222,6 +256,8 @@ private:
 
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_changedTags;
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_deletedTags;
+  std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_updatedTags; // since last GetAndResetUpdatedTags
+  mutable std::deque<TimeBucket> m_timeBuckets; // most recently used first
 };
 
 } // namespace PVR
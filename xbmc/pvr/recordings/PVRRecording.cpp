@@ -431,6 +431,34 @@ void CPVRRecording::UpdateMetadata(CVideoDatabase& db, const CPVRClient& client)
   m_bGotMetaData = true;
 }
 
+void CPVRRecording::UpdateMetadata(const VideoDbPlayState* state, const CPVRClient& client)
+{
+  if (m_bGotMetaData)
+    return;
+
+  if (state)
+  {
+    if (!client.GetClientCapabilities().SupportsRecordingsPlayCount())
+      CVideoInfoTag::SetPlayCount(state->playCount);
+
+    if (!client.GetClientCapabilities().SupportsRecordingsLastPlayedPosition() &&
+        state->resumePoint.IsSet())
+      CVideoInfoTag::SetResumePoint(state->resumePoint);
+
+    m_lastPlayed = state->lastPlayed;
+  }
+  else
+  {
+    // not in the database, so never played
+    if (!client.GetClientCapabilities().SupportsRecordingsPlayCount())
+      CVideoInfoTag::SetPlayCount(0);
+
+    m_lastPlayed = {};
+  }
+
+  m_bGotMetaData = true;
+}
+
 std::vector<PVR_EDL_ENTRY> CPVRRecording::GetEdl() const
 {
   std::vector<PVR_EDL_ENTRY> edls;
@@ -23,6 +23,7 @@
 class CVideoDatabase;
 
 struct PVR_EDL_ENTRY;
+struct VideoDbPlayState;
 struct PVR_RECORDING;
 
 namespace PVR
@@ -171,6 +172,14 @@ public:
    */
   void UpdateMetadata(CVideoDatabase& db, const CPVRClient& client);
 
+  /*!
+   * @brief Set the resume point and play count from database data fetched in advance if the
+   * client doesn't handle it itself.
+   * @param state The play state stored for this recording's path, or nullptr if there is none.
+   * @param client The client this recording belongs to.
+   */
+  void UpdateMetadata(const VideoDbPlayState* state, const CPVRClient& client);
+
   /*!
    * @brief Update this tag with the contents of the given tag.
    * @param tag The new tag info.
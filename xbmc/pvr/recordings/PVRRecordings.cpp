@@ -9,9 +9,11 @@
 #include "PVRRecordings.h"
 
 #include "ServiceBroker.h"
+#include "XBDateTime.h"
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_epg.h" // EPG_TAG_INVALID_UID
 #include "pvr/PVRCachedImages.h"
 #include "pvr/PVRManager.h"
+#include "pvr/addons/PVRClient.h"
 #include "pvr/addons/PVRClients.h"
 #include "pvr/epg/EpgInfoTag.h"
 #include "pvr/recordings/PVRRecording.h"
@@ -45,26 +47,98 @@ bool CPVRRecordings::UpdateFromClients(const std::vector<std::shared_ptr<CPVRCli
     return false;
 
   m_bIsUpdating = true;
+  m_bChanged = false;
 
-  for (const auto& recording : m_recordings)
-    recording.second->SetDirty(true);
+  time_t syncStart = 0;
+  CDateTime::GetUTCDateTime().GetAsTime(syncStart);
 
-  std::vector<int> failedClients;
-  CServiceBroker::GetPVRManager().Clients()->GetRecordings(clients, this, false, failedClients);
-  CServiceBroker::GetPVRManager().Clients()->GetRecordings(clients, this, true, failedClients);
+  std::vector<std::shared_ptr<CPVRClient>> allClients = clients;
+  if (allClients.empty())
+  {
+    const CPVRClientMap createdClients =
+        CServiceBroker::GetPVRManager().Clients()->GetCreatedClients();
+    std::transform(createdClients.cbegin(), createdClients.cend(), std::back_inserter(allClients),
+                   [](const auto& client) { return client.second; });
+  }
 
-  // remove recordings that were deleted at the backend
-  for (auto it = m_recordings.begin(); it != m_recordings.end();)
+  // clients supporting it only transfer what changed since their last sync, the others and those
+  // failing to do so transfer all their recordings
+  std::vector<std::shared_ptr<CPVRClient>> fullSyncClients;
+  for (const auto& client : allClients)
   {
-    if ((*it).second->IsDirty() && std::find(failedClients.begin(), failedClients.end(),
-                                             (*it).second->ClientID()) == failedClients.end())
-      it = m_recordings.erase(it);
+    const auto it = m_lastSyncTimes.find(client->GetID());
+    if (it != m_lastSyncTimes.end() && client->GetClientCapabilities().SupportsRecordingsDelta() &&
+        UpdateChangesFromClient(*client, it->second))
+      it->second = syncStart;
     else
-      ++it;
+      fullSyncClients.emplace_back(client);
+  }
+
+  if (!fullSyncClients.empty())
+  {
+    for (const auto& recording : m_recordings)
+    {
+      const int iClientId = recording.second->ClientID();
+      if (std::any_of(fullSyncClients.cbegin(), fullSyncClients.cend(),
+                      [iClientId](const auto& client) { return client->GetID() == iClientId; }))
+        recording.second->SetDirty(true);
+    }
+
+    // fetch the play state of all new recordings with one query instead of several per recording
+    m_bPrefetchPlayStates = true;
+
+    std::vector<int> failedClients;
+    std::vector<int> failedDeletedClients;
+    CServiceBroker::GetPVRManager().Clients()->GetRecordings(fullSyncClients, this, false,
+                                                             failedClients);
+    CServiceBroker::GetPVRManager().Clients()->GetRecordings(fullSyncClients, this, true,
+                                                             failedDeletedClients);
+    failedClients.insert(failedClients.end(), failedDeletedClients.cbegin(),
+                         failedDeletedClients.cend());
+
+    m_bPrefetchPlayStates = false;
+    m_playStates.reset();
+
+    // remove recordings that were deleted at the backend
+    for (auto it = m_recordings.begin(); it != m_recordings.end();)
+    {
+      if ((*it).second->IsDirty() && std::find(failedClients.begin(), failedClients.end(),
+                                               (*it).second->ClientID()) == failedClients.end())
+      {
+        it = m_recordings.erase(it);
+        m_bChanged = true;
+      }
+      else
+        ++it;
+    }
+
+    for (const auto& client : fullSyncClients)
+    {
+      if (std::find(failedClients.cbegin(), failedClients.cend(), client->GetID()) ==
+          failedClients.cend())
+        m_lastSyncTimes[client->GetID()] = syncStart;
+      else
+        m_lastSyncTimes.erase(client->GetID());
+    }
   }
 
   m_bIsUpdating = false;
-  CServiceBroker::GetPVRManager().PublishEvent(PVREvent::RecordingsInvalidated);
+
+  if (m_bChanged)
+    CServiceBroker::GetPVRManager().PublishEvent(PVREvent::RecordingsInvalidated);
+
+  return true;
+}
+
+bool CPVRRecordings::UpdateChangesFromClient(const CPVRClient& client, time_t since)
+{
+  if (client.GetRecordingsChangedSince(this, false, since) != PVR_ERROR_NO_ERROR)
+    return false;
+
+  if (client.GetClientCapabilities().SupportsRecordingsUndelete() &&
+      client.GetRecordingsChangedSince(this, true, since) != PVR_ERROR_NO_ERROR)
+    return false;
+
   return true;
 }
 
@@ -81,6 +155,7 @@ void CPVRRecordings::Unload()
   m_iTVRecordings = 0;
   m_iRadioRecordings = 0;
   m_recordings.clear();
+  m_lastSyncTimes.clear();
 }
 
 void CPVRRecordings::UpdateInProgressSize()
@@ -203,12 +278,41 @@ void CPVRRecordings::UpdateFromClient(const std::shared_ptr<CPVRRecording>& tag,
   std::shared_ptr<CPVRRecording> existingTag = GetById(tag->ClientID(), tag->ClientRecordingID());
   if (existingTag)
   {
+    // compare with the local id, so unchanged recordings do not invalidate all recordings
+    tag->SetRecordingID(existingTag->RecordingID());
+    if (*existingTag != *tag ||
+        (client.GetClientCapabilities().SupportsRecordingsPlayCount() &&
+         existingTag->GetLocalPlayCount() != tag->GetLocalPlayCount()) ||
+        (client.GetClientCapabilities().SupportsRecordingsLastPlayedPosition() &&
+         existingTag->GetLocalResumePoint().timeInSeconds !=
+             tag->GetLocalResumePoint().timeInSeconds))
+      m_bChanged = true;
+
     existingTag->Update(*tag, client);
     existingTag->SetDirty(false);
   }
   else
   {
-    tag->UpdateMetadata(GetVideoDatabase(), client);
+    if (m_bPrefetchPlayStates)
+    {
+      m_bPrefetchPlayStates = false;
+
+      CVideoDatabase& db = GetVideoDatabase();
+      m_playStates = std::make_unique<std::map<std::string, VideoDbPlayState>>();
+      if (!db.IsOpen() ||
+          !db.GetPlayStatesBelowPath(CPVRRecordingsPath::PATH_RECORDINGS, *m_playStates))
+        m_playStates.reset();
+    }
+
+    if (m_playStates)
+    {
+      const auto it = m_playStates->find(tag->m_strFileNameAndPath);
+      tag->UpdateMetadata(it != m_playStates->cend() ? &it->second : nullptr, client);
+    }
+    else
+      tag->UpdateMetadata(GetVideoDatabase(), client);
+
+    m_bChanged = true;
     tag->SetRecordingID(++m_iLastId);
     m_recordings.insert({CPVRRecordingUid(tag->ClientID(), tag->ClientRecordingID()), tag});
     if (tag->IsRadio())
@@ -218,6 +322,23 @@ void CPVRRecordings::UpdateFromClient(const std::shared_ptr<CPVRRecording>& tag,
   }
 }
 
+void CPVRRecordings::RemoveFromClient(int iClientId, const std::string& strRecordingId)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+
+  const auto it = m_recordings.find(CPVRRecordingUid(iClientId, strRecordingId));
+  if (it == m_recordings.end())
+    return;
+
+  if (it->second->IsRadio())
+    --m_iRadioRecordings;
+  else
+    --m_iTVRecordings;
+
+  m_recordings.erase(it);
+  m_bChanged = true;
+}
+
 std::shared_ptr<CPVRRecording> CPVRRecordings::GetRecordingForEpgTag(
     const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const
 {
@@ -10,6 +10,7 @@
 
 #include "threads/CriticalSection.h"
 
+#include <ctime>
 #include <map>
 #include <memory>
 #include <string>
@@ -17,6 +18,8 @@
 
 class CVideoDatabase;
 
+struct VideoDbPlayState;
+
 namespace PVR
 {
 class CPVRClient;
@@ -57,6 +60,13 @@ public:
    */
   void UpdateFromClient(const std::shared_ptr<CPVRRecording>& tag, const CPVRClient& client);
 
+  /*!
+   * @brief client has removed a recording.
+   * @param iClientId The id of the client the recording belongs to.
+   * @param strRecordingId The client's id of the recording.
+   */
+  void RemoveFromClient(int iClientId, const std::string& strRecordingId);
+
   /*!
    * @brief refresh the size of any in progress recordings from the clients.
    */
@@ -113,6 +123,14 @@ private:
    */
   CVideoDatabase& GetVideoDatabase();
 
+  /*!
+   * @brief Apply the changes since the last sync from a client supporting delta fetches.
+   * @param client The client to fetch the changes from.
+   * @param since The time the last successful sync with the client started.
+   * @return True on success, false if a full sync is needed.
+   */
+  bool UpdateChangesFromClient(const CPVRClient& client, time_t since);
+
   /*!
    * @brief Set a recording's play count
    * @param recording The recording
@@ -143,6 +161,10 @@ private:
 
   mutable CCriticalSection m_critSection;
   bool m_bIsUpdating = false;
+  bool m_bChanged = false; ///< recordings were added, changed or removed during the update
+  bool m_bPrefetchPlayStates = false;
+  std::unique_ptr<std::map<std::string, VideoDbPlayState>> m_playStates;
+  std::map<int, time_t> m_lastSyncTimes; ///< start of the last successful sync per client
   std::map<CPVRRecordingUid, std::shared_ptr<CPVRRecording>> m_recordings;
   unsigned int m_iLastId = 0;
   std::unique_ptr<CVideoDatabase> m_database;
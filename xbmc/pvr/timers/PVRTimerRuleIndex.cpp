@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PVRTimerRuleIndex.h"
+
+#include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_channels.h" // PVR_CHANNEL_INVALID_UID
+#include "pvr/epg/EpgInfoTag.h"
+#include "pvr/timers/PVRTimerInfoTag.h"
+#include "pvr/timers/PVRTimerRuleMatcher.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+using namespace PVR;
+
+void CPVRTimerRuleIndex::AddRule(const std::shared_ptr<CPVRTimerRuleMatcher>& matcher)
+{
+  Rule rule{matcher};
+
+  std::string keyword;
+  if (matcher->GetSearchKeyword(keyword, rule.bFullText))
+    rule.keyword = m_keywords.AddKeyword(keyword);
+
+  // rules for a channel only ever match tags of that channel, see
+  // CPVRTimerRuleMatcher::MatchChannel
+  const std::shared_ptr<const CPVRTimerInfoTag> timerRule = matcher->GetTimerRule();
+  const size_t index = m_rules.size();
+  if (timerRule->GetTimerType()->SupportsChannels() &&
+      timerRule->ClientChannelUID() != PVR_CHANNEL_INVALID_UID)
+    m_channelRules[{timerRule->ClientID(), timerRule->ClientChannelUID()}].emplace_back(index);
+  else
+    m_anyChannelRules.emplace_back(index);
+
+  m_rules.emplace_back(std::move(rule));
+}
+
+void CPVRTimerRuleIndex::Build()
+{
+  m_keywords.Build();
+}
+
+std::vector<std::shared_ptr<CPVRTimerRuleMatcher>> CPVRTimerRuleIndex::GetMatchingRules(
+    const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const
+{
+  std::vector<std::shared_ptr<CPVRTimerRuleMatcher>> matches;
+  if (!epgTag)
+    return matches;
+
+  std::vector<size_t> candidates;
+  const auto it = m_channelRules.find({epgTag->ClientID(), epgTag->UniqueChannelID()});
+  if (it != m_channelRules.cend())
+    std::merge(it->second.cbegin(), it->second.cend(), m_anyChannelRules.cbegin(),
+               m_anyChannelRules.cend(), std::back_inserter(candidates));
+  else
+    candidates = m_anyChannelRules;
+
+  // the tag's texts are only searched for keywords if a candidate rule needs them
+  std::vector<bool> titleKeywords;
+  std::vector<bool> textKeywords;
+  bool bSearchedTitle = false;
+  bool bSearchedText = false;
+
+  for (const size_t index : candidates)
+  {
+    const Rule& rule = m_rules[index];
+    if (rule.keyword != NO_KEYWORD)
+    {
+      if (!bSearchedTitle)
+      {
+        m_keywords.Find(epgTag->Title(), titleKeywords);
+        bSearchedTitle = true;
+      }
+
+      bool bFound = titleKeywords[rule.keyword];
+      if (!bFound && rule.bFullText)
+      {
+        if (!bSearchedText)
+        {
+          textKeywords = titleKeywords;
+          m_keywords.Find(epgTag->EpisodeName(), textKeywords);
+          m_keywords.Find(epgTag->PlotOutline(), textKeywords);
+          m_keywords.Find(epgTag->Plot(), textKeywords);
+          bSearchedText = true;
+        }
+        bFound = textKeywords[rule.keyword];
+      }
+
+      if (!bFound)
+        continue;
+    }
+
+    if (rule.matcher->Matches(epgTag))
+      matches.emplace_back(rule.matcher);
+  }
+
+  return matches;
+}
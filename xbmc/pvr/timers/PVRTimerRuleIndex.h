@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/AhoCorasick.h"
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace PVR
+{
+class CPVREpgInfoTag;
+class CPVRTimerRuleMatcher;
+
+/*!
+ * @brief Matches epg tags against many timer rules at once.
+ *
+ * Rules for a single channel are only checked against tags of that channel. Rules searching for
+ * literal texts are only checked against tags containing their text, which is found for all rules
+ * in one pass over the tag's texts. All other rules are checked against every tag.
+ */
+class CPVRTimerRuleIndex
+{
+public:
+  void AddRule(const std::shared_ptr<CPVRTimerRuleMatcher>& matcher);
+
+  /*!
+   * @brief Compile the index. Must be called after adding the rules and before matching.
+   */
+  void Build();
+
+  bool IsEmpty() const { return m_rules.empty(); }
+
+  /*!
+   * @brief Get the rules matching the given epg tag, in the order they were added.
+   * @param epgTag The epg tag.
+   * @return The matching rules.
+   */
+  std::vector<std::shared_ptr<CPVRTimerRuleMatcher>> GetMatchingRules(
+      const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
+
+private:
+  static constexpr size_t NO_KEYWORD = static_cast<size_t>(-1);
+
+  struct Rule
+  {
+    std::shared_ptr<CPVRTimerRuleMatcher> matcher;
+    size_t keyword = NO_KEYWORD;
+    bool bFullText = false;
+  };
+
+  std::vector<Rule> m_rules;
+  std::map<std::pair<int, int>, std::vector<size_t>> m_channelRules; // by client id, channel uid
+  std::vector<size_t> m_anyChannelRules;
+  CAhoCorasick m_keywords;
+};
+} // namespace PVR
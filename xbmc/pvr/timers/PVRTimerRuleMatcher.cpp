@@ -78,6 +78,25 @@ bool CPVRTimerRuleMatcher::Matches(const std::shared_ptr<const CPVREpgInfoTag>&
          MatchEnd(epgTag) && MatchDayOfWeek(epgTag) && MatchSearchText(epgTag);
 }
 
+bool CPVRTimerRuleMatcher::GetSearchKeyword(std::string& keyword, bool& bFullText) const
+{
+  if (m_timerRule->GetTimerType()->SupportsEpgFulltextMatch() && m_timerRule->IsFullTextEpgSearch())
+    bFullText = true;
+  else if (m_timerRule->GetTimerType()->SupportsEpgTitleMatch())
+    bFullText = false;
+  else
+    return false;
+
+  // the search string is compiled as a case insensitive, non-UTF-8 regular expression, so without
+  // meta characters it is a literal text with ASCII case folding
+  const std::string& searchString = m_timerRule->EpgSearchString();
+  if (searchString.find_first_of("\\^$.|?*+()[]{}") != std::string::npos)
+    return false;
+
+  keyword = searchString;
+  return true;
+}
+
 bool CPVRTimerRuleMatcher::MatchSeriesLink(
     const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const
 {
@@ -11,6 +11,7 @@
 #include "XBDateTime.h"
 
 #include <memory>
+#include <string>
 
 class CRegExp;
 
@@ -32,6 +33,16 @@ public:
   CDateTime GetNextTimerStart() const;
   bool Matches(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
 
+  /*!
+   * @brief Get the text an epg tag must contain to match this rule, if the rule searches for a
+   * literal text rather than a regular expression.
+   * @param[out] keyword The text. It is matched ignoring the case of ASCII letters.
+   * @param[out] bFullText True if the text is searched in title, episode name, plot outline and
+   * plot, false if it is only searched in the title.
+   * @return True if the rule searches for a literal text, false otherwise.
+   */
+  bool GetSearchKeyword(std::string& keyword, bool& bFullText) const;
+
 private:
   bool MatchSeriesLink(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
   bool MatchChannel(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
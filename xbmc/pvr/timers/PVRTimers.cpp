@@ -19,6 +19,7 @@
 #include "pvr/epg/EpgContainer.h"
 #include "pvr/epg/EpgInfoTag.h"
 #include "pvr/timers/PVRTimerInfoTag.h"
+#include "pvr/timers/PVRTimerRuleIndex.h"
 #include "pvr/timers/PVRTimerRuleMatcher.h"
 #include "settings/Settings.h"
 #include "utils/log.h"
@@ -29,6 +30,7 @@
 #include <memory>
 #include <mutex>
 #include <numeric>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -133,6 +135,7 @@ void CPVRTimers::Unload()
   // remove all tags
   std::unique_lock<CCriticalSection> lock(m_critSection);
   m_tags.clear();
+  m_reminderRuleEpgIds.clear();
 }
 
 void CPVRTimers::Start()
@@ -438,55 +441,28 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEpgTagsForTimerRule(
   return matches;
 }
 
-void AddTimerRuleToEpgMap(
-    const std::shared_ptr<CPVRTimerInfoTag>& timer,
-    const CDateTime& now,
-    std::map<std::shared_ptr<CPVREpg>, std::vector<std::shared_ptr<CPVRTimerRuleMatcher>>>& epgMap,
-    bool& bFetchedAllEpgs)
+void AddTimerRuleToIndex(const std::shared_ptr<CPVRTimerInfoTag>& timer,
+                         const CDateTime& now,
+                         CPVRTimerRuleIndex& index,
+                         std::set<std::shared_ptr<CPVREpg>>& epgs,
+                         bool& bFetchedAllEpgs)
 {
+  index.AddRule(std::make_shared<CPVRTimerRuleMatcher>(timer, now));
+
   const std::shared_ptr<const CPVRChannel> channel = timer->Channel();
   if (channel)
   {
     const std::shared_ptr<CPVREpg> epg = channel->GetEPG();
     if (epg)
-    {
-      const std::shared_ptr<CPVRTimerRuleMatcher> matcher =
-          std::make_shared<CPVRTimerRuleMatcher>(timer, now);
-      auto it = epgMap.find(epg);
-      if (it == epgMap.end())
-        epgMap.insert({epg, {matcher}});
-      else
-        it->second.emplace_back(matcher);
-    }
+      epgs.insert(epg);
   }
-  else
+  else if (!bFetchedAllEpgs)
   {
     // rule matches "any channel" => we need to check all channels
-    if (!bFetchedAllEpgs)
-    {
-      const std::vector<std::shared_ptr<CPVREpg>> epgs =
-          CServiceBroker::GetPVRManager().EpgContainer().GetAllEpgs();
-      for (const auto& epg : epgs)
-      {
-        const std::shared_ptr<CPVRTimerRuleMatcher> matcher =
-            std::make_shared<CPVRTimerRuleMatcher>(timer, now);
-        auto it = epgMap.find(epg);
-        if (it == epgMap.end())
-          epgMap.insert({epg, {matcher}});
-        else
-          it->second.emplace_back(matcher);
-      }
-      bFetchedAllEpgs = true;
-    }
-    else
-    {
-      for (auto& epgMapEntry : epgMap)
-      {
-        const std::shared_ptr<CPVRTimerRuleMatcher> matcher =
-            std::make_shared<CPVRTimerRuleMatcher>(timer, now);
-        epgMapEntry.second.emplace_back(matcher);
-      }
-    }
+    const std::vector<std::shared_ptr<CPVREpg>> allEpgs =
+        CServiceBroker::GetPVRManager().EpgContainer().GetAllEpgs();
+    epgs.insert(allEpgs.cbegin(), allEpgs.cend());
+    bFetchedAllEpgs = true;
   }
 }
 } // unnamed namespace
@@ -499,7 +475,8 @@ bool CPVRTimers::UpdateEntries(int iMaxNotificationDelay)
   bool bChanged = false;
   const CDateTime now = CDateTime::GetUTCDateTime();
   bool bFetchedAllEpgs = false;
-  std::map<std::shared_ptr<CPVREpg>, std::vector<std::shared_ptr<CPVRTimerRuleMatcher>>> epgMap;
+  CPVRTimerRuleIndex reminderRules;
+  std::set<std::shared_ptr<CPVREpg>> reminderRuleEpgs;
 
   std::unique_lock<CCriticalSection> lock(m_critSection);
 
@@ -611,7 +588,7 @@ bool CPVRTimers::UpdateEntries(int iMaxNotificationDelay)
           if (timer->IsEpgBased())
           {
             if (m_bReminderRulesUpdatePending)
-              AddTimerRuleToEpgMap(timer, now, epgMap, bFetchedAllEpgs);
+              AddTimerRuleToIndex(timer, now, reminderRules, reminderRuleEpgs, bFetchedAllEpgs);
           }
           else
           {
@@ -676,26 +653,33 @@ bool CPVRTimers::UpdateEntries(int iMaxNotificationDelay)
   }
 
   // create new children of local epg-based reminder timer rules
-  for (const auto& epgMapEntry : epgMap)
+  if (!reminderRules.IsEmpty())
   {
-    const auto epgTags = epgMapEntry.first->GetTags();
-    for (const auto& epgTag : epgTags)
+    reminderRules.Build();
+
+    for (const auto& epg : reminderRuleEpgs)
     {
-      if (GetTimerForEpgTag(epgTag))
-        continue;
+      // new rules are matched against all tags when added (see AddLocalTimer), so only the tags
+      // that changed since the last run need to be matched, once an epg was matched completely
+      std::vector<std::shared_ptr<CPVREpgInfoTag>> epgTags = epg->GetAndResetUpdatedTags();
+      if (m_reminderRuleEpgIds.insert(epg->EpgID()).second)
+        epgTags = epg->GetTags();
 
-      for (const auto& matcher : epgMapEntry.second)
+      for (const auto& epgTag : epgTags)
       {
-        if (!matcher->Matches(epgTag))
+        if (GetTimerForEpgTag(epgTag))
           continue;
 
-        const std::shared_ptr<CPVRTimerInfoTag> childTimer =
-            CPVRTimerInfoTag::CreateReminderFromEpg(epgTag, matcher->GetTimerRule());
-        if (childTimer)
+        for (const auto& matcher : reminderRules.GetMatchingRules(epgTag))
         {
-          bChanged = true;
-          childTimersToInsert.emplace_back(matcher->GetTimerRule(),
-                                           childTimer); // remember and insert/save later
+          const std::shared_ptr<CPVRTimerInfoTag> childTimer =
+              CPVRTimerInfoTag::CreateReminderFromEpg(epgTag, matcher->GetTimerRule());
+          if (childTimer)
+          {
+            bChanged = true;
+            childTimersToInsert.emplace_back(matcher->GetTimerRule(),
+                                             childTimer); // remember and insert/save later
+          }
         }
       }
     }
@@ -14,6 +14,7 @@
 #include <map>
 #include <memory>
 #include <queue>
+#include <set>
 #include <vector>
 
 class CDateTime;
@@ -326,6 +327,7 @@ private:
   CPVRSettings m_settings;
   std::queue<std::shared_ptr<CPVRTimerInfoTag>> m_remindersToAnnounce;
   bool m_bReminderRulesUpdatePending = false;
+  std::set<int> m_reminderRuleEpgIds; // epgs completely matched against reminder rules
 
   bool m_bFirstUpdate = true;
   std::vector<int> m_failedClients;
@@ -71,6 +71,8 @@ public:
   const std::string& GetRenderRenderer() const { return m_RenderRenderer; }
   const std::string& GetRenderVersionString() const { return m_RenderVersion; }
   virtual bool SupportsNPOT(bool dxt) const;
+  //! \brief Whether DXT1/3/5 compressed textures can be uploaded
+  virtual bool SupportsDXT() const { return false; }
   virtual bool SupportsStereo(RENDER_STEREO_MODE mode) const;
   unsigned int GetMaxTextureSize() const { return m_maxTextureSize; }
   unsigned int GetMinDXTPitch() const { return m_minDXTPitch; }
@@ -10,6 +10,7 @@
 
 #include "ServiceBroker.h"
 #include "URL.h"
+#include "guilib/GUIRenderCacheGL.h"
 #include "guilib/GUITextureGL.h"
 #include "rendering/MatrixGL.h"
 #include "settings/AdvancedSettings.h"
@@ -142,6 +143,7 @@ bool CRenderSystemGL::InitRenderSystem()
   InitialiseShaders();
 
   CGUITextureGL::Register();
+  CGUIRenderCacheGL::Register();
 
   return true;
 }
@@ -235,6 +237,7 @@ bool CRenderSystemGL::DestroyRenderSystem()
     glDeleteVertexArrays(1, &m_vertexArray);
   }
 
+  CGUITextureGL::DestroyStreamBuffers();
   ReleaseShaders();
   m_bRenderCreated = false;
 
@@ -316,6 +319,11 @@ bool CRenderSystemGL::SupportsNPOT(bool dxt) const
   return true;
 }
 
+bool CRenderSystemGL::SupportsDXT() const
+{
+  return IsExtSupported("GL_EXT_texture_compression_s3tc");
+}
+
 void CRenderSystemGL::PresentRender(bool rendered, bool videoLayer)
 {
   SetVSync(true);
@@ -9,6 +9,7 @@
 #include "RenderSystemGLES.h"
 
 #include "guilib/DirtyRegion.h"
+#include "guilib/GUIRenderCacheGLES.h"
 #include "guilib/GUITextureGLES.h"
 #include "rendering/MatrixGL.h"
 #include "settings/AdvancedSettings.h"
@@ -105,6 +106,7 @@ bool CRenderSystemGLES::InitRenderSystem()
   InitialiseShaders();
 
   CGUITextureGLES::Register();
+  CGUIRenderCacheGLES::Register();
 
   return true;
 }
@@ -19,6 +19,7 @@
 #include "settings/SettingsComponent.h"
 #include "settings/lib/Setting.h"
 #include "settings/lib/SettingsManager.h"
+#include "threads/LockProfiler.h"
 #include "utils/FileUtils.h"
 #include "utils/LangCodeExpander.h"
 #include "utils/StringUtils.h"
@@ -129,6 +130,7 @@ void CAdvancedSettings::Initialize()
     return;
 
   m_audioApplyDrc = -1.0f;
+  m_audioPrebufferNextFileSecs = 10;
   m_VideoPlayerIgnoreDTSinWAV = false;
 
   //default hold time of 25 ms, this allows a 20 hertz sine to pass undistorted
@@ -163,11 +165,13 @@ void CAdvancedSettings::Initialize()
   m_videoCaptureUseOcclusionQuery = -1; //-1 is auto detect
   m_videoVDPAUtelecine = false;
   m_videoVDPAUdeintSkipChromaHD = false;
+  m_videoPlaybackReport = false;
   m_DXVACheckCompatibility = false;
   m_DXVACheckCompatibilityPresent = false;
   m_videoFpsDetect = 1;
   m_maxTempo = 1.55f;
   m_videoPreferStereoStream = false;
+  m_videoZeroCopyDemux = false;
 
   m_videoDefaultLatency = 0.0;
 
@@ -293,10 +297,13 @@ void CAdvancedSettings::Initialize()
   m_imageRes = 720;
   m_imageScalingAlgorithm = CPictureScalingAlgorithm::Default;
   m_imageQualityJpeg = 4;
+  m_imageUseDDS = false;
+  m_textureMemoryBudget = 0;
 
   m_sambaclienttimeout = 30;
   m_sambadoscodepage = "";
   m_sambastatfiles = true;
+  m_sambareadahead = 4096;
 
   m_bHTTPDirectoryStatFilesize = false;
 
@@ -318,12 +325,17 @@ void CAdvancedSettings::Initialize()
   m_iMusicLibraryDateAdded = 1; // prefer mtime over ctime and current time
   m_bMusicLibraryUseISODates = false;
   m_bMusicLibraryArtistNavigatesToSongs = false;
+  m_iMusicLibraryTagReadConcurrency = 4;
+  m_bMusicLibraryAnalyzeLoudness = false;
 
   m_bVideoLibraryAllItemsOnBottom = false;
   m_iVideoLibraryRecentlyAddedItems = 25;
   m_bVideoLibraryCleanOnUpdate = false;
   m_bVideoLibraryUseFastHash = true;
+  m_bVideoLibraryIncrementalScan = false;
   m_bVideoScannerIgnoreErrors = false;
+  m_videoScannerLookupThreads = 4;
+  m_videoScannerLookupInterval = 100;
   m_iVideoLibraryDateAdded = 1; // prefer mtime over ctime and current time
 
   m_iEpgUpdateCheckInterval = 300; /* Check every X seconds, if EPG data need to be updated. This does not mean that
@@ -347,6 +359,7 @@ void CAdvancedSettings::Initialize()
                                                       updateemptytagsinterval = 3600 => trigger an EPG update for every
                                                       channel without EPG data every 2 hours and trigger an EPG update
                                                       for every channel with EPG data every 1 hour. */
+  m_iEpgUpdateConcurrency = 2; /* Number of channels per client whose EPG is fetched at the same time */
   m_bEpgDisplayUpdatePopup = true; /* Display a progress popup while updating EPG data from clients */
   m_bEpgDisplayIncrementalUpdatePopup = false; /* Display a progress popup while doing incremental EPG updates, but
                                                   only if 'displayupdatepopup' is also enabled. */
@@ -367,6 +380,9 @@ void CAdvancedSettings::Initialize()
   m_curlDisableIPV6 = false;      //Certain hardware/OS combinations have trouble
                                   //with ipv6.
   m_curlDisableHTTP2 = false;
+  m_curlRangeConnections = 1;
+  m_curlMaxConnects = 16;
+  m_cacheSegments = 1;
 
 #if defined(TARGET_WINDOWS_DESKTOP)
   m_minimizeToTray = false;
@@ -384,6 +400,8 @@ void CAdvancedSettings::Initialize()
   m_GLRectangleHack = false;
   m_iSkipLoopFilter = 0;
   m_bVirtualShares = true;
+  m_persistentDirectoryCache = false;
+  m_libraryWriteBatch = 50;
 
   m_cpuTempCmd = "";
   m_gpuTempCmd = "";
@@ -402,6 +420,7 @@ void CAdvancedSettings::Initialize()
   m_iPVRNumericChannelSwitchTimeout = 2000;
   m_iPVRTimeshiftThreshold = 10;
   m_bPVRTimeshiftSimpleOSD = true;
+  m_iPVRDemuxPrefetchSize = 0;
   m_PVRDefaultSortOrder.sortBy = SortByDate;
   m_PVRDefaultSortOrder.sortOrder = SortOrderDescending;
 
@@ -409,6 +428,7 @@ void CAdvancedSettings::Initialize()
 
   m_jsonOutputCompact = true;
   m_jsonTcpPort = 9090;
+  m_jsonNotificationCoalesceTime = 250;
 
   m_enableMultimediaKeys = false;
 
@@ -416,6 +436,7 @@ void CAdvancedSettings::Initialize()
   m_guiVisualizeDirtyRegions = false;
   m_guiAlgorithmDirtyRegions = 3;
   m_guiSmartRedraw = false;
+  m_guiIdleRefreshRate = 10;
   m_airTunesPort = 36666;
   m_airPlayPort = 36667;
 
@@ -582,6 +603,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
       GetCustomRegexps(pAudioExcludes, m_audioExcludeFromScanRegExps);
 
     XMLUtils::GetFloat(pElement, "applydrc", m_audioApplyDrc);
+    XMLUtils::GetInt(pElement, "prebuffernextfile", m_audioPrebufferNextFileSecs, 2, 60);
     XMLUtils::GetBoolean(pElement, "VideoPlayerignoredtsinwav", m_VideoPlayerIgnoreDTSinWAV);
 
     XMLUtils::GetFloat(pElement, "limiterhold", m_limiterHold, 0.0f, 100.0f);
@@ -650,6 +672,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "useocclusionquery", m_videoCaptureUseOcclusionQuery, -1, 1);
     XMLUtils::GetBoolean(pElement,"vdpauInvTelecine",m_videoVDPAUtelecine);
     XMLUtils::GetBoolean(pElement,"vdpauHDdeintSkipChroma",m_videoVDPAUdeintSkipChromaHD);
+    XMLUtils::GetBoolean(pElement, "playbackreport", m_videoPlaybackReport);
 
     TiXmlElement* pAdjustRefreshrate = pElement->FirstChildElement("adjustrefreshrate");
     if (pAdjustRefreshrate)
@@ -742,6 +765,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "fpsdetect", m_videoFpsDetect, 0, 2);
     XMLUtils::GetFloat(pElement, "maxtempo", m_maxTempo, 1.5, 2.1);
     XMLUtils::GetBoolean(pElement, "preferstereostream", m_videoPreferStereoStream);
+    XMLUtils::GetBoolean(pElement, "zerocopydemux", m_videoZeroCopyDemux);
 
     // Store global display latency settings
     TiXmlElement* pVideoLatency = pElement->FirstChildElement("latency");
@@ -802,6 +826,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "dateadded", m_iMusicLibraryDateAdded);
     XMLUtils::GetBoolean(pElement, "useisodates", m_bMusicLibraryUseISODates);
     XMLUtils::GetBoolean(pElement, "artistnavigatestosongs", m_bMusicLibraryArtistNavigatesToSongs);
+    XMLUtils::GetInt(pElement, "tagreadconcurrency", m_iMusicLibraryTagReadConcurrency, 1, 32);
+    XMLUtils::GetBoolean(pElement, "analyzeloudness", m_bMusicLibraryAnalyzeLoudness);
     //Music artist name separators
     TiXmlElement* separators = pElement->FirstChildElement("artistseparators");
     if (separators)
@@ -824,6 +850,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "recentlyaddeditems", m_iVideoLibraryRecentlyAddedItems, 1, INT_MAX);
     XMLUtils::GetBoolean(pElement, "cleanonupdate", m_bVideoLibraryCleanOnUpdate);
     XMLUtils::GetBoolean(pElement, "usefasthash", m_bVideoLibraryUseFastHash);
+    XMLUtils::GetBoolean(pElement, "incrementalscan", m_bVideoLibraryIncrementalScan);
     XMLUtils::GetString(pElement, "itemseparator", m_videoItemSeparator);
     XMLUtils::GetBoolean(pElement, "importwatchedstate", m_bVideoLibraryImportWatchedState);
     XMLUtils::GetBoolean(pElement, "importresumepoint", m_bVideoLibraryImportResumePoint);
@@ -834,6 +861,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   if (pElement)
   {
     XMLUtils::GetBoolean(pElement, "ignoreerrors", m_bVideoScannerIgnoreErrors);
+    XMLUtils::GetInt(pElement, "lookupthreads", m_videoScannerLookupThreads, 1, 16);
+    XMLUtils::GetInt(pElement, "lookupinterval", m_videoScannerLookupInterval, 0, 10000);
   }
 
   // Backward-compatibility of ExternalPlayer config
@@ -859,7 +888,10 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "curlkeepaliveinterval", m_curlKeepAliveInterval, 0, 300);
     XMLUtils::GetBoolean(pElement, "disableipv6", m_curlDisableIPV6);
     XMLUtils::GetBoolean(pElement, "disablehttp2", m_curlDisableHTTP2);
+    XMLUtils::GetInt(pElement, "curlrangeconnections", m_curlRangeConnections, 1, 16);
+    XMLUtils::GetInt(pElement, "curlmaxconnects", m_curlMaxConnects, 1, 100);
     XMLUtils::GetString(pElement, "catrustfile", m_caTrustFile);
+    XMLUtils::GetInt(pElement, "cachesegments", m_cacheSegments, 1, 8);
   }
 
   pElement = pRootElement->FirstChildElement("jsonrpc");
@@ -867,6 +899,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   {
     XMLUtils::GetBoolean(pElement, "compactoutput", m_jsonOutputCompact);
     XMLUtils::GetUInt(pElement, "tcpport", m_jsonTcpPort);
+    XMLUtils::GetUInt(pElement, "notificationcoalescetime", m_jsonNotificationCoalesceTime, 0,
+                      5000);
   }
 
   pElement = pRootElement->FirstChildElement("samba");
@@ -875,6 +909,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pElement,  "doscodepage",   m_sambadoscodepage);
     XMLUtils::GetInt(pElement, "clienttimeout", m_sambaclienttimeout, 5, 100);
     XMLUtils::GetBoolean(pElement, "statfiles", m_sambastatfiles);
+    XMLUtils::GetInt(pElement, "readahead", m_sambareadahead, 0, 65536);
   }
 
   pElement = pRootElement->FirstChildElement("httpdirectory");
@@ -903,6 +938,17 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     CServiceBroker::GetLogging().SetLogLevel(m_logLevel);
   }
 
+  // <asynclogging overflow="drop|block">true</asynclogging>
+  pElement = pRootElement->FirstChildElement("asynclogging");
+  if (pElement)
+  {
+    bool asyncLogging = false;
+    XMLUtils::GetBoolean(pRootElement, "asynclogging", asyncLogging);
+    const char* overflow = pElement->Attribute("overflow");
+    CServiceBroker::GetLogging().SetAsync(asyncLogging,
+                                          !overflow || StringUtils::EqualsNoCase(overflow, "drop"));
+  }
+
   XMLUtils::GetString(pRootElement, "cddbaddress", m_cddbAddress);
   XMLUtils::GetBoolean(pRootElement, "addsourceontop", m_addSourceOnTop);
 
@@ -923,6 +969,11 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   XMLUtils::GetBoolean(pRootElement, "showexitbutton", m_showExitButton);
   XMLUtils::GetBoolean(pRootElement, "canwindowed", m_canWindowed);
 
+  XMLUtils::GetBoolean(pRootElement, "lockprofiling", m_lockProfiling);
+#if defined(HAS_LOCK_PROFILING)
+  XbmcThreads::CLockProfiler::SetEnabled(m_lockProfiling);
+#endif
+
   XMLUtils::GetInt(pRootElement, "songinfoduration", m_songInfoDuration, 0, INT_MAX);
   XMLUtils::GetInt(pRootElement, "playlistretries", m_playlistRetries, -1, 5000);
   XMLUtils::GetInt(pRootElement, "playlisttimeout", m_playlistTimeout, 0, 5000);
@@ -931,6 +982,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   XMLUtils::GetInt(pRootElement,"skiploopfilter", m_iSkipLoopFilter, -16, 48);
 
   XMLUtils::GetBoolean(pRootElement,"virtualshares", m_bVirtualShares);
+  XMLUtils::GetBoolean(pRootElement, "persistentdircache", m_persistentDirectoryCache);
+  XMLUtils::GetInt(pRootElement, "librarywritebatch", m_libraryWriteBatch, 1, 1000);
   XMLUtils::GetUInt(pRootElement, "packagefoldersize", m_addonPackageFolderSize);
 
   // EPG
@@ -942,6 +995,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "activetagcheckinterval", m_iEpgActiveTagCheckInterval);
     XMLUtils::GetInt(pElement, "retryinterruptedupdateinterval", m_iEpgRetryInterruptedUpdateInterval);
     XMLUtils::GetInt(pElement, "updateemptytagsinterval", m_iEpgUpdateEmptyTagsInterval);
+    XMLUtils::GetInt(pElement, "updateconcurrency", m_iEpgUpdateConcurrency, 1, 8);
     XMLUtils::GetBoolean(pElement, "displayupdatepopup", m_bEpgDisplayUpdatePopup);
     XMLUtils::GetBoolean(pElement, "displayincrementalupdatepopup", m_bEpgDisplayIncrementalUpdatePopup);
   }
@@ -1072,6 +1126,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   if (XMLUtils::GetString(pRootElement, "imagescalingalgorithm", tmp))
     m_imageScalingAlgorithm = CPictureScalingAlgorithm::FromString(tmp);
   XMLUtils::GetUInt(pRootElement, "imagequalityjpeg", m_imageQualityJpeg, 0, 21);
+  XMLUtils::GetBoolean(pRootElement, "imageusedds", m_imageUseDDS);
+  XMLUtils::GetUInt(pRootElement, "texturememorybudget", m_textureMemoryBudget, 0, 65536);
   XMLUtils::GetBoolean(pRootElement, "playlistasfolders", m_playlistAsFolders);
   XMLUtils::GetBoolean(pRootElement, "uselocalecollation", m_useLocaleCollation);
   XMLUtils::GetBoolean(pRootElement, "detectasudf", m_detectAsUdf);
@@ -1128,6 +1184,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pPVR, "numericchannelswitchtimeout", m_iPVRNumericChannelSwitchTimeout, 50, 60000);
     XMLUtils::GetInt(pPVR, "timeshiftthreshold", m_iPVRTimeshiftThreshold, 0, 60);
     XMLUtils::GetBoolean(pPVR, "timeshiftsimpleosd", m_bPVRTimeshiftSimpleOSD);
+    XMLUtils::GetInt(pPVR, "demuxprefetchsize", m_iPVRDemuxPrefetchSize, 0, 262144);
     TiXmlElement* pSortDecription = pPVR->FirstChildElement("pvrrecordings");
     if (pSortDecription)
     {
@@ -1229,7 +1286,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetBoolean(pElement, "visualizedirtyregions", m_guiVisualizeDirtyRegions);
     XMLUtils::GetInt(pElement, "algorithmdirtyregions",     m_guiAlgorithmDirtyRegions);
     XMLUtils::GetBoolean(pElement, "smartredraw", m_guiSmartRedraw);
+    XMLUtils::GetBoolean(pElement, "occlusionculling", m_guiOcclusionCulling);
     XMLUtils::GetBoolean(pElement, "transparentvideolayout", m_guiVideoLayoutTransparent);
+    XMLUtils::GetUInt(pElement, "idlerefreshrate", m_guiIdleRefreshRate, 0, 100);
   }
 
   std::string seekSteps;
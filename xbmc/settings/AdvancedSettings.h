@@ -143,6 +143,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     std::string m_videoPPFFmpegPostProc;
     bool m_videoVDPAUtelecine;
     bool m_videoVDPAUdeintSkipChromaHD;
+    bool m_videoPlaybackReport; ///< write playback statistics when video playback ends
     bool m_musicUseTimeSeeking;
     int m_musicTimeSeekForward;
     int m_musicTimeSeekBackward;
@@ -155,6 +156,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_videoIgnoreSecondsAtStart;
     float m_videoIgnorePercentAtEnd;
     float m_audioApplyDrc;
+    int m_audioPrebufferNextFileSecs; // seconds of the next track decoded before the transition
     unsigned int m_maxPassthroughOffSyncDuration = 30; // when 30 ms off adjust
     bool m_AllowMultiChannelFloat = false; // Android only switch to be removed in v22
     bool m_superviseAudioDelay = false; // Android only to correct broken audio firmwares
@@ -171,6 +173,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int  m_videoFpsDetect;
     float m_maxTempo;
     bool m_videoPreferStereoStream = false;
+    bool m_videoZeroCopyDemux = false; //!< Reference libavformat packet buffers instead of copying
 
     std::string m_videoDefaultPlayer;
     float m_videoPlayCountMinimumPercent;
@@ -230,10 +233,13 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     CPictureScalingAlgorithm::Algorithm m_imageScalingAlgorithm;
     unsigned int
         m_imageQualityJpeg; ///< \brief the stored jpeg quality the lower the better (default: 4)
+    bool m_imageUseDDS; ///< \brief keep GPU compressed copies of cached images (default: false)
+    unsigned int m_textureMemoryBudget; ///< \brief memory budget of all textures in MB, 0 for a quarter of the physical memory
 
     int m_sambaclienttimeout;
     std::string m_sambadoscodepage;
     bool m_sambastatfiles;
+    int m_sambareadahead; ///< \brief size of the read-ahead buffer of smb files in KB, 0 to disable
 
     bool m_bHTTPDirectoryStatFilesize;
 
@@ -249,6 +255,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_bMusicLibraryArtistSortOnUpdate;
     bool m_bMusicLibraryUseISODates;
     bool m_bMusicLibraryArtistNavigatesToSongs;
+    int m_iMusicLibraryTagReadConcurrency; // files whose tags are read at the same time per folder
+    bool m_bMusicLibraryAnalyzeLoudness; // compute ReplayGain of untagged files while scanning
     std::string m_strMusicLibraryAlbumFormat;
     bool m_prioritiseAPEv2tags;
     std::string m_musicItemSeparator;
@@ -260,10 +268,13 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iVideoLibraryRecentlyAddedItems;
     bool m_bVideoLibraryCleanOnUpdate;
     bool m_bVideoLibraryUseFastHash;
+    bool m_bVideoLibraryIncrementalScan;
     bool m_bVideoLibraryImportWatchedState{true};
     bool m_bVideoLibraryImportResumePoint{true};
 
     bool m_bVideoScannerIgnoreErrors;
+    int m_videoScannerLookupThreads; ///< \brief concurrent movie lookups, 1 disables them
+    int m_videoScannerLookupInterval; ///< \brief min. ms between lookups of the same scraper
     int m_iVideoLibraryDateAdded;
 
     std::set<std::string> m_vecTokens;
@@ -273,6 +284,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iEpgActiveTagCheckInterval; // seconds
     int m_iEpgRetryInterruptedUpdateInterval; // seconds
     int m_iEpgUpdateEmptyTagsInterval; // seconds
+    int m_iEpgUpdateConcurrency; // channels updated at the same time per client
     bool m_bEpgDisplayUpdatePopup;
     bool m_bEpgDisplayIncrementalUpdatePopup;
 
@@ -293,6 +305,9 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_curlKeepAliveInterval;    // seconds
     bool m_curlDisableIPV6;
     bool m_curlDisableHTTP2;
+    int m_curlRangeConnections; ///< \brief max. concurrent range requests per host for read-ahead
+    int m_curlMaxConnects; ///< \brief max. idle connections kept open for reuse
+    int m_cacheSegments; ///< \brief number of independent ranges kept by the memory file cache
 
     std::string m_caTrustFile;
 
@@ -303,12 +318,15 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_canWindowed;
     bool m_splashImage;
     bool m_alwaysOnTop;  /* makes xbmc to run always on top .. osx/win32 only .. */
+    bool m_lockProfiling{false}; //!< record lock contention, needs ENABLE_LOCK_PROFILING
     int m_playlistRetries;
     int m_playlistTimeout;
     bool m_GLRectangleHack;
     int m_iSkipLoopFilter;
 
     bool m_bVirtualShares;
+    bool m_persistentDirectoryCache; ///< \brief keep validated network listings across restarts
+    int m_libraryWriteBatch; ///< \brief items per commit of the library scanners, 1 disables
 
     std::string m_cpuTempCmd;
     std::string m_gpuTempCmd;
@@ -321,6 +339,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iPVRNumericChannelSwitchTimeout; /*!< @brief time in msecs after that a channel switch occurs after entering a channel number, if confirmchannelswitch is disabled */
     int m_iPVRTimeshiftThreshold; /*!< @brief time diff between current playing time and timeshift buffer end, in seconds, before a playing stream is displayed as timeshifting. */
     bool m_bPVRTimeshiftSimpleOSD; /*!< @brief use simple timeshift OSD (with progress only for the playing event instead of progress for the whole ts buffer). */
+    int m_iPVRDemuxPrefetchSize; /*!< @brief size in KiB of the buffer that live PVR streams demuxed by the client are read ahead into, 0 to read packets on demand. */
     SortDescription m_PVRDefaultSortOrder; /*!< @brief SortDecription used to store default recording sort type and sort order */
 
     DatabaseSettings m_databaseMusic; // advanced music database setup
@@ -333,11 +352,14 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_guiVisualizeDirtyRegions;
     int  m_guiAlgorithmDirtyRegions;
     bool m_guiSmartRedraw;
+    bool m_guiOcclusionCulling{true};
     bool m_guiVideoLayoutTransparent{false};
+    unsigned int m_guiIdleRefreshRate; ///< \brief minimum GUI refresh rate in Hz while nothing changes, 0 to disable idle mode
     unsigned int m_addonPackageFolderSize;
 
     bool m_jsonOutputCompact;
     unsigned int m_jsonTcpPort;
+    unsigned int m_jsonNotificationCoalesceTime; ///< ms in which repeated seeks etc. are merged
 
     bool m_enableMultimediaKeys;
     std::vector<std::string> m_settingsFiles;
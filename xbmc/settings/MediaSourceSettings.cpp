@@ -12,6 +12,7 @@
 #include "URL.h"
 #include "Util.h"
 #include "media/MediaLockState.h"
+#include "network/DNSNameCache.h"
 #include "network/WakeOnAccess.h"
 #include "profiles/ProfileManager.h"
 #include "settings/SettingsComponent.h"
@@ -24,6 +25,7 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <set>
 
 #define SOURCES_FILE "sources.xml"
 #define XML_SOURCES "sources"
@@ -102,6 +104,26 @@ bool CMediaSourceSettings::Load(const std::string& file)
   GetSources(rootElement, "music", m_musicSources, m_defaultMusicSource);
   GetSources(rootElement, "games", m_gameSources, dummy);
 
+  // resolve the servers of network sources while nobody waits for them yet
+  std::set<std::string> hostNames;
+  for (const VECSOURCES* sources : {&m_videoSources, &m_programSources, &m_pictureSources,
+                                    &m_fileSources, &m_musicSources, &m_gameSources})
+  {
+    for (const auto& source : *sources)
+    {
+      for (const auto& path : source.vecPaths)
+      {
+        if (URIUtils::IsNetworkFilesystem(path) && !URIUtils::IsUPnP(path))
+        {
+          const CURL url(path);
+          if (!url.GetHostName().empty())
+            hostNames.insert(url.GetHostName());
+        }
+      }
+    }
+  }
+  CDNSNameCache::Prefetch({hostNames.begin(), hostNames.end()});
+
   return true;
 }
 
@@ -49,6 +49,7 @@
 #include "settings/SkinSettings.h"
 #include "settings/SubtitlesSettings.h"
 #include "settings/lib/SettingsManager.h"
+#include "threads/Timer.h"
 #include "utils/CharsetConverter.h"
 #include "utils/RssManager.h"
 #include "utils/StringUtils.h"
@@ -121,6 +122,12 @@ bool CSettings::Load()
 
 bool CSettings::Load(const std::string &file)
 {
+  {
+    // the file may have been changed or removed in the meantime
+    std::unique_lock<CCriticalSection> lock(m_saveLock);
+    m_lastSavedFile.clear();
+  }
+
   CXBMCTinyXML xmlDoc;
   bool updated = false;
   if (!XFILE::CFile::Exists(file) || !xmlDoc.LoadFile(file) ||
@@ -147,10 +154,18 @@ bool CSettings::Load(const TiXmlElement* root)
   return Load(root, updated);
 }
 
+CSettings::~CSettings() = default;
+
 bool CSettings::Save()
 {
   const std::shared_ptr<CProfileManager> profileManager = CServiceBroker::GetSettingsComponent()->GetProfileManager();
 
+  {
+    // this save covers any deferred one
+    std::unique_lock<CCriticalSection> lock(m_saveLock);
+    m_savePending = false;
+  }
+
   return Save(profileManager->GetSettingsFile());
 }
 
@@ -167,7 +182,63 @@ bool CSettings::Save(const std::string &file)
   if (!Save(root))
     return false;
 
-  return xmlDoc.SaveFile(file);
+  TiXmlPrinter printer;
+  xmlDoc.Accept(&printer);
+
+  std::unique_lock<CCriticalSection> lock(m_saveLock);
+  // most saves are triggered by actions that did not change any value, don't wear out the flash
+  // of small devices by writing the same content again
+  if (file == m_lastSavedFile && m_lastSavedContent == printer.Str())
+    return true;
+
+  CFile xmlFile;
+  if (!xmlFile.OpenForWrite(file, true) ||
+      xmlFile.Write(printer.CStr(), printer.Size()) != static_cast<ssize_t>(printer.Size()))
+    return false;
+  xmlFile.Flush();
+
+  m_lastSavedFile = file;
+  m_lastSavedContent = printer.Str();
+  return true;
+}
+
+void CSettings::Unload()
+{
+  SavePending();
+
+  {
+    std::unique_lock<CCriticalSection> lock(m_saveLock);
+    m_lastSavedFile.clear();
+  }
+
+  CSettingsBase::Unload();
+}
+
+void CSettings::SaveDeferred()
+{
+  // several changes within this time are written at once
+  constexpr auto SAVE_DELAY = std::chrono::seconds(2);
+
+  std::unique_lock<CCriticalSection> lock(m_saveLock);
+  m_savePending = true;
+  if (!m_saveTimer)
+    m_saveTimer = std::make_unique<CTimer>([this]() { SavePending(); });
+
+  if (m_saveTimer->IsRunning())
+    m_saveTimer->RestartAsync(SAVE_DELAY);
+  else
+    m_saveTimer->Start(SAVE_DELAY);
+}
+
+void CSettings::SavePending()
+{
+  {
+    std::unique_lock<CCriticalSection> lock(m_saveLock);
+    if (!m_savePending)
+      return;
+  }
+
+  Save();
 }
 
 bool CSettings::Save(TiXmlNode* root) const
@@ -199,6 +270,8 @@ bool CSettings::GetBool(const std::string& id) const
 
 void CSettings::Clear()
 {
+  SavePending();
+
   std::unique_lock<CCriticalSection> lock(m_critical);
   if (!m_initialized)
     return;
@@ -12,10 +12,13 @@
 #include "settings/SettingControl.h"
 #include "settings/SettingCreator.h"
 #include "settings/SettingsBase.h"
+#include "threads/CriticalSection.h"
 
+#include <memory>
 #include <string>
 
 class CSettingList;
+class CTimer;
 class TiXmlNode;
 
 /*!
@@ -542,7 +545,7 @@ public:
    be used.
    */
   CSettings() = default;
-  ~CSettings() override = default;
+  ~CSettings() override;
 
   CSettingsManager* GetSettingsManager() const { return m_settingsManager; }
 
@@ -565,6 +568,15 @@ public:
   // implementations of CSettingsBase
   bool Load() override;
   bool Save() override;
+  void Unload() override;
+
+  /*!
+   \brief Saves the setting values after a short delay.
+
+   Meant for values that are changed in quick succession, e.g. skin settings toggled from the GUI,
+   so that several changes end up in a single write of the settings file.
+   */
+  void SaveDeferred();
 
   /*!
    \brief Loads setting values from the given (XML) file.
@@ -658,5 +670,14 @@ private:
   bool Initialize(const std::string &file);
   bool Reset();
 
+  void SavePending();
+
   std::set<ISubSettings*> m_subSettings;
+
+  CCriticalSection m_saveLock;
+  std::unique_ptr<CTimer> m_saveTimer;
+  bool m_savePending = false;
+  // what was written last, an unchanged settings file is not written again
+  std::string m_lastSavedFile;
+  std::string m_lastSavedContent;
 };
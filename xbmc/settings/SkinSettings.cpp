@@ -50,6 +50,7 @@ const std::string& CSkinSettings::GetString(int setting) const
 void CSkinSettings::SetString(int setting, const std::string &label)
 {
   g_SkinInfo->SetString(setting, label);
+  ++m_version;
 }
 
 int CSkinSettings::TranslateBool(const std::string &setting)
@@ -70,11 +71,13 @@ int CSkinSettings::GetInt(int setting) const
 void CSkinSettings::SetBool(int setting, bool set)
 {
   g_SkinInfo->SetBool(setting, set);
+  ++m_version;
 }
 
 void CSkinSettings::Reset(const std::string &setting)
 {
   g_SkinInfo->Reset(setting);
+  ++m_version;
 }
 
 std::set<ADDON::CSkinSettingPtr> CSkinSettings::GetSettings() const
@@ -84,6 +87,8 @@ std::set<ADDON::CSkinSettingPtr> CSkinSettings::GetSettings() const
 
 ADDON::CSkinSettingPtr CSkinSettings::GetSetting(const std::string& settingId)
 {
+  // the caller may change the setting through the returned pointer
+  ++m_version;
   return g_SkinInfo->GetSkinSetting(settingId);
 }
 
@@ -96,6 +101,7 @@ std::shared_ptr<const ADDON::CSkinSetting> CSkinSettings::GetSetting(
 void CSkinSettings::Reset()
 {
   g_SkinInfo->Reset();
+  ++m_version;
 
   CGUIInfoManager& infoMgr = CServiceBroker::GetGUI()->GetInfoManager();
   infoMgr.ResetCache();
@@ -176,6 +182,8 @@ void CSkinSettings::MigrateSettings(const std::shared_ptr<ADDON::CSkinInfo>& ski
 
   if (settingsMigrated)
   {
+    ++m_version;
+
     // save the skin's settings
     skin->SaveSettings();
 
@@ -12,6 +12,7 @@
 #include "settings/ISubSettings.h"
 #include "threads/CriticalSection.h"
 
+#include <atomic>
 #include <memory>
 #include <set>
 #include <string>
@@ -50,6 +51,11 @@ public:
   void Reset(const std::string &setting);
   void Reset();
 
+  /*! \brief Get a counter that changes whenever any skin setting may have changed.
+   Used to cache labels built from skin settings.
+   */
+  unsigned int GetVersion() const { return m_version; }
+
 protected:
   CSkinSettings();
   CSkinSettings(const CSkinSettings&) = delete;
@@ -59,4 +65,5 @@ protected:
 private:
   CCriticalSection m_critical;
   std::set<ADDON::CSkinSettingPtr> m_settings;
+  std::atomic<unsigned int> m_version{1};
 };
@@ -583,11 +583,11 @@ SettingDependencyMap CSettingsManager::GetDependencies(const SettingConstPtr& se
 bool CSettingsManager::GetBool(const std::string &id) const
 {
   std::shared_lock<CSharedSection> lock(m_settingsCritical);
-  SettingPtr setting = GetSetting(id);
+  const CSetting* setting = FindValueSetting(id);
   if (setting == nullptr || setting->GetType() != SettingType::Boolean)
     return false;
 
-  return std::static_pointer_cast<CSettingBool>(setting)->GetValue();
+  return static_cast<const CSettingBool*>(setting)->GetValue();
 }
 
 bool CSettingsManager::SetBool(const std::string &id, bool value)
@@ -613,11 +613,11 @@ bool CSettingsManager::ToggleBool(const std::string &id)
 int CSettingsManager::GetInt(const std::string &id) const
 {
   std::shared_lock<CSharedSection> lock(m_settingsCritical);
-  SettingPtr setting = GetSetting(id);
+  const CSetting* setting = FindValueSetting(id);
   if (setting == nullptr || setting->GetType() != SettingType::Integer)
     return 0;
 
-  return std::static_pointer_cast<CSettingInt>(setting)->GetValue();
+  return static_cast<const CSettingInt*>(setting)->GetValue();
 }
 
 bool CSettingsManager::SetInt(const std::string &id, int value)
@@ -633,11 +633,11 @@ bool CSettingsManager::SetInt(const std::string &id, int value)
 double CSettingsManager::GetNumber(const std::string &id) const
 {
   std::shared_lock<CSharedSection> lock(m_settingsCritical);
-  SettingPtr setting = GetSetting(id);
+  const CSetting* setting = FindValueSetting(id);
   if (setting == nullptr || setting->GetType() != SettingType::Number)
     return 0.0;
 
-  return std::static_pointer_cast<CSettingNumber>(setting)->GetValue();
+  return static_cast<const CSettingNumber*>(setting)->GetValue();
 }
 
 bool CSettingsManager::SetNumber(const std::string &id, double value)
@@ -653,11 +653,11 @@ bool CSettingsManager::SetNumber(const std::string &id, double value)
 std::string CSettingsManager::GetString(const std::string &id) const
 {
   std::shared_lock<CSharedSection> lock(m_settingsCritical);
-  SettingPtr setting = GetSetting(id);
+  const CSetting* setting = FindValueSetting(id);
   if (setting == nullptr || setting->GetType() != SettingType::String)
     return "";
 
-  return std::static_pointer_cast<CSettingString>(setting)->GetValue();
+  return static_cast<const CSettingString*>(setting)->GetValue();
 }
 
 bool CSettingsManager::SetString(const std::string &id, const std::string &value)
@@ -1436,16 +1436,47 @@ void CSettingsManager::ResolveSettingDependencies(const Setting& setting)
   }
 }
 
-CSettingsManager::SettingMap::const_iterator CSettingsManager::FindSetting(std::string settingId) const
+namespace
 {
-  StringUtils::ToLower(settingId);
-  return m_settings.find(settingId);
+bool IsLower(const std::string& settingId)
+{
+  return std::none_of(settingId.begin(), settingId.end(),
+                      [](char c) { return c >= 'A' && c <= 'Z'; });
 }
+} // unnamed namespace
 
-CSettingsManager::SettingMap::iterator CSettingsManager::FindSetting(std::string settingId)
+CSettingsManager::SettingMap::const_iterator CSettingsManager::FindSetting(
+    const std::string& settingId) const
 {
-  StringUtils::ToLower(settingId);
-  return m_settings.find(settingId);
+  // the identifiers are stored in lower case and nearly every caller passes them that way, only
+  // copy them for lower casing if necessary
+  if (IsLower(settingId))
+    return m_settings.find(settingId);
+
+  return m_settings.find(StringUtils::ToLower(settingId));
+}
+
+CSettingsManager::SettingMap::iterator CSettingsManager::FindSetting(const std::string& settingId)
+{
+  if (IsLower(settingId))
+    return m_settings.find(settingId);
+
+  return m_settings.find(StringUtils::ToLower(settingId));
+}
+
+const CSetting* CSettingsManager::FindValueSetting(const std::string& settingId) const
+{
+  auto setting = FindSetting(settingId);
+  if (setting == m_settings.end())
+  {
+    m_logger->debug("requested setting ({}) was not found.", settingId);
+    return nullptr;
+  }
+
+  if (setting->second.setting->IsReference())
+    return FindValueSetting(setting->second.setting->GetReferencedId());
+
+  return setting->second.setting.get();
 }
 
 std::pair<CSettingsManager::SettingMap::iterator, bool> CSettingsManager::InsertSetting(std::string settingId, const Setting& setting)
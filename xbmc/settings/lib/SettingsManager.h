@@ -518,8 +518,14 @@ private:
   void ResolveSettingDependencies(const std::shared_ptr<CSetting>& setting);
   void ResolveSettingDependencies(const Setting& setting);
 
-  SettingMap::const_iterator FindSetting(std::string settingId) const;
-  SettingMap::iterator FindSetting(std::string settingId);
+  SettingMap::const_iterator FindSetting(const std::string& settingId) const;
+  SettingMap::iterator FindSetting(const std::string& settingId);
+  /*!
+   \brief Looks up the setting with the given identifier for reading its value, references are
+   resolved. Unlike GetSetting() no reference to the setting is taken, the caller has to hold
+   m_settingsCritical while using it.
+   */
+  const CSetting* FindValueSetting(const std::string& settingId) const;
   std::pair<SettingMap::iterator, bool> InsertSetting(std::string settingId, const Setting& setting);
 
   bool m_initialized = false;
@@ -130,3 +130,29 @@ const TestFileData BaseMovies[] = {{ "c:\\dir\\filename.avi", false, "c:\\dir\\f
                                    { "/home/user/movies/movie_name/BDMV/index.bdmv", true, "/home/user/movies/movie_name/" }};
 
 INSTANTIATE_TEST_SUITE_P(BaseNameMovies, TestFileItemBasePath, ValuesIn(BaseMovies));
+
+TEST(TestFileItem, Properties)
+{
+  CFileItem item;
+  EXPECT_FALSE(item.HasProperties());
+
+  item.SetProperty("Zeta", 1);
+  item.SetProperty("alpha", "a");
+  item.SetProperty("Mid", true);
+  item.SetProperty("ALPHA", "b");
+
+  EXPECT_TRUE(item.HasProperty("zeta"));
+  EXPECT_EQ("b", item.GetProperty("Alpha").asString());
+  EXPECT_TRUE(item.GetProperty("missing").isNull());
+
+  CVariant value;
+  item.Serialize(value);
+  EXPECT_EQ(3u, value["customproperties"].size());
+
+  item.ClearProperty("MID");
+  EXPECT_FALSE(item.HasProperty("mid"));
+  EXPECT_EQ(1, item.GetProperty("zeta").asInteger());
+
+  item.ClearProperties();
+  EXPECT_FALSE(item.HasProperties());
+}
@@ -0,0 +1,32 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/CircularCache.h"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using namespace XFILE;
+
+static void BM_CircularCacheWriteRead(benchmark::State& state)
+{
+  const size_t chunk = static_cast<size_t>(state.range(0));
+  CCircularCache cache(4 * 1024 * 1024, 1024 * 1024);
+  cache.Open();
+
+  std::vector<char> buffer(chunk, 'x');
+  for (auto _ : state)
+  {
+    cache.WriteToCache(buffer.data(), chunk);
+    cache.ReadFromCache(buffer.data(), chunk);
+  }
+  cache.Close();
+  state.SetBytesProcessed(state.iterations() * chunk);
+}
+BENCHMARK(BM_CircularCacheWriteRead)->Arg(4 * 1024)->Arg(64 * 1024);
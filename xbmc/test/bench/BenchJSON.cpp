@@ -0,0 +1,66 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// roughly what a JSON-RPC library listing returns
+CVariant CreateResult(int count)
+{
+  CVariant items(CVariant::VariantTypeArray);
+  for (int i = 0; i < count; ++i)
+  {
+    CVariant item(CVariant::VariantTypeObject);
+    item["movieid"] = i;
+    item["label"] = StringUtils::Format("Movie number {}", i);
+    item["year"] = 1950 + i % 70;
+    item["rating"] = 5.0 + (i % 50) / 10.0;
+    item["genre"].push_back("Drama");
+    item["genre"].push_back("Comedy");
+    item["file"] = StringUtils::Format("smb://server/movies/Movie {}/movie.mkv", i);
+    items.push_back(std::move(item));
+  }
+
+  CVariant result(CVariant::VariantTypeObject);
+  result["movies"] = std::move(items);
+  return result;
+}
+} // unnamed namespace
+
+static void BM_JSONWrite(benchmark::State& state)
+{
+  const CVariant result = CreateResult(static_cast<int>(state.range(0)));
+  std::string json;
+  for (auto _ : state)
+  {
+    CJSONVariantWriter::Write(result, json, true);
+    benchmark::DoNotOptimize(json.data());
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JSONWrite)->Arg(10)->Arg(1000);
+
+static void BM_JSONParse(benchmark::State& state)
+{
+  std::string json;
+  CJSONVariantWriter::Write(CreateResult(static_cast<int>(state.range(0))), json, true);
+  for (auto _ : state)
+  {
+    CVariant result;
+    CJSONVariantParser::Parse(json, result);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JSONParse)->Arg(10)->Arg(1000);
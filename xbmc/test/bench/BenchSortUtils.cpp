@@ -0,0 +1,63 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/SortUtils.h"
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+SortItems CreateItems(int count)
+{
+  SortItems items;
+  items.reserve(count);
+  for (int i = 0; i < count; ++i)
+  {
+    // a fixed permutation, so that every run sorts the same input
+    const int n = (i * 7919) % count;
+    SortItemPtr item = std::make_shared<SortItem>();
+    (*item)[FieldLabel] = StringUtils::Format("Item {} of the list", n);
+    (*item)[FieldTitle] = StringUtils::Format("Title {}", count - n);
+    (*item)[FieldYear] = 1950 + n % 70;
+    items.emplace_back(std::move(item));
+  }
+  return items;
+}
+} // unnamed namespace
+
+static void BM_SortUtilsSortByLabel(benchmark::State& state)
+{
+  const SortItems input = CreateItems(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    SortItems items = input;
+    state.ResumeTiming();
+    SortUtils::Sort(SortByLabel, SortOrderAscending, SortAttributeNone, items);
+    benchmark::DoNotOptimize(items.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortUtilsSortByLabel)->Arg(100)->Arg(10000);
+
+static void BM_SortUtilsSortByYear(benchmark::State& state)
+{
+  const SortItems input = CreateItems(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    SortItems items = input;
+    state.ResumeTiming();
+    SortUtils::Sort(SortByYear, SortOrderDescending, SortAttributeNone, items);
+    benchmark::DoNotOptimize(items.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortUtilsSortByYear)->Arg(100)->Arg(10000);
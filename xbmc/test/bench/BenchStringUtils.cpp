@@ -0,0 +1,56 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/StringUtils.h"
+
+#include <benchmark/benchmark.h>
+
+static void BM_StringUtilsFormat(benchmark::State& state)
+{
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::Format("{} - {:02}x{:02} - {}", "Show", 3, 12, "Title"));
+}
+BENCHMARK(BM_StringUtilsFormat);
+
+static void BM_StringUtilsToLower(benchmark::State& state)
+{
+  const std::string input("Some Mixed Case Label Of A Typical Length");
+  for (auto _ : state)
+  {
+    std::string str(input);
+    StringUtils::ToLower(str);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(BM_StringUtilsToLower);
+
+static void BM_StringUtilsSplit(benchmark::State& state)
+{
+  const std::string input("Action / Adventure / Comedy / Drama / Science Fiction / Thriller");
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::Split(input, " / "));
+}
+BENCHMARK(BM_StringUtilsSplit);
+
+static void BM_StringUtilsAlphaNumericCompare(benchmark::State& state)
+{
+  const std::wstring left(L"Episode 10 - The Return");
+  const std::wstring right(L"Episode 9 - The Departure");
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::AlphaNumericCompare(left.c_str(), right.c_str()));
+}
+BENCHMARK(BM_StringUtilsAlphaNumericCompare);
+
+static void BM_StringUtilsEqualsNoCase(benchmark::State& state)
+{
+  const std::string left("videodb://movies/titles/");
+  const std::string right("VideoDB://Movies/Titles/");
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::EqualsNoCase(left, right));
+}
+BENCHMARK(BM_StringUtilsEqualsNoCase);
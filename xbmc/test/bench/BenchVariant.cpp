@@ -0,0 +1,54 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+
+#include <benchmark/benchmark.h>
+
+static void BM_VariantBuildObject(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    CVariant object(CVariant::VariantTypeObject);
+    for (int i = 0; i < 20; ++i)
+      object[StringUtils::Format("key{}", i)] = i;
+    benchmark::DoNotOptimize(object);
+  }
+}
+BENCHMARK(BM_VariantBuildObject);
+
+static void BM_VariantCopy(benchmark::State& state)
+{
+  CVariant array(CVariant::VariantTypeArray);
+  for (int i = 0; i < 100; ++i)
+  {
+    CVariant item(CVariant::VariantTypeObject);
+    item["label"] = StringUtils::Format("Item {}", i);
+    item["id"] = i;
+    array.push_back(std::move(item));
+  }
+
+  for (auto _ : state)
+  {
+    CVariant copy(array);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_VariantCopy);
+
+static void BM_VariantLookup(benchmark::State& state)
+{
+  CVariant object(CVariant::VariantTypeObject);
+  for (int i = 0; i < 20; ++i)
+    object[StringUtils::Format("key{}", i)] = i;
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(object["key17"].asInteger());
+}
+BENCHMARK(BM_VariantLookup);
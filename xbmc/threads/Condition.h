@@ -37,16 +37,20 @@ namespace XbmcThreads
     {
       int count = lock.count;
       lock.count = 0;
+      lock.EndHold(); // the wait doesn't count as holding the lock
       cond.wait(lock.get_underlying(), std::move(predicate));
       lock.count = count;
+      lock.StartHold();
     }
 
     inline void wait(CCriticalSection& lock)
     {
       int count  = lock.count;
       lock.count = 0;
+      lock.EndHold(); // the wait doesn't count as holding the lock
       cond.wait(lock.get_underlying());
       lock.count = count;
+      lock.StartHold();
     }
 
     template<typename Rep, typename Period>
@@ -56,8 +60,10 @@ namespace XbmcThreads
     {
       int count = lock.count;
       lock.count = 0;
+      lock.EndHold(); // the wait doesn't count as holding the lock
       bool ret = cond.wait_for(lock.get_underlying(), duration, predicate);
       lock.count = count;
+      lock.StartHold();
       return ret;
     }
 
@@ -66,8 +72,10 @@ namespace XbmcThreads
     {
       int count  = lock.count;
       lock.count = 0;
+      lock.EndHold(); // the wait doesn't count as holding the lock
       std::cv_status res = cond.wait_for(lock.get_underlying(), duration);
       lock.count = count;
+      lock.StartHold();
       return res == std::cv_status::no_timeout;
     }
 
@@ -0,0 +1,160 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "LockProfiler.h"
+
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(TARGET_POSIX)
+#include <dlfcn.h>
+#elif defined(TARGET_WINDOWS)
+#include <intrin.h>
+#endif
+
+using namespace XbmcThreads;
+using namespace std::chrono;
+
+namespace
+{
+constexpr auto REPORT_INTERVAL = minutes(1);
+constexpr size_t REPORT_LOCKS = 20;
+
+struct LockStats
+{
+  const void* lock{nullptr};
+  const void* waitSite{nullptr}; //!< the function with the longest wait
+  uint64_t contended{0};
+  CLockProfiler::Clock::duration waitTime{0};
+  CLockProfiler::Clock::duration maxWait{0};
+  uint64_t longHolds{0};
+  CLockProfiler::Clock::duration holdTime{0};
+  CLockProfiler::Clock::duration maxHold{0};
+};
+
+// a plain mutex, the profiler must not profile itself
+std::mutex s_section;
+std::unordered_map<const void*, LockStats> s_locks;
+CLockProfiler::Clock::time_point s_lastReport;
+
+// logging takes locks of its own, which must not be recorded while we report
+thread_local bool s_inProfiler = false;
+
+std::string GetSiteName(const void* site)
+{
+#if defined(TARGET_POSIX)
+  Dl_info info;
+  if (site && dladdr(site, &info) && info.dli_sname)
+    return StringUtils::Format("{} ({})", info.dli_sname, site);
+#endif
+  return StringUtils::Format("{}", site);
+}
+
+void ReportIfDue(CLockProfiler::Clock::time_point now, std::unique_lock<std::mutex>& lock)
+{
+  if (now - s_lastReport < REPORT_INTERVAL)
+    return;
+  s_lastReport = now;
+  lock.unlock();
+  CLockProfiler::Report();
+}
+} // unnamed namespace
+
+std::atomic<bool> CLockProfiler::m_enabled{false};
+
+void CLockProfiler::SetEnabled(bool enabled)
+{
+  if (m_enabled.exchange(enabled) == enabled)
+    return;
+
+  std::unique_lock<std::mutex> lock(s_section);
+  s_locks.clear();
+  s_lastReport = Clock::now();
+}
+
+#if defined(_MSC_VER)
+__declspec(noinline)
+#else
+__attribute__((noinline))
+#endif
+void CLockProfiler::RecordWait(const void* lock, Clock::duration wait)
+{
+  if (s_inProfiler)
+    return;
+
+  // the return address is in the function the lock call was inlined into
+#if defined(_MSC_VER)
+  const void* site = _ReturnAddress();
+#else
+  const void* site = __builtin_return_address(0);
+#endif
+
+  const auto now = Clock::now();
+  std::unique_lock<std::mutex> guard(s_section);
+  LockStats& stats = s_locks[lock];
+  stats.lock = lock;
+  stats.contended++;
+  stats.waitTime += wait;
+  if (wait >= stats.maxWait)
+  {
+    stats.maxWait = wait;
+    stats.waitSite = site;
+  }
+  ReportIfDue(now, guard);
+}
+
+void CLockProfiler::RecordHold(const void* lock, Clock::duration hold)
+{
+  if (s_inProfiler)
+    return;
+
+  const auto now = Clock::now();
+  std::unique_lock<std::mutex> guard(s_section);
+  LockStats& stats = s_locks[lock];
+  stats.lock = lock;
+  stats.longHolds++;
+  stats.holdTime += hold;
+  stats.maxHold = std::max(stats.maxHold, hold);
+  ReportIfDue(now, guard);
+}
+
+void CLockProfiler::Report()
+{
+  std::vector<LockStats> locks;
+  {
+    std::unique_lock<std::mutex> lock(s_section);
+    locks.reserve(s_locks.size());
+    for (const auto& it : s_locks)
+      locks.emplace_back(it.second);
+  }
+
+  const size_t count = std::min(locks.size(), REPORT_LOCKS);
+  std::partial_sort(locks.begin(), locks.begin() + count, locks.end(),
+                    [](const LockStats& a, const LockStats& b) { return a.waitTime > b.waitTime; });
+
+  s_inProfiler = true;
+  CLog::Log(LOGINFO, "CLockProfiler::{} - {} locks recorded, worst {}:", __FUNCTION__,
+            locks.size(), count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    const LockStats& stats = locks[i];
+    CLog::Log(LOGINFO,
+              "  lock {}: contended {} times, waited {} ms (max {} ms in {}), held long {} times "
+              "for {} ms (max {} ms)",
+              stats.lock, stats.contended, duration_cast<milliseconds>(stats.waitTime).count(),
+              duration_cast<milliseconds>(stats.maxWait).count(), GetSiteName(stats.waitSite),
+              stats.longHolds, duration_cast<milliseconds>(stats.holdTime).count(),
+              duration_cast<milliseconds>(stats.maxHold).count());
+  }
+  s_inProfiler = false;
+}
@@ -0,0 +1,49 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+namespace XbmcThreads
+{
+
+/*!
+ * \brief Records how long threads wait for and hold CCriticalSection and CSharedSection, to find
+ * the lock behind a freeze of e.g. the GUI thread.
+ *
+ * The hooks are only compiled in with the ENABLE_LOCK_PROFILING build option, and they only
+ * record after being enabled at runtime with <lockprofiling>true</lockprofiling> in
+ * advancedsettings.xml. Every contended acquisition is recorded per lock, together with the
+ * function that waited. Holds are only recorded when they exceed HOLD_THRESHOLD, so that the
+ * uncontended fast path stays cheap. The locks with the most time waited on are written to the
+ * log once a minute, and on Report().
+ */
+class CLockProfiler
+{
+public:
+  using Clock = std::chrono::steady_clock;
+  static constexpr Clock::duration HOLD_THRESHOLD = std::chrono::milliseconds(1);
+
+  static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+  static void SetEnabled(bool enabled);
+
+  static void RecordWait(const void* lock, Clock::duration wait);
+  static void RecordHold(const void* lock, Clock::duration hold);
+
+  /*!
+   * \brief Write the locks with the longest total wait time to the log
+   */
+  static void Report();
+
+private:
+  static std::atomic<bool> m_enabled;
+};
+
+} // namespace XbmcThreads
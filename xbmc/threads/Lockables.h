@@ -8,6 +8,10 @@
 
 #pragma once
 
+#if defined(HAS_LOCK_PROFILING)
+#include "threads/LockProfiler.h"
+#endif
+
 namespace XbmcThreads
 {
 
@@ -43,13 +47,64 @@ namespace XbmcThreads
     L mutex;
     unsigned int count = 0;
 
+#if defined(HAS_LOCK_PROFILING)
+    CLockProfiler::Clock::time_point acquired;
+
+    inline void StartHold()
+    {
+      if (CLockProfiler::IsEnabled())
+        acquired = CLockProfiler::Clock::now();
+    }
+
+    inline void EndHold()
+    {
+      if (acquired != CLockProfiler::Clock::time_point())
+      {
+        const auto hold = CLockProfiler::Clock::now() - acquired;
+        acquired = {};
+        if (hold >= CLockProfiler::HOLD_THRESHOLD)
+          CLockProfiler::RecordHold(this, hold);
+      }
+    }
+#else
+    inline void StartHold() {}
+    inline void EndHold() {}
+#endif
+
   public:
     inline CountingLockable() = default;
 
     // STL Lockable concept
-    inline void lock() { mutex.lock(); count++; }
-    inline bool try_lock() { return mutex.try_lock() ? count++, true : false; }
-    inline void unlock() { count--; mutex.unlock(); }
+    inline void lock()
+    {
+#if defined(HAS_LOCK_PROFILING)
+      if (CLockProfiler::IsEnabled() && !mutex.try_lock())
+      {
+        const auto start = CLockProfiler::Clock::now();
+        mutex.lock();
+        CLockProfiler::RecordWait(this, CLockProfiler::Clock::now() - start);
+      }
+      else if (!CLockProfiler::IsEnabled())
+#endif
+        mutex.lock();
+      if (++count == 1)
+        StartHold();
+    }
+    inline bool try_lock()
+    {
+      if (!mutex.try_lock())
+        return false;
+      if (++count == 1)
+        StartHold();
+      return true;
+    }
+    inline void unlock()
+    {
+      if (count == 1)
+        EndHold();
+      count--;
+      mutex.unlock();
+    }
 
     /*!
      * \brief Check if have a lock owned
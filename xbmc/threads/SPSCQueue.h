@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace XbmcThreads
+{
+
+/*!
+ * \brief Bounded lock-free single-producer/single-consumer queue.
+ *
+ * TryPush() may only be called from one thread at a time and TryPop(), Front() and ForEach()
+ * from one (possibly different) thread at a time. Callers that have more than one thread on a
+ * side must serialize that side themselves, e.g. with a lock that the other side never takes.
+ *
+ * The capacity is rounded up to a power of two.
+ */
+template<typename T>
+class CSPSCQueue
+{
+public:
+  explicit CSPSCQueue(size_t capacity = 0) { Resize(capacity); }
+
+  CSPSCQueue(const CSPSCQueue&) = delete;
+  CSPSCQueue& operator=(const CSPSCQueue&) = delete;
+
+  /*!
+   * \brief Change the capacity. Drops all queued elements, must not be called while any other
+   * thread accesses the queue.
+   */
+  void Resize(size_t capacity)
+  {
+    size_t size = 1;
+    while (size < capacity)
+      size <<= 1;
+    m_slots.clear();
+    m_slots.resize(capacity ? size : 0);
+    m_mask = size - 1;
+    m_head.store(0, std::memory_order_relaxed);
+    m_tail.store(0, std::memory_order_relaxed);
+  }
+
+  size_t Capacity() const { return m_slots.size(); }
+
+  //! \brief Producer side. Returns false if the queue is full.
+  bool TryPush(T&& value)
+  {
+    const size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) >= m_slots.size())
+      return false;
+
+    m_slots[tail & m_mask] = std::move(value);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  //! \brief Consumer side. Returns false if the queue is empty.
+  bool TryPop(T& value)
+  {
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire))
+      return false;
+
+    value = std::move(m_slots[head & m_mask]);
+    m_slots[head & m_mask] = T();
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  //! \brief Consumer side. Oldest element or nullptr if the queue is empty.
+  T* Front()
+  {
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire))
+      return nullptr;
+    return &m_slots[head & m_mask];
+  }
+
+  //! \brief Consumer side. Visit all elements from oldest to newest.
+  template<typename F>
+  void ForEach(F&& func)
+  {
+    const size_t tail = m_tail.load(std::memory_order_acquire);
+    for (size_t i = m_head.load(std::memory_order_relaxed); i != tail; ++i)
+      func(m_slots[i & m_mask]);
+  }
+
+  //! \brief Approximate number of queued elements, exact on the consumer side.
+  size_t Size() const
+  {
+    const size_t head = m_head.load(std::memory_order_acquire);
+    return m_tail.load(std::memory_order_acquire) - head;
+  }
+
+  bool Empty() const { return Size() == 0; }
+
+private:
+  std::vector<T> m_slots;
+  size_t m_mask = 0;
+  alignas(64) std::atomic<size_t> m_head{0};
+  alignas(64) std::atomic<size_t> m_tail{0};
+};
+
+} // namespace XbmcThreads
@@ -0,0 +1,118 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace XbmcThreads
+{
+
+/*!
+ * \brief Publishes a trivially copyable value to readers that never block.
+ *
+ * Writers are serialized by a lock that readers never take. A reader copies the value and retries
+ * if a write was in progress, so it always gets a consistent snapshot. The value is stored in
+ * atomic words, which keeps concurrent reads and writes free of data races.
+ *
+ * Every write increases the version, which lets readers check whether the value changed since
+ * they last looked at it.
+ */
+template<typename T>
+class CSeqLock
+{
+  static_assert(std::is_trivially_copyable_v<T>, "CSeqLock needs a trivially copyable type");
+
+public:
+  CSeqLock() { Write(m_value); }
+  explicit CSeqLock(const T& value) : m_value(value) { Write(m_value); }
+
+  CSeqLock(const CSeqLock&) = delete;
+  CSeqLock& operator=(const CSeqLock&) = delete;
+
+  //! \brief Get a consistent copy of the value. Never blocks.
+  T Load() const
+  {
+    std::array<uint64_t, WORDS> words;
+    while (true)
+    {
+      const uint64_t sequence = m_sequence.load(std::memory_order_acquire);
+      if (!(sequence & 1))
+      {
+        for (size_t i = 0; i < WORDS; ++i)
+          words[i] = m_words[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == sequence)
+          break;
+      }
+      std::this_thread::yield();
+    }
+
+    T value;
+    std::memcpy(&value, words.data(), sizeof(T));
+    return value;
+  }
+
+  void Store(const T& value)
+  {
+    std::unique_lock<CCriticalSection> lock(m_writeSection);
+    m_value = value;
+    Publish(m_value);
+  }
+
+  //! \brief Modify the value in place. Concurrent writers are serialized.
+  template<typename F>
+  void Update(F&& modify)
+  {
+    std::unique_lock<CCriticalSection> lock(m_writeSection);
+    modify(m_value);
+    Publish(m_value);
+  }
+
+  //! \brief Number of writes so far
+  uint64_t GetVersion() const { return m_sequence.load(std::memory_order_acquire) / 2; }
+
+private:
+  static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+  void Write(const T& value)
+  {
+    std::array<uint64_t, WORDS> words{};
+    std::memcpy(words.data(), &value, sizeof(T));
+
+    for (size_t i = 0; i < WORDS; ++i)
+      m_words[i].store(words[i], std::memory_order_relaxed);
+  }
+
+  void Publish(const T& value)
+  {
+    const uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Write(value);
+
+    m_sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  T m_value{}; ///< writer side copy, guarded by m_writeSection
+  CCriticalSection m_writeSection;
+  std::array<std::atomic<uint64_t>, WORDS> m_words{};
+  std::atomic<uint64_t> m_sequence{0};
+};
+
+} // namespace XbmcThreads
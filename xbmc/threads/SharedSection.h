@@ -29,6 +29,16 @@ public:
   inline void lock()
   {
     std::unique_lock<CCriticalSection> l(sec);
+#if defined(HAS_LOCK_PROFILING)
+    if (sharedCount && XbmcThreads::CLockProfiler::IsEnabled())
+    {
+      // waiting for the readers to leave
+      const auto start = XbmcThreads::CLockProfiler::Clock::now();
+      actualCv.wait(l, [this]() { return sharedCount == 0; });
+      XbmcThreads::CLockProfiler::RecordWait(this,
+                                             XbmcThreads::CLockProfiler::Clock::now() - start);
+    }
+#endif
     while (sharedCount)
       actualCv.wait(l, [this]() { return sharedCount == 0; });
     sec.lock();
@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/SPSCQueue.h"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace XbmcThreads;
+
+TEST(TestSPSCQueue, CapacityIsRoundedUp)
+{
+  CSPSCQueue<int> queue(5);
+  EXPECT_EQ(8u, queue.Capacity());
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(TestSPSCQueue, PushPopOrder)
+{
+  CSPSCQueue<int> queue(4);
+  for (int i = 0; i < 4; i++)
+    EXPECT_TRUE(queue.TryPush(int(i)));
+  EXPECT_FALSE(queue.TryPush(4));
+  EXPECT_EQ(4u, queue.Size());
+
+  ASSERT_NE(nullptr, queue.Front());
+  EXPECT_EQ(0, *queue.Front());
+
+  int sum = 0;
+  queue.ForEach([&sum](int value) { sum += value; });
+  EXPECT_EQ(6, sum);
+
+  int value;
+  for (int i = 0; i < 4; i++)
+  {
+    EXPECT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_FALSE(queue.TryPop(value));
+  EXPECT_EQ(nullptr, queue.Front());
+}
+
+TEST(TestSPSCQueue, ProducerConsumer)
+{
+  constexpr int count = 100000;
+  CSPSCQueue<int> queue(64);
+
+  std::thread producer([&queue]() {
+    for (int i = 0; i < count; i++)
+    {
+      while (!queue.TryPush(int(i)))
+        std::this_thread::yield();
+    }
+  });
+
+  int expected = 0;
+  while (expected < count)
+  {
+    int value;
+    if (queue.TryPop(value))
+    {
+      ASSERT_EQ(expected, value);
+      expected++;
+    }
+    else
+      std::this_thread::yield();
+  }
+
+  producer.join();
+  EXPECT_TRUE(queue.Empty());
+}
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/SeqLock.h"
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace XbmcThreads;
+
+namespace
+{
+struct Pair
+{
+  int64_t first = 0;
+  int64_t second = 0;
+  bool flag = false;
+};
+} // unnamed namespace
+
+TEST(TestSeqLock, StoreLoad)
+{
+  CSeqLock<Pair> lock;
+  EXPECT_EQ(0, lock.Load().first);
+  EXPECT_EQ(0u, lock.GetVersion());
+
+  lock.Store({1, 2, true});
+  Pair value = lock.Load();
+  EXPECT_EQ(1, value.first);
+  EXPECT_EQ(2, value.second);
+  EXPECT_TRUE(value.flag);
+  EXPECT_EQ(1u, lock.GetVersion());
+
+  lock.Update([](Pair& pair) { pair.second = 5; });
+  value = lock.Load();
+  EXPECT_EQ(1, value.first);
+  EXPECT_EQ(5, value.second);
+  EXPECT_EQ(2u, lock.GetVersion());
+}
+
+TEST(TestSeqLock, ConsistentSnapshots)
+{
+  constexpr int64_t count = 100000;
+  CSeqLock<Pair> lock;
+  std::atomic<bool> done{false};
+
+  std::thread writer([&lock, &done]() {
+    for (int64_t i = 1; i <= count; i++)
+      lock.Store({i, -i, (i & 1) != 0});
+    done = true;
+  });
+
+  int64_t last = 0;
+  while (!done)
+  {
+    const Pair value = lock.Load();
+    ASSERT_EQ(value.first, -value.second);
+    ASSERT_EQ((value.first & 1) != 0, value.flag);
+    ASSERT_GE(value.first, last);
+    last = value.first;
+  }
+
+  writer.join();
+  EXPECT_EQ(count, lock.Load().first);
+}
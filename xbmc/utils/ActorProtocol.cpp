@@ -15,6 +15,40 @@
 
 using namespace Actor;
 
+namespace
+{
+// larger buffers are freed when a message is returned, payloads this big are rare
+constexpr size_t MAX_KEPT_BUFFER_SIZE = 64 * 1024;
+} // unnamed namespace
+
+Message::~Message() = default;
+
+void Message::SetData(const void* data, size_t size)
+{
+  if (size > sizeof(buffer))
+  {
+    if (heapBufferSize < size)
+    {
+      heapBuffer.reset(new uint8_t[size]);
+      heapBufferSize = size;
+    }
+    this->data = heapBuffer.get();
+  }
+  else
+    this->data = buffer;
+  memcpy(this->data, data, size);
+  payloadSize = size;
+}
+
+void Message::SetSync()
+{
+  isSync = true;
+  if (!syncEvent)
+    syncEvent = std::make_unique<CEvent>();
+  syncEvent->Reset();
+  event = syncEvent.get();
+}
+
 void Message::Release()
 {
   bool skip;
@@ -26,15 +60,14 @@ void Message::Release()
   if (skip)
     return;
 
-  // free data buffer
-  if (data != buffer)
-    delete [] data;
+  if (heapBufferSize > MAX_KEPT_BUFFER_SIZE)
+  {
+    heapBuffer.reset();
+    heapBufferSize = 0;
+  }
 
   payloadObj.reset();
 
-  // delete event in case of sync message
-  delete event;
-
   origin.ReturnMessage(this);
 }
 
@@ -57,13 +90,7 @@ bool Message::Reply(int sig, void *data /* = NULL*/, size_t size /* = 0 */)
     msg->isOut = !isOut;
     replyMessage = msg;
     if (data)
-    {
-      if (size > sizeof(msg->buffer))
-        msg->data = new uint8_t[size];
-      else
-        msg->data = msg->buffer;
-      memcpy(msg->data, data, size);
-    }
+      msg->SetData(data, size);
   }
 
   origin.Unlock();
@@ -76,14 +103,9 @@ bool Message::Reply(int sig, void *data /* = NULL*/, size_t size /* = 0 */)
 
 Protocol::~Protocol()
 {
-  Message *msg;
   Purge();
-  while (!freeMessageQueue.empty())
-  {
-    msg = freeMessageQueue.front();
-    freeMessageQueue.pop();
+  for (Message* msg : freeMessages)
     delete msg;
-  }
 }
 
 Message *Protocol::GetMessage()
@@ -92,10 +114,11 @@ Message *Protocol::GetMessage()
 
   std::unique_lock<CCriticalSection> lock(criticalSection);
 
-  if (!freeMessageQueue.empty())
+  // the most recently returned message is the one most likely still in the cache
+  if (!freeMessages.empty())
   {
-    msg = freeMessageQueue.front();
-    freeMessageQueue.pop();
+    msg = freeMessages.back();
+    freeMessages.pop_back();
   }
   else
     msg = new Message(*this);
@@ -115,7 +138,7 @@ void Protocol::ReturnMessage(Message *msg)
 {
   std::unique_lock<CCriticalSection> lock(criticalSection);
 
-  freeMessageQueue.push(msg);
+  freeMessages.push_back(msg);
 }
 
 bool Protocol::SendOutMessage(int signal,
@@ -133,13 +156,7 @@ bool Protocol::SendOutMessage(int signal,
   msg->isOut = true;
 
   if (data)
-  {
-    if (size > sizeof(msg->buffer))
-      msg->data = new uint8_t[size];
-    else
-      msg->data = msg->buffer;
-    memcpy(msg->data, data, size);
-  }
+    msg->SetData(data, size);
 
   {
     std::unique_lock<CCriticalSection> lock(criticalSection);
@@ -189,13 +206,7 @@ bool Protocol::SendInMessage(int signal,
   msg->isOut = false;
 
   if (data)
-  {
-    if (size > sizeof(msg->data))
-      msg->data = new uint8_t[size];
-    else
-      msg->data = msg->buffer;
-    memcpy(msg->data, data, size);
-  }
+    msg->SetData(data, size);
 
   {
     std::unique_lock<CCriticalSection> lock(criticalSection);
@@ -238,9 +249,7 @@ bool Protocol::SendOutMessageSync(int signal,
 {
   Message *msg = GetMessage();
   msg->isOut = true;
-  msg->isSync = true;
-  msg->event = new CEvent;
-  msg->event->Reset();
+  msg->SetSync();
   SendOutMessage(signal, data, size, msg);
 
   if (!msg->event->Wait(timeout))
@@ -272,9 +281,7 @@ bool Protocol::SendOutMessageSync(int signal,
 {
   Message *msg = GetMessage();
   msg->isOut = true;
-  msg->isSync = true;
-  msg->event = new CEvent;
-  msg->event->Reset();
+  msg->SetSync();
   SendOutMessage(signal, payload, msg);
 
   if (!msg->event->Wait(timeout))
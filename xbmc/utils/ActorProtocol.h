@@ -15,6 +15,7 @@
 #include <queue>
 #include <string>
 #include <utility>
+#include <vector>
 
 class CEvent;
 
@@ -68,6 +69,16 @@ public:
 private:
   explicit Message(Protocol &_origin) noexcept
     :origin(_origin) {}
+  ~Message();
+
+  void SetData(const void* data, size_t size);
+  void SetSync();
+
+  // kept while the message is in the free list, so that neither larger payloads nor sync messages
+  // allocate once the protocol runs
+  std::unique_ptr<uint8_t[]> heapBuffer;
+  size_t heapBufferSize = 0;
+  std::unique_ptr<CEvent> syncEvent;
 };
 
 class Protocol
@@ -116,7 +127,7 @@ protected:
   CCriticalSection criticalSection;
   std::queue<Message*> outMessages;
   std::queue<Message*> inMessages;
-  std::queue<Message*> freeMessageQueue;
+  std::vector<Message*> freeMessages;
   bool inDefered = false, outDefered = false;
 };
 
@@ -0,0 +1,115 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AhoCorasick.h"
+
+#include <algorithm>
+#include <deque>
+
+namespace
+{
+constexpr size_t NO_STATE = static_cast<size_t>(-1);
+} // unnamed namespace
+
+unsigned char CAhoCorasick::Fold(char c)
+{
+  const auto byte = static_cast<unsigned char>(c);
+  return (byte >= 'A' && byte <= 'Z') ? byte + ('a' - 'A') : byte;
+}
+
+size_t CAhoCorasick::Transition(size_t state, unsigned char c) const
+{
+  const auto& next = m_nodes[state].next;
+  const auto it = std::lower_bound(next.begin(), next.end(), c,
+                                   [](const auto& edge, unsigned char b) { return edge.first < b; });
+  return (it != next.end() && it->first == c) ? it->second : NO_STATE;
+}
+
+size_t CAhoCorasick::Next(size_t state, unsigned char c) const
+{
+  while (true)
+  {
+    const size_t next = Transition(state, c);
+    if (next != NO_STATE)
+      return next;
+    if (state == 0)
+      return 0;
+    state = m_nodes[state].fail;
+  }
+}
+
+size_t CAhoCorasick::AddKeyword(const std::string& keyword)
+{
+  size_t state = 0;
+  for (const char c : keyword)
+  {
+    const unsigned char b = Fold(c);
+    size_t next = Transition(state, b);
+    if (next == NO_STATE)
+    {
+      next = m_nodes.size();
+      m_nodes.emplace_back();
+      auto& edges = m_nodes[state].next;
+      edges.insert(std::lower_bound(edges.begin(), edges.end(), std::make_pair(b, size_t{0})),
+                   {b, next});
+    }
+    state = next;
+  }
+
+  m_nodes[state].keywords.emplace_back(m_keywordCount);
+  return m_keywordCount++;
+}
+
+void CAhoCorasick::Build()
+{
+  // breadth first, so the fail state of a node is complete before the node is visited
+  std::deque<size_t> queue;
+  for (const auto& edge : m_nodes[0].next)
+  {
+    m_nodes[edge.second].fail = 0;
+    queue.emplace_back(edge.second);
+  }
+
+  while (!queue.empty())
+  {
+    const size_t state = queue.front();
+    queue.pop_front();
+
+    for (const auto& [c, next] : m_nodes[state].next)
+    {
+      const size_t fail = Next(m_nodes[state].fail, c);
+      m_nodes[next].fail = fail;
+
+      // keywords ending in the root (empty ones) are reported once per text, not per state
+      if (fail != 0)
+      {
+        const std::vector<size_t>& inherited = m_nodes[fail].keywords;
+        m_nodes[next].keywords.insert(m_nodes[next].keywords.end(), inherited.begin(),
+                                      inherited.end());
+      }
+      queue.emplace_back(next);
+    }
+  }
+}
+
+void CAhoCorasick::Find(const std::string& text, std::vector<bool>& found) const
+{
+  if (found.size() < m_keywordCount)
+    found.resize(m_keywordCount, false);
+
+  for (const size_t keyword : m_nodes[0].keywords)
+    found[keyword] = true;
+
+  size_t state = 0;
+  for (const char c : text)
+  {
+    state = Next(state, Fold(c));
+    for (const size_t keyword : m_nodes[state].keywords)
+      found[keyword] = true;
+  }
+}
@@ -0,0 +1,61 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Finds which of a set of keywords occur in a text, in a single pass over the text.
+ *
+ * Keywords are matched ignoring the case of ASCII letters, other bytes have to match exactly. The
+ * automaton is compiled once by Build() after all keywords were added, the time to search a text
+ * then only depends on the length of the text and the number of matches, not on the number of
+ * keywords.
+ */
+class CAhoCorasick
+{
+public:
+  /*!
+   * \brief Add a keyword. An empty keyword occurs in every text.
+   * \return the index of the keyword, used to report matches
+   */
+  size_t AddKeyword(const std::string& keyword);
+
+  /*!
+   * \brief Compile the automaton. Has to be called after adding keywords and before searching.
+   */
+  void Build();
+
+  /*!
+   * \brief Mark the keywords occurring in a text.
+   * \param text the text to search
+   * \param[in,out] found flags indexed by keyword, set for every keyword found. Flags already set
+   * are kept, so several texts can be searched for the same keywords.
+   */
+  void Find(const std::string& text, std::vector<bool>& found) const;
+
+  size_t GetKeywordCount() const { return m_keywordCount; }
+
+private:
+  struct Node
+  {
+    std::vector<std::pair<unsigned char, size_t>> next; ///< transitions, sorted by byte
+    size_t fail = 0; ///< state of the longest proper suffix that is a keyword prefix
+    std::vector<size_t> keywords; ///< keywords ending here, including those of the fail states
+  };
+
+  static unsigned char Fold(char c);
+  size_t Next(size_t state, unsigned char c) const;
+  size_t Transition(size_t state, unsigned char c) const;
+
+  std::vector<Node> m_nodes{Node{}};
+  size_t m_keywordCount = 0;
+};
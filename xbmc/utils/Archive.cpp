@@ -36,7 +36,6 @@ CArchive::CArchive(CFile* pFile, int mode)
   m_pFile = pFile;
   m_iMode = mode;
 
-  memset(m_pBuffer.get(), 0, CARCHIVE_BUFFER_MAX);
   if (mode == load)
   {
     m_BufferPos = m_pBuffer.get() + CARCHIVE_BUFFER_MAX;
@@ -243,9 +242,9 @@ CArchive& CArchive::operator>>(std::string& str)
   if (iLength > MAX_STRING_SIZE)
     throw std::out_of_range("String too large, over 100MB");
 
-  auto s = std::unique_ptr<char[]>(new char[iLength]);
-  streamin(s.get(), iLength * sizeof(char));
-  str.assign(s.get(), iLength);
+  // read straight into the string, without a temporary buffer and a second copy
+  str.resize(iLength);
+  streamin(str.data(), iLength * sizeof(char));
 
   return *this;
 }
@@ -258,9 +257,8 @@ CArchive& CArchive::operator>>(std::wstring& wstr)
   if (iLength > MAX_STRING_SIZE)
     throw std::out_of_range("String too large, over 100MB");
 
-  auto p = std::unique_ptr<wchar_t[]>(new wchar_t[iLength]);
-  streamin(p.get(), iLength * sizeof(wchar_t));
-  wstr.assign(p.get(), iLength);
+  wstr.resize(iLength);
+  streamin(wstr.data(), iLength * sizeof(wchar_t));
 
   return *this;
 }
@@ -367,6 +365,8 @@ CArchive& CArchive::operator>>(std::vector<std::string>& strArray)
   uint32_t size;
   *this >> size;
   strArray.clear();
+  // the size comes from the file, don't trust it for more than a small reservation
+  strArray.reserve(std::min<uint32_t>(size, 1024));
   for (uint32_t index = 0; index < size; index++)
   {
     std::string str;
@@ -13,7 +13,8 @@
 #include <string>
 #include <vector>
 
-#define CARCHIVE_BUFFER_MAX 4096
+// large enough that directory caches of big libraries are read and written in few file calls
+#define CARCHIVE_BUFFER_MAX 65536
 
 namespace XFILE
 {
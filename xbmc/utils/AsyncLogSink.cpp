@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AsyncLogSink.h"
+
+#include <string>
+
+CAsyncLogSink::CAsyncLogSink(std::shared_ptr<spdlog::sinks::sink> target,
+                             size_t capacity,
+                             OverflowPolicy policy)
+  : m_target(std::move(target)), m_policy(policy), m_ring(capacity)
+{
+  m_thread = std::thread(&CAsyncLogSink::Process, this);
+}
+
+CAsyncLogSink::~CAsyncLogSink()
+{
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_dataAvailable.notify_one();
+  m_thread.join();
+}
+
+void CAsyncLogSink::log(const spdlog::details::log_msg& msg)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (m_count == m_ring.size())
+  {
+    if (m_policy == OverflowPolicy::DROP)
+    {
+      m_dropped++;
+      return;
+    }
+    m_spaceAvailable.wait(lock, [this]() { return m_count < m_ring.size() || m_stop; });
+    if (m_stop)
+      return;
+  }
+
+  // the strings of the ring keep their memory, so copying doesn't allocate once warmed up
+  Record& record = m_ring[(m_head + m_count) % m_ring.size()];
+  record.loggerName.assign(msg.logger_name.data(), msg.logger_name.size());
+  record.payload.assign(msg.payload.data(), msg.payload.size());
+  record.level = msg.level;
+  record.time = msg.time;
+  record.threadId = msg.thread_id;
+  record.source = msg.source;
+  m_count++;
+  lock.unlock();
+  m_dataAvailable.notify_one();
+}
+
+void CAsyncLogSink::flush()
+{
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_flush = true;
+  }
+  m_dataAvailable.notify_one();
+}
+
+void CAsyncLogSink::set_pattern(const std::string& pattern)
+{
+  std::unique_lock<std::mutex> lock(m_targetMutex);
+  m_target->set_pattern(pattern);
+}
+
+void CAsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter)
+{
+  std::unique_lock<std::mutex> lock(m_targetMutex);
+  m_target->set_formatter(std::move(sinkFormatter));
+}
+
+uint64_t CAsyncLogSink::GetDroppedCount() const
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  return m_dropped;
+}
+
+void CAsyncLogSink::Process()
+{
+  Record record;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true)
+  {
+    m_dataAvailable.wait(lock, [this]() { return m_count > 0 || m_flush || m_stop; });
+
+    // everything queued is written before stopping
+    if (m_count == 0 && m_stop)
+      break;
+
+    const uint64_t dropped = m_dropped - m_droppedReported;
+    m_droppedReported = m_dropped;
+    const bool flush = m_flush && m_count <= 1;
+    if (flush)
+      m_flush = false;
+
+    bool haveMessage = false;
+    if (m_count > 0)
+    {
+      std::swap(record, m_ring[m_head]);
+      m_head = (m_head + 1) % m_ring.size();
+      m_count--;
+      haveMessage = true;
+    }
+    lock.unlock();
+    m_spaceAvailable.notify_one();
+
+    {
+      std::unique_lock<std::mutex> targetLock(m_targetMutex);
+      if (dropped > 0)
+      {
+        const std::string text = std::to_string(dropped) + " log messages dropped, the log is " +
+                                 "written slower than messages come in";
+        m_target->log(spdlog::details::log_msg(record.loggerName, spdlog::level::warn, text));
+      }
+      if (haveMessage)
+      {
+        spdlog::details::log_msg msg(record.time, record.source, record.loggerName, record.level,
+                                     record.payload);
+        msg.thread_id = record.threadId;
+        m_target->log(msg);
+      }
+      if (flush)
+        m_target->flush();
+    }
+
+    lock.lock();
+  }
+
+  std::unique_lock<std::mutex> targetLock(m_targetMutex);
+  m_target->flush();
+}
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <spdlog/sinks/sink.h>
+
+/*!
+ * \brief Sink that hands log messages to a background thread, which writes them to another sink.
+ *
+ * Logging threads only copy the message into a ring buffer of fixed size, so that e.g. the video
+ * player or the audio engine don't wait for the log file while debug logging is on. When the
+ * buffer is full, messages are either dropped and the number of dropped messages is logged once
+ * there is room again, or the logging thread waits for the writer.
+ */
+class CAsyncLogSink : public spdlog::sinks::sink
+{
+public:
+  enum class OverflowPolicy
+  {
+    DROP,
+    BLOCK,
+  };
+
+  CAsyncLogSink(std::shared_ptr<spdlog::sinks::sink> target,
+                size_t capacity,
+                OverflowPolicy policy);
+  ~CAsyncLogSink() override;
+
+  void log(const spdlog::details::log_msg& msg) override;
+
+  /*!
+   * \brief Request a flush of the target sink once the queued messages are written, doesn't wait
+   */
+  void flush() override;
+
+  void set_pattern(const std::string& pattern) override;
+  void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override;
+
+  const std::shared_ptr<spdlog::sinks::sink>& GetTarget() const { return m_target; }
+  uint64_t GetDroppedCount() const;
+
+private:
+  struct Record
+  {
+    std::string loggerName;
+    std::string payload;
+    spdlog::level::level_enum level{spdlog::level::info};
+    spdlog::log_clock::time_point time;
+    size_t threadId{0};
+    spdlog::source_loc source;
+  };
+
+  void Process();
+
+  std::shared_ptr<spdlog::sinks::sink> m_target;
+  std::mutex m_targetMutex;
+  const OverflowPolicy m_policy;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_dataAvailable;
+  std::condition_variable m_spaceAvailable;
+  std::vector<Record> m_ring;
+  size_t m_head{0};
+  size_t m_count{0};
+  uint64_t m_dropped{0};
+  uint64_t m_droppedReported{0};
+  bool m_flush{false};
+  bool m_stop{false};
+
+  std::thread m_thread;
+};
@@ -211,43 +211,29 @@ static int nal_bs_read_se(nal_bitstream *bs)
 
 static const uint8_t* avc_find_startcode_internal(const uint8_t *p, const uint8_t *end)
 {
-  const uint8_t *a = p + 4 - ((intptr_t)p & 3);
-
-  for (end -= 3; p < a && p < end; p++)
+  // a start code needs two zero bytes, so only words containing a zero byte are looked at more
+  // closely. Words are loaded with memcpy, which needs no alignment and compiles to a single load.
+  for (; end - p >= 10; p += 8)
   {
-    if (p[0] == 0 && p[1] == 0 && p[2] == 1)
-      return p;
-  }
+    uint64_t x;
+    memcpy(&x, p, sizeof(x));
+    if (!((x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL))
+      continue;
 
-  for (end -= 3; p < end; p += 4)
-  {
-    uint32_t x = *(const uint32_t*)p;
-    if ((x - 0x01010101) & (~x) & 0x80808080) // generic
+    for (int i = 0; i < 8; i++)
     {
-      if (p[1] == 0)
-      {
-        if (p[0] == 0 && p[2] == 1)
-          return p;
-        if (p[2] == 0 && p[3] == 1)
-          return p+1;
-      }
-      if (p[3] == 0)
-      {
-        if (p[2] == 0 && p[4] == 1)
-          return p+2;
-        if (p[4] == 0 && p[5] == 1)
-          return p+3;
-      }
+      if (p[i] == 0 && p[i + 1] == 0 && p[i + 2] == 1)
+        return p + i;
     }
   }
 
-  for (end += 3; p < end; p++)
+  for (; end - p >= 3; p++)
   {
     if (p[0] == 0 && p[1] == 0 && p[2] == 1)
       return p;
   }
 
-  return end + 3;
+  return end;
 }
 
 static const uint8_t* avc_find_startcode(const uint8_t *p, const uint8_t *end)
@@ -473,6 +459,8 @@ CBitstreamConverter::CBitstreamConverter(CDVDStreamInfo& hints)
   m_convert_bitstream = false;
   m_convertBuffer     = NULL;
   m_convertSize       = 0;
+  m_convertCapacity   = 0;
+  m_converted         = false;
   m_inputBuffer       = NULL;
   m_inputSize         = 0;
   m_to_annexb = false;
@@ -657,6 +645,8 @@ void CBitstreamConverter::Close(void)
   if (m_convertBuffer)
     av_free(m_convertBuffer), m_convertBuffer = NULL;
   m_convertSize = 0;
+  m_convertCapacity = 0;
+  m_converted = false;
 
   m_extraData = {};
 
@@ -671,13 +661,9 @@ void CBitstreamConverter::Close(void)
 
 bool CBitstreamConverter::Convert(uint8_t *pData, int iSize, double pts)
 {
-  if (m_convertBuffer)
-  {
-    av_free(m_convertBuffer);
-    m_convertBuffer = NULL;
-  }
   m_inputSize = 0;
   m_convertSize = 0;
+  m_converted = false;
   m_inputBuffer = NULL;
 
   if (pData)
@@ -693,20 +679,14 @@ bool CBitstreamConverter::Convert(uint8_t *pData, int iSize, double pts)
         if (m_convert_bitstream)
         {
           // convert demuxer packet from bitstream to bytestream (AnnexB)
-          int bytestream_size = 0;
-          uint8_t *bytestream_buff = NULL;
-
-          BitstreamConvert(demuxer_content, demuxer_bytes, &bytestream_buff, &bytestream_size, pts);
-          if (bytestream_buff && (bytestream_size > 0))
+          if (BitstreamConvert(demuxer_content, demuxer_bytes, pts) && m_convertSize > 0)
           {
-            m_convertSize   = bytestream_size;
-            m_convertBuffer = bytestream_buff;
+            m_converted = true;
             return true;
           }
           else
           {
             m_convertSize = 0;
-            m_convertBuffer = NULL;
             CLog::Log(LOGERROR, "CBitstreamConverter::Convert: error converting.");
             return false;
           }
@@ -725,50 +705,50 @@ bool CBitstreamConverter::Convert(uint8_t *pData, int iSize, double pts)
 
         if (m_convert_bytestream)
         {
-          if(m_convertBuffer)
+          // convert demuxer packet from bytestream (AnnexB) to bitstream
+          const uint8_t *end = pData + iSize;
+          const uint8_t *nal_start = avc_find_startcode(pData, end);
+          for (;;)
           {
-            av_free(m_convertBuffer);
-            m_convertBuffer = NULL;
-          }
-          m_convertSize = 0;
+            while (nal_start < end && !*(nal_start++));
+            if (nal_start == end)
+              break;
 
-          // convert demuxer packet from bytestream (AnnexB) to bitstream
-          AVIOContext *pb;
+            const uint8_t *nal_end = avc_find_startcode(nal_start, end);
+            const uint32_t nal_size = nal_end - nal_start;
+            if (!ReserveConvertBuffer(m_convertSize + 4 + nal_size))
+              return false;
 
-          if(avio_open_dyn_buf(&pb) < 0)
-          {
-            return false;
+            BS_WB32(m_convertBuffer + m_convertSize, nal_size);
+            memcpy(m_convertBuffer + m_convertSize + 4, nal_start, nal_size);
+            m_convertSize += 4 + nal_size;
+            nal_start = nal_end;
           }
-          m_convertSize = avc_parse_nal_units(pb, pData, iSize);
-          m_convertSize = avio_close_dyn_buf(pb, &m_convertBuffer);
+          m_converted = true;
         }
         else if (m_convert_3byteTo4byteNALSize)
         {
-          if(m_convertBuffer)
-          {
-            av_free(m_convertBuffer);
-            m_convertBuffer = NULL;
-          }
-          m_convertSize = 0;
-
-          // convert demuxer packet from 3 byte NAL sizes to 4 byte
-          AVIOContext *pb;
-          if (avio_open_dyn_buf(&pb) < 0)
+          // convert demuxer packet from 3 byte NAL sizes to 4 byte, which adds at most one byte
+          // per three input bytes
+          if (!ReserveConvertBuffer(iSize + iSize / 3 + 1))
             return false;
 
           uint32_t nal_size;
           uint8_t *end = pData + iSize;
           uint8_t *nal_start = pData;
-          while (nal_start < end)
+          while (end - nal_start >= 3)
           {
             nal_size = BS_RB24(nal_start);
-            avio_wb32(pb, nal_size);
             nal_start += 3;
-            avio_write(pb, nal_start, nal_size);
+            if (nal_size > static_cast<uint32_t>(end - nal_start))
+              break;
+
+            BS_WB32(m_convertBuffer + m_convertSize, nal_size);
+            memcpy(m_convertBuffer + m_convertSize + 4, nal_start, nal_size);
+            m_convertSize += 4 + nal_size;
             nal_start += nal_size;
           }
-
-          m_convertSize = avio_close_dyn_buf(pb, &m_convertBuffer);
+          m_converted = true;
         }
         return true;
       }
@@ -780,18 +760,14 @@ bool CBitstreamConverter::Convert(uint8_t *pData, int iSize, double pts)
 
 bool CBitstreamConverter::Convert(uint8_t *pData_bl, int iSize_bl, uint8_t *pData_el, int iSize_el, double pts)
 {
-  if (m_convertBuffer)
-  {
-    av_free(m_convertBuffer);
-    m_convertBuffer = NULL;
-  }
   m_inputSize = 0;
   m_convertSize = 0;
+  m_converted = false;
   m_inputBuffer = NULL;
 
   if (pData_bl && pData_el)
   {
-    uint32_t offset = 0, size_eos;
+    uint32_t size_eos;
     uint8_t *buf=NULL, *end, *start, *buf_eos=NULL;
 
     uint32_t bl_frame_nal_buf_size = iSize_bl;
@@ -827,7 +803,7 @@ bool CBitstreamConverter::Convert(uint8_t *pData_bl, int iSize_bl, uint8_t *pDat
       switch (nal_type) {
 
         case HEVC_NAL_SEI_PREFIX:
-          ProcessSeiPrefixWrap(buf, size, &m_convertBuffer, offset, hdr10plus_meta, convert_hdr10plus_meta); 
+          ProcessSeiPrefix(buf, size, hdr10plus_meta, convert_hdr10plus_meta);
           break;
 
         case AVC_NAL_END_SEQUENCE: 
@@ -836,7 +812,7 @@ bool CBitstreamConverter::Convert(uint8_t *pData_bl, int iSize_bl, uint8_t *pDat
           break;
 
         default:
-          BitstreamAllocAndCopy(&m_convertBuffer, &offset, buf, size, nal_type);
+          BitstreamAllocAndCopy(buf, size, nal_type);
           break;        
       }
       
@@ -865,12 +841,12 @@ bool CBitstreamConverter::Convert(uint8_t *pData_bl, int iSize_bl, uint8_t *pDat
   
         case HEVC_NAL_UNSPEC62: // DoVi RPU
           if (!m_removeDovi && !convert_hdr10plus_meta)
-            ProcessDoViRpuWrap(buf, size, &m_convertBuffer, offset, pts);
+            ProcessDoViRpu(buf, size, pts);
           break;
 
         default: // Package other data into HEVC_NAL_UNSPEC63 DoVi EL
           if (!m_removeDovi && !convert_hdr10plus_meta && (m_convert_dovi == DOVIMode::MODE_NONE))
-            BitstreamAllocAndCopy(&m_convertBuffer, &offset, buf, size, HEVC_NAL_UNSPEC63);
+            BitstreamAllocAndCopy(buf, size, HEVC_NAL_UNSPEC63);
           break;
       }
 
@@ -884,16 +860,16 @@ bool CBitstreamConverter::Convert(uint8_t *pData_bl, int iSize_bl, uint8_t *pDat
 
     // If converting hdr10plus - add the DoVi RPU as the last NALU in the access unit.
     if (convert_hdr10plus_meta)
-      AddDoViRpuNaluWrap(hdr10plus_meta, &m_convertBuffer, offset, pts);
+      AddDoViRpuNalu(hdr10plus_meta, pts);
 
     // append end of sequence if exist
     if (buf_eos)
-      BitstreamAllocAndCopy(&m_convertBuffer, &offset, buf_eos, size_eos, AVC_NAL_END_SEQUENCE);
+      BitstreamAllocAndCopy(buf_eos, size_eos, AVC_NAL_END_SEQUENCE);
 
     if (!m_convert_bitstream)
       av_free(start);
 
-    m_convertSize = offset;
+    m_converted = true;
     m_combine = true;
   }
 
@@ -903,7 +879,7 @@ bool CBitstreamConverter::Convert(uint8_t *pData_bl, int iSize_bl, uint8_t *pDat
 
 uint8_t *CBitstreamConverter::GetConvertBuffer() const
 {
-  if((m_convert_bitstream || m_convert_bytestream || m_convert_3byteTo4byteNALSize || m_combine) && m_convertBuffer != NULL)
+  if((m_convert_bitstream || m_convert_bytestream || m_convert_3byteTo4byteNALSize || m_combine) && m_converted)
     return m_convertBuffer;
   else
     return m_inputBuffer;
@@ -911,7 +887,7 @@ uint8_t *CBitstreamConverter::GetConvertBuffer() const
 
 int CBitstreamConverter::GetConvertSize() const
 {
-  if((m_convert_bitstream || m_convert_bytestream || m_convert_3byteTo4byteNALSize || m_combine) && m_convertBuffer != NULL)
+  if((m_convert_bitstream || m_convert_bytestream || m_convert_3byteTo4byteNALSize || m_combine) && m_converted)
     return m_convertSize;
   else
     return m_inputSize;
@@ -1215,14 +1191,7 @@ void CBitstreamConverter::UpdateHdrStaticMetadata() {
   m_dataCacheCore.SetVideoHDRStaticMetadataInfo(hdrStaticMetadataInfo);
 }
 
-void CBitstreamConverter::AddDoViRpuNaluWrap(const Hdr10PlusMetadata& meta, uint8_t **poutbuf, uint32_t& poutbuf_size, double pts) {
-  
-  int int_poutbuf_size = poutbuf_size;
-  AddDoViRpuNalu(meta, poutbuf, &int_poutbuf_size, pts);
-  poutbuf_size = static_cast<uint32_t>(int_poutbuf_size);
-}
-
-void CBitstreamConverter::AddDoViRpuNalu(const Hdr10PlusMetadata& meta, uint8_t **poutbuf, int *poutbuf_size, double pts) {
+void CBitstreamConverter::AddDoViRpuNalu(const Hdr10PlusMetadata& meta, double pts) {
 
   auto nalu = create_rpu_nalu_for_hdr10plus(
     meta,
@@ -1247,23 +1216,17 @@ void CBitstreamConverter::AddDoViRpuNalu(const Hdr10PlusMetadata& meta, uint8_t
     get_dovi_rpu_info(nalu.data(), nalu.size(), m_first_frame, m_hints.dovi_el_type, m_hints.dovi, pts, m_dataCacheCore);
 #endif
 
-    BitstreamAllocAndCopy(poutbuf, poutbuf_size, NULL, 0, nalu.data(), nalu.size(), HEVC_NAL_UNSPEC62);
+    BitstreamAllocAndCopy(NULL, 0, nalu.data(), nalu.size(), HEVC_NAL_UNSPEC62);
     nalu.clear();
   }
 }
 
-void CBitstreamConverter::ProcessSeiPrefixWrap(uint8_t *buf, int32_t nal_size, uint8_t **poutbuf, uint32_t& poutbuf_size, Hdr10PlusMetadata& meta, bool& convert_hdr10plus_meta) {
-  
-  int int_poutbuf_size = poutbuf_size;
-  ProcessSeiPrefix(buf, nal_size, poutbuf, &int_poutbuf_size, meta, convert_hdr10plus_meta);
-  poutbuf_size = static_cast<uint32_t>(int_poutbuf_size);
-}
-
-void CBitstreamConverter::ProcessSeiPrefix(uint8_t *buf, int32_t nal_size, uint8_t **poutbuf, int *poutbuf_size, Hdr10PlusMetadata& meta, bool& convert_hdr10plus_meta) {
+void CBitstreamConverter::ProcessSeiPrefix(uint8_t *buf, int32_t nal_size, Hdr10PlusMetadata& meta, bool& convert_hdr10plus_meta) {
 
   bool copy = true;
 
-  std::vector<uint8_t> clearBuf;
+  // the cleared payload is parsed once and reused for all extractions and the HDR10+ removal
+  std::vector<uint8_t>& clearBuf = m_seiBuffer;
   auto messages = CHevcSei::ParseSeiRbspUnclearedEmulation(buf, nal_size, clearBuf);
 
   bool updateMetadata = false;
@@ -1300,27 +1263,17 @@ void CBitstreamConverter::ProcessSeiPrefix(uint8_t *buf, int32_t nal_size, uint8
 
     if (convert || m_removeHdr10Plus) {
       // Remove and carry forward remaining sei in nalu.
-      auto nalu = CHevcSei::RemoveHdr10PlusFromSeiNalu(buf, nal_size);
-      if (!nalu.empty())
-      {
-        BitstreamAllocAndCopy(poutbuf, poutbuf_size, NULL, 0, nalu.data(), nalu.size(), HEVC_NAL_SEI_PREFIX);
-        nalu.clear();
-      }
+      CHevcSei::RemoveHdr10PlusFromSeiNalu(messages, clearBuf);
+      if (!clearBuf.empty())
+        BitstreamAllocAndCopy(NULL, 0, clearBuf.data(), clearBuf.size(), HEVC_NAL_SEI_PREFIX);
       copy = false;
     }
   }
 
-  if (copy) BitstreamAllocAndCopy(poutbuf, poutbuf_size, NULL, 0, buf, nal_size, HEVC_NAL_SEI_PREFIX);   
-}
-
-void CBitstreamConverter::ProcessDoViRpuWrap(uint8_t *nal_buf, int32_t nal_size, uint8_t **poutbuf, uint32_t& poutbuf_size, double pts) {
-  
-  int int_poutbuf_size = poutbuf_size;
-  ProcessDoViRpu(nal_buf, nal_size, poutbuf, &int_poutbuf_size, pts);
-  poutbuf_size = static_cast<uint32_t>(int_poutbuf_size);
+  if (copy) BitstreamAllocAndCopy(NULL, 0, buf, nal_size, HEVC_NAL_SEI_PREFIX);   
 }
 
-void CBitstreamConverter::ProcessDoViRpu(uint8_t *nal_buf, int32_t nal_size, uint8_t **poutbuf, int *poutbuf_size, double pts) {
+void CBitstreamConverter::ProcessDoViRpu(uint8_t *nal_buf, int32_t nal_size, double pts) {
 
 #ifdef HAVE_LIBDOVI
   const DoviData* rpu_data = NULL;
@@ -1351,14 +1304,14 @@ void CBitstreamConverter::ProcessDoViRpu(uint8_t *nal_buf, int32_t nal_size, uin
   get_dovi_rpu_info(nal_buf, nal_size, m_first_frame, m_hints.dovi_el_type, m_hints.dovi, pts, m_dataCacheCore);
 #endif
 
-  BitstreamAllocAndCopy(poutbuf, poutbuf_size, NULL, 0, nal_buf, nal_size, HEVC_NAL_UNSPEC62);
+  BitstreamAllocAndCopy(NULL, 0, nal_buf, nal_size, HEVC_NAL_UNSPEC62);
 
 #ifdef HAVE_LIBDOVI
   if (rpu_data) dovi_data_free(rpu_data);
 #endif  
 }
 
-bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, uint8_t **poutbuf, int *poutbuf_size, double pts) 
+bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, double pts)
 {
   // based on h264_mp4toannexb_bsf.c (ffmpeg)
   // which is Copyright (c) 2007 Benoit Fouet <benoit.fouet@free.fr>
@@ -1424,7 +1377,7 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, uint8_t **
     // prepend only to the first access unit of an IDR picture, if no sps/pps already present
     if (m_sps_pps_context.first_idr && IsIDR(unit_type) && !m_sps_pps_context.idr_sps_pps_seen)
     {
-      BitstreamAllocAndCopy(poutbuf, poutbuf_size, m_sps_pps_context.sps_pps_data,
+      BitstreamAllocAndCopy(m_sps_pps_context.sps_pps_data,
                             m_sps_pps_context.size, buf, nal_size, unit_type);
       m_sps_pps_context.first_idr = 0;
     }
@@ -1440,21 +1393,21 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, uint8_t **
       switch (unit_type) {
         
         case HEVC_NAL_SEI_PREFIX:
-          ProcessSeiPrefix(buf, nal_size, poutbuf, poutbuf_size, hdr10plus_meta, convert_hdr10plus_meta);
+          ProcessSeiPrefix(buf, nal_size, hdr10plus_meta, convert_hdr10plus_meta);
           break;
 
         case HEVC_NAL_UNSPEC62: // DoVi RPU
           if (!m_removeDovi && !convert_hdr10plus_meta)
-            ProcessDoViRpu(buf, nal_size, poutbuf, poutbuf_size, pts);
+            ProcessDoViRpu(buf, nal_size, pts);
           break;
 
         case HEVC_NAL_UNSPEC63: // DoVi EL
           if (!m_removeDovi && !convert_hdr10plus_meta && (m_convert_dovi == DOVIMode::MODE_NONE))
-            BitstreamAllocAndCopy(poutbuf, poutbuf_size, NULL, 0, buf, nal_size, unit_type);
+            BitstreamAllocAndCopy(NULL, 0, buf, nal_size, unit_type);
           break;
 
         default: // Other
-          BitstreamAllocAndCopy(poutbuf, poutbuf_size, NULL, 0, buf, nal_size, unit_type);
+          BitstreamAllocAndCopy(NULL, 0, buf, nal_size, unit_type);
           break;
       }
     }
@@ -1465,21 +1418,40 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize, uint8_t **
 
   // If converting hdr10plus - add the DoVi RPU as the last NALU in the access unit.
   if (convert_hdr10plus_meta)
-    AddDoViRpuNalu(hdr10plus_meta, poutbuf, poutbuf_size, pts);
+    AddDoViRpuNalu(hdr10plus_meta, pts);
 
   m_first_frame = false;
 
   return true;
 
 fail:
-  av_free(*poutbuf), *poutbuf = NULL;
-  *poutbuf_size = 0;
+  m_convertSize = 0;
   return false;
 }
 
-void CBitstreamConverter::BitstreamAllocAndCopy(uint8_t** poutbuf,
-                                                int* poutbuf_size,
-                                                const uint8_t* sps_pps,
+bool CBitstreamConverter::ReserveConvertBuffer(uint32_t size)
+{
+  // grow geometrically and keep the padding ffmpeg expects behind the data, so the buffer is
+  // reused for every packet once it fits the largest one
+  const uint32_t required = size + AV_INPUT_BUFFER_PADDING_SIZE;
+  if (required <= m_convertCapacity)
+    return true;
+
+  const uint32_t capacity = std::max(required, m_convertCapacity * 2);
+  void* tmp = av_realloc(m_convertBuffer, capacity);
+  if (!tmp)
+  {
+    CLog::Log(LOGERROR, "CBitstreamConverter::ReserveConvertBuffer: failed to allocate {} bytes",
+              capacity);
+    return false;
+  }
+
+  m_convertBuffer = static_cast<uint8_t*>(tmp);
+  m_convertCapacity = capacity;
+  return true;
+}
+
+void CBitstreamConverter::BitstreamAllocAndCopy(const uint8_t* sps_pps,
                                                 uint32_t sps_pps_size,
                                                 const uint8_t* in,
                                                 uint32_t in_size,
@@ -1489,86 +1461,79 @@ void CBitstreamConverter::BitstreamAllocAndCopy(uint8_t** poutbuf,
   // which is Copyright (c) 2007 Benoit Fouet <benoit.fouet@free.fr>
   // and Licensed GPL 2.1 or greater
 
-  uint32_t offset = *poutbuf_size;
+  uint32_t offset = m_convertSize;
   uint8_t nal_header_size = offset ? 3 : 4;
-  void *tmp;
 
   // According to x265, this type is always encoded with four-sized header
   // https://bitbucket.org/multicoreware/x265_git/src/4bf31dc15fb6d1f93d12ecf21fad5e695f0db5c0/source/encoder/nal.cpp#lines-100
   if (nal_type == HEVC_NAL_UNSPEC62)
     nal_header_size = 4;
 
-  *poutbuf_size += sps_pps_size + in_size + nal_header_size;
-  tmp = av_realloc(*poutbuf, *poutbuf_size);
-  if (!tmp)
+  if (!ReserveConvertBuffer(offset + sps_pps_size + in_size + nal_header_size))
     return;
-  *poutbuf = (uint8_t*)tmp;
+  m_convertSize += sps_pps_size + in_size + nal_header_size;
+
+  uint8_t* out = m_convertBuffer + offset;
   if (sps_pps)
-    memcpy(*poutbuf + offset, sps_pps, sps_pps_size);
+    memcpy(out, sps_pps, sps_pps_size);
 
-  memcpy(*poutbuf + sps_pps_size + nal_header_size + offset, in, in_size);
+  memcpy(out + sps_pps_size + nal_header_size, in, in_size);
   if (!offset)
   {
-    BS_WB32(*poutbuf + sps_pps_size, 1);
+    BS_WB32(out + sps_pps_size, 1);
   }
   else if (nal_header_size == 4)
   {
-    (*poutbuf + offset + sps_pps_size)[0] = 0;
-    (*poutbuf + offset + sps_pps_size)[1] = 0;
-    (*poutbuf + offset + sps_pps_size)[2] = 0;
-    (*poutbuf + offset + sps_pps_size)[3] = 1;
+    (out + sps_pps_size)[0] = 0;
+    (out + sps_pps_size)[1] = 0;
+    (out + sps_pps_size)[2] = 0;
+    (out + sps_pps_size)[3] = 1;
   }
   else
   {
-    (*poutbuf + offset + sps_pps_size)[0] = 0;
-    (*poutbuf + offset + sps_pps_size)[1] = 0;
-    (*poutbuf + offset + sps_pps_size)[2] = 1;
+    (out + sps_pps_size)[0] = 0;
+    (out + sps_pps_size)[1] = 0;
+    (out + sps_pps_size)[2] = 1;
   }
 }
 
-void CBitstreamConverter::BitstreamAllocAndCopy(uint8_t** poutbuf,
-                                                uint32_t* poutbuf_size,
-                                                const uint8_t* in,
-                                                uint32_t in_size,
-                                                uint8_t nal_type)
+void CBitstreamConverter::BitstreamAllocAndCopy(const uint8_t* in, uint32_t in_size, uint8_t nal_type)
 {
-  uint32_t offset = *poutbuf_size;
+  uint32_t offset = m_convertSize;
   uint8_t nal_header_size = offset ? 3 : 4;
-  void *tmp;
 
   if (nal_type == HEVC_NAL_UNSPEC62)
     nal_header_size = 4;
   else if (nal_type == HEVC_NAL_UNSPEC63)
     nal_header_size = 5;
 
-  *poutbuf_size += in_size + nal_header_size;
-  tmp = av_realloc(*poutbuf, *poutbuf_size);
-  if (!tmp)
+  if (!ReserveConvertBuffer(offset + in_size + nal_header_size))
     return;
-  *poutbuf = (uint8_t*)tmp;
+  m_convertSize += in_size + nal_header_size;
 
-  memcpy(*poutbuf + nal_header_size + offset, in, in_size);
+  uint8_t* out = m_convertBuffer + offset;
+  memcpy(out + nal_header_size, in, in_size);
 
   if (nal_header_size == 5)
   {
-    (*poutbuf + offset)[0] = 0;
-    (*poutbuf + offset)[1] = 0;
-    (*poutbuf + offset)[2] = 1;
-    (*poutbuf + offset)[3] = HEVC_NAL_UNSPEC63 << 1;
-    (*poutbuf + offset)[4] = 1;
+    out[0] = 0;
+    out[1] = 0;
+    out[2] = 1;
+    out[3] = HEVC_NAL_UNSPEC63 << 1;
+    out[4] = 1;
   }
   else if (nal_header_size == 4)
   {
-    (*poutbuf + offset)[0] = 0;
-    (*poutbuf + offset)[1] = 0;
-    (*poutbuf + offset)[2] = 0;
-    (*poutbuf + offset)[3] = 1;
+    out[0] = 0;
+    out[1] = 0;
+    out[2] = 0;
+    out[3] = 1;
   }
   else
   {
-    (*poutbuf + offset)[0] = 0;
-    (*poutbuf + offset)[1] = 0;
-    (*poutbuf + offset)[2] = 1;
+    out[0] = 0;
+    out[1] = 0;
+    out[2] = 1;
   }
 }
 
@@ -12,6 +12,7 @@
 
 #include <optional>
 #include <stdint.h>
+#include <vector>
 
 #include "ServiceBroker.h"
 #include "cores/DataCacheCore.h"
@@ -145,32 +146,24 @@ protected:
   bool              IsSlice(uint8_t unit_type);
   bool              BitstreamConvertInitAVC(void *in_extradata, int in_extrasize);
   bool              BitstreamConvertInitHEVC(void *in_extradata, int in_extrasize);
-  bool              BitstreamConvert(uint8_t* pData, int iSize, uint8_t **poutbuf, int *poutbuf_size, double pts);
-  static void       BitstreamAllocAndCopy(uint8_t** poutbuf,
-                                         int* poutbuf_size,
-                                         const uint8_t* sps_pps,
-                                         uint32_t sps_pps_size,
-                                         const uint8_t* in,
-                                         uint32_t in_size,
-                                         uint8_t nal_type);
-  static void       BitstreamAllocAndCopy(uint8_t** poutbuf,
-                                         uint32_t* poutbuf_size,
-                                         const uint8_t* in,
-                                         uint32_t in_size,
-                                         uint8_t nal_type);
+  bool              BitstreamConvert(uint8_t* pData, int iSize, double pts);
+  bool              ReserveConvertBuffer(uint32_t size);
+  void              BitstreamAllocAndCopy(const uint8_t* sps_pps,
+                                          uint32_t sps_pps_size,
+                                          const uint8_t* in,
+                                          uint32_t in_size,
+                                          uint8_t nal_type);
+  void              BitstreamAllocAndCopy(const uint8_t* in, uint32_t in_size, uint8_t nal_type);
 
   void ApplyMasteringDisplayColourVolume(const MasteringDisplayColourVolume& metadata, bool& update);
   void ApplyContentLightLevel(const ContentLightLevel& metadata, bool& update);
   void UpdateHdrStaticMetadata();
   
-  void AddDoViRpuNaluWrap(const Hdr10PlusMetadata& meta, uint8_t **poutbuf, uint32_t& poutbuf_size, double pts);
-  void AddDoViRpuNalu(const Hdr10PlusMetadata& meta, uint8_t **poutbuf, int *poutbuf_size, double pts);
+  void AddDoViRpuNalu(const Hdr10PlusMetadata& meta, double pts);
 
-  void ProcessSeiPrefixWrap(uint8_t *buf, int32_t nal_size, uint8_t **poutbuf, uint32_t& poutbuf_size, Hdr10PlusMetadata& meta, bool& convert_hdr10plus_meta);
-  void ProcessSeiPrefix(uint8_t *buf, int32_t nal_size, uint8_t **poutbuf, int *poutbuf_size, Hdr10PlusMetadata& meta, bool& convert_hdr10plus_meta);
+  void ProcessSeiPrefix(uint8_t *buf, int32_t nal_size, Hdr10PlusMetadata& meta, bool& convert_hdr10plus_meta);
   
-  void ProcessDoViRpuWrap(uint8_t *buf, int32_t nal_size, uint8_t **poutbuf, uint32_t& poutbuf_size, double pts);
-  void ProcessDoViRpu(uint8_t *buf, int32_t nal_size, uint8_t **poutbuf, int *poutbuf_size, double pts);
+  void ProcessDoViRpu(uint8_t *buf, int32_t nal_size, double pts);
   
   typedef struct omx_bitstream_ctx {
       uint8_t  length_size;
@@ -180,8 +173,12 @@ protected:
       uint32_t size;
   } omx_bitstream_ctx;
 
+  // output of the conversion, kept between packets so it only has to grow
   uint8_t          *m_convertBuffer;
   int               m_convertSize;
+  uint32_t          m_convertCapacity;
+  bool              m_converted;
+  std::vector<uint8_t> m_seiBuffer;
   uint8_t          *m_inputBuffer;
   int               m_inputSize;
 
@@ -89,6 +89,15 @@ public:
 
   unsigned int GetCPUFeatures() const { return m_cpuFeatures; }
   int GetCPUCount() const { return m_cpuCount; }
+
+  /*!
+   * \brief Number of cores running at the highest maximum frequency, i.e. the "big" cores of
+   * a big.LITTLE system. Equals GetCPUCount() on symmetric systems or if unknown.
+   */
+  int GetPerformanceCoreCount() const
+  {
+    return m_performanceCoreCount > 0 ? m_performanceCoreCount : m_cpuCount;
+  }
   std::string GetCPUModel() { return m_cpuModel; }
   std::string GetCPUBogoMips() { return m_cpuBogoMips; }
   std::string GetCPUSoC() { return m_cpuSoC; }
@@ -116,6 +125,7 @@ protected:
   std::size_t m_totalTime{0};
 
   int m_cpuCount;
+  int m_performanceCoreCount{0};
   unsigned int m_cpuFeatures{0};
 
   std::vector<CoreInfo> m_cores;
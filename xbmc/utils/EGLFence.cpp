@@ -20,7 +20,9 @@ CEGLFence::CEGLFence(EGLDisplay display)
     m_eglDestroySyncKHR(
         CEGLUtils::GetRequiredProcAddress<PFNEGLDESTROYSYNCKHRPROC>("eglDestroySyncKHR")),
     m_eglGetSyncAttribKHR(
-        CEGLUtils::GetRequiredProcAddress<PFNEGLGETSYNCATTRIBKHRPROC>("eglGetSyncAttribKHR"))
+        CEGLUtils::GetRequiredProcAddress<PFNEGLGETSYNCATTRIBKHRPROC>("eglGetSyncAttribKHR")),
+    m_eglClientWaitSyncKHR(
+        CEGLUtils::GetRequiredProcAddress<PFNEGLCLIENTWAITSYNCKHRPROC>("eglClientWaitSyncKHR"))
 {
 }
 
@@ -71,3 +73,21 @@ bool CEGLFence::IsSignaled()
 
   return false;
 }
+
+bool CEGLFence::Wait(EGLTimeKHR timeout)
+{
+  if (m_fence == EGL_NO_SYNC_KHR)
+  {
+    return true;
+  }
+
+  const EGLint status =
+      m_eglClientWaitSyncKHR(m_display, m_fence, EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, timeout);
+  if (status == EGL_FALSE)
+  {
+    CEGLUtils::Log(LOGERROR, "failed to wait for egl sync fence");
+    return false;
+  }
+
+  return status == EGL_CONDITION_SATISFIED_KHR;
+}
@@ -29,6 +29,13 @@ public:
   void CreateFence();
   void DestroyFence();
   bool IsSignaled();
+  /**
+   * Flush the context and wait until the fence is signaled
+   *
+   * \param timeout in nanoseconds or EGL_FOREVER_KHR
+   * \return true if the fence is signaled
+   */
+  bool Wait(EGLTimeKHR timeout);
 
 private:
   EGLDisplay m_display{nullptr};
@@ -37,6 +44,7 @@ private:
   PFNEGLCREATESYNCKHRPROC m_eglCreateSyncKHR{nullptr};
   PFNEGLDESTROYSYNCKHRPROC m_eglDestroySyncKHR{nullptr};
   PFNEGLGETSYNCATTRIBKHRPROC m_eglGetSyncAttribKHR{nullptr};
+  PFNEGLCLIENTWAITSYNCKHRPROC m_eglClientWaitSyncKHR{nullptr};
 };
 
 }
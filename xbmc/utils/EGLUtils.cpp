@@ -299,6 +299,7 @@ bool CEGLContextUtils::InitializeDisplay(EGLint renderingApi)
     return false;
   }
 
+  m_renderingApi = renderingApi;
   return true;
 }
 
@@ -419,6 +420,9 @@ bool CEGLContextUtils::CreateContext(CEGLAttributesVec contextAttribs)
   if (CEGLUtils::HasExtension(m_eglDisplay, "EGL_KHR_no_config_context"))
     eglConfig = EGL_NO_CONFIG_KHR;
 
+  // shared contexts are created with the same attributes, but not at high priority
+  const CEGLAttributesVec sharedContextAttribs{contextAttribs};
+
   if (CEGLUtils::HasExtension(m_eglDisplay, "EGL_IMG_context_priority"))
     contextAttribs.Add({{EGL_CONTEXT_PRIORITY_LEVEL_IMG, EGL_CONTEXT_PRIORITY_HIGH_IMG}});
 
@@ -451,9 +455,51 @@ bool CEGLContextUtils::CreateContext(CEGLAttributesVec contextAttribs)
     return false;
   }
 
+  m_contextAttribs = sharedContextAttribs;
   return true;
 }
 
+EGLContext CEGLContextUtils::CreateSharedContext() const
+{
+  if (m_eglDisplay == EGL_NO_DISPLAY || m_eglContext == EGL_NO_CONTEXT)
+    return EGL_NO_CONTEXT;
+
+  if (!CEGLUtils::HasExtension(m_eglDisplay, "EGL_KHR_surfaceless_context"))
+  {
+    CLog::Log(LOGDEBUG, "EGL_KHR_surfaceless_context not supported, not creating shared context");
+    return EGL_NO_CONTEXT;
+  }
+
+  // the bound API is per thread
+  if (eglBindAPI(m_renderingApi) != EGL_TRUE)
+  {
+    CEGLUtils::Log(LOGERROR, "failed to bind EGL API");
+    return EGL_NO_CONTEXT;
+  }
+
+  EGLConfig eglConfig{m_eglConfig};
+
+  if (CEGLUtils::HasExtension(m_eglDisplay, "EGL_KHR_no_config_context"))
+    eglConfig = EGL_NO_CONFIG_KHR;
+
+  EGLContext context =
+      eglCreateContext(m_eglDisplay, eglConfig, m_eglContext, m_contextAttribs.Get());
+  if (context == EGL_NO_CONTEXT)
+  {
+    CLog::Log(LOGDEBUG, "Failed to create shared EGL context (EGL error {})", eglGetError());
+    return EGL_NO_CONTEXT;
+  }
+
+  if (eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, context) != EGL_TRUE)
+  {
+    CEGLUtils::Log(LOGERROR, "failed to make shared context current");
+    eglDestroyContext(m_eglDisplay, context);
+    return EGL_NO_CONTEXT;
+  }
+
+  return context;
+}
+
 bool CEGLContextUtils::BindContext()
 {
   if (m_eglDisplay == EGL_NO_DISPLAY || m_eglSurface == EGL_NO_SURFACE || m_eglContext == EGL_NO_CONTEXT)
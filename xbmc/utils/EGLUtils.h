@@ -193,6 +193,14 @@ public:
   bool InitializeDisplay(EGLint renderingApi);
   bool ChooseConfig(EGLint renderableType, EGLint visualId = 0, bool hdr = false);
   bool CreateContext(CEGLAttributesVec contextAttribs);
+  /**
+   * Create a context sharing objects with the context created by
+   * \ref CreateContext and make it current on the calling thread without a surface
+   *
+   * \return the new context or EGL_NO_CONTEXT if surfaceless contexts are not
+   *         supported or creating the context failed
+   */
+  EGLContext CreateSharedContext() const;
   bool BindContext();
   void Destroy();
   void DestroySurface();
@@ -224,6 +232,8 @@ private:
 
   EGLenum m_platform{EGL_NONE};
   bool m_platformSupported{false};
+  EGLint m_renderingApi{EGL_NONE};
+  CEGLAttributesVec m_contextAttribs;
 
   EGLDisplay m_eglDisplay{EGL_NO_DISPLAY};
   EGLSurface m_eglSurface{EGL_NO_SURFACE};
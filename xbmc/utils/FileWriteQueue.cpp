@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileWriteQueue.h"
+
+#include "ServiceBroker.h"
+#include "TextureCache.h"
+#include "URL.h"
+#include "dialogs/GUIDialogKaiToast.h"
+#include "filesystem/File.h"
+#include "guilib/LocalizeStrings.h"
+#include "utils/JobManager.h"
+#include "utils/XBMCTinyXML.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+
+using namespace XFILE;
+
+namespace
+{
+// bounds the memory taken by the documents of waiting writes
+constexpr size_t MAX_PENDING_WRITES = 64;
+
+std::string GetDestination(const std::string& file)
+{
+  const CURL url(file);
+  return url.GetProtocol() + "://" + url.GetHostName();
+}
+} // unnamed namespace
+
+CFileWriteQueue::CFileWriteQueue(unsigned int writesPerDestination)
+  : m_writesPerDestination(std::max(writesPerDestination, 1u)),
+    m_start(std::chrono::steady_clock::now())
+{
+}
+
+CFileWriteQueue::~CFileWriteQueue()
+{
+  Cancel();
+  Wait();
+}
+
+void CFileWriteQueue::Write(const std::string& file, std::function<bool()> write)
+{
+  CJobQueue* queue;
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    m_writeDone.wait(lock, [this, &file] {
+      return m_pendingFiles.size() < MAX_PENDING_WRITES &&
+             m_pendingFiles.find(file) == m_pendingFiles.end();
+    });
+    m_pendingFiles.insert(file);
+
+    std::unique_ptr<CJobQueue>& destination = m_destinations[GetDestination(file)];
+    if (!destination)
+      destination =
+          std::make_unique<CJobQueue>(false, m_writesPerDestination, CJob::PRIORITY_NORMAL);
+    queue = destination.get();
+  }
+
+  auto task = std::make_shared<std::function<bool()>>(std::move(write));
+  auto job = [this, file, task] { Run(file, *task); };
+  if (!queue->AddJob(new CLambdaJob<decltype(job)>(std::move(job))))
+    Run(file, *task);
+}
+
+void CFileWriteQueue::SaveNfo(const CXBMCTinyXML& doc, const std::string& file, bool overwrite)
+{
+  auto nfo = std::make_shared<CXBMCTinyXML>(doc);
+  Write(file, [nfo, file, overwrite] {
+    if (!overwrite && CFile::Exists(file, false))
+      return true;
+
+    if (nfo->SaveFile(file))
+      return true;
+
+    CLog::Log(LOGERROR, "CFileWriteQueue: nfo export failed! ('{}')", file);
+    CGUIDialogKaiToast::QueueNotification(CGUIDialogKaiToast::Error, g_localizeStrings.Get(20302),
+                                          CURL::GetRedacted(file));
+    return false;
+  });
+}
+
+void CFileWriteQueue::ExportImage(const std::string& image,
+                                  const std::string& destination,
+                                  bool overwrite)
+{
+  Write(destination, [image, destination, overwrite] {
+    // existing and missing images were never counted as failures
+    CServiceBroker::GetTextureCache()->Export(image, destination, overwrite);
+    return true;
+  });
+}
+
+unsigned int CFileWriteQueue::Wait()
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  m_writeDone.wait(lock, [this] { return m_pendingFiles.empty(); });
+  return m_failed;
+}
+
+void CFileWriteQueue::Cancel()
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  m_cancelled = true;
+}
+
+void CFileWriteQueue::LogStatistics(const std::string& name) const
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+  CLog::Log(LOGINFO, "{}: wrote {} files to {} destinations in {:.1f} s ({:.1f} files/s), {} failed",
+            name, m_written, m_destinations.size(), elapsed.count(),
+            elapsed.count() > 0 ? m_written / elapsed.count() : 0.0, m_failed);
+}
+
+void CFileWriteQueue::Run(const std::string& file, const std::function<bool()>& write)
+{
+  bool cancelled;
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    cancelled = m_cancelled;
+  }
+
+  const bool success = cancelled || write();
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  if (!cancelled)
+  {
+    if (success)
+      m_written++;
+    else
+      m_failed++;
+  }
+  m_pendingFiles.erase(file);
+  m_writeDone.notifyAll();
+}
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+class CJobQueue;
+class CXBMCTinyXML;
+
+/*!
+ \ingroup jobs
+ \brief Writes files in the background, a few at once for each destination
+
+ The library exports read and serialize their items one after the other and hand the NFO files and
+ artwork to this queue, so the writes to slow network shares overlap. Writes to the same file are
+ done in the order they were queued, which keeps the result the same as writing them in turn.
+ */
+class CFileWriteQueue
+{
+public:
+  /*!
+   \param writesPerDestination number of files written at once to the same host.
+   */
+  explicit CFileWriteQueue(unsigned int writesPerDestination = 2);
+
+  /*!
+   \brief Skips the writes not started yet and waits for the others.
+   */
+  ~CFileWriteQueue();
+
+  /*!
+   \brief Queue a write. Blocks while many writes are waiting.
+   \param file the file written, its host is the destination the write is counted for.
+   \param write writes the file, returns false if that failed.
+   */
+  void Write(const std::string& file, std::function<bool()> write);
+
+  /*!
+   \brief Queue saving a document to an NFO file. Failures are logged and notified.
+   \param doc the document, copied so it can be reused right away.
+   \param file the NFO file.
+   \param overwrite whether to replace an existing file.
+   */
+  void SaveNfo(const CXBMCTinyXML& doc, const std::string& file, bool overwrite);
+
+  /*!
+   \brief Queue exporting an image from the texture cache, see CTextureCache::Export.
+   */
+  void ExportImage(const std::string& image, const std::string& destination, bool overwrite);
+
+  /*!
+   \brief Wait until all queued writes are done.
+   \return the number of writes that failed.
+   */
+  unsigned int Wait();
+
+  /*!
+   \brief Skip the writes not started yet, e.g. when the export is cancelled.
+   */
+  void Cancel();
+
+  /*!
+   \brief Log how many files were written and how fast.
+   \param name the export the files were written for.
+   */
+  void LogStatistics(const std::string& name) const;
+
+private:
+  CFileWriteQueue(const CFileWriteQueue&) = delete;
+  CFileWriteQueue& operator=(const CFileWriteQueue&) = delete;
+
+  void Run(const std::string& file, const std::function<bool()>& write);
+
+  const unsigned int m_writesPerDestination;
+  const std::chrono::steady_clock::time_point m_start;
+
+  mutable CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_writeDone;
+  std::map<std::string, std::unique_ptr<CJobQueue>> m_destinations;
+  std::set<std::string> m_pendingFiles;
+  bool m_cancelled = false;
+  unsigned int m_written = 0;
+  unsigned int m_failed = 0;
+};
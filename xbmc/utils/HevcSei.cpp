@@ -28,6 +28,7 @@ void HevcClearStartCodeEmulationPrevention3Byte(const uint8_t* buf,
 {
   size_t i = 0;
 
+  out.clear();
   if (len > 2)
   {
     out.reserve(len);
@@ -245,10 +246,16 @@ const std::optional<ContentLightLevel> CHevcSei::ExtractContentLightLevel(
 
 const std::vector<uint8_t> CHevcSei::RemoveHdr10PlusFromSeiNalu(const uint8_t* inData, const size_t inDataLen)
 {
-
   std::vector<uint8_t> buf;
   std::vector<CHevcSei> messages = CHevcSei::ParseSeiRbspUnclearedEmulation(inData, inDataLen, buf);
 
+  RemoveHdr10PlusFromSeiNalu(messages, buf);
+  return buf;
+}
+
+void CHevcSei::RemoveHdr10PlusFromSeiNalu(const std::vector<CHevcSei>& messages,
+                                          std::vector<uint8_t>& buf)
+{
   if (auto res = CHevcSei::FindHdr10PlusSeiMessage(buf, messages))
   {
     auto msg = *res;
@@ -270,6 +277,4 @@ const std::vector<uint8_t> CHevcSei::RemoveHdr10PlusFromSeiNalu(const uint8_t* i
     // No HDR10+
     buf.clear();
   }
-
-  return buf;
 }
@@ -64,7 +64,7 @@ public:
   // Parses SEI payload assumed to not have emulation prevention 3 bytes
   static std::vector<CHevcSei> ParseSeiRbsp(const uint8_t* buf, const size_t len);
 
-  // Clears emulation prevention 3 bytes and fills in the passed buf
+  // Clears emulation prevention 3 bytes and fills in the passed buf, replacing its content
   static std::vector<CHevcSei> ParseSeiRbspUnclearedEmulation(const uint8_t* inData,
                                                               const size_t inDataLen,
                                                               std::vector<uint8_t>& buf);
@@ -81,6 +81,11 @@ public:
   static const std::vector<uint8_t> RemoveHdr10PlusFromSeiNalu(
       const uint8_t* inData, const size_t inDataLen);
 
+  // Same as above on a payload already parsed by ParseSeiRbspUnclearedEmulation, which avoids
+  // parsing it again. buf is modified in place and is left empty when it can be discarded.
+  static void RemoveHdr10PlusFromSeiNalu(const std::vector<CHevcSei>& messages,
+                                         std::vector<uint8_t>& buf);
+
   static const std::optional<const Hdr10PlusMetadata> ExtractHdr10Plus(
     const std::vector<CHevcSei>& messages,
     const std::vector<uint8_t>& buf);
@@ -34,12 +34,13 @@ private:
   template <typename... TArgs>
   bool Primitive(TArgs... args)
   {
-    PushObject(CVariant(std::forward<TArgs>(args)...));
-    PopObject();
+    AddValue(CVariant(std::forward<TArgs>(args)...));
 
     return true;
   }
 
+  //! \brief Add a value that has no members to the current container
+  void AddValue(CVariant variant);
   void PushObject(CVariant variant);
   void PopObject();
 
@@ -63,8 +64,7 @@ CJSONVariantParserHandler::CJSONVariantParserHandler(CVariant& parsedObject)
 
 bool CJSONVariantParserHandler::Null()
 {
-  PushObject(CVariant::ConstNullVariant);
-  PopObject();
+  AddValue(CVariant::ConstNullVariant);
 
   return true;
 }
@@ -118,7 +118,7 @@ bool CJSONVariantParserHandler::StartObject()
 
 bool CJSONVariantParserHandler::Key(const char* str, rapidjson::SizeType length, bool copy)
 {
-  m_key = std::string(str, 0, length);
+  m_key.assign(str, length);
 
   return true;
 }
@@ -144,14 +144,25 @@ bool CJSONVariantParserHandler::EndArray(rapidjson::SizeType elementCount)
   return true;
 }
 
+void CJSONVariantParserHandler::AddValue(CVariant variant)
+{
+  if (m_status == PARSE_STATUS::Object)
+    (*m_parse.back())[m_key] = std::move(variant);
+  else if (m_status == PARSE_STATUS::Array)
+    m_parse.back()->push_back(std::move(variant));
+  else if (m_parse.empty())
+    m_parsedObject = std::move(variant);
+}
+
 void CJSONVariantParserHandler::PushObject(CVariant variant)
 {
   const auto variant_type = variant.type();
 
   if (m_status == PARSE_STATUS::Object)
   {
-    (*m_parse.back())[m_key] = std::move(variant);
-    m_parse.push_back(&((*m_parse.back())[m_key]));
+    CVariant& member = (*m_parse.back())[m_key];
+    member = std::move(variant);
+    m_parse.push_back(&member);
   }
   else if (m_status == PARSE_STATUS::Array)
   {
@@ -191,7 +202,8 @@ void CJSONVariantParserHandler::PopObject()
   }
   else
   {
-    m_parsedObject = *variant;
+    // the tree is complete, hand it over instead of copying it
+    m_parsedObject = std::move(*variant);
     m_status = PARSE_STATUS::Variable;
   }
 }
@@ -11,9 +11,29 @@
 #include "utils/Variant.h"
 
 #include <rapidjson/prettywriter.h>
-#include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+namespace
+{
+/*!
+ \brief rapidjson output stream appending to a std::string, so large documents are not held
+ in a separate buffer and copied at the end.
+ */
+class CStringOutputStream
+{
+public:
+  using Ch = char;
+
+  explicit CStringOutputStream(std::string& output) : m_output(output) {}
+
+  void Put(Ch c) { m_output.push_back(c); }
+  void Flush() {}
+
+private:
+  std::string& m_output;
+};
+} // unnamed namespace
+
 template<class TWriter>
 bool InternalWrite(TWriter& writer, const CVariant &value)
 {
@@ -70,23 +90,24 @@ bool InternalWrite(TWriter& writer, const CVariant &value)
 
 bool CJSONVariantWriter::Write(const CVariant &value, std::string& output, bool compact)
 {
-  rapidjson::StringBuffer stringBuffer;
+  std::string buffer;
+  CStringOutputStream stream(buffer);
   if (compact)
   {
-    rapidjson::Writer<rapidjson::StringBuffer> writer(stringBuffer);
+    rapidjson::Writer<CStringOutputStream> writer(stream);
 
     if (!InternalWrite(writer, value) || !writer.IsComplete())
       return false;
   }
   else
   {
-    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(stringBuffer);
+    rapidjson::PrettyWriter<CStringOutputStream> writer(stream);
     writer.SetIndent('\t', 1);
 
     if (!InternalWrite(writer, value) || !writer.IsComplete())
       return false;
   }
 
-  output = stringBuffer.GetString();
+  output = std::move(buffer);
   return true;
 }
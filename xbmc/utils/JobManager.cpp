@@ -200,7 +200,8 @@ void CJobManager::CancelJobs()
   // clear any pending jobs
   for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED; ++priority)
   {
-    std::for_each(m_jobQueue[priority].begin(), m_jobQueue[priority].end(), [](CWorkItem& wi) {
+    std::for_each(m_jobQueue[priority].begin(), m_jobQueue[priority].end(), [this](CWorkItem& wi) {
+      GetTypeStatistics(wi.m_job).cancelled++;
       if (wi.m_callback)
         wi.m_callback->OnJobAbort(wi.m_id, wi.m_job);
       wi.FreeJob();
@@ -209,7 +210,8 @@ void CJobManager::CancelJobs()
   }
 
   // cancel any callbacks on jobs still processing
-  std::for_each(m_processing.begin(), m_processing.end(), [](CWorkItem& wi) {
+  std::for_each(m_processing.begin(), m_processing.end(), [this](CWorkItem& wi) {
+    GetTypeStatistics(wi.m_job).cancelled++;
     if (wi.m_callback)
       wi.m_callback->OnJobAbort(wi.m_id, wi.m_job);
     wi.Cancel();
@@ -258,6 +260,7 @@ void CJobManager::CancelJob(unsigned int jobID)
     JobQueue::iterator i = find(m_jobQueue[priority].begin(), m_jobQueue[priority].end(), jobID);
     if (i != m_jobQueue[priority].end())
     {
+      GetTypeStatistics(i->m_job).cancelled++;
       delete i->m_job;
       m_jobQueue[priority].erase(i);
       return;
@@ -266,7 +269,10 @@ void CJobManager::CancelJob(unsigned int jobID)
   // or if we're processing it
   Processing::iterator it = find(m_processing.begin(), m_processing.end(), jobID);
   if (it != m_processing.end())
+  {
+    GetTypeStatistics(it->m_job).cancelled++;
     it->m_callback = NULL; // job is in progress, so only thing to do is to remove callback
+  }
 }
 
 void CJobManager::StartWorkers(CJob::PRIORITY priority)
@@ -274,7 +280,7 @@ void CJobManager::StartWorkers(CJob::PRIORITY priority)
   std::unique_lock<CCriticalSection> lock(m_section);
 
   // check how many free threads we have
-  if (m_processing.size() >= GetMaxWorkers(priority))
+  if (GetSharedProcessingCount() >= GetMaxWorkers(priority))
     return;
 
   // do we have any sleeping threads?
@@ -297,12 +303,22 @@ CJob *CJobManager::PopJob()
     if (priority == CJob::PRIORITY_LOW_PAUSABLE && m_pauseJobs)
       continue;
 
-    if (m_jobQueue[priority].size() && m_processing.size() < GetMaxWorkers(CJob::PRIORITY(priority)))
+    if (m_jobQueue[priority].size() &&
+        GetSharedProcessingCount() < GetMaxWorkers(CJob::PRIORITY(priority)))
     {
       // pop the job off the queue
       CWorkItem job = m_jobQueue[priority].front();
       m_jobQueue[priority].pop_front();
 
+      job.m_started = std::chrono::steady_clock::now();
+      JobStatistics& stats = GetTypeStatistics(job.m_job);
+      const auto queued =
+          std::chrono::duration_cast<std::chrono::microseconds>(job.m_started - job.m_queued);
+      stats.queuedTime += queued;
+      stats.maxQueuedTime = std::max(stats.maxQueuedTime, queued);
+      stats.running++;
+      stats.maxRunning = std::max(stats.maxRunning, stats.running);
+
       // add to the processing vector
       m_processing.push_back(job);
       job.m_job->m_callback = this;
@@ -364,11 +380,12 @@ CJob* CJobManager::GetNextJob()
     CJob *job = PopJob();
     if (job)
       return job;
-    // no jobs are left - sleep for 30 seconds to allow new jobs to come in
+    // no jobs are left - sleep for 30 seconds to allow new jobs to come in, the first few workers
+    // keep waiting
     lock.unlock();
     bool newJob = m_jobEvent.Wait(30000ms);
     lock.lock();
-    if (!newJob)
+    if (!newJob && m_workers.size() > GetPersistentWorkers())
       break;
   }
   // ensure no jobs have come in during the period after
@@ -403,6 +420,15 @@ void CJobManager::OnJobComplete(bool success, CJob *job)
   {
     // tell any listeners we're done with the job, then delete it
     CWorkItem item(*i);
+
+    JobStatistics& stats = GetTypeStatistics(job);
+    const auto run = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - item.m_started);
+    stats.completed++;
+    stats.runTime += run;
+    stats.maxRunTime = std::max(stats.maxRunTime, run);
+    stats.running--;
+
     lock.unlock();
     try
     {
@@ -431,6 +457,69 @@ void CJobManager::RemoveWorker(const CJobWorker *worker)
     m_workers.erase(i); // workers auto-delete
 }
 
+size_t CJobManager::GetSharedProcessingCount() const
+{
+  return std::count_if(m_processing.begin(), m_processing.end(), [](const CWorkItem& item)
+                       { return item.m_priority != CJob::PRIORITY_DEDICATED; });
+}
+
+CJobManager::JobStatistics& CJobManager::GetTypeStatistics(const CJob* job)
+{
+  const char* type = job->GetType();
+  auto it = m_statistics.find(type);
+  if (it == m_statistics.end())
+  {
+    it = m_statistics.emplace(type, JobStatistics()).first;
+    it->second.type = type;
+  }
+  return it->second;
+}
+
+std::vector<CJobManager::JobStatistics> CJobManager::GetStatistics() const
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  std::vector<JobStatistics> statistics;
+  statistics.reserve(m_statistics.size());
+  for (const auto& it : m_statistics)
+    statistics.emplace_back(it.second);
+  return statistics;
+}
+
+void CJobManager::GetQueueInfo(size_t& queued, size_t& processing, size_t& workers) const
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  queued = 0;
+  for (const auto& queue : m_jobQueue)
+    queued += queue.size();
+  processing = m_processing.size();
+  workers = m_workers.size();
+}
+
+void CJobManager::ResetStatistics()
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  // keep the jobs that are running, their completion is still accounted
+  for (auto it = m_statistics.begin(); it != m_statistics.end();)
+  {
+    if (it->second.running == 0)
+      it = m_statistics.erase(it);
+    else
+    {
+      const unsigned int running = it->second.running;
+      it->second = JobStatistics();
+      it->second.type = it->first;
+      it->second.running = running;
+      it->second.maxRunning = running;
+      ++it;
+    }
+  }
+}
+
+size_t CJobManager::GetPersistentWorkers()
+{
+  return GetMaxWorkers(CJob::PRIORITY_HIGH);
+}
+
 unsigned int CJobManager::GetMaxWorkers(CJob::PRIORITY priority)
 {
   static const unsigned int max_workers = 5;
@@ -12,8 +12,12 @@
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
 
+#include <chrono>
+#include <map>
 #include <queue>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 class CJobManager;
@@ -213,6 +217,7 @@ class CJobManager final
       m_id = id;
       m_callback = callback;
       m_priority = priority;
+      m_queued = std::chrono::steady_clock::now();
     }
     bool operator==(unsigned int jobID) const
     {
@@ -235,9 +240,27 @@ class CJobManager final
     unsigned int  m_id;
     IJobCallback *m_callback;
     CJob::PRIORITY m_priority;
+    std::chrono::steady_clock::time_point m_queued;
+    std::chrono::steady_clock::time_point m_started;
   };
 
 public:
+  /*!
+   \brief Statistics of the jobs of one type, see CJob::GetType()
+   */
+  struct JobStatistics
+  {
+    std::string type;
+    uint64_t completed{0}; //!< jobs that finished DoWork()
+    uint64_t cancelled{0}; //!< jobs cancelled while queued or running
+    std::chrono::microseconds queuedTime{0}; //!< total time spent waiting for a worker
+    std::chrono::microseconds maxQueuedTime{0};
+    std::chrono::microseconds runTime{0}; //!< total time spent in DoWork()
+    std::chrono::microseconds maxRunTime{0};
+    unsigned int running{0};
+    unsigned int maxRunning{0};
+  };
+
   CJobManager();
 
   /*!
@@ -270,6 +293,42 @@ public:
     AddJob(new CLambdaJob<F>(std::forward<F>(f)), callback, priority);
   }
 
+  /*!
+   \brief Add a function f to this job manager and a continuation that is run after it.
+   The continuation is queued as a job of its own once f has finished, so it may run at a
+   different priority, e.g. a cheap update after an expensive load. It gets the return value of f
+   as argument, or no argument if f returns void. The continuation is dropped if jobs are
+   cancelled before it was queued.
+   \param f the function to run first
+   \param continuation the function to run with the result of f
+   \param priority the priority of f
+   \param continuationPriority the priority of the continuation
+   */
+  template<typename F, typename C>
+  void SubmitThen(F&& f,
+                  C&& continuation,
+                  CJob::PRIORITY priority = CJob::PRIORITY_LOW,
+                  CJob::PRIORITY continuationPriority = CJob::PRIORITY_LOW)
+  {
+    Submit(
+        [this, f = std::forward<F>(f), continuation = std::forward<C>(continuation),
+         continuationPriority]() mutable
+        {
+          if constexpr (std::is_void_v<std::invoke_result_t<F&>>)
+          {
+            f();
+            Submit(std::move(continuation), continuationPriority);
+          }
+          else
+          {
+            Submit([continuation = std::move(continuation), result = f()]() mutable
+                   { continuation(std::move(result)); },
+                   continuationPriority);
+          }
+        },
+        priority);
+  }
+
   /*!
    \brief Cancel a job with the given id.
    \param jobID the id of the job to cancel, retrieved previously from AddJob()
@@ -320,6 +379,21 @@ public:
    */
   bool IsProcessing(const CJob::PRIORITY &priority) const;
 
+  /*!
+   \brief Get the statistics of all job types that were run since startup or the last reset.
+   */
+  std::vector<JobStatistics> GetStatistics() const;
+
+  /*!
+   \brief Get the number of queued jobs and of worker threads.
+   */
+  void GetQueueInfo(size_t& queued, size_t& processing, size_t& workers) const;
+
+  /*!
+   \brief Start collecting statistics from scratch, e.g. before a measurement.
+   */
+  void ResetStatistics();
+
 protected:
   friend class CJobWorker;
   friend class CJob;
@@ -364,6 +438,19 @@ private:
   void RemoveWorker(const CJobWorker *worker);
   static unsigned int GetMaxWorkers(CJob::PRIORITY priority);
 
+  /*! \brief Number of workers that stay alive when idle.
+   Bursts of jobs, e.g. thumbnails of a directory, then don't pay for creating and destroying
+   threads. Workers above that number exit after being idle for a while.
+   */
+  static size_t GetPersistentWorkers();
+
+  /*! \brief Number of processing jobs that count against the worker limits.
+   Dedicated jobs run on workers of their own, so they don't hold back jobs of lower priority.
+   */
+  size_t GetSharedProcessingCount() const;
+
+  JobStatistics& GetTypeStatistics(const CJob* job);
+
   unsigned int m_jobCounter;
 
   typedef std::deque<CWorkItem>    JobQueue;
@@ -374,6 +461,7 @@ private:
   bool       m_pauseJobs;
   Processing m_processing;
   Workers    m_workers;
+  std::map<std::string, JobStatistics, std::less<>> m_statistics;
 
   mutable CCriticalSection m_section;
   CEvent           m_jobEvent;
@@ -0,0 +1,163 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "LoudnessMeter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+constexpr double PI = 3.14159265358979323846;
+constexpr double ABSOLUTE_GATE_LUFS = -70.0;
+constexpr double RELATIVE_GATE_LU = -10.0;
+constexpr unsigned int SUB_BLOCKS_PER_BLOCK = 4;
+
+double LoudnessToEnergy(double loudness)
+{
+  return std::pow(10.0, (loudness + 0.691) / 10.0);
+}
+
+double EnergyToLoudness(double energy)
+{
+  return -0.691 + 10.0 * std::log10(energy);
+}
+} // unnamed namespace
+
+CLoudnessMeter::CLoudnessMeter(unsigned int sampleRate, std::vector<double> channelWeights)
+  : m_channelWeights(std::move(channelWeights)),
+    m_channels(m_channelWeights.size()),
+    m_subBlockFrames(std::max(1u, sampleRate / 10))
+{
+  // The K-weighting filter of BS.1770 is specified for 48 kHz, the coefficients for other sample
+  // rates are derived from the analog prototypes of both stages
+  const double rate = static_cast<double>(std::max(1u, sampleRate));
+
+  // stage 1: high shelf modelling the acoustic effect of the head
+  {
+    const double f0 = 1681.974450955533;
+    const double gain = 3.999843853973347;
+    const double q = 0.7071752369554196;
+
+    const double k = std::tan(PI * f0 / rate);
+    const double vh = std::pow(10.0, gain / 20.0);
+    const double vb = std::pow(vh, 0.4996667741545416);
+    const double a0 = 1.0 + k / q + k * k;
+
+    m_stages[0].b0 = (vh + vb * k / q + k * k) / a0;
+    m_stages[0].b1 = 2.0 * (k * k - vh) / a0;
+    m_stages[0].b2 = (vh - vb * k / q + k * k) / a0;
+    m_stages[0].a1 = 2.0 * (k * k - 1.0) / a0;
+    m_stages[0].a2 = (1.0 - k / q + k * k) / a0;
+  }
+
+  // stage 2: high pass
+  {
+    const double f0 = 38.13547087602444;
+    const double q = 0.5003270373238773;
+
+    const double k = std::tan(PI * f0 / rate);
+    const double a0 = 1.0 + k / q + k * k;
+
+    m_stages[1].b0 = 1.0;
+    m_stages[1].b1 = -2.0;
+    m_stages[1].b2 = 1.0;
+    m_stages[1].a1 = 2.0 * (k * k - 1.0) / a0;
+    m_stages[1].a2 = (1.0 - k / q + k * k) / a0;
+  }
+}
+
+double CLoudnessMeter::Filter(ChannelState& state, double sample) const
+{
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    const Biquad& stage = m_stages[i];
+    double* z = state.z[i];
+
+    const double out = stage.b0 * sample + z[0];
+    z[0] = stage.b1 * sample - stage.a1 * out + z[1];
+    z[1] = stage.b2 * sample - stage.a2 * out;
+    sample = out;
+  }
+  return sample;
+}
+
+void CLoudnessMeter::Add(const float* samples, size_t frames)
+{
+  const size_t channelCount = m_channels.size();
+  if (channelCount == 0)
+    return;
+
+  for (size_t frame = 0; frame < frames; ++frame)
+  {
+    const float* const frameSamples = samples + frame * channelCount;
+
+    for (size_t ch = 0; ch < channelCount; ++ch)
+    {
+      m_peak = std::max(m_peak, std::fabs(frameSamples[ch]));
+
+      if (m_channelWeights[ch] == 0.0)
+        continue;
+
+      const double filtered = Filter(m_channels[ch], frameSamples[ch]);
+      m_subBlockEnergy += m_channelWeights[ch] * filtered * filtered;
+    }
+
+    if (++m_subBlockPos < m_subBlockFrames)
+      continue;
+
+    // a block is made of the last four sub blocks of 100 ms, giving the overlap of 75 %
+    m_subBlocks[m_subBlockCount % SUB_BLOCKS_PER_BLOCK] = m_subBlockEnergy;
+    m_subBlockCount++;
+    m_subBlockPos = 0;
+    m_subBlockEnergy = 0.0;
+
+    if (m_subBlockCount >= SUB_BLOCKS_PER_BLOCK)
+    {
+      double energy = 0.0;
+      for (double subBlock : m_subBlocks)
+        energy += subBlock;
+      m_blockEnergies.push_back(energy / (SUB_BLOCKS_PER_BLOCK * m_subBlockFrames));
+    }
+  }
+}
+
+bool CLoudnessMeter::GetIntegratedLoudness(double& loudness) const
+{
+  const auto gatedMean = [this](double threshold, double& mean)
+  {
+    double sum = 0.0;
+    size_t count = 0;
+    for (double energy : m_blockEnergies)
+    {
+      if (energy > threshold)
+      {
+        sum += energy;
+        count++;
+      }
+    }
+    if (count == 0)
+      return false;
+
+    mean = sum / count;
+    return true;
+  };
+
+  double mean;
+  if (!gatedMean(LoudnessToEnergy(ABSOLUTE_GATE_LUFS), mean))
+    return false;
+
+  const double relativeGate =
+      std::max(LoudnessToEnergy(ABSOLUTE_GATE_LUFS), mean * std::pow(10.0, RELATIVE_GATE_LU / 10.0));
+  if (!gatedMean(relativeGate, mean))
+    return false;
+
+  loudness = EnergyToLoudness(mean);
+  return true;
+}
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/*!
+ * \brief Measures the integrated loudness of interleaved float samples as specified by
+ * EBU R128 / ITU-R BS.1770: K-weighting, 400 ms blocks overlapping by 75 %, an absolute gate
+ * at -70 LUFS and a relative gate 10 LU below the loudness of the blocks above it.
+ */
+class CLoudnessMeter
+{
+public:
+  /*!
+   * \param sampleRate The sample rate of the samples
+   * \param channelWeights The weight of each channel, 1.0 for front channels, 1.41 for
+   *        surround channels and 0.0 for channels that are ignored, e.g. LFE
+   */
+  CLoudnessMeter(unsigned int sampleRate, std::vector<double> channelWeights);
+
+  /*!
+   * \brief Add samples
+   * \param samples Interleaved samples, full scale is 1.0
+   * \param frames The number of frames, i.e. samples per channel
+   */
+  void Add(const float* samples, size_t frames);
+
+  /*!
+   * \brief Get the integrated loudness of the samples added so far
+   * \param[out] loudness The loudness in LUFS
+   * \return false if no block passed the gates, e.g. for silence
+   */
+  bool GetIntegratedLoudness(double& loudness) const;
+
+  /*!
+   * \brief Get the largest absolute sample value, 1.0 is full scale
+   */
+  float GetPeak() const { return m_peak; }
+
+private:
+  struct Biquad
+  {
+    double b0, b1, b2, a1, a2;
+  };
+
+  struct ChannelState
+  {
+    double z[2][2] = {}; // DF2T state of both filter stages
+  };
+
+  double Filter(ChannelState& state, double sample) const;
+
+  Biquad m_stages[2];
+  std::vector<double> m_channelWeights;
+  std::vector<ChannelState> m_channels;
+
+  size_t m_subBlockFrames;
+  size_t m_subBlockPos = 0;
+  double m_subBlockEnergy = 0.0;
+  double m_subBlocks[4] = {};
+  unsigned int m_subBlockCount = 0;
+
+  std::vector<double> m_blockEnergies;
+  float m_peak = 0.0f;
+};
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <algorithm>
+#include <iterator>
 #include <random>
 
 namespace KODI
@@ -22,5 +23,27 @@ void RandomShuffle(TIterator begin, TIterator end)
   std::mt19937 mt(rd());
   std::shuffle(begin, end, mt);
 }
+
+/*!
+ * \brief Move count elements picked at random to the front of the range, in random order
+ *
+ * A partial Fisher-Yates shuffle, so picking a few elements of a large range only costs count
+ * swaps instead of shuffling or sorting the whole range.
+ * \return The end of the picked elements, i.e. begin + min(count, end - begin)
+ */
+template<class TIterator>
+TIterator RandomSample(TIterator begin, TIterator end, size_t count)
+{
+  std::random_device rd;
+  std::mt19937 mt(rd());
+  const auto size = static_cast<size_t>(std::distance(begin, end));
+  count = std::min(count, size);
+  for (size_t i = 0; i < count; ++i)
+  {
+    std::uniform_int_distribution<size_t> dist(i, size - 1);
+    std::iter_swap(begin + i, begin + dist(mt));
+  }
+  return begin + count;
+}
 }
 }
@@ -9,12 +9,16 @@
 #include "RegExp.h"
 
 #include "log.h"
+#include "threads/CriticalSection.h"
 #include "utils/StringUtils.h"
 #include "utils/Utf8Utils.h"
 
 #include <algorithm>
+#include <map>
+#include <mutex>
 #include <stdlib.h>
 #include <string.h>
+#include <utility>
 
 using namespace PCRE;
 
@@ -41,6 +45,64 @@ int CRegExp::m_Utf8Supported = -1;
 int CRegExp::m_UcpSupported  = -1;
 int CRegExp::m_JitSupported  = -1;
 
+struct CRegExp::CompiledPattern
+{
+  CompiledPattern() = default;
+  CompiledPattern(const CompiledPattern&) = delete;
+  CompiledPattern& operator=(const CompiledPattern&) = delete;
+  ~CompiledPattern()
+  {
+    if (sd)
+      pcre_free_study(sd);
+    if (re)
+      pcre_free(re);
+  }
+
+  pcre* re{nullptr};
+  pcre_extra* sd{nullptr};
+  bool jitCompiled{false};
+};
+
+namespace
+{
+// the same expressions, e.g. the tv show and stacking ones of advancedsettings, are compiled for
+// every file of a scan, so compiled patterns are shared between all CRegExp objects
+constexpr size_t PATTERN_CACHE_SIZE = 512;
+
+struct PatternCache
+{
+  CCriticalSection section;
+  std::map<std::pair<std::string, int>, std::shared_ptr<const CRegExp::CompiledPattern>> patterns;
+};
+
+PatternCache& GetPatternCache()
+{
+  // CRegExp objects with static storage may be compiled before any global of this file exists
+  static PatternCache cache;
+  return cache;
+}
+
+#ifdef PCRE_HAS_JIT_CODE
+pcre_jit_stack* GetThreadJitStack(void*)
+{
+  // a JIT compiled pattern can be used by several threads at once, each needs its own stack
+  struct JitStack
+  {
+    ~JitStack()
+    {
+      if (stack)
+        pcre_jit_stack_free(stack);
+    }
+    pcre_jit_stack* stack = pcre_jit_stack_alloc(32 * 1024, 512 * 1024);
+  };
+  thread_local JitStack jitStack;
+  if (!jitStack.stack)
+    CLog::Log(LOGWARNING, "{}: can't allocate address space for JIT stack", __FUNCTION__);
+  return jitStack.stack;
+}
+#endif
+} // unnamed namespace
+
 
 CRegExp::CRegExp(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= asciiOnly*/)
 {
@@ -67,7 +129,6 @@ void CRegExp::InitValues(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= a
   m_jitCompiled = false;
   m_bMatched    = false;
   m_iMatchCount = 0;
-  m_jitStack    = NULL;
 
   memset(m_iOvector, 0, sizeof(m_iOvector));
 }
@@ -226,7 +287,6 @@ CRegExp::CRegExp(const CRegExp& re)
 {
   m_re = NULL;
   m_sd = NULL;
-  m_jitStack = NULL;
   m_utf8Mode = re.m_utf8Mode;
   m_iOptions = re.m_iOptions;
   *this = re;
@@ -234,27 +294,25 @@ CRegExp::CRegExp(const CRegExp& re)
 
 CRegExp& CRegExp::operator=(const CRegExp& re)
 {
-  size_t size;
+  if (this == &re)
+    return *this;
+
   Cleanup();
   m_jitCompiled = false;
   m_pattern = re.m_pattern;
-  if (re.m_re)
+  if (re.m_compiled)
   {
-    if (pcre_fullinfo(re.m_re, NULL, PCRE_INFO_SIZE, &size) >= 0)
-    {
-      if ((m_re = (pcre*)malloc(size)))
-      {
-        memcpy(m_re, re.m_re, size);
-        memcpy(m_iOvector, re.m_iOvector, OVECCOUNT*sizeof(int));
-        m_offset = re.m_offset;
-        m_iMatchCount = re.m_iMatchCount;
-        m_bMatched = re.m_bMatched;
-        m_subject = re.m_subject;
-        m_iOptions = re.m_iOptions;
-      }
-      else
-        CLog::Log(LOGFATAL, "{}: Failed to allocate memory", __FUNCTION__);
-    }
+    // compiled patterns are immutable, the copy shares it including its study data
+    m_compiled = re.m_compiled;
+    m_re = m_compiled->re;
+    m_sd = m_compiled->sd;
+    m_jitCompiled = m_compiled->jitCompiled;
+    memcpy(m_iOvector, re.m_iOvector, OVECCOUNT*sizeof(int));
+    m_offset = re.m_offset;
+    m_iMatchCount = re.m_iMatchCount;
+    m_bMatched = re.m_bMatched;
+    m_subject = re.m_subject;
+    m_iOptions = re.m_iOptions;
   }
   return *this;
 }
@@ -281,39 +339,64 @@ bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
 
   Cleanup();
 
-  m_re = pcre_compile(re, options, &errMsg, &errOffset, NULL);
-  if (!m_re)
+  PatternCache& cache = GetPatternCache();
+  std::unique_lock<CCriticalSection> lock(cache.section);
+  auto key = std::make_pair(std::string(re), options);
+  auto it = cache.patterns.find(key);
+  if (it == cache.patterns.end())
   {
-    m_pattern.clear();
-    CLog::Log(LOGERROR, "PCRE: {}. Compilation failed at offset {} in expression '{}'", errMsg,
-              errOffset, re);
-    return false;
-  }
-
-  m_pattern = re;
+    auto compiled = std::make_shared<CompiledPattern>();
+    compiled->re = pcre_compile(re, options, &errMsg, &errOffset, NULL);
+    if (!compiled->re)
+    {
+      lock.unlock();
+      m_pattern.clear();
+      CLog::Log(LOGERROR, "PCRE: {}. Compilation failed at offset {} in expression '{}'", errMsg,
+                errOffset, re);
+      return false;
+    }
 
-  if (study)
-  {
-    const bool jitCompile = (study == StudyWithJitComp) && IsJitSupported();
+    // the pattern is going to be reused from the cache, so it's always worth to study it and to
+    // JIT compile it if possible, whatever the caller asked for
+    const bool jitCompile = IsJitSupported();
     const int studyOptions = jitCompile ? PCRE_STUDY_JIT_COMPILE : 0;
 
-    m_sd = pcre_study(m_re, studyOptions, &errMsg);
+    compiled->sd = pcre_study(compiled->re, studyOptions, &errMsg);
     if (errMsg != NULL)
     {
       CLog::Log(LOGWARNING, "{}: PCRE error \"{}\" while studying expression", __FUNCTION__,
                 errMsg);
-      if (m_sd != NULL)
+      if (compiled->sd != NULL)
       {
-        pcre_free_study(m_sd);
-        m_sd = NULL;
+        pcre_free_study(compiled->sd);
+        compiled->sd = NULL;
       }
     }
-    else if (jitCompile)
+    else if (jitCompile && compiled->sd)
     {
       int jitPresent = 0;
-      m_jitCompiled = (pcre_fullinfo(m_re, m_sd, PCRE_INFO_JIT, &jitPresent) == 0 && jitPresent == 1);
+      compiled->jitCompiled =
+          (pcre_fullinfo(compiled->re, compiled->sd, PCRE_INFO_JIT, &jitPresent) == 0 &&
+           jitPresent == 1);
+#ifdef PCRE_HAS_JIT_CODE
+      if (compiled->jitCompiled)
+        pcre_assign_jit_stack(compiled->sd, GetThreadJitStack, NULL);
+#endif
     }
+
+    // patterns still in use stay alive through their CRegExp objects
+    if (cache.patterns.size() >= PATTERN_CACHE_SIZE)
+      cache.patterns.clear();
+
+    it = cache.patterns.emplace(std::move(key), std::move(compiled)).first;
   }
+  m_compiled = it->second;
+  lock.unlock();
+
+  m_re = m_compiled->re;
+  m_sd = m_compiled->sd;
+  m_jitCompiled = m_compiled->jitCompiled;
+  m_pattern = re;
 
   return true;
 }
@@ -347,22 +430,11 @@ int CRegExp::PrivateRegFind(size_t bufferLen, const char *str, unsigned int star
     return -1;
   }
 
-#ifdef PCRE_HAS_JIT_CODE
-  if (m_jitCompiled && !m_jitStack)
-  {
-    m_jitStack = pcre_jit_stack_alloc(32*1024, 512*1024);
-    if (m_jitStack == NULL)
-      CLog::Log(LOGWARNING, "{}: can't allocate address space for JIT stack", __FUNCTION__);
-
-    pcre_assign_jit_stack(m_sd, NULL, m_jitStack);
-  }
-#endif
-
   if (maxNumberOfCharsToTest >= 0)
     bufferLen = std::min<size_t>(bufferLen, startoffset + maxNumberOfCharsToTest);
 
   m_subject.assign(str + startoffset, bufferLen - startoffset);
-  int rc = pcre_exec(m_re, NULL, m_subject.c_str(), m_subject.length(), 0, 0, m_iOvector, OVECCOUNT);
+  int rc = pcre_exec(m_re, m_sd, m_subject.c_str(), m_subject.length(), 0, 0, m_iOvector, OVECCOUNT);
 
   if (rc<1)
   {
@@ -556,25 +628,9 @@ void CRegExp::DumpOvector(int iLog /* = LOGDEBUG */)
 
 void CRegExp::Cleanup()
 {
-  if (m_re)
-  {
-    pcre_free(m_re);
-    m_re = NULL;
-  }
-
-  if (m_sd)
-  {
-    pcre_free_study(m_sd);
-    m_sd = NULL;
-  }
-
-#ifdef PCRE_HAS_JIT_CODE
-  if (m_jitStack)
-  {
-    pcre_jit_stack_free(m_jitStack);
-    m_jitStack = NULL;
-  }
-#endif
+  m_re = NULL;
+  m_sd = NULL;
+  m_compiled.reset();
 }
 
 inline bool CRegExp::IsValidSubNumber(int iSub) const
@@ -10,6 +10,7 @@
 
 //! @todo - move to std::regex (after switching to gcc 4.9 or higher) and get rid of CRegExp
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -133,6 +134,12 @@ public:
   static bool LogCheckUtf8Support(void);
   static bool IsJitSupported(void);
 
+  /*!
+   * \brief A compiled and studied expression, shared by all CRegExp objects using the same
+   * expression and options.
+   */
+  struct CompiledPattern;
+
 private:
   int PrivateRegFind(size_t bufferLen, const char *str, unsigned int startoffset = 0, int maxNumberOfCharsToTest = -1);
   void InitValues(bool caseless = false, CRegExp::utf8Mode utf8 = asciiOnly);
@@ -143,6 +150,7 @@ private:
   void Cleanup();
   inline bool IsValidSubNumber(int iSub) const;
 
+  std::shared_ptr<const CompiledPattern> m_compiled;
   PCRE::pcre* m_re;
   PCRE::pcre_extra* m_sd;
   static const int OVECCOUNT=(m_MaxNumOfBackrefrences + 1) * 3;
@@ -153,7 +161,6 @@ private:
   int         m_iOptions;
   bool        m_jitCompiled;
   bool        m_bMatched;
-  PCRE::pcre_jit_stack* m_jitStack;
   std::string m_subject;
   std::string m_pattern;
   static int  m_Utf8Supported;
@@ -17,6 +17,7 @@
 #include "Util.h"
 #include "application/ApplicationComponents.h"
 #include "application/ApplicationStackHelper.h"
+#include "filesystem/File.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIMessage.h"
 #include "guilib/GUIWindowManager.h"
@@ -25,10 +26,174 @@
 #include "music/MusicDatabase.h"
 #include "music/tags/MusicInfoTag.h"
 #include "network/upnp/UPnP.h"
+#include "profiles/ProfileManager.h"
+#include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
+#include "utils/Archive.h"
+#include "utils/JobManager.h"
 #include "utils/Variant.h"
 #include "video/Bookmark.h"
 #include "video/VideoDatabase.h"
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+// Format version of the journal, the archived items are versioned on their own
+constexpr int JOURNAL_VERSION = 1;
+
+struct PendingState
+{
+  std::shared_ptr<CFileItem> item;
+  CBookmark bookmark;
+  bool updatePlayCount = false;
+};
+
+struct StateQueue
+{
+  CCriticalSection section; // protects the members below
+  std::vector<PendingState> pending;
+  std::vector<PendingState> saving; // taken by the writer, kept in the journal until saved
+  bool writerQueued = false;
+
+  CCriticalSection writeSection; // only one thread saves states at a time
+};
+
+StateQueue& GetStateQueue()
+{
+  static StateQueue queue;
+  return queue;
+}
+
+std::string GetJournalFile()
+{
+  // states belong to the databases of the profile they were queued in
+  const auto profileManager = CServiceBroker::GetSettingsComponent()->GetProfileManager();
+  return StringUtils::Format("special://temp/filestate-{}.journal",
+                             profileManager->GetCurrentProfileId());
+}
+
+void ArchiveBookmark(CArchive& ar, CBookmark& bookmark)
+{
+  if (ar.IsStoring())
+  {
+    ar << bookmark.timeInSeconds;
+    ar << bookmark.totalTimeInSeconds;
+    ar << bookmark.partNumber;
+    ar << bookmark.thumbNailImage;
+    ar << bookmark.playerState;
+    ar << bookmark.player;
+    ar << bookmark.seasonNumber;
+    ar << bookmark.episodeNumber;
+    ar << static_cast<int>(bookmark.type);
+  }
+  else
+  {
+    ar >> bookmark.timeInSeconds;
+    ar >> bookmark.totalTimeInSeconds;
+    ar >> bookmark.partNumber;
+    ar >> bookmark.thumbNailImage;
+    ar >> bookmark.playerState;
+    ar >> bookmark.player;
+    ar >> bookmark.seasonNumber;
+    ar >> bookmark.episodeNumber;
+    int type;
+    ar >> type;
+    bookmark.type = static_cast<CBookmark::EType>(type);
+  }
+}
+
+// must be called with the queue locked
+void WriteJournal(const StateQueue& queue)
+{
+  const std::string journalFile = GetJournalFile();
+  if (queue.pending.empty() && queue.saving.empty())
+  {
+    if (XFILE::CFile::Exists(journalFile))
+      XFILE::CFile::Delete(journalFile);
+    return;
+  }
+
+  XFILE::CFile file;
+  if (!file.OpenForWrite(journalFile, true))
+  {
+    CLog::Log(LOGWARNING, "CSaveFileState::{} - unable to write journal {}", __FUNCTION__,
+              journalFile);
+    return;
+  }
+
+  CArchive ar(&file, CArchive::store);
+  ar << JOURNAL_VERSION;
+  ar << CFileItemList::ARCHIVE_VERSION;
+  ar << static_cast<int>(queue.saving.size() + queue.pending.size());
+  for (const auto* states : {&queue.saving, &queue.pending})
+  {
+    for (const PendingState& state : *states)
+    {
+      CBookmark bookmark = state.bookmark;
+      ar << *state.item;
+      ArchiveBookmark(ar, bookmark);
+      ar << state.updatePlayCount;
+    }
+  }
+  ar.Close();
+}
+
+void SavePendingStates()
+{
+  StateQueue& queue = GetStateQueue();
+  std::unique_lock<CCriticalSection> writeLock(queue.writeSection);
+
+  while (true)
+  {
+    {
+      std::unique_lock<CCriticalSection> lock(queue.section);
+      queue.saving.clear();
+      if (queue.pending.empty())
+      {
+        WriteJournal(queue);
+        return;
+      }
+      queue.saving.swap(queue.pending);
+    }
+
+    // consecutive files are saved over the same database connections
+    CDatabase::CConnectionScope connectionScope;
+    for (const PendingState& state : queue.saving)
+    {
+      // the journal may be rewritten meanwhile, so the queued state itself is left untouched
+      CFileItem item(*state.item);
+      CBookmark bookmark = state.bookmark;
+      CSaveFileState::DoWork(item, bookmark, state.updatePlayCount);
+    }
+  }
+}
+
+void QueueWriter(StateQueue& queue)
+{
+  if (queue.writerQueued)
+    return;
+
+  queue.writerQueued = true;
+  CServiceBroker::GetJobManager()->Submit(
+      []()
+      {
+        StateQueue& queue = GetStateQueue();
+        {
+          std::unique_lock<CCriticalSection> lock(queue.section);
+          queue.writerQueued = false;
+        }
+        SavePendingStates();
+      },
+      CJob::PRIORITY_NORMAL);
+}
+} // unnamed namespace
+
 void CSaveFileState::DoWork(CFileItem& item,
                             CBookmark& bookmark,
                             bool updatePlayCount)
@@ -233,3 +398,94 @@ void CSaveFileState::DoWork(CFileItem& item,
     }
   }
 }
+
+void CSaveFileState::Queue(const CFileItem& item, const CBookmark& bookmark, bool updatePlayCount)
+{
+  StateQueue& queue = GetStateQueue();
+  std::unique_lock<CCriticalSection> lock(queue.section);
+
+  const auto it = std::find_if(queue.pending.begin(), queue.pending.end(),
+                               [&item](const PendingState& state)
+                               { return state.item->GetPath() == item.GetPath(); });
+  if (it != queue.pending.end())
+  {
+    // the file was played again before its last state was saved, keep the latest state but
+    // don't lose that it was watched
+    it->item = std::make_shared<CFileItem>(item);
+    it->bookmark = bookmark;
+    it->updatePlayCount = it->updatePlayCount || updatePlayCount;
+  }
+  else
+    queue.pending.push_back({std::make_shared<CFileItem>(item), bookmark, updatePlayCount});
+
+  WriteJournal(queue);
+  QueueWriter(queue);
+}
+
+void CSaveFileState::Flush()
+{
+  SavePendingStates();
+}
+
+void CSaveFileState::ReplayJournal()
+{
+  const std::string journalFile = GetJournalFile();
+  XFILE::CFile file;
+  if (!file.Open(journalFile))
+    return;
+
+  std::vector<PendingState> states;
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+    int version = 0;
+    int itemsVersion = 0;
+    int count = 0;
+    ar >> version;
+    ar >> itemsVersion;
+    ar >> count;
+    if (version == JOURNAL_VERSION && itemsVersion == CFileItemList::ARCHIVE_VERSION)
+    {
+      for (int i = 0; i < count; ++i)
+      {
+        PendingState state;
+        state.item = std::make_shared<CFileItem>();
+        ar >> *state.item;
+        ArchiveBookmark(ar, state.bookmark);
+        ar >> state.updatePlayCount;
+        states.push_back(std::move(state));
+      }
+    }
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "CSaveFileState::{} - corrupt journal {}", __FUNCTION__, journalFile);
+    states.clear();
+  }
+  file.Close();
+
+  StateQueue& queue = GetStateQueue();
+  std::unique_lock<CCriticalSection> lock(queue.section);
+
+  // the journal also holds the states queued in this session
+  const auto isQueued = [&queue](const PendingState& journaled)
+  {
+    const auto samePath = [&journaled](const PendingState& state)
+    { return state.item->GetPath() == journaled.item->GetPath(); };
+    return std::any_of(queue.pending.begin(), queue.pending.end(), samePath) ||
+           std::any_of(queue.saving.begin(), queue.saving.end(), samePath);
+  };
+  states.erase(std::remove_if(states.begin(), states.end(), isQueued), states.end());
+  if (states.empty())
+  {
+    WriteJournal(queue);
+    return;
+  }
+
+  CLog::Log(LOGINFO, "CSaveFileState::{} - saving {} file states left by the last session",
+            __FUNCTION__, states.size());
+  queue.pending.insert(queue.pending.begin(), std::make_move_iterator(states.begin()),
+                       std::make_move_iterator(states.end()));
+  WriteJournal(queue);
+  QueueWriter(queue);
+}
@@ -17,5 +17,23 @@ public:
   static void DoWork(CFileItem& item,
                      CBookmark& bookmark,
                      bool updatePlayCount);
+
+  /*!
+   * \brief Save the state of a file in the background, so that stopping playback and starting the
+   * next item don't wait for the databases. A state queued for a file that still has one pending
+   * replaces it. Pending states are kept in a journal in special://temp until they are saved.
+   */
+  static void Queue(const CFileItem& item, const CBookmark& bookmark, bool updatePlayCount);
+
+  /*!
+   * \brief Save all pending states on the calling thread, e.g. before the profile changes or the
+   * application exits
+   */
+  static void Flush();
+
+  /*!
+   * \brief Queue the states left in the journal of the current profile by an unclean exit
+   */
+  static void ReplayJournal();
 };
 
@@ -14,10 +14,12 @@
 #include "URL.h"
 #include "XMLUtils.h"
 #include "filesystem/CurlFile.h"
+#include "filesystem/HttpCache.h"
 #include "filesystem/ZipFile.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CharsetDetection.h"
+#include "utils/HttpHeader.h"
 #include "utils/Mime.h"
 #include "utils/StringUtils.h"
 #include "utils/XBMCTinyXML.h"
@@ -188,6 +190,10 @@ bool CScraperUrl::ParseAndAppendUrl(const TiXmlElement* element)
 
   url.m_cache = XMLUtils::GetAttribute(element, "cache");
 
+  const char* szMaxAge = element->Attribute("maxage");
+  if (szMaxAge)
+    url.m_maxAge = std::max(atoi(szMaxAge), 0);
+
   const char* szType = element->Attribute("type");
   if (szType && StringUtils::CompareNoCase(szType, "season") == 0)
   {
@@ -324,6 +330,7 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
   }
 
   auto strHTML1 = strHTML;
+  std::string contentType;
 
   if (scrURL.m_post)
   {
@@ -333,13 +340,17 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
 
     if (!http.Post(url.Get(), strOptions, strHTML1))
       return false;
+    contentType = http.GetProperty(XFILE::FILE_PROPERTY_CONTENT_TYPE);
   }
-  else if (!http.Get(url.Get(), strHTML1))
+  else if (!XFILE::CHttpCache::Get(http, url.Get(), strHTML1, contentType, scrURL.m_maxAge))
     return false;
 
   strHTML = strHTML1;
 
-  const auto mimeType = http.GetProperty(XFILE::FILE_PROPERTY_MIME_TYPE);
+  // a cached response has no headers of its own in http
+  CHttpHeader contentHeader;
+  contentHeader.AddParam("content-type", contentType);
+  const auto mimeType = contentHeader.GetMimeType();
   CMime::EFileType ftype = CMime::GetFileTypeFromMime(mimeType);
   if (ftype == CMime::FileTypeUnknown)
     ftype = CMime::GetFileTypeFromContent(strHTML);
@@ -360,7 +371,7 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
                 scrURL.m_url);
   }
 
-  const auto reportedCharset = http.GetProperty(XFILE::FILE_PROPERTY_CONTENT_CHARSET);
+  const auto reportedCharset = contentHeader.GetCharset();
   if (ftype == CMime::FileTypeHtml)
   {
     std::string realHtmlCharset, converted;
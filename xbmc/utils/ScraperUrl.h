@@ -40,6 +40,7 @@ public:
     bool m_post = false;
     bool m_isgz = false;
     int m_season = -1;
+    int m_maxAge = 0; ///< seconds the response may be used from the http cache without a request
   };
 
   CScraperUrl();
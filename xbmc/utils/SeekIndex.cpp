@@ -0,0 +1,172 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SeekIndex.h"
+
+#include "URL.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr int SEEK_INDEX_VERSION = 2;
+constexpr const char* SEEK_INDEX_PATH = "special://temp/seekindex/";
+} // unnamed namespace
+
+CSeekIndex::CSeekIndex(int64_t interval, int64_t maxGap)
+  : m_interval(std::max<int64_t>(1, interval)),
+    m_maxGap(std::max(m_interval + 1, maxGap > 0 ? maxGap : 2 * m_interval))
+{
+}
+
+bool CSeekIndex::Load(const std::string& path)
+{
+  m_entries.clear();
+  m_modified = false;
+  m_path = path;
+  m_token = GetToken(path);
+  if (m_token.empty())
+    return false;
+
+  CFile file;
+  if (!file.Open(GetCacheFile(path)))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+    int version = 0;
+    ar >> version;
+    if (version != SEEK_INDEX_VERSION)
+      return false;
+
+    std::string cachedPath;
+    std::string cachedToken;
+    int64_t interval = 0;
+    int64_t maxGap = 0;
+    ar >> cachedPath;
+    ar >> cachedToken;
+    ar >> interval;
+    ar >> maxGap;
+    if (cachedPath != path || cachedToken != m_token || interval != m_interval ||
+        maxGap != m_maxGap)
+      return false;
+
+    unsigned int count = 0;
+    ar >> count;
+    m_entries.resize(count);
+    for (Entry& entry : m_entries)
+    {
+      ar >> entry.timestamp;
+      ar >> entry.pos;
+    }
+    return true;
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "CSeekIndex::{} - corrupt seek index of {}", __FUNCTION__,
+              CURL::GetRedacted(path));
+  }
+
+  m_entries.clear();
+  return false;
+}
+
+void CSeekIndex::Save()
+{
+  if (!m_modified || m_path.empty() || m_token.empty())
+    return;
+
+  const std::string cacheFile = GetCacheFile(m_path);
+  CFile file;
+  if (!file.OpenForWrite(cacheFile, true))
+  {
+    // first use, create the cache folder and try again
+    if (!CDirectory::Create(SEEK_INDEX_PATH) || !file.OpenForWrite(cacheFile, true))
+    {
+      CLog::Log(LOGWARNING, "CSeekIndex::{} - unable to write {}", __FUNCTION__, cacheFile);
+      return;
+    }
+  }
+
+  CArchive ar(&file, CArchive::store);
+  ar << SEEK_INDEX_VERSION;
+  ar << m_path;
+  ar << m_token;
+  ar << m_interval;
+  ar << m_maxGap;
+  ar << static_cast<unsigned int>(m_entries.size());
+  for (const Entry& entry : m_entries)
+  {
+    ar << entry.timestamp;
+    ar << entry.pos;
+  }
+  ar.Close();
+  m_modified = false;
+}
+
+void CSeekIndex::Add(int64_t timestamp, int64_t pos)
+{
+  if (pos < 0)
+    return;
+
+  if (m_entries.empty())
+  {
+    if (timestamp >= m_maxGap - m_interval)
+      return; // not read from the start
+  }
+  else
+  {
+    const Entry& last = m_entries.back();
+    if (timestamp < last.timestamp + m_interval || timestamp >= last.timestamp + m_maxGap ||
+        pos <= last.pos)
+      return;
+  }
+
+  m_entries.push_back({timestamp, pos});
+  m_modified = true;
+}
+
+bool CSeekIndex::Lookup(int64_t timestamp, Entry& entry) const
+{
+  if (m_entries.empty() || timestamp >= m_entries.back().timestamp + m_maxGap - m_interval)
+    return false;
+
+  auto it = std::upper_bound(m_entries.begin(), m_entries.end(), timestamp,
+                             [](int64_t value, const Entry& e) { return value < e.timestamp; });
+  if (it == m_entries.begin())
+    return false;
+
+  entry = *std::prev(it);
+  return true;
+}
+
+std::string CSeekIndex::GetToken(const std::string& path)
+{
+  struct __stat64 st;
+  if (CFile::Stat(path, &st) != 0 || st.st_size <= 0)
+    return {};
+
+  return StringUtils::Format("{}:{}", static_cast<int64_t>(st.st_size),
+                             static_cast<int64_t>(st.st_mtime));
+}
+
+std::string CSeekIndex::GetCacheFile(const std::string& path)
+{
+  return StringUtils::Format("{}{:08x}.idx", SEEK_INDEX_PATH, Crc32::Compute(path));
+}
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Maps timestamps of a media file to byte offsets, so that seeking can jump to a known
+ * packet instead of letting the demuxer search the file, e.g. in VBR MP3s without a TOC.
+ *
+ * The index is built while the file is read from the start and only covers that contiguous part,
+ * so that a lookup never lands far before the target. It is kept on disk per file and dropped
+ * when the size or modification time of the file changes.
+ */
+class CSeekIndex
+{
+public:
+  struct Entry
+  {
+    int64_t timestamp;
+    int64_t pos;
+  };
+
+  /*!
+   * \param interval Distance between entries, in the unit of the timestamps
+   * \param maxGap Largest distance between entries that does not break the index, 0 for twice the
+   * interval. Larger gaps are needed if only some packets can be seeked to, e.g. keyframes.
+   */
+  explicit CSeekIndex(int64_t interval, int64_t maxGap = 0);
+
+  /*!
+   * \brief Load the stored index of a file, the index is empty if there is none or it is stale
+   * \return true if an index was loaded
+   */
+  bool Load(const std::string& path);
+
+  /*!
+   * \brief Store the index of the file passed to Load(), if entries were added since
+   */
+  void Save();
+
+  /*!
+   * \brief Offer the position of a packet read in file order, it is only kept if it extends the
+   * index by at least one interval and less than the max gap
+   */
+  void Add(int64_t timestamp, int64_t pos);
+
+  /*!
+   * \brief Find the last entry at or before a timestamp
+   * \return false if the timestamp is not covered by the index
+   */
+  bool Lookup(int64_t timestamp, Entry& entry) const;
+
+  bool IsEmpty() const { return m_entries.empty(); }
+
+private:
+  static std::string GetToken(const std::string& path);
+  static std::string GetCacheFile(const std::string& path);
+
+  int64_t m_interval;
+  int64_t m_maxGap;
+  std::vector<Entry> m_entries;
+  bool m_modified = false;
+  std::string m_path;
+  std::string m_token;
+};
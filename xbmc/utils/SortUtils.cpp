@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <inttypes.h>
+#include <unordered_set>
 
 std::string ArrayToString(SortAttribute attributes, const CVariant &variant, const std::string &separator = " / ")
 {
@@ -984,6 +985,138 @@ void SortUtils::GetFieldsForSQLSort(const MediaType& mediaType,
 }
 
 
+namespace
+{
+/*!
+ * \brief Everything the sorters look at for one item, precomputed so the comparisons neither
+ * search the item's field map nor copy the sort label.
+ *
+ * Equal labels share one entry of a dictionary, so sorting by low cardinality fields like genre
+ * or year keeps a single copy of each value and compares duplicates by pointer.
+ */
+struct SortKey
+{
+  const std::wstring* label;
+  SortSpecial special;
+  int8_t folder; //!< -1 if the item has no FieldFolder
+  size_t index;
+};
+
+SortItem& GetSortItem(SortItem& item)
+{
+  return item;
+}
+
+SortItem& GetSortItem(const SortItemPtr& item)
+{
+  return *item;
+}
+
+//! \brief Same ordering as the SorterXXX functions, see preliminarySort()
+bool KeyLess(const SortKey& left, const SortKey& right, bool handleFolder, bool descending)
+{
+  if (left.special != right.special)
+    return left.special == SortSpecialOnTop || right.special == SortSpecialOnBottom;
+  if (left.special != SortSpecialNone)
+    return false;
+
+  if (handleFolder && left.folder >= 0 && right.folder >= 0 && left.folder != right.folder)
+    return left.folder > 0;
+
+  if (left.label == right.label)
+    return false;
+
+  const int64_t cmp = StringUtils::AlphaNumericCompare(left.label->c_str(), right.label->c_str());
+  return descending ? cmp > 0 : cmp < 0;
+}
+
+void GetLimits(size_t size, int limitEnd, int limitStart, size_t& begin, size_t& end)
+{
+  begin = 0;
+  if (limitStart > 0 && static_cast<size_t>(limitStart) < size)
+  {
+    begin = limitStart;
+    limitEnd -= limitStart;
+  }
+  end = size;
+  if (limitEnd > 0 && static_cast<size_t>(limitEnd) < size - begin)
+    end = begin + limitEnd;
+}
+
+template<typename T>
+void ApplyLimits(std::vector<T>& items, int limitEnd, int limitStart)
+{
+  size_t begin, end;
+  GetLimits(items.size(), limitEnd, limitStart, begin, end);
+  items.erase(items.begin() + end, items.end());
+  items.erase(items.begin(), items.begin() + begin);
+}
+
+/*!
+ * \brief Sort items by the label of the given preparator.
+ *
+ * The sort keys are collected into one contiguous array first and only that array is sorted,
+ * the items themselves are moved once into their final position, and only if they are within
+ * the requested limits.
+ */
+template<typename T>
+void SortByKeys(SortUtils::SortPreparator preparator,
+                const Fields& sortingFields,
+                SortOrder sortOrder,
+                SortAttribute attributes,
+                std::vector<T>& items,
+                int limitEnd,
+                int limitStart)
+{
+  std::vector<SortKey> keys;
+  keys.reserve(items.size());
+  std::unordered_set<std::wstring> labels;
+
+  // Prepare the string used for sorting and store it under FieldSort
+  for (size_t i = 0; i < items.size(); ++i)
+  {
+    SortItem& item = GetSortItem(items[i]);
+
+    // add all fields to the item that are required for sorting if they are currently missing
+    for (const Field field : sortingFields)
+      item.insert(std::pair<Field, CVariant>(field, CVariant::ConstNullVariant));
+
+    std::wstring sortLabel;
+    g_charsetConverter.utf8ToW(preparator(attributes, item), sortLabel, false);
+    const auto sort = item.insert(std::pair<Field, CVariant>(FieldSort, CVariant(sortLabel))).first;
+
+    SortKey key{nullptr, SortSpecialNone, -1, i};
+    key.label = &*labels.insert(sort->second.asWideString()).first;
+
+    const auto special = item.find(FieldSortSpecial);
+    if (special != item.end() && special->second.asInteger() <= (int64_t)SortSpecialOnBottom)
+      key.special = (SortSpecial)special->second.asInteger();
+
+    const auto folder = item.find(FieldFolder);
+    if (folder != item.end())
+      key.folder = folder->second.asBoolean() ? 1 : 0;
+
+    keys.emplace_back(std::move(key));
+  }
+
+  // Do the sorting
+  const bool handleFolder = !(attributes & SortAttributeIgnoreFolders);
+  const bool descending = sortOrder == SortOrderDescending;
+  std::stable_sort(keys.begin(), keys.end(),
+                   [handleFolder, descending](const SortKey& left, const SortKey& right)
+                   { return KeyLess(left, right, handleFolder, descending); });
+
+  size_t begin, end;
+  GetLimits(keys.size(), limitEnd, limitStart, begin, end);
+
+  std::vector<T> sorted;
+  sorted.reserve(end - begin);
+  for (size_t i = begin; i < end; ++i)
+    sorted.emplace_back(std::move(items[keys[i].index]));
+  items.swap(sorted);
+}
+} // unnamed namespace
+
 void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, DatabaseResults& items, int limitEnd /* = -1 */, int limitStart /* = 0 */)
 {
   if (sortBy != SortByNone)
@@ -992,35 +1125,13 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
     SortPreparator preparator = getPreparator(sortBy);
     if (preparator != NULL)
     {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (DatabaseResults::iterator item = items.begin(); item != items.end(); ++item)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (Fields::const_iterator field = sortingFields.begin(); field != sortingFields.end(); ++field)
-        {
-          if (item->find(*field) == item->end())
-            item->insert(std::pair<Field, CVariant>(*field, CVariant::ConstNullVariant));
-        }
-
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, *item), sortLabel, false);
-        item->insert(std::pair<Field, CVariant>(FieldSort, CVariant(sortLabel)));
-      }
-
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorter(sortOrder, attributes));
+      SortByKeys(preparator, GetFieldsForSorting(sortBy), sortOrder, attributes, items, limitEnd,
+                 limitStart);
+      return;
     }
   }
 
-  if (limitStart > 0 && (size_t)limitStart < items.size())
-  {
-    items.erase(items.begin(), items.begin() + limitStart);
-    limitEnd -= limitStart;
-  }
-  if (limitEnd > 0 && (size_t)limitEnd < items.size())
-    items.erase(items.begin() + limitEnd, items.end());
+  ApplyLimits(items, limitEnd, limitStart);
 }
 
 void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, SortItems& items, int limitEnd /* = -1 */, int limitStart /* = 0 */)
@@ -1031,35 +1142,13 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
     SortPreparator preparator = getPreparator(sortBy);
     if (preparator != NULL)
     {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (SortItems::iterator item = items.begin(); item != items.end(); ++item)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (Fields::const_iterator field = sortingFields.begin(); field != sortingFields.end(); ++field)
-        {
-          if ((*item)->find(*field) == (*item)->end())
-            (*item)->insert(std::pair<Field, CVariant>(*field, CVariant::ConstNullVariant));
-        }
-
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, **item), sortLabel, false);
-        (*item)->insert(std::pair<Field, CVariant>(FieldSort, CVariant(sortLabel)));
-      }
-
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorterIndirect(sortOrder, attributes));
+      SortByKeys(preparator, GetFieldsForSorting(sortBy), sortOrder, attributes, items, limitEnd,
+                 limitStart);
+      return;
     }
   }
 
-  if (limitStart > 0 && (size_t)limitStart < items.size())
-  {
-    items.erase(items.begin(), items.begin() + limitStart);
-    limitEnd -= limitStart;
-  }
-  if (limitEnd > 0 && (size_t)limitEnd < items.size())
-    items.erase(items.begin() + limitEnd, items.end());
+  ApplyLimits(items, limitEnd, limitStart);
 }
 
 void SortUtils::Sort(const SortDescription &sortDescription, DatabaseResults& items)
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SpectrumAnalyzer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+namespace
+{
+constexpr double LOWEST_BAND_HZ = 60.0;
+constexpr double HIGHEST_BAND_HZ = 16000.0;
+constexpr float RANGE_DB = 60.0f;
+constexpr float FALLOFF_PER_BLOCK = 2.0f; // percent, i.e. a full scale peak decays in ~0.6 s
+
+float ToPercent(float magnitude)
+{
+  if (magnitude <= 0.0f)
+    return 0.0f;
+  const float db = 20.0f * std::log10(magnitude);
+  return std::clamp((db + RANGE_DB) * 100.0f / RANGE_DB, 0.0f, 100.0f);
+}
+} // unnamed namespace
+
+CSpectrumAnalyzer::CSpectrumAnalyzer()
+  : m_fft(static_cast<int>(FFT_SIZE), true),
+    m_block(2 * FFT_SIZE),
+    m_magnitudes(FFT_SIZE),
+    m_spectrum(FFT_SIZE)
+{
+  Reset(44100);
+}
+
+void CSpectrumAnalyzer::Reset(unsigned int sampleRate)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_blockPos = 0;
+
+  // the band edges are spaced logarithmically, but every band gets at least one bin of its own
+  const double binWidth = static_cast<double>(std::max(1u, sampleRate)) / FFT_SIZE;
+  const double highest = std::min(HIGHEST_BAND_HZ, binWidth * FFT_SIZE / 2);
+  const size_t lastBin = FFT_SIZE / 2;
+  for (unsigned int i = 0; i <= NUM_BANDS; ++i)
+  {
+    const double freq = LOWEST_BAND_HZ * std::pow(highest / LOWEST_BAND_HZ,
+                                                  static_cast<double>(i) / NUM_BANDS);
+    size_t bin = static_cast<size_t>(std::lround(freq / binWidth));
+    if (i > 0)
+      bin = std::max(bin, m_bandBins[i - 1] + 1);
+    m_bandBins[i] = std::clamp<size_t>(bin, 1, lastBin);
+  }
+
+  m_hasSpectrum = false;
+  m_level = 0.0f;
+  m_bands.fill(0.0f);
+}
+
+void CSpectrumAnalyzer::Add(const float* samples, size_t count)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  while (count > 0)
+  {
+    const size_t copy = std::min(count, m_block.size() - m_blockPos);
+    std::copy_n(samples, copy, m_block.begin() + m_blockPos);
+    m_blockPos += copy;
+    samples += copy;
+    count -= copy;
+
+    if (m_blockPos == m_block.size())
+    {
+      Analyze();
+      m_blockPos = 0;
+    }
+  }
+}
+
+void CSpectrumAnalyzer::Analyze()
+{
+  m_fft.calc(m_block.data(), m_magnitudes.data());
+
+  float energy = 0.0f;
+  for (float sample : m_block)
+    energy += sample * sample;
+  const float level = ToPercent(std::sqrt(energy / m_block.size()));
+
+  std::array<float, NUM_BANDS> bands;
+  for (unsigned int i = 0; i < NUM_BANDS; ++i)
+  {
+    float peak = 0.0f;
+    for (size_t bin = m_bandBins[i]; bin < m_bandBins[i + 1]; ++bin)
+      peak = std::max(peak, 0.5f * (m_magnitudes[2 * bin] + m_magnitudes[2 * bin + 1]));
+    bands[i] = ToPercent(peak);
+  }
+
+  m_spectrum.swap(m_magnitudes);
+  m_hasSpectrum = true;
+  m_level = std::max(level, m_level - FALLOFF_PER_BLOCK);
+  for (unsigned int i = 0; i < NUM_BANDS; ++i)
+    m_bands[i] = std::max(bands[i], m_bands[i] - FALLOFF_PER_BLOCK);
+}
+
+size_t CSpectrumAnalyzer::GetSpectrum(float* spectrum, size_t size) const
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (!m_hasSpectrum || !spectrum)
+    return 0;
+
+  size = std::min(size, m_spectrum.size());
+  std::copy_n(m_spectrum.begin(), size, spectrum);
+  return size;
+}
+
+int CSpectrumAnalyzer::GetLevel() const
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  return static_cast<int>(std::lround(m_level));
+}
+
+int CSpectrumAnalyzer::GetBand(unsigned int band) const
+{
+  if (band >= NUM_BANDS)
+    return 0;
+
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  return static_cast<int>(std::lround(m_bands[band]));
+}
@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "utils/rfft.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/*!
+ * \brief Computes the spectrum of interleaved stereo samples once per block of FFT_SIZE frames,
+ * so that visualizations and skins can share it instead of each running their own transform.
+ *
+ * Samples are added from the audio thread, the results can be read from any thread. The
+ * transform of a block takes microseconds, so it simply runs under the same lock.
+ */
+class CSpectrumAnalyzer
+{
+public:
+  static constexpr size_t FFT_SIZE = 512; //!< Frames per block
+  static constexpr unsigned int NUM_BANDS = 16; //!< Logarithmically spaced bands
+
+  CSpectrumAnalyzer();
+
+  /*!
+   * \brief Drop pending samples and results, e.g. when a new stream starts
+   * \param sampleRate The sample rate of the samples added from now on
+   */
+  void Reset(unsigned int sampleRate);
+
+  /*!
+   * \brief Add samples, a spectrum is computed for every completed block
+   * \param samples Interleaved stereo samples, full scale is 1.0
+   * \param count The number of samples, i.e. twice the number of frames
+   */
+  void Add(const float* samples, size_t count);
+
+  /*!
+   * \brief Get the magnitudes of the last block
+   * \param[out] spectrum Receives up to size magnitudes, interleaved per channel and ordered by
+   *             frequency from 0 Hz in steps of sampleRate / FFT_SIZE
+   * \param size Capacity of spectrum
+   * \return The number of magnitudes written, 0 if no block has been analyzed yet
+   */
+  size_t GetSpectrum(float* spectrum, size_t size) const;
+
+  /*!
+   * \brief Get the level of the last block in percent of a -60 to 0 dBFS range, with falloff
+   */
+  int GetLevel() const;
+
+  /*!
+   * \brief Get the level of a frequency band in percent of a -60 to 0 dB range, with falloff
+   * \param band Band between 0 (lowest frequencies) and NUM_BANDS - 1
+   */
+  int GetBand(unsigned int band) const;
+
+private:
+  mutable CCriticalSection m_critSection;
+
+  // Called with m_critSection held
+  void Analyze();
+
+  RFFT m_fft;
+  std::vector<float> m_block;
+  size_t m_blockPos = 0;
+  std::vector<float> m_magnitudes;
+
+  //! First FFT bin of each band, the last entry ends the last band
+  std::array<size_t, NUM_BANDS + 1> m_bandBins = {};
+
+  std::vector<float> m_spectrum;
+  bool m_hasSpectrum = false;
+  float m_level = 0.0f;
+  std::array<float, NUM_BANDS> m_bands = {};
+};
@@ -15,6 +15,13 @@
 #include <memory>
 #include <string.h>
 
+#if defined(HAVE_SSE) && defined(__SSE__)
+#include <xmmintrin.h>
+#elif defined(__aarch64__) || (defined(HAS_NEON) && defined(__ARM_NEON))
+#define TRANSFORM_MATRIX_USE_NEON
+#include <arm_neon.h>
+#endif
+
 #ifdef __GNUC__
 // under gcc, inline will only take place if optimizations are applied (-O). this will force inline even with optimizations.
 #define XBMC_FORCE_INLINE __attribute__((always_inline))
@@ -249,6 +256,45 @@ public:
     return m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3];
   }
 
+  /*!
+   \brief Transform the corners of the rectangle (x1, y1) - (x2, y2) at once.
+
+   The corners are stored in the order (x1, y1), (x2, y1), (x2, y2), (x1, y2), the way
+   quads are drawn. Each of x, y and z receives 4 coordinates.
+   */
+  inline void TransformQuad(float x1, float y1, float x2, float y2, float* x, float* y, float* z)
+      const XBMC_FORCE_INLINE
+  {
+    float* result[3] = {x, y, z};
+#if defined(HAVE_SSE) && defined(__SSE__)
+    const __m128 xs = _mm_setr_ps(x1, x2, x2, x1);
+    const __m128 ys = _mm_setr_ps(y1, y1, y2, y2);
+    for (int i = 0; i < 3; i++)
+    {
+      const __m128 products = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[i][0]), xs),
+                                         _mm_mul_ps(_mm_set1_ps(m[i][1]), ys));
+      _mm_storeu_ps(result[i], _mm_add_ps(products, _mm_set1_ps(m[i][3])));
+    }
+#elif defined(TRANSFORM_MATRIX_USE_NEON)
+    const float32x4_t xs = {x1, x2, x2, x1};
+    const float32x4_t ys = {y1, y1, y2, y2};
+    for (int i = 0; i < 3; i++)
+    {
+      const float32x4_t products =
+          vaddq_f32(vmulq_n_f32(xs, m[i][0]), vmulq_n_f32(ys, m[i][1]));
+      vst1q_f32(result[i], vaddq_f32(products, vdupq_n_f32(m[i][3])));
+    }
+#else
+    const float xs[4] = {x1, x2, x2, x1};
+    const float ys[4] = {y1, y1, y2, y2};
+    for (int i = 0; i < 3; i++)
+    {
+      for (int j = 0; j < 4; j++)
+        result[i][j] = m[i][0] * xs[j] + m[i][1] * ys[j] + m[i][3];
+    }
+#endif
+  }
+
   inline UTILS::COLOR::Color TransformAlpha(UTILS::COLOR::Color color) const XBMC_FORCE_INLINE
   {
     return static_cast<UTILS::COLOR::Color>(color * alpha);
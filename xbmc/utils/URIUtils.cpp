@@ -26,13 +26,72 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cctype>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <string_view>
 
 using namespace PVR;
 using namespace XFILE;
 
+namespace
+{
+/*!
+ * \brief The scheme of a url as is, i.e. not lower-cased, without parsing or copying the url.
+ * \return the part before "://" or an empty view for plain paths
+ */
+std::string_view GetScheme(std::string_view path)
+{
+  const size_t pos = path.find("://");
+  if (pos == std::string_view::npos)
+    return {};
+  return path.substr(0, pos);
+}
+
+bool SchemeEquals(std::string_view scheme, std::string_view type)
+{
+  return scheme.size() == type.size() &&
+         std::equal(scheme.begin(), scheme.end(), type.begin(),
+                    [](char a, char b)
+                    { return std::tolower(static_cast<unsigned char>(a)) == b; });
+}
+
+/*!
+ * \brief Same as URIUtils::HasParentInHostname() on the scheme alone, so that the predicates
+ * below only need to parse urls whose host name holds another url.
+ */
+bool SchemeHasParentInHostname(std::string_view scheme)
+{
+  if (scheme.empty())
+    return false;
+
+  for (const std::string_view type : {"zip", "apk", "bluray", "udf", "iso9660", "xbt"})
+  {
+    if (SchemeEquals(scheme, type))
+      return true;
+  }
+
+  if (!CServiceBroker::IsAddonInterfaceUp())
+    return false;
+
+  std::string protocol(scheme);
+  StringUtils::ToLower(protocol);
+  return CServiceBroker::GetFileExtensionProvider().EncodedHostName(protocol);
+}
+
+bool IsInternetStreamScheme(std::string_view scheme)
+{
+  static constexpr std::array<std::string_view, 18> types = {
+      "http", "https", "tcp",    "udp",   "rtp",   "sdp", "mms", "mmst", "mmsh",
+      "rtsp", "rtmp",  "rtmpt",  "rtmpe", "rtmpte", "rtmps", "shout", "rss", "rsss"};
+
+  return std::any_of(types.begin(), types.end(),
+                     [scheme](std::string_view type) { return SchemeEquals(scheme, type); });
+}
+} // unnamed namespace
+
 const CAdvancedSettings* URIUtils::m_advancedSettings = nullptr;
 
 void URIUtils::RegisterAdvancedSettings(const CAdvancedSettings& advancedSettings)
@@ -538,7 +597,8 @@ std::string URIUtils::SubstitutePath(const std::string& strPath, bool reverse /*
 
 bool URIUtils::IsProtocol(const std::string& url, const std::string &type)
 {
-  return StringUtils::StartsWithNoCase(url, type + "://");
+  return url.size() > type.size() + 2 && StringUtils::StartsWithNoCase(url, type) &&
+         url.compare(type.size(), 3, "://") == 0;
 }
 
 bool URIUtils::PathHasParent(std::string path, std::string parent, bool translate /* = false */)
@@ -919,9 +979,8 @@ bool URIUtils::IsSmb(const std::string& strFile)
   if (IsSpecial(strFile))
     return IsSmb(CSpecialProtocol::TranslatePath(strFile));
 
-  CURL url(strFile);
-  if (HasParentInHostname(url))
-    return IsSmb(url.GetHostName());
+  if (SchemeHasParentInHostname(GetScheme(strFile)))
+    return IsSmb(CURL(strFile).GetHostName());
 
   return IsProtocol(strFile, "smb");
 }
@@ -939,9 +998,8 @@ bool URIUtils::IsFTP(const std::string& strFile)
   if (IsSpecial(strFile))
     return IsFTP(CSpecialProtocol::TranslatePath(strFile));
 
-  CURL url(strFile);
-  if (HasParentInHostname(url))
-    return IsFTP(url.GetHostName());
+  if (SchemeHasParentInHostname(GetScheme(strFile)))
+    return IsFTP(CURL(strFile).GetHostName());
 
   return IsProtocol(strFile, "ftp") ||
          IsProtocol(strFile, "ftps");
@@ -955,12 +1013,18 @@ bool URIUtils::IsHTTP(const std::string& strFile, bool bTranslate /* = false */)
   if (IsSpecial(strFile))
     return IsHTTP(CSpecialProtocol::TranslatePath(strFile));
 
-  CURL url(strFile);
-  if (HasParentInHostname(url))
-    return IsHTTP(url.GetHostName());
+  const std::string_view scheme = GetScheme(strFile);
+  if (SchemeHasParentInHostname(scheme))
+    return IsHTTP(CURL(strFile).GetHostName());
 
-  const std::string strProtocol = (bTranslate ? url.GetTranslatedProtocol() : url.GetProtocol());
+  if (SchemeEquals(scheme, "http") || SchemeEquals(scheme, "https"))
+    return true;
 
+  // translating the protocol of addon urls needs the parsed url
+  if (!bTranslate || scheme.empty())
+    return false;
+
+  const std::string strProtocol = CURL(strFile).GetTranslatedProtocol();
   return (strProtocol == "http" || strProtocol == "https");
 }
 
@@ -1030,8 +1094,19 @@ bool URIUtils::IsDAV(const std::string& strFile)
 
 bool URIUtils::IsInternetStream(const std::string &path, bool bStrictCheck /* = false */)
 {
-  const CURL pathToUrl(path);
-  return IsInternetStream(pathToUrl, bStrictCheck);
+  const std::string_view scheme = GetScheme(path);
+  if (scheme.empty())
+    return false;
+
+  // there's nothing to stop internet streams from being stacked
+  if (IsStack(path))
+    return IsInternetStream(CStackDirectory::GetFirstStackedFile(path), bStrictCheck);
+
+  // Only consider "streamed" filesystems internet streams when being strict
+  if (bStrictCheck && IsStreamedFilesystem(path))
+    return true;
+
+  return IsInternetStreamScheme(scheme);
 }
 
 bool URIUtils::IsInternetStream(const CURL& url, bool bStrictCheck /* = false */)
@@ -1048,36 +1123,22 @@ bool URIUtils::IsInternetStream(const CURL& url, bool bStrictCheck /* = false */
     return true;
 
   // Check for true internetstreams
-  const std::string& protocol = url.GetProtocol();
-  if (CURL::IsProtocolEqual(protocol, "http") || CURL::IsProtocolEqual(protocol, "https") ||
-      CURL::IsProtocolEqual(protocol, "tcp") || CURL::IsProtocolEqual(protocol, "udp") ||
-      CURL::IsProtocolEqual(protocol, "rtp") || CURL::IsProtocolEqual(protocol, "sdp") ||
-      CURL::IsProtocolEqual(protocol, "mms") || CURL::IsProtocolEqual(protocol, "mmst") ||
-      CURL::IsProtocolEqual(protocol, "mmsh") || CURL::IsProtocolEqual(protocol, "rtsp") ||
-      CURL::IsProtocolEqual(protocol, "rtmp") || CURL::IsProtocolEqual(protocol, "rtmpt") ||
-      CURL::IsProtocolEqual(protocol, "rtmpe") || CURL::IsProtocolEqual(protocol, "rtmpte") ||
-      CURL::IsProtocolEqual(protocol, "rtmps") || CURL::IsProtocolEqual(protocol, "shout") ||
-      CURL::IsProtocolEqual(protocol, "rss") || CURL::IsProtocolEqual(protocol, "rsss"))
-    return true;
-
-  return false;
+  return IsInternetStreamScheme(url.GetProtocol());
 }
 
 bool URIUtils::IsStreamedFilesystem(const std::string& strPath)
 {
-  CURL url(strPath);
-
-  if (url.GetProtocol().empty())
+  if (GetScheme(strPath).empty())
     return false;
 
-  if (url.IsProtocol("stack"))
+  if (IsStack(strPath))
     return IsStreamedFilesystem(CStackDirectory::GetFirstStackedFile(strPath));
 
   if (IsUPnP(strPath) || IsFTP(strPath) || IsHTTP(strPath, true))
     return true;
 
   //! @todo sftp/ssh special case has to be handled by vfs addon
-  if (url.IsProtocol("sftp") || url.IsProtocol("ssh"))
+  if (IsProtocol(strPath, "sftp") || IsProtocol(strPath, "ssh"))
     return true;
 
   return false;
@@ -1085,12 +1146,10 @@ bool URIUtils::IsStreamedFilesystem(const std::string& strPath)
 
 bool URIUtils::IsNetworkFilesystem(const std::string& strPath)
 {
-  CURL url(strPath);
-
-  if (url.GetProtocol().empty())
+  if (GetScheme(strPath).empty())
     return false;
 
-  if (url.IsProtocol("stack"))
+  if (IsStack(strPath))
     return IsNetworkFilesystem(CStackDirectory::GetFirstStackedFile(strPath));
 
   if (IsStreamedFilesystem(strPath))
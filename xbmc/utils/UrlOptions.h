@@ -20,8 +20,13 @@ public:
 
   CUrlOptions();
   CUrlOptions(const std::string &options, const char *strLead = "");
+  CUrlOptions(const CUrlOptions&) = default;
+  CUrlOptions(CUrlOptions&&) = default;
   virtual ~CUrlOptions();
 
+  CUrlOptions& operator=(const CUrlOptions&) = default;
+  CUrlOptions& operator=(CUrlOptions&&) = default;
+
   void Clear() { m_options.clear(); m_strLead.clear(); }
 
   const UrlOptions& GetOptions() const { return m_options; }
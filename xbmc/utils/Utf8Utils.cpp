@@ -8,6 +8,25 @@
 
 #include "Utf8Utils.h"
 
+#include <cstdint>
+#include <cstring>
+
+// skip US-ASCII characters 8 at a time, returns the position of the next non-ASCII byte or a
+// position less than 8 bytes before the end
+inline size_t CUtf8Utils::SkipAscii(const char* str, size_t pos, size_t len)
+{
+  constexpr uint64_t highBits = 0x8080808080808080ULL;
+  uint64_t chunk;
+  while (pos + sizeof(chunk) <= len)
+  {
+    std::memcpy(&chunk, str + pos, sizeof(chunk));
+    if (chunk & highBits)
+      break;
+    pos += sizeof(chunk);
+  }
+  return pos;
+}
+
 
 CUtf8Utils::utf8CheckResult CUtf8Utils::checkStrForUtf8(const std::string& str)
 {
@@ -18,6 +37,10 @@ CUtf8Utils::utf8CheckResult CUtf8Utils::checkStrForUtf8(const std::string& str)
 
   while (pos < len)
   {
+    pos = SkipAscii(strC, pos, len);
+    if (pos == len)
+      break;
+
     const size_t chrLen = SizeOfUtf8Char(strC + pos);
     if (chrLen == 0)
       return hiAscii; // non valid UTF-8 sequence
@@ -146,3 +169,95 @@ inline size_t CUtf8Utils::SizeOfUtf8Char(const char* const str)
 
   return 0; // invalid UTF-8 char sequence
 }
+
+bool CUtf8Utils::Utf8ToUtf32(const std::string& str, std::u32string& utf32, bool failOnBadChar)
+{
+  const char* const strC = str.c_str();
+  const unsigned char* const strU = reinterpret_cast<const unsigned char*>(strC);
+  const size_t len = str.length();
+
+  // UTF-32 never has more characters than UTF-8 has bytes
+  utf32.resize(len);
+  char32_t* out = utf32.data();
+
+  size_t pos = 0;
+  while (pos < len)
+  {
+    const size_t asciiEnd = SkipAscii(strC, pos, len);
+    while (pos < asciiEnd)
+      *out++ = strU[pos++];
+    if (pos == len)
+      break;
+
+    const unsigned char chr = strU[pos];
+    switch (SizeOfUtf8Char(strC + pos))
+    {
+      case 1:
+        *out++ = chr;
+        pos += 1;
+        break;
+      case 2:
+        *out++ = ((chr & 0x1F) << 6) | (strU[pos + 1] & 0x3F);
+        pos += 2;
+        break;
+      case 3:
+        *out++ = ((chr & 0x0F) << 12) | ((strU[pos + 1] & 0x3F) << 6) | (strU[pos + 2] & 0x3F);
+        pos += 3;
+        break;
+      case 4:
+        *out++ = ((chr & 0x07) << 18) | ((strU[pos + 1] & 0x3F) << 12) |
+                 ((strU[pos + 2] & 0x3F) << 6) | (strU[pos + 3] & 0x3F);
+        pos += 4;
+        break;
+      default:
+        if (failOnBadChar)
+        {
+          utf32.clear();
+          return false;
+        }
+        pos++; // skip the invalid byte
+        break;
+    }
+  }
+
+  utf32.resize(out - utf32.data());
+  return true;
+}
+
+bool CUtf8Utils::Utf32ToUtf8(const std::u32string& str, std::string& utf8, bool failOnBadChar)
+{
+  utf8.resize(str.length() * 4);
+  char* out = utf8.data();
+
+  for (const char32_t chr : str)
+  {
+    if (chr < 0x80)
+      *out++ = static_cast<char>(chr);
+    else if (chr < 0x800)
+    {
+      *out++ = static_cast<char>(0xC0 | (chr >> 6));
+      *out++ = static_cast<char>(0x80 | (chr & 0x3F));
+    }
+    else if (chr < 0x10000 && (chr < 0xD800 || chr > 0xDFFF))
+    {
+      *out++ = static_cast<char>(0xE0 | (chr >> 12));
+      *out++ = static_cast<char>(0x80 | ((chr >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (chr & 0x3F));
+    }
+    else if (chr >= 0x10000 && chr <= 0x10FFFF)
+    {
+      *out++ = static_cast<char>(0xF0 | (chr >> 18));
+      *out++ = static_cast<char>(0x80 | ((chr >> 12) & 0x3F));
+      *out++ = static_cast<char>(0x80 | ((chr >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (chr & 0x3F));
+    }
+    else if (failOnBadChar)
+    {
+      utf8.clear();
+      return false;
+    }
+  }
+
+  utf8.resize(out - utf8.data());
+  return true;
+}
@@ -37,6 +37,26 @@ public:
   static size_t RFindValidUtf8Char(const std::string& str, const size_t startPos);
 
   static size_t SizeOfUtf8Char(const std::string& str, const size_t charStart = 0);
+
+  /**
+   * Convert UTF-8 to UTF-32 without iconv, invalid sequences are skipped like iconv does
+   * @param str string to convert
+   * @param utf32 converted string
+   * @param failOnBadChar fail on invalid sequences instead of skipping them
+   * @return false if failOnBadChar is set and str is not valid UTF-8
+   */
+  static bool Utf8ToUtf32(const std::string& str, std::u32string& utf32, bool failOnBadChar);
+
+  /**
+   * Convert UTF-32 to UTF-8 without iconv, invalid code points are skipped
+   * @param str string to convert
+   * @param utf8 converted string
+   * @param failOnBadChar fail on invalid code points instead of skipping them
+   * @return false if failOnBadChar is set and str contains invalid code points
+   */
+  static bool Utf32ToUtf8(const std::u32string& str, std::string& utf8, bool failOnBadChar);
+
 private:
+  static size_t SkipAscii(const char* str, size_t pos, size_t len);
   static size_t SizeOfUtf8Char(const char* const str);
 };
@@ -13,6 +13,7 @@
 #include <charconv>
 #include <cstdlib>
 #include <cstring>
+#include <iterator>
 #include <string>
 #include <utility>
 #include <variant>
@@ -285,12 +286,14 @@ CVariant::CVariant(std::map<std::string, std::string>&& strMap)
 }
 
 CVariant::CVariant(const std::map<std::string, CVariant>& variantMap)
-  : m_data(std::in_place_type<VariantMap>, variantMap)
+  : m_data(std::in_place_type<VariantMap>, variantMap.begin(), variantMap.end())
 {
 }
 
 CVariant::CVariant(std::map<std::string, CVariant>&& variantMap)
-  : m_data(std::in_place_type<VariantMap>, std::move(variantMap))
+  : m_data(std::in_place_type<VariantMap>,
+           std::make_move_iterator(variantMap.begin()),
+           std::make_move_iterator(variantMap.end()))
 {
 }
 
@@ -464,19 +467,25 @@ std::wstring CVariant::asWideString(std::wstring_view fallback /*= L""*/) &&
                     m_data);
 }
 
-CVariant& CVariant::operator[](const std::string& key) &
+CVariant& CVariant::operator[](std::string_view key) &
 {
   if (type() == VariantTypeNull)
   {
     m_data = VariantMap{};
   }
 
-  return std::visit(overloaded{[&](VariantMap& m) -> CVariant& { return m[key]; },
+  return std::visit(overloaded{[&](VariantMap& m) -> CVariant& {
+                                 // only allocate the key when it is inserted
+                                 auto it = m.lower_bound(key);
+                                 if (it == m.end() || it->first != key)
+                                   it = m.emplace_hint(it, std::string(key), CVariant());
+                                 return it->second;
+                               },
                                [](auto&) -> CVariant& { return ConstNullVariant; }},
                     m_data);
 }
 
-const CVariant& CVariant::operator[](const std::string& key) const&
+const CVariant& CVariant::operator[](std::string_view key) const&
 {
   return std::visit(overloaded{[&](const VariantMap& m) -> const CVariant& {
                                  auto it = m.find(key);
@@ -486,7 +495,7 @@ const CVariant& CVariant::operator[](const std::string& key) const&
                     m_data);
 }
 
-CVariant CVariant::operator[](const std::string& key) &&
+CVariant CVariant::operator[](std::string_view key) &&
 {
   return std::visit(overloaded{[&](VariantMap& m) -> CVariant {
                                  auto it = m.find(key);
@@ -687,9 +696,14 @@ void CVariant::clear()
              m_data);
 }
 
-void CVariant::erase(const std::string &key)
+void CVariant::erase(std::string_view key)
 {
-  std::visit(overloaded{[&](Null&) { m_data = VariantMap{}; }, [&](VariantMap& m) { m.erase(key); },
+  std::visit(overloaded{[&](Null&) { m_data = VariantMap{}; },
+                        [&](VariantMap& m) {
+                          auto it = m.find(key);
+                          if (it != m.end())
+                            m.erase(it);
+                        },
                         [](const auto&) {}},
              m_data);
 }
@@ -701,7 +715,7 @@ void CVariant::erase(unsigned int position)
              m_data);
 }
 
-bool CVariant::isMember(const std::string &key) const
+bool CVariant::isMember(std::string_view key) const
 {
   return std::visit(overloaded{[&](const VariantMap& m) { return m.find(key) != m.end(); },
                                [](const auto&) { return false; }},
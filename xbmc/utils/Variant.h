@@ -100,9 +100,9 @@ public:
   double asDouble(double fallback = 0.0) const;
   float asFloat(float fallback = 0.0f) const;
 
-  CVariant& operator[](const std::string& key) &;
-  const CVariant& operator[](const std::string& key) const&;
-  CVariant operator[](const std::string& key) &&;
+  CVariant& operator[](std::string_view key) &;
+  const CVariant& operator[](std::string_view key) const&;
+  CVariant operator[](std::string_view key) &&;
   CVariant& operator[](unsigned int position) &;
   const CVariant& operator[](unsigned int position) const&;
   CVariant operator[](unsigned int position) &&;
@@ -124,7 +124,8 @@ public:
 
 private:
   typedef std::vector<CVariant> VariantArray;
-  typedef std::map<std::string, CVariant> VariantMap;
+  // transparent comparison, so looking up a key does not construct a std::string from it
+  typedef std::map<std::string, CVariant, std::less<>> VariantMap;
 
 public:
   typedef VariantArray::iterator        iterator_array;
@@ -146,10 +147,10 @@ public:
   unsigned int size() const;
   bool empty() const;
   void clear();
-  void erase(const std::string &key);
+  void erase(std::string_view key);
   void erase(unsigned int position);
 
-  bool isMember(const std::string &key) const;
+  bool isMember(std::string_view key) const;
 
   static CVariant ConstNullVariant;
 
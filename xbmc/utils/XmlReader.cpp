@@ -0,0 +1,318 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "XmlReader.h"
+
+#include <cstdlib>
+
+namespace
+{
+bool IsWhitespace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+bool IsNameEnd(char c)
+{
+  return IsWhitespace(c) || c == '/' || c == '>' || c == '=';
+}
+
+void AppendUtf8(std::string& str, unsigned long codepoint)
+{
+  if (codepoint < 0x80)
+    str += static_cast<char>(codepoint);
+  else if (codepoint < 0x800)
+  {
+    str += static_cast<char>(0xC0 | (codepoint >> 6));
+    str += static_cast<char>(0x80 | (codepoint & 0x3F));
+  }
+  else if (codepoint < 0x10000)
+  {
+    str += static_cast<char>(0xE0 | (codepoint >> 12));
+    str += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    str += static_cast<char>(0x80 | (codepoint & 0x3F));
+  }
+  else if (codepoint < 0x110000)
+  {
+    str += static_cast<char>(0xF0 | (codepoint >> 18));
+    str += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+    str += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    str += static_cast<char>(0x80 | (codepoint & 0x3F));
+  }
+}
+} // unnamed namespace
+
+CXmlReader::Node CXmlReader::Next()
+{
+  if (m_error)
+    return Node::ERROR;
+
+  if (m_pendingEnd)
+  {
+    m_pendingEnd = false;
+    return Node::END_ELEMENT;
+  }
+
+  while (m_pos < m_data.size())
+  {
+    if (m_data[m_pos] != '<')
+    {
+      size_t end = m_data.find('<', m_pos);
+      if (end == std::string_view::npos)
+        end = m_data.size();
+      const std::string_view raw = m_data.substr(m_pos, end - m_pos);
+      m_pos = end;
+
+      bool whitespace = true;
+      for (char c : raw)
+      {
+        if (!IsWhitespace(c))
+        {
+          whitespace = false;
+          break;
+        }
+      }
+      if (whitespace)
+        continue;
+      if (m_elements.empty())
+        return Fail();
+
+      Decode(raw, m_text);
+      return Node::TEXT;
+    }
+
+    const std::string_view rest = m_data.substr(m_pos);
+    if (rest.compare(0, 4, "<!--") == 0)
+    {
+      const size_t end = m_data.find("-->", m_pos + 4);
+      if (end == std::string_view::npos)
+        return Fail();
+      m_pos = end + 3;
+    }
+    else if (rest.compare(0, 9, "<![CDATA[") == 0)
+    {
+      const size_t end = m_data.find("]]>", m_pos + 9);
+      if (end == std::string_view::npos || m_elements.empty())
+        return Fail();
+      m_text.assign(m_data.substr(m_pos + 9, end - m_pos - 9));
+      m_pos = end + 3;
+      return Node::TEXT;
+    }
+    else if (rest.compare(0, 2, "<?") == 0)
+    {
+      const size_t end = m_data.find("?>", m_pos + 2);
+      if (end == std::string_view::npos)
+        return Fail();
+      m_pos = end + 2;
+    }
+    else if (rest.compare(0, 2, "<!") == 0)
+    {
+      // doctype, possibly with an internal subset in brackets
+      size_t end = m_data.find_first_of("[>", m_pos + 2);
+      if (end != std::string_view::npos && m_data[end] == '[')
+        end = m_data.find("]>", end);
+      if (end == std::string_view::npos)
+        return Fail();
+      m_pos = m_data.find('>', end) + 1;
+    }
+    else if (rest.compare(0, 2, "</") == 0)
+      return ReadEndElement();
+    else
+      return ReadStartElement();
+  }
+
+  if (!m_elements.empty())
+    return Fail();
+  return Node::END;
+}
+
+const std::string* CXmlReader::GetAttribute(const std::string& name) const
+{
+  for (const auto& attribute : m_attributes)
+  {
+    if (attribute.first == name)
+      return &attribute.second;
+  }
+  return nullptr;
+}
+
+bool CXmlReader::SkipElement()
+{
+  const size_t depth = m_elements.size() - (m_pendingEnd ? 0 : 1);
+  while (true)
+  {
+    switch (Next())
+    {
+      case Node::END_ELEMENT:
+        if (m_elements.size() == depth)
+          return true;
+        break;
+      case Node::END:
+      case Node::ERROR:
+        return false;
+      default:
+        break;
+    }
+  }
+}
+
+std::string_view CXmlReader::ReadElementSource()
+{
+  const size_t start = m_elementStart;
+  if (!SkipElement())
+    return {};
+  return m_data.substr(start, m_pos - start);
+}
+
+CXmlReader::Node CXmlReader::Fail()
+{
+  m_error = true;
+  return Node::ERROR;
+}
+
+CXmlReader::Node CXmlReader::ReadStartElement()
+{
+  // a document has a single root element
+  if (m_elements.empty() && m_rootRead)
+    return Fail();
+
+  m_rootRead = true;
+  m_elementStart = m_pos++;
+  if (!ReadName())
+    return Fail();
+
+  m_attributes.clear();
+  while (true)
+  {
+    SkipWhitespace();
+    if (m_pos >= m_data.size())
+      return Fail();
+
+    if (m_data[m_pos] == '>')
+    {
+      ++m_pos;
+      m_elements.emplace_back(m_name);
+      return Node::START_ELEMENT;
+    }
+    if (m_data.compare(m_pos, 2, "/>") == 0)
+    {
+      m_pos += 2;
+      m_pendingEnd = true;
+      return Node::START_ELEMENT;
+    }
+
+    const size_t nameStart = m_pos;
+    while (m_pos < m_data.size() && !IsNameEnd(m_data[m_pos]))
+      ++m_pos;
+    const std::string_view name = m_data.substr(nameStart, m_pos - nameStart);
+    SkipWhitespace();
+    if (name.empty() || m_pos >= m_data.size() || m_data[m_pos] != '=')
+      return Fail();
+    ++m_pos;
+    SkipWhitespace();
+    if (m_pos >= m_data.size() || (m_data[m_pos] != '"' && m_data[m_pos] != '\''))
+      return Fail();
+
+    const char quote = m_data[m_pos++];
+    const size_t end = m_data.find(quote, m_pos);
+    if (end == std::string_view::npos)
+      return Fail();
+
+    auto& attribute = m_attributes.emplace_back(std::string(name), std::string());
+    Decode(m_data.substr(m_pos, end - m_pos), attribute.second);
+    m_pos = end + 1;
+  }
+}
+
+CXmlReader::Node CXmlReader::ReadEndElement()
+{
+  m_pos += 2;
+  if (!ReadName())
+    return Fail();
+  SkipWhitespace();
+  if (m_pos >= m_data.size() || m_data[m_pos] != '>' || m_elements.empty() ||
+      m_elements.back() != m_name)
+    return Fail();
+
+  ++m_pos;
+  m_elements.pop_back();
+  return Node::END_ELEMENT;
+}
+
+bool CXmlReader::ReadName()
+{
+  const size_t start = m_pos;
+  while (m_pos < m_data.size() && !IsNameEnd(m_data[m_pos]))
+    ++m_pos;
+  m_name.assign(m_data.substr(start, m_pos - start));
+  return !m_name.empty();
+}
+
+void CXmlReader::SkipWhitespace()
+{
+  while (m_pos < m_data.size() && IsWhitespace(m_data[m_pos]))
+    ++m_pos;
+}
+
+void CXmlReader::Decode(std::string_view raw, std::string& decoded) const
+{
+  decoded.clear();
+  decoded.reserve(raw.size());
+
+  size_t pos = 0;
+  while (pos < raw.size())
+  {
+    const size_t amp = raw.find('&', pos);
+    if (amp == std::string_view::npos)
+    {
+      decoded.append(raw.substr(pos));
+      break;
+    }
+    decoded.append(raw.substr(pos, amp - pos));
+    pos = amp + 1;
+
+    // unknown entities and stray '&' are kept as they are, like CXBMCTinyXML does
+    const size_t semicolon = raw.find(';', amp);
+    if (semicolon == std::string_view::npos || semicolon - amp > 10)
+    {
+      decoded += '&';
+      continue;
+    }
+
+    const std::string entity(raw.substr(amp + 1, semicolon - amp - 1));
+    if (entity == "amp")
+      decoded += '&';
+    else if (entity == "lt")
+      decoded += '<';
+    else if (entity == "gt")
+      decoded += '>';
+    else if (entity == "quot")
+      decoded += '"';
+    else if (entity == "apos")
+      decoded += '\'';
+    else if (entity.size() > 1 && entity[0] == '#')
+    {
+      const bool hex = entity[1] == 'x' || entity[1] == 'X';
+      const char* digits = entity.c_str() + (hex ? 2 : 1);
+      char* end = nullptr;
+      const unsigned long codepoint = std::strtoul(digits, &end, hex ? 16 : 10);
+      if (*digits == '\0' || *end != '\0' || codepoint == 0)
+      {
+        decoded += '&';
+        continue;
+      }
+      AppendUtf8(decoded, codepoint);
+    }
+    else
+    {
+      decoded += '&';
+      continue;
+    }
+    pos = semicolon + 1;
+  }
+}
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Forward only pull parser for large XML documents, e.g. the addons.xml of a repository
+ *
+ * Unlike CXBMCTinyXML no DOM is built: the document is visited node by node and the caller decides
+ * which elements it is interested in. Those can be skipped without decoding them, or their source
+ * can be handed to CXBMCTinyXML on its own, so that at most one of them is held as DOM at a time.
+ *
+ * Comments, processing instructions and doctype declarations are skipped, as is text that consists
+ * of white space only. Empty elements (<a/>) are reported as a start and an end element. The data
+ * has to outlive the reader.
+ */
+class CXmlReader
+{
+public:
+  enum class Node
+  {
+    START_ELEMENT,
+    END_ELEMENT,
+    TEXT,
+    END, ///< end of the document
+    ERROR ///< malformed document, the reader stays in this state
+  };
+
+  explicit CXmlReader(std::string_view data) : m_data(data) {}
+
+  /*!
+   * \brief Advance to the next node
+   */
+  Node Next();
+
+  /*!
+   * \brief The name of the current start or end element
+   */
+  const std::string& GetName() const { return m_name; }
+
+  /*!
+   * \brief The decoded text of the current text node
+   */
+  const std::string& GetText() const { return m_text; }
+
+  /*!
+   * \brief Get the decoded value of an attribute of the current start element
+   * \return nullptr if the element has no such attribute
+   */
+  const std::string* GetAttribute(const std::string& name) const;
+
+  /*!
+   * \brief The number of elements the reader is inside of, including the current start element
+   */
+  size_t GetDepth() const { return m_elements.size(); }
+
+  /*!
+   * \brief Skip the rest of the current start element including all its children
+   * \return false if the document ended or is malformed before the element was closed
+   */
+  bool SkipElement();
+
+  /*!
+   * \brief Skip the rest of the current start element and get its complete source, from its start
+   * tag up to and including its end tag
+   * \return an empty view if the document ended or is malformed before the element was closed
+   */
+  std::string_view ReadElementSource();
+
+private:
+  Node Fail();
+  Node ReadStartElement();
+  Node ReadEndElement();
+  bool ReadName();
+  void SkipWhitespace();
+  void Decode(std::string_view raw, std::string& decoded) const;
+
+  std::string_view m_data;
+  size_t m_pos = 0;
+  size_t m_elementStart = 0;
+  bool m_error = false;
+  bool m_rootRead = false;
+  bool m_pendingEnd = false;
+  std::string m_name;
+  std::string m_text;
+  std::vector<std::pair<std::string, std::string>> m_attributes;
+  std::vector<std::string> m_elements;
+};
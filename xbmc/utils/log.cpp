@@ -17,6 +17,7 @@
 #include "settings/SettingsComponent.h"
 #include "settings/lib/Setting.h"
 #include "settings/lib/SettingsManager.h"
+#include "utils/AsyncLogSink.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 
@@ -32,6 +33,7 @@ namespace
 static constexpr unsigned char Utf8Bom[3] = {0xEF, 0xBB, 0xBF};
 static const std::string LogFileExtension = ".log";
 static const std::string LogPattern = "%Y-%m-%d %T.%e T:%-5t %7l <%n>: %v";
+static constexpr size_t AsyncLogCapacity = 8192;
 } // namespace
 
 CLog::CLog()
@@ -157,6 +159,36 @@ void CLog::Deinitialize()
   m_fileSink.reset();
 }
 
+void CLog::SetAsync(bool async, bool dropOnOverflow)
+{
+  if (m_fileSink == nullptr)
+    return;
+
+  auto asyncSink = std::dynamic_pointer_cast<CAsyncLogSink>(m_fileSink);
+  if (static_cast<bool>(asyncSink) == async)
+    return;
+
+  // the file sink isn't thread safe, so the async sink is gone before the file sink is used
+  // directly again
+  m_sinks->remove_sink(m_fileSink);
+  if (async)
+  {
+    m_fileSink = std::make_shared<CAsyncLogSink>(m_fileSink, AsyncLogCapacity,
+                                                 dropOnOverflow
+                                                     ? CAsyncLogSink::OverflowPolicy::DROP
+                                                     : CAsyncLogSink::OverflowPolicy::BLOCK);
+  }
+  else
+  {
+    m_fileSink = asyncSink->GetTarget();
+    asyncSink.reset();
+  }
+  m_sinks->add_sink(m_fileSink);
+
+  FormatAndLogInternal(spdlog::level::info, "Log file is written {}",
+                       async ? "asynchronously" : "synchronously");
+}
+
 void CLog::SetLogLevel(int level)
 {
   if (level < LOG_LEVEL_NONE || level > LOG_LEVEL_MAX)
@@ -74,6 +74,13 @@ public:
   void UnregisterFromSettings();
   void Deinitialize();
 
+  /*!
+   * \brief Write the log file from a background thread, so that logging doesn't wait for file I/O
+   * \param async true to write asynchronously
+   * \param dropOnOverflow true to drop messages when the writer can't keep up, false to wait
+   */
+  void SetAsync(bool async, bool dropOnOverflow);
+
   void SetLogLevel(int level);
   int GetLogLevel() { return m_logLevel; }
   bool IsLogLevelLogged(int loglevel);
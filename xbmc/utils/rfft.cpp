@@ -14,9 +14,13 @@
 #include <math.h>
 
 RFFT::RFFT(int size, bool windowed) :
-  m_size(size), m_windowed(windowed)
+  m_size(size), m_windowed(windowed),
+  m_linput(m_size), m_rinput(m_size),
+  m_loutput(m_size / 2 + 1), m_routput(m_size / 2 + 1)
 {
   m_cfg = kiss_fftr_alloc(m_size,0,nullptr,nullptr);
+  if (m_windowed)
+    m_window = hann(m_size);
 }
 
 RFFT::~RFFT()
@@ -30,44 +34,49 @@ RFFT::~RFFT()
 
 void RFFT::calc(const float* input, float* output)
 {
-  // temporary buffers
-  std::vector<kiss_fft_scalar> linput(m_size), rinput(m_size);
-  std::vector<kiss_fft_cpx> loutput(m_size), routput(m_size);
+  kiss_fft_scalar* const linput = m_linput.data();
+  kiss_fft_scalar* const rinput = m_rinput.data();
 
-  for (size_t i=0;i<m_size;++i)
+  // deinterleave and window in one pass, the loops have no dependencies between iterations so
+  // that the compiler can vectorize them
+  if (m_windowed)
   {
-    linput[i] = input[2*i];
-    rinput[i] = input[2*i+1];
+    const kiss_fft_scalar* const window = m_window.data();
+    for (size_t i=0;i<m_size;++i)
+    {
+      linput[i] = input[2*i] * window[i];
+      rinput[i] = input[2*i+1] * window[i];
+    }
   }
-
-  if (m_windowed)
+  else
   {
-    hann(linput);
-    hann(rinput);
+    for (size_t i=0;i<m_size;++i)
+    {
+      linput[i] = input[2*i];
+      rinput[i] = input[2*i+1];
+    }
   }
 
   // transform channels
-  kiss_fftr(m_cfg, &linput[0], &loutput[0]);
-  kiss_fftr(m_cfg, &rinput[0], &routput[0]);
+  kiss_fftr(m_cfg, linput, m_loutput.data());
+  kiss_fftr(m_cfg, rinput, m_routput.data());
 
-  auto&& filter = [&](kiss_fft_cpx& data)
-  {
-    return static_cast<double>(sqrt(data.r * data.r + data.i * data.i)) * 2.0 / m_size *
-           (m_windowed ? sqrt(8.0 / 3.0) : 1.0);
-  };
+  const float scale = 2.0f / m_size * (m_windowed ? sqrtf(8.0f / 3.0f) : 1.0f);
+  const kiss_fft_cpx* const loutput = m_loutput.data();
+  const kiss_fft_cpx* const routput = m_routput.data();
 
   // interleave while taking magnitudes and normalizing
   for (size_t i=0;i<m_size/2;++i)
   {
-    output[2*i] = filter(loutput[i]);
-    output[2*i+1] = filter(routput[i]);
+    output[2*i] = sqrtf(loutput[i].r * loutput[i].r + loutput[i].i * loutput[i].i) * scale;
+    output[2*i+1] = sqrtf(routput[i].r * routput[i].r + routput[i].i * routput[i].i) * scale;
   }
 }
 
-#include <iostream>
-
-void RFFT::hann(std::vector<kiss_fft_scalar>& data)
+std::vector<kiss_fft_scalar> RFFT::hann(size_t size)
 {
-  for (size_t i=0;i<data.size();++i)
-    data[i] *= 0.5f * (1.0f - cos(2.0f * static_cast<float>(M_PI) * i / (data.size() - 1)));
+  std::vector<kiss_fft_scalar> window(size);
+  for (size_t i=0;i<size;++i)
+    window[i] = 0.5f * (1.0f - cos(2.0f * static_cast<float>(M_PI) * i / (size - 1)));
+  return window;
 }
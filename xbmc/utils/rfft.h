@@ -29,11 +29,16 @@ public:
   //! \param output Output data of size m_size.
   void calc(const float* input, float* output);
 protected:
-  //! \brief Apply a Hann window to a buffer.
-  //! \param data Vector with data to apply window to.
-  static void hann(std::vector<kiss_fft_scalar>& data);
+  //! \brief Create the coefficients of a Hann window.
+  //! \param size Length of the window.
+  static std::vector<kiss_fft_scalar> hann(size_t size);
 
   size_t m_size;       //!< Size for a single channel.
   bool m_windowed;     //!< Whether or not a Hann window is applied.
   kiss_fftr_cfg m_cfg; //!< FFT plan
+
+  // Created with the plan, so that calc() neither allocates nor evaluates the window function
+  std::vector<kiss_fft_scalar> m_window;
+  std::vector<kiss_fft_scalar> m_linput, m_rinput;
+  std::vector<kiss_fft_cpx> m_loutput, m_routput;
 };
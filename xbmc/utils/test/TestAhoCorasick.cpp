@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/AhoCorasick.h"
+
+#include <gtest/gtest.h>
+
+TEST(TestAhoCorasick, Find)
+{
+  CAhoCorasick automaton;
+  const size_t he = automaton.AddKeyword("he");
+  const size_t she = automaton.AddKeyword("she");
+  const size_t his = automaton.AddKeyword("his");
+  const size_t hers = automaton.AddKeyword("hers");
+  automaton.Build();
+  EXPECT_EQ(4u, automaton.GetKeywordCount());
+
+  std::vector<bool> found;
+  automaton.Find("ushers", found);
+  ASSERT_EQ(4u, found.size());
+  EXPECT_TRUE(found[he]);
+  EXPECT_TRUE(found[she]);
+  EXPECT_FALSE(found[his]);
+  EXPECT_TRUE(found[hers]);
+
+  found.assign(4, false);
+  automaton.Find("ahishe", found);
+  EXPECT_TRUE(found[he]);
+  EXPECT_TRUE(found[she]);
+  EXPECT_TRUE(found[his]);
+  EXPECT_FALSE(found[hers]);
+
+  found.assign(4, false);
+  automaton.Find("", found);
+  EXPECT_FALSE(found[he] || found[she] || found[his] || found[hers]);
+}
+
+TEST(TestAhoCorasick, IgnoresAsciiCase)
+{
+  CAhoCorasick automaton;
+  const size_t news = automaton.AddKeyword("News");
+  const size_t umlaut = automaton.AddKeyword("\xC3\xA4rger"); // "ärger"
+  automaton.Build();
+
+  std::vector<bool> found;
+  automaton.Find("Late NEWS tonight", found);
+  EXPECT_TRUE(found[news]);
+  EXPECT_FALSE(found[umlaut]);
+
+  automaton.Find("\xC3\x84RGER", found); // "ÄRGER", only ASCII letters are folded
+  EXPECT_FALSE(found[umlaut]);
+  automaton.Find("viel \xC3\xA4RGER", found);
+  EXPECT_TRUE(found[umlaut]);
+}
+
+TEST(TestAhoCorasick, KeepsFoundFlags)
+{
+  CAhoCorasick automaton;
+  const size_t title = automaton.AddKeyword("title");
+  const size_t plot = automaton.AddKeyword("plot");
+  const size_t empty = automaton.AddKeyword("");
+  automaton.Build();
+
+  std::vector<bool> found;
+  automaton.Find("a title", found);
+  automaton.Find("a plot", found);
+  EXPECT_TRUE(found[title]);
+  EXPECT_TRUE(found[plot]);
+  EXPECT_TRUE(found[empty]);
+}
+
+TEST(TestAhoCorasick, MatchesBruteForce)
+{
+  const std::vector<std::string> keywords = {"a", "ab", "bab", "bc", "bca", "c", "caa", "abcab"};
+  CAhoCorasick automaton;
+  for (const auto& keyword : keywords)
+    automaton.AddKeyword(keyword);
+  automaton.Build();
+
+  // all texts over {a, b, c} up to length 6
+  std::vector<std::string> texts{""};
+  for (size_t i = 0; i < texts.size(); i++)
+  {
+    if (texts[i].size() < 6)
+    {
+      for (const char c : {'a', 'b', 'c'})
+        texts.emplace_back(texts[i] + c);
+    }
+  }
+
+  for (const auto& text : texts)
+  {
+    std::vector<bool> found;
+    automaton.Find(text, found);
+    for (size_t k = 0; k < keywords.size(); k++)
+      EXPECT_EQ(text.find(keywords[k]) != std::string::npos, found[k]) << text << " " << keywords[k];
+  }
+}
@@ -220,6 +220,28 @@ TEST_F(TestArchive, StringArchive)
   EXPECT_STREQ(string_ref.c_str(), string_var.c_str());
 }
 
+TEST_F(TestArchive, LongStringArchive)
+{
+  ASSERT_NE(nullptr, file);
+  // longer than the archive buffer, so it is read across several buffer refills
+  std::string string_ref(3 * CARCHIVE_BUFFER_MAX + 7, 'x'), string_var;
+  std::string string2_ref = "after", string2_var;
+
+  CArchive arstore(file, CArchive::store);
+  arstore << string_ref;
+  arstore << string2_ref;
+  arstore.Close();
+
+  ASSERT_EQ(0, file->Seek(0, SEEK_SET));
+  CArchive arload(file, CArchive::load);
+  arload >> string_var;
+  arload >> string2_var;
+  arload.Close();
+
+  EXPECT_EQ(string_ref, string_var);
+  EXPECT_EQ(string2_ref, string2_var);
+}
+
 TEST_F(TestArchive, SystemTimeArchive)
 {
   ASSERT_NE(nullptr, file);
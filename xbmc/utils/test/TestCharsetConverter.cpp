@@ -121,6 +121,28 @@ TEST_F(TestCharsetConverter, utf8ToW)
   EXPECT_STREQ(refstrw1.c_str(), varstrw1.c_str());
 }
 
+TEST_F(TestCharsetConverter, utf8ToUtf32)
+{
+  // long enough for the ASCII fast path, and with 2, 3 and 4 byte sequences
+  const std::string utf8 = "test utf8ToUtf32 \xc3\xa4\xe2\x82\xac\xf0\x9f\x98\x80 end";
+  const std::u32string utf32 = U"test utf8ToUtf32 \u00e4\u20ac\U0001f600 end";
+  std::u32string varstr32;
+  EXPECT_TRUE(g_charsetConverter.utf8ToUtf32(utf8, varstr32));
+  EXPECT_TRUE(varstr32 == utf32);
+
+  std::string varstr8;
+  EXPECT_TRUE(g_charsetConverter.utf32ToUtf8(utf32, varstr8));
+  EXPECT_EQ(utf8, varstr8);
+
+  // invalid bytes and surrogates fail, or are skipped
+  EXPECT_FALSE(g_charsetConverter.utf8ToUtf32("abc\xff" "def", varstr32, true));
+  EXPECT_TRUE(g_charsetConverter.utf8ToUtf32("abc\xff" "def", varstr32, false));
+  EXPECT_TRUE(varstr32 == U"abcdef");
+  EXPECT_FALSE(g_charsetConverter.utf8ToUtf32("\xed\xa0\x80", varstr32, true));
+  EXPECT_TRUE(g_charsetConverter.utf8ToUtf32("abc\xe2\x82", varstr32, false));
+  EXPECT_TRUE(varstr32 == U"abc");
+}
+
 
 //TEST_F(TestCharsetConverter, utf16LEtoW)
 //{
@@ -0,0 +1,66 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "utils/FileWriteQueue.h"
+#include "utils/JobManager.h"
+#include "utils/StringUtils.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+class TestFileWriteQueue : public testing::Test
+{
+protected:
+  TestFileWriteQueue() { CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>()); }
+
+  ~TestFileWriteQueue() override
+  {
+    CServiceBroker::GetJobManager()->CancelJobs();
+    CServiceBroker::GetJobManager()->Restart();
+    CServiceBroker::UnregisterJobManager();
+  }
+};
+
+TEST_F(TestFileWriteQueue, Wait)
+{
+  std::atomic<int> written{0};
+  CFileWriteQueue writer;
+  for (int i = 0; i < 100; i++)
+  {
+    writer.Write(StringUtils::Format("smb://host{}/share/file{}", i % 3, i), [&written] {
+      written++;
+      return true;
+    });
+  }
+  writer.Write("smb://host0/share/failed", [] { return false; });
+
+  EXPECT_EQ(1u, writer.Wait());
+  EXPECT_EQ(100, written);
+}
+
+TEST_F(TestFileWriteQueue, SameFileInOrder)
+{
+  std::mutex section;
+  std::vector<int> order;
+  CFileWriteQueue writer(4);
+  for (int i = 0; i < 10; i++)
+  {
+    writer.Write("smb://host/share/file", [&section, &order, i] {
+      std::unique_lock<std::mutex> lock(section);
+      order.push_back(i);
+      return true;
+    });
+  }
+
+  EXPECT_EQ(0u, writer.Wait());
+  EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), order);
+}
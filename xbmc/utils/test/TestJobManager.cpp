@@ -211,3 +211,60 @@ TEST_F(TestJobManager, IsProcessing)
 
   job->FinishAndStopBlocking();
 }
+
+TEST_F(TestJobManager, DedicatedJobsDontBlockLowPriority)
+{
+  Flags blocking[2];
+  for (auto& flags : blocking)
+  {
+    CServiceBroker::GetJobManager()->AddJob(new DummyJob(&flags), nullptr,
+                                            CJob::PRIORITY_DEDICATED);
+    ASSERT_TRUE(poll([&flags]() -> bool { return flags.started; }));
+  }
+
+  Flags lowPriority;
+  CServiceBroker::GetJobManager()->AddJob(new ReallyDumbJob(&lowPriority), nullptr,
+                                          CJob::PRIORITY_LOW_PAUSABLE);
+  EXPECT_TRUE(poll([&lowPriority]() -> bool { return lowPriority.finished; }));
+
+  for (auto& flags : blocking)
+    flags.lingerAtWork = false;
+  for (auto& flags : blocking)
+    ASSERT_TRUE(poll([&flags]() -> bool { return flags.finished; }));
+}
+
+TEST_F(TestJobManager, SubmitThen)
+{
+  std::atomic<int> result{0};
+  CServiceBroker::GetJobManager()->SubmitThen([]() { return 42; },
+                                              [&result](int value) { result = value; });
+  EXPECT_TRUE(poll([&result]() -> bool { return result == 42; }));
+
+  std::atomic<bool> first{false};
+  std::atomic<bool> second{false};
+  CServiceBroker::GetJobManager()->SubmitThen([&first]() { first = true; },
+                                              [&first, &second]() { second = first.load(); },
+                                              CJob::PRIORITY_LOW, CJob::PRIORITY_HIGH);
+  EXPECT_TRUE(poll([&second]() -> bool { return second; }));
+}
+
+TEST_F(TestJobManager, Statistics)
+{
+  Flags flags;
+  CServiceBroker::GetJobManager()->AddJob(new ReallyDumbJob(&flags), nullptr);
+  ASSERT_TRUE(poll([&flags]() -> bool { return flags.finished; }));
+
+  std::vector<CJobManager::JobStatistics> stats;
+  EXPECT_TRUE(poll(
+      [&stats]() -> bool
+      {
+        stats = CServiceBroker::GetJobManager()->GetStatistics();
+        return stats.size() == 1 && stats[0].completed == 1;
+      }));
+  EXPECT_EQ(0u, stats[0].cancelled);
+  EXPECT_EQ(0u, stats[0].running);
+  EXPECT_EQ(1u, stats[0].maxRunning);
+
+  CServiceBroker::GetJobManager()->ResetStatistics();
+  EXPECT_TRUE(CServiceBroker::GetJobManager()->GetStatistics().empty());
+}
@@ -0,0 +1,89 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/LoudnessMeter.h"
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::vector<float> StereoSine(unsigned int sampleRate, double frequency, double dBFS, double secs)
+{
+  const double amplitude = std::pow(10.0, dBFS / 20.0);
+  const size_t frames = static_cast<size_t>(sampleRate * secs);
+
+  std::vector<float> samples(frames * 2);
+  for (size_t i = 0; i < frames; ++i)
+  {
+    const float value =
+        static_cast<float>(amplitude * std::sin(2.0 * M_PI * frequency * i / sampleRate));
+    samples[i * 2] = value;
+    samples[i * 2 + 1] = value;
+  }
+  return samples;
+}
+} // unnamed namespace
+
+TEST(TestLoudnessMeter, SineAt48kHz)
+{
+  // EBU Tech 3341 test case 1: stereo 1 kHz sine at -23 dBFS measures -23 LUFS
+  const std::vector<float> samples = StereoSine(48000, 1000.0, -23.0, 20.0);
+
+  CLoudnessMeter meter(48000, {1.0, 1.0});
+  meter.Add(samples.data(), samples.size() / 2);
+
+  double loudness;
+  ASSERT_TRUE(meter.GetIntegratedLoudness(loudness));
+  EXPECT_NEAR(-23.0, loudness, 0.1);
+  EXPECT_NEAR(std::pow(10.0, -23.0 / 20.0), meter.GetPeak(), 0.001);
+}
+
+TEST(TestLoudnessMeter, SineAt44kHz)
+{
+  const std::vector<float> samples = StereoSine(44100, 1000.0, -33.0, 20.0);
+
+  CLoudnessMeter meter(44100, {1.0, 1.0});
+  meter.Add(samples.data(), samples.size() / 2);
+
+  double loudness;
+  ASSERT_TRUE(meter.GetIntegratedLoudness(loudness));
+  EXPECT_NEAR(-33.0, loudness, 0.1);
+}
+
+TEST(TestLoudnessMeter, RelativeGate)
+{
+  // EBU Tech 3341 test case 3: -36 dBFS, -23 dBFS and -36 dBFS for 10 s, 60 s and 10 s, the
+  // quiet parts are below the relative gate
+  std::vector<float> samples = StereoSine(48000, 1000.0, -36.0, 10.0);
+  const std::vector<float> loud = StereoSine(48000, 1000.0, -23.0, 60.0);
+  samples.insert(samples.end(), loud.begin(), loud.end());
+  const std::vector<float> quiet = StereoSine(48000, 1000.0, -36.0, 10.0);
+  samples.insert(samples.end(), quiet.begin(), quiet.end());
+
+  CLoudnessMeter meter(48000, {1.0, 1.0});
+  meter.Add(samples.data(), samples.size() / 2);
+
+  double loudness;
+  ASSERT_TRUE(meter.GetIntegratedLoudness(loudness));
+  EXPECT_NEAR(-23.0, loudness, 0.1);
+}
+
+TEST(TestLoudnessMeter, Silence)
+{
+  const std::vector<float> samples(48000 * 2 * 5, 0.0f);
+
+  CLoudnessMeter meter(48000, {1.0, 1.0});
+  meter.Add(samples.data(), samples.size() / 2);
+
+  double loudness;
+  EXPECT_FALSE(meter.GetIntegratedLoudness(loudness));
+  EXPECT_EQ(0.0f, meter.GetPeak());
+}
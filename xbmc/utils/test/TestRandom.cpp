@@ -0,0 +1,54 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/Random.h"
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestRandom, RandomSamplePicksDistinctElements)
+{
+  std::vector<int> values(1000);
+  std::iota(values.begin(), values.end(), 0);
+
+  const auto end = KODI::UTILS::RandomSample(values.begin(), values.end(), 10);
+  ASSERT_EQ(end - values.begin(), 10);
+
+  // the range is only reordered, so the picked elements are distinct and nothing is lost
+  const std::set<int> picked(values.begin(), end);
+  EXPECT_EQ(picked.size(), 10u);
+  std::sort(values.begin(), values.end());
+  for (int i = 0; i < 1000; ++i)
+    EXPECT_EQ(values[i], i);
+}
+
+TEST(TestRandom, RandomSampleOfWholeRange)
+{
+  std::vector<int> values{1, 2, 3};
+  EXPECT_EQ(KODI::UTILS::RandomSample(values.begin(), values.end(), 5), values.end());
+
+  std::vector<int> empty;
+  EXPECT_EQ(KODI::UTILS::RandomSample(empty.begin(), empty.end(), 5), empty.end());
+}
+
+TEST(TestRandom, RandomSampleCoversRange)
+{
+  // picking one element many times should eventually pick every one of them
+  std::set<int> picked;
+  for (int i = 0; i < 1000 && picked.size() < 5; ++i)
+  {
+    std::vector<int> values{0, 1, 2, 3, 4};
+    KODI::UTILS::RandomSample(values.begin(), values.end(), 1);
+    picked.insert(values.front());
+  }
+  EXPECT_EQ(picked.size(), 5u);
+}
@@ -123,6 +123,28 @@ TEST(TestRegExp, operatorEqual)
   EXPECT_STREQ("string", match.c_str());
 }
 
+TEST(TestRegExp, SharedPattern)
+{
+  CRegExp regex1, regex2(true);
+
+  // same expression, one compiled pattern, but independent matches
+  EXPECT_TRUE(regex1.RegComp("s([0-9]+)e([0-9]+)"));
+  EXPECT_TRUE(regex2.RegComp("s([0-9]+)e([0-9]+)"));
+  EXPECT_TRUE(regex1.RegComp("s([0-9]+)e([0-9]+)"));
+  EXPECT_EQ(5, regex1.RegFind("show.s01e02.mkv"));
+  EXPECT_EQ(-1, regex1.RegFind("show.S03E04.mkv"));
+  EXPECT_EQ(5, regex2.RegFind("show.S03E04.mkv"));
+  EXPECT_STREQ("03", regex2.GetMatch(1).c_str());
+
+  {
+    CRegExp regex3(regex1);
+    EXPECT_EQ(0, regex3.RegFind("s05e06"));
+    EXPECT_STREQ("06", regex3.GetMatch(2).c_str());
+  }
+  EXPECT_EQ(5, regex1.RegFind("show.s07e08.mkv"));
+  EXPECT_STREQ("08", regex1.GetMatch(2).c_str());
+}
+
 class TestRegExpLog : public testing::Test
 {
 protected:
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/SeekIndex.h"
+
+#include <gtest/gtest.h>
+
+TEST(TestSeekIndex, EmptyIndex)
+{
+  CSeekIndex index(100);
+  CSeekIndex::Entry entry;
+  EXPECT_TRUE(index.IsEmpty());
+  EXPECT_FALSE(index.Lookup(0, entry));
+}
+
+TEST(TestSeekIndex, StartsAtBeginning)
+{
+  CSeekIndex index(100);
+  index.Add(250, 4096);
+  EXPECT_TRUE(index.IsEmpty());
+
+  index.Add(10, 512);
+  EXPECT_FALSE(index.IsEmpty());
+}
+
+TEST(TestSeekIndex, KeepsOneEntryPerInterval)
+{
+  CSeekIndex index(100);
+  for (int64_t ts = 0; ts < 1000; ts += 26)
+    index.Add(ts, ts * 10);
+
+  CSeekIndex::Entry entry;
+  ASSERT_TRUE(index.Lookup(0, entry));
+  EXPECT_EQ(entry.timestamp, 0);
+
+  ASSERT_TRUE(index.Lookup(150, entry));
+  EXPECT_EQ(entry.timestamp, 104);
+  EXPECT_EQ(entry.pos, 1040);
+
+  ASSERT_TRUE(index.Lookup(208, entry));
+  EXPECT_EQ(entry.timestamp, 208);
+}
+
+TEST(TestSeekIndex, IgnoresGaps)
+{
+  CSeekIndex index(100);
+  index.Add(0, 0);
+  index.Add(100, 1000);
+  // jumped ahead, e.g. after a seek
+  index.Add(500, 5000);
+  // out of file order
+  index.Add(200, 500);
+
+  CSeekIndex::Entry entry;
+  ASSERT_TRUE(index.Lookup(199, entry));
+  EXPECT_EQ(entry.timestamp, 100);
+  EXPECT_FALSE(index.Lookup(200, entry));
+  EXPECT_FALSE(index.Lookup(600, entry));
+
+  index.Add(200, 2000);
+  ASSERT_TRUE(index.Lookup(250, entry));
+  EXPECT_EQ(entry.pos, 2000);
+}
+
+TEST(TestSeekIndex, AllowsGapsUpToMaxGap)
+{
+  // e.g. keyframes of a stream with long and irregular GOPs
+  CSeekIndex index(100, 1000);
+  index.Add(400, 100);
+  index.Add(450, 200);
+  index.Add(1300, 900);
+  index.Add(2400, 1500);
+
+  CSeekIndex::Entry entry;
+  ASSERT_TRUE(index.Lookup(1299, entry));
+  EXPECT_EQ(entry.timestamp, 400);
+  ASSERT_TRUE(index.Lookup(2000, entry));
+  EXPECT_EQ(entry.timestamp, 1300);
+  EXPECT_FALSE(index.Lookup(2200, entry));
+}
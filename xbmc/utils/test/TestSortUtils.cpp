@@ -103,6 +103,29 @@ TEST(TestSortUtils, Sort_SortDescription)
   EXPECT_STREQ("R Artist", (*items.at(6))[FieldArtist].asString().c_str());
 }
 
+TEST(TestSortUtils, Sort_SpecialFolderLimits)
+{
+  SortItems items;
+  const char* titles[] = {"D Title", "C Title", "B Title", "A Title", "E Title"};
+  for (const char* title : titles)
+  {
+    SortItemPtr item(new SortItem());
+    (*item)[FieldTitle] = CVariant(title);
+    items.push_back(item);
+  }
+  (*items[0])[FieldSortSpecial] = CVariant(static_cast<int>(SortSpecialOnTop));
+  (*items[3])[FieldSortSpecial] = CVariant(static_cast<int>(SortSpecialOnBottom));
+  (*items[1])[FieldFolder] = CVariant(false);
+  (*items[2])[FieldFolder] = CVariant(true);
+
+  SortUtils::Sort(SortByTitle, SortOrderAscending, SortAttributeNone, items, 3, 1);
+
+  ASSERT_EQ(3u, items.size());
+  EXPECT_STREQ("B Title", (*items.at(0))[FieldTitle].asString().c_str());
+  EXPECT_STREQ("C Title", (*items.at(1))[FieldTitle].asString().c_str());
+  EXPECT_STREQ("E Title", (*items.at(2))[FieldTitle].asString().c_str());
+}
+
 TEST(TestSortUtils, GetFieldsForSorting)
 {
   Fields fields;
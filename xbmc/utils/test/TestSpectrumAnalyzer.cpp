@@ -0,0 +1,99 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/SpectrumAnalyzer.h"
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::vector<float> StereoSine(unsigned int sampleRate, double frequency, size_t frames)
+{
+  std::vector<float> samples(frames * 2);
+  for (size_t i = 0; i < frames; ++i)
+  {
+    const float value = static_cast<float>(std::sin(2.0 * M_PI * frequency * i / sampleRate));
+    samples[i * 2] = value;
+    samples[i * 2 + 1] = value;
+  }
+  return samples;
+}
+} // unnamed namespace
+
+TEST(TestSpectrumAnalyzer, NothingBeforeFirstBlock)
+{
+  CSpectrumAnalyzer analyzer;
+  analyzer.Reset(48000);
+
+  const std::vector<float> samples = StereoSine(48000, 1000.0, CSpectrumAnalyzer::FFT_SIZE - 1);
+  analyzer.Add(samples.data(), samples.size());
+
+  std::vector<float> spectrum(CSpectrumAnalyzer::FFT_SIZE);
+  EXPECT_EQ(analyzer.GetSpectrum(spectrum.data(), spectrum.size()), 0u);
+  EXPECT_EQ(analyzer.GetLevel(), 0);
+}
+
+TEST(TestSpectrumAnalyzer, SineInOneBand)
+{
+  CSpectrumAnalyzer analyzer;
+  analyzer.Reset(48000);
+
+  // added in odd chunks, so that blocks span several calls
+  const std::vector<float> samples = StereoSine(48000, 1500.0, 4 * CSpectrumAnalyzer::FFT_SIZE);
+  for (size_t pos = 0; pos < samples.size(); pos += 300)
+    analyzer.Add(samples.data() + pos, std::min<size_t>(300, samples.size() - pos));
+
+  std::vector<float> spectrum(CSpectrumAnalyzer::FFT_SIZE);
+  ASSERT_EQ(analyzer.GetSpectrum(spectrum.data(), spectrum.size()), spectrum.size());
+
+  // 1500 Hz falls on bin 16 at 93.75 Hz per bin
+  size_t peak = 0;
+  for (size_t bin = 0; bin < spectrum.size() / 2; ++bin)
+  {
+    EXPECT_FLOAT_EQ(spectrum[2 * bin], spectrum[2 * bin + 1]);
+    if (spectrum[2 * bin] > spectrum[2 * peak])
+      peak = bin;
+  }
+  EXPECT_EQ(peak, 16u);
+
+  // a full scale sine is 3 dB below a full scale square wave
+  EXPECT_NEAR(analyzer.GetLevel(), 95, 1);
+
+  unsigned int loudest = 0;
+  for (unsigned int band = 0; band < CSpectrumAnalyzer::NUM_BANDS; ++band)
+  {
+    if (analyzer.GetBand(band) > analyzer.GetBand(loudest))
+      loudest = band;
+  }
+  EXPECT_GT(analyzer.GetBand(loudest), 90);
+  EXPECT_GT(loudest, 0u);
+  EXPECT_LT(loudest, CSpectrumAnalyzer::NUM_BANDS - 1);
+  EXPECT_LT(analyzer.GetBand(0), 50);
+  EXPECT_LT(analyzer.GetBand(CSpectrumAnalyzer::NUM_BANDS - 1), 50);
+  EXPECT_EQ(analyzer.GetBand(CSpectrumAnalyzer::NUM_BANDS), 0);
+}
+
+TEST(TestSpectrumAnalyzer, ResetDropsResults)
+{
+  CSpectrumAnalyzer analyzer;
+  analyzer.Reset(44100);
+
+  const std::vector<float> samples = StereoSine(44100, 440.0, CSpectrumAnalyzer::FFT_SIZE);
+  analyzer.Add(samples.data(), samples.size());
+  EXPECT_GT(analyzer.GetLevel(), 0);
+
+  analyzer.Reset(44100);
+  float value;
+  EXPECT_EQ(analyzer.GetSpectrum(&value, 1), 0u);
+  EXPECT_EQ(analyzer.GetLevel(), 0);
+  for (unsigned int band = 0; band < CSpectrumAnalyzer::NUM_BANDS; ++band)
+    EXPECT_EQ(analyzer.GetBand(band), 0);
+}
@@ -0,0 +1,36 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/TransformMatrix.h"
+
+#include <gtest/gtest.h>
+
+TEST(TestTransformMatrix, TransformQuad)
+{
+  TransformMatrix matrix = TransformMatrix::CreateTranslation(12.5f, -7.0f, 3.0f);
+  matrix *= TransformMatrix::CreateScaler(1.5f, 0.75f);
+  matrix *= TransformMatrix::CreateZRotation(30.0f, 100.0f, 50.0f, 16.0f / 9.0f);
+
+  const float x1 = 20.0f, y1 = 40.0f, x2 = 220.0f, y2 = 90.0f;
+  float x[4], y[4], z[4];
+  matrix.TransformQuad(x1, y1, x2, y2, x, y, z);
+
+  const float cornersX[4] = {x1, x2, x2, x1};
+  const float cornersY[4] = {y1, y1, y2, y2};
+  for (int i = 0; i < 4; i++)
+  {
+    float expectedX = cornersX[i];
+    float expectedY = cornersY[i];
+    float expectedZ = 0.0f;
+    matrix.TransformPosition(expectedX, expectedY, expectedZ);
+
+    EXPECT_FLOAT_EQ(expectedX, x[i]);
+    EXPECT_FLOAT_EQ(expectedY, y[i]);
+    EXPECT_FLOAT_EQ(expectedZ, z[i]);
+  }
+}
@@ -278,6 +278,8 @@ TEST_F(TestURIUtils, IsDVD)
 TEST_F(TestURIUtils, IsFTP)
 {
   EXPECT_TRUE(URIUtils::IsFTP("ftp://path/in/ftp"));
+  EXPECT_TRUE(URIUtils::IsFTP("FTPS://path/in/ftp"));
+  EXPECT_FALSE(URIUtils::IsFTP("/path/to/ftp"));
 }
 
 TEST_F(TestURIUtils, IsHD)
@@ -305,6 +307,11 @@ TEST_F(TestURIUtils, IsInternetStream)
   CURL url2("https://path/to/file");
   EXPECT_TRUE(URIUtils::IsInternetStream(url1));
   EXPECT_TRUE(URIUtils::IsInternetStream(url2));
+  EXPECT_TRUE(URIUtils::IsInternetStream("HTTP://path/to/file"));
+  EXPECT_TRUE(URIUtils::IsInternetStream("stack://rtsp://path/to/file"));
+  EXPECT_FALSE(URIUtils::IsInternetStream("smb://path/to/file"));
+  EXPECT_FALSE(URIUtils::IsInternetStream("/path/to/http://file"));
+  EXPECT_FALSE(URIUtils::IsInternetStream("/path/to/file"));
 }
 
 TEST_F(TestURIUtils, IsInZIP)
@@ -392,6 +399,9 @@ TEST_F(TestURIUtils, IsSmb)
 {
   EXPECT_TRUE(URIUtils::IsSmb("smb://path/to/file"));
   EXPECT_TRUE(URIUtils::IsSmb("stack://smb://path/to/file"));
+  EXPECT_TRUE(URIUtils::IsSmb("SMB://path/to/file"));
+  EXPECT_TRUE(URIUtils::IsSmb("zip://smb%3a%2f%2fpath%2fto%2ffile.zip/file"));
+  EXPECT_FALSE(URIUtils::IsSmb("smbx://path/to/file"));
 }
 
 TEST_F(TestURIUtils, IsSpecial)
@@ -360,6 +360,35 @@ TEST(TestVariant, isMember)
   EXPECT_FALSE(a.isMember("key2"));
 }
 
+TEST(TestVariant, keyTypes)
+{
+  CVariant a;
+  a["key1"] = "string1";
+  a[std::string("key2")] = "string2";
+  CVariant& key3 = a[std::string_view("key3xx", 4)];
+  key3 = "string3";
+
+  // references to members stay valid while other members are added
+  for (int i = 0; i < 100; ++i)
+    a["filler" + std::to_string(i)] = i;
+
+  EXPECT_STREQ("string3", key3.c_str());
+  EXPECT_STREQ("string1", a[std::string_view("key1")].c_str());
+  EXPECT_STREQ("string2", a["key2"].c_str());
+  EXPECT_TRUE(a.isMember(std::string("key3")));
+  EXPECT_FALSE(a.isMember("key"));
+  EXPECT_FALSE(a.isMember(std::string_view("key3xx")));
+
+  const CVariant& b = a;
+  EXPECT_TRUE(b["missing"].isNull());
+  EXPECT_FALSE(b.isMember("missing"));
+
+  a.erase(std::string("missing"));
+  a.erase(std::string_view("key1"));
+  EXPECT_FALSE(a.isMember("key1"));
+  EXPECT_EQ(102u, a.size());
+}
+
 TEST(TestVariant, asBoolean)
 {
   EXPECT_TRUE(CVariant("true").asBoolean());
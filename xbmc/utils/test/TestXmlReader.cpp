@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/XmlReader.h"
+
+#include <gtest/gtest.h>
+
+TEST(TestXmlReader, Nodes)
+{
+  CXmlReader reader("<?xml version=\"1.0\"?>\n<!-- comment -->\n"
+                    "<root a=\"1 &amp; 2\" b='x'>\n  <child/>text &lt;&#65;&#x42;&foo;"
+                    "<![CDATA[<raw>]]></root>");
+
+  ASSERT_EQ(CXmlReader::Node::START_ELEMENT, reader.Next());
+  EXPECT_EQ("root", reader.GetName());
+  ASSERT_NE(nullptr, reader.GetAttribute("a"));
+  EXPECT_EQ("1 & 2", *reader.GetAttribute("a"));
+  ASSERT_NE(nullptr, reader.GetAttribute("b"));
+  EXPECT_EQ("x", *reader.GetAttribute("b"));
+  EXPECT_EQ(nullptr, reader.GetAttribute("c"));
+
+  ASSERT_EQ(CXmlReader::Node::START_ELEMENT, reader.Next());
+  EXPECT_EQ("child", reader.GetName());
+  ASSERT_EQ(CXmlReader::Node::END_ELEMENT, reader.Next());
+  EXPECT_EQ("child", reader.GetName());
+  EXPECT_EQ(1u, reader.GetDepth());
+
+  ASSERT_EQ(CXmlReader::Node::TEXT, reader.Next());
+  EXPECT_EQ("text <AB&foo;", reader.GetText());
+  ASSERT_EQ(CXmlReader::Node::TEXT, reader.Next());
+  EXPECT_EQ("<raw>", reader.GetText());
+
+  ASSERT_EQ(CXmlReader::Node::END_ELEMENT, reader.Next());
+  EXPECT_EQ("root", reader.GetName());
+  EXPECT_EQ(CXmlReader::Node::END, reader.Next());
+}
+
+TEST(TestXmlReader, SkipAndReadElement)
+{
+  CXmlReader reader("<addons><addon id=\"a\"><x><y/></x></addon>"
+                    "<addon id=\"b\"><x>1</x></addon><addon id=\"c\"/></addons>");
+
+  ASSERT_EQ(CXmlReader::Node::START_ELEMENT, reader.Next());
+  ASSERT_EQ(CXmlReader::Node::START_ELEMENT, reader.Next());
+  EXPECT_TRUE(reader.SkipElement());
+
+  ASSERT_EQ(CXmlReader::Node::START_ELEMENT, reader.Next());
+  EXPECT_EQ("b", *reader.GetAttribute("id"));
+  EXPECT_EQ("<addon id=\"b\"><x>1</x></addon>", reader.ReadElementSource());
+
+  ASSERT_EQ(CXmlReader::Node::START_ELEMENT, reader.Next());
+  EXPECT_EQ("<addon id=\"c\"/>", reader.ReadElementSource());
+
+  ASSERT_EQ(CXmlReader::Node::END_ELEMENT, reader.Next());
+  EXPECT_EQ("addons", reader.GetName());
+  EXPECT_EQ(CXmlReader::Node::END, reader.Next());
+}
+
+TEST(TestXmlReader, Malformed)
+{
+  CXmlReader mismatched("<a><b></a>");
+  EXPECT_EQ(CXmlReader::Node::START_ELEMENT, mismatched.Next());
+  EXPECT_EQ(CXmlReader::Node::START_ELEMENT, mismatched.Next());
+  EXPECT_EQ(CXmlReader::Node::ERROR, mismatched.Next());
+  EXPECT_EQ(CXmlReader::Node::ERROR, mismatched.Next());
+
+  CXmlReader truncated("<a><b>");
+  EXPECT_EQ(CXmlReader::Node::START_ELEMENT, truncated.Next());
+  EXPECT_EQ(CXmlReader::Node::START_ELEMENT, truncated.Next());
+  EXPECT_FALSE(truncated.SkipElement());
+
+  CXmlReader twoRoots("<a/><b/>");
+  EXPECT_EQ(CXmlReader::Node::START_ELEMENT, twoRoots.Next());
+  EXPECT_EQ(CXmlReader::Node::END_ELEMENT, twoRoots.Next());
+  EXPECT_EQ(CXmlReader::Node::ERROR, twoRoots.Next());
+}
@@ -21,9 +21,12 @@
 #include "input/actions/Action.h"
 #include "input/actions/ActionIDs.h"
 #include "input/keyboard/KeyIDs.h"
+#include "utils/Crc32.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 
+#include <cstddef>
+
 #include <harfbuzz/hb-ft.h>
 
 using namespace std::chrono_literals;
@@ -36,6 +39,7 @@ static inline void SDL_memset4(uint32_t* dst, uint32_t val, size_t len)
 #define SDL_memcpy4(dst, src, len) memcpy(dst, src, (len) << 2)
 
 static const char *TeletextFont = "special://xbmc/media/Fonts/teletext.ttf";
+static const size_t MaxDecodedPages = 256; /* about 2 MB */
 
 /* spacing attributes */
 #define alpha_black         0x00
@@ -621,6 +625,7 @@ bool CTeletextDecoder::InitDecoder()
   auto& components = CServiceBroker::GetAppComponents();
   const auto appPlayer = components.GetComponent<CApplicationPlayer>();
   m_txtCache = appPlayer->GetTeletextCache();
+  m_decodedPages.clear();
   if (m_txtCache == nullptr)
   {
     CLog::Log(LOGERROR, "{}: called without teletext cache", __FUNCTION__);
@@ -741,6 +746,8 @@ void CTeletextDecoder::EndDecoder()
   m_Manager               = NULL;
   m_Library               = NULL;
 
+  m_decodedPages.clear();
+
   if (!m_txtCache)
   {
     CLog::Log(LOGINFO, "{}: called without cache", __FUNCTION__);
@@ -2910,6 +2917,18 @@ TextPageinfo_t* CTeletextDecoder::DecodePage(bool showl25,             // 1=deco
   else
     boxed = false;
 
+  /* take pages from the cache as long as they don't change, e.g. when rotating subpages */
+  uint32_t fingerprint = 0;
+  if (IsDec(m_txtCache->Page))
+  {
+    fingerprint = GetPageFingerprint(PageInfo, PageChar, showl25);
+    if (LoadDecodedPage(fingerprint, showl25, HintMode, showflof, PageChar, PageAtrb))
+    {
+      if (!boxed)
+        memcpy(&PageChar[32], &m_txtCache->TimeString, 8);
+      return PageInfo;
+    }
+  }
 
   /* modify header */
   if (boxed)
@@ -3318,9 +3337,113 @@ TextPageinfo_t* CTeletextDecoder::DecodePage(bool showl25,             // 1=deco
       }
     }
   }
+
+  if (IsDec(m_txtCache->Page))
+    StoreDecodedPage(fingerprint, showl25, HintMode, showflof, PageChar, PageAtrb);
+
   return PageInfo;
 }
 
+uint32_t CTeletextDecoder::GetPageFingerprint(const TextPageinfo_t* PageInfo,
+                                              const unsigned char* PageChar,
+                                              bool showl25) const
+{
+  Crc32 crc;
+  crc.Compute(reinterpret_cast<const char*>(&PageChar[8]), 24); /* header line without TimeString */
+  crc.Compute(reinterpret_cast<const char*>(&PageChar[40]), 23 * 40);
+
+  const unsigned char flags[] = {PageInfo->boxed, PageInfo->nationalvalid, PageInfo->national,
+                                 PageInfo->function};
+  crc.Compute(reinterpret_cast<const char*>(flags), sizeof(flags));
+
+  if (PageInfo->p24)
+    crc.Compute(reinterpret_cast<const char*>(PageInfo->p24), 2 * 40);
+
+  if (const TextExtData_t* e = PageInfo->ext)
+  {
+    /* everything after the pointers to packets 26 and 27 */
+    crc.Compute(reinterpret_cast<const char*>(e->bgr),
+                sizeof(TextExtData_t) - offsetof(TextExtData_t, bgr));
+    for (const unsigned char* p26 : e->p26)
+    {
+      if (p26)
+        crc.Compute(reinterpret_cast<const char*>(p26), 13 * 3);
+    }
+    if (e->p27)
+      crc.Compute(reinterpret_cast<const char*>(e->p27), 4 * sizeof(Textp27_t));
+  }
+
+  /* without level 2.5 the row colors are left from the page decoded before */
+  if (!showl25)
+    crc.Compute(reinterpret_cast<const char*>(m_txtCache->FullRowColor),
+                sizeof(m_txtCache->FullRowColor));
+
+  return crc;
+}
+
+bool CTeletextDecoder::LoadDecodedPage(uint32_t fingerprint,
+                                       bool showl25,
+                                       bool HintMode,
+                                       bool showflof,
+                                       unsigned char* PageChar,
+                                       TextPageAttr_t* PageAtrb)
+{
+  const auto it = m_decodedPages.find((m_txtCache->Page << 8) | m_txtCache->SubPage);
+  if (it == m_decodedPages.end())
+    return false;
+
+  const TextDecodedPage_t& page = it->second;
+  if (page.Fingerprint != fingerprint || page.ObjectVersion != m_txtCache->ObjectVersion ||
+      page.Showl25 != showl25 || page.HintMode != HintMode || page.ShowFlof != showflof)
+    return false;
+
+  memcpy(PageChar, page.PageChar, sizeof(page.PageChar));
+  memcpy(PageAtrb, page.PageAtrb, sizeof(page.PageAtrb));
+  memcpy(m_txtCache->FullRowColor, page.FullRowColor, sizeof(page.FullRowColor));
+  m_txtCache->FullScrColor            = page.FullScrColor;
+  m_txtCache->NationalSubset          = page.NationalSubset;
+  m_txtCache->NationalSubsetSecondary = page.NationalSubsetSecondary;
+  m_txtCache->pop                     = page.pop;
+  m_txtCache->gpop                    = page.gpop;
+  m_txtCache->drcs                    = page.drcs;
+  m_txtCache->gdrcs                   = page.gdrcs;
+  m_txtCache->ColorTable              = page.ColorTable;
+  return true;
+}
+
+void CTeletextDecoder::StoreDecodedPage(uint32_t fingerprint,
+                                        bool showl25,
+                                        bool HintMode,
+                                        bool showflof,
+                                        const unsigned char* PageChar,
+                                        const TextPageAttr_t* PageAtrb)
+{
+  const int key = (m_txtCache->Page << 8) | m_txtCache->SubPage;
+
+  /* only keep the magazine being read */
+  if (!m_decodedPages.empty() && ((m_decodedPages.begin()->first >> 16) != (key >> 16) ||
+                                  m_decodedPages.size() >= MaxDecodedPages))
+    m_decodedPages.clear();
+
+  TextDecodedPage_t& page = m_decodedPages[key];
+  page.Fingerprint = fingerprint;
+  page.ObjectVersion = m_txtCache->ObjectVersion;
+  page.Showl25 = showl25;
+  page.HintMode = HintMode;
+  page.ShowFlof = showflof;
+  memcpy(page.PageChar, PageChar, sizeof(page.PageChar));
+  memcpy(page.PageAtrb, PageAtrb, sizeof(page.PageAtrb));
+  memcpy(page.FullRowColor, m_txtCache->FullRowColor, sizeof(page.FullRowColor));
+  page.FullScrColor            = m_txtCache->FullScrColor;
+  page.NationalSubset          = m_txtCache->NationalSubset;
+  page.NationalSubsetSecondary = m_txtCache->NationalSubsetSecondary;
+  page.pop                     = m_txtCache->pop;
+  page.gpop                    = m_txtCache->gpop;
+  page.drcs                    = m_txtCache->drcs;
+  page.gdrcs                   = m_txtCache->gdrcs;
+  page.ColorTable              = m_txtCache->ColorTable;
+}
+
 void CTeletextDecoder::Eval_l25(unsigned char* PageChar, TextPageAttr_t *PageAtrb, bool HintMode)
 {
   std::unique_lock<CCriticalSection> lock(m_txtCache->m_critSection);
@@ -12,6 +12,9 @@
 #include "guilib/GUITexture.h"
 #include "utils/ColorUtils.h"
 
+#include <cstdint>
+#include <map>
+
 // stuff for freetype
 #include <ft2build.h>
 
@@ -153,6 +156,21 @@ private:
                              TextPageAttr_t *PageAtrb,  // attribute buffer, min 25*40
                              bool HintMode,             // 1=show hidden information
                              bool showflof);            // 1=decode FLOF-line
+  uint32_t GetPageFingerprint(const TextPageinfo_t* PageInfo,
+                              const unsigned char* PageChar,
+                              bool showl25) const;
+  bool LoadDecodedPage(uint32_t fingerprint,
+                       bool showl25,
+                       bool HintMode,
+                       bool showflof,
+                       unsigned char* PageChar,
+                       TextPageAttr_t* PageAtrb);
+  void StoreDecodedPage(uint32_t fingerprint,
+                        bool showl25,
+                        bool HintMode,
+                        bool showflof,
+                        const unsigned char* PageChar,
+                        const TextPageAttr_t* PageAtrb);
   void Eval_l25(unsigned char* page_char, TextPageAttr_t *PageAtrb, bool HintMode);
   void Eval_Object(int iONr, TextCachedPage_t *pstCachedPage,
                    unsigned char *pAPx, unsigned char *pAPy,
@@ -201,4 +219,5 @@ private:
   int                 m_LastPage;         /* Last selected Page */
   std::shared_ptr<TextCacheStruct_t>  m_txtCache;         /* Text cache generated by the VideoPlayer if Teletext present */
   TextRenderInfo_t    m_RenderInfo;       /* Rendering information of displayed Teletext page */
+  std::map<int, TextDecodedPage_t> m_decodedPages; /* Decoded pages of the current magazine */
 };
@@ -11,6 +11,7 @@
 #include "threads/CriticalSection.h"
 
 #include <chrono>
+#include <cstdint>
 #include <string>
 
 #define FLOFSIZE 4
@@ -389,6 +390,24 @@ typedef struct
   TextPageAttr_t PageAtrb[TELETEXT_PAGE_SIZE];
 } TextSubtitleCache_t;
 
+/* decoded page with the level 2.5 state it leaves behind, kept by the decoder until the page changes */
+typedef struct
+{
+  uint32_t        Fingerprint;             /* checksum of the page data the page was decoded from */
+  unsigned int    ObjectVersion;           /* TextCacheStruct_t::ObjectVersion at decoding */
+  bool            Showl25;
+  bool            HintMode;
+  bool            ShowFlof;
+  unsigned char   PageChar[TELETEXT_PAGE_SIZE];
+  TextPageAttr_t  PageAtrb[TELETEXT_PAGE_SIZE];
+  unsigned char   FullRowColor[25];
+  unsigned char   FullScrColor;
+  int             NationalSubset;
+  int             NationalSubsetSecondary;
+  short           pop, gpop, drcs, gdrcs;
+  unsigned short *ColorTable;
+} TextDecodedPage_t;
+
 /* main data structure */
 typedef struct TextCacheStruct_t
 {
@@ -422,6 +441,7 @@ typedef struct TextCacheStruct_t
   unsigned char   tAPx, tAPy;              /* temporary offset to Active Position for objects */
   short           pop, gpop, drcs, gdrcs;
   unsigned short *ColorTable;
+  unsigned int    ObjectVersion;           /* changes with the object, DRCS and magazine data pages refer to */
 
   std::string      line30;
 
@@ -11,11 +11,80 @@
 #include "DVDFileInfo.h"
 #include "FileItem.h"
 #include "ServiceBroker.h"
+#include "cores/VideoPlayer/VideoFrameExtractor.h"
 #include "guilib/Texture.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
+#include "threads/Timer.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+/*!
+ * \brief Keeps the video of the last chapter image open, as the images of all its chapters are
+ * usually requested one after another. It is closed when no image was requested for a while.
+ */
+class CChapterFrameExtractor
+{
+public:
+  std::unique_ptr<CTexture> Extract(const CFileItem& item, int chapter, unsigned int maxWidth)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    if (!m_extractor || m_extractor->GetPath() != item.GetDynPath())
+    {
+      m_extractor.reset();
+      if (!CDVDFileInfo::CanExtract(item))
+        return {};
+
+      auto extractor = std::make_unique<CVideoFrameExtractor>();
+      if (!extractor->Open(item))
+        return {};
+      m_extractor = std::move(extractor);
+    }
+
+    std::unique_ptr<CTexture> texture;
+    if (chapter <= m_extractor->GetChapterCount())
+      texture = m_extractor->ExtractFrame(m_extractor->GetChapterPos(chapter), maxWidth);
+
+    m_lastUse = std::chrono::steady_clock::now();
+    if (m_closeTimer.IsRunning())
+      m_closeTimer.RestartAsync(CLOSE_DELAY);
+    else
+      m_closeTimer.Start(CLOSE_DELAY);
+    return texture;
+  }
+
+private:
+  static constexpr auto CLOSE_DELAY = 10s;
+
+  void Close()
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    if (std::chrono::steady_clock::now() - m_lastUse >= CLOSE_DELAY)
+      m_extractor.reset();
+  }
+
+  CCriticalSection m_section;
+  std::unique_ptr<CVideoFrameExtractor> m_extractor;
+  std::chrono::steady_clock::time_point m_lastUse;
+  CTimer m_closeTimer{[this]() { Close(); }};
+};
+
+CChapterFrameExtractor& GetChapterFrameExtractor()
+{
+  static CChapterFrameExtractor extractor;
+  return extractor;
+}
+} // unnamed namespace
+
 bool VIDEO::CVideoChapterImageFileLoader::CanLoad(const std::string& specialType) const
 {
   return specialType == "videochapter";
@@ -24,7 +93,7 @@ bool VIDEO::CVideoChapterImageFileLoader::CanLoad(const std::string& specialType
 std::unique_ptr<CTexture> VIDEO::CVideoChapterImageFileLoader::Load(
     const std::string& specialType,
     const std::string& goofyChapterPath,
-    unsigned int,
+    unsigned int preferredWidth,
     unsigned int) const
 {
   // "goofy" chapter path because these paths don't yet conform to 'image://' path standard
@@ -49,6 +118,10 @@ std::unique_ptr<CTexture> VIDEO::CVideoChapterImageFileLoader::Load(
     return {};
   }
 
+  unsigned int maxWidth = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes;
+  if (preferredWidth > 0)
+    maxWidth = std::min(maxWidth, preferredWidth);
+
   CFileItem item{cleanname, false};
-  return CDVDFileInfo::ExtractThumbToTexture(item, chapterNum);
+  return GetChapterFrameExtractor().Extract(item, chapterNum, maxWidth);
 }
@@ -24,6 +24,7 @@
 #include "dialogs/GUIDialogProgress.h"
 #include "dialogs/GUIDialogYesNo.h"
 #include "filesystem/Directory.h"
+#include "filesystem/DirectoryPreview.h"
 #include "filesystem/File.h"
 #include "filesystem/MultiPathDirectory.h"
 #include "filesystem/PluginDirectory.h"
@@ -44,6 +45,7 @@
 #include "settings/SettingsComponent.h"
 #include "storage/MediaManager.h"
 #include "utils/FileUtils.h"
+#include "utils/FileWriteQueue.h"
 #include "utils/GroupUtils.h"
 #include "utils/LabelFormatter.h"
 #include "utils/StringUtils.h"
@@ -71,6 +73,90 @@ using namespace ADDON;
 using namespace KODI::MESSAGING;
 using namespace KODI::GUILIB;
 
+namespace
+{
+/*!
+ * \brief Statement that recomputes the tvshowcounts rows of the tv shows matching a condition
+ * \param showCondition condition on tvshow.idShow, e.g. "=new.idShow" in a trigger
+ */
+std::string RefreshTvShowCounts(const std::string& showCondition)
+{
+  return StringUtils::Format(
+      "REPLACE INTO tvshowcounts (idShow, lastPlayed, totalCount, watchedcount, totalSeasons, "
+      "dateAdded, inProgressCount) "
+      "SELECT tvshow.idShow, MAX(files.lastPlayed), NULLIF(COUNT(episode.c{0:02}), 0), "
+      "COUNT(files.playCount), NULLIF(COUNT(DISTINCT(episode.c{0:02})), 0), "
+      "MAX(files.dateAdded), COUNT(bookmark.type) "
+      "FROM tvshow "
+      "LEFT JOIN episode ON episode.idShow=tvshow.idShow "
+      "LEFT JOIN files ON files.idFile=episode.idFile "
+      "LEFT JOIN bookmark ON bookmark.idFile=files.idFile AND bookmark.type=1 "
+      "WHERE tvshow.idShow{1} "
+      "GROUP BY tvshow.idShow",
+      VIDEODB_ID_EPISODE_SEASON, showCondition);
+}
+
+/*!
+ * \brief Join ids for an IN (...) condition
+ */
+std::string JoinIds(const std::vector<int>& ids)
+{
+  std::string joined;
+  for (const int id : ids)
+  {
+    if (!joined.empty())
+      joined += ',';
+    joined += std::to_string(id);
+  }
+  return joined;
+}
+
+/*!
+ * \brief Add the stream of the current row of a "SELECT * FROM streamdetails" query
+ * \return true if the row held a known stream type
+ */
+bool AddStreamDetail(dbiplus::Dataset& ds, CStreamDetails& details)
+{
+  switch (static_cast<CStreamDetail::StreamType>(ds.fv(1).get_asInt()))
+  {
+    case CStreamDetail::VIDEO:
+    {
+      CStreamDetailVideo* p = new CStreamDetailVideo();
+      p->m_strCodec = ds.fv(2).get_asString();
+      p->m_fAspect = ds.fv(3).get_asFloat();
+      p->m_iWidth = ds.fv(4).get_asInt();
+      p->m_iHeight = ds.fv(5).get_asInt();
+      p->m_iDuration = ds.fv(10).get_asInt();
+      p->m_strStereoMode = ds.fv(11).get_asString();
+      p->m_strLanguage = ds.fv(12).get_asString();
+      p->m_strHdrType = ds.fv(13).get_asString();
+      details.AddStream(p);
+      return true;
+    }
+    case CStreamDetail::AUDIO:
+    {
+      CStreamDetailAudio* p = new CStreamDetailAudio();
+      p->m_strCodec = ds.fv(6).get_asString();
+      if (ds.fv(7).get_isNull())
+        p->m_iChannels = -1;
+      else
+        p->m_iChannels = ds.fv(7).get_asInt();
+      p->m_strLanguage = ds.fv(8).get_asString();
+      details.AddStream(p);
+      return true;
+    }
+    case CStreamDetail::SUBTITLE:
+    {
+      CStreamDetailSubtitle* p = new CStreamDetailSubtitle();
+      p->m_strLanguage = ds.fv(9).get_asString();
+      details.AddStream(p);
+      return true;
+    }
+  }
+  return false;
+}
+} // unnamed namespace
+
 //********************************************************************************************************************************
 CVideoDatabase::CVideoDatabase(void) = default;
 
@@ -141,6 +227,12 @@ void CVideoDatabase::CreateTables()
   columns += ", userrating integer, duration INTEGER)";
   m_pDS->exec(columns);
 
+  CLog::Log(LOGINFO, "create tvshowcounts table");
+  CreateTvShowCountsTable();
+
+  CLog::Log(LOGINFO, "create changelog table");
+  CreateChangeLogTable();
+
   CLog::Log(LOGINFO, "create episode table");
   columns = "CREATE TABLE episode ( idEpisode integer primary key, idFile integer";
   for (int i = 0; i < VIDEODB_MAX_COLUMNS; i++)
@@ -218,6 +310,13 @@ void CVideoDatabase::CreateLinkIndex(const char *table)
   m_pDS->exec(PrepareSQL("CREATE INDEX ix_%s_link_3 ON %s_link (media_type(20))", table, table));
 }
 
+void CVideoDatabase::CreateTvShowCountsTable()
+{
+  m_pDS->exec("CREATE TABLE tvshowcounts (idShow INTEGER PRIMARY KEY, lastPlayed TEXT, "
+              "totalCount INTEGER, watchedcount INTEGER, totalSeasons INTEGER, dateAdded TEXT, "
+              "inProgressCount INTEGER)");
+}
+
 void CVideoDatabase::CreateForeignLinkIndex(const char *table, const char *foreignkey)
 {
   m_pDS->exec(PrepareSQL("CREATE UNIQUE INDEX ix_%s_link_1 ON %s_link (%s_id, media_type(20), media_id)", table, table, foreignkey));
@@ -265,6 +364,11 @@ void CVideoDatabase::CreateAnalytics()
   m_pDS->exec(createColIndex);
   m_pDS->exec("CREATE INDEX ix_episode_show1 on episode(idEpisode,idShow)");
   m_pDS->exec("CREATE INDEX ix_episode_show2 on episode(idShow,idEpisode)");
+  // covers the joins of season_view and the tvshowcounts refreshes without reading episode rows
+  createColIndex = StringUtils::Format(
+      "CREATE INDEX ix_episode_show_season on episode (idShow, c{:02}, idFile)",
+      VIDEODB_ID_EPISODE_SEASON);
+  m_pDS->exec(createColIndex);
 
   m_pDS->exec("CREATE UNIQUE INDEX ix_musicvideo_file_1 on musicvideo (idMVideo, idFile)");
   m_pDS->exec("CREATE UNIQUE INDEX ix_musicvideo_file_2 on musicvideo (idFile, idMVideo)");
@@ -328,6 +432,7 @@ void CVideoDatabase::CreateAnalytics()
               "DELETE FROM tag_link WHERE media_id=old.idShow AND media_type='tvshow'; "
               "DELETE FROM rating WHERE media_id=old.idShow AND media_type='tvshow'; "
               "DELETE FROM uniqueid WHERE media_id=old.idShow AND media_type='tvshow'; "
+              "DELETE FROM tvshowcounts WHERE idShow=old.idShow; "
               "END");
   m_pDS->exec("CREATE TRIGGER delete_musicvideo AFTER DELETE ON musicvideo FOR EACH ROW BEGIN "
               "DELETE FROM actor_link WHERE media_id=old.idMVideo AND media_type='musicvideo'; "
@@ -344,7 +449,9 @@ void CVideoDatabase::CreateAnalytics()
               "DELETE FROM writer_link WHERE media_id=old.idEpisode AND media_type='episode'; "
               "DELETE FROM art WHERE media_id=old.idEpisode AND media_type='episode'; "
               "DELETE FROM rating WHERE media_id=old.idEpisode AND media_type='episode'; "
-              "DELETE FROM uniqueid WHERE media_id=old.idEpisode AND media_type='episode'; "
+              "DELETE FROM uniqueid WHERE media_id=old.idEpisode AND media_type='episode'; " +
+              RefreshTvShowCounts("=old.idShow") +
+              "; "
               "END");
   m_pDS->exec("CREATE TRIGGER delete_season AFTER DELETE ON seasons FOR EACH ROW BEGIN "
               "DELETE FROM art WHERE media_id=old.idSeason AND media_type='season'; "
@@ -364,8 +471,42 @@ void CVideoDatabase::CreateAnalytics()
               "DELETE FROM stacktimes WHERE idFile=old.idFile; "
               "DELETE FROM streamdetails WHERE idFile=old.idFile; "
               "DELETE FROM videoversion WHERE idFile=old.idFile; "
-              "DELETE FROM art WHERE media_id=old.idFile AND media_type='videoversion'; "
+              "DELETE FROM art WHERE media_id=old.idFile AND media_type='videoversion'; " +
+              RefreshTvShowCounts(" IN (SELECT idShow FROM episode WHERE idFile=old.idFile)") +
+              "; "
+              "END");
+
+  // keep the counts of the tvshows up to date, instead of aggregating all episodes of all shows
+  // whenever tvshow_view is queried
+  m_pDS->exec("CREATE TRIGGER insert_tvshow AFTER INSERT ON tvshow FOR EACH ROW BEGIN " +
+              RefreshTvShowCounts("=new.idShow") +
+              "; "
               "END");
+  m_pDS->exec("CREATE TRIGGER insert_episode AFTER INSERT ON episode FOR EACH ROW BEGIN " +
+              RefreshTvShowCounts("=new.idShow") +
+              "; "
+              "END");
+  m_pDS->exec("CREATE TRIGGER update_episode AFTER UPDATE ON episode FOR EACH ROW BEGIN " +
+              RefreshTvShowCounts(" IN (old.idShow, new.idShow)") +
+              "; "
+              "END");
+  m_pDS->exec("CREATE TRIGGER update_file AFTER UPDATE ON files FOR EACH ROW BEGIN " +
+              RefreshTvShowCounts(" IN (SELECT idShow FROM episode WHERE idFile=new.idFile)") +
+              "; "
+              "END");
+  m_pDS->exec("CREATE TRIGGER insert_bookmark AFTER INSERT ON bookmark FOR EACH ROW BEGIN " +
+              RefreshTvShowCounts(" IN (SELECT idShow FROM episode WHERE idFile=new.idFile)") +
+              "; "
+              "END");
+  m_pDS->exec("CREATE TRIGGER delete_bookmark AFTER DELETE ON bookmark FOR EACH ROW BEGIN " +
+              RefreshTvShowCounts(" IN (SELECT idShow FROM episode WHERE idFile=old.idFile)") +
+              "; "
+              "END");
+
+  // the triggers are dropped while the tables are updated to a new version, so the counts are
+  // computed again for all tvshows
+  m_pDS->exec("DELETE FROM tvshowcounts");
+  m_pDS->exec(RefreshTvShowCounts(" IS NOT NULL"));
 
   CreateViews();
 }
@@ -414,27 +555,6 @@ void CVideoDatabase::CreateViews()
                                       VIDEODB_ID_EPISODE_IDENT_ID);
   m_pDS->exec(episodeview);
 
-  CLog::Log(LOGINFO, "create tvshowcounts");
-  // clang-format off
-  std::string tvshowcounts = PrepareSQL("CREATE VIEW tvshowcounts AS SELECT "
-                                       "      tvshow.idShow AS idShow,"
-                                       "      MAX(files.lastPlayed) AS lastPlayed,"
-                                       "      NULLIF(COUNT(episode.c12), 0) AS totalCount,"
-                                       "      COUNT(files.playCount) AS watchedcount,"
-                                       "      NULLIF(COUNT(DISTINCT(episode.c12)), 0) AS totalSeasons, "
-                                       "      MAX(files.dateAdded) as dateAdded, "
-                                       "      COUNT(bookmark.type) AS inProgressCount "
-                                       "    FROM tvshow"
-                                       "      LEFT JOIN episode ON"
-                                       "        episode.idShow=tvshow.idShow"
-                                       "      LEFT JOIN files ON"
-                                       "        files.idFile=episode.idFile "
-                                       "      LEFT JOIN bookmark ON"
-                                       "        bookmark.idFile=files.idFile AND bookmark.type=1 "
-                                       "GROUP BY tvshow.idShow");
-  // clang-format on
-  m_pDS->exec(tvshowcounts);
-
   CLog::Log(LOGINFO, "create tvshowlinkpath_minview");
   // This view only exists to workaround a limitation in MySQL <5.7 which is not able to
   // perform subqueries in joins.
@@ -635,8 +755,8 @@ int CVideoDatabase::GetPathId(const std::string& strPath)
 
     URIUtils::AddSlashAtEnd(strPath1);
 
-    strSQL=PrepareSQL("select idPath from path where strPath='%s'",strPath1.c_str());
-    m_pDS->query(strSQL);
+    strSQL = PrepareSQL("select idPath from path where strPath=?");
+    m_pDS->query(strSQL, {field_value(strPath1)});
     if (!m_pDS->eof())
       idPath = m_pDS->fv("path.idPath").get_asInt();
 
@@ -776,12 +896,13 @@ bool CVideoDatabase::GetPathsForTvShow(int idShow, std::set<int>& paths)
   return false;
 }
 
-int CVideoDatabase::RunQuery(const std::string &sql)
+int CVideoDatabase::RunQuery(const std::string& sql,
+                             const dbiplus::sql_params* params /* = nullptr */)
 {
   auto start = std::chrono::steady_clock::now();
 
   int rows = -1;
-  if (m_pDS->query(sql))
+  if (params ? m_pDS->query(sql, *params) : m_pDS->query(sql))
   {
     rows = m_pDS->num_rows();
     if (rows == 0)
@@ -828,6 +949,35 @@ bool CVideoDatabase::GetSubPaths(const std::string &basepath, std::vector<std::p
   return false;
 }
 
+bool CVideoDatabase::GetChildPaths(const std::string& path, std::vector<std::string>& children)
+{
+  std::string sql;
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return false;
+
+    const int idPath = GetPathId(path);
+    if (idPath < 0)
+      return false;
+
+    sql = PrepareSQL("SELECT strPath FROM path WHERE idParentPath=%i", idPath);
+    m_pDS->query(sql);
+    while (!m_pDS->eof())
+    {
+      children.emplace_back(m_pDS->fv(0).get_asString());
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} error during query: {}", __FUNCTION__, sql);
+  }
+  return false;
+}
+
 int CVideoDatabase::AddPath(const std::string& strPath, const std::string &parentPath /*= "" */, const CDateTime& dateAdded /* = CDateTime() */)
 {
   std::string strSQL;
@@ -851,21 +1001,18 @@ int CVideoDatabase::AddPath(const std::string& strPath, const std::string &paren
     int idParentPath = GetPathId(parentPath.empty() ? URIUtils::GetParentPath(strPath1) : parentPath);
 
     // add the path
-    if (idParentPath < 0)
-    {
-      if (dateAdded.IsValid())
-        strSQL=PrepareSQL("insert into path (idPath, strPath, dateAdded) values (NULL, '%s', '%s')", strPath1.c_str(), dateAdded.GetAsDBDateTime().c_str());
-      else
-        strSQL=PrepareSQL("insert into path (idPath, strPath) values (NULL, '%s')", strPath1.c_str());
-    }
+    field_value dateValue;
+    if (dateAdded.IsValid())
+      dateValue.set_asString(dateAdded.GetAsDBDateTime());
     else
-    {
-      if (dateAdded.IsValid())
-        strSQL = PrepareSQL("insert into path (idPath, strPath, dateAdded, idParentPath) values (NULL, '%s', '%s', %i)", strPath1.c_str(), dateAdded.GetAsDBDateTime().c_str(), idParentPath);
-      else
-        strSQL=PrepareSQL("insert into path (idPath, strPath, idParentPath) values (NULL, '%s', %i)", strPath1.c_str(), idParentPath);
-    }
-    m_pDS->exec(strSQL);
+      dateValue.set_isNull();
+    field_value parentValue(idParentPath);
+    if (idParentPath < 0)
+      parentValue.set_isNull();
+
+    strSQL = PrepareSQL("insert into path (idPath, strPath, dateAdded, idParentPath) "
+                        "values (NULL, ?, ?, ?)");
+    m_pDS->exec(strSQL, {field_value(strPath1), dateValue, parentValue});
     idPath = (int)m_pDS->lastinsertid();
     return idPath;
   }
@@ -1006,9 +1153,9 @@ int CVideoDatabase::AddFile(const std::string& strFileNameAndPath,
     if (idPath < 0)
       return -1;
 
-    std::string strSQL=PrepareSQL("select idFile from files where strFileName='%s' and idPath=%i", strFileName.c_str(),idPath);
+    strSQL = PrepareSQL("select idFile from files where strFileName=? and idPath=?");
 
-    m_pDS->query(strSQL);
+    m_pDS->query(strSQL, {field_value(strFileName), field_value(idPath)});
     if (m_pDS->num_rows() > 0)
     {
       idFile = m_pDS->fv("idFile").get_asInt() ;
@@ -1017,17 +1164,19 @@ int CVideoDatabase::AddFile(const std::string& strFileNameAndPath,
     }
     m_pDS->close();
 
-    std::string strPlaycount = "NULL";
-    if (playcount > 0)
-      strPlaycount = std::to_string(playcount);
-    std::string strLastPlayed = "NULL";
+    field_value playcountValue(playcount);
+    if (playcount <= 0)
+      playcountValue.set_isNull();
+    field_value lastPlayedValue;
     if (lastPlayed.IsValid())
-      strLastPlayed = "'" + lastPlayed.GetAsDBDateTime() + "'";
+      lastPlayedValue.set_asString(lastPlayed.GetAsDBDateTime());
+    else
+      lastPlayedValue.set_isNull();
 
     strSQL = PrepareSQL("INSERT INTO files (idFile, idPath, strFileName, playCount, lastPlayed, dateAdded) "
-                        "VALUES(NULL, %i, '%s', " + strPlaycount + ", " + strLastPlayed + ", '%s')",
-                        idPath, strFileName.c_str(), finalDateAdded.GetAsDBDateTime().c_str());
-    m_pDS->exec(strSQL);
+                        "VALUES(NULL, ?, ?, ?, ?, ?)");
+    m_pDS->exec(strSQL, {field_value(idPath), field_value(strFileName), playcountValue,
+                         lastPlayedValue, field_value(finalDateAdded.GetAsDBDateTime())});
     idFile = (int)m_pDS->lastinsertid();
     return idFile;
   }
@@ -1097,6 +1246,17 @@ bool CVideoDatabase::SetPathHash(const std::string &path, const std::string &has
     std::string strSQL=PrepareSQL("update path set strHash='%s' where idPath=%ld", hash.c_str(), idPath);
     m_pDS->exec(strSQL);
 
+    // paths added before their parent aren't linked to it yet, the incremental scan relies on it
+    std::string parentPath(path);
+    URIUtils::AddSlashAtEnd(parentPath);
+    const int idParentPath = GetPathId(URIUtils::GetParentPath(parentPath));
+    if (idParentPath >= 0 && idParentPath != idPath)
+    {
+      strSQL = PrepareSQL("UPDATE path SET idParentPath=%i WHERE idPath=%i AND idParentPath IS NULL",
+                          idParentPath, idPath);
+      m_pDS->exec(strSQL);
+    }
+
     return true;
   }
   catch (...)
@@ -1585,14 +1745,15 @@ int CVideoDatabase::AddToTable(const std::string& table, const std::string& firs
     if (nullptr == m_pDS)
       return -1;
 
-    std::string strSQL = PrepareSQL("select %s from %s where %s like '%s'", firstField.c_str(), table.c_str(), secondField.c_str(), value.substr(0, 255).c_str());
-    m_pDS->query(strSQL);
+    const field_value truncated(value.substr(0, 255));
+    std::string strSQL = PrepareSQL("select %s from %s where %s like ?", firstField.c_str(), table.c_str(), secondField.c_str());
+    m_pDS->query(strSQL, {truncated});
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
       // doesn't exists, add it
-      strSQL = PrepareSQL("insert into %s (%s, %s) values(NULL, '%s')", table.c_str(), firstField.c_str(), secondField.c_str(), value.substr(0, 255).c_str());
-      m_pDS->exec(strSQL);
+      strSQL = PrepareSQL("insert into %s (%s, %s) values(NULL, ?)", table.c_str(), firstField.c_str(), secondField.c_str());
+      m_pDS->exec(strSQL, {truncated});
       int id = (int)m_pDS->lastinsertid();
       return id;
     }
@@ -1813,14 +1974,15 @@ int CVideoDatabase::AddActor(const std::string& name, const std::string& thumbUR
     std::string trimmedName = name;
     StringUtils::Trim(trimmedName);
 
-    std::string strSQL=PrepareSQL("select actor_id from actor where name like '%s'", trimmedName.substr(0, 255).c_str());
-    m_pDS->query(strSQL);
+    const field_value truncated(trimmedName.substr(0, 255));
+    std::string strSQL = PrepareSQL("select actor_id from actor where name like ?");
+    m_pDS->query(strSQL, {truncated});
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
       // doesn't exists, add it
-      strSQL=PrepareSQL("insert into actor (actor_id, name, art_urls) values(NULL, '%s', '%s')", trimmedName.substr(0,255).c_str(), thumbURLs.c_str());
-      m_pDS->exec(strSQL);
+      strSQL = PrepareSQL("insert into actor (actor_id, name, art_urls) values(NULL, ?, ?)");
+      m_pDS->exec(strSQL, {truncated, field_value(thumbURLs)});
       idActor = (int)m_pDS->lastinsertid();
     }
     else
@@ -1830,8 +1992,8 @@ int CVideoDatabase::AddActor(const std::string& name, const std::string& thumbUR
       // update the thumb url's
       if (!thumbURLs.empty())
       {
-        strSQL=PrepareSQL("update actor set art_urls = '%s' where actor_id = %i", thumbURLs.c_str(), idActor);
-        m_pDS->exec(strSQL);
+        strSQL = PrepareSQL("update actor set art_urls = ? where actor_id = ?");
+        m_pDS->exec(strSQL, {field_value(thumbURLs), field_value(idActor)});
       }
     }
     // add artwork
@@ -1850,26 +2012,51 @@ int CVideoDatabase::AddActor(const std::string& name, const std::string& thumbUR
 
 void CVideoDatabase::AddLinkToActor(int mediaId, const char *mediaType, int actorId, const std::string &role, int order)
 {
-  std::string sql = PrepareSQL("SELECT 1 FROM actor_link WHERE actor_id=%i AND "
-                               "media_id=%i AND media_type='%s' AND role='%s'",
-                               actorId, mediaId, mediaType, role.c_str());
+  std::string sql;
+  try
+  {
+    sql = PrepareSQL("SELECT 1 FROM actor_link WHERE actor_id=? AND "
+                     "media_id=? AND media_type=? AND role=?");
+    sql_params params{field_value(actorId), field_value(mediaId), field_value(mediaType),
+                      field_value(role)};
+    m_pDS->query(sql, params);
+    const bool exists = !m_pDS->eof();
+    m_pDS->close();
 
-  if (GetSingleValue(sql).empty())
-  { // doesn't exists, add it
-    sql = PrepareSQL("INSERT INTO actor_link (actor_id, media_id, media_type, role, cast_order) VALUES(%i,%i,'%s','%s',%i)", actorId, mediaId, mediaType, role.c_str(), order);
-    ExecuteQuery(sql);
+    if (!exists)
+    { // doesn't exists, add it
+      sql = PrepareSQL("INSERT INTO actor_link (actor_id, media_id, media_type, role, cast_order) VALUES(?,?,?,?,?)");
+      params.emplace_back(order);
+      m_pDS->exec(sql, params);
+    }
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} - failed to execute query '{}'", __FUNCTION__, sql);
   }
 }
 
 void CVideoDatabase::AddToLinkTable(int mediaId, const std::string& mediaType, const std::string& table, int valueId, const char *foreignKey)
 {
   const char *key = foreignKey ? foreignKey : table.c_str();
-  std::string sql = PrepareSQL("SELECT 1 FROM %s_link WHERE %s_id=%i AND media_id=%i AND media_type='%s'", table.c_str(), key, valueId, mediaId, mediaType.c_str());
+  std::string sql;
+  try
+  {
+    const sql_params params{field_value(valueId), field_value(mediaId), field_value(mediaType)};
+    sql = PrepareSQL("SELECT 1 FROM %s_link WHERE %s_id=? AND media_id=? AND media_type=?", table.c_str(), key);
+    m_pDS->query(sql, params);
+    const bool exists = !m_pDS->eof();
+    m_pDS->close();
 
-  if (GetSingleValue(sql).empty())
-  { // doesn't exists, add it
-    sql = PrepareSQL("INSERT INTO %s_link (%s_id,media_id,media_type) VALUES(%i,%i,'%s')", table.c_str(), key, valueId, mediaId, mediaType.c_str());
-    ExecuteQuery(sql);
+    if (!exists)
+    { // doesn't exists, add it
+      sql = PrepareSQL("INSERT INTO %s_link (%s_id,media_id,media_type) VALUES(?,?,?)", table.c_str(), key);
+      m_pDS->exec(sql, params);
+    }
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} - failed to execute query '{}'", __FUNCTION__, sql);
   }
 }
 
@@ -3219,38 +3406,67 @@ void CVideoDatabase::SetStreamDetailsForFileId(const CStreamDetails& details, in
 
   try
   {
-    m_pDS->exec(PrepareSQL("DELETE FROM streamdetails WHERE idFile = %i", idFile));
+    m_pDS->exec(PrepareSQL("DELETE FROM streamdetails WHERE idFile = ?"), {field_value(idFile)});
 
-    for (int i=1; i<=details.GetVideoStreamCount(); i++)
-    {
-      m_pDS->exec(PrepareSQL("INSERT INTO streamdetails "
-                             "(idFile, iStreamType, strVideoCodec, fVideoAspect, iVideoWidth, "
-                             "iVideoHeight, iVideoDuration, strStereoMode, strVideoLanguage,  "
-                             "strHdrType)"
-                             "VALUES (%i,%i,'%s',%f,%i,%i,%i,'%s','%s','%s')",
-                             idFile, (int)CStreamDetail::VIDEO, details.GetVideoCodec(i).c_str(),
-                             static_cast<double>(details.GetVideoAspect(i)),
-                             details.GetVideoWidth(i), details.GetVideoHeight(i),
-                             details.GetVideoDuration(i), details.GetStereoMode(i).c_str(),
-                             details.GetVideoLanguage(i).c_str(),
-                             details.GetVideoHdrType(i).c_str()));
-    }
-    for (int i=1; i<=details.GetAudioStreamCount(); i++)
-    {
-      m_pDS->exec(PrepareSQL("INSERT INTO streamdetails "
-        "(idFile, iStreamType, strAudioCodec, iAudioChannels, strAudioLanguage) "
-        "VALUES (%i,%i,'%s',%i,'%s')",
-        idFile, (int)CStreamDetail::AUDIO,
-        details.GetAudioCodec(i).c_str(), details.GetAudioChannels(i),
-        details.GetAudioLanguage(i).c_str()));
-    }
-    for (int i=1; i<=details.GetSubtitleStreamCount(); i++)
+    // all streams go into one multi-row insert
+    const size_t streamCount = details.GetVideoStreamCount() + details.GetAudioStreamCount() +
+                               details.GetSubtitleStreamCount();
+    if (streamCount > 0)
     {
-      m_pDS->exec(PrepareSQL("INSERT INTO streamdetails "
-        "(idFile, iStreamType, strSubtitleLanguage) "
-        "VALUES (%i,%i,'%s')",
-        idFile, (int)CStreamDetail::SUBTITLE,
-        details.GetSubtitleLanguage(i).c_str()));
+      static constexpr size_t STREAM_COLUMNS = 14;
+      // stays below the 999 variables per statement of older sqlite versions
+      static constexpr size_t MAX_ROWS = 64;
+      field_value null;
+      null.set_isNull();
+
+      sql_params params;
+      params.reserve(streamCount * STREAM_COLUMNS);
+
+      for (int i=1; i<=details.GetVideoStreamCount(); i++)
+      {
+        params.insert(params.end(),
+                      {field_value(idFile), field_value(static_cast<int>(CStreamDetail::VIDEO)),
+                       field_value(details.GetVideoCodec(i)),
+                       field_value(static_cast<double>(details.GetVideoAspect(i))),
+                       field_value(details.GetVideoWidth(i)),
+                       field_value(details.GetVideoHeight(i)),
+                       field_value(details.GetVideoDuration(i)),
+                       field_value(details.GetStereoMode(i)),
+                       field_value(details.GetVideoLanguage(i)),
+                       field_value(details.GetVideoHdrType(i)), null, null, null, null});
+      }
+      for (int i=1; i<=details.GetAudioStreamCount(); i++)
+      {
+        params.insert(params.end(),
+                      {field_value(idFile), field_value(static_cast<int>(CStreamDetail::AUDIO)),
+                       null, null, null, null, null, null, null, null,
+                       field_value(details.GetAudioCodec(i)),
+                       field_value(details.GetAudioChannels(i)),
+                       field_value(details.GetAudioLanguage(i)), null});
+      }
+      for (int i=1; i<=details.GetSubtitleStreamCount(); i++)
+      {
+        params.insert(params.end(),
+                      {field_value(idFile), field_value(static_cast<int>(CStreamDetail::SUBTITLE)),
+                       null, null, null, null, null, null, null, null, null, null, null,
+                       field_value(details.GetSubtitleLanguage(i))});
+      }
+
+      for (size_t first = 0; first < streamCount; first += MAX_ROWS)
+      {
+        const size_t rows = std::min(MAX_ROWS, streamCount - first);
+        std::string sql = PrepareSQL(
+            "INSERT INTO streamdetails "
+            "(idFile, iStreamType, strVideoCodec, fVideoAspect, iVideoWidth, "
+            "iVideoHeight, iVideoDuration, strStereoMode, strVideoLanguage, "
+            "strHdrType, strAudioCodec, iAudioChannels, strAudioLanguage, "
+            "strSubtitleLanguage) VALUES ");
+        for (size_t i = 0; i < rows; i++)
+          sql += i == 0 ? "(?,?,?,?,?,?,?,?,?,?,?,?,?,?)" : ",(?,?,?,?,?,?,?,?,?,?,?,?,?,?)";
+
+        m_pDS->exec(sql, sql_params(params.begin() + first * STREAM_COLUMNS,
+                                    params.begin() + (first + rows) * STREAM_COLUMNS));
+      }
     }
 
     // update the runtime information, if empty
@@ -4220,46 +4436,8 @@ bool CVideoDatabase::GetStreamDetails(CVideoInfoTag& tag) const
 
     while (!pDS->eof())
     {
-      CStreamDetail::StreamType e = (CStreamDetail::StreamType)pDS->fv(1).get_asInt();
-      switch (e)
-      {
-      case CStreamDetail::VIDEO:
-        {
-          CStreamDetailVideo *p = new CStreamDetailVideo();
-          p->m_strCodec = pDS->fv(2).get_asString();
-          p->m_fAspect = pDS->fv(3).get_asFloat();
-          p->m_iWidth = pDS->fv(4).get_asInt();
-          p->m_iHeight = pDS->fv(5).get_asInt();
-          p->m_iDuration = pDS->fv(10).get_asInt();
-          p->m_strStereoMode = pDS->fv(11).get_asString();
-          p->m_strLanguage = pDS->fv(12).get_asString();
-          p->m_strHdrType = pDS->fv(13).get_asString();
-          details.AddStream(p);
-          retVal = true;
-          break;
-        }
-      case CStreamDetail::AUDIO:
-        {
-          CStreamDetailAudio *p = new CStreamDetailAudio();
-          p->m_strCodec = pDS->fv(6).get_asString();
-          if (pDS->fv(7).get_isNull())
-            p->m_iChannels = -1;
-          else
-            p->m_iChannels = pDS->fv(7).get_asInt();
-          p->m_strLanguage = pDS->fv(8).get_asString();
-          details.AddStream(p);
-          retVal = true;
-          break;
-        }
-      case CStreamDetail::SUBTITLE:
-        {
-          CStreamDetailSubtitle *p = new CStreamDetailSubtitle();
-          p->m_strLanguage = pDS->fv(9).get_asString();
-          details.AddStream(p);
-          retVal = true;
-          break;
-        }
-      }
+      if (AddStreamDetail(*pDS, details))
+        retVal = true;
 
       pDS->next();
     }
@@ -4278,6 +4456,40 @@ bool CVideoDatabase::GetStreamDetails(CVideoInfoTag& tag) const
   return retVal;
 }
 
+bool CVideoDatabase::GetStreamDetailsForFiles(const std::vector<int>& fileIds,
+                                              std::map<int, CStreamDetails>& details) const
+{
+  if (fileIds.empty())
+    return true;
+
+  for (const int fileId : fileIds)
+    details[fileId].Reset();
+
+  std::unique_ptr<Dataset> pDS(m_pDB->CreateDataset());
+  try
+  {
+    pDS->query(PrepareSQL("SELECT * FROM streamdetails WHERE idFile IN (%s)",
+                          JoinIds(fileIds).c_str()));
+    while (!pDS->eof())
+    {
+      const auto it = details.find(pDS->fv(0).get_asInt());
+      if (it != details.end())
+        AddStreamDetail(*pDS, it->second);
+      pDS->next();
+    }
+    pDS->close();
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}({} files) failed", __FUNCTION__, fileIds.size());
+    return false;
+  }
+
+  for (const int fileId : fileIds)
+    details[fileId].DetermineBestStreams();
+  return true;
+}
+
 bool CVideoDatabase::GetResumePoint(CVideoInfoTag& tag)
 {
   if (tag.m_iFileId < 0)
@@ -4980,6 +5192,39 @@ bool CVideoDatabase::GetArtForItem(int mediaId, const MediaType &mediaType, std:
   return false;
 }
 
+bool CVideoDatabase::GetArtForItems(const MediaType& mediaType,
+                                    const std::vector<int>& mediaIds,
+                                    std::map<int, std::map<std::string, std::string>>& art)
+{
+  if (mediaIds.empty())
+    return true;
+
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS2)
+      return false;
+
+    m_pDS2->query(PrepareSQL("SELECT media_id,type,url FROM art WHERE media_type='%s' AND "
+                             "media_id IN (%s)",
+                             mediaType.c_str(), JoinIds(mediaIds).c_str()));
+    while (!m_pDS2->eof())
+    {
+      art[m_pDS2->fv(0).get_asInt()].insert(
+          std::make_pair(m_pDS2->fv(1).get_asString(), m_pDS2->fv(2).get_asString()));
+      m_pDS2->next();
+    }
+    m_pDS2->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}({}, {} items) failed", __FUNCTION__, mediaType, mediaIds.size());
+  }
+  return false;
+}
+
 bool CVideoDatabase::GetArtForAsset(int assetId,
                                     ArtFallbackOptions fallback,
                                     std::map<std::string, std::string>& art)
@@ -6392,11 +6637,20 @@ void CVideoDatabase::UpdateTables(int iVersion)
     }
     m_pDS->close();
   }
+
+  if (iVersion < 132)
+  {
+    // tvshowcounts was a view before, it is filled when the analytics are created
+    CreateTvShowCountsTable();
+  }
+
+  if (iVersion < 133)
+    CreateChangeLogTable();
 }
 
 int CVideoDatabase::GetSchemaVersion() const
 {
-  return 131;
+  return 133;
 }
 
 bool CVideoDatabase::LookupByFolders(const std::string &path, bool shows)
@@ -6507,6 +6761,62 @@ bool CVideoDatabase::GetPlayCounts(const std::string &strPath, CFileItemList &it
   return false;
 }
 
+bool CVideoDatabase::GetPlayStatesBelowPath(const std::string& pathPrefix,
+                                            std::map<std::string, VideoDbPlayState>& states)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    const std::string sql = PrepareSQL(
+        "SELECT"
+        "  path.strPath, files.strFilename, files.playCount, files.lastPlayed,"
+        "  bookmark.timeInSeconds, bookmark.totalTimeInSeconds "
+        "FROM files"
+        "  INNER JOIN path ON files.idPath = path.idPath"
+        "  LEFT JOIN bookmark ON"
+        "    files.idFile = bookmark.idFile AND bookmark.type = %i "
+        "WHERE path.strPath LIKE '%s%%' "
+        "ORDER BY bookmark.timeInSeconds",
+        static_cast<int>(CBookmark::RESUME), pathPrefix.c_str());
+
+    if (!m_pDS->query(sql))
+      return false;
+
+    while (!m_pDS->eof())
+    {
+      std::string path;
+      ConstructPath(path, m_pDS->fv(0).get_asString(), m_pDS->fv(1).get_asString());
+
+      // keep the first resume bookmark of a file, like GetResumeBookMark does
+      const auto [it, inserted] = states.try_emplace(path);
+      if (inserted)
+      {
+        VideoDbPlayState& state = it->second;
+        state.playCount = m_pDS->fv(2).get_asInt();
+        state.lastPlayed.SetFromDBDateTime(m_pDS->fv(3).get_asString());
+        if (!m_pDS->fv(4).get_isNull())
+        {
+          state.resumePoint.timeInSeconds = m_pDS->fv(4).get_asDouble();
+          state.resumePoint.totalTimeInSeconds = m_pDS->fv(5).get_asDouble();
+          state.resumePoint.type = CBookmark::RESUME;
+        }
+      }
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} ({}) failed", __FUNCTION__, pathPrefix);
+  }
+  return false;
+}
+
 int CVideoDatabase::GetPlayCount(int iFileId)
 {
   if (iFileId < 0)
@@ -6658,6 +6968,8 @@ CDateTime CVideoDatabase::SetPlayCount(const CFileItem& item, int count, const C
     // We only need to announce changes to video items in the library
     if (item.HasVideoInfoTag() && item.GetVideoInfoTag()->m_iDbId > 0)
     {
+      LogLibraryChange(item.GetVideoInfoTag()->m_type, item.GetVideoInfoTag()->m_iDbId, false);
+
       CVariant data;
       if (CVideoLibraryQueue::GetInstance().IsScanningLibrary())
         data["transaction"] = true;
@@ -8208,7 +8520,9 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
-    int iRowsFound = RunQuery(strSQL);
+    // list views repeat the same query, keep it prepared
+    const sql_params noParams;
+    int iRowsFound = RunQuery(strSQL, &noParams);
 
     // store the total value of items as a property
     if (total < iRowsFound)
@@ -8237,7 +8551,8 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
           g_passwordManager.bMasterUser                                   ||
           g_passwordManager.IsDatabasePathUnlocked(movie.m_strPath, *CMediaSourceSettings::GetInstance().GetSources("video")))
       {
-        CFileItemPtr pItem(new CFileItem(movie));
+        CFileItemPtr pItem(new CFileItem(std::move(movie)));
+        const CVideoInfoTag& details = *pItem->GetVideoInfoTag();
 
         std::string path;
         CVideoDbUrl itemUrl{videoUrl};
@@ -8249,7 +8564,7 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
           {
             // all versions for the given media id requested; we need to insert the real video
             // version id for this movie into the videodb url
-            path = RewriteVideoVersionURL(strBaseDir, movie);
+            path = RewriteVideoVersionURL(strBaseDir, details);
           }
           // this is a certain version, no need to resolve (e.g. no version chooser on select)
           pItem->SetProperty("has_resolved_video_asset", true);
@@ -8257,16 +8572,17 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
 
         if (path.empty())
         {
-          itemUrl.AppendPath(std::to_string(movie.m_iDbId));
+          itemUrl.AppendPath(std::to_string(details.m_iDbId));
           path = itemUrl.ToString();
         }
 
         pItem->SetPath(path);
-        pItem->SetDynPath(movie.m_strFileNameAndPath);
+        pItem->SetDynPath(details.m_strFileNameAndPath);
 
-        pItem->SetOverlayImage(movie.GetPlayCount() > 0 ? CGUIListItem::ICON_OVERLAY_WATCHED
-                                                        : CGUIListItem::ICON_OVERLAY_UNWATCHED);
+        pItem->SetOverlayImage(details.GetPlayCount() > 0 ? CGUIListItem::ICON_OVERLAY_WATCHED
+                                                          : CGUIListItem::ICON_OVERLAY_UNWATCHED);
         items.Add(pItem);
+        CDirectoryPreview::Publish(items);
       }
     }
 
@@ -8379,6 +8695,7 @@ bool CVideoDatabase::GetTvShowsByWhere(const std::string& strBaseDir, const Filt
                                    ? CGUIListItem::ICON_OVERLAY_WATCHED
                                    : CGUIListItem::ICON_OVERLAY_UNWATCHED);
         items.Add(pItem);
+        CDirectoryPreview::Publish(items);
       }
     }
 
@@ -8496,7 +8813,8 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
           g_passwordManager.bMasterUser                                     ||
           g_passwordManager.IsDatabasePathUnlocked(episode.m_strPath, *CMediaSourceSettings::GetInstance().GetSources("video")))
       {
-        CFileItemPtr pItem(new CFileItem(episode));
+        CFileItemPtr pItem(new CFileItem(std::move(episode)));
+        const CVideoInfoTag& details = *pItem->GetVideoInfoTag();
         formatter.FormatLabel(pItem.get());
 
         int idEpisode = record->at(0).get_asInt();
@@ -8506,17 +8824,18 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
         if (appendFullShowPath && videoUrl.GetItemType() != "episodes")
           path = StringUtils::Format("{}/{}/{}",
                                      record->at(VIDEODB_DETAILS_EPISODE_TVSHOW_ID).get_asInt(),
-                                     episode.m_iSeason, idEpisode);
+                                     details.m_iSeason, idEpisode);
         else
           path = std::to_string(idEpisode);
         itemUrl.AppendPath(path);
         pItem->SetPath(itemUrl.ToString());
-        pItem->SetDynPath(episode.m_strFileNameAndPath);
+        pItem->SetDynPath(details.m_strFileNameAndPath);
 
-        pItem->SetOverlayImage(episode.GetPlayCount() > 0 ? CGUIListItem::ICON_OVERLAY_WATCHED
+        pItem->SetOverlayImage(details.GetPlayCount() > 0 ? CGUIListItem::ICON_OVERLAY_WATCHED
                                                           : CGUIListItem::ICON_OVERLAY_UNWATCHED);
-        pItem->m_dateTime = episode.m_firstAired;
+        pItem->m_dateTime = details.m_firstAired;
         items.Add(pItem);
+        CDirectoryPreview::Publish(items);
       }
     }
 
@@ -9412,17 +9731,19 @@ bool CVideoDatabase::GetMusicVideosByWhere(const std::string &baseDir, const Fil
       if (!checkLocks || m_profileManager.GetMasterProfile().getLockMode() == LOCK_MODE_EVERYONE || g_passwordManager.bMasterUser ||
           g_passwordManager.IsDatabasePathUnlocked(musicvideo.m_strPath, *CMediaSourceSettings::GetInstance().GetSources("video")))
       {
-        CFileItemPtr item(new CFileItem(musicvideo));
+        CFileItemPtr item(new CFileItem(std::move(musicvideo)));
+        const CVideoInfoTag& details = *item->GetVideoInfoTag();
 
         CVideoDbUrl itemUrl = videoUrl;
         std::string path = std::to_string(record->at(0).get_asInt());
         itemUrl.AppendPath(path);
         item->SetPath(itemUrl.ToString());
-        item->SetDynPath(musicvideo.m_strFileNameAndPath);
+        item->SetDynPath(details.m_strFileNameAndPath);
 
-        item->SetOverlayImage(musicvideo.GetPlayCount() > 0 ? CGUIListItem::ICON_OVERLAY_WATCHED
-                                                            : CGUIListItem::ICON_OVERLAY_UNWATCHED);
+        item->SetOverlayImage(details.GetPlayCount() > 0 ? CGUIListItem::ICON_OVERLAY_WATCHED
+                                                         : CGUIListItem::ICON_OVERLAY_UNWATCHED);
         items.Add(item);
+        CDirectoryPreview::Publish(items);
       }
     }
 
@@ -9441,39 +9762,22 @@ bool CVideoDatabase::GetMusicVideosByWhere(const std::string &baseDir, const Fil
 
 unsigned int CVideoDatabase::GetRandomMusicVideoIDs(const std::string& strWhere, std::vector<std::pair<int,int> > &songIDs)
 {
-  try
-  {
-    if (nullptr == m_pDB)
-      return 0;
-    if (nullptr == m_pDS)
-      return 0;
+  songIDs.clear();
+  if (nullptr == m_pDB || nullptr == m_pDS)
+    return 0;
 
-    std::string strSQL = "select distinct idMVideo from musicvideo_view";
-    if (!strWhere.empty())
-      strSQL += " where " + strWhere;
-    strSQL += PrepareSQL(" ORDER BY RANDOM()");
+  std::string strSQL = "select distinct idMVideo from musicvideo_view";
+  if (!strWhere.empty())
+    strSQL += " where " + strWhere;
 
-    if (!m_pDS->query(strSQL)) return 0;
-    songIDs.clear();
-    if (m_pDS->num_rows() == 0)
-    {
-      m_pDS->close();
-      return 0;
-    }
-    songIDs.reserve(m_pDS->num_rows());
-    while (!m_pDS->eof())
-    {
-      songIDs.push_back(std::make_pair<int,int>(2,m_pDS->fv(0).get_asInt()));
-      m_pDS->next();
-    }    // cleanup
-    m_pDS->close();
-    return songIDs.size();
-  }
-  catch (...)
-  {
-    CLog::Log(LOGERROR, "{} ({}) failed", __FUNCTION__, strWhere);
-  }
-  return 0;
+  // Shuffled here rather than with ORDER BY RANDOM(), so the db does not sort the whole library
+  std::vector<int> ids;
+  GetRandomIDs(strSQL, 0, ids);
+
+  songIDs.reserve(ids.size());
+  for (int id : ids)
+    songIDs.emplace_back(2, id);
+  return songIDs.size();
 }
 
 int CVideoDatabase::GetMatchingMusicVideo(const std::string& strArtist, const std::string& strAlbum, const std::string& strTitle)
@@ -10545,6 +10849,9 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
     if (nullptr == pDS2)
       return;
 
+    // NFO files and artwork are written in the background while the next items are read
+    CFileWriteQueue writer;
+
     // if we're exporting to a single folder, we export thumbs as well
     std::string exportRoot = URIUtils::AddFileToFolder(path, "kodi_videodb_" + CDateTime::GetCurrentDateTime().GetAsDBDate());
     std::string xmlFile = URIUtils::AddFileToFolder(exportRoot, "videodb.xml");
@@ -10654,17 +10961,7 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
                                     URIUtils::GetFileName(nfoFile));
           }
 
-          if (overwrite || !CFile::Exists(nfoFile, false))
-          {
-            if(!xmlDoc.SaveFile(nfoFile))
-            {
-              CLog::Log(LOGERROR, "{}: Movie nfo export failed! ('{}')", __FUNCTION__, nfoFile);
-              CGUIDialogKaiToast::QueueNotification(CGUIDialogKaiToast::Error,
-                                                    g_localizeStrings.Get(20302),
-                                                    CURL::GetRedacted(nfoFile));
-              iFailCount++;
-            }
-          }
+          writer.SaveNfo(xmlDoc, nfoFile, overwrite);
         }
       }
       if (!singleFile)
@@ -10686,10 +10983,10 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
         for (const auto &i : artwork)
         {
           std::string savedThumb = item.GetLocalArt(i.first, false);
-          CServiceBroker::GetTextureCache()->Export(i.second, savedThumb, overwrite);
+          writer.ExportImage(i.second, savedThumb, overwrite);
         }
         if (actorThumbs)
-          ExportActorThumbs(actorsDir, movie, !singleFile, overwrite);
+          ExportActorThumbs(writer, actorsDir, movie, !singleFile, overwrite);
       }
       m_pDS->next();
       current++;
@@ -10735,7 +11032,7 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
           for (const auto& art : artwork)
           {
             std::string savedThumb = URIUtils::AddFileToFolder(itemPath, art.first);
-            CServiceBroker::GetTextureCache()->Export(art.second, savedThumb, overwrite);
+            writer.ExportImage(art.second, savedThumb, overwrite);
           }
         }
         else
@@ -10800,18 +11097,7 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
         {
           std::string nfoFile(URIUtils::ReplaceExtension(item.GetTBNFile(), ".nfo"));
 
-          if (overwrite || !CFile::Exists(nfoFile, false))
-          {
-            if(!xmlDoc.SaveFile(nfoFile))
-            {
-              CLog::Log(LOGERROR, "{}: Musicvideo nfo export failed! ('{}')", __FUNCTION__,
-                        nfoFile);
-              CGUIDialogKaiToast::QueueNotification(CGUIDialogKaiToast::Error,
-                                                    g_localizeStrings.Get(20302),
-                                                    CURL::GetRedacted(nfoFile));
-              iFailCount++;
-            }
-          }
+          writer.SaveNfo(xmlDoc, nfoFile, overwrite);
         }
       }
       if (!singleFile)
@@ -10832,7 +11118,7 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
         for (const auto &i : artwork)
         {
           std::string savedThumb = item.GetLocalArt(i.first, false);
-          CServiceBroker::GetTextureCache()->Export(i.second, savedThumb, overwrite);
+          writer.ExportImage(i.second, savedThumb, overwrite);
         }
       }
       m_pDS->next();
@@ -10903,17 +11189,7 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
         {
           std::string nfoFile = URIUtils::AddFileToFolder(tvshow.m_strPath, "tvshow.nfo");
 
-          if (overwrite || !CFile::Exists(nfoFile, false))
-          {
-            if(!xmlDoc.SaveFile(nfoFile))
-            {
-              CLog::Log(LOGERROR, "{}: TVShow nfo export failed! ('{}')", __FUNCTION__, nfoFile);
-              CGUIDialogKaiToast::QueueNotification(CGUIDialogKaiToast::Error,
-                                                    g_localizeStrings.Get(20302),
-                                                    CURL::GetRedacted(nfoFile));
-              iFailCount++;
-            }
-          }
+          writer.SaveNfo(xmlDoc, nfoFile, overwrite);
         }
       }
       if (!singleFile)
@@ -10930,11 +11206,11 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
         for (const auto &i : artwork)
         {
           std::string savedThumb = item.GetLocalArt(i.first, true);
-          CServiceBroker::GetTextureCache()->Export(i.second, savedThumb, overwrite);
+          writer.ExportImage(i.second, savedThumb, overwrite);
         }
 
         if (actorThumbs)
-          ExportActorThumbs(actorsDir, tvshow, !singleFile, overwrite);
+          ExportActorThumbs(writer, actorsDir, tvshow, !singleFile, overwrite);
 
         // export season thumbs
         for (const auto &i : seasonArt)
@@ -10950,7 +11226,7 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
           {
             std::string savedThumb(item.GetLocalArt(seasonThumb + "-" + j.first, true));
             if (!i.second.empty())
-              CServiceBroker::GetTextureCache()->Export(j.second, savedThumb, overwrite);
+              writer.ExportImage(j.second, savedThumb, overwrite);
           }
         }
       }
@@ -11001,17 +11277,7 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
           {
             std::string nfoFile(URIUtils::ReplaceExtension(item.GetTBNFile(), ".nfo"));
 
-            if (overwrite || !CFile::Exists(nfoFile, false))
-            {
-              if(!xmlDoc.SaveFile(nfoFile))
-              {
-                CLog::Log(LOGERROR, "{}: Episode nfo export failed! ('{}')", __FUNCTION__, nfoFile);
-                CGUIDialogKaiToast::QueueNotification(CGUIDialogKaiToast::Error,
-                                                      g_localizeStrings.Get(20302),
-                                                      CURL::GetRedacted(nfoFile));
-                iFailCount++;
-              }
-            }
+            writer.SaveNfo(xmlDoc, nfoFile, overwrite);
           }
         }
         if (!singleFile)
@@ -11032,10 +11298,10 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
           for (const auto &i : artwork)
           {
             std::string savedThumb = item.GetLocalArt(i.first, false);
-            CServiceBroker::GetTextureCache()->Export(i.second, savedThumb, overwrite);
+            writer.ExportImage(i.second, savedThumb, overwrite);
           }
           if (actorThumbs)
-            ExportActorThumbs(actorsDir, episode, !singleFile, overwrite);
+            ExportActorThumbs(writer, actorsDir, episode, !singleFile, overwrite);
         }
       }
       pDS->close();
@@ -11050,6 +11316,9 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
       progress->Progress();
     }
 
+    iFailCount += writer.Wait();
+    writer.LogStatistics("CVideoDatabase::ExportToXML");
+
     if (singleFile)
     {
       // now dump path info
@@ -11100,7 +11369,11 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
         CVariant{647}, CVariant{StringUtils::Format(g_localizeStrings.Get(15011), iFailCount)});
 }
 
-void CVideoDatabase::ExportActorThumbs(const std::string &strDir, const CVideoInfoTag &tag, bool singleFiles, bool overwrite /*=false*/)
+void CVideoDatabase::ExportActorThumbs(CFileWriteQueue& writer,
+                                       const std::string& strDir,
+                                       const CVideoInfoTag& tag,
+                                       bool singleFiles,
+                                       bool overwrite /*=false*/)
 {
   std::string strPath(strDir);
   if (singleFiles)
@@ -11120,7 +11393,7 @@ void CVideoDatabase::ExportActorThumbs(const std::string &strDir, const CVideoIn
     if (!i.thumb.empty())
     {
       std::string thumbFile(GetSafeFile(strPath, i.strName));
-      CServiceBroker::GetTextureCache()->Export(i.thumb, thumbFile, overwrite);
+      writer.ExportImage(i.thumb, thumbFile, overwrite);
     }
   }
 }
@@ -11393,7 +11666,11 @@ void CVideoDatabase::InvalidatePathHash(const std::string& strPath)
 bool CVideoDatabase::CommitTransaction()
 {
   if (CDatabase::CommitTransaction())
-  { // number of items in the db has likely changed, so recalculate
+  {
+    if (InWriteBatch())
+      return true; // recalculated when the batch is committed
+
+    // number of items in the db has likely changed, so recalculate
     GUIINFO::CLibraryGUIInfo& guiInfo = CServiceBroker::GetGUI()->GetInfoManager().GetInfoProviders().GetLibraryInfoProvider();
     guiInfo.SetLibraryBool(LIBRARY_HAS_MOVIES, HasContent(VideoDbContentType::MOVIES));
     guiInfo.SetLibraryBool(LIBRARY_HAS_TVSHOWS, HasContent(VideoDbContentType::TVSHOWS));
@@ -11499,6 +11776,8 @@ std::string CVideoDatabase::GetSafeFile(const std::string &dir, const std::strin
 
 void CVideoDatabase::AnnounceRemove(const std::string& content, int id, bool scanning /* = false */)
 {
+  LogLibraryChange(content, id, true);
+
   CVariant data;
   data["type"] = content;
   data["id"] = id;
@@ -11509,6 +11788,8 @@ void CVideoDatabase::AnnounceRemove(const std::string& content, int id, bool sca
 
 void CVideoDatabase::AnnounceUpdate(const std::string& content, int id)
 {
+  LogLibraryChange(content, id, false);
+
   CVariant data;
   data["type"] = content;
   data["id"] = id;
@@ -15,13 +15,16 @@
 #include "utils/SortUtils.h"
 #include "utils/UrlOptions.h"
 
+#include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
 class CFileItem;
 class CFileItemList;
+class CFileWriteQueue;
 class CVideoSettings;
 class CGUIDialogProgress;
 class CGUIDialogProgressBarHandle;
@@ -35,6 +38,7 @@ namespace dbiplus
 {
   class field_value;
   typedef std::vector<field_value> sql_record;
+  typedef std::vector<field_value> sql_params;
 }
 
 #ifndef my_offsetof
@@ -413,6 +417,16 @@ enum class DeleteMovieCascadeAction
   ALL_ASSETS
 };
 
+/*! \brief Play state of a single file as stored in the files and bookmark tables
+ \sa CVideoDatabase::GetPlayStatesBelowPath
+ */
+struct VideoDbPlayState
+{
+  int playCount = 0;
+  CDateTime lastPlayed;
+  CBookmark resumePoint; ///< not set if the file has no resume bookmark
+};
+
 #define COMPARE_PERCENTAGE     0.90f // 90%
 #define COMPARE_PERCENTAGE_MIN 0.50f // 50%
 
@@ -512,6 +526,17 @@ public:
    */
   bool GetPlayCounts(const std::string &path, CFileItemList &items);
 
+  /*! \brief Get the playcount, last played time and resume point of all files below a path
+   Uses a single query instead of a lookup per file, for callers that need the state of many files
+   located in different sub paths, like the PVR recordings.
+   \param pathPrefix the path to fetch the files below, e.g. pvr://recordings/
+   \param states [out] the play states, keyed by the full path of each file
+   \return true if the query succeeded, false otherwise
+   \sa GetPlayCount, GetLastPlayed, GetResumeBookMark
+   */
+  bool GetPlayStatesBelowPath(const std::string& pathPrefix,
+                              std::map<std::string, VideoDbPlayState>& states);
+
   void UpdateMovieTitle(int idMovie,
                         const std::string& strNewMovieTitle,
                         VideoDbContentType iType = VideoDbContentType::MOVIES);
@@ -689,6 +714,14 @@ public:
   bool GetResumePoint(CVideoInfoTag& tag);
   bool GetStreamDetails(CFileItem& item);
   bool GetStreamDetails(CVideoInfoTag& tag) const;
+  /*!
+   * \brief Get the stream details of several files with a single query
+   * \param fileIds the ids of the files
+   * \param details the stream details by file id, empty for files without any
+   * \return false if the query failed
+   */
+  bool GetStreamDetailsForFiles(const std::vector<int>& fileIds,
+                                std::map<int, CStreamDetails>& details) const;
   bool GetDetailsByTypeAndId(CFileItem& item, VideoDbContentType type, int id);
   CVideoInfoTag GetDetailsByTypeAndId(VideoDbContentType type, int id);
 
@@ -751,6 +784,13 @@ public:
    */
   bool GetSubPaths(const std::string& basepath, std::vector< std::pair<int, std::string> >& subpaths);
 
+  /*! \brief Get the paths directly below a path, i.e. the ones linked to it by idParentPath
+   \param path the parent path
+   \param children [out] the child paths
+   \return true on success
+   */
+  bool GetChildPaths(const std::string& path, std::vector<std::string>& children);
+
   bool GetSourcePath(const std::string &path, std::string &sourcePath);
   bool GetSourcePath(const std::string &path, std::string &sourcePath, VIDEO::SScanSettings& settings);
 
@@ -904,7 +944,11 @@ public:
   void UpdateFileDateAdded(CVideoInfoTag& details);
 
   void ExportToXML(const std::string &path, bool singleFile = true, bool images=false, bool actorThumbs=false, bool overwrite=false);
-  void ExportActorThumbs(const std::string &path, const CVideoInfoTag& tag, bool singleFiles, bool overwrite=false);
+  void ExportActorThumbs(CFileWriteQueue& writer,
+                         const std::string& path,
+                         const CVideoInfoTag& tag,
+                         bool singleFiles,
+                         bool overwrite = false);
   void ImportFromXML(const std::string &path);
   void DumpToDummyFiles(const std::string &path);
   bool ImportArtFromXML(const TiXmlNode *node, std::map<std::string, std::string> &artwork);
@@ -964,6 +1008,16 @@ public:
   void SetArtForItem(int mediaId, const MediaType &mediaType, const std::map<std::string, std::string> &art);
   bool GetArtForItem(int mediaId, const MediaType &mediaType, std::map<std::string, std::string> &art);
   std::string GetArtForItem(int mediaId, const MediaType &mediaType, const std::string &artType);
+  /*!
+   * \brief Get the art of several items of the same media type with a single query
+   * \param mediaType the media type of the items
+   * \param mediaIds the ids of the items
+   * \param art the art by item id, items without art are left out
+   * \return false if the query failed
+   */
+  bool GetArtForItems(const MediaType& mediaType,
+                      const std::vector<int>& mediaIds,
+                      std::map<int, std::map<std::string, std::string>>& art);
 
   /*!
    * \brief Retrieve all art for the given video asset, with optional fallback to the art of the
@@ -1195,6 +1249,10 @@ private:
   void CreateLinkIndex(const char *table);
   void CreateForeignLinkIndex(const char *table, const char *foreignkey);
 
+  /*! \brief Create the table with the episode counts of the tvshows, kept up to date by triggers
+   */
+  void CreateTvShowCountsTable();
+
   /*! \brief (Re)Create the generic database views for movies, tvshows,
      episodes and music videos
    */
@@ -1210,9 +1268,11 @@ private:
   /*! \brief Run a query on the main dataset and return the number of rows
    If no rows are found we close the dataset and return 0.
    \param sql the sql query to run
+   \param params if set, the values of the ? placeholders in sql. The query is then run as a
+   prepared statement which the connection keeps cached for the next run of the same sql.
    \return the number of rows, -1 for an error.
    */
-  int RunQuery(const std::string &sql);
+  int RunQuery(const std::string& sql, const dbiplus::sql_params* params = nullptr);
 
   void AppendIdLinkFilter(const char* field, const char *table, const MediaType& mediaType, const char *view, const char *viewKey, const CUrlOptions::UrlOptions& options, Filter &filter);
   void AppendLinkFilter(const char* field, const char *table, const MediaType& mediaType, const char *view, const char *viewKey, const CUrlOptions::UrlOptions& options, Filter &filter);
@@ -1258,8 +1318,8 @@ private:
   std::vector<int> CleanMediaType(const std::string &mediaType, const std::string &cleanableFileIDs,
                                   std::map<int, bool> &pathsDeleteDecisions, std::string &deletedFileIDs, bool silent);
 
-  static void AnnounceRemove(const std::string& content, int id, bool scanning = false);
-  static void AnnounceUpdate(const std::string& content, int id);
+  void AnnounceRemove(const std::string& content, int id, bool scanning = false);
+  void AnnounceUpdate(const std::string& content, int id);
 
   static CDateTime GetDateAdded(const std::string& filename, CDateTime dateAdded = CDateTime());
 
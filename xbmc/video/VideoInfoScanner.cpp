@@ -16,6 +16,7 @@
 #include "URL.h"
 #include "Util.h"
 #include "VideoInfoDownloader.h"
+#include "VideoLookupQueue.h"
 #include "cores/VideoPlayer/DVDFileInfo.h"
 #include "dialogs/GUIDialogExtendedProgressBar.h"
 #include "dialogs/GUIDialogProgress.h"
@@ -58,6 +59,12 @@ using namespace KODI::MESSAGING;
 using KODI::MESSAGING::HELPERS::DialogResponse;
 using KODI::UTILITY::CDigest;
 
+namespace
+{
+// marks the hash of a folder with subfolders stored by the incremental scan
+constexpr const char* INCREMENTAL_HASH_PREFIX = "d:";
+} // unnamed namespace
+
 namespace VIDEO
 {
 
@@ -286,6 +293,7 @@ namespace VIDEO
     }
 
     std::string hash, dbHash;
+    bool incremental = false;
     if (content == CONTENT_MOVIES ||content == CONTENT_MUSICVIDEOS)
     {
       if (m_handle)
@@ -298,10 +306,26 @@ namespace VIDEO
       if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bVideoLibraryUseFastHash && !URIUtils::IsPlugin(strDirectory))
         fastHash = GetFastHash(strDirectory, regexps);
 
+      // In incremental mode folders with subfolders are fingerprinted by their own mtime as well.
+      // Their hashes are marked so they can't be mistaken for a leaf folder's fast hash when the
+      // mode is switched off again.
+      incremental = !fastHash.empty() && CServiceBroker::GetSettingsComponent()
+                                             ->GetAdvancedSettings()
+                                             ->m_bVideoLibraryIncrementalScan;
+      const std::string folderHash = INCREMENTAL_HASH_PREFIX + fastHash;
+
       if (m_database.GetPathHash(strDirectory, dbHash) && !fastHash.empty() && StringUtils::EqualsNoCase(fastHash, dbHash))
       { // fast hashes match - no need to process anything
         hash = fastHash;
       }
+      else if (incremental && StringUtils::EqualsNoCase(folderHash, dbHash))
+      { // folder unchanged - only its known subfolders need to be checked
+        hash = folderHash;
+        std::vector<std::string> children;
+        m_database.GetChildPaths(strDirectory, children);
+        for (const std::string& child : children)
+          items.Add(std::make_shared<CFileItem>(child, true));
+      }
       else
       { // need to fetch the folder
         CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
@@ -316,7 +340,12 @@ namespace VIDEO
 
         // check whether to re-use previously computed fast hash
         if (!CanFastHash(items, regexps) || fastHash.empty())
-          GetPathHash(items, hash);
+        {
+          if (incremental && !items.IsEmpty())
+            hash = folderHash;
+          else
+            GetPathHash(items, hash);
+        }
         else
           hash = fastHash;
       }
@@ -395,6 +424,10 @@ namespace VIDEO
           m_pathsToClean.insert(m_database.GetPathId(strDirectory));
         CLog::Log(LOGDEBUG, "VideoInfoScanner: No (new) information was found in dir {}",
                   CURL::GetRedacted(strDirectory));
+
+        // the incremental scan only finds folders it has a hash for
+        if (incremental && !m_bStop && !hash.empty())
+          m_database.SetPathHash(strDirectory, hash);
       }
     }
     else if (!StringUtils::EqualsNoCase(hash, dbHash) && (content == CONTENT_MOVIES || content == CONTENT_MUSICVIDEOS))
@@ -455,10 +488,18 @@ namespace VIDEO
 
     m_database.Open();
 
+    StartMovieLookups(items, bDirNames, content, useLocal, pURL, pDlgProgress);
+
+    // commit the writes of several items at once
+    if (!pDlgProgress)
+      m_database.BeginWriteBatch(
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_libraryWriteBatch);
+
     bool FoundSomeInfo = false;
     std::vector<int> seenPaths;
     for (int i = 0; i < items.Size(); ++i)
     {
+      m_database.WriteBatchItemDone();
       CFileItemPtr pItem = items[i];
 
       // we do this since we may have a override per dir
@@ -552,6 +593,9 @@ namespace VIDEO
           m_pathsToClean.insert(i->first);
       }
     }
+    m_lookupQueue.reset();
+    m_database.EndWriteBatch();
+
     if(pDlgProgress)
       pDlgProgress->ShowProgressBar(false);
 
@@ -559,6 +603,47 @@ namespace VIDEO
     return FoundSomeInfo;
   }
 
+  void CVideoInfoScanner::StartMovieLookups(const CFileItemList& items,
+                                            bool bDirNames,
+                                            CONTENT_TYPE content,
+                                            bool useLocal,
+                                            const CScraperUrl* pURL,
+                                            const CGUIDialogProgress* pDlgProgress)
+  {
+    m_lookupQueue.reset();
+
+    // interactive lookups need the progress dialog and a given url is used for the first item
+    if (content != CONTENT_MOVIES || pURL || pDlgProgress || items.Size() < 2)
+      return;
+
+    const std::shared_ptr<CAdvancedSettings> advancedSettings =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+    if (advancedSettings->m_videoScannerLookupThreads < 2)
+      return;
+
+    // only python scrapers can run concurrently, xml scrapers share their cache folder
+    const ScraperPtr scraper = m_database.GetScraperForPath(items.GetPath());
+    if (!scraper || !scraper->IsPython() || scraper->Content() != CONTENT_MOVIES)
+      return;
+
+    m_lookupQueue = std::make_unique<CVideoLookupQueue>(
+        scraper, bDirNames, useLocal, advancedSettings->m_videoScannerLookupThreads,
+        std::chrono::milliseconds(advancedSettings->m_videoScannerLookupInterval));
+
+    for (const auto& item : items)
+    {
+      if (item->m_bIsFolder || !item->IsVideo() || item->IsNFO() ||
+          (item->IsPlayList() && !URIUtils::HasExtension(item->GetPath(), ".strm")))
+        continue;
+      if (CUtil::ExcludeFileOrFolder(item->GetPath(),
+                                     advancedSettings->m_moviesExcludeFromScanRegExps))
+        continue;
+      if (m_database.HasMovieInfo(item->GetDynPath()))
+        continue;
+      m_lookupQueue->Add(*item);
+    }
+  }
+
   CInfoScanner::INFO_RET
   CVideoInfoScanner::RetrieveInfoForTvShow(CFileItem *pItem,
                                            bool bDirNames,
@@ -734,6 +819,29 @@ namespace VIDEO
     if (m_handle)
       m_handle->SetText(pItem->GetMovieName(bDirNames));
 
+    CVideoLookupQueue::Result lookup;
+    if (m_lookupQueue && !pURL && m_lookupQueue->GetScraper()->ID() == info2->ID() &&
+        m_lookupQueue->Get(*pItem, lookup, [this] { return m_bStop; }))
+    {
+      // looked up in the background, failed lookups are retried below
+      if (!lookup.found)
+        return INFO_NOT_FOUND;
+
+      *pItem->GetVideoInfoTag() = lookup.details;
+      if (m_handle)
+        m_handle->SetText(lookup.details.m_strTitle);
+
+      const int dbId = AddVideo(pItem, info2->Content(), bDirNames,
+                                lookup.nfoType == CInfoScanner::FULL_NFO || useLocal);
+      if (dbId < 0)
+        return INFO_ERROR;
+      if (!m_ignoreVideoVersions && ProcessVideoVersion(VideoDbContentType::MOVIES, dbId))
+        return INFO_HAVE_ALREADY;
+      return INFO_ADDED;
+    }
+    if (m_lookupQueue && m_bStop)
+      return INFO_CANCELLED;
+
     CInfoScanner::INFO_TYPE result = CInfoScanner::NO_NFO;
     CScraperUrl scrUrl;
     // handle .nfo files
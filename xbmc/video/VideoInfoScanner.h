@@ -13,6 +13,7 @@
 #include "addons/Scraper.h"
 #include "guilib/GUIListItem.h"
 
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -23,6 +24,7 @@ class CFileItemList;
 
 namespace VIDEO
 {
+  class CVideoLookupQueue;
   class IVideoInfoTagLoader;
 
   typedef struct SScanSettings
@@ -114,6 +116,17 @@ namespace VIDEO
     INFO_RET RetrieveInfoForMusicVideo(CFileItem *pItem, bool bDirNames, ADDON::ScraperPtr &scraper, bool useLocal, CScraperUrl* pURL, CGUIDialogProgress* pDlgProgress);
     INFO_RET RetrieveInfoForEpisodes(CFileItem *item, long showID, const ADDON::ScraperPtr &scraper, bool useLocal, CGUIDialogProgress *progress = NULL);
 
+    /*! \brief Queue the lookups of all movies in a folder that are missing from the library, so
+     they run concurrently while the scanner processes the items in order.
+     Does nothing unless the folder is scanned non-interactively with a python scraper.
+     */
+    void StartMovieLookups(const CFileItemList& items,
+                           bool bDirNames,
+                           CONTENT_TYPE content,
+                           bool useLocal,
+                           const CScraperUrl* pURL,
+                           const CGUIDialogProgress* pDlgProgress);
+
     /*! \brief Update the progress bar with the heading and line and check for cancellation
      \param progress CGUIDialogProgress bar
      \param heading string id of heading
@@ -248,6 +261,7 @@ namespace VIDEO
     bool m_ignoreVideoExtras{false};
     std::string m_strStartDir;
     CVideoDatabase m_database;
+    std::unique_ptr<CVideoLookupQueue> m_lookupQueue;
     std::set<std::string> m_pathsToCount;
     std::set<int> m_pathsToClean;
 
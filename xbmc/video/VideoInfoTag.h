@@ -54,6 +54,10 @@ class CVideoInfoTag : public IArchivable, public ISerializable, public ISortable
 {
 public:
   CVideoInfoTag() { Reset(); }
+  CVideoInfoTag(const CVideoInfoTag&) = default;
+  CVideoInfoTag(CVideoInfoTag&&) = default;
+  CVideoInfoTag& operator=(const CVideoInfoTag&) = default;
+  CVideoInfoTag& operator=(CVideoInfoTag&&) = default;
   virtual ~CVideoInfoTag() = default;
   void Reset();
   /* \brief Load information to a videoinfotag from an XML element
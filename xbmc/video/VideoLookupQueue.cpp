@@ -0,0 +1,206 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoLookupQueue.h"
+
+#include "FileItem.h"
+#include "URL.h"
+#include "Util.h"
+#include "VideoInfoDownloader.h"
+#include "threads/Event.h"
+#include "utils/ScraperUrl.h"
+#include "utils/XTimeUtils.h"
+#include "utils/log.h"
+#include "video/tags/IVideoInfoTagLoader.h"
+#include "video/tags/VideoInfoTagLoaderFactory.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+using namespace VIDEO;
+using namespace std::chrono_literals;
+
+struct CVideoLookupQueue::Lookup
+{
+  CEvent done{true};
+  bool valid = false;
+  Result result;
+};
+
+CVideoLookupQueue::CVideoLookupQueue(const ADDON::ScraperPtr& scraper,
+                                     bool dirNames,
+                                     bool useLocal,
+                                     unsigned int concurrency,
+                                     std::chrono::milliseconds interval)
+  : m_scraper(scraper),
+    m_dirNames(dirNames),
+    m_useLocal(useLocal),
+    m_interval(interval),
+    m_jobs(false, std::max(concurrency, 1u), CJob::PRIORITY_NORMAL)
+{
+}
+
+CVideoLookupQueue::~CVideoLookupQueue()
+{
+  // lookups already running keep their own reference to their Lookup and finish on their own
+  m_jobs.CancelJobs();
+}
+
+void CVideoLookupQueue::Add(const CFileItem& item)
+{
+  const std::string& path = item.GetPath();
+  if (m_lookups.find(path) != m_lookups.end())
+    return;
+
+  auto lookup = std::make_shared<Lookup>();
+  m_lookups.emplace(path, lookup);
+
+  m_jobs.Submit([item = CFileItem(item), scraper = m_scraper, dirNames = m_dirNames,
+                 useLocal = m_useLocal, interval = m_interval, lookup]() {
+    WaitForSlot(scraper->ID(), interval);
+    Run(item, scraper, dirNames, useLocal, *lookup);
+    lookup->done.Set();
+  });
+}
+
+bool CVideoLookupQueue::Get(const CFileItem& item,
+                            Result& result,
+                            const std::function<bool()>& cancelled)
+{
+  const auto it = m_lookups.find(item.GetPath());
+  if (it == m_lookups.end())
+    return false;
+
+  const std::shared_ptr<Lookup> lookup = it->second;
+  m_lookups.erase(it);
+
+  while (!lookup->done.Wait(100ms))
+  {
+    if (cancelled())
+      return false;
+  }
+
+  if (!lookup->valid)
+    return false;
+
+  result = std::move(lookup->result);
+  return true;
+}
+
+void CVideoLookupQueue::WaitForSlot(const std::string& scraperId,
+                                    std::chrono::milliseconds interval)
+{
+  if (interval <= 0ms)
+    return;
+
+  static CCriticalSection section;
+  static std::unordered_map<std::string, std::chrono::steady_clock::time_point> nextStart;
+
+  std::chrono::steady_clock::time_point start;
+  {
+    std::unique_lock<CCriticalSection> lock(section);
+    start = std::max(std::chrono::steady_clock::now(), nextStart[scraperId]);
+    nextStart[scraperId] = start + interval;
+  }
+
+  const auto wait = start - std::chrono::steady_clock::now();
+  if (wait > 0ms)
+    KODI::TIME::Sleep(std::chrono::duration_cast<std::chrono::milliseconds>(wait));
+}
+
+void CVideoLookupQueue::Run(const CFileItem& source,
+                            const ADDON::ScraperPtr& scraper,
+                            bool dirNames,
+                            bool useLocal,
+                            Lookup& lookup)
+{
+  CFileItem item(source);
+  CInfoScanner::INFO_TYPE nfoType = CInfoScanner::NO_NFO;
+  std::unique_ptr<IVideoInfoTagLoader> loader;
+  if (useLocal)
+  {
+    loader.reset(CVideoInfoTagLoaderFactory::CreateLoader(item, scraper, dirNames));
+    if (loader)
+    {
+      item.GetVideoInfoTag()->Reset();
+      nfoType = loader->Load(*item.GetVideoInfoTag(), false);
+    }
+  }
+  lookup.result.nfoType = nfoType;
+
+  if (nfoType == CInfoScanner::FULL_NFO)
+  {
+    lookup.result.details = *item.GetVideoInfoTag();
+    lookup.result.found = true;
+    lookup.valid = true;
+    return;
+  }
+
+  CScraperUrl url;
+  if (nfoType == CInfoScanner::URL_NFO || nfoType == CInfoScanner::COMBINED_NFO)
+    url = loader->ScraperUrl();
+
+  std::string movieTitle = item.GetMovieName(dirNames);
+  int movieYear = -1;
+  if (nfoType == CInfoScanner::TITLE_NFO)
+  {
+    movieTitle = item.GetVideoInfoTag()->GetTitle();
+    movieYear = item.GetVideoInfoTag()->GetYear();
+  }
+
+  IVideoInfoTagLoader* overrides =
+      (nfoType == CInfoScanner::COMBINED_NFO || nfoType == CInfoScanner::OVERRIDE_NFO)
+          ? loader.get()
+          : nullptr;
+  CVideoInfoDownloader downloader(scraper);
+
+  std::string identifierType;
+  std::string identifier;
+  if (scraper->IsPython() && CUtil::GetFilenameIdentifier(movieTitle, identifierType, identifier))
+  {
+    const std::unordered_map<std::string, std::string> uniqueIDs{{identifierType, identifier}};
+    CVideoInfoTag details;
+    if (downloader.GetDetails(uniqueIDs, CScraperUrl(), details))
+    {
+      if (overrides)
+        overrides->Load(details, true);
+      lookup.result.details = std::move(details);
+      lookup.result.found = true;
+      lookup.valid = true;
+      return;
+    }
+  }
+
+  if (!url.HasUrls())
+  {
+    MOVIELIST movies;
+    const int rc = downloader.FindMovie(movieTitle, movieYear, movies);
+    if (rc <= 0)
+      return; // the scanner retries and decides whether to give up
+    if (movies.empty())
+    {
+      lookup.valid = true;
+      return;
+    }
+    url = movies[0];
+  }
+
+  CLog::Log(LOGDEBUG, "CVideoLookupQueue::{} - fetching '{}' for '{}' using {}", __FUNCTION__,
+            url.GetFirstThumbUrl(), CURL::GetRedacted(item.GetPath()), scraper->Name());
+
+  CVideoInfoTag details;
+  if (!downloader.GetDetails({}, url, details))
+    return;
+
+  if (overrides)
+    overrides->Load(details, true);
+  lookup.result.details = std::move(details);
+  lookup.result.found = true;
+  lookup.valid = true;
+}
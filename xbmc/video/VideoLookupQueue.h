@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "InfoScanner.h"
+#include "addons/Scraper.h"
+#include "threads/CriticalSection.h"
+#include "utils/JobManager.h"
+#include "video/VideoInfoTag.h"
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+class CFileItem;
+
+namespace VIDEO
+{
+/*!
+ \brief Runs the NFO parsing and scraper lookups of movies on job workers ahead of the scanner.
+
+ The scanner queues all items of a folder that still need info and then picks up the results in
+ its usual order, so database writes stay on the scanner thread. Lookups that fail are left to
+ the caller, which retries them serially with its normal error handling.
+ */
+class CVideoLookupQueue
+{
+public:
+  struct Result
+  {
+    CInfoScanner::INFO_TYPE nfoType = CInfoScanner::NO_NFO;
+    bool found = false; //!< false if the scraper returned no match
+    CVideoInfoTag details;
+  };
+
+  /*!
+   \param scraper the scraper to look items up with, must be thread safe (python scrapers are)
+   \param dirNames whether to use the folder name for the lookup
+   \param useLocal whether to use NFO files
+   \param concurrency the number of lookups to run at once
+   \param interval the minimum time between two lookups of the same scraper
+   */
+  CVideoLookupQueue(const ADDON::ScraperPtr& scraper,
+                    bool dirNames,
+                    bool useLocal,
+                    unsigned int concurrency,
+                    std::chrono::milliseconds interval);
+  ~CVideoLookupQueue();
+
+  CVideoLookupQueue(const CVideoLookupQueue&) = delete;
+  CVideoLookupQueue& operator=(const CVideoLookupQueue&) = delete;
+
+  const ADDON::ScraperPtr& GetScraper() const { return m_scraper; }
+
+  void Add(const CFileItem& item);
+
+  /*!
+   \brief Wait for the lookup of an item queued with Add().
+   \param item the item
+   \param[out] result the lookup result
+   \param cancelled polled while waiting, the wait is given up once it returns true
+   \return true if result is valid, false if the item has to be looked up by the caller
+   */
+  bool Get(const CFileItem& item, Result& result, const std::function<bool()>& cancelled);
+
+private:
+  struct Lookup;
+
+  static void Run(const CFileItem& item,
+                  const ADDON::ScraperPtr& scraper,
+                  bool dirNames,
+                  bool useLocal,
+                  Lookup& lookup);
+  static void WaitForSlot(const std::string& scraperId, std::chrono::milliseconds interval);
+
+  ADDON::ScraperPtr m_scraper;
+  bool m_dirNames;
+  bool m_useLocal;
+  std::chrono::milliseconds m_interval;
+  std::map<std::string, std::shared_ptr<Lookup>> m_lookups;
+  CJobQueue m_jobs;
+};
+} // namespace VIDEO
@@ -0,0 +1,181 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoSeekPreviewImageFileLoader.h"
+
+#include "DVDFileInfo.h"
+#include "FileItem.h"
+#include "ServiceBroker.h"
+#include "TextureCache.h"
+#include "TextureDatabase.h"
+#include "URL.h"
+#include "cores/VideoPlayer/VideoFrameExtractor.h"
+#include "guilib/Texture.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+constexpr const char* SHEET_TYPE = "video_seekpreview";
+constexpr const char* PREVIEW_TYPE = "video_seekpreviewtile";
+
+constexpr unsigned int COLUMNS = 10;
+constexpr unsigned int ROWS = 10;
+constexpr unsigned int PREVIEWS = COLUMNS * ROWS;
+// the sheet is not scaled down by the texture cache with the default image resolution
+constexpr unsigned int PREVIEW_WIDTH = 128;
+constexpr unsigned int PREVIEW_HEIGHT = 72;
+
+void CopyPixels(const CTexture& source,
+                unsigned int sourceX,
+                unsigned int sourceY,
+                CTexture& dest,
+                unsigned int destX,
+                unsigned int destY,
+                unsigned int width,
+                unsigned int height)
+{
+  width = std::min({width, source.GetWidth() - sourceX, dest.GetWidth() - destX});
+  height = std::min({height, source.GetHeight() - sourceY, dest.GetHeight() - destY});
+  for (unsigned int y = 0; y < height; ++y)
+  {
+    std::memcpy(dest.GetPixels() + (destY + y) * dest.GetPitch() + destX * 4,
+                source.GetPixels() + (sourceY + y) * source.GetPitch() + sourceX * 4, width * 4);
+  }
+}
+
+std::unique_ptr<CTexture> CreateSheet(const std::string& path)
+{
+  const CFileItem item{path, false};
+  if (!CDVDFileInfo::CanExtract(item))
+    return {};
+
+  CVideoFrameExtractor extractor;
+  if (!extractor.Open(item))
+    return {};
+
+  const int64_t length = extractor.GetLength();
+  if (length <= 0)
+    return {};
+
+  auto sheet = CTexture::CreateTexture(COLUMNS * PREVIEW_WIDTH, ROWS * PREVIEW_HEIGHT);
+  sheet->SetAlpha(false);
+  std::memset(sheet->GetPixels(), 0, sheet->GetPitch() * sheet->GetHeight());
+
+  unsigned int maxWidth = PREVIEW_WIDTH;
+  unsigned int extracted = 0;
+  for (unsigned int i = 0; i < PREVIEWS; ++i)
+  {
+    // the middle of each fraction, the first frames are often black
+    const int64_t time = (2 * i + 1) * length / (2 * PREVIEWS);
+    std::unique_ptr<CTexture> frame = extractor.ExtractFrame(time, maxWidth);
+    if (frame && frame->GetHeight() > PREVIEW_HEIGHT)
+    {
+      // taller than 16:9, the following frames have the same size
+      maxWidth = std::max(1u, maxWidth * PREVIEW_HEIGHT / frame->GetHeight());
+      frame = extractor.ExtractFrame(time, maxWidth);
+    }
+    if (!frame)
+      continue;
+
+    const unsigned int width = std::min(frame->GetWidth(), PREVIEW_WIDTH);
+    const unsigned int height = std::min(frame->GetHeight(), PREVIEW_HEIGHT);
+    CopyPixels(*frame, 0, 0, *sheet, (i % COLUMNS) * PREVIEW_WIDTH + (PREVIEW_WIDTH - width) / 2,
+               (i / COLUMNS) * PREVIEW_HEIGHT + (PREVIEW_HEIGHT - height) / 2, width, height);
+    extracted++;
+  }
+
+  if (extracted == 0)
+    return {};
+
+  CLog::LogF(LOGDEBUG, "generated {} seek previews of {}", extracted, CURL::GetRedacted(path));
+  return sheet;
+}
+
+std::unique_ptr<CTexture> CutPreview(const std::string& path, unsigned int index)
+{
+  if (index >= PREVIEWS)
+    return {};
+
+  // only previews of a generated sheet, the video is never decoded while seeking
+  bool needsRecaching = false;
+  const std::string sheetFile = CServiceBroker::GetTextureCache()->CheckCachedImage(
+      VIDEO::CVideoSeekPreviewImageFileLoader::GetSheetURL(path), needsRecaching);
+  if (sheetFile.empty())
+    return {};
+
+  std::unique_ptr<CTexture> sheet = CTexture::LoadFromFile(sheetFile, 0, 0, true);
+  if (!sheet)
+    return {};
+
+  // the texture cache may have scaled the sheet down
+  const unsigned int width = sheet->GetWidth() / COLUMNS;
+  const unsigned int height = sheet->GetHeight() / ROWS;
+  if (width == 0 || height == 0)
+    return {};
+
+  auto preview = CTexture::CreateTexture(width, height);
+  preview->SetAlpha(false);
+  CopyPixels(*sheet, (index % COLUMNS) * width, (index / COLUMNS) * height, *preview, 0, 0, width,
+             height);
+  return preview;
+}
+} // unnamed namespace
+
+bool VIDEO::CVideoSeekPreviewImageFileLoader::CanLoad(const std::string& specialType) const
+{
+  return specialType == SHEET_TYPE || specialType == PREVIEW_TYPE;
+}
+
+std::unique_ptr<CTexture> VIDEO::CVideoSeekPreviewImageFileLoader::Load(
+    const std::string& specialType,
+    const std::string& filePath,
+    unsigned int,
+    unsigned int) const
+{
+  if (specialType == SHEET_TYPE)
+    return CreateSheet(filePath);
+
+  // path of the video and index of the preview, separated by a slash
+  const size_t lastSlashPos = filePath.rfind('/');
+  if (lastSlashPos == std::string::npos)
+    return {};
+
+  unsigned int index = 0;
+  try
+  {
+    index = std::stoul(filePath.substr(lastSlashPos + 1));
+  }
+  catch (...)
+  {
+    // these paths can come from anywhere
+    return {};
+  }
+
+  return CutPreview(filePath.substr(0, lastSlashPos), index);
+}
+
+std::string VIDEO::CVideoSeekPreviewImageFileLoader::GetSheetURL(const std::string& path)
+{
+  return CTextureUtils::GetWrappedImageURL(path, SHEET_TYPE);
+}
+
+std::string VIDEO::CVideoSeekPreviewImageFileLoader::GetPreviewURL(const std::string& path,
+                                                                   int64_t time,
+                                                                   int64_t length)
+{
+  if (length <= 0)
+    return {};
+
+  const int64_t index = std::clamp<int64_t>(time * PREVIEWS / length, 0, PREVIEWS - 1);
+  return CTextureUtils::GetWrappedImageURL(StringUtils::Format("{}/{}", path, index),
+                                           PREVIEW_TYPE);
+}
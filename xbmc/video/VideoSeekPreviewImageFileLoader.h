@@ -0,0 +1,51 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "imagefiles/SpecialImageFileLoader.h"
+
+#include <cstdint>
+#include <string>
+
+namespace VIDEO
+{
+/*!
+ * @brief Generates the seek bar previews of a video.
+ *
+ * The previews are small keyframe thumbnails at fixed fractions of the video, generated at once
+ * into a single sprite sheet image that the texture cache stores. The preview for a seek time is
+ * cut from the cached sheet, so it never needs the video to be decoded while seeking.
+ */
+class CVideoSeekPreviewImageFileLoader : public IMAGE_FILES::ISpecialImageFileLoader
+{
+public:
+  CVideoSeekPreviewImageFileLoader() = default;
+  ~CVideoSeekPreviewImageFileLoader() override = default;
+
+  bool CanLoad(const std::string& specialType) const override;
+  std::unique_ptr<CTexture> Load(const std::string& specialType,
+                                 const std::string& filePath,
+                                 unsigned int preferredWidth,
+                                 unsigned int preferredHeight) const override;
+
+  /*!
+   * @brief Get the image URL of the sprite sheet of a video, caching it generates the previews.
+   */
+  static std::string GetSheetURL(const std::string& path);
+
+  /*!
+   * @brief Get the image URL of the preview closest to a time.
+   * @param path The video
+   * @param time The time to preview, in ms
+   * @param length The length of the video, in ms
+   */
+  static std::string GetPreviewURL(const std::string& path, int64_t time, int64_t length);
+};
+
+} // namespace VIDEO
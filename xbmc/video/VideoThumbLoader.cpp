@@ -62,9 +62,51 @@ void CVideoThumbLoader::OnLoaderFinish()
 {
   m_videoDatabase->Close();
   m_artCache.clear();
+  m_preparedArt.clear();
+  m_preparedStreamDetails.clear();
   CThumbLoader::OnLoaderFinish();
 }
 
+void CVideoThumbLoader::PrepareItemsCached(const std::vector<CFileItem*>& items)
+{
+  m_preparedArt.clear();
+  m_preparedStreamDetails.clear();
+
+  // collect what LoadItemCached would otherwise query item by item
+  std::vector<int> fileIds;
+  std::map<MediaType, std::vector<int>> mediaIds;
+  for (const CFileItem* item : items)
+  {
+    if (item->m_bIsShareOrDrive || item->IsParentFolder() || !item->HasVideoInfoTag())
+      continue;
+
+    const CVideoInfoTag& tag = *item->GetVideoInfoTag();
+    if (!tag.HasStreamDetails() && tag.m_iFileId >= 0)
+      fileIds.push_back(tag.m_iFileId);
+
+    if (!item->GetProperty("libraryartfilled").asBoolean() && tag.m_iDbId > -1 &&
+        !tag.m_type.empty() && tag.m_type != MediaTypeAlbum && !VIDEO::IsVideoAssetFile(*item))
+      mediaIds[tag.m_type].push_back(tag.m_iDbId);
+  }
+
+  if (fileIds.empty() && mediaIds.empty())
+    return;
+
+  m_videoDatabase->Open();
+  if (!m_videoDatabase->GetStreamDetailsForFiles(fileIds, m_preparedStreamDetails))
+    m_preparedStreamDetails.clear();
+  for (const auto& [mediaType, ids] : mediaIds)
+  {
+    std::map<int, ArtMap> art;
+    if (!m_videoDatabase->GetArtForItems(mediaType, ids, art))
+      continue;
+    // items without art are prepared as well, so that they aren't queried again
+    for (const int id : ids)
+      m_preparedArt[std::make_pair(mediaType, id)] = std::move(art[id]);
+  }
+  m_videoDatabase->Close();
+}
+
 namespace
 {
 std::vector<std::string> GetSettingListAsString(const std::string& settingID)
@@ -180,7 +222,19 @@ bool CVideoThumbLoader::LoadItemCached(CFileItem* pItem)
 
   if (!pItem->HasVideoInfoTag() || !pItem->GetVideoInfoTag()->HasStreamDetails()) // no stream details
   {
-    if ((pItem->HasVideoInfoTag() && pItem->GetVideoInfoTag()->m_iFileId >= 0) // file (or maybe folder) is in the database
+    const auto prepared = pItem->HasVideoInfoTag()
+                              ? m_preparedStreamDetails.find(pItem->GetVideoInfoTag()->m_iFileId)
+                              : m_preparedStreamDetails.end();
+    if (prepared != m_preparedStreamDetails.end())
+    {
+      CVideoInfoTag& tag = *pItem->GetVideoInfoTag();
+      tag.m_streamDetails = prepared->second;
+      if (tag.m_streamDetails.GetVideoDuration() > 0)
+        tag.SetDuration(tag.m_streamDetails.GetVideoDuration());
+      if (tag.HasStreamDetails())
+        pItem->SetInvalid();
+    }
+    else if ((pItem->HasVideoInfoTag() && pItem->GetVideoInfoTag()->m_iFileId >= 0) // file (or maybe folder) is in the database
     || (!pItem->m_bIsFolder && pItem->IsVideo())) // Some other video file for which we haven't yet got any database details
     {
       if (m_videoDatabase->GetStreamDetails(*pItem))
@@ -419,7 +473,7 @@ bool CVideoThumbLoader::FillLibraryArt(CFileItem &item)
               artwork))
         item.AppendArt(artwork);
     }
-    else if (m_videoDatabase->GetArtForItem(tag.m_iDbId, tag.m_type, artwork))
+    else if (GetLibraryArt(tag, artwork))
     {
       item.AppendArt(artwork);
     }
@@ -617,6 +671,16 @@ void CVideoThumbLoader::DetectAndAddMissingItemData(CFileItem &item)
     item.SetProperty("stereomode", CStereoscopicsManager::NormalizeStereoMode(stereoMode));
 }
 
+bool CVideoThumbLoader::GetLibraryArt(const CVideoInfoTag& tag, ArtMap& art)
+{
+  const auto prepared = m_preparedArt.find(std::make_pair(tag.m_type, tag.m_iDbId));
+  if (prepared == m_preparedArt.end())
+    return m_videoDatabase->GetArtForItem(tag.m_iDbId, tag.m_type, art);
+
+  art.insert(prepared->second.begin(), prepared->second.end());
+  return !art.empty();
+}
+
 const ArtMap& CVideoThumbLoader::GetArtFromCache(const std::string &mediaType, const int id)
 {
   std::pair<MediaType, int> key = std::make_pair(mediaType, id);
@@ -10,11 +10,11 @@
 
 #include "FileItem.h"
 #include "ThumbLoader.h"
+#include "utils/StreamDetails.h"
 
 #include <map>
 #include <vector>
 
-class CStreamDetails;
 class CVideoDatabase;
 class EmbeddedArt;
 
@@ -29,6 +29,7 @@ public:
 
   void OnLoaderStart() override;
   void OnLoaderFinish() override;
+  void PrepareItemsCached(const std::vector<CFileItem*>& items) override;
 
   bool LoadItem(CFileItem* pItem) override;
   bool LoadItemCached(CFileItem* pItem) override;
@@ -76,6 +77,8 @@ public:
 protected:
   CVideoDatabase *m_videoDatabase;
   ArtCache m_artCache;
+  ArtCache m_preparedArt; // art of the items of the current batch, by media type and id
+  std::map<int, CStreamDetails> m_preparedStreamDetails; // of the current batch, by file id
 
   /*! \brief Tries to detect missing data/info from a file and adds those
    \param item The CFileItem to process
@@ -84,4 +87,9 @@ protected:
   void DetectAndAddMissingItemData(CFileItem &item);
 
   const ArtMap& GetArtFromCache(const std::string &mediaType, const int id);
+
+  /*! \brief Get the art of a library item, prepared for its batch or from the database
+   \return true if the item has any art
+   */
+  bool GetLibraryArt(const CVideoInfoTag& tag, ArtMap& art);
 };
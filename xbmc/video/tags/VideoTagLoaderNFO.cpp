@@ -13,15 +13,98 @@
 #include "URL.h"
 #include "filesystem/Directory.h"
 #include "filesystem/StackDirectory.h"
+#include "threads/CriticalSection.h"
 #include "utils/FileUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 #include "video/VideoInfoTag.h"
+#include "video/VideoLibraryQueue.h"
 
+#include <chrono>
+#include <map>
+#include <mutex>
 #include <utility>
 
 using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+// While the library is scanned, the nfo files of a folder are listed once and all lookups for its
+// items are answered from that listing, as probing every candidate name is a round trip on
+// network shares and most of them do not exist.
+constexpr auto NFO_LISTING_LIFETIME = 60s;
+constexpr size_t NFO_LISTING_MAX_FOLDERS = 64;
+
+struct NfoListing
+{
+  std::chrono::steady_clock::time_point time;
+  std::vector<std::string> files;
+};
+
+CCriticalSection nfoListingSection;
+std::map<std::string, NfoListing> nfoListings;
+
+bool ListNFOFiles(std::string folder, std::vector<std::string>& files)
+{
+  const bool scanning = CVideoLibraryQueue::GetInstance().IsScanningLibrary();
+  URIUtils::AddSlashAtEnd(folder);
+  const auto now = std::chrono::steady_clock::now();
+  if (scanning)
+  {
+    std::unique_lock<CCriticalSection> lock(nfoListingSection);
+    const auto it = nfoListings.find(folder);
+    if (it != nfoListings.end() && now - it->second.time < NFO_LISTING_LIFETIME)
+    {
+      files = it->second.files;
+      return true;
+    }
+  }
+
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(folder, items, ".nfo", DIR_FLAG_DEFAULTS))
+    return false;
+
+  NfoListing listing;
+  listing.time = now;
+  for (const auto& item : items)
+  {
+    if (item->IsNFO())
+      listing.files.emplace_back(item->GetPath());
+  }
+  files = listing.files;
+
+  std::unique_lock<CCriticalSection> lock(nfoListingSection);
+  if (!scanning || nfoListings.size() >= NFO_LISTING_MAX_FOLDERS)
+    nfoListings.clear();
+  if (scanning)
+    nfoListings[folder] = std::move(listing);
+  return true;
+}
+
+//! \brief Get the path of an nfo file if it exists, in the case the folder listing reports it
+std::string FindNFOFile(const std::string& path)
+{
+  // outside of a scan a single probe is cheaper than listing the folder
+  std::vector<std::string> files;
+  if (!CVideoLibraryQueue::GetInstance().IsScanningLibrary() ||
+      !ListNFOFiles(URIUtils::GetDirectory(path), files))
+    return CFileUtils::Exists(path) ? path : "";
+
+  const std::string fileName = URIUtils::GetFileName(path);
+  std::string found;
+  for (const auto& file : files)
+  {
+    const std::string listedName = URIUtils::GetFileName(file);
+    if (listedName == fileName)
+      return file;
+    if (found.empty() && StringUtils::EqualsNoCase(listedName, fileName))
+      found = file;
+  }
+  return found;
+}
+} // unnamed namespace
 
 CVideoTagLoaderNFO::CVideoTagLoaderNFO(const CFileItem& item,
                                        ADDON::ScraperPtr info,
@@ -36,7 +119,7 @@ CVideoTagLoaderNFO::CVideoTagLoaderNFO(const CFileItem& item,
 
 bool CVideoTagLoaderNFO::HasInfo() const
 {
-  return !m_path.empty() && CFileUtils::Exists(m_path);
+  return !m_path.empty() && !FindNFOFile(m_path).empty();
 }
 
 CInfoScanner::INFO_TYPE CVideoTagLoaderNFO::Load(CVideoInfoTag& tag,
@@ -112,8 +195,8 @@ std::string CVideoTagLoaderNFO::FindNFO(const CFileItem& item,
 
     if (movieFolder && !item.IsStack())
     { // looking up by folder name - movie.nfo takes priority - but not for stacked items (handled below)
-      nfoFile = URIUtils::AddFileToFolder(strPath, "movie.nfo");
-      if (CFileUtils::Exists(nfoFile))
+      nfoFile = FindNFOFile(URIUtils::AddFileToFolder(strPath, "movie.nfo"));
+      if (!nfoFile.empty())
         return nfoFile;
     }
 
@@ -145,8 +228,8 @@ std::string CVideoTagLoaderNFO::FindNFO(const CFileItem& item,
     }
 
     // test file existence
-    if (!nfoFile.empty() && !CFileUtils::Exists(nfoFile))
-      nfoFile.clear();
+    if (!nfoFile.empty())
+      nfoFile = FindNFOFile(nfoFile);
 
     if (nfoFile.empty()) // final attempt - strip off any cd1 folders
     {
@@ -170,33 +253,15 @@ std::string CVideoTagLoaderNFO::FindNFO(const CFileItem& item,
   if (item.m_bIsFolder || item.IsOpticalMediaFile() || (movieFolder && nfoFile.empty()))
   {
     // see if there is a unique nfo file in this folder, and if so, use that
-    CFileItemList items;
-    CDirectory dir;
     std::string strPath;
     if (item.m_bIsFolder)
       strPath = item.GetPath();
     else
       strPath = URIUtils::GetDirectory(item.GetPath());
 
-    if (dir.GetDirectory(strPath, items, ".nfo", DIR_FLAG_DEFAULTS) && items.Size())
-    {
-      int numNFO = -1;
-      for (int i = 0; i < items.Size(); i++)
-      {
-        if (items[i]->IsNFO())
-        {
-          if (numNFO == -1)
-            numNFO = i;
-          else
-          {
-            numNFO = -1;
-            break;
-          }
-        }
-      }
-      if (numNFO > -1)
-        return items[numNFO]->GetPath();
-    }
+    std::vector<std::string> files;
+    if (ListNFOFiles(strPath, files) && files.size() == 1)
+      return files.front();
   }
 
   return nfoFile;
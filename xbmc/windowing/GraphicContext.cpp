@@ -797,6 +797,11 @@ void CGraphicContext::ScaleFinalCoords(float &x, float &y, float &z) const
   m_finalTransform.matrix.TransformPosition(x, y, z);
 }
 
+void CGraphicContext::ScaleFinalQuad(const CRect& rect, float* x, float* y, float* z) const
+{
+  m_finalTransform.matrix.TransformQuad(rect.x1, rect.y1, rect.x2, rect.y2, x, y, z);
+}
+
 float CGraphicContext::GetScalingPixelRatio() const
 {
   // assume the resolutions are different - we want to return the aspect ratio of the video resolution
@@ -121,6 +121,8 @@ public:
   float ScaleFinalYCoord(float x, float y) const;
   float ScaleFinalZCoord(float x, float y) const;
   void ScaleFinalCoords(float &x, float &y, float &z) const;
+  /*! \brief Transform the 4 corners of a quad, see TransformMatrix::TransformQuad */
+  void ScaleFinalQuad(const CRect& rect, float* x, float* y, float* z) const;
   bool RectIsAngled(float x1, float y1, float x2, float y2) const;
   const TransformMatrix &GetGUIMatrix() const;
   float GetGUIScaleX() const;
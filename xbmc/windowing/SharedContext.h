@@ -0,0 +1,38 @@
+/*
+ *  Copyright (C) 2024 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+namespace KODI
+{
+namespace WINDOWING
+{
+
+/**
+ * Render context sharing textures with the GUI render context, so they can be
+ * uploaded on another thread
+ *
+ * The context is current on the thread that created it as long as the object
+ * is alive, so it has to be destroyed on that thread as well.
+ */
+class ISharedContext
+{
+public:
+  virtual ~ISharedContext() = default;
+
+  /**
+   * Wait until all commands issued in this context so far have completed, so
+   * the textures written are ready for use in the GUI render context
+   *
+   * \return false if the commands could not be waited for
+   */
+  virtual bool Finish() = 0;
+};
+
+} // namespace WINDOWING
+} // namespace KODI
@@ -11,6 +11,7 @@
 #include "HDRStatus.h"
 #include "OSScreenSaver.h"
 #include "Resolution.h"
+#include "SharedContext.h"
 #include "VideoSync.h"
 #include "WinEvents.h"
 #include "cores/VideoPlayer/VideoRenderers/DebugInfo.h"
@@ -79,6 +80,8 @@ public:
   virtual bool HasCursor(){ return true; }
   //some platforms have api for gesture inertial scrolling - default to false and use the InertialScrollingHandler
   virtual bool HasInertialGestures(){ return false; }
+  //input events are pushed to the application port from other threads, so the render loop may block while the GUI is idle
+  virtual bool CanWaitForEvents() const { return false; }
   //does the output expect limited color range (ie 16-235)
   virtual bool UseLimitedColor();
   //the number of presentation buffers
@@ -204,6 +207,18 @@ public:
    */
   virtual void* GetHWContext() { return nullptr; }
 
+  /*!
+   * \brief Create a render context sharing textures with the GUI render context
+   *
+   * The context is made current on the calling thread and has to be destroyed on it.
+   *
+   * \return the context or nullptr if the windowing system doesn't support shared contexts
+   */
+  virtual std::unique_ptr<KODI::WINDOWING::ISharedContext> CreateSharedContext()
+  {
+    return nullptr;
+  }
+
   std::shared_ptr<CDPMSSupport> GetDPMSManager();
 
   /*!
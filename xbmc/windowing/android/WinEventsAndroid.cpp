@@ -53,28 +53,40 @@ CWinEventsAndroid::~CWinEventsAndroid()
 
 void CWinEventsAndroid::MessagePush(XBMC_Event *newEvent)
 {
-  std::unique_lock<CCriticalSection> lock(m_eventsCond);
+  {
+    std::unique_lock<CCriticalSection> lock(m_eventsCond);
 
-  m_events.push_back(*newEvent);
+    m_events.push_back(*newEvent);
+  }
+
+  std::shared_ptr<CAppInboundProtocol> appPort = CServiceBroker::GetAppPort();
+  if (appPort)
+    appPort->WakeUp();
 }
 
 void CWinEventsAndroid::MessagePushRepeat(XBMC_Event *repeatEvent)
 {
-  std::unique_lock<CCriticalSection> lock(m_eventsCond);
-
-  std::list<XBMC_Event>::iterator itt;
-  for (itt = m_events.begin(); itt != m_events.end(); ++itt)
   {
-    // we have events pending, if we we just
-    // repush, we might push the repeat event
-    // in back of a canceling non-active event.
-    // do not repush if pending are different event.
-    if (different_event(*itt, *repeatEvent))
-      return;
+    std::unique_lock<CCriticalSection> lock(m_eventsCond);
+
+    std::list<XBMC_Event>::iterator itt;
+    for (itt = m_events.begin(); itt != m_events.end(); ++itt)
+    {
+      // we have events pending, if we we just
+      // repush, we might push the repeat event
+      // in back of a canceling non-active event.
+      // do not repush if pending are different event.
+      if (different_event(*itt, *repeatEvent))
+        return;
+    }
+
+    // is a repeat, push it
+    m_events.push_back(*repeatEvent);
   }
 
-  // is a repeat, push it
-  m_events.push_back(*repeatEvent);
+  std::shared_ptr<CAppInboundProtocol> appPort = CServiceBroker::GetAppPort();
+  if (appPort)
+    appPort->WakeUp();
 }
 
 bool CWinEventsAndroid::MessagePump()
@@ -45,6 +45,7 @@ public:
   void UpdateDisplayModes();
 
   bool HasCursor() override { return false; }
+  bool CanWaitForEvents() const override { return true; }
 
   bool Minimize() override;
   bool Hide() override;
@@ -22,6 +22,7 @@
 #include <assert.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <time.h>
 
 #include <unistd.h>
 
@@ -101,6 +102,13 @@ void CVideoSyncGbm::Run(CEvent& stopEvent)
     if (sequence == m_sequence)
       continue;
 
+    // the timestamps are in CLOCK_MONOTONIC which drifts against the host counter, the offset
+    // measured at setup would be off after a longer playback
+    timespec now;
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)
+      m_offset = CurrentHostCounter() -
+                 (static_cast<uint64_t>(now.tv_sec) * 1000000000 + now.tv_nsec);
+
     m_refClock->UpdateClock(sequence - m_sequence, m_offset + ns);
     m_sequence = sequence;
   }
@@ -52,6 +52,7 @@ public:
   void FlipPage(bool rendered, bool videoLayer);
 
   bool CanDoWindowed() override { return false; }
+  bool CanWaitForEvents() const override { return true; }
   void UpdateResolutions() override;
 
   bool UseLimitedColor() override;
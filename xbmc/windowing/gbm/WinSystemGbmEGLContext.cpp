@@ -135,6 +135,11 @@ bool CWinSystemGbmEGLContext::DestroyWindowSystem()
   return CWinSystemGbm::DestroyWindowSystem();
 }
 
+std::unique_ptr<KODI::WINDOWING::ISharedContext> CWinSystemGbmEGLContext::CreateSharedContext()
+{
+  return CreateEGLSharedContext();
+}
+
 void CWinSystemGbmEGLContext::delete_CVaapiProxy::operator()(CVaapiProxy *p) const
 {
   VaapiProxyDelete(p);
@@ -33,6 +33,7 @@ public:
                        bool fullScreen,
                        RESOLUTION_INFO& res) override;
   bool DestroyWindow() override;
+  std::unique_ptr<ISharedContext> CreateSharedContext() override;
 
 protected:
   CWinSystemGbmEGLContext(EGLenum platform, std::string const& platformExtension)
@@ -17,6 +17,9 @@
 
 #include "PlatformDefs.h"
 
+#include <algorithm>
+#include <iterator>
+
 using namespace KODI::WINDOWING::GBM;
 
 namespace
@@ -255,6 +258,34 @@ bool CDRMUtils::FindPlanes()
   return true;
 }
 
+CDRMPlane* CDRMUtils::FindVideoPlane(uint32_t format, uint64_t modifier) const
+{
+  if (!m_video_plane || !m_crtc)
+    return nullptr;
+
+  if (m_video_plane->SupportsFormatAndModifier(format, modifier))
+    return m_video_plane;
+
+  auto crtc = std::find_if(m_crtcs.begin(), m_crtcs.end(),
+                           [this](auto& crtc) { return crtc.get() == m_crtc; });
+  if (crtc == m_crtcs.end())
+    return nullptr;
+
+  const uint32_t crtcMask = 1 << std::distance(m_crtcs.begin(), crtc);
+
+  // SoCs often have several overlay planes that support different formats and modifiers,
+  // e.g. only one of them takes AFBC or 10 bit formats
+  auto plane = std::find_if(m_planes.begin(), m_planes.end(),
+                            [&](auto& plane)
+                            {
+                              return plane.get() != m_gui_plane &&
+                                     (plane->GetPossibleCrtcs() & crtcMask) &&
+                                     plane->SupportsFormatAndModifier(format, modifier);
+                            });
+
+  return plane != m_planes.end() ? plane->get() : nullptr;
+}
+
 void CDRMUtils::PrintDrmDeviceInfo(drmDevicePtr device)
 {
   std::string message;
@@ -49,6 +49,14 @@ public:
   int GetRenderNodeFileDescriptor() const { return m_renderFd; }
   const char* GetRenderDevicePath() const { return m_renderDevicePath; }
   CDRMPlane* GetVideoPlane() const { return m_video_plane; }
+
+  /*!
+   * \brief Find a plane of the crtc which can scan out video of a format directly
+   * \return the current video plane if it supports the format, else another free plane that
+   * does, nullptr if there is none
+   */
+  CDRMPlane* FindVideoPlane(uint32_t format, uint64_t modifier) const;
+  void SetVideoPlane(CDRMPlane* plane) { m_video_plane = plane; }
   CDRMPlane* GetGuiPlane() const { return m_gui_plane; }
   CDRMCrtc* GetCrtc() const { return m_crtc; }
   CDRMConnector* GetConnector() const { return m_connector; }
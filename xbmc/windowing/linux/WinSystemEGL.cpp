@@ -8,8 +8,55 @@
 
 #include "WinSystemEGL.h"
 
+#include "utils/EGLFence.h"
+#include "utils/log.h"
+
+#include <stdexcept>
+
+using namespace KODI::WINDOWING;
 using namespace KODI::WINDOWING::LINUX;
 
+namespace
+{
+
+class CEGLSharedContext : public ISharedContext
+{
+public:
+  CEGLSharedContext(EGLDisplay display, EGLContext context)
+    : m_display(display), m_context(context), m_fence(display)
+  {
+  }
+
+  ~CEGLSharedContext() override
+  {
+    eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(m_display, m_context);
+  }
+
+  bool Finish() override
+  {
+    try
+    {
+      m_fence.CreateFence();
+    }
+    catch (const std::runtime_error&)
+    {
+      return false;
+    }
+
+    const bool signaled = m_fence.Wait(EGL_FOREVER_KHR);
+    m_fence.DestroyFence();
+    return signaled;
+  }
+
+private:
+  EGLDisplay m_display;
+  EGLContext m_context;
+  KODI::UTILS::EGL::CEGLFence m_fence;
+};
+
+} // unnamed namespace
+
 CWinSystemEGL::CWinSystemEGL(EGLenum platform, std::string const& platformExtension)
   : m_eglContext{platform, platformExtension}
 {
@@ -34,3 +81,23 @@ EGLConfig CWinSystemEGL::GetEGLConfig() const
 {
   return m_eglContext.GetEGLConfig();
 }
+
+std::unique_ptr<ISharedContext> CWinSystemEGL::CreateEGLSharedContext() const
+{
+  const EGLContext context = m_eglContext.CreateSharedContext();
+  if (context == EGL_NO_CONTEXT)
+    return nullptr;
+
+  try
+  {
+    return std::make_unique<CEGLSharedContext>(m_eglContext.GetEGLDisplay(), context);
+  }
+  catch (const std::runtime_error& e)
+  {
+    // the fence functions are missing
+    CLog::Log(LOGDEBUG, "Not using shared EGL context: {}", e.what());
+    eglMakeCurrent(m_eglContext.GetEGLDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(m_eglContext.GetEGLDisplay(), context);
+    return nullptr;
+  }
+}
@@ -9,6 +9,9 @@
 #pragma once
 
 #include "utils/EGLUtils.h"
+#include "windowing/SharedContext.h"
+
+#include <memory>
 
 namespace KODI
 {
@@ -29,6 +32,13 @@ public:
   EGLConfig GetEGLConfig() const;
 
 protected:
+  /**
+   * Create a surfaceless context sharing objects with the GUI context, for
+   * implementing CWinSystemBase::CreateSharedContext()
+   */
+  std::unique_ptr<ISharedContext> CreateEGLSharedContext() const;
+
+
   CEGLContextUtils m_eglContext;
 };
 
@@ -15,6 +15,7 @@
 #include "windowing/wayland/WinSystemWayland.h"
 
 #include <cinttypes>
+#include <ctime>
 #include <functional>
 
 using namespace KODI::WINDOWING::WAYLAND;
@@ -78,7 +79,24 @@ void CVideoSyncWpPresentation::HandlePresentation(timespec tv, std::uint32_t ref
   }
   m_lastMsc = msc;
 
-  // FIXME use timespec instead of currenthostcounter()? Possibly difficult
-  // due to different clock base
-  m_refClock->UpdateClock(mscDiff, CurrentHostCounter());
+  m_refClock->UpdateClock(mscDiff, ToHostCounter(tv));
+}
+
+std::int64_t CVideoSyncWpPresentation::ToHostCounter(timespec tv)
+{
+  // the compositor reports when the frame was actually shown, in the presentation clock,
+  // move that to the host counter by how long ago it was
+  const std::int64_t now = CurrentHostCounter();
+  timespec clockNow;
+  if (clock_gettime(m_winSystem.GetPresentationClock(), &clockNow) != 0)
+    return now;
+
+  const std::int64_t ageNs = (static_cast<std::int64_t>(clockNow.tv_sec) - tv.tv_sec) * 1000000000 +
+                             (clockNow.tv_nsec - tv.tv_nsec);
+
+  // a timestamp in the future or from long ago is of no use
+  if (ageNs < 0 || ageNs > 1000000000)
+    return now;
+
+  return now - static_cast<std::int64_t>(static_cast<double>(ageNs) * CurrentHostFrequency() / 1e9);
 }
@@ -34,6 +34,7 @@ public:
 
 private:
   void HandlePresentation(timespec tv, std::uint32_t refresh, std::uint32_t syncOutputID, float syncOutputRefreshRate, std::uint64_t msc);
+  std::int64_t ToHostCounter(timespec tv);
 
   CEvent m_stopEvent;
   CSignalRegistration m_presentationHandler;
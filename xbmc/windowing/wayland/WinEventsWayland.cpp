@@ -272,6 +272,12 @@ bool CWinEventsWayland::MessagePump()
 
 void CWinEventsWayland::MessagePush(XBMC_Event* ev)
 {
-  std::unique_lock<CCriticalSection> lock(m_queueMutex);
-  m_queue.emplace(*ev);
+  {
+    std::unique_lock<CCriticalSection> lock(m_queueMutex);
+    m_queue.emplace(*ev);
+  }
+
+  std::shared_ptr<CAppInboundProtocol> appPort = CServiceBroker::GetAppPort();
+  if (appPort)
+    appPort->WakeUp();
 }
@@ -77,6 +77,7 @@ public:
   bool Minimize() override;
 
   bool HasCursor() override;
+  bool CanWaitForEvents() const override { return true; }
   void ShowOSMouse(bool show) override;
 
   std::string GetClipboardText() override;
@@ -91,6 +92,7 @@ public:
 
   using PresentationFeedbackHandler = std::function<void(timespec /* tv */, std::uint32_t /* refresh */, std::uint32_t /* sync output id */, float /* sync output fps */, std::uint64_t /* msc */)>;
   CSignalRegistration RegisterOnPresentationFeedback(const PresentationFeedbackHandler& handler);
+  clockid_t GetPresentationClock() const { return m_presentationClock; }
 
   std::vector<std::string> GetConnectedOutputs() override;
 
@@ -102,6 +102,11 @@ bool CWinSystemWaylandEGLContext::DestroyWindowSystem()
   return CWinSystemWaylandImpl::DestroyWindowSystem();
 }
 
+std::unique_ptr<KODI::WINDOWING::ISharedContext> CWinSystemWaylandEGLContext::CreateSharedContext()
+{
+  return CreateEGLSharedContext();
+}
+
 CSizeInt CWinSystemWaylandEGLContext::GetNativeWindowAttachedSize()
 {
   int width, height;
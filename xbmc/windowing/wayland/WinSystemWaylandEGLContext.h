@@ -42,6 +42,7 @@ public:
                        RESOLUTION_INFO& res) override;
   bool DestroyWindow() override;
   bool DestroyWindowSystem() override;
+  std::unique_ptr<ISharedContext> CreateSharedContext() override;
 
 protected:
   /**
@@ -31,6 +31,7 @@
 #include "dialogs/GUIDialogMediaFilter.h"
 #include "dialogs/GUIDialogProgress.h"
 #include "dialogs/GUIDialogSmartPlaylistEditor.h"
+#include "filesystem/DirectoryPreview.h"
 #include "filesystem/FileDirectoryFactory.h"
 #include "filesystem/MultiPathDirectory.h"
 #include "filesystem/PluginDirectory.h"
@@ -92,6 +93,7 @@ public:
 
   void Run() override
   {
+    XFILE::CDirectoryPreview::CScope previewScope(m_preview);
     m_result = m_dir.GetDirectory(m_url, m_items, m_useDir, true);
   }
 
@@ -101,6 +103,7 @@ public:
   }
 
   bool m_result = false;
+  XFILE::CDirectoryPreview m_preview;
 
 protected:
   XFILE::CVirtualDirectory &m_dir;
@@ -2245,48 +2248,65 @@ bool CGUIMediaWindow::GetDirectoryItems(CURL &url, CFileItemList &items, bool us
 bool CGUIMediaWindow::WaitGetDirectoryItems(CGetDirectoryItems &items)
 {
   bool ret = true;
+  m_updateJobActive = true;
+  m_updateAborted = false;
+  m_updateEvent.Reset();
+  CServiceBroker::GetJobManager()->Submit(
+      [&]() {
+        items.Run();
+        items.m_preview.GetEvent().Set();
+        m_updateEvent.Set();
+      },
+      nullptr, CJob::PRIORITY_NORMAL);
+
   CGUIDialogBusy* dialog = CServiceBroker::GetGUI()->GetWindowManager().GetWindow<CGUIDialogBusy>(WINDOW_DIALOG_BUSY);
   if (dialog && !dialog->IsDialogRunning())
   {
-    if (!CGUIDialogBusy::Wait(&items, 100, true))
+    // show the busy dialog until the listing is done or its first items can be shown
+    if (!CGUIDialogBusy::WaitOnEvent(items.m_preview.GetEvent(), 100, true))
     {
-      // cancelled
-      ret = false;
+      // cancelled, the job still refers to the items
+      items.Cancel();
+      m_updateEvent.Wait();
+      return false;
     }
   }
-  else
+
+  // Loop until either the job ended or update canceled via CGUIMediaWindow::CancelUpdateItems.
+  CFileItemList preview;
+  while (!m_updateAborted && !m_updateEvent.Wait(1ms))
   {
-    m_updateJobActive = true;
-    m_updateAborted = false;
-    m_updateEvent.Reset();
-    CServiceBroker::GetJobManager()->Submit(
-        [&]() {
-          items.Run();
-          m_updateEvent.Set();
-        },
-        nullptr, CJob::PRIORITY_NORMAL);
-
-    // Loop until either the job ended or update canceled via CGUIMediaWindow::CancelUpdateItems.
-    while (!m_updateAborted && !m_updateEvent.Wait(1ms))
-    {
-      if (!ProcessRenderLoop(false))
-        break;
-    }
+    if (items.m_preview.Take(preview))
+      ShowPartialItems(preview);
 
-    if (m_updateAborted)
-    {
-      CLog::LogF(LOGDEBUG, "Get directory items job was canceled.");
-      ret = false;
-    }
-    else if (!items.m_result)
-    {
-      CLog::LogF(LOGDEBUG, "Get directory items job was unsuccessful.");
-      ret = false;
-    }
+    if (!ProcessRenderLoop(false))
+      break;
+  }
+
+  if (m_updateAborted)
+  {
+    CLog::LogF(LOGDEBUG, "Get directory items job was canceled.");
+    ret = false;
+  }
+  else if (!items.m_result)
+  {
+    CLog::LogF(LOGDEBUG, "Get directory items job was unsuccessful.");
+    ret = false;
   }
   return ret;
 }
 
+void CGUIMediaWindow::ShowPartialItems(CFileItemList& items)
+{
+  // only the items are replaced, the complete listing replaces them again along with the path and
+  // properties, and is sorted, filtered and cached as usual
+  CLog::LogF(LOGDEBUG, "Showing the first {} items", items.Size());
+  items.FillInDefaultIcons();
+  m_vecItems->ClearItems();
+  m_vecItems->Append(items);
+  m_viewControl.SetItems(*m_vecItems);
+}
+
 void CGUIMediaWindow::CancelUpdateItems()
 {
   if (m_updateJobActive)
@@ -161,6 +161,9 @@ protected:
   bool WaitForNetwork() const;
   bool GetDirectoryItems(CURL &url, CFileItemList &items, bool useDir);
   bool WaitGetDirectoryItems(CGetDirectoryItems &items);
+  /*! \brief Show the first items of a listing that is still being retrieved
+   \param items the items retrieved so far, taken over by the window */
+  void ShowPartialItems(CFileItemList& items);
   void CancelUpdateItems();
 
   /*! \brief Translate the folder to start in from the given quick path
@@ -12,6 +12,7 @@
 #include "GUIInfoManager.h"
 #include "ServiceBroker.h"
 #include "addons/Skin.h"
+#include "application/Application.h"
 #include "filesystem/SpecialProtocol.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIControlFactory.h"
@@ -19,10 +20,13 @@
 #include "guilib/GUIFontManager.h"
 #include "guilib/GUITextLayout.h"
 #include "guilib/GUIWindowManager.h"
+#include "guilib/InputLatencyTracker.h"
+#include "guilib/TextureMemory.h"
 #include "input/WindowTranslator.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CPUInfo.h"
+#include "utils/JobManager.h"
 #include "utils/MemUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
@@ -129,6 +133,56 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetFPS(),
                                strCores, ucAppName, dCPU, profiling);
 #endif
+
+    const CGUIOcclusionTracker::Stats& stats =
+        CServiceBroker::GetGUI()->GetWindowManager().GetOcclusionStats();
+    if (stats.screenArea > 0.0f)
+      info += StringUtils::Format(
+          "\nGUI: rendered {:.0f}% of screen, skipped {:.0f}% behind opaque controls ({} controls)",
+          100.0f * stats.renderedArea / stats.screenArea,
+          stats.renderedArea > 0.0f ? 100.0f * stats.skippedArea / stats.renderedArea : 0.0f,
+          stats.skippedControls);
+
+    info += StringUtils::Format("\nRENDER: idle {:.0f}%", g_application.GetIdlePercent());
+
+    float p50, p90, p99;
+    if (CInputLatencyTracker::IsEnabled() &&
+        CInputLatencyTracker::GetInstance().GetPercentiles(
+            CServiceBroker::GetGUI()->GetWindowManager().GetActiveWindowOrDialog(), p50, p90, p99))
+      info += StringUtils::Format("\nINPUT LATENCY: p50 {:.0f} ms, p90 {:.0f} ms, p99 {:.0f} ms",
+                                  p50, p90, p99);
+
+    constexpr int64_t MB = 1024 * 1024;
+    info += StringUtils::Format("\nTEXTURES: {}/{} MB", CTextureMemory::GetTotalUsage() / MB,
+                                CTextureMemory::GetTotalBudget() / MB);
+    for (int i = 0; i < static_cast<int>(TextureConsumer::COUNT); ++i)
+    {
+      const auto consumer = static_cast<TextureConsumer>(i);
+      info += StringUtils::Format(" - {}: {}/{} MB{}", CTextureMemory::GetName(consumer),
+                                  CTextureMemory::GetUsage(consumer) / MB,
+                                  CTextureMemory::GetBudget(consumer) / MB,
+                                  CTextureMemory::IsUnderPressure(consumer) ? " (pressure)" : "");
+    }
+
+    const auto jobManager = CServiceBroker::GetJobManager();
+    size_t queued, processing, workers;
+    jobManager->GetQueueInfo(queued, processing, workers);
+    info += StringUtils::Format("\nJOBS: {} queued, {} running, {} workers", queued, processing,
+                                workers);
+
+    // the job type that waits longest for a worker on average
+    const CJobManager::JobStatistics* slowest = nullptr;
+    const auto jobStats = jobManager->GetStatistics();
+    for (const auto& job : jobStats)
+    {
+      if (job.completed > 0 &&
+          (!slowest || job.queuedTime / job.completed > slowest->queuedTime / slowest->completed))
+        slowest = &job;
+    }
+    if (slowest)
+      info += StringUtils::Format(" - {}: {} ms queued, {} ms run", slowest->type,
+                                  (slowest->queuedTime / slowest->completed).count() / 1000,
+                                  (slowest->runTime / slowest->completed).count() / 1000);
   }
 
   // render the skin debug info